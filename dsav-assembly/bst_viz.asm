@@ -33,6 +33,8 @@ define(NODE_SIZE, 24)
 bst_root:           .quad 0                 // Root pointer
 bst_node_count:     .word 0                 // Number of nodes in tree
 bst_height:         .word 0                 // Tree height
+    .balign 8
+bst_generation:     .quad 0                 // Bumped by insert, delete and free_all
 
 // ----------------------------------------------------------------------------
 // UI Strings
@@ -191,6 +193,7 @@ insert_success:
     ldr     w1, [x0]
     add     w1, w1, 1
     str     w1, [x0]
+    BUMP_GENERATION(bst_generation)
     ldr     x21, [x19]
 
 insert_done:
@@ -272,6 +275,7 @@ bst_delete:
     ldr     x0, [x19]                    // Load root
     bl      bst_delete_node              // Call recursive delete
     str     x0, [x19]                    // Store new root
+    BUMP_GENERATION(bst_generation)      // Also on a miss; views just resync
 
     mov     x0, x0                       // Return root
     ldp     x21, x22, [sp, 32]
@@ -562,6 +566,7 @@ bst_free_all:
     add     x0, x0, :lo12:bst_node_count
     mov     w1, 0
     str     w1, [x0]
+    BUMP_GENERATION(bst_generation)
 
     ldp     x19, x20, [sp, 16]
     ldp     x29, x30, [sp], 32
@@ -594,6 +599,15 @@ bst_free_recursive:
 free_rec_done:
     ret
 
+// ============================================================================
+// bst_get_generation - Get the BST generation counter
+// ============================================================================
+// Output: x0 = generation (bumped by insert, delete and free_all)
+// ============================================================================
+    .global bst_get_generation
+bst_get_generation:
+    GET_GENERATION(bst_generation)
+
 // ============================================================================
 // FUNCTION: bst_menu
 // Main menu for BST operations
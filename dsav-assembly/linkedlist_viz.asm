@@ -25,6 +25,8 @@ node_size = 16
 
 list_head:      .quad 0                     // Pointer to first node (NULL = empty)
 list_count:     .word 0                     // Number of nodes in list
+    .balign 8
+list_generation: .quad 0                   // Bumped on every change
 
 // ----------------------------------------------------------------------------
 // UI Strings
@@ -336,6 +338,7 @@ list_insert_front:
     ldr     w2, [x1]
     add     w2, w2, 1
     str     w2, [x1]
+    BUMP_GENERATION(list_generation)
 
     mov     w0, 1                            // Success
     b       list_insert_front_done
@@ -407,6 +410,7 @@ list_insert_back_success:
     ldr     w2, [x1]
     add     w2, w2, 1
     str     w2, [x1]
+    BUMP_GENERATION(list_generation)
 
     mov     w0, 1                            // Success
     b       list_insert_back_done
@@ -491,6 +495,7 @@ list_delete_success:
     ldr     w2, [x1]
     sub     w2, w2, 1
     str     w2, [x1]
+    BUMP_GENERATION(list_generation)
 
     mov     w0, 1                            // Success
     b       list_delete_done
@@ -591,6 +596,7 @@ list_free_all_done:
     adrp    x1, list_count
     add     x1, x1, :lo12:list_count
     str     w2, [x1]
+    BUMP_GENERATION(list_generation)
 
     ldp     x19, x20, [sp, 16]
     ldp     x29, x30, [sp], 32
@@ -1244,3 +1250,45 @@ list_display_hl_done:
     ldp     x19, x20, [sp, 16]
     ldp     x29, x30, [sp], 48
     ret
+
+// ============================================================================
+// C++ INTERFACE FUNCTIONS (for asm-linked version)
+// These functions expose internal state for visualization and benchmarking
+// ============================================================================
+
+// ============================================================================
+// FUNCTION: list_get_head
+// Get pointer to first node (for C++ visualization)
+// Parameters: none
+// Returns: x0 = head node pointer (NULL if empty)
+// ============================================================================
+    .global list_get_head
+list_get_head:
+    adrp    x0, list_head
+    add     x0, x0, :lo12:list_head
+    ldr     x0, [x0]
+    ret
+
+// ============================================================================
+// FUNCTION: list_get_count
+// Get number of nodes (for C++ visualization)
+// Parameters: none
+// Returns: w0 = node count
+// ============================================================================
+    .global list_get_count
+list_get_count:
+    adrp    x0, list_count
+    add     x0, x0, :lo12:list_count
+    ldr     w0, [x0]
+    ret
+
+// ============================================================================
+// FUNCTION: list_get_generation
+// Get the list generation counter (for C++ visualization)
+// Bumped by every routine that changes the list
+// Parameters: none
+// Returns: x0 = generation
+// ============================================================================
+    .global list_get_generation
+list_get_generation:
+    GET_GENERATION(list_generation)
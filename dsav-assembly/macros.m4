@@ -80,6 +80,31 @@ define(`NODE_DATA_OFFSET', `0')
 define(`NODE_NEXT_OFFSET', `8')
 define(`NODE_SIZE', `16')
 
+dnl ----------------------------------------------------------------------------
+dnl GENERATION COUNTERS
+dnl Each data structure keeps a 64-bit counter that every mutating routine
+dnl bumps, so C++ views can skip resyncing when nothing changed.
+dnl ----------------------------------------------------------------------------
+
+dnl Increment a .quad counter (clobbers x9, x10)
+dnl Usage: BUMP_GENERATION(stack_generation)
+define(`BUMP_GENERATION', `
+    adrp    x9, $1
+    add     x9, x9, :lo12:$1
+    ldr     x10, [x9]
+    add     x10, x10, 1
+    str     x10, [x9]
+')
+
+dnl Accessor returning a counter in x0
+dnl Usage: GET_GENERATION(stack_generation)
+define(`GET_GENERATION', `
+    adrp    x0, $1
+    add     x0, x0, :lo12:$1
+    ldr     x0, [x0]
+    ret
+')
+
 dnl ----------------------------------------------------------------------------
 dnl UTILITY MACROS
 dnl ----------------------------------------------------------------------------
@@ -21,6 +21,8 @@ queue_data:     .skip queue_max_size * 4    // Queue storage (8 x 4 bytes)
 queue_front:    .word 0                     // Front index
 queue_rear:     .word -1                    // Rear index (-1 = empty)
 queue_count:    .word 0                     // Current element count
+    .balign 8
+queue_generation: .quad 0                  // Bumped on every change
 
 // ----------------------------------------------------------------------------
 // UI Strings
@@ -434,25 +436,26 @@ queue_enqueue:
     // Load rear
     adrp    x22, queue_rear
     add     x22, x22, :lo12:queue_rear
-    ldr     w23, [x22]
+    ldr     w9, [x22]
 
     // Calculate new rear: (rear + 1) % max_size
-    add     w23, w23, 1
-    mov     w24, queue_max_size
-    udiv    w25, w23, w24                   // w25 = (rear+1) / max_size
-    msub    w23, w25, w24, w23              // w23 = (rear+1) % max_size
+    add     w9, w9, 1
+    mov     w10, queue_max_size
+    udiv    w11, w9, w10                    // w11 = (rear+1) / max_size
+    msub    w9, w11, w10, w9                // w9 = (rear+1) % max_size
 
     // Store value at new rear
-    adrp    x24, queue_data
-    add     x24, x24, :lo12:queue_data
-    str     w19, [x24, w23, SXTW 2]
+    adrp    x10, queue_data
+    add     x10, x10, :lo12:queue_data
+    str     w19, [x10, w9, SXTW 2]
 
     // Update rear
-    str     w23, [x22]
+    str     w9, [x22]
 
     // Increment count
     add     w21, w21, 1
     str     w21, [x20]
+    BUMP_GENERATION(queue_generation)
 
     mov     w0, 1                            // Success
     b       queue_enqueue_ret
@@ -495,15 +498,15 @@ queue_dequeue:
     ldr     w22, [x21]
 
     // Get value at front
-    adrp    x23, queue_data
-    add     x23, x23, :lo12:queue_data
-    ldr     w0, [x23, w22, SXTW 2]          // Return value
+    adrp    x9, queue_data
+    add     x9, x9, :lo12:queue_data
+    ldr     w0, [x9, w22, SXTW 2]           // Return value
 
     // Calculate new front: (front + 1) % max_size
     add     w22, w22, 1
-    mov     w24, queue_max_size
-    udiv    w25, w22, w24
-    msub    w22, w25, w24, w22
+    mov     w10, queue_max_size
+    udiv    w11, w22, w10
+    msub    w22, w11, w10, w22
 
     // Update front
     str     w22, [x21]
@@ -511,6 +514,7 @@ queue_dequeue:
     // Decrement count
     sub     w20, w20, 1
     str     w20, [x19]
+    BUMP_GENERATION(queue_generation)
 
     b       queue_dequeue_ret
 
@@ -546,14 +550,14 @@ queue_peek:
     b.le    queue_peek_fail
 
     // Load front
-    adrp    x21, queue_front
-    add     x21, x21, :lo12:queue_front
-    ldr     w22, [x21]
+    adrp    x9, queue_front
+    add     x9, x9, :lo12:queue_front
+    ldr     w10, [x9]
 
     // Get value at front (don't remove)
-    adrp    x23, queue_data
-    add     x23, x23, :lo12:queue_data
-    ldr     w0, [x23, w22, SXTW 2]
+    adrp    x11, queue_data
+    add     x11, x11, :lo12:queue_data
+    ldr     w0, [x11, w10, SXTW 2]
 
     b       queue_peek_ret
 
@@ -851,6 +855,7 @@ queue_clear:
     add     x0, x0, :lo12:queue_count
     mov     w1, 0
     str     w1, [x0]
+    BUMP_GENERATION(queue_generation)
 
     ldp     x29, x30, [sp], 16
     ret
@@ -921,3 +926,14 @@ queue_get_count:
 queue_get_capacity:
     mov     w0, queue_max_size
     ret
+
+// ============================================================================
+// FUNCTION: queue_get_generation
+// Get the queue generation counter (for C++ visualization)
+// Bumped by every routine that changes the queue
+// Parameters: none
+// Returns: x0 = generation
+// ============================================================================
+    .global queue_get_generation
+queue_get_generation:
+    GET_GENERATION(queue_generation)
@@ -0,0 +1,525 @@
+// ============================================================================
+// sort_kernels.asm - Headless Sorting Kernels
+// ============================================================================
+// Sorting routines that work on caller-owned arrays, with no display,
+// delays or global state, for the asm-linked version and dsav-asm-bench:
+//   - Bubble Sort (stops after a pass without swaps)
+//   - Insertion Sort
+//   - Merge Sort (bottom-up, caller-provided or malloc'd scratch buffer)
+//   - Quick Sort (median-of-three Hoare partition, explicit range stack)
+// Bubble and insertion sort return the number of element comparisons they
+// made, counted the same way as the pure C++ steppers, so both backends can
+// be checked against each other. They are leaf functions that only touch
+// caller-saved registers.
+//
+// Merge and quick sort hand every run of up to 16 elements to a NEON
+// sorting network instead of comparing one pair at a time, so their counts
+// are not comparable with the steppers and they return nothing. They save
+// the callee-saved registers they use; the network only uses v0-v7 and
+// v16-v23, so the callee-saved low halves of v8-v15 are never touched.
+// ============================================================================
+
+include(`macros.m4')
+
+// ----------------------------------------------------------------------------
+// NEON sorting network helpers
+// ----------------------------------------------------------------------------
+
+// Largest run handled by the network
+define(NETWORK_SIZE, 16)
+
+// BITONIC_CLEAN(x, y, t0, t1, t2, t3)
+// Sorts the bitonic 4-lane sequences in x and y, each on its own, with
+// compare-exchanges at distance 2 and then 1. Clobbers t0-t3.
+define(`BITONIC_CLEAN', `
+    zip1    $3.2d, $1.2d, $2.2d              // lanes 0,1 of x and y
+    zip2    $4.2d, $1.2d, $2.2d              // lanes 2,3 of x and y
+    smin    $5.4s, $3.4s, $4.4s
+    smax    $6.4s, $3.4s, $4.4s
+    zip1    $1.2d, $5.2d, $6.2d
+    zip2    $2.2d, $5.2d, $6.2d
+    uzp1    $3.4s, $1.4s, $2.4s              // even lanes of x and y
+    uzp2    $4.4s, $1.4s, $2.4s              // odd lanes of x and y
+    smin    $5.4s, $3.4s, $4.4s
+    smax    $6.4s, $3.4s, $4.4s
+    zip1    $1.4s, $5.4s, $6.4s
+    zip2    $2.4s, $5.4s, $6.4s
+')
+
+// REVERSE_LANES(dst, src)
+// Reverses the four 32-bit lanes of src into dst
+define(`REVERSE_LANES', `
+    rev64   $1.4s, $2.4s
+    ext     $1.16b, $1.16b, $1.16b, 8
+')
+
+// SORT_NETWORK_16(ptr)
+// Sorts the 16 ints at [ptr] in place:
+//   1. 4-input network down the columns of v0-v3 (each lane sorted)
+//   2. 4x4 transpose, giving four sorted runs of 4
+//   3. Bitonic merges 4+4 -> 8 (twice), then 8+8 -> 16
+// Clobbers v0-v7 and v16-v21.
+define(`SORT_NETWORK_16', `
+    ld1     {v0.4s, v1.4s, v2.4s, v3.4s}, [$1]
+
+    // Column network: (0,1) (2,3) (0,2) (1,3) (1,2)
+    smin    v4.4s, v0.4s, v1.4s
+    smax    v1.4s, v0.4s, v1.4s
+    smin    v5.4s, v2.4s, v3.4s
+    smax    v3.4s, v2.4s, v3.4s
+    smin    v0.4s, v4.4s, v5.4s
+    smax    v2.4s, v4.4s, v5.4s
+    smin    v6.4s, v1.4s, v3.4s
+    smax    v3.4s, v1.4s, v3.4s
+    smin    v1.4s, v2.4s, v6.4s
+    smax    v2.4s, v2.4s, v6.4s
+
+    // Transpose so each register holds one sorted column
+    trn1    v4.4s, v0.4s, v1.4s
+    trn2    v5.4s, v0.4s, v1.4s
+    trn1    v6.4s, v2.4s, v3.4s
+    trn2    v7.4s, v2.4s, v3.4s
+    trn1    v0.2d, v4.2d, v6.2d
+    trn1    v1.2d, v5.2d, v7.2d
+    trn2    v2.2d, v4.2d, v6.2d
+    trn2    v3.2d, v5.2d, v7.2d
+
+    // Merge v0+v1 into v17:v18 and v2+v3 into v19:v20
+    REVERSE_LANES(v16, v1)
+    smin    v17.4s, v0.4s, v16.4s
+    smax    v18.4s, v0.4s, v16.4s
+    REVERSE_LANES(v16, v3)
+    smin    v19.4s, v2.4s, v16.4s
+    smax    v20.4s, v2.4s, v16.4s
+    BITONIC_CLEAN(v17, v18, v4, v5, v6, v7)
+    BITONIC_CLEAN(v19, v20, v4, v5, v6, v7)
+
+    // Merge v17:v18 with v19:v20 (second run reversed)
+    REVERSE_LANES(v16, v20)
+    REVERSE_LANES(v21, v19)
+    smin    v0.4s, v17.4s, v16.4s
+    smax    v2.4s, v17.4s, v16.4s
+    smin    v1.4s, v18.4s, v21.4s
+    smax    v3.4s, v18.4s, v21.4s
+    smin    v4.4s, v0.4s, v1.4s
+    smax    v5.4s, v0.4s, v1.4s
+    smin    v6.4s, v2.4s, v3.4s
+    smax    v7.4s, v2.4s, v3.4s
+    BITONIC_CLEAN(v4, v5, v16, v17, v18, v19)
+    BITONIC_CLEAN(v6, v7, v16, v17, v18, v19)
+
+    st1     {v4.4s, v5.4s, v6.4s, v7.4s}, [$1]
+')
+
+    .text
+    .balign 4
+
+// ============================================================================
+// FUNCTION: bubble_sort_array
+// Bubble sort in place
+// Parameters:
+//   x0 = pointer to array
+//   w1 = number of elements
+// Returns:
+//   x0 = number of comparisons
+// ============================================================================
+    .global bubble_sort_array
+bubble_sort_array:
+    mov     x9, x0                           // x9 = array
+    mov     x0, 0                            // x0 = comparisons
+    sub     w10, w1, 1                       // w10 = comparisons in this pass
+
+bubble_array_pass:
+    cmp     w10, 0
+    b.le    bubble_array_done
+
+    mov     w11, 0                           // w11 = j
+    mov     w12, 0                           // w12 = swapped flag
+    mov     x13, x9                          // x13 = &arr[j]
+
+bubble_array_inner:
+    ldp     w14, w15, [x13]                  // arr[j], arr[j+1]
+    add     x0, x0, 1
+    cmp     w14, w15
+    b.le    bubble_array_next
+
+    stp     w15, w14, [x13]                  // Swap
+    mov     w12, 1
+
+bubble_array_next:
+    add     x13, x13, 4
+    add     w11, w11, 1
+    cmp     w11, w10
+    b.lt    bubble_array_inner
+
+    // A pass without swaps means the array is sorted
+    cbz     w12, bubble_array_done
+    sub     w10, w10, 1
+    b       bubble_array_pass
+
+bubble_array_done:
+    ret
+
+// ============================================================================
+// FUNCTION: insertion_sort_array
+// Insertion sort in place
+// Parameters:
+//   x0 = pointer to array
+//   w1 = number of elements
+// Returns:
+//   x0 = number of comparisons
+// ============================================================================
+    .global insertion_sort_array
+insertion_sort_array:
+    mov     x9, x0                           // x9 = array
+    mov     x0, 0                            // x0 = comparisons
+    mov     w10, 1                           // w10 = i
+
+insertion_array_outer:
+    cmp     w10, w1
+    b.ge    insertion_array_done
+
+    ldr     w11, [x9, w10, SXTW 2]           // w11 = key = arr[i]
+    sub     w12, w10, 1                      // w12 = j
+
+insertion_array_shift:
+    tbnz    w12, 31, insertion_array_place   // j < 0: key goes to the front
+    ldr     w13, [x9, w12, SXTW 2]           // arr[j]
+    add     x0, x0, 1
+    cmp     w13, w11
+    b.le    insertion_array_place
+
+    add     w14, w12, 1
+    str     w13, [x9, w14, SXTW 2]           // arr[j+1] = arr[j]
+    sub     w12, w12, 1
+    b       insertion_array_shift
+
+insertion_array_place:
+    add     w14, w12, 1
+    str     w11, [x9, w14, SXTW 2]           // arr[j+1] = key
+    add     w10, w10, 1
+    b       insertion_array_outer
+
+insertion_array_done:
+    ret
+
+// ============================================================================
+// FUNCTION: sort_small_array
+// Sorts a run of at most 16 elements with the NEON network. Shorter runs
+// are padded with INT_MAX in a stack buffer, sorted there and copied back.
+// Leaf function; only touches caller-saved registers.
+// Parameters:
+//   x0 = pointer to array
+//   w1 = number of elements (0-16)
+// ============================================================================
+sort_small_array:
+    cmp     w1, NETWORK_SIZE
+    b.lt    sort_small_padded
+    SORT_NETWORK_16(x0)
+    ret
+
+sort_small_padded:
+    cmp     w1, 1
+    b.le    sort_small_done                  // Nothing to order
+
+    sub     sp, sp, 64
+    mov     w9, 0x7fffffff
+    dup     v16.4s, w9
+    stp     q16, q16, [sp]
+    stp     q16, q16, [sp, 32]
+
+    mov     w10, 0
+sort_small_copy_in:
+    ldr     w9, [x0, w10, UXTW 2]
+    str     w9, [sp, w10, UXTW 2]
+    add     w10, w10, 1
+    cmp     w10, w1
+    b.lt    sort_small_copy_in
+
+    mov     x11, sp
+    SORT_NETWORK_16(x11)
+
+    // Padding sorts to the end, so the first w1 slots are the result
+    mov     w10, 0
+sort_small_copy_out:
+    ldr     w9, [sp, w10, UXTW 2]
+    str     w9, [x0, w10, UXTW 2]
+    add     w10, w10, 1
+    cmp     w10, w1
+    b.lt    sort_small_copy_out
+
+    add     sp, sp, 64
+
+sort_small_done:
+    ret
+
+// ============================================================================
+// FUNCTION: merge_sort
+// Bottom-up merge sort in place. Runs of 16 are sorted by the NEON network,
+// then merged pairwise, ping-ponging between the array and the scratch
+// buffer; the result is copied back if it ends up in the scratch buffer.
+// Parameters:
+//   x0 = pointer to array
+//   w1 = number of elements
+//   x2 = scratch buffer of at least w1 ints, or NULL to malloc one
+//        (if that fails the array is left unsorted)
+// ============================================================================
+    .global merge_sort
+merge_sort:
+    stp     x29, x30, [sp, -80]!
+    mov     x29, sp
+    stp     x19, x20, [sp, 16]
+    stp     x21, x22, [sp, 32]
+    stp     x23, x24, [sp, 48]
+    stp     x25, x26, [sp, 64]
+
+    cmp     w1, 1
+    b.le    merge_array_return
+
+    mov     x19, x0                          // x19 = array
+    sxtw    x20, w1                          // x20 = n
+    mov     x21, x2                          // x21 = scratch buffer
+    mov     x26, 0                           // x26 = buffer to free on exit
+    cbnz    x21, merge_array_blocks
+
+    lsl     x0, x20, 2
+    bl      malloc
+    cbz     x0, merge_array_return
+    mov     x21, x0
+    mov     x26, x0
+
+    // Base case: sort each run of 16 (the last one may be shorter)
+merge_array_blocks:
+    mov     x25, 0                           // x25 = run start
+merge_array_block_loop:
+    sub     x1, x20, x25                     // Elements left
+    cmp     x1, 0
+    b.le    merge_array_passes
+    cmp     x1, NETWORK_SIZE
+    mov     x9, NETWORK_SIZE
+    csel    x1, x1, x9, lt
+    add     x0, x19, x25, LSL 2
+    bl      sort_small_array
+    add     x25, x25, NETWORK_SIZE
+    b       merge_array_block_loop
+
+merge_array_passes:
+    mov     x22, x19                         // x22 = source
+    mov     x23, x21                         // x23 = destination
+    mov     x24, NETWORK_SIZE                // x24 = run width
+
+merge_array_pass:
+    cmp     x24, x20
+    b.ge    merge_array_copy_back
+    mov     x25, 0                           // x25 = lo
+
+merge_array_pair:
+    cmp     x25, x20
+    b.ge    merge_array_pass_done
+
+    add     x9, x25, x24                     // x9 = mid = min(lo + width, n)
+    cmp     x9, x20
+    csel    x9, x9, x20, lt
+    add     x10, x9, x24                     // x10 = hi = min(mid + width, n)
+    cmp     x10, x20
+    csel    x10, x10, x20, lt
+
+    add     x11, x22, x25, LSL 2             // x11 = left cursor
+    add     x12, x22, x9, LSL 2              // x12 = left end
+    mov     x13, x12                         // x13 = right cursor
+    add     x14, x22, x10, LSL 2             // x14 = right end
+    add     x15, x23, x25, LSL 2             // x15 = output cursor
+
+merge_array_merge:
+    cmp     x11, x12
+    b.hs    merge_array_rest_left
+    cmp     x13, x14
+    b.hs    merge_array_rest_left
+
+    ldr     w16, [x11]
+    ldr     w17, [x13]
+    cmp     w17, w16
+    b.lt    merge_array_take_right           // Ties take the left run (stable)
+
+    str     w16, [x15], 4
+    add     x11, x11, 4
+    b       merge_array_merge
+
+merge_array_take_right:
+    str     w17, [x15], 4
+    add     x13, x13, 4
+    b       merge_array_merge
+
+    // One run is exhausted; copy what is left of the other
+merge_array_rest_left:
+    cmp     x11, x12
+    b.hs    merge_array_rest_right
+    ldr     w16, [x11], 4
+    str     w16, [x15], 4
+    b       merge_array_rest_left
+
+merge_array_rest_right:
+    cmp     x13, x14
+    b.hs    merge_array_pair_done
+    ldr     w17, [x13], 4
+    str     w17, [x15], 4
+    b       merge_array_rest_right
+
+merge_array_pair_done:
+    mov     x25, x10                         // lo = hi
+    b       merge_array_pair
+
+merge_array_pass_done:
+    mov     x9, x22                          // Swap source and destination
+    mov     x22, x23
+    mov     x23, x9
+    lsl     x24, x24, 1
+    b       merge_array_pass
+
+merge_array_copy_back:
+    cmp     x22, x19
+    b.eq    merge_array_free
+    mov     x0, x19
+    mov     x1, x22
+    lsl     x2, x20, 2
+    bl      memcpy
+
+merge_array_free:
+    cbz     x26, merge_array_return
+    mov     x0, x26
+    bl      free
+
+merge_array_return:
+    ldp     x25, x26, [sp, 64]
+    ldp     x23, x24, [sp, 48]
+    ldp     x21, x22, [sp, 32]
+    ldp     x19, x20, [sp, 16]
+    ldp     x29, x30, [sp], 80
+    ret
+
+// ============================================================================
+// FUNCTION: quick_sort
+// Quick sort in place. Each range is partitioned around the median of its
+// first, middle and last elements (Hoare scheme); the larger side is pushed
+// on a range stack and the smaller one is sorted next, so the stack never
+// holds more than log2(n) ranges. Ranges of 16 or fewer go to the NEON
+// network.
+// Parameters:
+//   x0 = pointer to array
+//   w1 = number of elements
+// ============================================================================
+define(QUICK_STACK_BYTES, 1024)              // 64 pending ranges of (lo, hi)
+
+    .global quick_sort
+quick_sort:
+    stp     x29, x30, [sp, -64]!
+    mov     x29, sp
+    stp     x19, x20, [sp, 16]
+    stp     x21, x22, [sp, 32]
+    stp     x23, x24, [sp, 48]
+    sub     sp, sp, QUICK_STACK_BYTES
+
+    cmp     w1, 1
+    b.le    quick_array_return
+
+    mov     x19, x0                          // x19 = array
+    sxtw    x20, w1                          // x20 = n
+    mov     x21, 0                           // x21 = pending ranges
+    mov     x22, 0                           // x22 = lo
+    sub     x23, x20, 1                      // x23 = hi (inclusive)
+
+quick_array_range:
+    sub     x9, x23, x22
+    add     x9, x9, 1                        // x9 = length
+    cmp     x9, NETWORK_SIZE
+    b.gt    quick_array_partition
+
+    add     x0, x19, x22, LSL 2
+    mov     w1, w9
+    bl      sort_small_array
+
+quick_array_pop:
+    cbz     x21, quick_array_return
+    sub     x21, x21, 1
+    add     x9, sp, x21, LSL 4
+    ldp     x22, x23, [x9]
+    b       quick_array_range
+
+quick_array_partition:
+    // Order arr[lo] <= arr[mid] <= arr[hi]; arr[mid] is the pivot, and the
+    // two ends bound both scans
+    sub     x9, x23, x22
+    add     x9, x22, x9, LSR 1               // x9 = mid
+    add     x10, x19, x22, LSL 2             // x10 = &arr[lo]
+    add     x11, x19, x9, LSL 2              // x11 = &arr[mid]
+    add     x12, x19, x23, LSL 2             // x12 = &arr[hi]
+    ldr     w13, [x10]
+    ldr     w14, [x11]
+    ldr     w15, [x12]
+
+    cmp     w13, w14
+    csel    w16, w13, w14, le
+    csel    w14, w14, w13, le
+    mov     w13, w16
+    cmp     w14, w15
+    csel    w16, w14, w15, le
+    csel    w15, w15, w14, le
+    mov     w14, w16
+    cmp     w13, w14
+    csel    w16, w13, w14, le
+    csel    w14, w14, w13, le
+    mov     w13, w16
+
+    str     w13, [x10]
+    str     w14, [x11]
+    str     w15, [x12]
+    mov     w16, w14                         // w16 = pivot
+
+    sub     x10, x10, 4                      // i = lo - 1
+    add     x12, x12, 4                      // j = hi + 1
+
+quick_array_scan_left:
+    ldr     w13, [x10, 4]!
+    cmp     w13, w16
+    b.lt    quick_array_scan_left
+
+quick_array_scan_right:
+    ldr     w14, [x12, -4]!
+    cmp     w14, w16
+    b.gt    quick_array_scan_right
+
+    cmp     x10, x12
+    b.hs    quick_array_split
+    str     w14, [x10]
+    str     w13, [x12]
+    b       quick_array_scan_left
+
+quick_array_split:
+    // Split into [lo, j] and [j + 1, hi]
+    sub     x9, x12, x19
+    asr     x9, x9, 2                        // x9 = j
+    sub     x10, x9, x22
+    add     x10, x10, 1                      // x10 = left length
+    sub     x11, x23, x9                     // x11 = right length
+    add     x12, sp, x21, LSL 4              // x12 = next free range slot
+    add     x21, x21, 1
+    cmp     x10, x11
+    b.gt    quick_array_left_larger
+
+    add     x13, x9, 1                       // Push the right side
+    stp     x13, x23, [x12]
+    mov     x23, x9
+    b       quick_array_range
+
+quick_array_left_larger:
+    stp     x22, x9, [x12]                   // Push the left side
+    add     x22, x9, 1
+    b       quick_array_range
+
+quick_array_return:
+    add     sp, sp, QUICK_STACK_BYTES
+    ldp     x23, x24, [sp, 48]
+    ldp     x21, x22, [sp, 32]
+    ldp     x19, x20, [sp, 16]
+    ldp     x29, x30, [sp], 64
+    ret
@@ -19,6 +19,8 @@ include(`macros.m4')
 stack_max_size = 8                          // Maximum stack capacity
 stack_data:     .skip stack_max_size * 4    // Stack storage (8 x 4 bytes)
 stack_top:      .word -1                    // Top index (-1 = empty)
+    .balign 8
+stack_generation: .quad 0                  // Bumped on every change
 
 // ----------------------------------------------------------------------------
 // UI Strings
@@ -424,20 +426,21 @@ stack_push:
     // Load stack top
     adrp    x20, stack_top
     add     x20, x20, :lo12:stack_top
-    ldr     w21, [x20]
+    ldr     w9, [x20]
 
     // Check for overflow
-    cmp     w21, stack_max_size - 1
+    cmp     w9, stack_max_size - 1
     b.ge    stack_push_fail
 
     // Increment top
-    add     w21, w21, 1
-    str     w21, [x20]
+    add     w9, w9, 1
+    str     w9, [x20]
 
     // Store value
     adrp    x20, stack_data
     add     x20, x20, :lo12:stack_data
-    str     w19, [x20, w21, SXTW 2]
+    str     w19, [x20, w9, SXTW 2]
+    BUMP_GENERATION(stack_generation)
 
     mov     w0, 1                            // Success
     b       stack_push_ret
@@ -473,13 +476,14 @@ stack_pop:
     b.lt    stack_pop_fail
 
     // Get value
-    adrp    x21, stack_data
-    add     x21, x21, :lo12:stack_data
-    ldr     w0, [x21, w20, SXTW 2]
+    adrp    x9, stack_data
+    add     x9, x9, :lo12:stack_data
+    ldr     w0, [x9, w20, SXTW 2]
 
     // Decrement top
     sub     w20, w20, 1
     str     w20, [x19]
+    BUMP_GENERATION(stack_generation)
 
     b       stack_pop_ret
 
@@ -514,9 +518,9 @@ stack_peek:
     b.lt    stack_peek_fail
 
     // Get value (don't remove)
-    adrp    x21, stack_data
-    add     x21, x21, :lo12:stack_data
-    ldr     w0, [x21, w20, SXTW 2]
+    adrp    x9, stack_data
+    add     x9, x9, :lo12:stack_data
+    ldr     w0, [x9, w20, SXTW 2]
 
     b       stack_peek_ret
 
@@ -749,6 +753,7 @@ stack_clear:
     add     x0, x0, :lo12:stack_top
     mov     w1, -1
     str     w1, [x0]
+    BUMP_GENERATION(stack_generation)
 
     ldp     x29, x30, [sp], 16
     ret
@@ -793,3 +798,14 @@ stack_get_top:
 stack_get_capacity:
     mov     w0, stack_max_size
     ret
+
+// ============================================================================
+// FUNCTION: stack_get_generation
+// Get the stack generation counter (for C++ visualization)
+// Bumped by every routine that changes the stack
+// Parameters: none
+// Returns: x0 = generation
+// ============================================================================
+    .global stack_get_generation
+stack_get_generation:
+    GET_GENERATION(stack_generation)
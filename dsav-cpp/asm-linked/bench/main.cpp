@@ -0,0 +1,614 @@
+/**
+ * @file main.cpp
+ * @brief Entry point for dsav-asm-bench, the pure C++ vs assembly benchmark
+ *
+ * Runs the same pre-generated operation mix through the pure C++ containers
+ * and steppers and through the ARMv8 assembly implementations, then reports
+ * throughput, per-op latency percentiles and cycles per op for each backend.
+ * Every operation's result is recorded on both sides and compared, so a
+ * speedup is only reported for runs that produced identical results.
+ *
+ * Cycles come from the kernel's hardware cycle event (the PMU cycle counter
+ * on ARM); where that is unavailable the column shows "n/a".
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "asm_interface.hpp"
+#include "asm_view.hpp"
+#include "data_structures/stack.hpp"
+#include "data_structures/queue.hpp"
+#include "data_structures/linked_list.hpp"
+#include "data_structures/binary_search_tree.hpp"
+#include "algorithms/sorting.hpp"
+
+namespace {
+
+// ===== Configuration =====
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t ASM_STACK_CAPACITY = 8;    ///< stack_max_size in stack_viz.asm
+constexpr size_t ASM_QUEUE_CAPACITY = 8;    ///< queue_max_size in queue_viz.asm
+constexpr size_t DEFAULT_OPS = 1000000;     ///< Operations per stack/queue run
+constexpr size_t DEFAULT_NODES = 4000;      ///< Inserts per list/BST run (list inserts are O(n))
+constexpr size_t DEFAULT_SORT_SIZE = 1000;  ///< Elements per sort call
+constexpr size_t DEFAULT_SORT_RUNS = 50;    ///< Sort calls per run
+constexpr std::uint32_t DEFAULT_SEED = 42;
+constexpr size_t BATCH_OPS = 256;           ///< Container ops timed together for one latency sample
+
+const char* const WORKLOADS[] = {"stack", "queue", "list", "bst", "bubble", "insertion", "merge", "quick"};
+
+struct Options {
+    size_t ops = DEFAULT_OPS;
+    size_t nodes = DEFAULT_NODES;
+    size_t sortSize = DEFAULT_SORT_SIZE;
+    size_t sortRuns = DEFAULT_SORT_RUNS;
+    std::uint32_t seed = DEFAULT_SEED;
+    bool csv = false;
+    std::vector<std::string> workloads;  ///< Empty = all
+};
+
+/**
+ * @brief One operation of a stack/queue mix
+ */
+struct Op {
+    bool insert = true;  ///< Push/enqueue, otherwise pop/dequeue
+    int value = 0;
+};
+
+/**
+ * @brief Timing and results of one backend on one workload
+ */
+struct RunResult {
+    size_t ops = 0;
+    double seconds = 0.0;
+    std::vector<double> samples;     ///< ns per op, one per timed batch
+    std::int64_t cycles = -1;        ///< Total cycles, -1 if unavailable
+    std::vector<std::int64_t> trace; ///< Every observable result, compared across backends
+};
+
+// ===== Cycle Counter =====
+
+/**
+ * @brief User-space CPU cycle count via the kernel's hardware cycle event
+ *
+ * On ARM the kernel backs this with the PMU cycle counter (PMCCNTR_EL0),
+ * which user code cannot normally read directly. Opening fails on kernels
+ * without perf events, in most containers, or with a strict
+ * perf_event_paranoid setting; available() then reports false.
+ */
+class CycleCounter {
+public:
+    CycleCounter() {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CycleCounter() {
+#if defined(__linux__)
+        if (m_fd >= 0) close(m_fd);
+#endif
+    }
+
+    CycleCounter(const CycleCounter&) = delete;
+    CycleCounter& operator=(const CycleCounter&) = delete;
+
+    bool available() const { return m_fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (m_fd >= 0) {
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /**
+     * @brief Cycles since start(), or -1 if unavailable
+     */
+    std::int64_t stop() {
+#if defined(__linux__)
+        if (m_fd >= 0) {
+            ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+            std::int64_t count = 0;
+            if (read(m_fd, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count))) {
+                return count;
+            }
+        }
+#endif
+        return -1;
+    }
+
+private:
+    int m_fd = -1;
+};
+
+// ===== Input Generation =====
+
+/**
+ * @brief Random mix of inserts and removals, biased toward inserts so the
+ * containers spend time both full and empty
+ */
+std::vector<Op> makeOps(size_t count, std::mt19937& rng) {
+    std::vector<Op> ops(count);
+    std::uniform_int_distribution<int> kind(0, 99);
+    std::uniform_int_distribution<int> value(-1000000, 1000000);
+    for (Op& op : ops) {
+        op.insert = kind(rng) < 55;
+        op.value = value(rng);
+    }
+    return ops;
+}
+
+std::vector<int> makeValues(size_t count, std::mt19937& rng) {
+    std::vector<int> values(count);
+    std::uniform_int_distribution<int> value(-1000000, 1000000);
+    for (int& v : values) v = value(rng);
+    return values;
+}
+
+// ===== Runners =====
+
+/**
+ * @brief Time body(i) for i in [0, count), one latency sample per batch
+ *
+ * Single container ops are shorter than the clock's resolution, so they are
+ * timed in batches and each sample is the batch's mean ns per op.
+ */
+template <typename Body>
+void timeOps(size_t count, size_t batch, RunResult& result, CycleCounter& cycles, Body body) {
+    result.ops = count;
+    result.samples.reserve(count / batch + 1);
+
+    cycles.start();
+    auto start = Clock::now();
+    for (size_t first = 0; first < count; first += batch) {
+        size_t last = std::min(count, first + batch);
+        auto batchStart = Clock::now();
+        for (size_t i = first; i < last; ++i) {
+            body(i);
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - batchStart).count();
+        result.samples.push_back(ns / static_cast<double>(last - first));
+    }
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.cycles = cycles.stop();
+}
+
+RunResult runStackCpp(const std::vector<Op>& ops, CycleCounter& cycles) {
+    RunResult result;
+    result.trace.reserve(ops.size());
+    dsav::Stack<int, ASM_STACK_CAPACITY> stack;
+    timeOps(ops.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        if (ops[i].insert) {
+            result.trace.push_back(stack.push(ops[i].value) ? 1 : 0);
+        } else {
+            auto value = stack.pop();
+            result.trace.push_back(value ? *value : 0);
+        }
+    });
+    return result;
+}
+
+RunResult runStackAsm(const std::vector<Op>& ops, CycleCounter& cycles) {
+    RunResult result;
+    result.trace.reserve(ops.size());
+    stack_clear();
+    timeOps(ops.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        if (ops[i].insert) {
+            result.trace.push_back(stack_push(ops[i].value));
+        } else {
+            result.trace.push_back(stack_is_empty() ? 0 : stack_pop());
+        }
+    });
+    stack_clear();
+    return result;
+}
+
+RunResult runQueueCpp(const std::vector<Op>& ops, CycleCounter& cycles) {
+    RunResult result;
+    result.trace.reserve(ops.size());
+    dsav::Queue<int, ASM_QUEUE_CAPACITY> queue;
+    timeOps(ops.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        if (ops[i].insert) {
+            result.trace.push_back(queue.enqueue(ops[i].value) ? 1 : 0);
+        } else {
+            auto value = queue.dequeue();
+            result.trace.push_back(value ? *value : 0);
+        }
+    });
+    return result;
+}
+
+RunResult runQueueAsm(const std::vector<Op>& ops, CycleCounter& cycles) {
+    RunResult result;
+    result.trace.reserve(ops.size());
+    queue_clear();
+    timeOps(ops.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        if (ops[i].insert) {
+            result.trace.push_back(queue_enqueue(ops[i].value));
+        } else {
+            result.trace.push_back(queue_is_empty() ? 0 : queue_dequeue());
+        }
+    });
+    queue_clear();
+    return result;
+}
+
+RunResult runListCpp(const std::vector<int>& values, CycleCounter& cycles) {
+    RunResult result;
+    dsav::LinkedList<int> list;
+    timeOps(values.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        list.insertBack(values[i]);
+    });
+    list.traverse([&](const int& value) { result.trace.push_back(value); });
+    return result;
+}
+
+RunResult runListAsm(const std::vector<int>& values, CycleCounter& cycles) {
+    RunResult result;
+    list_free_all();
+    timeOps(values.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        list_insert_back(values[i]);
+    });
+    dsav::AsmListView view;
+    view.refresh();
+    for (const AsmListNode& node : view) {
+        result.trace.push_back(node.data);
+    }
+    list_free_all();
+    return result;
+}
+
+RunResult runBstCpp(const std::vector<int>& values, CycleCounter& cycles) {
+    RunResult result;
+    dsav::BinarySearchTree<int> tree;
+    timeOps(values.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        tree.insert(values[i]);
+    });
+    for (int value : tree.inorder()) {
+        result.trace.push_back(value);
+    }
+    return result;
+}
+
+RunResult runBstAsm(const std::vector<int>& values, CycleCounter& cycles) {
+    RunResult result;
+    AsmBSTNode* root = nullptr;
+    timeOps(values.size(), BATCH_OPS, result, cycles, [&](size_t i) {
+        bst_insert(&root, values[i]);
+    });
+
+    dsav::AsmBstView view(&root);
+    view.refresh();
+    view.forEachInorder([&](const AsmBSTNode& node, size_t) {
+        result.trace.push_back(node.data);
+    });
+    bst_free_all(&root);
+    return result;
+}
+
+/**
+ * @brief Sort each input; one op (and one latency sample) is one whole sort
+ *
+ * The trace holds every output element and each sort's comparison count.
+ */
+template <typename SortFn>
+RunResult runSorts(const std::vector<std::vector<int>>& inputs, CycleCounter& cycles, SortFn sortFn) {
+    RunResult result;
+    std::vector<std::vector<int>> outputs = inputs;
+    std::vector<std::int64_t> comparisons(inputs.size());
+    timeOps(inputs.size(), 1, result, cycles, [&](size_t i) {
+        comparisons[i] = sortFn(outputs[i]);
+    });
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        result.trace.push_back(comparisons[i]);
+        result.trace.insert(result.trace.end(), outputs[i].begin(), outputs[i].end());
+    }
+    return result;
+}
+
+template <typename Stepper>
+std::int64_t sortWithStepper(std::vector<int>& arr) {
+    Stepper stepper(arr);
+    while (stepper.step()) {
+    }
+    return static_cast<std::int64_t>(stepper.getComparisons());
+}
+
+/**
+ * @brief Like sortWithStepper, but reports 0 comparisons
+ *
+ * The assembly merge and quick sorts hand small runs to a NEON sorting
+ * network, so their comparison counts have no stepper equivalent; only the
+ * sorted output is compared.
+ */
+template <typename Stepper>
+std::int64_t sortOutputWithStepper(std::vector<int>& arr) {
+    sortWithStepper<Stepper>(arr);
+    return 0;
+}
+
+// ===== Reporting =====
+
+double percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return samples[index];
+}
+
+std::string formatCycles(const RunResult& result) {
+    if (result.cycles < 0 || result.ops == 0) return "n/a";
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1)
+        << static_cast<double>(result.cycles) / static_cast<double>(result.ops);
+    return oss.str();
+}
+
+void printHeader(bool csv) {
+    if (csv) {
+        std::cout << "workload,backend,ops,mops_per_s,p50_ns,p90_ns,p99_ns,cycles_per_op,match\n";
+        return;
+    }
+    std::cout << std::left << std::setw(11) << "workload"
+              << std::setw(9) << "backend"
+              << std::right << std::setw(10) << "ops"
+              << std::setw(11) << "Mops/s"
+              << std::setw(11) << "p50 ns"
+              << std::setw(11) << "p90 ns"
+              << std::setw(11) << "p99 ns"
+              << std::setw(12) << "cycles/op"
+              << std::setw(8) << "match" << "\n"
+              << std::string(94, '-') << "\n";
+}
+
+void printRow(const std::string& workload, const char* backend, const RunResult& result, bool match,
+              bool csv) {
+    double mops = result.seconds > 0.0 ? static_cast<double>(result.ops) / result.seconds / 1e6 : 0.0;
+    double p50 = percentile(result.samples, 0.50);
+    double p90 = percentile(result.samples, 0.90);
+    double p99 = percentile(result.samples, 0.99);
+
+    if (csv) {
+        std::cout << workload << "," << backend << "," << result.ops << "," << mops << ","
+                  << p50 << "," << p90 << "," << p99 << "," << formatCycles(result) << ","
+                  << (match ? "yes" : "NO") << "\n";
+        return;
+    }
+    std::cout << std::left << std::setw(11) << workload
+              << std::setw(9) << backend
+              << std::right << std::setw(10) << result.ops
+              << std::fixed << std::setprecision(3) << std::setw(11) << mops
+              << std::setprecision(1) << std::setw(11) << p50
+              << std::setw(11) << p90
+              << std::setw(11) << p99
+              << std::setw(12) << formatCycles(result)
+              << std::setw(8) << (match ? "yes" : "NO") << "\n";
+}
+
+/**
+ * @brief Print both rows and, if the results agree, the median speedup
+ *
+ * @return true if both backends produced identical results
+ */
+bool report(const std::string& workload, const RunResult& cpp, const RunResult& asmResult, bool csv) {
+    bool match = cpp.trace == asmResult.trace;
+    printRow(workload, "c++", cpp, match, csv);
+    printRow(workload, "asm", asmResult, match, csv);
+
+    if (!csv) {
+        if (match) {
+            double cppP50 = percentile(cpp.samples, 0.50);
+            double asmP50 = percentile(asmResult.samples, 0.50);
+            if (asmP50 > 0.0) {
+                std::cout << "  asm speedup (p50): " << std::setprecision(2) << cppP50 / asmP50 << "x\n";
+            }
+        } else {
+            std::cout << "  results differ: speedup not reported\n";
+        }
+    }
+    return match;
+}
+
+// ===== Command Line =====
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --workload LIST   Comma-separated: stack,queue,list,bst,bubble,insertion,merge,quick\n"
+              << "                    (default all)\n"
+              << "  --ops N           Operations per stack/queue run (default " << DEFAULT_OPS << ")\n"
+              << "  --nodes N         Inserts per list/bst run (default " << DEFAULT_NODES << ")\n"
+              << "  --sort-size N     Elements per sort call (default " << DEFAULT_SORT_SIZE << ")\n"
+              << "  --sort-runs N     Sort calls per run (default " << DEFAULT_SORT_RUNS << ")\n"
+              << "  --seed N          RNG seed (default " << DEFAULT_SEED << ")\n"
+              << "  --csv             Machine-readable output\n"
+              << "  --help            Show this message\n";
+}
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+bool parseSize(const char* text, size_t& out) {
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text, &end, 10);
+    if (end == text || *end != '\0' || value == 0) return false;
+    out = static_cast<size_t>(value);
+    return true;
+}
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--help") {
+            printUsage(argv[0]);
+            std::exit(0);
+        } else if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--workload" && hasValue) {
+            options.workloads = splitList(argv[++i]);
+            for (const std::string& name : options.workloads) {
+                if (std::find(std::begin(WORKLOADS), std::end(WORKLOADS), name) == std::end(WORKLOADS)) {
+                    std::cerr << "Unknown workload: " << name << "\n";
+                    return false;
+                }
+            }
+        } else if (arg == "--ops" && hasValue) {
+            if (!parseSize(argv[++i], options.ops)) return false;
+        } else if (arg == "--nodes" && hasValue) {
+            if (!parseSize(argv[++i], options.nodes)) return false;
+        } else if (arg == "--sort-size" && hasValue) {
+            if (!parseSize(argv[++i], options.sortSize)) return false;
+        } else if (arg == "--sort-runs" && hasValue) {
+            if (!parseSize(argv[++i], options.sortRuns)) return false;
+        } else if (arg == "--seed" && hasValue) {
+            size_t seed = 0;
+            if (!parseSize(argv[++i], seed)) return false;
+            options.seed = static_cast<std::uint32_t>(seed);
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool wants(const Options& options, const char* name) {
+    return options.workloads.empty() ||
+           std::find(options.workloads.begin(), options.workloads.end(), name) != options.workloads.end();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    // The C++ side mirrors the assembly capacities at compile time
+    if (static_cast<size_t>(stack_get_capacity()) != ASM_STACK_CAPACITY ||
+        static_cast<size_t>(queue_get_capacity()) != ASM_QUEUE_CAPACITY) {
+        std::cerr << "Assembly capacities (stack " << stack_get_capacity() << ", queue "
+                  << queue_get_capacity() << ") do not match the benchmark's\n";
+        return 2;
+    }
+
+    CycleCounter cycles;
+    if (!options.csv && !cycles.available()) {
+        std::cout << "Cycle counter unavailable (no perf events or perf_event_paranoid too strict)\n";
+    }
+
+    std::mt19937 rng(options.seed);
+    bool allMatch = true;
+    printHeader(options.csv);
+
+    if (wants(options, "stack")) {
+        std::vector<Op> ops = makeOps(options.ops, rng);
+        RunResult cpp = runStackCpp(ops, cycles);
+        allMatch &= report("stack", cpp, runStackAsm(ops, cycles), options.csv);
+    }
+
+    if (wants(options, "queue")) {
+        std::vector<Op> ops = makeOps(options.ops, rng);
+        RunResult cpp = runQueueCpp(ops, cycles);
+        allMatch &= report("queue", cpp, runQueueAsm(ops, cycles), options.csv);
+    }
+
+    if (wants(options, "list")) {
+        std::vector<int> values = makeValues(options.nodes, rng);
+        RunResult cpp = runListCpp(values, cycles);
+        allMatch &= report("list", cpp, runListAsm(values, cycles), options.csv);
+    }
+
+    if (wants(options, "bst")) {
+        std::vector<int> values = makeValues(options.nodes, rng);
+        RunResult cpp = runBstCpp(values, cycles);
+        allMatch &= report("bst", cpp, runBstAsm(values, cycles), options.csv);
+    }
+
+    std::vector<std::vector<int>> sortInputs;
+    if (wants(options, "bubble") || wants(options, "insertion") || wants(options, "merge") ||
+        wants(options, "quick")) {
+        for (size_t i = 0; i < options.sortRuns; ++i) {
+            sortInputs.push_back(makeValues(options.sortSize, rng));
+        }
+    }
+
+    if (wants(options, "bubble")) {
+        RunResult cpp = runSorts(sortInputs, cycles, sortWithStepper<dsav::algorithms::BubbleSortStepper>);
+        RunResult asmResult = runSorts(sortInputs, cycles, [](std::vector<int>& arr) {
+            return static_cast<std::int64_t>(bubble_sort_array(arr.data(), static_cast<int>(arr.size())));
+        });
+        allMatch &= report("bubble", cpp, asmResult, options.csv);
+    }
+
+    if (wants(options, "insertion")) {
+        RunResult cpp = runSorts(sortInputs, cycles, sortWithStepper<dsav::algorithms::InsertionSortStepper>);
+        RunResult asmResult = runSorts(sortInputs, cycles, [](std::vector<int>& arr) {
+            return static_cast<std::int64_t>(insertion_sort_array(arr.data(), static_cast<int>(arr.size())));
+        });
+        allMatch &= report("insertion", cpp, asmResult, options.csv);
+    }
+
+    if (wants(options, "merge")) {
+        std::vector<int> scratch(options.sortSize);
+        RunResult cpp = runSorts(sortInputs, cycles, sortOutputWithStepper<dsav::algorithms::MergeSortStepper>);
+        RunResult asmResult = runSorts(sortInputs, cycles, [&scratch](std::vector<int>& arr) {
+            merge_sort(arr.data(), static_cast<int>(arr.size()), scratch.data());
+            return std::int64_t{0};
+        });
+        allMatch &= report("merge", cpp, asmResult, options.csv);
+    }
+
+    if (wants(options, "quick")) {
+        RunResult cpp = runSorts(sortInputs, cycles, sortOutputWithStepper<dsav::algorithms::QuickSortStepper>);
+        RunResult asmResult = runSorts(sortInputs, cycles, [](std::vector<int>& arr) {
+            quick_sort(arr.data(), static_cast<int>(arr.size()));
+            return std::int64_t{0};
+        });
+        allMatch &= report("quick", cpp, asmResult, options.csv);
+    }
+
+    if (!allMatch) {
+        std::cerr << "Backends disagreed on at least one workload\n";
+        return 1;
+    }
+    return 0;
+}
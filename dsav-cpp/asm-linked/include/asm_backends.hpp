@@ -0,0 +1,413 @@
+/**
+ * @file asm_backends.hpp
+ * @brief Assembly storage for the shared queue, linked list and BST visualizers
+ *
+ * The pure C++ QueueVisualizer, LinkedListVisualizer and BSTVisualizer draw
+ * whatever their backend reports, so the asm-linked build plugs the assembly routines in
+ * here instead of keeping its own copies of the rendering code. Mutations
+ * go through the assembly functions; reads go through the generation-checked
+ * views in asm_view.hpp.
+ */
+
+#pragma once
+
+#include "asm_interface.hpp"
+#include "asm_view.hpp"
+#include "visualizers/queue_backend.hpp"
+#include "visualizers/list_backend.hpp"
+#include "visualizers/tree_backend.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Queue backend over the assembly circular buffer
+ *
+ * The assembly queue has one fixed ring of queue_get_capacity() slots, so
+ * it is shown as a single block that never grows and logs no events.
+ */
+class AsmQueueBackend final : public QueueBackend {
+public:
+    /**
+     * @brief Take over the assembly queue (clears it)
+     */
+    AsmQueueBackend() {
+        queue_clear();
+    }
+
+    const char* name() const override { return "Queue (ASM)"; }
+
+    const char* layoutHint() const override {
+        return "Circular buffer (assembly): fixed capacity, the rear wraps around to slot 0";
+    }
+
+    bool enqueue(int value) override { return queue_enqueue(value) != 0; }
+
+    std::optional<int> dequeue() override {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        return queue_dequeue();
+    }
+
+    std::optional<int> peek() const override {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        return queue_peek();
+    }
+
+    void clear() override { queue_clear(); }
+
+    size_t size() const override { return view().size(); }
+    size_t capacity() const override { return view().capacity(); }
+    bool isFull() const override { return size() == capacity(); }
+
+    size_t frontIndex() const override { return view().front(); }
+    size_t rearIndex() const override { return view().slotOf(view().size()); }
+    size_t slotOf(size_t position) const override { return view().slotOf(position); }
+    int atPosition(size_t position) const override { return view()[position]; }
+
+    size_t blockSize() const override { return capacity(); }
+    size_t blockCount() const override { return 1; }
+    size_t spareBlockCount() const override { return 0; }
+
+private:
+    const AsmQueueView& view() const {
+        m_view.refresh();
+        return m_view;
+    }
+
+    mutable AsmQueueView m_view;               ///< In-place view of the ring buffer
+};
+
+/**
+ * @brief List backend over the assembly singly linked list
+ *
+ * The assembly only inserts at either end and deletes by value (the first
+ * node holding it), so insertAt works at the ends and deleteAt only where
+ * no earlier node holds the same value.
+ */
+class AsmListBackend final : public ListBackend {
+public:
+    /**
+     * @brief Take over the assembly list (frees any nodes left in it)
+     */
+    AsmListBackend() {
+        list_free_all();
+    }
+
+    ~AsmListBackend() override {
+        list_free_all();
+    }
+
+    AsmListBackend(const AsmListBackend&) = delete;
+    AsmListBackend& operator=(const AsmListBackend&) = delete;
+
+    const char* name() const override { return "Linked List (ASM)"; }
+
+    const char* positionalLimits() const override {
+        return "The assembly list inserts only at the ends and deletes the first node holding a value";
+    }
+
+    bool insertFront(int value) override { return list_insert_front(value) != 0; }
+    bool insertBack(int value) override { return list_insert_back(value) != 0; }
+
+    bool insertAt(size_t index, int value) override {
+        if (index == 0) {
+            return insertFront(value);
+        }
+        if (index == size()) {
+            return insertBack(value);
+        }
+        return false;
+    }
+
+    std::optional<int> deleteFront() override { return deleteAt(0); }
+
+    std::optional<int> deleteBack() override {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        return deleteAt(size() - 1);
+    }
+
+    std::optional<int> deleteAt(size_t index) override {
+        if (!canDeleteAt(index)) {
+            return std::nullopt;
+        }
+        int value = valueAt(index);
+        list_delete(value);
+        return value;
+    }
+
+    bool canInsertAt(size_t index) const override {
+        return index == 0 || index == size();
+    }
+
+    bool canDeleteAt(size_t index) const override {
+        if (index >= size()) {
+            return false;
+        }
+        int value = valueAt(index);
+        size_t position = 0;
+        for (const AsmListNode& node : view()) {
+            if (position == index) {
+                return true;
+            }
+            if (static_cast<int>(node.data) == value) {
+                return false;
+            }
+            ++position;
+        }
+        return false;
+    }
+
+    void clear() override { list_free_all(); }
+    size_t size() const override { return view().size(); }
+
+    void values(std::vector<int>& out) const override {
+        out.clear();
+        for (const AsmListNode& node : view()) {
+            out.push_back(static_cast<int>(node.data));
+        }
+    }
+
+private:
+    const AsmListView& view() const {
+        m_view.refresh();
+        return m_view;
+    }
+
+    int valueAt(size_t index) const {
+        auto it = view().begin();
+        for (size_t i = 0; i < index; ++i) {
+            ++it;
+        }
+        return static_cast<int>(it->data);
+    }
+
+    mutable AsmListView m_view;                ///< In-place view of the list
+};
+
+/**
+ * @brief Tree backend over the assembly binary search tree
+ *
+ * The assembly nodes carry no ids, parent links or subtree sizes, so the
+ * backend mirrors them: each node address gets a stable id, and whenever
+ * the BST generation moves the in-order walk is diffed against the mirror
+ * to journal added, removed and relinked ids. The walk also yields the
+ * sorted keys, which answer select, rank and range counts.
+ */
+class AsmTreeBackend final : public TreeBackend {
+public:
+    AsmTreeBackend() = default;
+
+    ~AsmTreeBackend() override {
+        bst_free_all(&m_root);
+    }
+
+    AsmTreeBackend(const AsmTreeBackend&) = delete;
+    AsmTreeBackend& operator=(const AsmTreeBackend&) = delete;
+
+    const char* name() const override { return "Binary Search Tree (ASM)"; }
+
+    void insert(int value) override { bst_insert(&m_root, value); }
+
+    bool remove(int value) override {
+        if (!contains(value)) {
+            return false;
+        }
+        bst_delete(&m_root, value);
+        // Retire the freed node now, before an insert can reuse its address
+        sync();
+        return true;
+    }
+
+    NodeIndex find(int value) const override {
+        sync();
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), value);
+        if (it == m_keys.end() || *it != value) {
+            return NULL_NODE;
+        }
+        return m_order[static_cast<size_t>(it - m_keys.begin())];
+    }
+
+    void clear() override {
+        bst_free_all(&m_root);
+        sync();
+        m_changed.clear();
+    }
+
+    size_t size() const override {
+        sync();
+        return m_order.size();
+    }
+
+    int height() const override {
+        sync();
+        return m_height;
+    }
+
+    NodeIndex root() const override {
+        sync();
+        return m_rootId;
+    }
+
+    bool isLive(NodeIndex id) const override {
+        sync();
+        return id < m_slots.size() && m_slots[id].live;
+    }
+
+    TreeNodeLinks node(NodeIndex id) const override {
+        sync();
+        const Slot& slot = m_slots[id];
+        return {slot.key, slot.left, slot.right};
+    }
+
+    std::vector<NodeIndex> takeChangedNodes() override {
+        sync();
+        std::vector<NodeIndex> result = std::move(m_changed);
+        m_changed.clear();
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    NodeIndex select(size_t k) const override {
+        sync();
+        return k < m_order.size() ? m_order[k] : NULL_NODE;
+    }
+
+    size_t rank(int value) const override {
+        sync();
+        return static_cast<size_t>(std::lower_bound(m_keys.begin(), m_keys.end(), value) - m_keys.begin());
+    }
+
+    size_t countInRange(int low, int high) const override {
+        if (high < low) {
+            return 0;
+        }
+        sync();
+        return static_cast<size_t>(std::upper_bound(m_keys.begin(), m_keys.end(), high)
+                                   - std::lower_bound(m_keys.begin(), m_keys.end(), low));
+    }
+
+    bool adopt(BinarySearchTree<int, true>&& tree) override {
+        // Inserting in preorder rebuilds the same shape; the ids are new
+        clear();
+        for (int key : tree.preorder()) {
+            bst_insert(&m_root, key);
+        }
+        return false;
+    }
+
+private:
+    /**
+     * @brief Mirror of one assembly node, indexed by its id
+     */
+    struct Slot {
+        const AsmBSTNode* address = nullptr;
+        int key = 0;
+        NodeIndex left = NULL_NODE;
+        NodeIndex right = NULL_NODE;
+        std::uint64_t seen = 0;                ///< Last sync whose walk reached the node
+        bool live = false;
+    };
+
+    /**
+     * @brief Diff the assembly tree against the mirror if its generation moved
+     *
+     * Ids freed by this diff are only handed out again by a later one, so a
+     * journaled id that is not live always means a removed node.
+     */
+    void sync() const {
+        if (!m_view.refresh()) {
+            return;
+        }
+        ++m_epoch;
+        m_order.clear();
+        m_keys.clear();
+        m_height = -1;
+
+        // Ids for every reachable node; new addresses take a spare id
+        m_view.forEachInorder([this](const AsmBSTNode& node, size_t depth) {
+            auto [it, added] = m_ids.try_emplace(&node, NULL_NODE);
+            if (added) {
+                it->second = allocateId();
+                Slot& slot = m_slots[it->second];
+                slot = Slot{};
+                slot.address = &node;
+                slot.live = true;
+                m_changed.push_back(it->second);
+            }
+            m_slots[it->second].seen = m_epoch;
+            m_order.push_back(it->second);
+            m_keys.push_back(static_cast<int>(node.data));
+            m_height = std::max(m_height, static_cast<int>(depth));
+        });
+
+        // Nodes the walk did not reach were freed
+        std::vector<NodeIndex> retired;
+        for (NodeIndex id = 0; id < m_slots.size(); ++id) {
+            Slot& slot = m_slots[id];
+            if (slot.live && slot.seen != m_epoch) {
+                m_ids.erase(slot.address);
+                slot.live = false;
+                m_changed.push_back(id);
+                retired.push_back(id);
+            }
+        }
+
+        // Keys and links (a two-child delete copies the successor's key up)
+        auto idOf = [this](const AsmBSTNode* child) {
+            return child != nullptr ? m_ids.find(child)->second : NULL_NODE;
+        };
+        for (size_t i = 0; i < m_order.size(); ++i) {
+            NodeIndex id = m_order[i];
+            Slot& slot = m_slots[id];
+            NodeIndex left = idOf(slot.address->left);
+            NodeIndex right = idOf(slot.address->right);
+            if (slot.key != m_keys[i] || slot.left != left || slot.right != right) {
+                slot.key = m_keys[i];
+                slot.left = left;
+                slot.right = right;
+                m_changed.push_back(id);
+            }
+        }
+
+        m_rootId = idOf(m_view.root());
+        m_spareIds.insert(m_spareIds.end(), retired.begin(), retired.end());
+    }
+
+    NodeIndex allocateId() const {
+        if (!m_spareIds.empty()) {
+            NodeIndex id = m_spareIds.back();
+            m_spareIds.pop_back();
+            return id;
+        }
+        m_slots.emplace_back();
+        return static_cast<NodeIndex>(m_slots.size() - 1);
+    }
+
+    AsmBSTNode* m_root = nullptr;              ///< Root slot passed to the assembly
+    mutable AsmBstView m_view{&m_root};        ///< Generation check and in-order walk
+
+    // Mirror, rebuilt by sync() from const readers
+    mutable std::unordered_map<const AsmBSTNode*, NodeIndex> m_ids;
+    mutable std::vector<Slot> m_slots;
+    mutable std::vector<NodeIndex> m_spareIds; ///< Ids of removed nodes, free for reuse
+    mutable std::vector<NodeIndex> m_order;    ///< Live ids in ascending key order
+    mutable std::vector<int> m_keys;           ///< Keys in ascending order, parallel to m_order
+    mutable std::vector<NodeIndex> m_changed;  ///< Journal since the last takeChangedNodes()
+    mutable NodeIndex m_rootId = NULL_NODE;
+    mutable int m_height = -1;
+    mutable std::uint64_t m_epoch = 0;
+};
+
+} // namespace dsav
@@ -7,6 +7,14 @@
  *
  * The asm-linked version uses these assembly functions for core data structure
  * operations, while C++ handles visualization, animation, and UI.
+ *
+ * Signatures follow the assembly exactly: the stack, queue and linked list
+ * keep their state in globals, and pop/peek style calls return the value
+ * itself (0 when empty), so callers check *_is_empty() first.
+ *
+ * Every mutating routine also bumps a per-structure generation counter
+ * (*_get_generation()); asm_view.hpp uses it to read assembly memory in
+ * place and resync only after a change.
  */
 
 #pragma once
@@ -29,17 +37,15 @@ int stack_push(int value);
 
 /**
  * Pop a value from the stack
- * @param out_value Pointer to store the popped value
- * @return 1 on success, 0 on underflow (stack empty)
+ * @return The popped value, or 0 on underflow (stack empty)
  */
-int stack_pop(int* out_value);
+int stack_pop();
 
 /**
  * Peek at the top value without removing it
- * @param out_value Pointer to store the top value
- * @return 1 on success, 0 if stack is empty
+ * @return The top value, or 0 if stack is empty
  */
-int stack_peek(int* out_value);
+int stack_peek();
 
 /**
  * Check if stack is empty
@@ -58,7 +64,7 @@ int stack_is_full();
  */
 void stack_clear();
 
-// State accessors (need to be added to assembly)
+// State accessors
 /**
  * Get pointer to internal stack array
  * @return Pointer to stack data array
@@ -77,6 +83,12 @@ int stack_get_top();
  */
 int stack_get_capacity();
 
+/**
+ * Get stack generation (bumped by push, pop and clear)
+ * @return Generation counter
+ */
+uint64_t stack_get_generation();
+
 
 // =============================================================================
 // QUEUE OPERATIONS
@@ -91,17 +103,15 @@ int queue_enqueue(int value);
 
 /**
  * Dequeue a value
- * @param out_value Pointer to store the dequeued value
- * @return 1 on success, 0 on underflow (queue empty)
+ * @return The dequeued value, or 0 on underflow (queue empty)
  */
-int queue_dequeue(int* out_value);
+int queue_dequeue();
 
 /**
  * Peek at the front value without removing it
- * @param out_value Pointer to store the front value
- * @return 1 on success, 0 if queue is empty
+ * @return The front value, or 0 if queue is empty
  */
-int queue_peek(int* out_value);
+int queue_peek();
 
 /**
  * Check if queue is empty
@@ -120,7 +130,7 @@ int queue_is_full();
  */
 void queue_clear();
 
-// State accessors (need to be added to assembly)
+// State accessors
 /**
  * Get pointer to internal queue array
  * @return Pointer to queue data array
@@ -135,7 +145,7 @@ int queue_get_front();
 
 /**
  * Get current rear index
- * @return Rear index
+ * @return Index of the last element (-1 if nothing was enqueued since a clear)
  */
 int queue_get_rear();
 
@@ -151,6 +161,12 @@ int queue_get_count();
  */
 int queue_get_capacity();
 
+/**
+ * Get queue generation (bumped by enqueue, dequeue and clear)
+ * @return Generation counter
+ */
+uint64_t queue_get_generation();
+
 
 // =============================================================================
 // LINKED LIST OPERATIONS
@@ -158,7 +174,10 @@ int queue_get_capacity();
 
 /**
  * Node structure matching assembly layout
- * 24 bytes: 8 bytes data + 8 bytes next pointer + 8 bytes padding
+ * 16 bytes: 8 bytes data + 8 bytes next pointer
+ *
+ * The assembly stores and compares the full 64-bit register, so values are
+ * passed as int64_t to keep the upper half defined.
  */
 struct AsmListNode {
     int64_t data;
@@ -170,43 +189,58 @@ struct AsmListNode {
  * @param value Node value
  * @return Pointer to new node, or nullptr on allocation failure
  */
-AsmListNode* list_create_node(int value);
+AsmListNode* list_create_node(int64_t value);
 
 /**
  * Insert a value at the front of the list
- * @param head Pointer to head pointer
  * @param value Value to insert
+ * @return 1 on success, 0 on allocation failure
  */
-void list_insert_front(AsmListNode** head, int value);
+int list_insert_front(int64_t value);
 
 /**
  * Insert a value at the back of the list
- * @param head Pointer to head pointer
  * @param value Value to insert
+ * @return 1 on success, 0 on allocation failure
  */
-void list_insert_back(AsmListNode** head, int value);
+int list_insert_back(int64_t value);
 
 /**
- * Delete a value from the list
- * @param head Pointer to head pointer
+ * Delete the first node holding a value
  * @param value Value to delete
  * @return 1 if deleted, 0 if not found
  */
-int list_delete(AsmListNode** head, int value);
+int list_delete(int64_t value);
 
 /**
  * Search for a value in the list
- * @param head List head
  * @param value Value to search for
  * @return Pointer to node if found, nullptr otherwise
  */
-AsmListNode* list_search(AsmListNode* head, int value);
+AsmListNode* list_search(int64_t value);
 
 /**
- * Free all nodes in the list
- * @param head Pointer to head pointer (will be set to nullptr)
+ * Free all nodes in the list and reset it to empty
  */
-void list_free_all(AsmListNode** head);
+void list_free_all();
+
+/**
+ * Get the first node
+ * @return Head node, or nullptr if the list is empty
+ */
+AsmListNode* list_get_head();
+
+/**
+ * Get number of nodes in the list
+ * @return Node count
+ */
+int list_get_count();
+
+/**
+ * Get list generation (bumped by inserts, deletes and free_all)
+ * @return Generation counter
+ */
+uint64_t list_get_generation();
 
 
 // =============================================================================
@@ -215,10 +249,13 @@ void list_free_all(AsmListNode** head);
 
 /**
  * BST Node structure matching assembly layout
- * 24 bytes: 8 bytes data + 8 bytes left + 8 bytes right
+ * 24 bytes: 8-byte data slot + 8 bytes left + 8 bytes right
+ *
+ * The assembly writes only the low 32 bits of the data slot.
  */
 struct AsmBSTNode {
-    int64_t data;
+    int32_t data;
+    int32_t reserved;  ///< Never written by the assembly
     struct AsmBSTNode* left;
     struct AsmBSTNode* right;
 };
@@ -231,19 +268,20 @@ struct AsmBSTNode {
 AsmBSTNode* bst_create_node(int value);
 
 /**
- * Insert a value into the BST
+ * Insert a value into the BST (duplicates are ignored)
  * @param root Pointer to root pointer
  * @param value Value to insert
+ * @return The root after insertion
  */
-void bst_insert(AsmBSTNode** root, int value);
+AsmBSTNode* bst_insert(AsmBSTNode** root, int value);
 
 /**
  * Delete a value from the BST
  * @param root Pointer to root pointer
  * @param value Value to delete
- * @return 1 if deleted, 0 if not found
+ * @return The root after deletion
  */
-int bst_delete(AsmBSTNode** root, int value);
+AsmBSTNode* bst_delete(AsmBSTNode** root, int value);
 
 /**
  * Search for a value in the BST
@@ -266,58 +304,74 @@ AsmBSTNode* bst_find_min(AsmBSTNode* root);
  */
 void bst_free_all(AsmBSTNode** root);
 
-// Traversal callback type
-typedef void (*BSTCallback)(int value);
+/**
+ * Get BST generation (bumped by insert, delete and free_all, on any tree)
+ * @return Generation counter
+ */
+uint64_t bst_get_generation();
+
+// The traversals print to the terminal; C++ code walks the nodes directly
+// (see AsmBstView in asm_view.hpp).
 
 /**
- * Perform inorder traversal
+ * Print values inorder
  * @param root BST root
- * @param callback Function to call for each node
  */
-void bst_inorder(AsmBSTNode* root, BSTCallback callback);
+void bst_inorder(AsmBSTNode* root);
 
 /**
- * Perform preorder traversal
+ * Print values preorder
  * @param root BST root
- * @param callback Function to call for each node
  */
-void bst_preorder(AsmBSTNode* root, BSTCallback callback);
+void bst_preorder(AsmBSTNode* root);
 
 /**
- * Perform postorder traversal
+ * Print values postorder
  * @param root BST root
- * @param callback Function to call for each node
  */
-void bst_postorder(AsmBSTNode* root, BSTCallback callback);
+void bst_postorder(AsmBSTNode* root);
 
 
 // =============================================================================
 // SORTING ALGORITHMS
 // =============================================================================
 
+// The terminal program's bubble_sort/selection_sort/insertion_sort animate a
+// global array with delays; these headless kernels (sort_kernels.asm) sort
+// caller memory instead.
+
 /**
- * Bubble sort
+ * Bubble sort in place (stops after a pass without swaps)
  * @param arr Array to sort
  * @param size Array size
+ * @return Number of comparisons
  */
-void bubble_sort(int* arr, int size);
+uint64_t bubble_sort_array(int* arr, int size);
 
 /**
- * Selection sort
+ * Insertion sort in place
  * @param arr Array to sort
  * @param size Array size
+ * @return Number of comparisons
  */
-void selection_sort(int* arr, int size);
+uint64_t insertion_sort_array(int* arr, int size);
 
 /**
- * Insertion sort
+ * Bottom-up merge sort in place; runs of 16 are sorted by a NEON network
  * @param arr Array to sort
  * @param size Array size
+ * @param scratch Buffer of at least size ints, or nullptr to have the kernel
+ *                allocate (and free) one; the array is left unsorted if that fails
  */
-void insertion_sort(int* arr, int size);
+void merge_sort(int* arr, int size, int* scratch);
 
-// Note: Merge sort and quick sort functions exist but use internal arrays
-// We'll need to add versions that accept array pointers
+/**
+ * Quick sort in place (median-of-three Hoare partition); ranges of 16 or
+ * fewer are sorted by a NEON network
+ * @param arr Array to sort
+ * @param size Array size
+ */
+void quick_sort(int* arr, int size);
 
 
 // =============================================================================
@@ -0,0 +1,89 @@
+/**
+ * @file asm_sort_backend.hpp
+ * @brief ARMv8 assembly sort kernels behind the shared sorting visualizer
+ *
+ * The kernels in sort_kernels.asm run to completion in one call, so each
+ * run is recorded as the permutation the kernel applied: the result is
+ * checked, the stable sorting permutation of the input is recovered and
+ * SortingVisualizer replays it as swaps, with the usual timeline, bar
+ * rendering and playback. The backend also times the kernels on a larger
+ * array so the NEON merge and quick sorts can be compared with std::sort
+ * on the machine the program runs on.
+ */
+
+#pragma once
+
+#include "asm_interface.hpp"
+#include "visualizers/sort_backend.hpp"
+#include <cstdint>
+#include <vector>
+#include <string>
+
+namespace dsav {
+
+/**
+ * @brief Sort backend over the assembly kernels
+ */
+class AsmSortBackend final : public SortBackend {
+public:
+    /**
+     * @brief Assembly kernel to run (the backend's algorithm index)
+     */
+    enum class Kernel {
+        Bubble,
+        Insertion,
+        Merge,
+        Quick
+    };
+
+    const char* name() const override { return "Sorting (ASM)"; }
+    size_t algorithmCount() const override { return 4; }
+    const char* algorithmName(size_t algorithm) const override;
+
+    bool record(size_t algorithm, std::vector<int> input, algorithms::SortTrace& trace,
+                std::string& note, const std::atomic<bool>* cancel) const override;
+
+    /**
+     * @brief Benchmark controls and the last benchmark table
+     */
+    void renderControls() override;
+
+    /**
+     * @brief Time every kernel (and std::sort) on a random array of m_benchSize
+     */
+    void runBenchmark();
+
+private:
+    /**
+     * @brief One row of the benchmark table
+     */
+    struct BenchResult {
+        const char* name = "";
+        double microseconds = 0.0;      ///< Best of BENCH_REPEATS runs
+        bool skipped = false;           ///< Quadratic kernel skipped at this size
+        bool correct = true;            ///< Output matched std::sort
+    };
+
+    /**
+     * @brief Run a kernel on arr in place
+     *
+     * @param kernel Kernel to run
+     * @param arr Array to sort
+     * @param scratch Scratch buffer for merge sort (at least arr.size())
+     * @return Comparisons reported by bubble and insertion sort, 0 for the others
+     */
+    static std::uint64_t runKernel(Kernel kernel, std::vector<int>& arr, std::vector<int>& scratch);
+
+    static bool isQuadratic(Kernel kernel) { return kernel == Kernel::Bubble || kernel == Kernel::Insertion; }
+
+    // Benchmark (render thread only)
+    std::vector<BenchResult> m_benchResults;   ///< Last benchmark table
+    std::string m_benchStatus;                 ///< What the last benchmark measured
+    int m_benchSize = 100000;                  ///< Elements in the benchmark array
+
+    static constexpr int MAX_BENCH_SIZE = 10000000;
+    static constexpr int MAX_QUADRATIC_SIZE = 20000;         // Bubble/insertion refused above this
+    static constexpr int BENCH_REPEATS = 5;
+};
+
+} // namespace dsav
@@ -10,6 +10,7 @@
 
 #include "visualizer.hpp"
 #include "asm_interface.hpp"
+#include "asm_view.hpp"
 #include "animation.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
@@ -23,8 +24,9 @@ namespace dsav {
 /**
  * @brief Stack visualizer with assembly backend
  *
- * Calls ARMv8 assembly functions for core stack operations,
- * then syncs visual state from assembly memory.
+ * Calls ARMv8 assembly functions for core stack operations, then
+ * reads the result in place through an AsmStackView; bars are only
+ * rebuilt when the assembly's generation counter moves.
  */
 class AsmStackVisualizer : public IVisualizer {
 public:
@@ -54,10 +56,10 @@ public:
 
 private:
     /**
-     * @brief Sync visual elements with current assembly stack state
+     * @brief Sync visual elements with the assembly stack if it changed
      *
-     * Reads stack data from assembly using accessor functions,
-     * then creates VisualElements for rendering.
+     * Bars below the first slot whose value differs are kept (with any
+     * running animation); the rest are rebuilt from the view.
      */
     void syncFromAssembly();
 
@@ -70,6 +72,7 @@ private:
     glm::vec2 calculatePosition(size_t index) const;
 
     // Visual representation
+    AsmStackView m_view;                       ///< Assembly stack, read in place
     std::vector<VisualElement> m_elements;     ///< Visual representation of stack elements
     AnimationController m_animator;            ///< Animation controller
 
@@ -0,0 +1,287 @@
+/**
+ * @file asm_view.hpp
+ * @brief Read-only views over assembly-owned data structures
+ *
+ * The assembly keeps its stack, queue and list in globals and the BST in
+ * malloc'd nodes. Rather than copying that state into C++ containers (or
+ * walking it through callbacks), each view points straight at the assembly
+ * memory and remembers the generation counter it last saw: refresh() is one
+ * call into the assembly when nothing changed, and re-reads the layout
+ * (top, front, count, head, root) only when something did.
+ *
+ * Views never write. Anything read through them is valid until the next
+ * call that mutates the structure.
+ */
+
+#pragma once
+
+#include "asm_interface.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Contiguous read-only range of assembly memory
+ */
+template <typename T>
+class AsmSpan {
+public:
+    AsmSpan() = default;
+    AsmSpan(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+    const T* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const T& operator[](size_t index) const { return m_data[index]; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+
+private:
+    const T* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+/**
+ * @brief Generation bookkeeping shared by the views
+ */
+class AsmGeneration {
+public:
+    /**
+     * @brief Record a generation read from the assembly
+     *
+     * @return true if it differs from the last one recorded (always true the
+     *         first time)
+     */
+    bool advance(std::uint64_t current) {
+        if (current == m_generation) {
+            return false;
+        }
+        m_generation = current;
+        return true;
+    }
+
+    /**
+     * @brief Forget the recorded generation so the next advance() reports a change
+     */
+    void invalidate() {
+        m_generation = NEVER_SYNCED;
+    }
+
+    std::uint64_t value() const { return m_generation; }
+
+private:
+    static constexpr std::uint64_t NEVER_SYNCED = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t m_generation = NEVER_SYNCED;
+};
+
+/**
+ * @brief View of the assembly stack (bottom first)
+ */
+class AsmStackView {
+public:
+    /**
+     * @brief Re-read the stack layout if the assembly changed it
+     *
+     * @return true if the stack changed since the last refresh
+     */
+    bool refresh() {
+        if (!m_generation.advance(stack_get_generation())) {
+            return false;
+        }
+        m_items = AsmSpan<int>(stack_get_data(), static_cast<size_t>(stack_get_top() + 1));
+        m_capacity = static_cast<size_t>(stack_get_capacity());
+        return true;
+    }
+
+    void invalidate() { m_generation.invalidate(); }
+
+    /// Elements from bottom to top, in the assembly's own storage
+    AsmSpan<int> items() const { return m_items; }
+    size_t size() const { return m_items.size(); }
+    size_t capacity() const { return m_capacity; }
+    std::uint64_t generation() const { return m_generation.value(); }
+
+private:
+    AsmGeneration m_generation;
+    AsmSpan<int> m_items;
+    size_t m_capacity = 0;
+};
+
+/**
+ * @brief View of the assembly circular queue
+ */
+class AsmQueueView {
+public:
+    /**
+     * @brief Re-read front and count if the assembly changed the queue
+     *
+     * @return true if the queue changed since the last refresh
+     */
+    bool refresh() {
+        if (!m_generation.advance(queue_get_generation())) {
+            return false;
+        }
+        m_slots = AsmSpan<int>(queue_get_data(), static_cast<size_t>(queue_get_capacity()));
+        m_front = static_cast<size_t>(queue_get_front());
+        m_count = static_cast<size_t>(queue_get_count());
+        return true;
+    }
+
+    void invalidate() { m_generation.invalidate(); }
+
+    /// Whole ring buffer, including free slots
+    AsmSpan<int> slots() const { return m_slots; }
+
+    /// Slot holding the element at a position (0 = front)
+    size_t slotOf(size_t position) const { return (m_front + position) % m_slots.size(); }
+
+    /// Element at a position (0 = front)
+    int operator[](size_t position) const { return m_slots[slotOf(position)]; }
+
+    size_t front() const { return m_front; }
+    size_t size() const { return m_count; }
+    size_t capacity() const { return m_slots.size(); }
+    std::uint64_t generation() const { return m_generation.value(); }
+
+private:
+    AsmGeneration m_generation;
+    AsmSpan<int> m_slots;
+    size_t m_front = 0;
+    size_t m_count = 0;
+};
+
+/**
+ * @brief View of the assembly linked list
+ */
+class AsmListView {
+public:
+    /**
+     * @brief Forward iterator over the nodes, head first
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = AsmListNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const AsmListNode*;
+        using reference = const AsmListNode&;
+
+        explicit Iterator(const AsmListNode* node = nullptr) : m_node(node) {}
+
+        reference operator*() const { return *m_node; }
+        pointer operator->() const { return m_node; }
+        Iterator& operator++() {
+            m_node = m_node->next;
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return m_node == other.m_node; }
+        bool operator!=(const Iterator& other) const { return m_node != other.m_node; }
+
+    private:
+        const AsmListNode* m_node;
+    };
+
+    /**
+     * @brief Re-read head and count if the assembly changed the list
+     *
+     * @return true if the list changed since the last refresh
+     */
+    bool refresh() {
+        if (!m_generation.advance(list_get_generation())) {
+            return false;
+        }
+        m_head = list_get_head();
+        m_count = static_cast<size_t>(list_get_count());
+        return true;
+    }
+
+    void invalidate() { m_generation.invalidate(); }
+
+    Iterator begin() const { return Iterator(m_head); }
+    Iterator end() const { return Iterator(); }
+    const AsmListNode* head() const { return m_head; }
+    size_t size() const { return m_count; }
+    std::uint64_t generation() const { return m_generation.value(); }
+
+private:
+    AsmGeneration m_generation;
+    const AsmListNode* m_head = nullptr;
+    size_t m_count = 0;
+};
+
+/**
+ * @brief View of an assembly BST
+ *
+ * The caller owns the root pointer the assembly updates, so the view holds
+ * its address. The generation counter is shared by every tree, so a change
+ * to any tree makes all BST views resync.
+ */
+class AsmBstView {
+public:
+    /**
+     * @brief Create a view of the tree rooted at *rootSlot
+     *
+     * @param rootSlot Address of the root pointer passed to bst_insert/bst_delete
+     */
+    explicit AsmBstView(AsmBSTNode* const* rootSlot) : m_rootSlot(rootSlot) {}
+
+    /**
+     * @brief Re-read the root if the assembly changed a tree
+     *
+     * @return true if a tree changed since the last refresh
+     */
+    bool refresh() {
+        if (!m_generation.advance(bst_get_generation())) {
+            return false;
+        }
+        m_root = *m_rootSlot;
+        return true;
+    }
+
+    void invalidate() { m_generation.invalidate(); }
+
+    const AsmBSTNode* root() const { return m_root; }
+    std::uint64_t generation() const { return m_generation.value(); }
+
+    /**
+     * @brief Call visit(node, depth) for each node in ascending order
+     *
+     * Walks the nodes with an explicit stack (reused between calls), so the
+     * visitor is inlined instead of being called through a function pointer.
+     */
+    template <typename Visitor>
+    void forEachInorder(Visitor&& visit) const {
+        m_pending.clear();
+        const AsmBSTNode* node = m_root;
+        size_t depth = 0;
+        while (node != nullptr || !m_pending.empty()) {
+            while (node != nullptr) {
+                m_pending.push_back({node, depth});
+                node = node->left;
+                ++depth;
+            }
+            Pending top = m_pending.back();
+            m_pending.pop_back();
+            visit(*top.node, top.depth);
+            node = top.node->right;
+            depth = top.depth + 1;
+        }
+    }
+
+private:
+    struct Pending {
+        const AsmBSTNode* node;
+        size_t depth;
+    };
+
+    AsmGeneration m_generation;
+    AsmBSTNode* const* m_rootSlot;
+    const AsmBSTNode* m_root = nullptr;
+    mutable std::vector<Pending> m_pending;
+};
+
+} // namespace dsav
@@ -25,9 +25,20 @@
 #include "renderer.hpp"
 #include "animation.hpp"
 #include "ui_components.hpp"
+#include "profiler_overlay.hpp"
+#include "trace_writer.hpp"
+#include "job_system.hpp"
+#include "render_scheduler.hpp"
+#include "visualizer_registry.hpp"
 
 // Assembly-linked visualizers
 #include "asm_stack_visualizer.hpp"
+#include "asm_backends.hpp"
+#include "asm_sort_backend.hpp"
+#include "visualizers/queue_visualizer.hpp"
+#include "visualizers/linked_list_visualizer.hpp"
+#include "visualizers/bst_visualizer.hpp"
+#include "visualizers/sorting_visualizer.hpp"
 
 // GLM for math
 #include <glm/glm.hpp>
@@ -38,6 +49,7 @@ constexpr int WINDOW_WIDTH = 1280;
 constexpr int WINDOW_HEIGHT = 720;
 constexpr const char* WINDOW_TITLE = "DSAV - Assembly-Linked Version (ARMv8)";
 constexpr const char* GLSL_VERSION = "#version 330 core";
+constexpr int FRAME_CAP_CHOICES[] = {0, 30, 60, 120};  ///< View > Frame Cap entries (0 = display refresh)
 
 // ===== Forward Declarations =====
 
@@ -47,17 +59,33 @@ static void glfwKeyCallback(GLFWwindow* window, int key, int scancode, int actio
 
 // ===== Application State =====
 
+/**
+ * @brief Sidebar entries, in sidebar order
+ */
+enum class VisualizerId {
+    Stack,
+    Queue,
+    LinkedList,
+    BST,
+    Sorting
+};
+
 struct ApplicationState {
     bool showDemoWindow = false;
+    bool showProfiler = false;
     bool showSidebar = true;
     bool showVisualization = true;
 
-    // Current visualizer
-    std::unique_ptr<dsav::IVisualizer> currentVisualizer;
+    // Every visualizer opened so far; the selected one is visualizers.current()
+    dsav::VisualizerRegistry<VisualizerId> visualizers;
 
     std::string statusMessage = "Ready - Using ARM64 Assembly Backend";
 };
 
+static void registerVisualizers(ApplicationState& appState);
+static void sidebarButton(ApplicationState& appState, VisualizerId id);
+static bool needsContinuousFrames(const ApplicationState& appState);
+
 // ===== Main Function =====
 
 int main(int argc, char** argv) {
@@ -67,6 +95,11 @@ int main(int argc, char** argv) {
     std::cout << "ARMv8 AArch64 Assembly + C++ Visualization\n";
     std::cout << "========================================\n\n";
 
+    dsav::RenderSchedulerConfig schedulerConfig;
+    if (!dsav::parseRenderSchedulerArgs(argc, argv, schedulerConfig)) {
+        return 1;
+    }
+
     // ===== 1. Initialize GLFW =====
 
     glfwSetErrorCallback(glfwErrorCallback);
@@ -146,21 +179,31 @@ int main(int argc, char** argv) {
 
     ApplicationState appState;
 
-    // Initialize with Assembly Stack visualizer
-    appState.currentVisualizer = std::make_unique<dsav::AsmStackVisualizer>();
+    // Visualizers are built on first selection; start with the Assembly Stack
+    registerVisualizers(appState);
+    appState.visualizers.select(VisualizerId::Stack);
 
     // ===== 5. Main Loop =====
 
-    float lastFrame = 0.0f;
+    // Renders every frame while something moves, sleeps on events otherwise
+    dsav::RenderScheduler scheduler(schedulerConfig);
+
+    // A finished background job ends an idle wait at once
+    dsav::jobs::setCompletionListener(dsav::RenderScheduler::wake);
 
     while (!glfwWindowShouldClose(window)) {
-        // Calculate delta time
-        float currentFrame = static_cast<float>(glfwGetTime());
-        float deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
+        // Wait for the next frame and process events (also yields the delta time)
+        float deltaTime;
+        {
+            DSAV_PROFILE_SCOPE("Wait Events");
+            deltaTime = scheduler.beginFrame(needsContinuousFrames(appState));
+        }
 
-        // Poll events
-        glfwPollEvents();
+        // Apply results of finished background jobs before anything reads visualizer state
+        {
+            DSAV_PROFILE_SCOPE("Job Completions");
+            dsav::jobs::runCompletions();
+        }
 
         // Start new ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -168,8 +211,9 @@ int main(int argc, char** argv) {
         ImGui::NewFrame();
 
         // Update visualizer
-        if (appState.currentVisualizer) {
-            appState.currentVisualizer->update(deltaTime);
+        if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+            DSAV_PROFILE_SCOPE("Visualizer Update");
+            visualizer->update(deltaTime);
         }
 
         // ===== Setup Dockspace =====
@@ -204,9 +248,19 @@ int main(int argc, char** argv) {
         if (ImGui::BeginMenuBar()) {
             if (ImGui::BeginMenu("File")) {
                 if (ImGui::MenuItem("Reset", "Ctrl+R")) {
-                    if (appState.currentVisualizer) {
-                        appState.currentVisualizer->reset();
+                    if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+                        visualizer->reset();
+                    }
+                }
+                if (!dsav::trace::isActive()) {
+                    if (ImGui::MenuItem("Start Trace Capture")) {
+                        std::string path = dsav::trace::defaultPath();
+                        if (!dsav::trace::start(path)) {
+                            std::cerr << "Cannot open trace file " << path << "\n";
+                        }
                     }
+                } else if (ImGui::MenuItem("Stop Trace Capture")) {
+                    dsav::trace::stop();
                 }
                 ImGui::Separator();
                 if (ImGui::MenuItem("Exit", "ESC")) {
@@ -219,7 +273,22 @@ int main(int argc, char** argv) {
                 ImGui::MenuItem("Sidebar", nullptr, &appState.showSidebar);
                 ImGui::MenuItem("Visualization", nullptr, &appState.showVisualization);
                 ImGui::Separator();
+                ImGui::MenuItem("Profiler", nullptr, &appState.showProfiler);
                 ImGui::MenuItem("ImGui Demo", nullptr, &appState.showDemoWindow);
+                ImGui::Separator();
+                bool idleThrottling = scheduler.config().idleThrottling;
+                if (ImGui::MenuItem("Idle Throttling", nullptr, &idleThrottling)) {
+                    scheduler.setIdleThrottling(idleThrottling);
+                }
+                if (ImGui::BeginMenu("Frame Cap")) {
+                    for (int fps : FRAME_CAP_CHOICES) {
+                        std::string label = fps == 0 ? "Display Refresh" : std::to_string(fps) + " FPS";
+                        if (ImGui::MenuItem(label.c_str(), nullptr, scheduler.config().maxFps == fps)) {
+                            scheduler.setMaxFps(fps);
+                        }
+                    }
+                    ImGui::EndMenu();
+                }
                 ImGui::EndMenu();
             }
 
@@ -247,34 +316,24 @@ int main(int argc, char** argv) {
 
             // Data Structures Section
             if (ImGui::CollapsingHeader("Data Structures (ASM)", ImGuiTreeNodeFlags_DefaultOpen)) {
-                // Stack button
-                bool isStackActive = appState.currentVisualizer &&
-                                     appState.currentVisualizer->getName() == "Stack (ASM)";
-                if (isStackActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Stack", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::AsmStackVisualizer>();
-                    appState.statusMessage = "Stack (Assembly) selected";
-                }
-                if (isStackActive) {
-                    ImGui::PopStyleColor();
-                }
+                sidebarButton(appState, VisualizerId::Stack);
+                // Queue, linked list and BST: shared visualizers over the assembly backends
+                sidebarButton(appState, VisualizerId::Queue);
+                sidebarButton(appState, VisualizerId::LinkedList);
+                sidebarButton(appState, VisualizerId::BST);
+            }
 
-                // TODO: Add more visualizers
-                ImGui::BeginDisabled();
-                ImGui::Button("Queue (Coming Soon)", ImVec2(-1, 0));
-                ImGui::Button("Linked List (Coming Soon)", ImVec2(-1, 0));
-                ImGui::Button("BST (Coming Soon)", ImVec2(-1, 0));
-                ImGui::EndDisabled();
+            // Algorithms Section
+            if (ImGui::CollapsingHeader("Sorting (ASM)", ImGuiTreeNodeFlags_DefaultOpen)) {
+                sidebarButton(appState, VisualizerId::Sorting);
             }
 
             ImGui::Separator();
 
             // Visualizer Controls
-            if (appState.currentVisualizer) {
-                appState.currentVisualizer->renderControls();
+            if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+                DSAV_PROFILE_SCOPE("Render Controls");
+                visualizer->renderControls();
             }
 
             ImGui::End();
@@ -285,8 +344,9 @@ int main(int argc, char** argv) {
         if (appState.showVisualization) {
             ImGui::Begin("Visualization");
 
-            if (appState.currentVisualizer) {
-                appState.currentVisualizer->renderVisualization();
+            if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+                DSAV_PROFILE_SCOPE("Render Visualization");
+                visualizer->renderVisualization();
             }
 
             ImGui::End();
@@ -298,9 +358,20 @@ int main(int argc, char** argv) {
             ImGui::ShowDemoWindow(&appState.showDemoWindow);
         }
 
+        // ===== Profiler Overlay =====
+
+        if (appState.showProfiler) {
+            dsav::profiler::renderOverlay(&appState.showProfiler);
+        }
+
         // ===== Rendering =====
 
-        ImGui::Render();
+        {
+            DSAV_PROFILE_SCOPE("ImGui Render");
+            ImGui::Render();
+        }
+        dsav::profiler::captureDrawData(ImGui::GetDrawData());
+
         int display_w, display_h;
         glfwGetFramebufferSize(window, &display_w, &display_h);
         glViewport(0, 0, display_w, display_h);
@@ -310,17 +381,34 @@ int main(int argc, char** argv) {
         glClearColor(bgColor.r, bgColor.g, bgColor.b, bgColor.a);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        {
+            DSAV_PROFILE_SCOPE("OpenGL Draw");
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
+
+        {
+            DSAV_PROFILE_SCOPE("Swap Buffers");
+            glfwSwapBuffers(window);
+        }
 
-        glfwSwapBuffers(window);
+        // Close the frame: gather every thread's scopes for the overlay
+        dsav::profiler::endFrame();
     }
 
     // ===== Cleanup =====
 
+    dsav::trace::stop();
+
+    // Visualizers may own GL objects; release them while the context is alive
+    appState.visualizers.clear();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 
+    // Workers may still finish after the window system is gone
+    dsav::jobs::setCompletionListener(nullptr);
+
     glfwDestroyWindow(window);
     glfwTerminate();
 
@@ -328,6 +416,62 @@ int main(int argc, char** argv) {
     return 0;
 }
 
+// ===== Visualizer Selection =====
+
+/**
+ * @brief Register a factory per sidebar entry (nothing is constructed here)
+ */
+static void registerVisualizers(ApplicationState& appState) {
+    auto& registry = appState.visualizers;
+    registry.add(VisualizerId::Stack, "Stack", [] { return std::make_unique<dsav::AsmStackVisualizer>(); });
+    registry.add(VisualizerId::Queue, "Queue", [] {
+        return std::make_unique<dsav::QueueVisualizer>(std::make_unique<dsav::AsmQueueBackend>());
+    });
+    registry.add(VisualizerId::LinkedList, "Linked List", [] {
+        return std::make_unique<dsav::LinkedListVisualizer>(std::make_unique<dsav::AsmListBackend>());
+    });
+    registry.add(VisualizerId::BST, "BST", [] {
+        return std::make_unique<dsav::BSTVisualizer>(std::make_unique<dsav::AsmTreeBackend>());
+    });
+    registry.add(VisualizerId::Sorting, "Sorting Kernels", [] {
+        return std::make_unique<dsav::SortingVisualizer>(std::make_unique<dsav::AsmSortBackend>());
+    });
+}
+
+/**
+ * @brief Full-width sidebar button that selects a visualizer, highlighted while selected
+ */
+static void sidebarButton(ApplicationState& appState, VisualizerId id) {
+    bool isActive = appState.visualizers.isCurrent(id);
+    if (isActive) {
+        ImGui::PushStyleColor(ImGuiCol_Button,
+            dsav::colors::toImGui(dsav::colors::semantic::active));
+    }
+    const char* label = appState.visualizers.label(id);
+    if (ImGui::Button(label, ImVec2(-1, 0))) {
+        bool resumed = !isActive && appState.visualizers.isConstructed(id);
+        appState.visualizers.select(id);
+        appState.statusMessage = std::string(label) + (resumed ? " (Assembly) resumed" : " (Assembly) selected");
+    }
+    if (isActive) {
+        ImGui::PopStyleColor();
+    }
+}
+
+// ===== Frame Scheduling =====
+
+/**
+ * @brief True while the screen changes without input, so frames can't be skipped
+ */
+static bool needsContinuousFrames(const ApplicationState& appState) {
+    // Finished background jobs wake the loop themselves; the profiler graphs every frame
+    if (appState.showProfiler) {
+        return true;
+    }
+    const dsav::IVisualizer* visualizer = appState.visualizers.current();
+    return visualizer && (visualizer->isAnimating() || !visualizer->isPaused());
+}
+
 // ===== Callback Implementations =====
 
 static void glfwErrorCallback(int error, const char* description) {
@@ -10,6 +10,8 @@
 namespace dsav {
 
 AsmStackVisualizer::AsmStackVisualizer() {
+    m_animator.bindContainer(m_elements);
+
     // Initialize assembly stack (clears it)
     stack_clear();
 
@@ -20,6 +22,9 @@ AsmStackVisualizer::AsmStackVisualizer() {
 }
 
 void AsmStackVisualizer::update(float deltaTime) {
+    // Pick up changes made behind our back (no-op if the generation is unchanged)
+    syncFromAssembly();
+
     // Update animations
     m_animator.update(deltaTime * m_speed);
 }
@@ -29,9 +34,8 @@ void AsmStackVisualizer::renderVisualization() {
     ImVec2 windowPos = ImGui::GetCursorScreenPos();
 
     // Draw capacity indicator
-    int capacity = stack_get_capacity();
-    int top = stack_get_top();
-    int size = top + 1;
+    int capacity = static_cast<int>(m_view.capacity());
+    int size = static_cast<int>(m_view.size());
 
     // Draw empty stack slots
     for (int i = 0; i < capacity; ++i) {
@@ -58,24 +62,24 @@ void AsmStackVisualizer::renderVisualization() {
         drawList->AddRect(topLeft, bottomRight, borderColor, 4.0f, 0, 2.0f);
 
         // Draw value text (centered)
-        ImVec2 textSize = ImGui::CalcTextSize(element.label.c_str());
+        ImVec2 textSize = labels::textSize(element.label);
         ImVec2 textPos(
             topLeft.x + (ELEMENT_WIDTH - textSize.x) * 0.5f,
             topLeft.y + (ELEMENT_HEIGHT - textSize.y) * 0.5f
         );
 
-        drawList->AddText(textPos, IM_COL32(255, 255, 255, 255), element.label.c_str());
+        labels::draw(drawList, textPos, IM_COL32(255, 255, 255, 255), element.label);
 
         // Draw sublabel (TOP indicator)
-        if (!element.sublabel.empty()) {
-            ImVec2 sublabelSize = ImGui::CalcTextSize(element.sublabel.c_str());
+        if (element.sublabel != NO_LABEL) {
+            ImVec2 sublabelSize = labels::textSize(element.sublabel);
             ImVec2 sublabelPos(
                 topLeft.x + (ELEMENT_WIDTH - sublabelSize.x) * 0.5f,
                 topLeft.y - 20.0f
             );
-            drawList->AddText(sublabelPos,
+            labels::draw(drawList, sublabelPos,
                 ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::green)),
-                element.sublabel.c_str());
+                element.sublabel);
         }
     }
 
@@ -226,8 +230,12 @@ void AsmStackVisualizer::pushValue(int value) {
 }
 
 void AsmStackVisualizer::popValue() {
+    // stack_pop returns the value itself, so check for underflow first
     int value = 0;
-    int success = stack_pop(&value);
+    bool success = !stack_is_empty();
+    if (success) {
+        value = stack_pop();
+    }
 
     if (success) {
         m_lastPoppedValue = value;
@@ -245,7 +253,10 @@ void AsmStackVisualizer::popValue() {
 
 void AsmStackVisualizer::peekValue() {
     int value = 0;
-    int success = stack_peek(&value);
+    bool success = !stack_is_empty();
+    if (success) {
+        value = stack_peek();
+    }
 
     if (success) {
         m_lastPeekedValue = value;
@@ -275,25 +286,35 @@ void AsmStackVisualizer::peekValue() {
 }
 
 void AsmStackVisualizer::syncFromAssembly() {
-    // Read current state from assembly
-    int* data = stack_get_data();
-    int top = stack_get_top();
-    int capacity = stack_get_capacity();
+    if (!m_view.refresh()) {
+        return;
+    }
 
-    // Clear existing visual elements
-    m_elements.clear();
+    // Keep bars whose slot still holds the same value
+    AsmSpan<int> items = m_view.items();
+    size_t keep = 0;
+    while (keep < m_elements.size() && keep < items.size() &&
+           m_elements[keep].label == labels::fromInt(items[keep])) {
+        ++keep;
+    }
+    m_elements.resize(keep);
 
-    // Create visual elements for each stack item
-    for (int i = 0; i <= top && i < capacity; ++i) {
+    // Create visual elements for the rest
+    for (size_t i = keep; i < items.size(); ++i) {
         VisualElement elem;
-        elem.label = std::to_string(data[i]);
-        elem.sublabel = (i == top) ? "TOP" : "";
+        elem.label = labels::fromInt(items[i]);
         elem.position = calculatePosition(i);
         elem.size = glm::vec2(ELEMENT_WIDTH, ELEMENT_HEIGHT);
         elem.color = colors::semantic::elementBase;
-        elem.borderColor = (i == top) ? colors::semantic::active : colors::semantic::elementBorder;
         m_elements.push_back(elem);
     }
+
+    // The TOP marker follows the last element
+    for (size_t i = 0; i < m_elements.size(); ++i) {
+        bool isTop = (i + 1 == m_elements.size());
+        m_elements[i].sublabel = isTop ? labels::intern("TOP") : NO_LABEL;
+        m_elements[i].borderColor = isTop ? colors::semantic::active : colors::semantic::elementBorder;
+    }
 }
 
 glm::vec2 AsmStackVisualizer::calculatePosition(size_t index) const {
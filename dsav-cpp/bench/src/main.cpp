@@ -0,0 +1,1310 @@
+/**
+ * @file main.cpp
+ * @brief Entry point for dsav-bench, the headless stepper benchmark
+ *
+ * Drives every sorting and searching stepper to completion across input
+ * sizes (a one-key edge case first) and distributions and reports ns/step,
+ * total steps, comparisons and swaps. No window, OpenGL or ImGui is involved, so the numbers track
+ * the stepper hot paths alone.
+ *
+ * With --complexity it instead sweeps every data structure operation over
+ * power-of-two sizes and reports the counted work per operation.
+ *
+ * With --containers it times the node-based containers against their
+ * cache-friendly counterparts (LinkedList vs UnrolledLinkedList, RedBlackTree
+ * vs BTree and BPlusTree) on scans and lookups, where large n turns every
+ * extra pointer hop into a likely cache miss, binary against 4- and
+ * 8-ary heaps on heapify, push and pop, and the open-addressing HashMap
+ * against std::unordered_map.
+ *
+ * With --concurrent it runs producer/consumer threads through the lock-free
+ * queues and stack and their mutex-wrapped Queue and Stack baselines at
+ * growing thread counts, reporting throughput, the speedup over the
+ * baseline and how many CAS attempts had to be retried.
+ *
+ * With --dataset the sorting and searching runs use the keys of a recorded
+ * file (sampled down to --max-size) instead of generated inputs, and
+ * --convert-dataset rewrites a raw or text key file in the compact format.
+ *
+ * With --workload it replays a workload script against fresh containers in
+ * timed batches and reports ops/s and the batch-time percentiles;
+ * --generate-workload writes a random script to replay.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "algorithms/sorting.hpp"
+#include "algorithms/searching.hpp"
+#include "algorithms/parallel_sorting.hpp"
+#include "algorithms/simd_kernels.hpp"
+#include "algorithms/complexity.hpp"
+#include "algorithms/dataset_import.hpp"
+#include "algorithms/concurrent_workload.hpp"
+#include "algorithms/workload_script.hpp"
+#include "data_structures/linked_list.hpp"
+#include "data_structures/unrolled_linked_list.hpp"
+#include "data_structures/red_black_tree.hpp"
+#include "data_structures/btree.hpp"
+#include "data_structures/bplus_tree.hpp"
+#include "data_structures/dary_heap.hpp"
+#include "data_structures/hash_map.hpp"
+#include <unordered_map>
+
+using namespace dsav::algorithms;
+
+namespace {
+
+// ===== Configuration =====
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t DEFAULT_MIN_SIZE = 100;
+constexpr size_t DEFAULT_MAX_SIZE = 1000000;
+constexpr double DEFAULT_TIME_LIMIT = 10.0;    ///< Seconds per run before it is cut off
+constexpr size_t DEFAULT_QUERIES = 1000;       ///< Targets per search run
+constexpr std::uint32_t DEFAULT_SEED = 42;
+constexpr size_t CLOCK_CHECK_INTERVAL = 4096;  ///< Steps between deadline checks
+constexpr int FEW_UNIQUE_VALUES = 8;
+constexpr size_t CONTAINER_LOOKUPS = 100000;       ///< Tree searches per container run
+constexpr size_t CONTAINER_FIND_BUDGET = 50000000; ///< Elements scanned by the linear finds per run
+constexpr size_t CONTAINER_NODE_CAP = 16;          ///< UnrolledLinkedList elements per node
+constexpr size_t CONTAINER_ORDER = 16;             ///< BTree / BPlusTree children per node
+constexpr size_t CONCURRENT_RING_CAPACITY = 1024;  ///< MpmcRing cells in --concurrent runs
+constexpr size_t DEFAULT_WORKLOAD_OPS = 1000000;   ///< --generate-workload script length
+constexpr size_t DEFAULT_WORKLOAD_BATCH = 4096;    ///< Ops per timed batch in --workload runs
+
+enum class Distribution {
+    Random,
+    Sorted,
+    Reversed,
+    FewUnique,
+    Dataset     ///< Keys of the --dataset file
+};
+
+const char* distributionName(Distribution dist) {
+    switch (dist) {
+        case Distribution::Random:    return "random";
+        case Distribution::Sorted:    return "sorted";
+        case Distribution::Reversed:  return "reversed";
+        case Distribution::FewUnique: return "few-unique";
+        case Distribution::Dataset:   return "dataset";
+    }
+    return "?";
+}
+
+struct Options {
+    size_t minSize = DEFAULT_MIN_SIZE;
+    size_t maxSize = DEFAULT_MAX_SIZE;
+    double timeLimit = DEFAULT_TIME_LIMIT;
+    size_t queries = DEFAULT_QUERIES;
+    std::uint32_t seed = DEFAULT_SEED;
+    bool csv = false;
+    bool fastForward = false;                 ///< Vectorized kernels where a stepper has them
+    bool complexity = false;                  ///< Sweep the data structures instead of the steppers
+    bool containers = false;                  ///< Time list and tree layouts instead of the steppers
+    bool concurrent = false;                  ///< Run the producer/consumer scaling sweep instead
+    size_t threads = 0;                       ///< Most threads in the sweep (0 = hardware threads)
+    std::vector<std::string> algorithms;      ///< Empty = all
+    std::vector<Distribution> distributions;  ///< Empty = all
+    std::string dataset;                      ///< Key file replacing the generated inputs
+    std::string convertInput;                 ///< --convert-dataset source
+    std::string convertOutput;                ///< --convert-dataset destination
+    std::string workload;                     ///< Script to replay instead
+    std::string generateWorkload;             ///< --generate-workload destination
+    size_t workloadOps = DEFAULT_WORKLOAD_OPS;
+    size_t workloadBatch = DEFAULT_WORKLOAD_BATCH;
+    WorkloadMix workloadMix;
+    std::vector<WorkloadContainer> workloadContainers;  ///< Empty = stack, queue and rbtree
+};
+
+/**
+ * @brief Outcome of driving one stepper (or one batch of searches) to completion
+ */
+struct RunResult {
+    size_t steps = 0;
+    size_t comparisons = 0;
+    size_t swaps = 0;
+    double seconds = 0.0;
+    bool completed = true;  ///< False if the time limit cut the run short
+    bool valid = true;      ///< Output matched the reference result
+};
+
+// ===== Input Generation =====
+
+/**
+ * @brief Build an input array
+ *
+ * Values are always even so that odd search targets are guaranteed misses.
+ */
+std::vector<int> makeInput(Distribution dist, size_t n, std::mt19937& rng) {
+    std::vector<int> arr(n);
+    switch (dist) {
+        case Distribution::Random: {
+            std::uniform_int_distribution<int> value(0, static_cast<int>(n));
+            for (int& v : arr) v = value(rng) * 2;
+            break;
+        }
+        case Distribution::Sorted:
+            for (size_t i = 0; i < n; ++i) arr[i] = static_cast<int>(i) * 2;
+            break;
+        case Distribution::Reversed:
+            for (size_t i = 0; i < n; ++i) arr[i] = static_cast<int>(n - i) * 2;
+            break;
+        case Distribution::FewUnique: {
+            std::uniform_int_distribution<int> value(0, FEW_UNIQUE_VALUES - 1);
+            for (int& v : arr) v = value(rng) * 2;
+            break;
+        }
+        case Distribution::Dataset:
+            break;  // Loaded by loadDataset()
+    }
+    return arr;
+}
+
+/**
+ * @brief Half hits drawn from the array, half guaranteed misses
+ */
+std::vector<int> makeTargets(const std::vector<int>& arr, size_t count, std::mt19937& rng) {
+    std::vector<int> targets(count);
+    std::uniform_int_distribution<size_t> index(0, arr.size() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        int hit = arr[index(rng)];
+        targets[i] = (i % 2 == 0 || hit == INT_MAX) ? hit : hit + 1;
+    }
+    return targets;
+}
+
+// ===== Runners =====
+
+/// Steppers with a vectorized fast path expose setFastForward()
+template <typename Stepper, typename = void>
+struct HasFastForward : std::false_type {};
+
+template <typename Stepper>
+struct HasFastForward<Stepper, std::void_t<decltype(std::declval<Stepper&>().setFastForward(true))>>
+    : std::true_type {};
+
+template <typename Stepper>
+RunResult runSort(std::vector<int> arr, double timeLimit, bool fastForward) {
+    RunResult result;
+    Stepper stepper(arr);
+    if constexpr (HasFastForward<Stepper>::value) {
+        stepper.setFastForward(fastForward);
+    }
+
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(timeLimit));
+
+    while (true) {
+        bool more = stepper.step();
+        result.steps++;
+        if (!more) break;
+        if (result.steps % CLOCK_CHECK_INTERVAL == 0 && Clock::now() > deadline) {
+            result.completed = false;
+            break;
+        }
+    }
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.comparisons = stepper.getComparisons();
+    result.swaps = stepper.getSwaps();
+    if (result.completed) {
+        result.valid = stepper.isComplete() && std::is_sorted(arr.begin(), arr.end());
+    }
+    return result;
+}
+
+template <typename Stepper>
+RunResult runSearch(const std::vector<int>& arr, const std::vector<int>& targets, double timeLimit,
+                    bool fastForward) {
+    RunResult result;
+    std::vector<int> found;
+    found.reserve(targets.size());
+
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(timeLimit));
+
+    for (int target : targets) {
+        Stepper stepper(arr, target);
+        if constexpr (HasFastForward<Stepper>::value) {
+            stepper.setFastForward(fastForward);
+        }
+        while (true) {
+            bool more = stepper.step();
+            result.steps++;
+            if (!more) break;
+            if (result.steps % CLOCK_CHECK_INTERVAL == 0 && Clock::now() > deadline) {
+                result.completed = false;
+                break;
+            }
+        }
+        result.comparisons += stepper.getComparisons();
+        if (!result.completed) break;
+        found.push_back(stepper.getResult());
+    }
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Check every finished query against the reference answer
+    std::vector<int> reference(arr);
+    std::sort(reference.begin(), reference.end());
+    for (size_t i = 0; i < found.size(); ++i) {
+        bool present = std::binary_search(reference.begin(), reference.end(), targets[i]);
+        int idx = found[i];
+        if (idx < 0) {
+            result.valid = result.valid && !present;
+        } else {
+            result.valid = result.valid && idx < static_cast<int>(arr.size()) && arr[idx] == targets[i];
+        }
+    }
+    return result;
+}
+
+// ===== Benchmarks =====
+
+/// Arrangement a search expects its input in
+enum class Layout {
+    AsIs,
+    Sorted,
+    Eytzinger   ///< Sorted, then reordered by eytzingerLayout()
+};
+
+struct Benchmark {
+    const char* name;
+    Layout layout;
+    bool isSearch;
+    RunResult (*sort)(std::vector<int>, double, bool);
+    RunResult (*search)(const std::vector<int>&, const std::vector<int>&, double, bool);
+};
+
+const std::vector<Benchmark>& benchmarks() {
+    static const std::vector<Benchmark> all = {
+        {"bubble",        Layout::AsIs,      false, &runSort<BubbleSortStepper>, nullptr},
+        {"selection",     Layout::AsIs,      false, &runSort<SelectionSortStepper>, nullptr},
+        {"insertion",     Layout::AsIs,      false, &runSort<InsertionSortStepper>, nullptr},
+        {"merge",         Layout::AsIs,      false, &runSort<MergeSortStepper>, nullptr},
+        {"quick",         Layout::AsIs,      false, &runSort<QuickSortStepper>, nullptr},
+        {"heap",          Layout::AsIs,      false, &runSort<HeapSortStepper>, nullptr},
+        {"shell",         Layout::AsIs,      false, &runSort<ShellSortStepper>, nullptr},
+        {"radix",         Layout::AsIs,      false, &runSort<RadixSortStepper>, nullptr},
+        {"counting",      Layout::AsIs,      false, &runSort<CountingSortStepper>, nullptr},
+        {"intro",         Layout::AsIs,      false, &runSort<IntroSortStepper>, nullptr},
+        {"par-merge",     Layout::AsIs,      false, &runSort<ParallelMergeSortStepper>, nullptr},
+        {"par-quick",     Layout::AsIs,      false, &runSort<ParallelQuickSortStepper>, nullptr},
+        {"linear",        Layout::AsIs,      true,  nullptr, &runSearch<LinearSearchStepper>},
+        {"binary",        Layout::Sorted,    true,  nullptr, &runSearch<BinarySearchStepper>},
+        {"branchless",    Layout::Sorted,    true,  nullptr, &runSearch<BranchlessBinarySearchStepper>},
+        {"eytzinger",     Layout::Eytzinger, true,  nullptr, &runSearch<EytzingerSearchStepper>},
+        {"interpolation", Layout::Sorted,    true,  nullptr, &runSearch<InterpolationSearchStepper>},
+        {"exponential",   Layout::Sorted,    true,  nullptr, &runSearch<ExponentialSearchStepper>},
+    };
+    return all;
+}
+
+// ===== Output =====
+
+void printHeader(bool csv) {
+    if (csv) {
+        std::cout << "algorithm,distribution,n,steps,comparisons,swaps,ms,ns_per_step,status\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(15) << "algorithm"
+              << std::setw(12) << "dist"
+              << std::right
+              << std::setw(9) << "n"
+              << std::setw(14) << "steps"
+              << std::setw(14) << "comparisons"
+              << std::setw(14) << "swaps"
+              << std::setw(11) << "ms"
+              << std::setw(10) << "ns/step"
+              << "  status\n";
+    std::cout << std::string(101, '-') << "\n";
+}
+
+void printRow(bool csv, const char* name, Distribution dist, size_t n, const RunResult& r) {
+    double ms = r.seconds * 1e3;
+    double nsPerStep = (r.steps > 0) ? (r.seconds * 1e9) / static_cast<double>(r.steps) : 0.0;
+    const char* status = !r.valid ? "FAIL" : (r.completed ? "ok" : "timeout");
+
+    if (csv) {
+        std::cout << name << ',' << distributionName(dist) << ',' << n << ','
+                  << r.steps << ',' << r.comparisons << ',' << r.swaps << ','
+                  << std::fixed << std::setprecision(3) << ms << ','
+                  << std::setprecision(2) << nsPerStep << ',' << status << "\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(15) << name
+              << std::setw(12) << distributionName(dist)
+              << std::right
+              << std::setw(9) << n
+              << std::setw(14) << r.steps
+              << std::setw(14) << r.comparisons
+              << std::setw(14) << r.swaps
+              << std::fixed << std::setprecision(2)
+              << std::setw(11) << ms
+              << std::setw(10) << nsPerStep
+              << "  " << status << "\n";
+}
+
+void printComplexityHeader(bool csv) {
+    if (csv) {
+        std::cout << "structure,operation,n,comparisons,hops,moves,allocations,rotations,ns\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(20) << "structure"
+              << std::setw(22) << "operation"
+              << std::right
+              << std::setw(8) << "n"
+              << std::setw(12) << "compares"
+              << std::setw(10) << "hops"
+              << std::setw(10) << "moves"
+              << std::setw(8) << "allocs"
+              << std::setw(8) << "rotates"
+              << std::setw(10) << "ns"
+              << "   (per operation)\n";
+    std::cout << std::string(126, '-') << "\n";
+}
+
+void printComplexityRow(bool csv, ComplexityOp op, const ComplexitySample& sample) {
+    const ComplexityOpInfo& info = complexityOpInfo(op);
+    if (csv) {
+        std::cout << info.structure << ',' << info.operation << ',' << sample.n << std::fixed << std::setprecision(3);
+        for (size_t m = 0; m < COMPLEXITY_METRIC_COUNT; ++m) {
+            std::cout << ',' << sample.perOperation(static_cast<ComplexityMetric>(m));
+        }
+        std::cout << "\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(20) << info.structure
+              << std::setw(22) << info.operation
+              << std::right
+              << std::setw(8) << sample.n
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << sample.perOperation(ComplexityMetric::Comparisons)
+              << std::setw(10) << sample.perOperation(ComplexityMetric::Hops)
+              << std::setw(10) << sample.perOperation(ComplexityMetric::Moves)
+              << std::setw(8) << sample.perOperation(ComplexityMetric::Allocations)
+              << std::setw(8) << sample.perOperation(ComplexityMetric::Rotations)
+              << std::setw(10) << sample.perOperation(ComplexityMetric::Nanoseconds)
+              << "\n";
+}
+
+/**
+ * @brief Largest exponent e with 2^e <= n
+ */
+size_t floorLog2(size_t n) {
+    size_t exponent = 0;
+    while (n > 1) {
+        n >>= 1;
+        ++exponent;
+    }
+    return exponent;
+}
+
+int runComplexitySweep(const Options& options) {
+    size_t minExponent = floorLog2(options.minSize);
+    size_t maxExponent = floorLog2(options.maxSize);
+
+    if (!options.csv && !dsav::OpCounted::countingEnabled()) {
+        std::cout << "operation counters compiled out (ENABLE_OP_COUNTERS=OFF): only ns is measured\n\n";
+    }
+    printComplexityHeader(options.csv);
+
+    std::vector<ComplexitySample> samples;
+    for (size_t i = 0; i < COMPLEXITY_OP_COUNT; ++i) {
+        ComplexityOp op = static_cast<ComplexityOp>(i);
+        runComplexity(op, minExponent, maxExponent, options.seed, samples);
+        for (const ComplexitySample& sample : samples) {
+            printComplexityRow(options.csv, op, sample);
+        }
+    }
+    return 0;
+}
+
+// ===== Container Layouts =====
+
+/**
+ * @brief Timed scan or lookup batch over one container
+ */
+struct ContainerResult {
+    size_t operations = 0;      ///< Scans or lookups performed
+    double seconds = 0.0;
+    std::uint64_t hops = 0;     ///< Links followed (0 with counters compiled out)
+    size_t nodes = 0;           ///< Nodes holding the n elements
+    bool valid = true;          ///< Every result matched the reference
+};
+
+/// Keeps scan and lookup results from being optimized away
+volatile std::uint64_t g_containerSink = 0;
+
+void printContainerHeader(bool csv) {
+    if (csv) {
+        std::cout << "structure,operation,n,operations,ns_per_op,hops_per_op,nodes,status\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(24) << "structure"
+              << std::setw(10) << "operation"
+              << std::right
+              << std::setw(10) << "n"
+              << std::setw(10) << "ops"
+              << std::setw(14) << "ns/op"
+              << std::setw(12) << "hops/op"
+              << std::setw(10) << "nodes"
+              << "  status\n";
+    std::cout << std::string(98, '-') << "\n";
+}
+
+void printContainerRow(bool csv, const char* structure, const char* operation, size_t n,
+                       const ContainerResult& r) {
+    double ops = static_cast<double>(std::max<size_t>(r.operations, 1));
+    double nsPerOp = r.seconds * 1e9 / ops;
+    double hopsPerOp = static_cast<double>(r.hops) / ops;
+    const char* status = r.valid ? "ok" : "FAIL";
+
+    if (csv) {
+        std::cout << structure << ',' << operation << ',' << n << ',' << r.operations << ','
+                  << std::fixed << std::setprecision(2) << nsPerOp << ',' << hopsPerOp << ','
+                  << r.nodes << ',' << status << "\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(24) << structure
+              << std::setw(10) << operation
+              << std::right
+              << std::setw(10) << n
+              << std::setw(10) << r.operations
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << nsPerOp
+              << std::setw(12) << hopsPerOp
+              << std::setw(10) << r.nodes
+              << "  " << status << "\n";
+}
+
+/**
+ * @brief Time a batch and read the hops the container counted during it
+ *
+ * @param batch Runs the operations, returns false if a result was wrong
+ */
+template <typename Container, typename Batch>
+ContainerResult timeContainer(Container& container, size_t operations, Batch&& batch) {
+    ContainerResult result;
+    result.operations = operations;
+    container.resetOpCounters();
+
+    auto start = Clock::now();
+    result.valid = batch(container);
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    result.hops = container.opCounters().hops;
+    return result;
+}
+
+/**
+ * @brief Sum every element, then look up present elements by linear search
+ */
+template <typename List>
+void benchList(const char* name, bool csv, const std::vector<int>& values,
+               const std::vector<int>& probes, std::uint64_t expectedSum) {
+    List list;
+    list.reserve(values.size());
+    for (int value : values) list.insertBack(value);
+    size_t nodes = list.size();
+    if constexpr (std::is_same_v<List, dsav::UnrolledLinkedList<int, CONTAINER_NODE_CAP>>) {
+        nodes = list.nodeCount();
+    }
+
+    ContainerResult scan = timeContainer(list, 1, [&](const List& l) {
+        std::uint64_t sum = 0;
+        l.traverse([&sum](const int& value) { sum += static_cast<std::uint64_t>(value); });
+        g_containerSink = g_containerSink + sum;
+        return sum == expectedSum;
+    });
+    scan.nodes = nodes;
+    printContainerRow(csv, name, "scan", values.size(), scan);
+
+    ContainerResult find = timeContainer(list, probes.size(), [&](const List& l) {
+        bool ok = true;
+        for (int probe : probes) {
+            std::optional<size_t> index = l.find(probe);
+            ok = ok && index.has_value();
+            g_containerSink = g_containerSink + index.value_or(0);
+        }
+        return ok;
+    });
+    find.nodes = nodes;
+    printContainerRow(csv, name, "find", values.size(), find);
+}
+
+/**
+ * @brief Search shuffled keys (half present, half missing), then scan in order
+ */
+template <typename Tree>
+void benchTree(const char* name, bool csv, const std::vector<int>& shuffled,
+               const std::vector<int>& probes, std::uint64_t expectedSum) {
+    Tree tree;
+    tree.reserve(shuffled.size());
+    for (int key : shuffled) tree.insert(key);
+    size_t nodes = tree.size();
+    if constexpr (!std::is_same_v<Tree, dsav::RedBlackTree<int>>) {
+        nodes = tree.nodeCount();
+    }
+
+    ContainerResult search = timeContainer(tree, probes.size(), [&](const Tree& t) {
+        bool ok = true;
+        for (int probe : probes) {
+            bool found = t.search(probe);
+            ok = ok && (found == (probe % 2 == 0));
+            g_containerSink = g_containerSink + (found ? 1 : 0);
+        }
+        return ok;
+    });
+    search.nodes = nodes;
+    printContainerRow(csv, name, "search", shuffled.size(), search);
+
+    ContainerResult scan = timeContainer(tree, 1, [&](const Tree& t) {
+        std::uint64_t sum = 0;
+        auto add = [&sum](const int& key) { sum += static_cast<std::uint64_t>(key); };
+        if constexpr (std::is_same_v<Tree, dsav::RedBlackTree<int>>) {
+            t.inorderTraversal(add);
+        } else {
+            t.traverse(add);
+        }
+        g_containerSink = g_containerSink + sum;
+        return sum == expectedSum;
+    });
+    scan.nodes = nodes;
+    printContainerRow(csv, name, "scan", shuffled.size(), scan);
+}
+
+/**
+ * @brief Heapify the keys, then push them one by one, then pop everything in order
+ *
+ * hops/op is levels walked per operation: a wider heap walks fewer levels
+ * but compares D children on each one.
+ */
+template <size_t D>
+void benchHeap(const char* name, bool csv, const std::vector<int>& shuffled, std::uint64_t expectedSum) {
+    using Heap = dsav::DaryHeap<int, D>;
+    Heap heap;
+
+    ContainerResult build = timeContainer(heap, shuffled.size(), [&](Heap& h) {
+        h.heapify(shuffled);
+        return h.size() == shuffled.size();
+    });
+    build.nodes = shuffled.size();
+    printContainerRow(csv, name, "heapify", shuffled.size(), build);
+
+    heap.clear();
+    heap.reserve(shuffled.size());
+    ContainerResult push = timeContainer(heap, shuffled.size(), [&](Heap& h) {
+        for (int key : shuffled) h.push(key);
+        return h.size() == shuffled.size();
+    });
+    push.nodes = shuffled.size();
+    printContainerRow(csv, name, "push", shuffled.size(), push);
+
+    ContainerResult pop = timeContainer(heap, shuffled.size(), [&](Heap& h) {
+        std::uint64_t sum = 0;
+        int previous = 0;
+        bool ordered = true;
+        while (std::optional<int> key = h.pop()) {
+            ordered = ordered && *key >= previous;
+            previous = *key;
+            sum += static_cast<std::uint64_t>(*key);
+        }
+        g_containerSink = g_containerSink + sum;
+        return ordered && sum == expectedSum;
+    });
+    pop.nodes = shuffled.size();
+    printContainerRow(csv, name, "pop", shuffled.size(), pop);
+}
+
+/**
+ * @brief std::unordered_map behind the HashMap interface (counts nothing)
+ */
+class StdHashMap : public dsav::OpCounted {
+public:
+    bool insert(int key, int value) { return m_map.insert_or_assign(key, value).second; }
+    bool remove(int key) { return m_map.erase(key) != 0; }
+    const int* find(int key) const {
+        auto it = m_map.find(key);
+        return it == m_map.end() ? nullptr : &it->second;
+    }
+    size_t size() const { return m_map.size(); }
+    size_t capacity() const { return m_map.bucket_count(); }
+    void setRehashStep(size_t) {}
+
+private:
+    std::unordered_map<int, int> m_map;
+};
+
+/**
+ * @brief Insert shuffled keys from empty, look up hits and misses, erase half
+ *
+ * "worst-ins" is the slowest single insert of a second build, timed one by
+ * one: with incremental rehash no insert copies the whole table, so it
+ * stays far below the all-at-once rehash of std::unordered_map or of a
+ * HashMap whose rehash step covers the whole table. nodes is the slot
+ * (bucket) count after the inserts.
+ */
+template <typename Map>
+void benchHashMap(const char* name, bool csv, const std::vector<int>& shuffled,
+                  const std::vector<int>& probes, size_t rehashStep) {
+    Map map;
+    map.setRehashStep(rehashStep);
+
+    ContainerResult insert = timeContainer(map, shuffled.size(), [&](Map& m) {
+        for (int key : shuffled) m.insert(key, key);
+        return m.size() == shuffled.size();
+    });
+    insert.nodes = map.capacity();
+    printContainerRow(csv, name, "insert", shuffled.size(), insert);
+
+    ContainerResult find = timeContainer(map, probes.size(), [&](const Map& m) {
+        bool ok = true;
+        for (int probe : probes) {
+            const int* value = m.find(probe);
+            ok = ok && ((value != nullptr) == (probe % 2 == 0)) && (!value || *value == probe);
+            g_containerSink = g_containerSink + (value ? 1 : 0);
+        }
+        return ok;
+    });
+    find.nodes = map.capacity();
+    printContainerRow(csv, name, "find", shuffled.size(), find);
+
+    ContainerResult erase = timeContainer(map, shuffled.size() / 2, [&](Map& m) {
+        bool ok = true;
+        for (size_t i = 0; i < shuffled.size() / 2; ++i) ok = m.remove(shuffled[i]) && ok;
+        return ok && m.size() == shuffled.size() - shuffled.size() / 2;
+    });
+    erase.nodes = map.capacity();
+    printContainerRow(csv, name, "erase", shuffled.size(), erase);
+
+    Map timed;
+    timed.setRehashStep(rehashStep);
+    ContainerResult worst;
+    worst.operations = 1;
+    for (int key : shuffled) {
+        auto start = Clock::now();
+        timed.insert(key, key);
+        worst.seconds = std::max(worst.seconds, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    worst.valid = timed.size() == shuffled.size();
+    worst.nodes = timed.capacity();
+    printContainerRow(csv, name, "worst-ins", shuffled.size(), worst);
+}
+
+int runContainerBench(const Options& options) {
+    if (!options.csv && !dsav::OpCounted::countingEnabled()) {
+        std::cout << "operation counters compiled out (ENABLE_OP_COUNTERS=OFF): hops read 0\n\n";
+    }
+    printContainerHeader(options.csv);
+
+    for (size_t n = options.minSize; n <= options.maxSize; n *= 10) {
+        std::mt19937 rng(options.seed ^ static_cast<std::uint32_t>(n * 2654435761u));
+
+        // Keys 0, 2, ..., 2(n - 1): even probes hit, odd probes miss
+        std::vector<int> keys(n);
+        std::uint64_t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            keys[i] = static_cast<int>(2 * i);
+            sum += static_cast<std::uint64_t>(keys[i]);
+        }
+        std::vector<int> shuffled(keys);
+        std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+        std::uniform_int_distribution<size_t> pick(0, n - 1);
+        std::vector<int> listProbes(std::max<size_t>(1, std::min(options.queries, CONTAINER_FIND_BUDGET / n)));
+        for (int& probe : listProbes) probe = keys[pick(rng)];
+        std::vector<int> treeProbes(CONTAINER_LOOKUPS);
+        for (size_t i = 0; i < treeProbes.size(); ++i) {
+            treeProbes[i] = keys[pick(rng)] + static_cast<int>(i % 2);
+        }
+
+        benchList<dsav::LinkedList<int>>("LinkedList", options.csv, shuffled, listProbes, sum);
+        benchList<dsav::UnrolledLinkedList<int, CONTAINER_NODE_CAP>>(
+            "UnrolledLinkedList<16>", options.csv, shuffled, listProbes, sum);
+        benchTree<dsav::RedBlackTree<int>>("RedBlackTree", options.csv, shuffled, treeProbes, sum);
+        benchTree<dsav::BTree<int, CONTAINER_ORDER>>("BTree<16>", options.csv, shuffled, treeProbes, sum);
+        benchTree<dsav::BPlusTree<int, CONTAINER_ORDER>>("BPlusTree<16>", options.csv, shuffled, treeProbes, sum);
+        benchHeap<2>("DaryHeap<2>", options.csv, shuffled, sum);
+        benchHeap<4>("DaryHeap<4>", options.csv, shuffled, sum);
+        benchHeap<8>("DaryHeap<8>", options.csv, shuffled, sum);
+
+        using RobinHoodMap = dsav::HashMap<int, int, dsav::HashProbing::RobinHood>;
+        using SwissMap = dsav::HashMap<int, int, dsav::HashProbing::Swiss>;
+        benchHashMap<RobinHoodMap>("HashMap<RobinHood>", options.csv, shuffled, treeProbes,
+                                   RobinHoodMap::DEFAULT_REHASH_STEP);
+        benchHashMap<SwissMap>("HashMap<Swiss>", options.csv, shuffled, treeProbes,
+                               SwissMap::DEFAULT_REHASH_STEP);
+        benchHashMap<SwissMap>("HashMap<Swiss> 1-shot", options.csv, shuffled, treeProbes, SIZE_MAX);
+        benchHashMap<StdHashMap>("std::unordered_map", options.csv, shuffled, treeProbes, 0);
+
+        if (n > options.maxSize / 10) break;
+    }
+    return 0;
+}
+
+// ===== Concurrent Containers =====
+
+void printConcurrentHeader(bool csv) {
+    if (csv) {
+        std::cout << "structure,producers,consumers,items,ms,mitems_per_s,speedup,cas_per_item,retry_pct,status\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(22) << "structure"
+              << std::right
+              << std::setw(6) << "prod"
+              << std::setw(6) << "cons"
+              << std::setw(10) << "items"
+              << std::setw(10) << "ms"
+              << std::setw(10) << "Mitems/s"
+              << std::setw(9) << "speedup"
+              << std::setw(10) << "cas/item"
+              << std::setw(9) << "retry%"
+              << "  status\n";
+    std::cout << std::string(100, '-') << "\n";
+}
+
+void printConcurrentRow(bool csv, const ConcurrentWorkload& workload, const ConcurrentResult& r,
+                        double baselineRate) {
+    double items = static_cast<double>(std::max<std::uint64_t>(r.itemsPopped, 1));
+    double rate = r.itemsPerSecond();
+    double speedup = baselineRate > 0.0 ? rate / baselineRate : 0.0;
+    double casPerItem = static_cast<double>(r.totals.attempts) / items;
+    double retryPct = 100.0 * r.totals.retryRate();
+    const char* status = !r.checksumOk ? "FAIL" : (r.completed ? "ok" : "cancelled");
+    const char* name = concurrentContainerName(workload.container);
+
+    if (csv) {
+        std::cout << concurrentContainerKey(workload.container) << ',' << workload.producers << ','
+                  << workload.consumers << ',' << r.itemsPopped << ',' << std::fixed
+                  << std::setprecision(3) << r.seconds * 1e3 << ',' << rate / 1e6 << ',' << speedup
+                  << ',' << casPerItem << ',' << retryPct << ',' << status << "\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(22) << name
+              << std::right
+              << std::setw(6) << workload.producers
+              << std::setw(6) << workload.consumers
+              << std::setw(10) << r.itemsPopped
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << r.seconds * 1e3
+              << std::setw(10) << rate / 1e6
+              << std::setw(9) << speedup
+              << std::setw(10) << casPerItem
+              << std::setw(9) << retryPct
+              << "  " << status << "\n";
+}
+
+/**
+ * @brief Every container at 2, 4, 8, ... threads (half producers), max-size items per run
+ *
+ * The speedup column compares against the mutex baseline of the same
+ * order at the same thread count. The probe only counts (it logs no
+ * events), and each thread counts into its own cache lines.
+ */
+int runConcurrentBench(const Options& options) {
+    size_t maxThreads = options.threads != 0
+        ? options.threads : static_cast<size_t>(std::thread::hardware_concurrency());
+    maxThreads = std::clamp<size_t>(maxThreads, 2,
+        ConcurrentWorkload::MAX_PRODUCERS + ConcurrentWorkload::MAX_CONSUMERS);
+
+    std::vector<size_t> threadCounts;
+    for (size_t t = 2; t <= maxThreads; t *= 2) threadCounts.push_back(t);
+    if (threadCounts.back() != maxThreads) threadCounts.push_back(maxThreads);
+
+    if (!options.csv) {
+        std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+                  << ", ring capacity: " << CONCURRENT_RING_CAPACITY << "\n\n";
+    }
+    printConcurrentHeader(options.csv);
+
+    bool allValid = true;
+    for (size_t threads : threadCounts) {
+        double baselineRate[CONCURRENT_CONTAINER_COUNT] = {};
+        // Baselines come first in each order so the lock-free rows can refer to them
+        for (ConcurrentContainer container : {ConcurrentContainer::MutexQueue,
+                                              ConcurrentContainer::MichaelScottQueue,
+                                              ConcurrentContainer::MpmcRing,
+                                              ConcurrentContainer::MutexStack,
+                                              ConcurrentContainer::TreiberStack}) {
+            ConcurrentWorkload workload;
+            workload.container = container;
+            workload.producers = threads / 2;
+            workload.consumers = threads - threads / 2;
+            workload.itemsPerProducer = std::max<size_t>(1, options.maxSize / workload.producers);
+            workload.ringCapacity = CONCURRENT_RING_CAPACITY;
+
+            dsav::ContentionProbe probe(contentionSiteCount(container, workload.ringCapacity),
+                                        workload.threadCount(), 0, 2);
+            ConcurrentResult result;
+            allValid = runConcurrentWorkload(workload, result, &probe) && allValid;
+
+            baselineRate[static_cast<size_t>(container)] = result.itemsPerSecond();
+            printConcurrentRow(options.csv, workload, result,
+                               baselineRate[static_cast<size_t>(mutexBaselineFor(container))]);
+        }
+    }
+    return allValid ? 0 : 1;
+}
+
+// ===== Workload Replay =====
+
+void printWorkloadHeader(bool csv) {
+    if (csv) {
+        std::cout << "structure,ops,ms,mops_per_s,hit_pct,final_size,batches,batch_p50_us,batch_p99_us\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(16) << "structure"
+              << std::right
+              << std::setw(10) << "ops"
+              << std::setw(10) << "ms"
+              << std::setw(9) << "Mops/s"
+              << std::setw(8) << "hit%"
+              << std::setw(10) << "size"
+              << std::setw(9) << "batches"
+              << std::setw(11) << "p50 us"
+              << std::setw(11) << "p99 us" << "\n";
+    std::cout << std::string(94, '-') << "\n";
+}
+
+void printWorkloadRow(bool csv, WorkloadContainer container, const WorkloadResult& r) {
+    double hitPct = r.applied > 0 ? 100.0 * static_cast<double>(r.hits) / static_cast<double>(r.applied) : 0.0;
+    if (csv) {
+        std::cout << workloadContainerKey(container) << ',' << r.applied << ',' << std::fixed
+                  << std::setprecision(3) << r.seconds * 1e3 << ',' << r.opsPerSecond() / 1e6 << ','
+                  << hitPct << ',' << r.finalSize << ',' << r.batches << ',' << r.batchP50Us << ','
+                  << r.batchP99Us << "\n";
+        return;
+    }
+    std::cout << std::left
+              << std::setw(16) << workloadContainerName(container)
+              << std::right
+              << std::setw(10) << r.applied
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << r.seconds * 1e3
+              << std::setw(9) << r.opsPerSecond() / 1e6
+              << std::setw(8) << hitPct
+              << std::setw(10) << r.finalSize
+              << std::setw(9) << r.batches
+              << std::setw(11) << r.batchP50Us
+              << std::setw(11) << r.batchP99Us << "\n";
+}
+
+/**
+ * @brief Write a random script (text for a .txt path, binary otherwise)
+ */
+int runGenerateWorkload(const Options& options) {
+    WorkloadScript script;
+    script.generate(options.workloadOps, options.workloadMix, options.seed);
+    const std::string& path = options.generateWorkload;
+    bool text = path.size() >= 4 && path.compare(path.size() - 4, 4, ".txt") == 0;
+    if (!script.save(path, text ? WorkloadFormat::Text : WorkloadFormat::Binary)) {
+        std::cerr << script.error() << "\n";
+        return 1;
+    }
+    std::cout << path << ": " << script.size() << " ops (" << script.count(WorkloadOpCode::Insert)
+              << " insert, " << script.count(WorkloadOpCode::Remove) << " remove, "
+              << script.count(WorkloadOpCode::Search) << " search), " << (text ? "text" : "binary") << "\n";
+    return 0;
+}
+
+/**
+ * @brief Replay the --workload script once per selected container
+ *
+ * Every container starts empty. The array is off by default: its removes
+ * and searches scan, which makes a long script quadratic.
+ */
+int runWorkloadBench(const Options& options) {
+    WorkloadScript script;
+    if (!script.load(options.workload)) {
+        std::cerr << "Cannot read " << options.workload << ": " << script.error() << "\n";
+        return 2;
+    }
+    std::vector<WorkloadContainer> containers = options.workloadContainers;
+    if (containers.empty()) {
+        containers = {WorkloadContainer::Stack, WorkloadContainer::Queue, WorkloadContainer::RedBlackTree};
+    }
+
+    if (!options.csv) {
+        std::cout << "workload: " << options.workload << " (" << script.size() << " ops, batches of "
+                  << options.workloadBatch << ")\n\n";
+    }
+    printWorkloadHeader(options.csv);
+    for (WorkloadContainer container : containers) {
+        WorkloadResult result;
+        runWorkload(container, script, options.workloadBatch, result);
+        printWorkloadRow(options.csv, container, result);
+    }
+    return 0;
+}
+
+// ===== Datasets =====
+
+/**
+ * @brief Read the --dataset keys, sampled evenly down to maxSize
+ */
+bool loadDataset(const Options& options, std::vector<int>& keys) {
+    DatasetReader reader;
+    if (!reader.open(options.dataset) || !reader.readInto(keys, options.maxSize)) {
+        std::cerr << "Cannot read " << options.dataset << ": " << reader.error() << "\n";
+        return false;
+    }
+    if (keys.empty()) {
+        std::cerr << options.dataset << " has no keys\n";
+        return false;
+    }
+    if (!options.csv) {
+        const DatasetInfo& info = reader.info();
+        std::cout << "dataset: " << options.dataset << " (" << datasetFormatName(info.format)
+                  << ", " << keys.size() << " of " << info.count << " keys";
+        if (info.narrowed) std::cout << ", shifted right by " << info.narrowShift << " bits";
+        std::cout << ")\n\n";
+    }
+    return true;
+}
+
+/**
+ * @brief Rewrite a key file in the compact format, 4-byte keys if they all fit
+ */
+int runConvertDataset(const Options& options) {
+    DatasetReader reader;
+    if (!reader.open(options.convertInput) || !reader.scan()) {
+        std::cerr << "Cannot read " << options.convertInput << ": " << reader.error() << "\n";
+        return 1;
+    }
+    const DatasetInfo& info = reader.info();
+    bool fitsInt32 = info.count == 0
+        || (info.minKey >= INT32_MIN && info.maxKey <= INT32_MAX);
+
+    CompactDatasetWriter writer;
+    if (!writer.open(options.convertOutput, fitsInt32 ? 4 : 8)) {
+        std::cerr << "Cannot create " << options.convertOutput << ": " << writer.error() << "\n";
+        return 1;
+    }
+    bool ok = reader.readWide([&](const std::int64_t* keys, size_t count) {
+        return writer.append(keys, count);
+    });
+    if (!writer.close() || !ok) {
+        std::cerr << "Conversion failed: "
+                  << (writer.error().empty() ? reader.error() : writer.error()) << "\n";
+        return 1;
+    }
+
+    std::cout << options.convertOutput << ": " << writer.count() << " keys, "
+              << (fitsInt32 ? 4 : 8) << " bytes each, range [" << info.minKey << ", "
+              << info.maxKey << "], " << info.sortedness.descents << " descents, "
+              << info.sortedness.duplicates << " duplicates\n";
+    return 0;
+}
+
+// ===== Command Line =====
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --min-size N      Smallest input size after the n=1 edge case (default "
+              << DEFAULT_MIN_SIZE << ")\n"
+              << "  --max-size N      Largest input size (default " << DEFAULT_MAX_SIZE << ")\n"
+              << "  --algo LIST       Comma-separated: bubble,selection,insertion,merge,quick,\n"
+              << "                    heap,shell,radix,counting,intro,par-merge,\n"
+              << "                    par-quick,linear,binary,branchless,eytzinger,\n"
+              << "                    interpolation,exponential\n"
+              << "  --dist LIST       Comma-separated: random,sorted,reversed,few-unique\n"
+              << "  --time-limit S    Seconds per run before it is cut off (default " << DEFAULT_TIME_LIMIT << ")\n"
+              << "  --queries N       Targets per search run (default " << DEFAULT_QUERIES << ")\n"
+              << "  --seed N          RNG seed (default " << DEFAULT_SEED << ")\n"
+              << "  --csv             Emit CSV instead of a table\n"
+              << "  --fast-forward    Use the vectorized kernels (merge, quick, linear)\n"
+              << "  --simd LEVEL      Kernel instruction set: scalar,avx2,neon (default: best)\n"
+              << "  --complexity      Sweep the data structure operations instead (sizes are\n"
+              << "                    powers of two within the size range, up to 2^"
+              << COMPLEXITY_MAX_EXPONENT << ")\n"
+              << "  --containers      Time scans and lookups of LinkedList vs UnrolledLinkedList\n"
+              << "                    and RedBlackTree vs BTree/BPlusTree, and DaryHeap with\n"
+              << "                    D = 2/4/8 on heapify/push/pop, and HashMap (Robin Hood,\n"
+              << "                    Swiss) vs std::unordered_map instead\n"
+              << "  --concurrent      Run producer/consumer threads through the lock-free queues\n"
+              << "                    and stack vs mutex-wrapped Queue/Stack instead (max-size\n"
+              << "                    items per run)\n"
+              << "  --threads N       Most threads in the --concurrent sweep (default: hardware\n"
+              << "                    threads)\n"
+              << "  --dataset PATH    Sort and search the keys of a file (raw .i32/.i64, text or\n"
+              << "                    compact), sampled evenly down to --max-size\n"
+              << "  --convert-dataset IN OUT\n"
+              << "                    Write the keys of IN to OUT in the compact format\n"
+              << "  --workload PATH   Replay a workload script (text or binary) against fresh\n"
+              << "                    containers instead, in timed batches\n"
+              << "  --structures LIST Comma-separated --workload containers: array,stack,queue,\n"
+              << "                    rbtree (default stack,queue,rbtree)\n"
+              << "  --batch N         Ops per timed --workload batch (default " << DEFAULT_WORKLOAD_BATCH << ")\n"
+              << "  --generate-workload PATH\n"
+              << "                    Write a random script to PATH (text if it ends in .txt)\n"
+              << "  --ops N           Ops in a generated script (default " << DEFAULT_WORKLOAD_OPS << ")\n"
+              << "  --mix I,R,S       Insert, remove and search weights (default 50,25,25)\n"
+              << "  --burst N         Ops of the same kind in a row (default 1)\n"
+              << "  --key-range N     Operands drawn from [1, N] (default: the op count)\n"
+              << "\n"
+              << "Sizes step by powers of ten. Once a run times out, larger sizes of the\n"
+              << "same algorithm and distribution are skipped.\n";
+}
+
+std::vector<std::string> splitList(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+bool parseDistribution(const std::string& name, Distribution& out) {
+    for (Distribution dist : {Distribution::Random, Distribution::Sorted,
+                              Distribution::Reversed, Distribution::FewUnique}) {
+        if (name == distributionName(dist)) {
+            out = dist;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseArguments(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            std::exit(0);
+        } else if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--fast-forward") {
+            options.fastForward = true;
+        } else if (arg == "--complexity") {
+            options.complexity = true;
+        } else if (arg == "--containers") {
+            options.containers = true;
+        } else if (arg == "--concurrent") {
+            options.concurrent = true;
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--simd" && hasValue) {
+            std::string name = argv[++i];
+            bool known = false;
+            for (simd::SimdLevel level : {simd::SimdLevel::Scalar, simd::SimdLevel::Avx2,
+                                          simd::SimdLevel::Neon}) {
+                if (name == simd::levelName(level)) {
+                    known = true;
+                    if (!simd::setLevel(level)) {
+                        std::cerr << "SIMD level not supported here: " << name << "\n";
+                        return false;
+                    }
+                }
+            }
+            if (!known) {
+                std::cerr << "Unknown SIMD level: " << name << "\n";
+                return false;
+            }
+        } else if (arg == "--dataset" && hasValue) {
+            options.dataset = argv[++i];
+        } else if (arg == "--convert-dataset" && i + 2 < argc) {
+            options.convertInput = argv[++i];
+            options.convertOutput = argv[++i];
+        } else if (arg == "--workload" && hasValue) {
+            options.workload = argv[++i];
+        } else if (arg == "--generate-workload" && hasValue) {
+            options.generateWorkload = argv[++i];
+        } else if (arg == "--structures" && hasValue) {
+            for (const std::string& name : splitList(argv[++i])) {
+                WorkloadContainer container;
+                if (!parseWorkloadContainer(name, container)) {
+                    std::cerr << "Unknown structure: " << name << "\n";
+                    return false;
+                }
+                options.workloadContainers.push_back(container);
+            }
+        } else if (arg == "--batch" && hasValue) {
+            options.workloadBatch = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--ops" && hasValue) {
+            options.workloadOps = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--mix" && hasValue) {
+            std::vector<std::string> weights = splitList(argv[++i]);
+            if (weights.size() != 3) {
+                std::cerr << "--mix needs three weights: insert,remove,search\n";
+                return false;
+            }
+            options.workloadMix.insertWeight = static_cast<unsigned>(std::strtoul(weights[0].c_str(), nullptr, 10));
+            options.workloadMix.removeWeight = static_cast<unsigned>(std::strtoul(weights[1].c_str(), nullptr, 10));
+            options.workloadMix.searchWeight = static_cast<unsigned>(std::strtoul(weights[2].c_str(), nullptr, 10));
+        } else if (arg == "--burst" && hasValue) {
+            options.workloadMix.burst = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--key-range" && hasValue) {
+            options.workloadMix.keyRange = static_cast<std::int32_t>(
+                std::min<unsigned long long>(std::strtoull(argv[++i], nullptr, 10), INT32_MAX));
+        } else if (arg == "--min-size" && hasValue) {
+            options.minSize = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--max-size" && hasValue) {
+            options.maxSize = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--time-limit" && hasValue) {
+            options.timeLimit = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--queries" && hasValue) {
+            options.queries = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--algo" && hasValue) {
+            options.algorithms = splitList(argv[++i]);
+            for (const std::string& name : options.algorithms) {
+                bool known = std::any_of(benchmarks().begin(), benchmarks().end(),
+                    [&](const Benchmark& b) { return name == b.name; });
+                if (!known) {
+                    std::cerr << "Unknown algorithm: " << name << "\n";
+                    return false;
+                }
+            }
+        } else if (arg == "--dist" && hasValue) {
+            for (const std::string& name : splitList(argv[++i])) {
+                Distribution dist;
+                if (!parseDistribution(name, dist)) {
+                    std::cerr << "Unknown distribution: " << name << "\n";
+                    return false;
+                }
+                options.distributions.push_back(dist);
+            }
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << "\n";
+            return false;
+        }
+    }
+
+    if (options.minSize < 1 || options.maxSize < options.minSize) {
+        std::cerr << "Invalid size range\n";
+        return false;
+    }
+    if (!options.dataset.empty()) {
+        options.distributions = {Distribution::Dataset};
+    } else if (options.distributions.empty()) {
+        options.distributions = {Distribution::Random, Distribution::Sorted,
+                                 Distribution::Reversed, Distribution::FewUnique};
+    }
+    return true;
+}
+
+bool isSelected(const Options& options, const char* name) {
+    if (options.algorithms.empty()) return true;
+    return std::find(options.algorithms.begin(), options.algorithms.end(), name)
+        != options.algorithms.end();
+}
+
+} // namespace
+
+// ===== Main Function =====
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    if (options.complexity) {
+        return runComplexitySweep(options);
+    }
+    if (options.containers) {
+        return runContainerBench(options);
+    }
+    if (options.concurrent) {
+        return runConcurrentBench(options);
+    }
+    if (!options.convertInput.empty()) {
+        return runConvertDataset(options);
+    }
+    if (!options.generateWorkload.empty()) {
+        return runGenerateWorkload(options);
+    }
+    if (!options.workload.empty()) {
+        return runWorkloadBench(options);
+    }
+
+    std::vector<int> datasetKeys;
+    std::vector<size_t> sizes;
+    if (!options.dataset.empty()) {
+        if (!loadDataset(options, datasetKeys)) return 2;
+        sizes.push_back(datasetKeys.size());
+    } else {
+        // A single key always runs first, so the status column covers the
+        // steppers' nothing-to-compare path
+        if (options.minSize > 1) sizes.push_back(1);
+        for (size_t n = options.minSize; n <= options.maxSize; n *= 10) {
+            sizes.push_back(n);
+            if (n > options.maxSize / 10) break;
+        }
+    }
+
+    if (!options.csv && options.fastForward) {
+        std::cout << "fast-forward kernels: " << simd::levelName(simd::activeLevel()) << "\n\n";
+    }
+    printHeader(options.csv);
+
+    bool allValid = true;
+    for (const Benchmark& bench : benchmarks()) {
+        if (!isSelected(options, bench.name)) continue;
+
+        for (Distribution dist : options.distributions) {
+            for (size_t n : sizes) {
+                // Same seed per (size, distribution) so every algorithm sees identical input
+                std::mt19937 rng(options.seed ^ static_cast<std::uint32_t>(n * 2654435761u)
+                                 ^ static_cast<std::uint32_t>(dist));
+                std::vector<int> input = (dist == Distribution::Dataset)
+                    ? datasetKeys : makeInput(dist, n, rng);
+
+                RunResult result;
+                if (bench.isSearch) {
+                    if (bench.layout != Layout::AsIs) std::sort(input.begin(), input.end());
+                    if (bench.layout == Layout::Eytzinger) input = eytzingerLayout(input);
+                    std::vector<int> targets = makeTargets(input, options.queries, rng);
+                    result = bench.search(input, targets, options.timeLimit, options.fastForward);
+                } else {
+                    result = bench.sort(std::move(input), options.timeLimit, options.fastForward);
+                }
+
+                printRow(options.csv, bench.name, dist, n, result);
+                allValid = allValid && result.valid;
+
+                if (!result.completed) break;  // Larger inputs would only time out too
+            }
+        }
+    }
+
+    if (!allValid) {
+        std::cerr << "One or more runs produced incorrect output\n";
+        return 1;
+    }
+    return 0;
+}
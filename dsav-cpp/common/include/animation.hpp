@@ -9,12 +9,29 @@
 #pragma once
 
 #include <functional>
-#include <queue>
 #include <vector>
+#include <cstdint>
+#include <cstddef>
 #include <glm/glm.hpp>
 
 namespace dsav {
 
+/**
+ * @brief Easing curve identifier
+ *
+ * Tracks store an id instead of a function object so the per-frame
+ * evaluation loop can dispatch with a switch.
+ */
+enum class Easing : std::uint8_t {
+    Linear,
+    EaseInOut,
+    EaseIn,
+    EaseOut,
+    EaseOutBounce,
+    EaseOutElastic,
+    EaseOutBack
+};
+
 /**
  * @brief Easing functions for smooth animations
  *
@@ -42,33 +59,40 @@ namespace easing {
 
     /** Back easing (overshoots and returns) */
     float easeOutBack(float t);
+
+    /** Evaluate the curve identified by an Easing id */
+    float apply(Easing curve, float t);
 }
 
 /**
- * @brief Single animation instance
+ * @brief Description of a single tween
  *
- * An animation runs for a specified duration and calls an update function
- * with a normalized time value (0 to 1) on each frame.
+ * An animation drives 1, 2 or 4 floats (scale, position or color) from their
+ * value at the moment the animation starts playing to a target value. A null
+ * target makes it a pure delay. It is only a description: the controller
+ * copies it into its track store when enqueued.
  */
 struct Animation {
-    float duration;                              // Total duration in seconds
-    float elapsed = 0.0f;                        // Time elapsed so far
-    std::function<void(float t)> updateFn;       // Called each frame with t ∈ [0, 1]
+    float duration = 0.0f;                       // Total duration in seconds
+    Easing easing = Easing::EaseInOut;           // Easing curve
+    float* target = nullptr;                     // First animated component (nullptr = delay)
+    std::uint8_t components = 0;                 // Number of animated floats (0, 1, 2 or 4)
+    glm::vec4 to = glm::vec4(0.0f);              // Target value (unused components ignored)
     std::function<void()> onComplete;            // Called when animation completes
-    std::function<float(float)> easingFn = easing::easeInOut;  // Easing function
-
-    /** Check if animation has completed */
-    bool isComplete() const { return elapsed >= duration; }
-
-    /** Update the animation with delta time */
-    void update(float deltaTime);
 };
 
 /**
  * @brief Animation controller for managing animation queues
  *
- * Supports sequential animations (queue) and parallel animation groups.
- * Animations can be paused, their speed can be adjusted, and they can be cleared.
+ * Animations are stored as a structure of arrays (one track per tween) and
+ * played in steps: enqueue() adds a step with one track, enqueueParallel()
+ * adds a step whose tracks all play together, and a step ends only when all
+ * of its tracks have finished (a barrier). Each frame evaluates every track
+ * of the current step in a single loop.
+ *
+ * Targets that live inside a container registered with bindContainer() are
+ * stored as (container, byte offset) and re-resolved every frame, so they
+ * stay valid when the container reallocates.
  */
 class AnimationController {
 public:
@@ -78,6 +102,18 @@ public:
     /** Add multiple animations to run in parallel as a group */
     void enqueueParallel(std::vector<Animation> anims);
 
+    /**
+     * @brief Register a container whose elements are animation targets
+     *
+     * The container must outlive the controller (declare it first).
+     *
+     * @param container Vector holding the animated elements
+     */
+    template<typename T>
+    void bindContainer(const std::vector<T>& container) {
+        m_bindings.push_back({&container, &containerData<T>, &containerBytes<T>});
+    }
+
     /** Update all active animations with delta time */
     void update(float deltaTime);
 
@@ -100,18 +136,84 @@ public:
     bool hasAnimations() const;
 
     /** Check if currently processing a parallel group */
-    bool isProcessingParallelGroup() const { return !m_parallelGroup.empty(); }
-    
+    bool isProcessingParallelGroup() const;
+
+    /** Number of tracks playing in the current step */
+    size_t activeTrackCount() const;
+
     /** Advance animation by one fixed step (for step-by-step playback) */
     void stepForward(float stepSize = 0.1f);
 
+    /**
+     * @brief Flag the elements of a bound container the current step animates
+     *
+     * Lets a renderer draw those elements live and keep the rest cached.
+     *
+     * @param container Container previously passed to bindContainer()
+     * @param animated Resized to the container; 1 for each animated element
+     * @return Number of elements flagged
+     */
+    template<typename T>
+    size_t markAnimated(const std::vector<T>& container, std::vector<std::uint8_t>& animated) const {
+        animated.assign(container.size(), 0);
+        return markAnimatedElements(&container, sizeof(T), animated);
+    }
+
 private:
-    std::queue<Animation> m_queue;                // Sequential animation queue
-    std::vector<Animation> m_parallelGroup;       // Current parallel animation group
+    static constexpr std::uint32_t NO_BINDING = 0xFFFFFFFFu;
+    static constexpr std::uint32_t NO_CALLBACK = 0xFFFFFFFFu;
+
+    /// Type-erased view of a bound container
+    struct Binding {
+        const void* container;
+        char* (*data)(const void*);
+        size_t (*bytes)(const void*);
+    };
+
+    template<typename T>
+    static char* containerData(const void* container) {
+        auto* vec = static_cast<const std::vector<T>*>(container);
+        return reinterpret_cast<char*>(const_cast<T*>(vec->data()));
+    }
+
+    template<typename T>
+    static size_t containerBytes(const void* container) {
+        return static_cast<const std::vector<T>*>(container)->size() * sizeof(T);
+    }
+
+    size_t markAnimatedElements(const void* container, size_t stride, std::vector<std::uint8_t>& animated) const;
+    void addTrack(Animation& anim);
+    void beginStep();
+    float* resolve(size_t track) const;
+
+    // Track store (structure of arrays, one entry per tween)
+    std::vector<std::uint32_t> m_trackBinding;   // Bound container or NO_BINDING
+    std::vector<size_t> m_trackOffset;           // Byte offset into the bound container
+    std::vector<float*> m_trackRaw;              // Direct target when unbound
+    std::vector<std::uint8_t> m_trackComponents; // Floats written per track
+    std::vector<Easing> m_trackEasing;           // Easing curve
+    std::vector<glm::vec4> m_trackFrom;          // Start value (captured when the step begins)
+    std::vector<glm::vec4> m_trackTo;            // End value
+    std::vector<float> m_trackDuration;          // Duration in seconds
+    std::vector<std::uint8_t> m_trackDone;       // Completion already reported
+    std::vector<std::uint32_t> m_trackCallback;  // Index into m_callbacks or NO_CALLBACK
+    std::vector<std::function<void()>> m_callbacks;
+
+    // Steps (group barriers): step i owns tracks [m_stepBegin[i], m_stepBegin[i + 1])
+    std::vector<size_t> m_stepBegin;
+    size_t m_currentStep = 0;                    // First step not yet finished
+    float m_stepElapsed = 0.0f;                  // Time spent in the current step
+    bool m_stepStarted = false;                  // Start values captured for current step
+
+    // Per-frame scratch
+    std::vector<Binding> m_bindings;             // Registered target containers
+    std::vector<char*> m_bindingBase;            // Container data pointers this frame
+    std::vector<size_t> m_bindingBytes;          // Container sizes this frame
+    std::vector<std::uint32_t> m_firedCallbacks; // Callbacks to run after evaluation
+
     bool m_paused = false;                        // Paused state
     float m_speed = 1.0f;                         // Speed multiplier
 };
-
 /**
  * @brief Helper functions to create common animations
  */
@@ -0,0 +1,153 @@
+/**
+ * @file bar_renderer.hpp
+ * @brief GPU-instanced bar chart renderer for large arrays
+ *
+ * Uploads one value and one state byte per bar into a GL buffer and draws
+ * every bar with a single instanced draw call, injected into an ImGui draw
+ * list through a draw callback so it composes with the surrounding UI.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <imgui.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace dsav {
+
+/**
+ * @brief Per-bar state, mapped to a palette color in the shader
+ */
+enum class BarState : std::uint8_t {
+    Base,        ///< Unvisited element
+    Comparing,   ///< Being compared
+    Swapping,    ///< Being swapped/moved
+    Sorted,      ///< In final position
+    Highlight,   ///< Pivot, current minimum, etc.
+    Lane0,       ///< Touched by worker lane 0 of a parallel sort (Lane0 + k for lane k)
+    Lane7 = Lane0 + 7,
+    Count
+};
+
+constexpr size_t BAR_STATE_COUNT = static_cast<size_t>(BarState::Count);
+constexpr size_t BAR_LANE_COUNT = static_cast<size_t>(BarState::Lane7) - static_cast<size_t>(BarState::Lane0) + 1;
+
+/**
+ * @brief Bar state for a worker lane (lanes past BAR_LANE_COUNT reuse colors)
+ */
+inline BarState laneBarState(size_t lane) {
+    return static_cast<BarState>(static_cast<size_t>(BarState::Lane0) + lane % BAR_LANE_COUNT);
+}
+
+/**
+ * @brief Screen-space placement of the bars for one draw
+ */
+struct BarLayout {
+    glm::vec2 origin{0.0f, 0.0f};  ///< Bottom-left corner of bar 0 (screen pixels)
+    float pitch = 1.0f;            ///< Horizontal distance between consecutive bars
+    float width = 1.0f;            ///< Bar width (clamped to at least one pixel)
+    float heightScale = 1.0f;      ///< Pixels per unit of value
+};
+
+/**
+ * @brief Draws an array as instanced bars through the OpenGL 3.3 context
+ *
+ * GL objects are created lazily on first use, so the renderer can be
+ * constructed before the context exists; it must be destroyed while the
+ * context is still current. One draw() per frame per renderer.
+ */
+class InstancedBarRenderer {
+public:
+    InstancedBarRenderer();
+    ~InstancedBarRenderer();
+
+    InstancedBarRenderer(const InstancedBarRenderer&) = delete;
+    InstancedBarRenderer& operator=(const InstancedBarRenderer&) = delete;
+
+    /**
+     * @brief Set the color used for a bar state
+     */
+    void setStateColor(BarState state, const glm::vec4& color);
+
+    /**
+     * @brief Upload bar values and states (sizes must match)
+     *
+     * @param values One value per bar
+     * @param states One BarState per bar
+     * @return false if the GL resources could not be created
+     */
+    bool upload(const std::vector<int>& values, const std::vector<BarState>& states);
+
+    /**
+     * @brief Queue an instanced draw of bars [first, first + count) into a draw list
+     *
+     * @param drawList ImGui draw list of the current window
+     * @param layout Screen placement of the bars
+     * @param first First bar to draw
+     * @param count Number of bars to draw
+     */
+    void draw(ImDrawList* drawList, const BarLayout& layout, size_t first, size_t count);
+
+    /**
+     * @brief Check whether the GPU path is usable (shader compiled, buffers created)
+     */
+    bool isAvailable();
+
+    /**
+     * @brief Free the GL objects (recreated by the next upload(), which must follow)
+     *
+     * Must not be called between queuing a frame's draw and rendering it.
+     */
+    void release() { releaseResources(); }
+
+    /**
+     * @brief Number of bars in the last upload
+     */
+    size_t size() const { return m_count; }
+
+private:
+    struct Instance {
+        float value;
+        std::uint32_t state;
+    };
+
+    bool ensureResources();
+    void releaseResources();
+    void render(const ImVec4& clipRect);
+
+    static void drawCallback(const ImDrawList* drawList, const ImDrawCmd* cmd);
+
+    // GL objects
+    unsigned int m_program = 0;
+    unsigned int m_vao = 0;
+    unsigned int m_quadVbo = 0;
+    unsigned int m_instanceVbo = 0;
+    int m_locProjection = -1;
+    int m_locOrigin = -1;
+    int m_locPitch = -1;
+    int m_locWidth = -1;
+    int m_locHeightScale = -1;
+    int m_locFirst = -1;
+    int m_locPalette = -1;
+    bool m_initialized = false;
+    bool m_failed = false;
+
+    // Instance data
+    std::vector<Instance> m_staging;
+    size_t m_count = 0;
+    size_t m_capacity = 0;              ///< Instances allocated in m_instanceVbo
+
+    // Recorded by draw(), consumed by the callback during ImGui rendering
+    BarLayout m_layout;
+    size_t m_drawFirst = 0;
+    size_t m_drawCount = 0;
+    ImVec2 m_displayPos;
+    ImVec2 m_displaySize;
+    ImVec2 m_framebufferScale;
+
+    glm::vec4 m_palette[BAR_STATE_COUNT];
+};
+
+} // namespace dsav
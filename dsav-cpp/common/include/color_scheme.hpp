@@ -105,6 +105,12 @@ namespace semantic {
     constexpr auto topElement     = mocha::blue;        // Top of stack / front of queue
     constexpr auto bottomElement  = mocha::overlay2;    // Bottom element
 
+    // Worker lanes of the parallel sorts (one per thread)
+    constexpr glm::vec4 lanes[] = {
+        mocha::mauve, mocha::sky, mocha::pink, mocha::lavender,
+        mocha::maroon, mocha::sapphire, mocha::flamingo, mocha::rosewater
+    };
+
     // UI accent colors
     constexpr auto buttonPrimary  = mocha::blue;        // Primary button
     constexpr auto buttonHover    = mocha::sky;         // Button hover state
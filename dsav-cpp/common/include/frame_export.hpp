@@ -0,0 +1,167 @@
+/**
+ * @file frame_export.hpp
+ * @brief Exports the visualization canvas as a PNG sequence or animated GIF
+ *
+ * While an export runs, every frame in which the visualization moves is an
+ * export frame: the main loop advances the visualizer by exactly 1 / fps
+ * seconds and renders without vsync, so playback runs as fast as the GPU
+ * and encoder allow instead of in real time. Still frames (waiting for the
+ * next operation) are neither recorded nor sped up.
+ *
+ * After the frame is rendered, captureFrame() queues an asynchronous
+ * glReadPixels of the canvas rect from the back buffer into one of two
+ * pixel-pack buffers and maps the other one, which the GPU filled a frame
+ * earlier, so the render thread never waits on the read. Mapped frames are
+ * handed to a background encoder thread through a lock-free queue. When the
+ * encoder falls FRAMES_IN_FLIGHT frames behind, the render thread waits for
+ * it instead of dropping frames.
+ *
+ * Render thread only; the GL context must be current.
+ */
+
+#pragma once
+
+#include <imgui.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace dsav {
+
+/**
+ * @brief Output of an export
+ */
+enum class ExportFormat {
+    PngSequence,    ///< Directory of frame_000000.png, frame_000001.png, ...
+    Gif             ///< One looping animated GIF
+};
+
+/**
+ * @brief Export settings
+ */
+struct ExportSettings {
+    ExportFormat format = ExportFormat::PngSequence;
+    int fps = 30;               ///< Output frame rate, also the fixed timestep
+    std::string path;           ///< Directory (PNG) or file (GIF); empty picks a timestamped name
+};
+
+/**
+ * @brief Captures canvas frames at a fixed timestep and encodes them in the background
+ */
+class FrameExporter {
+public:
+    /// Frames read back but not yet encoded before the render thread waits
+    static constexpr size_t FRAMES_IN_FLIGHT = 8;
+
+    FrameExporter();
+    ~FrameExporter();
+
+    FrameExporter(const FrameExporter&) = delete;
+    FrameExporter& operator=(const FrameExporter&) = delete;
+
+    /**
+     * @brief Start an export (the frame size is taken from the next setSource())
+     *
+     * @param settings Format, frame rate and destination
+     * @return false if an export is running, fps is not positive or the
+     *         destination cannot be created (see error())
+     */
+    bool start(const ExportSettings& settings);
+
+    /**
+     * @brief Read back the last frame, finish encoding and close the output
+     *
+     * Blocks until the encoder has written every captured frame.
+     */
+    void stop();
+
+    /**
+     * @brief Check whether an export is running
+     */
+    bool isActive() const { return m_session != nullptr; }
+
+    /**
+     * @brief Decide whether this frame is an export frame (call before update)
+     *
+     * Switches vsync off for export frames and back on otherwise.
+     *
+     * @param moving True if the visualization changes this frame
+     * @return true if the frame must advance by timestep() and be captured
+     */
+    bool beginFrame(bool moving);
+
+    /**
+     * @brief Seconds the visualizer advances per export frame
+     */
+    float timestep() const { return 1.0f / static_cast<float>(m_settings.fps); }
+
+    /**
+     * @brief Record the canvas rect to capture this frame
+     *
+     * Call from inside the visualization window, before it draws. The first
+     * call of an export fixes the frame size; later rects keep their
+     * top-left corner and are clamped to the framebuffer.
+     *
+     * @param canvasPos Top-left corner of the canvas (screen space)
+     * @param canvasSize Size of the canvas
+     */
+    void setSource(const ImVec2& canvasPos, const ImVec2& canvasSize);
+
+    /**
+     * @brief Queue the read-back of an export frame (after rendering, before the swap)
+     */
+    void captureFrame();
+
+    /// Frames read back by the current (or last) export
+    std::uint64_t capturedFrames() const { return m_captured; }
+
+    /// Frames the encoder has written by the current (or last) export
+    std::uint64_t writtenFrames() const { return m_written.load(std::memory_order_relaxed); }
+
+    /// Destination of the current (or last) export
+    const std::string& path() const { return m_settings.path; }
+
+    /// Reason the last export failed to start or to write, empty if none
+    const std::string& error() const { return m_error; }
+
+    /**
+     * @brief Timestamped destination in the working directory
+     *
+     * dsav-export-YYYYMMDD-HHMMSS/ for PNG sequences, .gif for GIFs.
+     */
+    static std::string defaultPath(ExportFormat format);
+
+private:
+    struct Session;
+
+    bool ensureBuffers(size_t bytes);
+    void releaseBuffers();
+    void readBack(int buffer);
+    void encoderLoop(Session& session);
+
+    ExportSettings m_settings;
+    std::unique_ptr<Session> m_session;
+
+    // Pixel-pack buffers, alternated every captured frame
+    unsigned int m_pbo[2] = {0, 0};
+    bool m_pending[2] = {false, false};  ///< Holds a read not yet mapped
+    size_t m_pboBytes = 0;
+    int m_nextBuffer = 0;
+    bool m_exportFrame = false;          ///< Set by beginFrame()
+    bool m_vsyncOff = false;
+
+    // Canvas rect of this frame, in framebuffer pixels (GL origin bottom-left)
+    bool m_hasSource = false;
+    int m_sourceX = 0;
+    int m_sourceY = 0;
+    int m_width = 0;                     ///< Frame size, fixed for the whole export
+    int m_height = 0;
+
+    std::uint64_t m_captured = 0;
+    std::atomic<std::uint64_t> m_written{0};
+    std::string m_error;
+};
+
+} // namespace dsav
@@ -82,6 +82,7 @@ typedef void* (*GLADloadproc)(const char *name);
 #define GL_CULL_FACE 0x0B44
 #define GL_DEPTH_TEST 0x0B71
 #define GL_SCISSOR_TEST 0x0C11
+#define GL_VIEWPORT 0x0BA2
 #define GL_TEXTURE_2D 0x0DE1
 #define GL_UNSIGNED_BYTE 0x1401
 #define GL_UNSIGNED_INT 0x1405
@@ -100,6 +101,12 @@ typedef void* (*GLADloadproc)(const char *name);
 #define GL_ELEMENT_ARRAY_BUFFER 0x8893
 #define GL_STATIC_DRAW 0x88E4
 #define GL_DYNAMIC_DRAW 0x88E8
+#define GL_STREAM_DRAW 0x88E0
+#define GL_STREAM_READ 0x88E1
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_MAP_READ_BIT 0x0001
+#define GL_PACK_ALIGNMENT 0x0D05
+#define GL_BACK 0x0405
 #define GL_FRAGMENT_SHADER 0x8B30
 #define GL_VERTEX_SHADER 0x8B31
 #define GL_COMPILE_STATUS 0x8B81
@@ -107,6 +114,7 @@ typedef void* (*GLADloadproc)(const char *name);
 #define GL_INFO_LOG_LENGTH 0x8B84
 #define GL_FRAMEBUFFER 0x8D40
 #define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define GL_FRAMEBUFFER_BINDING 0x8CA6
 #define GL_COLOR_ATTACHMENT0 0x8CE0
 #define GL_DEPTH_ATTACHMENT 0x8D00
 #define GL_RENDERBUFFER 0x8D41
@@ -194,6 +202,8 @@ typedef void (KHRONOS_APIENTRY *PFNGLDELETEBUFFERSPROC)(GLsizei n, const GLuint
 typedef void (KHRONOS_APIENTRY *PFNGLBINDBUFFERPROC)(GLenum target, GLuint buffer);
 typedef void (KHRONOS_APIENTRY *PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 typedef void (KHRONOS_APIENTRY *PFNGLBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+typedef void *(KHRONOS_APIENTRY *PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLboolean (KHRONOS_APIENTRY *PFNGLUNMAPBUFFERPROC)(GLenum target);
 
 /* OpenGL 2.0 - Shaders */
 typedef void (KHRONOS_APIENTRY *PFNGLATTACHSHADERPROC)(GLuint program, GLuint shader);
@@ -216,6 +226,7 @@ typedef void (KHRONOS_APIENTRY *PFNGLUNIFORM2FPROC)(GLint location, GLfloat v0,
 typedef void (KHRONOS_APIENTRY *PFNGLUNIFORM3FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
 typedef void (KHRONOS_APIENTRY *PFNGLUNIFORM4FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
 typedef void (KHRONOS_APIENTRY *PFNGLUNIFORM1IPROC)(GLint location, GLint v0);
+typedef void (KHRONOS_APIENTRY *PFNGLUNIFORM4FVPROC)(GLint location, GLsizei count, const GLfloat *value);
 typedef void (KHRONOS_APIENTRY *PFNGLUNIFORMMATRIX4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 typedef void (KHRONOS_APIENTRY *PFNGLVERTEXATTRIBPOINTERPROC)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
 typedef GLint (KHRONOS_APIENTRY *PFNGLGETUNIFORMLOCATIONPROC)(GLuint program, const GLchar *name);
@@ -225,6 +236,11 @@ typedef GLint (KHRONOS_APIENTRY *PFNGLGETATTRIBLOCATIONPROC)(GLuint program, con
 typedef void (KHRONOS_APIENTRY *PFNGLGENVERTEXARRAYSPROC)(GLsizei n, GLuint *arrays);
 typedef void (KHRONOS_APIENTRY *PFNGLDELETEVERTEXARRAYSPROC)(GLsizei n, const GLuint *arrays);
 typedef void (KHRONOS_APIENTRY *PFNGLBINDVERTEXARRAYPROC)(GLuint array);
+typedef void (KHRONOS_APIENTRY *PFNGLVERTEXATTRIBIPOINTERPROC)(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+
+/* OpenGL 3.1 / 3.3 - Instancing */
+typedef void (KHRONOS_APIENTRY *PFNGLDRAWARRAYSINSTANCEDPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+typedef void (KHRONOS_APIENTRY *PFNGLVERTEXATTRIBDIVISORPROC)(GLuint index, GLuint divisor);
 
 /* OpenGL 3.0 - Framebuffer Objects */
 typedef void (KHRONOS_APIENTRY *PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint *framebuffers);
@@ -372,6 +388,10 @@ extern PFNGLBUFFERDATAPROC gladglBufferData;
 #define glBufferData gladglBufferData
 extern PFNGLBUFFERSUBDATAPROC gladglBufferSubData;
 #define glBufferSubData gladglBufferSubData
+extern PFNGLMAPBUFFERRANGEPROC gladglMapBufferRange;
+#define glMapBufferRange gladglMapBufferRange
+extern PFNGLUNMAPBUFFERPROC gladglUnmapBuffer;
+#define glUnmapBuffer gladglUnmapBuffer
 extern PFNGLATTACHSHADERPROC gladglAttachShader;
 #define glAttachShader gladglAttachShader
 extern PFNGLCOMPILESHADERPROC gladglCompileShader;
@@ -412,6 +432,8 @@ extern PFNGLUNIFORM4FPROC gladglUniform4f;
 #define glUniform4f gladglUniform4f
 extern PFNGLUNIFORM1IPROC gladglUniform1i;
 #define glUniform1i gladglUniform1i
+extern PFNGLUNIFORM4FVPROC gladglUniform4fv;
+#define glUniform4fv gladglUniform4fv
 extern PFNGLUNIFORMMATRIX4FVPROC gladglUniformMatrix4fv;
 #define glUniformMatrix4fv gladglUniformMatrix4fv
 extern PFNGLVERTEXATTRIBPOINTERPROC gladglVertexAttribPointer;
@@ -426,6 +448,12 @@ extern PFNGLDELETEVERTEXARRAYSPROC gladglDeleteVertexArrays;
 #define glDeleteVertexArrays gladglDeleteVertexArrays
 extern PFNGLBINDVERTEXARRAYPROC gladglBindVertexArray;
 #define glBindVertexArray gladglBindVertexArray
+extern PFNGLVERTEXATTRIBIPOINTERPROC gladglVertexAttribIPointer;
+#define glVertexAttribIPointer gladglVertexAttribIPointer
+extern PFNGLDRAWARRAYSINSTANCEDPROC gladglDrawArraysInstanced;
+#define glDrawArraysInstanced gladglDrawArraysInstanced
+extern PFNGLVERTEXATTRIBDIVISORPROC gladglVertexAttribDivisor;
+#define glVertexAttribDivisor gladglVertexAttribDivisor
 extern PFNGLGENFRAMEBUFFERSPROC gladglGenFramebuffers;
 #define glGenFramebuffers gladglGenFramebuffers
 extern PFNGLDELETEFRAMEBUFFERSPROC gladglDeleteFramebuffers;
@@ -0,0 +1,108 @@
+/**
+ * @file image_writer.hpp
+ * @brief Dependency-free PNG and animated GIF encoders
+ *
+ * Just enough of both formats for exporting frames of the visualization
+ * canvas. PNG frames are compressed with fixed-Huffman deflate and per-row
+ * Sub/Up filtering, which suits the flat colors of the canvas well. GIF
+ * frames get a 256-color palette of their own, picked from a 15-bit color
+ * histogram of the frame.
+ *
+ * Pixels are 8-bit RGBA, top row first. Alpha is ignored (the canvas is
+ * opaque). Nothing here touches GL or ImGui, so any thread may encode.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace dsav::image {
+
+/**
+ * @brief Encode an RGBA image as an RGB PNG file
+ *
+ * @param path File to create (overwritten)
+ * @param rgba width * height * 4 bytes, top row first
+ * @param width Image width in pixels
+ * @param height Image height in pixels
+ * @return false if the file cannot be written
+ */
+bool writePng(const std::string& path, const std::uint8_t* rgba, int width, int height);
+
+/**
+ * @brief Encode an RGBA image as PNG file contents in memory
+ */
+std::vector<std::uint8_t> encodePng(const std::uint8_t* rgba, int width, int height);
+
+/**
+ * @brief Streams frames into a looping animated GIF
+ *
+ * open(), then addFrame() per frame, then close(). Each frame is written
+ * as soon as it is added, so memory does not grow with the animation.
+ */
+class GifWriter {
+public:
+    GifWriter() = default;
+    ~GifWriter();
+
+    GifWriter(const GifWriter&) = delete;
+    GifWriter& operator=(const GifWriter&) = delete;
+
+    /**
+     * @brief Create the file and write the header
+     *
+     * @param path File to create (overwritten)
+     * @param width Frame width in pixels (at most 65535)
+     * @param height Frame height in pixels (at most 65535)
+     * @return false if a file is already open, the size is invalid or the file cannot be created
+     */
+    bool open(const std::string& path, int width, int height);
+
+    /**
+     * @brief Append one frame
+     *
+     * @param rgba width * height * 4 bytes, top row first
+     * @param delayCentiseconds How long the frame shows (GIF timing unit)
+     * @return false if no file is open or the write failed
+     */
+    bool addFrame(const std::uint8_t* rgba, int delayCentiseconds);
+
+    /**
+     * @brief Write the trailer and close the file
+     *
+     * @return false if writing failed at any point since open()
+     */
+    bool close();
+
+    bool isOpen() const { return m_file != nullptr; }
+
+private:
+    /**
+     * @brief Pick a palette for the frame and map every pixel to it
+     */
+    void quantize(const std::uint8_t* rgba);
+
+    /**
+     * @brief LZW-compress m_indices into GIF data sub-blocks
+     */
+    void writeImageData();
+
+    std::FILE* m_file = nullptr;
+    int m_width = 0;
+    int m_height = 0;
+    bool m_failed = false;
+
+    // Per-frame scratch, kept to avoid reallocating
+    std::vector<std::uint32_t> m_histogram;     ///< Pixel count per 5-5-5 color bin
+    std::vector<std::uint64_t> m_binSums;       ///< Summed r, g, b per bin (for the bin's mean color)
+    std::vector<std::uint8_t> m_binIndex;       ///< Palette entry per bin
+    std::vector<std::uint32_t> m_occupied;      ///< Bins with at least one pixel
+    std::uint8_t m_palette[256 * 3] = {};
+    std::vector<std::uint8_t> m_indices;        ///< Palette index per pixel
+    std::vector<std::uint8_t> m_encoded;        ///< LZW output before sub-blocking
+};
+
+} // namespace dsav::image
@@ -0,0 +1,110 @@
+/**
+ * @file job_system.hpp
+ * @brief Worker threads for algorithm work that must stay off the render loop
+ *
+ * A job runs on a worker thread and returns a completion, which is handed
+ * back to the render thread through that worker's lock-free SPSC queue and
+ * executed by runCompletions() at the top of the next frame. Jobs must not
+ * touch visualizer state or ImGui; they work on copies, and only their
+ * completion applies the result, so the render thread never waits on a job.
+ *
+ * Submitting and draining are main-thread only. A completion listener can
+ * wake the render thread when a result is ready, so it need not poll while
+ * jobs run.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace dsav {
+
+namespace jobs { class Scheduler; }
+
+/**
+ * @brief Shared state of one submitted job
+ */
+class JobToken {
+public:
+    /**
+     * @brief Ask the job to stop and drop its completion (main thread)
+     */
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Check whether the job was cancelled
+     */
+    bool isCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Flag long-running jobs can poll (e.g. SortTrace::generate)
+     */
+    const std::atomic<bool>& cancelledFlag() const { return m_cancelled; }
+
+    /**
+     * @brief Check whether the completion has run, or the job was dropped (main thread)
+     */
+    bool isDone() const { return m_done; }
+
+private:
+    friend class jobs::Scheduler;
+
+    std::atomic<bool> m_cancelled{false};
+    bool m_done = false;
+};
+
+/// Handle the submitter keeps to poll or cancel a job
+using JobHandle = std::shared_ptr<JobToken>;
+
+/// Runs on the render thread once the job has finished
+using JobCompletion = std::function<void()>;
+
+/// Runs on a worker; returns the completion to run on the render thread (may be empty)
+using JobWork = std::function<JobCompletion(const JobToken&)>;
+
+namespace jobs {
+
+/**
+ * @brief Queue work for the next free worker (starts the workers on first use)
+ *
+ * @param work Job body; must only touch data it owns or captured by value
+ * @return Handle for polling and cancellation
+ */
+JobHandle submit(JobWork work);
+
+/**
+ * @brief Run the completions of finished jobs (call once per frame)
+ *
+ * Completions of cancelled jobs are dropped.
+ *
+ * @param maxCompletions Upper bound on completions run in this call
+ */
+void runCompletions(size_t maxCompletions = static_cast<size_t>(-1));
+
+/**
+ * @brief Call a function on the worker each time a job posts its completion
+ *
+ * The main loops pass RenderScheduler::wake, so an idle wait ends as soon
+ * as there is a completion to run. Set it before the first submit and clear
+ * it (nullptr) before the window system shuts down.
+ *
+ * @param listener Thread-safe function, or nullptr for none
+ */
+void setCompletionListener(void (*listener)());
+
+/**
+ * @brief Number of worker threads (0 before the first submit)
+ */
+size_t workerCount();
+
+/**
+ * @brief Jobs submitted whose completion has not run yet
+ */
+size_t pendingCount();
+
+} // namespace jobs
+
+} // namespace dsav
@@ -0,0 +1,81 @@
+/**
+ * @file label_cache.hpp
+ * @brief Interned text labels with cached text extents
+ *
+ * Visual elements keep a small LabelId instead of a std::string. Each
+ * distinct label is formatted once, stored for the lifetime of the program
+ * and measured once per font/font size, so steady-state frames neither
+ * allocate nor call ImGui::CalcTextSize for unchanged elements.
+ *
+ * Integers in [SMALL_INT_MIN, SMALL_INT_MAX] and "[index]" labels are
+ * looked up through flat tables; other text goes through a hash map.
+ * Like the rest of the ImGui-facing code, this is main-thread only.
+ */
+
+#pragma once
+
+#include <imgui.h>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace dsav {
+
+/// Handle to an interned label
+using LabelId = std::uint32_t;
+
+/// The empty label (renderers skip it)
+constexpr LabelId NO_LABEL = 0;
+
+namespace labels {
+
+/// Range of integers served from the flat lookup table
+constexpr int SMALL_INT_MIN = -1024;
+constexpr int SMALL_INT_MAX = 4095;
+
+/**
+ * @brief Intern arbitrary text
+ *
+ * @param text Label text (empty text returns NO_LABEL)
+ * @return Stable id for the text
+ */
+LabelId intern(std::string_view text);
+
+/**
+ * @brief Intern the decimal form of an integer
+ */
+LabelId fromInt(int value);
+
+/**
+ * @brief Intern an index label of the form "[index]"
+ */
+LabelId fromIndex(size_t index);
+
+/**
+ * @brief Null-terminated text of a label (valid for the program lifetime)
+ */
+const char* text(LabelId id);
+
+/**
+ * @brief Size of a label in the current ImGui font, measured once per font size
+ */
+ImVec2 textSize(LabelId id);
+
+/**
+ * @brief Draw a label with its top-left corner at pos
+ */
+void draw(ImDrawList* drawList, const ImVec2& pos, ImU32 color, LabelId id);
+
+/**
+ * @brief Draw a label centered on a point
+ */
+void drawCentered(ImDrawList* drawList, const ImVec2& center, ImU32 color, LabelId id);
+
+/**
+ * @brief Number of distinct labels interned so far
+ */
+size_t count();
+
+} // namespace labels
+
+} // namespace dsav
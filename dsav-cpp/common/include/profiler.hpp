@@ -0,0 +1,158 @@
+/**
+ * @file profiler.hpp
+ * @brief Scoped frame timers with per-thread record buffers
+ *
+ * DSAV_PROFILE_SCOPE("name") times the rest of the enclosing block. Each
+ * thread writes finished scopes into its own lock-free SPSC ring, so timing a
+ * worker never contends with the render thread; endFrame() drains every
+ * ring on the render thread and folds the records into FrameStats, which
+ * keeps the last FRAME_HISTORY frames for the overlay.
+ *
+ * With DSAV_PROFILER=0 (CMake -DENABLE_PROFILER=OFF) the macro expands to
+ * nothing, endFrame() is an empty inline function and operator new is not
+ * replaced, so instrumented code costs nothing.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#ifndef DSAV_PROFILER
+#define DSAV_PROFILER 0
+#endif
+
+namespace dsav::profiler {
+
+/// Frames kept for the rolling graph and the per-scope statistics
+constexpr size_t FRAME_HISTORY = 240;
+
+/// Finished scopes buffered per thread between two endFrame() calls
+constexpr size_t THREAD_BUFFER_RECORDS = 4096;
+
+/**
+ * @brief One finished scope (plain data, written into a thread's ring)
+ */
+struct ScopeRecord {
+    const char* name = "";      ///< String literal passed to DSAV_PROFILE_SCOPE
+    std::uint64_t startNs = 0;
+    std::uint64_t endNs = 0;
+    std::uint32_t depth = 0;    ///< Scopes already open on the thread
+};
+
+/**
+ * @brief ImGui geometry submitted in one frame
+ */
+struct DrawStats {
+    size_t drawLists = 0;
+    size_t commands = 0;
+    size_t vertices = 0;
+    size_t indices = 0;
+};
+
+/**
+ * @brief Rolling statistics of one named scope
+ */
+struct ScopeStats {
+    std::string_view name;
+    std::uint32_t depth = 0;                    ///< Nesting depth when first seen
+    std::uint32_t thread = 0;                   ///< Thread that first recorded it (0 = first registered)
+    std::uint64_t firstStartNs = 0;             ///< Start of the first recorded call
+    std::array<float, FRAME_HISTORY> frameMs{}; ///< Time inside the scope per frame (ring, see FrameStats::next)
+    std::uint32_t callsLastFrame = 0;
+    float averageMs = 0.0f;                     ///< Mean of frameMs over the recorded frames
+    float p99Ms = 0.0f;                         ///< 99th percentile of frameMs
+};
+
+/**
+ * @brief Everything the overlay draws, updated by endFrame()
+ */
+struct FrameStats {
+    std::array<float, FRAME_HISTORY> frameMs{};             ///< Time between endFrame() calls (ring)
+    std::array<std::uint32_t, FRAME_HISTORY> allocations{}; ///< operator new calls per frame (ring)
+    size_t frameCount = 0;          ///< Valid entries in the rings (at most FRAME_HISTORY)
+    size_t next = 0;                ///< Ring slot the next frame goes to (oldest entry once full)
+    float averageMs = 0.0f;
+    float p99Ms = 0.0f;
+    float averageAllocations = 0.0f;
+    DrawStats draw;                 ///< Geometry of the last frame
+    std::uint64_t droppedRecords = 0; ///< Scopes lost because a thread's ring was full
+    std::vector<ScopeStats> scopes; ///< By thread, then by first start (parents before children)
+};
+
+#if DSAV_PROFILER
+
+/// Nesting depth of the calling thread's open scopes
+inline thread_local std::uint32_t t_depth = 0;
+
+/**
+ * @brief Monotonic time in nanoseconds
+ */
+std::uint64_t nowNs();
+
+/**
+ * @brief Append a finished scope to the calling thread's ring
+ *
+ * Registers the thread on its first call. If the ring is full the record
+ * is counted as dropped instead of blocking.
+ */
+void record(const ScopeRecord& scope);
+
+/**
+ * @brief Close the frame: drain every thread's ring and update FrameStats (render thread)
+ */
+void endFrame();
+
+/**
+ * @brief Store the geometry counts of the frame that was just rendered
+ */
+void setDrawStats(const DrawStats& stats);
+
+/**
+ * @brief Statistics up to the last endFrame() (render thread)
+ */
+const FrameStats& frameStats();
+
+/**
+ * @brief Times its own lifetime and records it on destruction
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name)
+        : m_name(name), m_depth(t_depth++), m_start(nowNs()) {}
+
+    ~ScopedTimer() {
+        std::uint64_t end = nowNs();
+        --t_depth;
+        record(ScopeRecord{m_name, m_start, end, m_depth});
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    const char* m_name;
+    std::uint32_t m_depth;
+    std::uint64_t m_start;
+};
+
+#define DSAV_PROFILE_CONCAT_INNER(a, b) a##b
+#define DSAV_PROFILE_CONCAT(a, b) DSAV_PROFILE_CONCAT_INNER(a, b)
+
+/// Time the rest of the enclosing block under a string-literal name
+#define DSAV_PROFILE_SCOPE(name) \
+    ::dsav::profiler::ScopedTimer DSAV_PROFILE_CONCAT(dsavProfileScope, __LINE__)(name)
+
+#else
+
+inline void endFrame() {}
+inline void setDrawStats(const DrawStats&) {}
+
+#define DSAV_PROFILE_SCOPE(name) ((void)0)
+
+#endif
+
+} // namespace dsav::profiler
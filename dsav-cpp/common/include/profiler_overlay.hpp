@@ -0,0 +1,30 @@
+/**
+ * @file profiler_overlay.hpp
+ * @brief ImGui window for the frame profiler
+ *
+ * Shows a rolling frame-time graph, per-scope averages and p99, the
+ * geometry ImGui submitted and operator new calls per frame.
+ */
+
+#pragma once
+
+#include "profiler.hpp"
+#include <imgui.h>
+
+namespace dsav::profiler {
+
+/**
+ * @brief Record the geometry of the draw data ImGui::Render() just built
+ *
+ * @param drawData Result of ImGui::GetDrawData()
+ */
+void captureDrawData(const ImDrawData* drawData);
+
+/**
+ * @brief Draw the profiler window
+ *
+ * @param open Window visibility flag (cleared by the close button)
+ */
+void renderOverlay(bool* open);
+
+} // namespace dsav::profiler
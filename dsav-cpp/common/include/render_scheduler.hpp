@@ -0,0 +1,108 @@
+/**
+ * @file render_scheduler.hpp
+ * @brief Decides when the main loop renders: every refresh, capped, or on events only
+ *
+ * While something moves (an animation is queued, playback is running, a job
+ * is in flight) the loop polls events and renders every frame, optionally
+ * paced to a frame cap. Once everything is still it blocks in
+ * glfwWaitEventsTimeout() instead, so an idle window costs no CPU or GPU
+ * time. After each wake it renders a few more frames so ImGui can settle
+ * hover and layout changes, and it wakes every idleTimeout seconds on its own
+ * for blinking carets and status text.
+ *
+ * Main thread only, except wake().
+ */
+
+#pragma once
+
+namespace dsav {
+
+/**
+ * @brief Render scheduler settings (also set from the command line)
+ */
+struct RenderSchedulerConfig {
+    int maxFps = 0;              ///< Frame cap while active (0 = display refresh via vsync)
+    double idleTimeout = 0.5;    ///< Longest idle wait before a housekeeping frame (seconds)
+    int settleFrames = 3;        ///< Frames rendered after an event before waiting again
+    bool idleThrottling = true;  ///< False renders every frame, as before
+};
+
+/**
+ * @brief Paces the main loop and puts it to sleep while nothing changes
+ */
+class RenderScheduler {
+public:
+    /// Longest delta time handed to update(); the first frame after an idle wait would otherwise jump
+    static constexpr float MAX_FRAME_DELTA = 0.1f;
+
+    /**
+     * @brief Construct with settings
+     */
+    explicit RenderScheduler(const RenderSchedulerConfig& config = {});
+
+    /**
+     * @brief Wait for the next frame and process pending events
+     *
+     * Polls (after pacing to maxFps) when active or still settling, and
+     * otherwise blocks until an event arrives or idleTimeout passes.
+     *
+     * @param active True while something on screen changes without input
+     * @return Seconds since the previous frame, at most MAX_FRAME_DELTA
+     */
+    float beginFrame(bool active);
+
+    /**
+     * @brief Keep rendering for at least the next count frames
+     */
+    void requestFrames(int count);
+
+    /**
+     * @brief Interrupt an idle wait (safe from any thread)
+     *
+     * Installed as the job system's completion listener, so a finished job
+     * is applied right away instead of at the next housekeeping frame.
+     */
+    static void wake();
+
+    /**
+     * @brief True if the last beginFrame() blocked waiting for events
+     */
+    bool isIdle() const { return m_idle; }
+
+    void setMaxFps(int maxFps);
+    void setIdleThrottling(bool enabled);
+
+    /**
+     * @brief Ignore the frame cap until called with false (frame export runs flat out)
+     */
+    void setUnpaced(bool unpaced) { m_unpaced = unpaced; }
+
+    const RenderSchedulerConfig& config() const { return m_config; }
+
+private:
+    /**
+     * @brief Sleep until the next frame slot of the frame cap
+     */
+    void paceFrame();
+
+    RenderSchedulerConfig m_config;
+    double m_lastFrame = 0.0;      ///< Start of the previous frame (glfwGetTime)
+    double m_nextSlot = 0.0;       ///< Earliest start of the next capped frame
+    int m_settleRemaining = 0;     ///< Frames still rendered before waiting
+    bool m_idle = false;
+    bool m_unpaced = false;        ///< Frame cap suspended
+};
+
+/**
+ * @brief Read --max-fps N, --idle-timeout S and --no-idle-throttle
+ *
+ * Other arguments are left for the caller.
+ *
+ * @param argc Argument count from main()
+ * @param argv Arguments from main()
+ * @param config Settings to update
+ * @return false if a value is missing or invalid (a message is printed)
+ */
+bool parseRenderSchedulerArgs(int argc, char** argv, RenderSchedulerConfig& config);
+
+} // namespace dsav
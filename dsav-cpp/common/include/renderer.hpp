@@ -10,7 +10,10 @@
 
 #include <glm/glm.hpp>
 #include <string>
+#include <cstddef>
+#include <cstdint>
 #include <imgui.h>  // Need full definition for default arguments
+#include "label_cache.hpp"
 
 namespace dsav {
 
@@ -28,21 +31,130 @@ struct VisualElement {
     float scale = 1.0f;                       // Scale multiplier (for animations)
     float rotation = 0.0f;                    // Rotation in radians (future use)
 
-    std::string label;                        // Main value to display
-    std::string sublabel;                     // Index or additional info
+    LabelId label = NO_LABEL;                 // Main value to display (see label_cache.hpp)
+    LabelId sublabel = NO_LABEL;              // Index or additional info
 
     bool isHighlighted = false;               // Highlight state
     bool isAnimating = false;                 // Currently animating
 };
 
+/**
+ * @brief How much decoration renderers emit per element
+ */
+enum class DetailLevel {
+    Full,       ///< Labels, rounded corners, arrowheads
+    Reduced     ///< Plain shapes and lines only (zoomed out)
+};
+
+/// Zoom level below which canvases switch to DetailLevel::Reduced
+constexpr float LOD_ZOOM_THRESHOLD = 0.6f;
+
+/// Extra screen-space margin around the canvas kept when culling (labels, glow)
+constexpr float CULL_MARGIN = 32.0f;
+
+/// Segment count for circles at DetailLevel::Reduced (0 lets ImGui pick for Full)
+constexpr int LOD_CIRCLE_SEGMENTS = 8;
+
+/**
+ * @brief Half-open index range [first, last)
+ */
+struct IndexRange {
+    size_t first = 0;
+    size_t last = 0;
+
+    bool empty() const { return first >= last; }
+};
+
+/**
+ * @brief Visible screen rect of a canvas for one frame
+ *
+ * Built at the start of renderVisualization() from the canvas rect and the
+ * visualizer's zoom. Renderers ask it whether an element's screen bounds can
+ * be skipped and which detail level to draw at, so panned-away or tiny
+ * elements cost no draw commands.
+ */
+class CanvasViewport {
+public:
+    /**
+     * @brief Construct from the canvas rect (screen space) and current zoom
+     *
+     * @param canvasPos Top-left corner of the canvas
+     * @param canvasSize Size of the canvas
+     * @param zoom Current zoom level (selects the detail level)
+     * @param margin Extra space kept around the canvas
+     */
+    CanvasViewport(const ImVec2& canvasPos, const ImVec2& canvasSize, float zoom,
+                   float margin = CULL_MARGIN);
+
+    /**
+     * @brief Check whether a screen-space rect overlaps the viewport
+     */
+    bool isRectVisible(const ImVec2& min, const ImVec2& max) const;
+
+    /**
+     * @brief Check whether a circle overlaps the viewport
+     */
+    bool isCircleVisible(const ImVec2& center, float radius) const;
+
+    /**
+     * @brief Check whether a line segment's bounding box overlaps the viewport
+     */
+    bool isSegmentVisible(const ImVec2& a, const ImVec2& b) const;
+
+    /**
+     * @brief Indices of evenly spaced columns that overlap the viewport
+     *
+     * Column i spans [startX + i * pitch, startX + i * pitch + width].
+     *
+     * @param startX Left edge of column 0
+     * @param pitch Distance between consecutive columns (may be negative)
+     * @param width Column width
+     * @param count Number of columns
+     */
+    IndexRange visibleColumns(float startX, float pitch, float width, size_t count) const;
+
+    /**
+     * @brief Indices of evenly spaced rows that overlap the viewport
+     *
+     * Row i spans [startY + i * pitch, startY + i * pitch + height]; use a
+     * negative pitch for layouts that grow upwards.
+     */
+    IndexRange visibleRows(float startY, float pitch, float height, size_t count) const;
+
+    /**
+     * @brief Detail level for the current zoom
+     */
+    DetailLevel detail() const { return m_detail; }
+
+    /**
+     * @brief True when labels, rounded corners and arrowheads should be drawn
+     */
+    bool isFullDetail() const { return m_detail == DetailLevel::Full; }
+
+    /**
+     * @brief num_segments argument for ImDrawList circle calls at this detail level
+     */
+    int circleSegments() const { return isFullDetail() ? 0 : LOD_CIRCLE_SEGMENTS; }
+
+    const ImVec2& min() const { return m_min; }
+    const ImVec2& max() const { return m_max; }
+
+private:
+    ImVec2 m_min;
+    ImVec2 m_max;
+    DetailLevel m_detail;
+};
+
 /**
  * @brief Render a single visual element using ImGui's DrawList
  *
  * @param drawList ImGui draw list to render into
  * @param elem Element to render
  * @param offset Offset to apply to position (for scrolling/panning)
+ * @param detail Reduced drops labels, corner rounding and the highlight glow
  */
-void renderElement(ImDrawList* drawList, const VisualElement& elem, const ImVec2& offset = ImVec2(0, 0));
+void renderElement(ImDrawList* drawList, const VisualElement& elem, const ImVec2& offset = ImVec2(0, 0),
+                   DetailLevel detail = DetailLevel::Full);
 
 /**
  * @brief Render a line/edge connecting two points
@@ -65,8 +177,172 @@ void renderLine(ImDrawList* drawList, const glm::vec2& start, const glm::vec2& e
  * @param color Arrow color
  * @param thickness Arrow line thickness
  * @param arrowSize Size of arrow head
+ * @param detail Reduced draws the line without its head
  */
 void renderArrow(ImDrawList* drawList, const glm::vec2& start, const glm::vec2& end,
-                 const glm::vec4& color, float thickness = 2.0f, float arrowSize = 10.0f);
+                 const glm::vec4& color, float thickness = 2.0f, float arrowSize = 10.0f,
+                 DetailLevel detail = DetailLevel::Full);
+
+/**
+ * @brief Everything the static layer of a canvas depends on besides its rect
+ */
+struct CanvasCacheKey {
+    std::uint64_t sceneVersion = 0;  ///< Bumped by the visualizer whenever static content changes
+    float zoom = 1.0f;               ///< Camera zoom
+    float offsetX = 0.0f;            ///< Camera translation in screen pixels
+    float offsetY = 0.0f;
+
+    bool operator==(const CanvasCacheKey& other) const {
+        return sceneVersion == other.sceneVersion && zoom == other.zoom &&
+               offsetX == other.offsetX && offsetY == other.offsetY;
+    }
+    bool operator!=(const CanvasCacheKey& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Keeps the static layer of a canvas in an offscreen texture
+ *
+ * A visualizer draws its background, edges and resting elements between
+ * beginStatic() and endStatic(), then the elements that are animating on
+ * top. While the key, the canvas rect and the window clip rect stay the
+ * same, beginStatic() returns false and endStatic() blits last frame's
+ * texture instead, so an idle or mostly-still scene costs one quad plus
+ * whatever moves.
+ *
+ * On a rebuild the static commands still go into the window's draw list,
+ * fenced by draw callbacks that redirect them into a framebuffer object the
+ * size of the viewport's framebuffer. The ImGui backend's projection and
+ * scissor rects therefore apply unchanged. The static layer must start with
+ * an opaque fill of the canvas, since the texture replaces it wholesale.
+ *
+ * Falls back to drawing everything live (beginStatic() always returning
+ * true) when framebuffer objects are unavailable or the window sits in a
+ * secondary platform viewport, whose GL context does not share them. GL
+ * objects are created lazily; destroy the cache while the context is current.
+ */
+class CanvasCache {
+public:
+    CanvasCache() = default;
+    ~CanvasCache();
+
+    CanvasCache(const CanvasCache&) = delete;
+    CanvasCache& operator=(const CanvasCache&) = delete;
+
+    /**
+     * @brief Start the static layer of this frame
+     *
+     * @param drawList ImGui draw list of the current window
+     * @param canvasPos Top-left corner of the canvas (screen space)
+     * @param canvasSize Size of the canvas
+     * @param key Scene version and camera the static layer is drawn for
+     * @return true if the caller must draw the static layer now, false if the cached texture is reused
+     */
+    bool beginStatic(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize,
+                     const CanvasCacheKey& key);
+
+    /**
+     * @brief Finish the static layer and place the cached texture (call once after beginStatic)
+     */
+    void endStatic(ImDrawList* drawList);
+
+    /**
+     * @brief Force a rebuild on the next beginStatic()
+     */
+    void invalidate() { m_valid = false; }
+
+    /**
+     * @brief Free the framebuffer and texture (recreated by the next beginStatic())
+     *
+     * Must not be called between queuing a frame's draw commands and rendering them.
+     */
+    void release() { releaseResources(); }
+
+    /**
+     * @brief Check whether the offscreen path is usable (framebuffer complete)
+     */
+    bool isAvailable() const { return m_initialized && !m_failed; }
+
+    /**
+     * @brief Number of times the static layer was redrawn into the texture
+     */
+    size_t rebuildCount() const { return m_rebuilds; }
+
+private:
+    enum class Pass {
+        Live,     ///< No cache this frame: the static layer draws straight to the window
+        Rebuild,  ///< Static layer is being redirected into the texture
+        Cached    ///< Texture is current and only needs to be placed
+    };
+
+    bool ensureResources(int width, int height);
+    void releaseResources();
+
+    static void beginCallback(const ImDrawList* drawList, const ImDrawCmd* cmd);
+    static void endCallback(const ImDrawList* drawList, const ImDrawCmd* cmd);
+
+    // GL objects
+    unsigned int m_framebuffer = 0;
+    unsigned int m_texture = 0;
+    int m_width = 0;                    ///< Texture size in framebuffer pixels
+    int m_height = 0;
+    int m_previousFramebuffer = 0;      ///< Restored by endCallback()
+    bool m_initialized = false;
+    bool m_failed = false;
+
+    // What the texture currently holds
+    bool m_valid = false;
+    CanvasCacheKey m_key;
+    ImVec2 m_canvasPos;
+    ImVec2 m_canvasSize;
+    ImVec2 m_clipMin;
+    ImVec2 m_clipMax;
+    ImVec2 m_displayPos;
+    ImVec2 m_uvMin;                     ///< Canvas corners in texture coordinates
+    ImVec2 m_uvMax;
+
+    Pass m_pass = Pass::Live;
+    size_t m_rebuilds = 0;
+};
+
+/**
+ * @brief A small CPU-filled RGBA image shown as one textured quad
+ *
+ * For overviews that summarize far more elements than the canvas could
+ * draw as shapes: the owner writes one pixel per summary cell and uploads
+ * only when the summary changed. The texture is created lazily; destroy
+ * it while the GL context is current.
+ */
+class PixelTexture {
+public:
+    PixelTexture() = default;
+    ~PixelTexture();
+
+    PixelTexture(const PixelTexture&) = delete;
+    PixelTexture& operator=(const PixelTexture&) = delete;
+
+    /**
+     * @brief Replace the image
+     *
+     * @param pixels width * height colors packed like IM_COL32, top row first
+     */
+    void upload(const std::uint32_t* pixels, int width, int height);
+
+    /**
+     * @brief Stretch the image over a screen rect (nearest filtering)
+     */
+    void draw(ImDrawList* drawList, const ImVec2& min, const ImVec2& max) const;
+
+    /**
+     * @brief Free the texture (recreated by the next upload())
+     */
+    void release();
+
+    bool isReady() const { return m_texture != 0; }
+
+private:
+    unsigned int m_texture = 0;
+    int m_width = 0;
+    int m_height = 0;
+};
 
 } // namespace dsav
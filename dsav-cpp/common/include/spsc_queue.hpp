@@ -0,0 +1,99 @@
+/**
+ * @file spsc_queue.hpp
+ * @brief Bounded lock-free single-producer/single-consumer queue
+ *
+ * A power-of-two ring buffer with one atomic index per side. The producer
+ * only writes the tail and the consumer only writes the head, so neither
+ * side ever blocks the other; each index lives on its own cache line to
+ * avoid false sharing between the two threads.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Fixed-capacity FIFO for exactly one producer and one consumer thread
+ *
+ * @tparam T Element type (must be default-constructible and movable)
+ */
+template <typename T>
+class SpscQueue {
+public:
+    /**
+     * @brief Construct a queue holding up to capacity elements
+     *
+     * @param capacity Requested capacity (rounded up to a power of two)
+     */
+    explicit SpscQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_mask = size - 1;
+        m_slots = std::make_unique<T[]>(size);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Append an element (producer thread only)
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool tryPush(T&& value) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead > m_mask) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead > m_mask) {
+                return false;
+            }
+        }
+
+        m_slots[tail & m_mask] = std::move(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer thread only)
+     * @return The element, or std::nullopt if the queue is empty
+     */
+    std::optional<T> tryPop() {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) {
+                return std::nullopt;
+            }
+        }
+
+        std::optional<T> value(std::move(m_slots[head & m_mask]));
+        m_slots[head & m_mask] = T{};
+        m_head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Maximum number of queued elements
+     */
+    size_t capacity() const { return m_mask + 1; }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    std::unique_ptr<T[]> m_slots;
+    size_t m_mask = 0;
+
+    alignas(CACHE_LINE) std::atomic<size_t> m_head{0};  ///< Next slot to pop (written by the consumer)
+    size_t m_cachedTail = 0;                            ///< Consumer's last view of m_tail
+
+    alignas(CACHE_LINE) std::atomic<size_t> m_tail{0};  ///< Next slot to fill (written by the producer)
+    size_t m_cachedHead = 0;                            ///< Producer's last view of m_head
+};
+
+} // namespace dsav
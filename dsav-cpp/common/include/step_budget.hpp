@@ -0,0 +1,45 @@
+/**
+ * @file step_budget.hpp
+ * @brief Time-budgeted batch stepping for turbo playback
+ *
+ * Lets a visualizer run as many algorithm steps as fit in a slice of the
+ * frame and then sync its visuals once, instead of one step per frame.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace dsav {
+
+/// Default per-frame stepping budget for turbo mode (milliseconds)
+constexpr float DEFAULT_TURBO_BUDGET_MS = 2.0f;
+
+/**
+ * @brief Call step() until it reports completion or the time budget is spent
+ *
+ * The clock is only sampled every checkInterval steps so that cheap steps
+ * are not dominated by timer overhead. At least one step always runs.
+ *
+ * @param step Callable returning true while more steps remain
+ * @param budgetMs Wall-clock budget in milliseconds
+ * @param checkInterval Steps between clock samples
+ * @return Number of steps executed
+ */
+template <typename StepFn>
+size_t runStepsWithinBudget(StepFn&& step, float budgetMs, size_t checkInterval = 64) {
+    using Clock = std::chrono::steady_clock;
+    auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float, std::milli>(budgetMs));
+
+    size_t steps = 0;
+    while (true) {
+        steps++;
+        if (!step()) break;
+        if (steps % checkInterval == 0 && Clock::now() >= deadline) break;
+    }
+    return steps;
+}
+
+} // namespace dsav
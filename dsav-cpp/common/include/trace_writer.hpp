@@ -0,0 +1,103 @@
+/**
+ * @file trace_writer.hpp
+ * @brief Streams profiler scopes and algorithm events to a Chrome trace file
+ *
+ * While a capture runs, the render thread hands plain TraceEvents to a
+ * background writer through a lock-free SPSC queue; the writer formats them
+ * as Chrome Trace Event JSON and appends them to disk, so a long session
+ * never holds its trace in memory or blocks a frame on file I/O. The file
+ * opens in chrome://tracing, Perfetto, or Tracy (through its import-chrome
+ * tool).
+ *
+ * emit() is render-thread only: profiler scopes from other threads reach
+ * it through profiler::endFrame(), which drains them on the render thread.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace dsav::trace {
+
+/// Events buffered between the render thread and the writer
+constexpr size_t QUEUE_CAPACITY = 1 << 16;
+
+/// Track the algorithm events are drawn on (profiler threads use 0, 1, ...)
+constexpr std::uint32_t ALGORITHM_TRACK = 1000;
+
+/**
+ * @brief Chrome trace event phase
+ */
+enum class Phase : char {
+    Complete = 'X',     ///< Span with a duration
+    Instant = 'i'       ///< Single point in time
+};
+
+/**
+ * @brief One event (plain data; names must be string literals or interned)
+ */
+struct TraceEvent {
+    const char* name = "";
+    const char* category = "";
+    Phase phase = Phase::Instant;
+    std::uint32_t track = 0;            ///< Thread row in the viewer
+    std::uint64_t timestampNs = 0;      ///< Same clock as profiler::nowNs()
+    std::uint64_t durationNs = 0;       ///< Complete events only
+    const char* argNames[2] = {nullptr, nullptr};  ///< Unused args have no name
+    std::int64_t args[2] = {0, 0};
+};
+
+namespace detail {
+extern std::atomic<bool> g_active;
+}
+
+/**
+ * @brief Check whether a capture is running (cheap enough for every step)
+ */
+inline bool isActive() {
+    return detail::g_active.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Open a trace file and start the writer thread
+ *
+ * @param path File to create (overwritten)
+ * @return false if a capture is already running or the file cannot be opened
+ */
+bool start(const std::string& path);
+
+/**
+ * @brief Flush the queued events, close the file and join the writer
+ */
+void stop();
+
+/**
+ * @brief Queue an event (render thread; dropped and counted if the queue is full)
+ */
+void emit(const TraceEvent& event);
+
+/**
+ * @brief Queue an instant event with up to two named integer arguments
+ */
+void instant(const char* name, const char* category, std::uint32_t track,
+             const char* arg0 = nullptr, std::int64_t value0 = 0,
+             const char* arg1 = nullptr, std::int64_t value1 = 0);
+
+/**
+ * @brief Timestamped file name in the working directory (dsav-trace-YYYYMMDD-HHMMSS.json)
+ */
+std::string defaultPath();
+
+/// Path of the running (or last) capture
+const std::string& path();
+
+/// Events written to disk by the current (or last) capture
+std::uint64_t writtenEvents();
+
+/// Events dropped because the writer fell behind
+std::uint64_t droppedEvents();
+
+} // namespace dsav::trace
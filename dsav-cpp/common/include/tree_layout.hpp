@@ -0,0 +1,152 @@
+/**
+ * @file tree_layout.hpp
+ * @brief Incremental tidy-tree layout engine for binary tree visualizers
+ *
+ * Implements the Reingold–Tilford tidy drawing (threaded contours, parents
+ * centered over their children, a guaranteed minimum gap between adjacent
+ * nodes on the same level). The engine mirrors the tree topology in flat
+ * arrays keyed by node id, and after a change it only re-merges the touched
+ * nodes and their ancestors, so layout cost follows the size of the change
+ * rather than the size of the tree.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace dsav {
+
+/**
+ * @brief Incremental Reingold–Tilford layout keyed by stable node ids
+ *
+ * Usage: report every node whose links changed with setLinks(), every
+ * deleted node with removeNode(), the current root with setRoot(), then
+ * call update(). Ids are small dense integers (e.g. node pool indices).
+ */
+class TreeLayout {
+public:
+    /// Id meaning "no node"
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    /**
+     * @brief Construct a layout engine
+     *
+     * @param nodeSpacing Minimum horizontal distance between adjacent nodes on a level
+     * @param levelSpacing Vertical distance between levels
+     */
+    explicit TreeLayout(float nodeSpacing = 70.0f, float levelSpacing = 80.0f);
+
+    /**
+     * @brief Record a node's current children (adds the node if new)
+     *
+     * @param id Node id
+     * @param left Left child id or NONE
+     * @param right Right child id or NONE
+     */
+    void setLinks(std::uint32_t id, std::uint32_t left, std::uint32_t right);
+
+    /**
+     * @brief Drop a node that no longer exists in the tree
+     */
+    void removeNode(std::uint32_t id);
+
+    /**
+     * @brief Set the current root (NONE for an empty tree)
+     */
+    void setRoot(std::uint32_t id);
+
+    /**
+     * @brief Set the screen position of the root
+     */
+    void setOrigin(const glm::vec2& origin);
+
+    /**
+     * @brief Change spacing (forces a full relayout on the next update)
+     */
+    void setSpacing(float nodeSpacing, float levelSpacing);
+
+    /**
+     * @brief Forget every node
+     */
+    void clear();
+
+    /**
+     * @brief Recompute the layout for everything reported since the last update
+     */
+    void update();
+
+    /**
+     * @brief Get absolute position of a node (valid after update)
+     */
+    glm::vec2 position(std::uint32_t id) const;
+
+    /**
+     * @brief Check whether a node is part of the layout
+     */
+    bool contains(std::uint32_t id) const;
+
+    /**
+     * @brief Ids whose absolute position changed in the last update (new nodes included)
+     */
+    const std::vector<std::uint32_t>& movedNodes() const { return m_moved; }
+
+    /**
+     * @brief Number of subtree merges performed by the last update (for profiling)
+     */
+    size_t lastMergeCount() const { return m_lastMergeCount; }
+
+private:
+    void ensureCapacity(std::uint32_t id);
+    void touch(std::uint32_t id);
+    void clearThread(std::uint32_t owner);
+    void merge(std::uint32_t id);
+    void resolvePositions();
+
+    bool nextLeftContour(std::uint32_t& node, float& x) const;
+    bool nextRightContour(std::uint32_t& node, float& x) const;
+
+    // Topology (mirrored from the host tree)
+    std::vector<std::uint32_t> m_left;
+    std::vector<std::uint32_t> m_right;
+    std::vector<std::uint32_t> m_parent;
+    std::vector<std::uint8_t> m_present;
+
+    // Relative layout produced by the merges
+    std::vector<float> m_offset;               ///< X relative to parent
+    std::vector<std::uint32_t> m_height;       ///< Subtree height in levels
+    std::vector<std::uint32_t> m_extLeft;      ///< Leftmost node on the deepest level
+    std::vector<std::uint32_t> m_extRight;     ///< Rightmost node on the deepest level
+    std::vector<float> m_extLeftX;             ///< X of m_extLeft relative to this node
+    std::vector<float> m_extRightX;            ///< X of m_extRight relative to this node
+
+    // Contour threads (set on leaves, pointing one level deeper)
+    std::vector<std::uint32_t> m_threadLeft;
+    std::vector<std::uint32_t> m_threadRight;
+    std::vector<float> m_threadLeftX;          ///< Target X relative to the threaded node
+    std::vector<float> m_threadRightX;
+    std::vector<std::uint32_t> m_threadOwner;  ///< Node whose merge placed a thread (per merging node)
+    std::vector<std::uint8_t> m_threadOwnerLeft;
+
+    // Absolute positions
+    std::vector<glm::vec2> m_position;
+    std::vector<std::uint8_t> m_placed;
+
+    // Incremental bookkeeping
+    std::vector<std::uint32_t> m_touched;
+    std::vector<std::uint8_t> m_inWorkSet;
+    std::vector<std::uint32_t> m_workSet;
+    std::vector<std::uint8_t> m_pending;
+    std::vector<std::uint32_t> m_moved;
+
+    std::uint32_t m_root = NONE;
+    glm::vec2 m_origin = glm::vec2(400.0f, 80.0f);
+    float m_nodeSpacing;
+    float m_levelSpacing;
+    bool m_fullRelayout = false;
+    size_t m_lastMergeCount = 0;
+};
+
+} // namespace dsav
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
 
 namespace dsav {
 
@@ -117,6 +118,77 @@ public:
      * @return true if paused
      */
     virtual bool isPaused() const = 0;
+
+    // ===== Timeline (optional) =====
+    // Visualizers that record a step history override these; the defaults
+    // describe a visualizer that can only move forward.
+
+    /**
+     * @brief Check whether this visualizer records a seekable step history
+     */
+    virtual bool hasTimeline() const { return false; }
+
+    /**
+     * @brief Step backward one recorded step and pause
+     *
+     * @return true if the view moved
+     */
+    virtual bool stepBack() { return false; }
+
+    /**
+     * @brief Jump to a recorded step and pause
+     *
+     * @param step Target step (0 = before the first step, clamped to stepCount())
+     * @return true if the step is part of the history
+     */
+    virtual bool seek(size_t step) { (void)step; return false; }
+
+    /**
+     * @brief Step currently shown
+     */
+    virtual size_t currentStep() const { return 0; }
+
+    /**
+     * @brief Number of recorded steps
+     */
+    virtual size_t stepCount() const { return 0; }
+
+    // ===== Lifetime (optional) =====
+
+    /**
+     * @brief Called when the sidebar switches to another visualizer
+     *
+     * The visualizer stays alive and is shown again later, but receives no
+     * update() calls meanwhile. Override to free GPU objects and visual
+     * caches the next renderVisualization() can rebuild; keep the data and
+     * the step history.
+     */
+    virtual void suspend() {}
+
+    // ===== Snapshots (optional) =====
+
+    /**
+     * @brief Check whether the container can be saved to a snapshot file
+     */
+    virtual bool supportsSnapshots() const { return false; }
+
+    /**
+     * @brief Write the container's contents to a snapshot file
+     *
+     * @return false on failure (getStatusText() gives the reason)
+     */
+    virtual bool saveSnapshot(const std::string& path) { (void)path; return false; }
+
+    /**
+     * @brief Replace the container's contents with a snapshot file's
+     *
+     * Runs to completion before returning. Pending animations and the step
+     * history are dropped.
+     *
+     * @return false on failure (getStatusText() gives the reason); the
+     *         contents are then unchanged or empty
+     */
+    virtual bool loadSnapshot(const std::string& path) { (void)path; return false; }
 };
 
 } // namespace dsav
@@ -0,0 +1,159 @@
+/**
+ * @file visualizer_registry.hpp
+ * @brief Owns one lazily constructed instance per visualizer kind
+ *
+ * The sidebar registers a factory per visualizer under an enum id. A
+ * visualizer is constructed the first time it is selected and then kept
+ * alive: switching away only calls IVisualizer::suspend(), so switching
+ * back restores it with its data, camera and history intact instead of
+ * rebuilding it. Lookups are by id, so highlighting the active sidebar entry
+ * is an integer compare rather than a getName() string compare.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Lazily constructed, persistent visualizers indexed by an enum
+ *
+ * @tparam Id Enum class whose values are 0, 1, ... (one per visualizer)
+ */
+template <typename Id>
+class VisualizerRegistry {
+public:
+    using Factory = std::function<std::unique_ptr<IVisualizer>()>;
+
+    /**
+     * @brief Register how to build a visualizer (nothing is constructed yet)
+     *
+     * @param id Id the sidebar selects it by
+     * @param label Display name (sidebar button, status messages)
+     * @param factory Builds the visualizer on first selection
+     */
+    void add(Id id, const char* label, Factory factory) {
+        Entry& entry = entryFor(id, true);
+        entry.label = label;
+        entry.factory = std::move(factory);
+        entry.instance.reset();
+    }
+
+    /**
+     * @brief Make a visualizer current, constructing it on first use
+     *
+     * The previously current visualizer is suspended, not destroyed.
+     *
+     * @return The visualizer, or nullptr if the id was never registered
+     */
+    IVisualizer* select(Id id) {
+        Entry* entry = find(id);
+        if (!entry || !entry->factory) {
+            return nullptr;
+        }
+        if (m_hasCurrent && index(id) == m_current) {
+            return entry->instance.get();
+        }
+
+        if (IVisualizer* previous = current()) {
+            previous->suspend();
+        }
+        if (!entry->instance) {
+            entry->instance = entry->factory();
+        }
+        m_current = index(id);
+        m_hasCurrent = entry->instance != nullptr;
+        return entry->instance.get();
+    }
+
+    /**
+     * @brief The selected visualizer (nullptr before the first select())
+     */
+    IVisualizer* current() const {
+        return m_hasCurrent ? m_entries[m_current].instance.get() : nullptr;
+    }
+
+    /**
+     * @brief Check whether id is the selected visualizer
+     */
+    bool isCurrent(Id id) const {
+        return m_hasCurrent && index(id) == m_current;
+    }
+
+    /**
+     * @brief Check whether id has been constructed (and not released since)
+     */
+    bool isConstructed(Id id) const {
+        const Entry* entry = find(id);
+        return entry && entry->instance;
+    }
+
+    /**
+     * @brief Display name registered for id ("" if none)
+     */
+    const char* label(Id id) const {
+        const Entry* entry = find(id);
+        return entry ? entry->label : "";
+    }
+
+    /**
+     * @brief Destroy every constructed visualizer except the current one
+     *
+     * @return Number of visualizers destroyed
+     */
+    size_t releaseInactive() {
+        size_t released = 0;
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if ((!m_hasCurrent || i != m_current) && m_entries[i].instance) {
+                m_entries[i].instance.reset();
+                released++;
+            }
+        }
+        return released;
+    }
+
+    /**
+     * @brief Destroy every visualizer (call while the GL context is still current)
+     */
+    void clear() {
+        for (Entry& entry : m_entries) {
+            entry.instance.reset();
+        }
+        m_hasCurrent = false;
+    }
+
+private:
+    struct Entry {
+        const char* label = "";
+        Factory factory;
+        std::unique_ptr<IVisualizer> instance;
+    };
+
+    static size_t index(Id id) { return static_cast<size_t>(id); }
+
+    Entry& entryFor(Id id, bool grow) {
+        if (grow && index(id) >= m_entries.size()) {
+            m_entries.resize(index(id) + 1);
+        }
+        return m_entries[index(id)];
+    }
+
+    Entry* find(Id id) {
+        return index(id) < m_entries.size() ? &m_entries[index(id)] : nullptr;
+    }
+
+    const Entry* find(Id id) const {
+        return index(id) < m_entries.size() ? &m_entries[index(id)] : nullptr;
+    }
+
+    std::vector<Entry> m_entries;
+    size_t m_current = 0;
+    bool m_hasCurrent = false;
+};
+
+} // namespace dsav
@@ -4,7 +4,6 @@
  */
 
 #include "animation.hpp"
-#include "color_scheme.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -73,111 +72,240 @@ float easeOutBack(float t) {
     return 1.0f + c3 * std::pow(t - 1.0f, 3.0f) + c1 * std::pow(t - 1.0f, 2.0f);
 }
 
+float apply(Easing curve, float t) {
+    switch (curve) {
+        case Easing::Linear:         return linear(t);
+        case Easing::EaseInOut:      return easeInOut(t);
+        case Easing::EaseIn:         return easeIn(t);
+        case Easing::EaseOut:        return easeOut(t);
+        case Easing::EaseOutBounce:  return easeOutBounce(t);
+        case Easing::EaseOutElastic: return easeOutElastic(t);
+        case Easing::EaseOutBack:    return easeOutBack(t);
+    }
+    return t;
+}
+
 } // namespace easing
 
-// ===== Animation =====
+// ===== AnimationController =====
 
-void Animation::update(float deltaTime) {
-    if (isComplete()) return;
+void AnimationController::enqueue(Animation anim) {
+    m_stepBegin.push_back(m_trackDuration.size());
+    addTrack(anim);
+}
 
-    elapsed += deltaTime;
+void AnimationController::enqueueParallel(std::vector<Animation> anims) {
+    if (anims.empty()) return;
 
-    // Clamp to duration
-    if (elapsed > duration) {
-        elapsed = duration;
+    // One step, many tracks: the next step waits for the slowest of them
+    m_stepBegin.push_back(m_trackDuration.size());
+    for (auto& anim : anims) {
+        addTrack(anim);
     }
+}
 
-    // Calculate normalized time [0, 1]
-    float t = (duration > 0.0f) ? (elapsed / duration) : 1.0f;
+void AnimationController::addTrack(Animation& anim) {
+    // Prefer a container-relative handle so the target survives reallocation
+    std::uint32_t binding = NO_BINDING;
+    size_t offset = 0;
+    if (anim.target) {
+        auto address = reinterpret_cast<std::uintptr_t>(anim.target);
+        for (std::uint32_t b = 0; b < m_bindings.size(); ++b) {
+            auto base = reinterpret_cast<std::uintptr_t>(m_bindings[b].data(m_bindings[b].container));
+            size_t bytes = m_bindings[b].bytes(m_bindings[b].container);
+            if (address >= base && address < base + bytes) {
+                binding = b;
+                offset = address - base;
+                break;
+            }
+        }
+    }
 
-    // Apply easing function
-    float easedT = easingFn ? easingFn(t) : t;
+    m_trackBinding.push_back(binding);
+    m_trackOffset.push_back(offset);
+    m_trackRaw.push_back(binding == NO_BINDING ? anim.target : nullptr);
+    m_trackComponents.push_back(anim.target ? anim.components : 0);
+    m_trackEasing.push_back(anim.easing);
+    m_trackFrom.push_back(anim.to);
+    m_trackTo.push_back(anim.to);
+    m_trackDuration.push_back(anim.duration);
+    m_trackDone.push_back(0);
+
+    if (anim.onComplete) {
+        m_trackCallback.push_back(static_cast<std::uint32_t>(m_callbacks.size()));
+        m_callbacks.push_back(std::move(anim.onComplete));
+    } else {
+        m_trackCallback.push_back(NO_CALLBACK);
+    }
+}
 
-    // Call update function
-    if (updateFn) {
-        updateFn(easedT);
+float* AnimationController::resolve(size_t track) const {
+    std::uint32_t binding = m_trackBinding[track];
+    if (binding == NO_BINDING) {
+        return m_trackRaw[track];
     }
 
-    // Call completion callback if just completed
-    if (isComplete() && onComplete) {
-        onComplete();
+    // Element removed from the container since the track was created
+    size_t offset = m_trackOffset[track];
+    if (offset + m_trackComponents[track] * sizeof(float) > m_bindingBytes[binding]) {
+        return nullptr;
     }
+    return reinterpret_cast<float*>(m_bindingBase[binding] + offset);
 }
 
-// ===== AnimationController =====
+size_t AnimationController::markAnimatedElements(const void* container, size_t stride,
+                                                 std::vector<std::uint8_t>& animated) const {
+    if (!hasAnimations()) return 0;
 
-void AnimationController::enqueue(Animation anim) {
-    m_queue.push(std::move(anim));
+    std::uint32_t binding = NO_BINDING;
+    for (std::uint32_t b = 0; b < m_bindings.size(); ++b) {
+        if (m_bindings[b].container == container) {
+            binding = b;
+            break;
+        }
+    }
+    if (binding == NO_BINDING) return 0;
+
+    size_t begin = m_stepBegin[m_currentStep];
+    size_t end = (m_currentStep + 1 < m_stepBegin.size()) ? m_stepBegin[m_currentStep + 1] : m_trackDuration.size();
+    size_t marked = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (m_trackBinding[i] != binding) continue;
+        size_t element = m_trackOffset[i] / stride;
+        if (element < animated.size() && !animated[element]) {
+            animated[element] = 1;
+            marked++;
+        }
+    }
+    return marked;
 }
 
-void AnimationController::enqueueParallel(std::vector<Animation> anims) {
-    // If there's a parallel group running, we need to wait for it to finish
-    // For now, we'll add a dummy animation to the queue to separate groups
-    if (!m_queue.empty() || !m_parallelGroup.empty()) {
-        // Add a marker to indicate end of previous animations
-        // We'll handle this by just pushing all animations
+void AnimationController::beginStep() {
+    size_t begin = m_stepBegin[m_currentStep];
+    size_t end = (m_currentStep + 1 < m_stepBegin.size()) ? m_stepBegin[m_currentStep + 1] : m_trackDuration.size();
+
+    // Tweens start from whatever value the target has when the step begins
+    for (size_t i = begin; i < end; ++i) {
+        const float* target = resolve(i);
+        if (!target) continue;
+        float* from = &m_trackFrom[i].x;
+        for (std::uint8_t c = 0; c < m_trackComponents[i]; ++c) {
+            from[c] = target[c];
+        }
     }
 
-    // Add all parallel animations to the queue wrapped in a special way
-    // For simplicity, we'll just add them sequentially for now
-    // A more sophisticated implementation would track them separately
-    for (auto& anim : anims) {
-        m_queue.push(std::move(anim));
-    }
+    m_stepElapsed = 0.0f;
+    m_stepStarted = true;
 }
 
 void AnimationController::update(float deltaTime) {
-    if (m_paused) return;
+    if (m_paused || !hasAnimations()) return;
+
+    // Resolve container base pointers once per frame
+    m_bindingBase.resize(m_bindings.size());
+    m_bindingBytes.resize(m_bindings.size());
+    for (size_t b = 0; b < m_bindings.size(); ++b) {
+        m_bindingBase[b] = m_bindings[b].data(m_bindings[b].container);
+        m_bindingBytes[b] = m_bindings[b].bytes(m_bindings[b].container);
+    }
 
-    // Apply speed multiplier
-    float adjustedDelta = deltaTime * m_speed;
+    if (!m_stepStarted) {
+        beginStep();
+    }
 
-    // Process parallel group if active
-    if (!m_parallelGroup.empty()) {
-        // Update all animations in parallel
-        for (auto& anim : m_parallelGroup) {
-            anim.update(adjustedDelta);
+    // Apply speed multiplier
+    m_stepElapsed += deltaTime * m_speed;
+
+    // Evaluate every track of the current step in one pass
+    size_t begin = m_stepBegin[m_currentStep];
+    size_t end = (m_currentStep + 1 < m_stepBegin.size()) ? m_stepBegin[m_currentStep + 1] : m_trackDuration.size();
+    bool stepDone = true;
+
+    for (size_t i = begin; i < end; ++i) {
+        if (m_trackDone[i]) continue;
+
+        float duration = m_trackDuration[i];
+        float t = (duration > 0.0f) ? (m_stepElapsed / duration) : 1.0f;
+        if (t >= 1.0f) {
+            t = 1.0f;
+            m_trackDone[i] = 1;
+            if (m_trackCallback[i] != NO_CALLBACK) {
+                m_firedCallbacks.push_back(m_trackCallback[i]);
+            }
+        } else {
+            stepDone = false;
         }
 
-        // Remove completed animations
-        m_parallelGroup.erase(
-            std::remove_if(m_parallelGroup.begin(), m_parallelGroup.end(),
-                [](const Animation& anim) { return anim.isComplete(); }),
-            m_parallelGroup.end()
-        );
+        float* target = resolve(i);
+        if (!target) continue;
 
-        // If parallel group is done, we can start next animation
-        return;
+        float eased = easing::apply(m_trackEasing[i], t);
+        glm::vec4 value = m_trackFrom[i] + (m_trackTo[i] - m_trackFrom[i]) * eased;
+        const float* components = &value.x;
+        for (std::uint8_t c = 0; c < m_trackComponents[i]; ++c) {
+            target[c] = components[c];
+        }
+    }
+
+    // Take callbacks out before they run: they may enqueue or clear()
+    std::vector<std::function<void()>> callbacks;
+    callbacks.reserve(m_firedCallbacks.size());
+    for (std::uint32_t index : m_firedCallbacks) {
+        callbacks.push_back(std::move(m_callbacks[index]));
     }
+    m_firedCallbacks.clear();
 
-    // Process sequential queue
-    if (!m_queue.empty()) {
-        Animation& current = m_queue.front();
-        current.update(adjustedDelta);
+    if (stepDone) {
+        m_currentStep++;
+        m_stepStarted = false;
 
-        if (current.isComplete()) {
-            m_queue.pop();
+        // Queue drained: recycle the track store
+        if (m_currentStep == m_stepBegin.size()) {
+            clear();
         }
     }
-}
 
-void AnimationController::clear() {
-    // Clear queue
-    while (!m_queue.empty()) {
-        m_queue.pop();
+    for (auto& callback : callbacks) {
+        callback();
     }
+}
 
-    // Clear parallel group
-    m_parallelGroup.clear();
+void AnimationController::clear() {
+    m_trackBinding.clear();
+    m_trackOffset.clear();
+    m_trackRaw.clear();
+    m_trackComponents.clear();
+    m_trackEasing.clear();
+    m_trackFrom.clear();
+    m_trackTo.clear();
+    m_trackDuration.clear();
+    m_trackDone.clear();
+    m_trackCallback.clear();
+    m_callbacks.clear();
+
+    m_stepBegin.clear();
+    m_currentStep = 0;
+    m_stepElapsed = 0.0f;
+    m_stepStarted = false;
 }
 
 bool AnimationController::hasAnimations() const {
-    return !m_queue.empty() || !m_parallelGroup.empty();
+    return m_currentStep < m_stepBegin.size();
+}
+
+bool AnimationController::isProcessingParallelGroup() const {
+    return activeTrackCount() > 1;
+}
+
+size_t AnimationController::activeTrackCount() const {
+    if (!hasAnimations()) return 0;
+    size_t begin = m_stepBegin[m_currentStep];
+    size_t end = (m_currentStep + 1 < m_stepBegin.size()) ? m_stepBegin[m_currentStep + 1] : m_trackDuration.size();
+    return end - begin;
 }
 
 void AnimationController::stepForward(float stepSize) {
     // Temporarily unpause, advance by stepSize, then pause again
-    bool wasPaused = m_paused;
     m_paused = false;
     update(stepSize);
     m_paused = true;
@@ -186,64 +314,53 @@ void AnimationController::stepForward(float stepSize) {
 // ===== Helper Animation Creators =====
 
 Animation createMoveAnimation(glm::vec2& pos, const glm::vec2& target, float duration) {
-    glm::vec2 start = pos;
-
     Animation anim;
     anim.duration = duration;
-    anim.updateFn = [&pos, start, target](float t) {
-        pos = start + (target - start) * t;
-    };
-    anim.easingFn = easing::easeInOut;
+    anim.target = &pos.x;
+    anim.components = 2;
+    anim.to = glm::vec4(target.x, target.y, 0.0f, 0.0f);
+    anim.easing = Easing::EaseInOut;
 
     return anim;
 }
 
 Animation createColorAnimation(glm::vec4& color, const glm::vec4& target, float duration) {
-    glm::vec4 start = color;
-
     Animation anim;
     anim.duration = duration;
-    anim.updateFn = [&color, start, target](float t) {
-        color = colors::lerp(start, target, t);
-    };
-    anim.easingFn = easing::linear;  // Color transitions usually look better linear
+    anim.target = &color.x;
+    anim.components = 4;
+    anim.to = target;
+    anim.easing = Easing::Linear;  // Color transitions usually look better linear
 
     return anim;
 }
 
 Animation createScaleAnimation(float& scale, float target, float duration) {
-    float start = scale;
-
     Animation anim;
     anim.duration = duration;
-    anim.updateFn = [&scale, start, target](float t) {
-        scale = start + (target - start) * t;
-    };
-    anim.easingFn = easing::easeOutBack;  // Scale looks good with back easing
+    anim.target = &scale;
+    anim.components = 1;
+    anim.to = glm::vec4(target, 0.0f, 0.0f, 0.0f);
+    anim.easing = Easing::EaseOutBack;  // Scale looks good with back easing
 
     return anim;
 }
 
 Animation createFadeAnimation(float& alpha, float target, float duration) {
-    float start = alpha;
-
     Animation anim;
     anim.duration = duration;
-    anim.updateFn = [&alpha, start, target](float t) {
-        alpha = start + (target - start) * t;
-    };
-    anim.easingFn = easing::linear;
+    anim.target = &alpha;
+    anim.components = 1;
+    anim.to = glm::vec4(target, 0.0f, 0.0f, 0.0f);
+    anim.easing = Easing::Linear;
 
     return anim;
 }
 
 Animation createDelayAnimation(float duration) {
     Animation anim;
-    anim.duration = duration;
-    anim.updateFn = [](float) {
-        // Do nothing during delay
-    };
-    anim.easingFn = easing::linear;
+    anim.duration = duration;  // No target: the step just waits
+    anim.easing = Easing::Linear;
 
     return anim;
 }
@@ -0,0 +1,289 @@
+/**
+ * @file bar_renderer.cpp
+ * @brief Implementation of the GPU-instanced bar renderer
+ */
+
+#include <glad/glad.h>
+#include "bar_renderer.hpp"
+#include "color_scheme.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace dsav {
+
+namespace {
+
+// Unit quad corners; x spans the bar width, y spans its height (upwards)
+constexpr float QUAD_CORNERS[] = {
+    0.0f, 0.0f,
+    1.0f, 0.0f,
+    0.0f, 1.0f,
+    1.0f, 1.0f
+};
+
+const char* VERTEX_SHADER = R"(#version 330 core
+layout(location = 0) in vec2 a_corner;
+layout(location = 1) in float a_value;
+layout(location = 2) in uint a_state;
+
+uniform mat4 u_projection;
+uniform vec2 u_origin;
+uniform float u_pitch;
+uniform float u_width;
+uniform float u_heightScale;
+uniform int u_first;
+uniform vec4 u_palette[13];
+
+flat out vec4 v_color;
+
+void main() {
+    float index = float(gl_InstanceID + u_first);
+    vec2 pos = vec2(u_origin.x + index * u_pitch + a_corner.x * u_width,
+                    u_origin.y - a_corner.y * a_value * u_heightScale);
+    gl_Position = u_projection * vec4(pos, 0.0, 1.0);
+    v_color = u_palette[min(a_state, 12u)];
+}
+)";
+
+static_assert(BAR_STATE_COUNT == 13, "Update u_palette in VERTEX_SHADER");
+
+const char* FRAGMENT_SHADER = R"(#version 330 core
+flat in vec4 v_color;
+out vec4 fragColor;
+
+void main() {
+    fragColor = v_color;
+}
+)";
+
+GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (!status) {
+        char log[512];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "Bar renderer shader compile failed: " << log << "\n";
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+} // namespace
+
+InstancedBarRenderer::InstancedBarRenderer() {
+    m_palette[static_cast<size_t>(BarState::Base)] = colors::semantic::elementBase;
+    m_palette[static_cast<size_t>(BarState::Comparing)] = colors::semantic::comparing;
+    m_palette[static_cast<size_t>(BarState::Swapping)] = colors::semantic::swapping;
+    m_palette[static_cast<size_t>(BarState::Sorted)] = colors::semantic::sorted;
+    m_palette[static_cast<size_t>(BarState::Highlight)] = colors::semantic::highlight;
+    for (size_t lane = 0; lane < BAR_LANE_COUNT; ++lane) {
+        m_palette[static_cast<size_t>(laneBarState(lane))] = colors::semantic::lanes[lane];
+    }
+}
+
+InstancedBarRenderer::~InstancedBarRenderer() {
+    releaseResources();
+}
+
+void InstancedBarRenderer::setStateColor(BarState state, const glm::vec4& color) {
+    size_t index = static_cast<size_t>(state);
+    if (index < BAR_STATE_COUNT) {
+        m_palette[index] = color;
+    }
+}
+
+bool InstancedBarRenderer::isAvailable() {
+    return ensureResources();
+}
+
+bool InstancedBarRenderer::ensureResources() {
+    if (m_initialized) return true;
+    if (m_failed) return false;
+
+    // Instancing entry points are optional in the loader; bail out cleanly
+    if (!glDrawArraysInstanced || !glVertexAttribDivisor || !glVertexAttribIPointer || !glUniform4fv) {
+        m_failed = true;
+        return false;
+    }
+
+    GLuint vs = compileShader(GL_VERTEX_SHADER, VERTEX_SHADER);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, FRAGMENT_SHADER);
+    if (!vs || !fs) {
+        if (vs) glDeleteShader(vs);
+        if (fs) glDeleteShader(fs);
+        m_failed = true;
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, vs);
+    glAttachShader(m_program, fs);
+    glLinkProgram(m_program);
+    glDetachShader(m_program, vs);
+    glDetachShader(m_program, fs);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint linked = 0;
+    glGetProgramiv(m_program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char log[512];
+        glGetProgramInfoLog(m_program, sizeof(log), nullptr, log);
+        std::cerr << "Bar renderer program link failed: " << log << "\n";
+        glDeleteProgram(m_program);
+        m_program = 0;
+        m_failed = true;
+        return false;
+    }
+
+    m_locProjection = glGetUniformLocation(m_program, "u_projection");
+    m_locOrigin = glGetUniformLocation(m_program, "u_origin");
+    m_locPitch = glGetUniformLocation(m_program, "u_pitch");
+    m_locWidth = glGetUniformLocation(m_program, "u_width");
+    m_locHeightScale = glGetUniformLocation(m_program, "u_heightScale");
+    m_locFirst = glGetUniformLocation(m_program, "u_first");
+    m_locPalette = glGetUniformLocation(m_program, "u_palette");
+
+    glGenVertexArrays(1, &m_vao);
+    glGenBuffers(1, &m_quadVbo);
+    glGenBuffers(1, &m_instanceVbo);
+
+    glBindVertexArray(m_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(QUAD_CORNERS), QUAD_CORNERS, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+
+    // Per-instance attributes; pointers are re-based per draw in render()
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_initialized = true;
+    return true;
+}
+
+void InstancedBarRenderer::releaseResources() {
+    if (!m_initialized) return;
+
+    glDeleteBuffers(1, &m_instanceVbo);
+    glDeleteBuffers(1, &m_quadVbo);
+    glDeleteVertexArrays(1, &m_vao);
+    glDeleteProgram(m_program);
+    m_instanceVbo = 0;
+    m_quadVbo = 0;
+    m_vao = 0;
+    m_program = 0;
+    m_capacity = 0;
+    m_initialized = false;
+}
+
+bool InstancedBarRenderer::upload(const std::vector<int>& values, const std::vector<BarState>& states) {
+    if (!ensureResources()) return false;
+
+    m_count = std::min(values.size(), states.size());
+    m_staging.resize(m_count);
+    for (size_t i = 0; i < m_count; ++i) {
+        m_staging[i].value = static_cast<float>(values[i]);
+        m_staging[i].state = static_cast<std::uint32_t>(states[i]);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+    size_t bytes = m_count * sizeof(Instance);
+    if (m_count > m_capacity) {
+        // Grow geometrically so resizing arrays does not reallocate every upload
+        m_capacity = std::max(m_count, m_capacity * 2);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_capacity * sizeof(Instance)),
+                     nullptr, GL_STREAM_DRAW);
+    }
+    if (bytes > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(bytes), m_staging.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void InstancedBarRenderer::draw(ImDrawList* drawList, const BarLayout& layout, size_t first, size_t count) {
+    if (!drawList || !m_initialized || first >= m_count) return;
+
+    m_layout = layout;
+    m_layout.width = std::max(layout.width, 1.0f);
+    m_drawFirst = first;
+    m_drawCount = std::min(count, m_count - first);
+    if (m_drawCount == 0) return;
+
+    // ImGui projects each viewport from its own display rect
+    ImGuiViewport* viewport = ImGui::GetWindowViewport();
+    m_displayPos = viewport->Pos;
+    m_displaySize = viewport->Size;
+    m_framebufferScale = ImGui::GetIO().DisplayFramebufferScale;
+
+    drawList->AddCallback(&InstancedBarRenderer::drawCallback, this);
+    drawList->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+}
+
+void InstancedBarRenderer::drawCallback(const ImDrawList*, const ImDrawCmd* cmd) {
+    static_cast<InstancedBarRenderer*>(cmd->UserCallbackData)->render(cmd->ClipRect);
+}
+
+void InstancedBarRenderer::render(const ImVec4& clipRect) {
+    // Same orthographic projection the ImGui backend uses
+    float l = m_displayPos.x;
+    float r = m_displayPos.x + m_displaySize.x;
+    float t = m_displayPos.y;
+    float b = m_displayPos.y + m_displaySize.y;
+    const float projection[4][4] = {
+        { 2.0f / (r - l),    0.0f,              0.0f, 0.0f },
+        { 0.0f,              2.0f / (t - b),    0.0f, 0.0f },
+        { 0.0f,              0.0f,             -1.0f, 0.0f },
+        { (r + l) / (l - r), (t + b) / (b - t), 0.0f, 1.0f },
+    };
+
+    // Clip to the window, in framebuffer pixels (GL origin is bottom-left)
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    float clipMinX = (clipRect.x - m_displayPos.x) * m_framebufferScale.x;
+    float clipMinY = (clipRect.y - m_displayPos.y) * m_framebufferScale.y;
+    float clipMaxX = (clipRect.z - m_displayPos.x) * m_framebufferScale.x;
+    float clipMaxY = (clipRect.w - m_displayPos.y) * m_framebufferScale.y;
+    if (clipMaxX <= clipMinX || clipMaxY <= clipMinY) return;
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(static_cast<GLint>(clipMinX),
+              static_cast<GLint>(viewport[3] - clipMaxY),
+              static_cast<GLsizei>(clipMaxX - clipMinX),
+              static_cast<GLsizei>(clipMaxY - clipMinY));
+
+    glUseProgram(m_program);
+    glUniformMatrix4fv(m_locProjection, 1, GL_FALSE, &projection[0][0]);
+    glUniform2f(m_locOrigin, m_layout.origin.x, m_layout.origin.y);
+    glUniform1f(m_locPitch, m_layout.pitch);
+    glUniform1f(m_locWidth, m_layout.width);
+    glUniform1f(m_locHeightScale, m_layout.heightScale);
+    glUniform1i(m_locFirst, static_cast<GLint>(m_drawFirst));
+    glUniform4fv(m_locPalette, static_cast<GLsizei>(BAR_STATE_COUNT), &m_palette[0].x);
+
+    // GL 3.3 has no base instance, so offset the instance attributes instead
+    glBindVertexArray(m_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+    const char* base = reinterpret_cast<const char*>(m_drawFirst * sizeof(Instance));
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), base + offsetof(Instance, value));
+    glVertexAttribIPointer(2, 1, GL_UNSIGNED_INT, sizeof(Instance), base + offsetof(Instance, state));
+
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(m_drawCount));
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+} // namespace dsav
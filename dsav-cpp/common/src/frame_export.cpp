@@ -0,0 +1,351 @@
+/**
+ * @file frame_export.cpp
+ * @brief PBO frame read-back and background PNG/GIF encoding
+ */
+
+#include <glad/glad.h>
+#include "frame_export.hpp"
+#include "image_writer.hpp"
+#include "spsc_queue.hpp"
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace dsav {
+
+namespace {
+
+constexpr std::chrono::milliseconds IDLE_SLEEP(2);     ///< Encoder nap when no frame is queued
+constexpr std::chrono::milliseconds BACKPRESSURE_SLEEP(1);  ///< Render thread nap while all frames are in flight
+
+/// GIF delays are whole centiseconds and many viewers slow anything under 2 down
+constexpr int GIF_MAX_FPS = 50;
+
+/// Centiseconds frame index shows for, spread so the total stays on the fps clock
+int gifDelay(std::uint64_t index, int fps) {
+    auto at = [fps](std::uint64_t frame) {
+        return static_cast<std::int64_t>(std::llround(static_cast<double>(frame) * 100.0 / fps));
+    };
+    return static_cast<int>(at(index + 1) - at(index));
+}
+
+} // namespace
+
+/**
+ * @brief State of one running export
+ */
+struct FrameExporter::Session {
+    struct Frame {
+        std::vector<std::uint8_t> rgba;     ///< Top row first
+        int width = 0;
+        int height = 0;
+        std::uint64_t index = 0;
+    };
+
+    SpscQueue<std::unique_ptr<Frame>> toEncoder{FRAMES_IN_FLIGHT};
+    SpscQueue<std::unique_ptr<Frame>> recycled{FRAMES_IN_FLIGHT};
+    size_t allocated = 0;                   ///< Frames created so far (render thread)
+
+    image::GifWriter gif;                   ///< Encoder thread only
+    std::thread encoder;
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> failed{false};
+};
+
+FrameExporter::FrameExporter() = default;
+
+FrameExporter::~FrameExporter() {
+    stop();
+    releaseBuffers();
+}
+
+bool FrameExporter::start(const ExportSettings& settings) {
+    if (m_session) {
+        m_error = "an export is already running";
+        return false;
+    }
+    if (settings.fps <= 0) {
+        m_error = "frame rate must be positive";
+        return false;
+    }
+
+    m_settings = settings;
+    if (m_settings.path.empty()) {
+        m_settings.path = defaultPath(settings.format);
+    }
+    if (m_settings.format == ExportFormat::Gif) {
+        m_settings.fps = std::min(m_settings.fps, GIF_MAX_FPS);
+    }
+    m_error.clear();
+
+    // Fail now rather than on the encoder thread if the destination is unusable
+    if (m_settings.format == ExportFormat::PngSequence) {
+        std::error_code ec;
+        std::filesystem::create_directories(m_settings.path, ec);
+        if (ec) {
+            m_error = "cannot create " + m_settings.path + ": " + ec.message();
+            return false;
+        }
+    } else {
+        std::FILE* probe = std::fopen(m_settings.path.c_str(), "wb");
+        if (probe == nullptr) {
+            m_error = "cannot create " + m_settings.path;
+            return false;
+        }
+        std::fclose(probe);
+    }
+
+    m_session = std::make_unique<Session>();
+    m_hasSource = false;
+    m_width = 0;
+    m_height = 0;
+    m_pending[0] = m_pending[1] = false;
+    m_nextBuffer = 0;
+    m_captured = 0;
+    m_written.store(0, std::memory_order_relaxed);
+
+    Session& session = *m_session;
+    session.encoder = std::thread([this, &session]() { encoderLoop(session); });
+    return true;
+}
+
+void FrameExporter::stop() {
+    if (!m_session) {
+        return;
+    }
+
+    // Only the newest read can still be in its buffer
+    int last = 1 - m_nextBuffer;
+    if (m_pending[last]) {
+        readBack(last);
+    }
+
+    m_session->stopping.store(true, std::memory_order_release);
+    m_session->encoder.join();
+    if (m_session->failed.load(std::memory_order_relaxed) && m_error.empty()) {
+        m_error = "writing " + m_settings.path + " failed";
+    }
+    m_session.reset();
+
+    if (m_vsyncOff) {
+        glfwSwapInterval(1);
+        m_vsyncOff = false;
+    }
+}
+
+bool FrameExporter::beginFrame(bool moving) {
+    m_exportFrame = m_session != nullptr && moving;
+    m_hasSource = false;  // A hidden visualization window records nothing
+
+    // Export frames are paced by the encoder, not the display
+    if (m_exportFrame != m_vsyncOff) {
+        glfwSwapInterval(m_exportFrame ? 0 : 1);
+        m_vsyncOff = m_exportFrame;
+    }
+    return m_exportFrame;
+}
+
+void FrameExporter::setSource(const ImVec2& canvasPos, const ImVec2& canvasSize) {
+    m_hasSource = false;
+    if (!m_session) {
+        return;
+    }
+
+    // Only the main window's back buffer is read
+    ImGuiViewport* viewport = ImGui::GetWindowViewport();
+    if (viewport != ImGui::GetMainViewport()) {
+        return;
+    }
+
+    ImVec2 scale = ImGui::GetIO().DisplayFramebufferScale;
+    int framebufferWidth = static_cast<int>(viewport->Size.x * scale.x);
+    int framebufferHeight = static_cast<int>(viewport->Size.y * scale.y);
+    int left = static_cast<int>((canvasPos.x - viewport->Pos.x) * scale.x);
+    int top = static_cast<int>((canvasPos.y - viewport->Pos.y) * scale.y);
+
+    if (m_width == 0) {
+        m_width = std::min(static_cast<int>(canvasSize.x * scale.x), framebufferWidth - std::max(left, 0));
+        m_height = std::min(static_cast<int>(canvasSize.y * scale.y), framebufferHeight - std::max(top, 0));
+        if (m_width <= 0 || m_height <= 0) {
+            m_width = 0;
+            m_height = 0;
+            return;
+        }
+    }
+    if (m_width > framebufferWidth || m_height > framebufferHeight) {
+        return;  // Window shrank below the export size: skip until it grows back
+    }
+
+    m_sourceX = std::clamp(left, 0, framebufferWidth - m_width);
+    int clampedTop = std::clamp(top, 0, framebufferHeight - m_height);
+    m_sourceY = framebufferHeight - clampedTop - m_height;
+    m_hasSource = true;
+}
+
+bool FrameExporter::ensureBuffers(size_t bytes) {
+    if (!glMapBufferRange || !glUnmapBuffer) {
+        return false;
+    }
+    if (m_pboBytes == bytes) {
+        return true;
+    }
+
+    if (m_pbo[0] == 0) {
+        glGenBuffers(2, m_pbo);
+    }
+    for (unsigned int pbo : m_pbo) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    m_pboBytes = bytes;
+    return true;
+}
+
+void FrameExporter::releaseBuffers() {
+    if (m_pbo[0] != 0) {
+        glDeleteBuffers(2, m_pbo);
+        m_pbo[0] = m_pbo[1] = 0;
+    }
+    m_pboBytes = 0;
+}
+
+void FrameExporter::captureFrame() {
+    if (!m_session || !m_exportFrame || !m_hasSource) {
+        return;
+    }
+
+    size_t bytes = static_cast<size_t>(m_width) * m_height * 4;
+    if (!ensureBuffers(bytes)) {
+        m_error = "pixel buffer objects are not available";
+        m_session->failed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    // Start this frame's read; it completes while the next frame is built
+    int current = m_nextBuffer;
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadBuffer(GL_BACK);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo[current]);
+    glReadPixels(m_sourceX, m_sourceY, m_width, m_height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    m_pending[current] = true;
+    m_nextBuffer = 1 - current;
+
+    // The other buffer was filled a frame ago, so mapping it does not stall
+    if (m_pending[m_nextBuffer]) {
+        readBack(m_nextBuffer);
+    }
+}
+
+void FrameExporter::readBack(int buffer) {
+    m_pending[buffer] = false;
+    Session& session = *m_session;
+
+    // Reuse a frame the encoder is done with; wait for one if all are in flight
+    std::unique_ptr<Session::Frame> frame;
+    if (session.allocated < FRAMES_IN_FLIGHT) {
+        if (auto recycled = session.recycled.tryPop()) {
+            frame = std::move(*recycled);
+        } else {
+            frame = std::make_unique<Session::Frame>();
+            session.allocated++;
+        }
+    } else {
+        for (;;) {
+            if (auto recycled = session.recycled.tryPop()) {
+                frame = std::move(*recycled);
+                break;
+            }
+            std::this_thread::sleep_for(BACKPRESSURE_SLEEP);
+        }
+    }
+
+    size_t rowBytes = static_cast<size_t>(m_width) * 4;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo[buffer]);
+    const auto* pixels = static_cast<const std::uint8_t*>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(m_pboBytes), GL_MAP_READ_BIT));
+    if (pixels) {
+        // GL rows run bottom-up
+        frame->rgba.resize(m_pboBytes);
+        for (int y = 0; y < m_height; ++y) {
+            std::memcpy(&frame->rgba[static_cast<size_t>(y) * rowBytes],
+                        pixels + static_cast<size_t>(m_height - 1 - y) * rowBytes, rowBytes);
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+        frame->width = m_width;
+        frame->height = m_height;
+        frame->index = m_captured++;
+        session.toEncoder.tryPush(std::move(frame));  // Never full: at most FRAMES_IN_FLIGHT frames exist
+    } else {
+        session.recycled.tryPush(std::move(frame));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void FrameExporter::encoderLoop(Session& session) {
+    char name[32];
+
+    for (;;) {
+        // Read the flag first: everything queued before stop() is then drained below
+        bool stopping = session.stopping.load(std::memory_order_acquire);
+
+        bool worked = false;
+        while (auto queued = session.toEncoder.tryPop()) {
+            Session::Frame& frame = **queued;
+            worked = true;
+
+            // After a failure keep recycling so the render thread never waits forever
+            if (!session.failed.load(std::memory_order_relaxed)) {
+                bool ok;
+                if (m_settings.format == ExportFormat::PngSequence) {
+                    std::snprintf(name, sizeof(name), "frame_%06llu.png",
+                                  static_cast<unsigned long long>(frame.index));
+                    std::string file = (std::filesystem::path(m_settings.path) / name).string();
+                    ok = image::writePng(file, frame.rgba.data(), frame.width, frame.height);
+                } else {
+                    ok = session.gif.isOpen() || session.gif.open(m_settings.path, frame.width, frame.height);
+                    ok = ok && session.gif.addFrame(frame.rgba.data(), gifDelay(frame.index, m_settings.fps));
+                }
+                if (ok) {
+                    m_written.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    session.failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            session.recycled.tryPush(std::move(*queued));
+        }
+
+        if (stopping) {
+            break;
+        }
+        if (!worked) {
+            std::this_thread::sleep_for(IDLE_SLEEP);
+        }
+    }
+
+    if (session.gif.isOpen() && !session.gif.close()) {
+        session.failed.store(true, std::memory_order_relaxed);
+    }
+}
+
+std::string FrameExporter::defaultPath(ExportFormat format) {
+    std::time_t now = std::time(nullptr);
+    char name[64];
+    std::strftime(name, sizeof(name), format == ExportFormat::Gif ? "dsav-export-%Y%m%d-%H%M%S.gif"
+                                                                  : "dsav-export-%Y%m%d-%H%M%S",
+                  std::localtime(&now));
+    return name;
+}
+
+} // namespace dsav
@@ -74,6 +74,8 @@ PFNGLDELETEBUFFERSPROC gladglDeleteBuffers = NULL;
 PFNGLBINDBUFFERPROC gladglBindBuffer = NULL;
 PFNGLBUFFERDATAPROC gladglBufferData = NULL;
 PFNGLBUFFERSUBDATAPROC gladglBufferSubData = NULL;
+PFNGLMAPBUFFERRANGEPROC gladglMapBufferRange = NULL;
+PFNGLUNMAPBUFFERPROC gladglUnmapBuffer = NULL;
 PFNGLATTACHSHADERPROC gladglAttachShader = NULL;
 PFNGLCOMPILESHADERPROC gladglCompileShader = NULL;
 PFNGLCREATEPROGRAMPROC gladglCreateProgram = NULL;
@@ -94,6 +96,7 @@ PFNGLUNIFORM2FPROC gladglUniform2f = NULL;
 PFNGLUNIFORM3FPROC gladglUniform3f = NULL;
 PFNGLUNIFORM4FPROC gladglUniform4f = NULL;
 PFNGLUNIFORM1IPROC gladglUniform1i = NULL;
+PFNGLUNIFORM4FVPROC gladglUniform4fv = NULL;
 PFNGLUNIFORMMATRIX4FVPROC gladglUniformMatrix4fv = NULL;
 PFNGLVERTEXATTRIBPOINTERPROC gladglVertexAttribPointer = NULL;
 PFNGLGETUNIFORMLOCATIONPROC gladglGetUniformLocation = NULL;
@@ -101,6 +104,9 @@ PFNGLGETATTRIBLOCATIONPROC gladglGetAttribLocation = NULL;
 PFNGLGENVERTEXARRAYSPROC gladglGenVertexArrays = NULL;
 PFNGLDELETEVERTEXARRAYSPROC gladglDeleteVertexArrays = NULL;
 PFNGLBINDVERTEXARRAYPROC gladglBindVertexArray = NULL;
+PFNGLVERTEXATTRIBIPOINTERPROC gladglVertexAttribIPointer = NULL;
+PFNGLDRAWARRAYSINSTANCEDPROC gladglDrawArraysInstanced = NULL;
+PFNGLVERTEXATTRIBDIVISORPROC gladglVertexAttribDivisor = NULL;
 PFNGLGENFRAMEBUFFERSPROC gladglGenFramebuffers = NULL;
 PFNGLDELETEFRAMEBUFFERSPROC gladglDeleteFramebuffers = NULL;
 PFNGLBINDFRAMEBUFFERPROC gladglBindFramebuffer = NULL;
@@ -189,6 +195,8 @@ int gladLoadGLLoader(GLADloadproc load) {
     gladglBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
     gladglBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
     gladglBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+    gladglMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+    gladglUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
 
     /* OpenGL 2.0 - Shaders */
     gladglAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
@@ -211,6 +219,7 @@ int gladLoadGLLoader(GLADloadproc load) {
     gladglUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
     gladglUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
     gladglUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+    gladglUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
     gladglUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
     gladglVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
     gladglGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
@@ -220,6 +229,11 @@ int gladLoadGLLoader(GLADloadproc load) {
     gladglGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
     gladglDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
     gladglBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+    gladglVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+
+    /* OpenGL 3.1 / 3.3 - Instancing */
+    gladglDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+    gladglVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
 
     /* OpenGL 3.0 - Framebuffer Objects */
     gladglGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
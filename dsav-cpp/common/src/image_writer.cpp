@@ -0,0 +1,525 @@
+/**
+ * @file image_writer.cpp
+ * @brief PNG (fixed-Huffman deflate) and animated GIF (LZW) encoders
+ */
+
+#include "image_writer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+namespace dsav::image {
+
+namespace {
+
+// ===== Checksums =====
+
+std::array<std::uint32_t, 256> makeCrcTable() {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t n = 0; n < 256; ++n) {
+        std::uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}
+
+std::uint32_t crc32(const std::uint8_t* data, size_t size, std::uint32_t crc = 0) {
+    static const std::array<std::uint32_t, 256> TABLE = makeCrcTable();
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+std::uint32_t adler32(const std::uint8_t* data, size_t size) {
+    constexpr std::uint32_t MOD = 65521;
+    constexpr size_t BLOCK = 5552;  // Largest run that cannot overflow 32 bits
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    while (size > 0) {
+        size_t n = std::min(size, BLOCK);
+        size -= n;
+        while (n-- > 0) {
+            a += *data++;
+            b += a;
+        }
+        a %= MOD;
+        b %= MOD;
+    }
+    return (b << 16) | a;
+}
+
+void putBigEndian(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+// ===== Deflate =====
+
+/**
+ * @brief LSB-first bit packer shared by deflate and GIF LZW
+ */
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<std::uint8_t>& out) : m_out(out) {}
+
+    void put(std::uint32_t bits, int count) {
+        m_buffer |= static_cast<std::uint64_t>(bits) << m_count;
+        m_count += count;
+        while (m_count >= 8) {
+            m_out.push_back(static_cast<std::uint8_t>(m_buffer));
+            m_buffer >>= 8;
+            m_count -= 8;
+        }
+    }
+
+    /// Huffman codes are defined MSB-first
+    void putReversed(std::uint32_t code, int count) {
+        std::uint32_t reversed = 0;
+        for (int i = 0; i < count; ++i) {
+            reversed = (reversed << 1) | ((code >> i) & 1);
+        }
+        put(reversed, count);
+    }
+
+    void flush() {
+        if (m_count > 0) {
+            m_out.push_back(static_cast<std::uint8_t>(m_buffer));
+        }
+        m_buffer = 0;
+        m_count = 0;
+    }
+
+private:
+    std::vector<std::uint8_t>& m_out;
+    std::uint64_t m_buffer = 0;
+    int m_count = 0;
+};
+
+constexpr int MIN_MATCH = 3;
+constexpr int MAX_MATCH = 258;
+constexpr size_t WINDOW_SIZE = 32768;
+constexpr int HASH_BITS = 15;
+constexpr int MAX_CHAIN = 32;   ///< Candidates tried per position (flat images match on the first few)
+
+constexpr std::uint16_t LENGTH_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+constexpr std::uint8_t LENGTH_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+constexpr std::uint16_t DISTANCE_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+constexpr std::uint8_t DISTANCE_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/// Literal/length symbol with the fixed Huffman code (RFC 1951, 3.2.6)
+void putFixedSymbol(BitWriter& bits, int symbol) {
+    if (symbol < 144) {
+        bits.putReversed(0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        bits.putReversed(0x190 + (symbol - 144), 9);
+    } else if (symbol < 280) {
+        bits.putReversed(symbol - 256, 7);
+    } else {
+        bits.putReversed(0xC0 + (symbol - 280), 8);
+    }
+}
+
+void putMatch(BitWriter& bits, int length, int distance) {
+    int code = 28;
+    while (LENGTH_BASE[code] > length) --code;
+    putFixedSymbol(bits, 257 + code);
+    bits.put(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+    code = 29;
+    while (DISTANCE_BASE[code] > distance) --code;
+    bits.putReversed(code, 5);
+    bits.put(distance - DISTANCE_BASE[code], DISTANCE_EXTRA[code]);
+}
+
+std::uint32_t hash3(const std::uint8_t* p) {
+    std::uint32_t v = (static_cast<std::uint32_t>(p[0]) << 16) | (p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief zlib stream of one fixed-Huffman block with greedy LZ77 matching
+ */
+void deflate(const std::vector<std::uint8_t>& data, std::vector<std::uint8_t>& out) {
+    out.push_back(0x78);  // 32K window, deflate
+    out.push_back(0x01);  // Fastest-compression level hint; header check bits
+
+    BitWriter bits(out);
+    bits.put(1, 1);       // Final block
+    bits.put(1, 2);       // Fixed Huffman codes
+
+    const size_t size = data.size();
+    std::vector<std::int32_t> head(size_t(1) << HASH_BITS, -1);
+    std::vector<std::int32_t> previous(WINDOW_SIZE, -1);
+
+    auto insert = [&](size_t pos) {
+        std::uint32_t h = hash3(&data[pos]);
+        previous[pos & (WINDOW_SIZE - 1)] = head[h];
+        head[h] = static_cast<std::int32_t>(pos);
+    };
+
+    size_t pos = 0;
+    while (pos < size) {
+        int bestLength = 0;
+        int bestDistance = 0;
+
+        if (pos + MIN_MATCH <= size) {
+            int maxLength = static_cast<int>(std::min<size_t>(MAX_MATCH, size - pos));
+            std::int32_t candidate = head[hash3(&data[pos])];
+            for (int chain = 0; chain < MAX_CHAIN && candidate >= 0; ++chain) {
+                size_t distance = pos - static_cast<size_t>(candidate);
+                if (distance > WINDOW_SIZE - 1) break;
+
+                const std::uint8_t* a = &data[candidate];
+                const std::uint8_t* b = &data[pos];
+                int length = 0;
+                while (length < maxLength && a[length] == b[length]) ++length;
+                if (length > bestLength) {
+                    bestLength = length;
+                    bestDistance = static_cast<int>(distance);
+                    if (length == maxLength) break;
+                }
+
+                std::int32_t next = previous[candidate & (WINDOW_SIZE - 1)];
+                if (next >= candidate) break;  // Slot reused by a newer position
+                candidate = next;
+            }
+        }
+
+        if (bestLength >= MIN_MATCH) {
+            putMatch(bits, bestLength, bestDistance);
+            size_t end = pos + bestLength;
+            for (; pos < end; ++pos) {
+                if (pos + MIN_MATCH <= size) insert(pos);
+            }
+        } else {
+            putFixedSymbol(bits, data[pos]);
+            if (pos + MIN_MATCH <= size) insert(pos);
+            ++pos;
+        }
+    }
+
+    putFixedSymbol(bits, 256);  // End of block
+    bits.flush();
+    putBigEndian(out, adler32(data.data(), size));
+}
+
+void appendChunk(std::vector<std::uint8_t>& png, const char type[4], const std::vector<std::uint8_t>& payload) {
+    putBigEndian(png, static_cast<std::uint32_t>(payload.size()));
+    size_t typeStart = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), payload.begin(), payload.end());
+    putBigEndian(png, crc32(&png[typeStart], payload.size() + 4));
+}
+
+/// Sum of absolute filtered bytes (as signed), the usual filter-choice heuristic
+size_t filterCost(const std::uint8_t* row, size_t bytes) {
+    size_t cost = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        cost += static_cast<size_t>(std::abs(static_cast<int>(static_cast<std::int8_t>(row[i]))));
+    }
+    return cost;
+}
+
+// ===== GIF =====
+
+constexpr int GIF_COLOR_BITS = 8;        ///< Palette size 2^8, also the LZW minimum code size
+constexpr std::uint32_t GIF_CLEAR = 1u << GIF_COLOR_BITS;
+constexpr std::uint32_t GIF_END = GIF_CLEAR + 1;
+constexpr std::uint32_t GIF_MAX_CODE = 4095;
+constexpr int LZW_HASH_SIZE = 5003;      ///< Prime a little over the 4096-entry dictionary
+
+constexpr size_t BIN_COUNT = 1 << 15;    ///< 5 bits per channel
+
+std::uint32_t binOf(const std::uint8_t* pixel) {
+    return (static_cast<std::uint32_t>(pixel[0] >> 3) << 10) | ((pixel[1] >> 3) << 5) | (pixel[2] >> 3);
+}
+
+void putLittleEndian16(std::FILE* file, int value) {
+    std::fputc(value & 0xFF, file);
+    std::fputc((value >> 8) & 0xFF, file);
+}
+
+} // namespace
+
+// ===== PNG =====
+
+std::vector<std::uint8_t> encodePng(const std::uint8_t* rgba, int width, int height) {
+    size_t rowBytes = static_cast<size_t>(width) * 3;
+    std::vector<std::uint8_t> raw(static_cast<size_t>(height) * (rowBytes + 1));
+    std::vector<std::uint8_t> current(rowBytes);
+    std::vector<std::uint8_t> above(rowBytes, 0);
+    std::vector<std::uint8_t> sub(rowBytes);
+    std::vector<std::uint8_t> up(rowBytes);
+
+    for (int y = 0; y < height; ++y) {
+        const std::uint8_t* src = rgba + static_cast<size_t>(y) * width * 4;
+        for (int x = 0; x < width; ++x) {
+            std::memcpy(&current[static_cast<size_t>(x) * 3], &src[static_cast<size_t>(x) * 4], 3);
+        }
+
+        // Sub suits horizontal runs, Up suits rows that repeat the one above
+        for (size_t i = 0; i < rowBytes; ++i) {
+            sub[i] = static_cast<std::uint8_t>(current[i] - (i >= 3 ? current[i - 3] : 0));
+            up[i] = static_cast<std::uint8_t>(current[i] - above[i]);
+        }
+        bool useUp = y > 0 && filterCost(up.data(), rowBytes) < filterCost(sub.data(), rowBytes);
+
+        std::uint8_t* dst = &raw[static_cast<size_t>(y) * (rowBytes + 1)];
+        dst[0] = useUp ? 2 : 1;
+        std::memcpy(dst + 1, useUp ? up.data() : sub.data(), rowBytes);
+        current.swap(above);
+    }
+
+    std::vector<std::uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    std::vector<std::uint8_t> header;
+    putBigEndian(header, static_cast<std::uint32_t>(width));
+    putBigEndian(header, static_cast<std::uint32_t>(height));
+    header.push_back(8);   // Bit depth
+    header.push_back(2);   // Truecolor
+    header.push_back(0);   // Deflate
+    header.push_back(0);   // Adaptive filtering
+    header.push_back(0);   // No interlace
+    appendChunk(png, "IHDR", header);
+
+    std::vector<std::uint8_t> compressed;
+    compressed.reserve(raw.size() / 8);
+    deflate(raw, compressed);
+    appendChunk(png, "IDAT", compressed);
+    appendChunk(png, "IEND", {});
+    return png;
+}
+
+bool writePng(const std::string& path, const std::uint8_t* rgba, int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    std::vector<std::uint8_t> png = encodePng(rgba, width, height);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = std::fwrite(png.data(), 1, png.size(), file) == png.size();
+    ok = std::fclose(file) == 0 && ok;
+    return ok;
+}
+
+// ===== GifWriter =====
+
+GifWriter::~GifWriter() {
+    close();
+}
+
+bool GifWriter::open(const std::string& path, int width, int height) {
+    if (m_file != nullptr || width <= 0 || height <= 0 || width > 0xFFFF || height > 0xFFFF) {
+        return false;
+    }
+    m_file = std::fopen(path.c_str(), "wb");
+    if (m_file == nullptr) {
+        return false;
+    }
+    m_width = width;
+    m_height = height;
+    m_failed = false;
+
+    std::fputs("GIF89a", m_file);
+    putLittleEndian16(m_file, width);
+    putLittleEndian16(m_file, height);
+    std::fputc(0x00, m_file);  // No global color table: every frame brings its own
+    std::fputc(0x00, m_file);  // Background color index
+    std::fputc(0x00, m_file);  // Square pixels
+
+    // NETSCAPE2.0 application extension: loop forever
+    const std::uint8_t loop[] = {0x21, 0xFF, 0x0B, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0',
+                                 0x03, 0x01, 0x00, 0x00, 0x00};
+    std::fwrite(loop, 1, sizeof(loop), m_file);
+    return true;
+}
+
+bool GifWriter::addFrame(const std::uint8_t* rgba, int delayCentiseconds) {
+    if (m_file == nullptr) {
+        return false;
+    }
+
+    quantize(rgba);
+
+    // Graphic control extension: frame delay, no transparency
+    std::fputc(0x21, m_file);
+    std::fputc(0xF9, m_file);
+    std::fputc(0x04, m_file);
+    std::fputc(0x04, m_file);  // Leave the frame in place when the next one is drawn
+    putLittleEndian16(m_file, std::clamp(delayCentiseconds, 0, 0xFFFF));
+    std::fputc(0x00, m_file);
+    std::fputc(0x00, m_file);
+
+    // Image descriptor with a 256-entry local color table
+    std::fputc(0x2C, m_file);
+    putLittleEndian16(m_file, 0);
+    putLittleEndian16(m_file, 0);
+    putLittleEndian16(m_file, m_width);
+    putLittleEndian16(m_file, m_height);
+    std::fputc(0x80 | (GIF_COLOR_BITS - 1), m_file);
+    std::fwrite(m_palette, 1, sizeof(m_palette), m_file);
+
+    writeImageData();
+
+    if (std::ferror(m_file)) {
+        m_failed = true;
+    }
+    return !m_failed;
+}
+
+bool GifWriter::close() {
+    if (m_file == nullptr) {
+        return !m_failed;
+    }
+    std::fputc(0x3B, m_file);  // Trailer
+    if (std::ferror(m_file)) {
+        m_failed = true;
+    }
+    if (std::fclose(m_file) != 0) {
+        m_failed = true;
+    }
+    m_file = nullptr;
+    return !m_failed;
+}
+
+void GifWriter::quantize(const std::uint8_t* rgba) {
+    size_t pixels = static_cast<size_t>(m_width) * m_height;
+    m_histogram.assign(BIN_COUNT, 0);
+    m_binSums.assign(BIN_COUNT * 3, 0);
+    m_binIndex.resize(BIN_COUNT);
+    m_occupied.clear();
+
+    for (size_t i = 0; i < pixels; ++i) {
+        const std::uint8_t* pixel = rgba + i * 4;
+        std::uint32_t bin = binOf(pixel);
+        if (m_histogram[bin]++ == 0) {
+            m_occupied.push_back(bin);
+        }
+        m_binSums[bin * 3] += pixel[0];
+        m_binSums[bin * 3 + 1] += pixel[1];
+        m_binSums[bin * 3 + 2] += pixel[2];
+    }
+
+    // Most populated bins become the palette, at their mean color
+    size_t paletteSize = std::min<size_t>(m_occupied.size(), 256);
+    std::vector<std::uint32_t> ranked = m_occupied;
+    std::partial_sort(ranked.begin(), ranked.begin() + paletteSize, ranked.end(),
+                      [this](std::uint32_t a, std::uint32_t b) { return m_histogram[a] > m_histogram[b]; });
+    std::memset(m_palette, 0, sizeof(m_palette));
+    for (size_t p = 0; p < paletteSize; ++p) {
+        std::uint32_t bin = ranked[p];
+        for (int c = 0; c < 3; ++c) {
+            m_palette[p * 3 + c] = static_cast<std::uint8_t>(m_binSums[bin * 3 + c] / m_histogram[bin]);
+        }
+    }
+
+    // Remaining bins map to the nearest palette color
+    for (std::uint32_t bin : m_occupied) {
+        int r = static_cast<int>(m_binSums[bin * 3] / m_histogram[bin]);
+        int g = static_cast<int>(m_binSums[bin * 3 + 1] / m_histogram[bin]);
+        int b = static_cast<int>(m_binSums[bin * 3 + 2] / m_histogram[bin]);
+        int best = 0;
+        int bestDistance = 1 << 30;
+        for (size_t p = 0; p < paletteSize; ++p) {
+            int dr = r - m_palette[p * 3];
+            int dg = g - m_palette[p * 3 + 1];
+            int db = b - m_palette[p * 3 + 2];
+            int distance = dr * dr + dg * dg + db * db;
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                best = static_cast<int>(p);
+                if (distance == 0) break;
+            }
+        }
+        m_binIndex[bin] = static_cast<std::uint8_t>(best);
+    }
+
+    m_indices.resize(pixels);
+    for (size_t i = 0; i < pixels; ++i) {
+        m_indices[i] = m_binIndex[binOf(rgba + i * 4)];
+    }
+}
+
+void GifWriter::writeImageData() {
+    m_encoded.clear();
+    BitWriter bits(m_encoded);
+
+    std::vector<std::int32_t> keys(LZW_HASH_SIZE, -1);
+    std::vector<std::uint16_t> codes(LZW_HASH_SIZE, 0);
+    int codeSize = GIF_COLOR_BITS + 1;
+    std::uint32_t nextCode = GIF_END + 1;
+
+    bits.put(GIF_CLEAR, codeSize);
+
+    std::uint32_t prefix = m_indices.empty() ? 0 : m_indices[0];
+    for (size_t i = 1; i < m_indices.size(); ++i) {
+        std::uint32_t symbol = m_indices[i];
+        std::int32_t key = static_cast<std::int32_t>((prefix << 8) | symbol);
+
+        // Open addressing with a secondary step, as in Unix compress
+        int slot = static_cast<int>(((symbol << 4) ^ prefix) % LZW_HASH_SIZE);
+        int step = slot == 0 ? 1 : LZW_HASH_SIZE - slot;
+        while (keys[slot] != -1 && keys[slot] != key) {
+            slot -= step;
+            if (slot < 0) slot += LZW_HASH_SIZE;
+        }
+        if (keys[slot] == key) {
+            prefix = codes[slot];
+            continue;
+        }
+
+        bits.put(prefix, codeSize);
+        keys[slot] = key;
+        codes[slot] = static_cast<std::uint16_t>(nextCode);
+        if (nextCode >= (1u << codeSize)) {
+            codeSize++;
+        }
+        if (nextCode == GIF_MAX_CODE) {
+            // Dictionary full: start over
+            bits.put(GIF_CLEAR, codeSize);
+            std::fill(keys.begin(), keys.end(), -1);
+            codeSize = GIF_COLOR_BITS + 1;
+            nextCode = GIF_END + 1;
+        } else {
+            nextCode++;
+        }
+        prefix = symbol;
+    }
+
+    bits.put(prefix, codeSize);
+    bits.put(GIF_END, codeSize);
+    bits.flush();
+
+    std::fputc(GIF_COLOR_BITS, m_file);  // LZW minimum code size
+    for (size_t offset = 0; offset < m_encoded.size(); offset += 255) {
+        size_t length = std::min<size_t>(255, m_encoded.size() - offset);
+        std::fputc(static_cast<int>(length), m_file);
+        std::fwrite(&m_encoded[offset], 1, length, m_file);
+    }
+    std::fputc(0x00, m_file);  // Block terminator
+}
+
+} // namespace dsav::image
@@ -0,0 +1,179 @@
+/**
+ * @file job_system.cpp
+ * @brief Implementation of the worker pool and its completion queues
+ */
+
+#include "job_system.hpp"
+#include "profiler.hpp"
+#include "spsc_queue.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dsav::jobs {
+
+namespace {
+
+/// Upper bound on workers; the render thread keeps a core to itself
+constexpr size_t MAX_WORKERS = 4;
+
+/// Finished jobs a worker can hand back before it waits for the next frame
+constexpr size_t OUTBOX_CAPACITY = 64;
+
+struct Finished {
+    JobHandle token;
+    JobCompletion completion;
+};
+
+struct Queued {
+    JobHandle token;
+    JobWork work;
+};
+
+} // namespace
+
+/**
+ * @brief Worker pool: a locked inbox shared by all workers, one SPSC outbox each
+ *
+ * Submission only happens a few times per user action, so the inbox is a
+ * plain mutex/condvar queue. Results flow every frame, so each worker owns
+ * a lock-free outbox with itself as the only producer and the render thread
+ * as the only consumer.
+ */
+class Scheduler {
+public:
+    static Scheduler& instance() {
+        static Scheduler scheduler;
+        return scheduler;
+    }
+
+    ~Scheduler() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    JobHandle submit(JobWork work) {
+        start();
+
+        auto token = std::make_shared<JobToken>();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inbox.push_back({token, std::move(work)});
+        }
+        m_pending++;
+        m_wake.notify_one();
+        return token;
+    }
+
+    void runCompletions(size_t maxCompletions) {
+        size_t ran = 0;
+        for (auto& outbox : m_outboxes) {
+            while (ran < maxCompletions) {
+                std::optional<Finished> finished = outbox->tryPop();
+                if (!finished) break;
+
+                if (!finished->token->isCancelled() && finished->completion) {
+                    finished->completion();
+                }
+                finished->token->m_done = true;
+                m_pending--;
+                ran++;
+            }
+        }
+    }
+
+    void setCompletionListener(void (*listener)()) { m_listener.store(listener, std::memory_order_release); }
+
+    size_t workerCount() const { return m_threads.size(); }
+    size_t pendingCount() const { return m_pending; }
+
+private:
+    Scheduler() = default;
+
+    void start() {
+        if (!m_threads.empty()) {
+            return;
+        }
+
+        size_t hardware = std::thread::hardware_concurrency();
+        size_t count = std::clamp<size_t>(hardware > 1 ? hardware - 1 : 1, 1, MAX_WORKERS);
+        for (size_t i = 0; i < count; ++i) {
+            m_outboxes.push_back(std::make_unique<SpscQueue<Finished>>(OUTBOX_CAPACITY));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            m_threads.emplace_back([this, i]() { workerLoop(*m_outboxes[i]); });
+        }
+    }
+
+    void workerLoop(SpscQueue<Finished>& outbox) {
+        for (;;) {
+            Queued job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this]() { return m_stopping || !m_inbox.empty(); });
+                if (m_stopping) return;
+                job = std::move(m_inbox.front());
+                m_inbox.pop_front();
+            }
+
+            // Cancelled before it started: skip the work, still report it so the token settles
+            JobCompletion completion;
+            if (!job.token->isCancelled()) {
+                DSAV_PROFILE_SCOPE("Job");
+                completion = job.work(*job.token);
+            }
+
+            Finished finished{std::move(job.token), std::move(completion)};
+            while (!outbox.tryPush(std::move(finished))) {
+                if (m_stopping) return;
+                std::this_thread::yield();
+            }
+            if (auto listener = m_listener.load(std::memory_order_acquire)) {
+                listener();
+            }
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::vector<std::unique_ptr<SpscQueue<Finished>>> m_outboxes;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<Queued> m_inbox;
+    std::atomic<bool> m_stopping{false};
+    std::atomic<void (*)()> m_listener{nullptr};   ///< Called after each completion is posted
+
+    size_t m_pending = 0;     ///< Submitted but not yet drained (main thread only)
+};
+
+JobHandle submit(JobWork work) {
+    return Scheduler::instance().submit(std::move(work));
+}
+
+void runCompletions(size_t maxCompletions) {
+    Scheduler::instance().runCompletions(maxCompletions);
+}
+
+void setCompletionListener(void (*listener)()) {
+    Scheduler::instance().setCompletionListener(listener);
+}
+
+size_t workerCount() {
+    return Scheduler::instance().workerCount();
+}
+
+size_t pendingCount() {
+    return Scheduler::instance().pendingCount();
+}
+
+} // namespace dsav::jobs
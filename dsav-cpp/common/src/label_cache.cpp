@@ -0,0 +1,169 @@
+/**
+ * @file label_cache.cpp
+ * @brief Implementation of the interned label cache
+ */
+
+#include "label_cache.hpp"
+#include <charconv>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dsav::labels {
+
+namespace {
+
+/**
+ * @brief Measured sizes of every label for one font at one size
+ */
+struct ExtentTable {
+    const ImFont* font = nullptr;
+    float fontSize = 0.0f;
+    std::vector<ImVec2> sizes;
+    std::vector<std::uint8_t> measured;
+};
+
+struct Cache {
+    std::deque<std::string> texts{std::string()};          ///< Indexed by LabelId; deque keeps c_str() stable
+    std::unordered_map<std::string, LabelId> byText;
+    std::vector<LabelId> smallInts = std::vector<LabelId>(SMALL_INT_MAX - SMALL_INT_MIN + 1, NO_LABEL);
+    std::unordered_map<int, LabelId> largeInts;
+    std::vector<LabelId> indices;
+    std::vector<ExtentTable> extents;
+    size_t lastExtent = 0;                                  ///< Table used by the previous textSize()
+};
+
+Cache& cache() {
+    static Cache instance;
+    return instance;
+}
+
+LabelId store(Cache& c, std::string text) {
+    LabelId id = static_cast<LabelId>(c.texts.size());
+    c.byText.emplace(text, id);
+    c.texts.push_back(std::move(text));
+    return id;
+}
+
+LabelId internInt(int value) {
+    char buffer[16];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return intern(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+}
+
+ExtentTable& currentExtents(Cache& c) {
+    const ImFont* font = ImGui::GetFont();
+    float fontSize = ImGui::GetFontSize();
+
+    if (c.lastExtent < c.extents.size()) {
+        ExtentTable& last = c.extents[c.lastExtent];
+        if (last.font == font && last.fontSize == fontSize) {
+            return last;
+        }
+    }
+
+    for (size_t i = 0; i < c.extents.size(); ++i) {
+        if (c.extents[i].font == font && c.extents[i].fontSize == fontSize) {
+            c.lastExtent = i;
+            return c.extents[i];
+        }
+    }
+
+    ExtentTable table;
+    table.font = font;
+    table.fontSize = fontSize;
+    c.extents.push_back(std::move(table));
+    c.lastExtent = c.extents.size() - 1;
+    return c.extents.back();
+}
+
+} // namespace
+
+LabelId intern(std::string_view text) {
+    if (text.empty()) return NO_LABEL;
+
+    Cache& c = cache();
+    std::string key(text);
+    auto it = c.byText.find(key);
+    if (it != c.byText.end()) {
+        return it->second;
+    }
+    return store(c, std::move(key));
+}
+
+LabelId fromInt(int value) {
+    Cache& c = cache();
+
+    if (value >= SMALL_INT_MIN && value <= SMALL_INT_MAX) {
+        LabelId& slot = c.smallInts[static_cast<size_t>(value - SMALL_INT_MIN)];
+        if (slot == NO_LABEL) {
+            slot = internInt(value);
+        }
+        return slot;
+    }
+
+    auto it = c.largeInts.find(value);
+    if (it != c.largeInts.end()) {
+        return it->second;
+    }
+    LabelId id = internInt(value);
+    c.largeInts.emplace(value, id);
+    return id;
+}
+
+LabelId fromIndex(size_t index) {
+    Cache& c = cache();
+
+    if (index >= c.indices.size()) {
+        c.indices.resize(index + 1, NO_LABEL);
+    }
+    LabelId& slot = c.indices[index];
+    if (slot == NO_LABEL) {
+        slot = intern("[" + std::to_string(index) + "]");
+    }
+    return slot;
+}
+
+const char* text(LabelId id) {
+    Cache& c = cache();
+    return id < c.texts.size() ? c.texts[id].c_str() : "";
+}
+
+ImVec2 textSize(LabelId id) {
+    Cache& c = cache();
+    if (id == NO_LABEL || id >= c.texts.size()) return ImVec2(0.0f, 0.0f);
+
+    ExtentTable& table = currentExtents(c);
+    if (id >= table.sizes.size()) {
+        table.sizes.resize(c.texts.size());
+        table.measured.resize(c.texts.size(), 0);
+    }
+    if (!table.measured[id]) {
+        const std::string& s = c.texts[id];
+        table.sizes[id] = ImGui::CalcTextSize(s.c_str(), s.c_str() + s.size());
+        table.measured[id] = 1;
+    }
+    return table.sizes[id];
+}
+
+void draw(ImDrawList* drawList, const ImVec2& pos, ImU32 color, LabelId id) {
+    Cache& c = cache();
+    if (!drawList || id == NO_LABEL || id >= c.texts.size()) return;
+
+    const std::string& s = c.texts[id];
+    drawList->AddText(pos, color, s.c_str(), s.c_str() + s.size());
+}
+
+void drawCentered(ImDrawList* drawList, const ImVec2& center, ImU32 color, LabelId id) {
+    if (!drawList || id == NO_LABEL) return;
+
+    ImVec2 size = textSize(id);
+    draw(drawList, ImVec2(center.x - size.x * 0.5f, center.y - size.y * 0.5f), color, id);
+}
+
+size_t count() {
+    return cache().texts.size() - 1;
+}
+
+} // namespace dsav::labels
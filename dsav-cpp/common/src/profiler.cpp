@@ -0,0 +1,248 @@
+/**
+ * @file profiler.cpp
+ * @brief Per-thread scope rings, frame aggregation and the allocation counter
+ */
+
+#include "profiler.hpp"
+
+#if DSAV_PROFILER
+
+#include "spsc_queue.hpp"
+#include "trace_writer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+// ===== Allocation Counter =====
+// Replacing the global operator new is the only way to see allocations made
+// inside ImGui and the standard library. The array and nothrow forms forward
+// here by default, so these three cover every non-aligned allocation.
+
+namespace {
+std::atomic<std::uint64_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace dsav::profiler {
+
+namespace {
+
+// ===== Thread Rings =====
+
+/**
+ * @brief Scope ring owned by one thread (producer) and drained by endFrame (consumer)
+ */
+struct ThreadBuffer {
+    explicit ThreadBuffer(std::uint32_t id) : index(id), records(THREAD_BUFFER_RECORDS) {}
+
+    std::uint32_t index;
+    SpscQueue<ScopeRecord> records;
+    std::atomic<std::uint64_t> dropped{0};
+};
+
+/**
+ * @brief Every thread that ever recorded a scope
+ *
+ * Buffers outlive their threads, so a worker that exits never leaves the
+ * render thread reading freed memory. The lock is only taken to register a
+ * thread and to walk the list in endFrame().
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+// Never destroyed: workers may still record while static destructors run
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer& threadBuffer() {
+    if (t_buffer == nullptr) {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(reg.buffers.size())));
+        t_buffer = reg.buffers.back().get();
+    }
+    return *t_buffer;
+}
+
+// ===== Frame Aggregation (render thread) =====
+
+FrameStats g_stats;
+std::unordered_map<std::string_view, size_t> g_scopeIndex;  ///< Name -> g_stats.scopes index
+std::vector<float> g_scopeMs;                               ///< Time per scope this frame
+std::vector<std::uint32_t> g_scopeCalls;                    ///< Calls per scope this frame
+std::array<float, FRAME_HISTORY> g_scratch{};               ///< Workspace for percentiles
+std::uint64_t g_lastFrameNs = 0;
+std::uint64_t g_lastAllocations = 0;
+bool g_newScopes = false;                                   ///< A scope was seen for the first time
+
+void accumulate(const ScopeRecord& scope, std::uint32_t thread) {
+    std::string_view name(scope.name);
+    auto [it, inserted] = g_scopeIndex.try_emplace(name, g_stats.scopes.size());
+    if (inserted) {
+        ScopeStats stats;
+        stats.name = name;
+        stats.depth = scope.depth;
+        stats.thread = thread;
+        stats.firstStartNs = scope.startNs;
+        g_stats.scopes.push_back(stats);
+        g_scopeMs.push_back(0.0f);
+        g_scopeCalls.push_back(0);
+        g_newScopes = true;
+    }
+    g_scopeMs[it->second] += static_cast<float>(scope.endNs - scope.startNs) * 1e-6f;
+    g_scopeCalls[it->second]++;
+
+    if (trace::isActive()) {
+        trace::TraceEvent event;
+        event.name = scope.name;
+        event.category = "frame";
+        event.phase = trace::Phase::Complete;
+        event.track = thread;
+        event.timestampNs = scope.startNs;
+        event.durationNs = scope.endNs - scope.startNs;
+        trace::emit(event);
+    }
+}
+
+void drainThreads() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& buffer : reg.buffers) {
+        while (auto scope = buffer->records.tryPop()) {
+            accumulate(*scope, buffer->index);
+        }
+        g_stats.droppedRecords += buffer->dropped.exchange(0, std::memory_order_relaxed);
+    }
+}
+
+float average(const float* values, size_t count) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        sum += values[i];
+    }
+    return count > 0 ? sum / static_cast<float>(count) : 0.0f;
+}
+
+float percentile99(const float* values, size_t count) {
+    if (count == 0) {
+        return 0.0f;
+    }
+    std::copy(values, values + count, g_scratch.begin());
+    size_t rank = std::min(count - 1, count * 99 / 100);
+    std::nth_element(g_scratch.begin(), g_scratch.begin() + rank, g_scratch.begin() + count);
+    return g_scratch[rank];
+}
+
+} // namespace
+
+std::uint64_t nowNs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void record(const ScopeRecord& scope) {
+    ThreadBuffer& buffer = threadBuffer();
+    ScopeRecord copy = scope;
+    if (!buffer.records.tryPush(std::move(copy))) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void endFrame() {
+    std::uint64_t now = nowNs();
+    std::uint64_t allocations = g_allocations.load(std::memory_order_relaxed);
+
+    std::fill(g_scopeMs.begin(), g_scopeMs.end(), 0.0f);
+    std::fill(g_scopeCalls.begin(), g_scopeCalls.end(), 0u);
+    drainThreads();
+
+    // The first call only starts the clock; scopes before it are discarded
+    if (g_lastFrameNs == 0) {
+        g_lastFrameNs = now;
+        g_lastAllocations = allocations;
+        return;
+    }
+
+    size_t slot = g_stats.next;
+    g_stats.frameMs[slot] = static_cast<float>(now - g_lastFrameNs) * 1e-6f;
+    g_stats.allocations[slot] = static_cast<std::uint32_t>(allocations - g_lastAllocations);
+    g_lastFrameNs = now;
+    g_lastAllocations = allocations;
+
+    for (size_t i = 0; i < g_stats.scopes.size(); ++i) {
+        g_stats.scopes[i].frameMs[slot] = g_scopeMs[i];
+        g_stats.scopes[i].callsLastFrame = g_scopeCalls[i];
+    }
+
+    // Scopes are recorded when they close, so children arrive before their
+    // parents; keep the table in start order instead
+    if (g_newScopes) {
+        std::stable_sort(g_stats.scopes.begin(), g_stats.scopes.end(),
+            [](const ScopeStats& a, const ScopeStats& b) {
+                if (a.thread != b.thread) {
+                    return a.thread < b.thread;
+                }
+                return a.firstStartNs < b.firstStartNs;
+            });
+        for (size_t i = 0; i < g_stats.scopes.size(); ++i) {
+            g_scopeIndex[g_stats.scopes[i].name] = i;
+        }
+        g_newScopes = false;
+    }
+
+    g_stats.next = (slot + 1) % FRAME_HISTORY;
+    g_stats.frameCount = std::min(g_stats.frameCount + 1, FRAME_HISTORY);
+
+    size_t count = g_stats.frameCount;
+    g_stats.averageMs = average(g_stats.frameMs.data(), count);
+    g_stats.p99Ms = percentile99(g_stats.frameMs.data(), count);
+
+    std::uint64_t allocationSum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        allocationSum += g_stats.allocations[i];
+    }
+    g_stats.averageAllocations = static_cast<float>(allocationSum) / static_cast<float>(count);
+
+    for (auto& scope : g_stats.scopes) {
+        scope.averageMs = average(scope.frameMs.data(), count);
+        scope.p99Ms = percentile99(scope.frameMs.data(), count);
+    }
+}
+
+void setDrawStats(const DrawStats& stats) {
+    g_stats.draw = stats;
+}
+
+const FrameStats& frameStats() {
+    return g_stats;
+}
+
+} // namespace dsav::profiler
+
+#endif // DSAV_PROFILER
@@ -0,0 +1,129 @@
+/**
+ * @file profiler_overlay.cpp
+ * @brief Implementation of the profiler window
+ */
+
+#include "profiler_overlay.hpp"
+#include "color_scheme.hpp"
+#include "trace_writer.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace dsav::profiler {
+
+#if DSAV_PROFILER
+
+void captureDrawData(const ImDrawData* drawData) {
+    if (drawData == nullptr) {
+        return;
+    }
+
+    DrawStats stats;
+    stats.drawLists = static_cast<size_t>(drawData->CmdListsCount);
+    stats.vertices = static_cast<size_t>(drawData->TotalVtxCount);
+    stats.indices = static_cast<size_t>(drawData->TotalIdxCount);
+    for (int i = 0; i < drawData->CmdListsCount; ++i) {
+        stats.commands += static_cast<size_t>(drawData->CmdLists[i]->CmdBuffer.Size);
+    }
+    setDrawStats(stats);
+}
+
+void renderOverlay(bool* open) {
+    ImGui::SetNextWindowSize(ImVec2(460, 0), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Profiler", open)) {
+        ImGui::End();
+        return;
+    }
+
+    const FrameStats& stats = frameStats();
+    if (stats.frameCount == 0) {
+        ImGui::TextDisabled("Collecting frames...");
+        ImGui::End();
+        return;
+    }
+
+    size_t latest = (stats.next + FRAME_HISTORY - 1) % FRAME_HISTORY;
+    float lastMs = stats.frameMs[latest];
+
+    // ===== Frame Time =====
+
+    ImGui::Text("Frame: %.2f ms   avg %.2f ms   p99 %.2f ms   (%.0f FPS)",
+                lastMs, stats.averageMs, stats.p99Ms,
+                stats.averageMs > 0.0f ? 1000.0f / stats.averageMs : 0.0f);
+
+    // Ring is in order until it fills, then starts at stats.next
+    int offset = stats.frameCount == FRAME_HISTORY ? static_cast<int>(stats.next) : 0;
+    float scaleMax = std::max(stats.p99Ms * 1.25f, 20.0f);
+    char label[32];
+    std::snprintf(label, sizeof(label), "%.1f ms", lastMs);
+    ImGui::PlotLines("##FrameTimes", stats.frameMs.data(), static_cast<int>(stats.frameCount),
+                     offset, label, 0.0f, scaleMax, ImVec2(-1, 80));
+
+    // ===== Scopes =====
+
+    ImGui::Separator();
+    ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV;
+    if (!stats.scopes.empty() && ImGui::BeginTable("##Scopes", 5, flags)) {
+        ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Avg ms");
+        ImGui::TableSetupColumn("p99 ms");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableHeadersRow();
+
+        for (const auto& scope : stats.scopes) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%*s%.*s", static_cast<int>(scope.depth * 2), "",
+                        static_cast<int>(scope.name.size()), scope.name.data());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", scope.averageMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", scope.p99Ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", scope.callsLastFrame);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", scope.thread);
+        }
+        ImGui::EndTable();
+    }
+
+    // ===== Geometry and Allocations =====
+
+    ImGui::Separator();
+    ImGui::Text("Draw lists: %zu   Commands: %zu", stats.draw.drawLists, stats.draw.commands);
+    ImGui::Text("Vertices: %zu   Indices: %zu", stats.draw.vertices, stats.draw.indices);
+    ImGui::Text("Allocations: %u last frame, %.1f avg", stats.allocations[latest], stats.averageAllocations);
+    if (stats.droppedRecords > 0) {
+        ImGui::TextColored(colors::toImGui(colors::mocha::red),
+            "Dropped scopes: %llu (a thread ring filled up)",
+            static_cast<unsigned long long>(stats.droppedRecords));
+    }
+
+    // ===== Trace Capture =====
+
+    if (trace::isActive()) {
+        ImGui::Separator();
+        ImGui::Text("Tracing to %s", trace::path().c_str());
+        ImGui::Text("Events written: %llu   Dropped: %llu",
+            static_cast<unsigned long long>(trace::writtenEvents()),
+            static_cast<unsigned long long>(trace::droppedEvents()));
+    }
+
+    ImGui::End();
+}
+
+#else
+
+void captureDrawData(const ImDrawData*) {}
+
+void renderOverlay(bool* open) {
+    if (ImGui::Begin("Profiler", open)) {
+        ImGui::TextWrapped("Profiling was compiled out. Reconfigure with -DENABLE_PROFILER=ON.");
+    }
+    ImGui::End();
+}
+
+#endif
+
+} // namespace dsav::profiler
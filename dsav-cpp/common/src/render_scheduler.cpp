@@ -0,0 +1,133 @@
+/**
+ * @file render_scheduler.cpp
+ * @brief Implementation of the main loop render scheduler
+ */
+
+#include "render_scheduler.hpp"
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace dsav {
+
+namespace {
+
+/// Sleep this much short of a frame slot and yield for the rest (sleep overshoots)
+constexpr double PACING_SPIN_SECONDS = 0.001;
+
+/// A wait that returned this much before its timeout was ended by an event
+constexpr double WAKE_TOLERANCE = 0.9;
+
+constexpr int MAX_FPS_LIMIT = 1000;
+
+} // namespace
+
+RenderScheduler::RenderScheduler(const RenderSchedulerConfig& config)
+    : m_config(config), m_settleRemaining(config.settleFrames) {
+    m_lastFrame = glfwGetTime();
+    m_nextSlot = m_lastFrame;
+}
+
+float RenderScheduler::beginFrame(bool active) {
+    bool wait = m_config.idleThrottling && !active && m_settleRemaining <= 0;
+    m_idle = wait;
+
+    if (wait) {
+        double before = glfwGetTime();
+        glfwWaitEventsTimeout(m_config.idleTimeout);
+        if (glfwGetTime() - before < m_config.idleTimeout * WAKE_TOLERANCE) {
+            // Woken by input or wake(): give ImGui a few frames to react
+            m_settleRemaining = m_config.settleFrames;
+        }
+    } else {
+        if (!m_unpaced) {
+            paceFrame();
+        }
+        glfwPollEvents();
+        if (m_settleRemaining > 0) {
+            m_settleRemaining--;
+        }
+    }
+
+    double now = glfwGetTime();
+    float deltaTime = static_cast<float>(now - m_lastFrame);
+    m_lastFrame = now;
+    return std::min(deltaTime, MAX_FRAME_DELTA);
+}
+
+void RenderScheduler::requestFrames(int count) {
+    m_settleRemaining = std::max(m_settleRemaining, count);
+}
+
+void RenderScheduler::wake() {
+    glfwPostEmptyEvent();
+}
+
+void RenderScheduler::setMaxFps(int maxFps) {
+    m_config.maxFps = std::clamp(maxFps, 0, MAX_FPS_LIMIT);
+    m_nextSlot = glfwGetTime();
+}
+
+void RenderScheduler::setIdleThrottling(bool enabled) {
+    m_config.idleThrottling = enabled;
+    requestFrames(m_config.settleFrames);
+}
+
+void RenderScheduler::paceFrame() {
+    if (m_config.maxFps <= 0) {
+        return;  // vsync paces the swap
+    }
+
+    double period = 1.0 / m_config.maxFps;
+    double now = glfwGetTime();
+    if (m_nextSlot - now > PACING_SPIN_SECONDS) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(m_nextSlot - now - PACING_SPIN_SECONDS));
+    }
+    while (glfwGetTime() < m_nextSlot) {
+        std::this_thread::yield();
+    }
+
+    // Fixed slots keep the cadence even; after a stall start over from now
+    now = glfwGetTime();
+    m_nextSlot += period;
+    if (m_nextSlot < now) {
+        m_nextSlot = now + period;
+    }
+}
+
+bool parseRenderSchedulerArgs(int argc, char** argv, RenderSchedulerConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--no-idle-throttle") == 0) {
+            config.idleThrottling = false;
+        } else if (std::strcmp(arg, "--max-fps") == 0) {
+            char* end = nullptr;
+            long fps = hasValue ? std::strtol(argv[i + 1], &end, 10) : -1;
+            if (!hasValue || *end != '\0' || fps < 0 || fps > MAX_FPS_LIMIT) {
+                std::cerr << "--max-fps expects 0 (vsync) to " << MAX_FPS_LIMIT << "\n";
+                return false;
+            }
+            config.maxFps = static_cast<int>(fps);
+            ++i;
+        } else if (std::strcmp(arg, "--idle-timeout") == 0) {
+            char* end = nullptr;
+            double seconds = hasValue ? std::strtod(argv[i + 1], &end) : -1.0;
+            if (!hasValue || *end != '\0' || !(seconds > 0.0)) {
+                std::cerr << "--idle-timeout expects a positive number of seconds\n";
+                return false;
+            }
+            config.idleTimeout = seconds;
+            ++i;
+        }
+    }
+    return true;
+}
+
+} // namespace dsav
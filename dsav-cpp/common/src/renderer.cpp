@@ -3,14 +3,77 @@
  * @brief Implementation of rendering utilities
  */
 
+#include <glad/glad.h>
 #include "renderer.hpp"
 #include "color_scheme.hpp"
 #include <imgui.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 namespace dsav {
 
-void renderElement(ImDrawList* drawList, const VisualElement& elem, const ImVec2& offset) {
+namespace {
+
+bool sameVec(const ImVec2& a, const ImVec2& b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+// Indices i in [0, count) whose span [start + i * pitch, start + i * pitch + extent]
+// overlaps [viewMin, viewMax]
+IndexRange visibleSpan(float viewMin, float viewMax, float start, float pitch, float extent, size_t count) {
+    IndexRange range;
+    if (count == 0) return range;
+
+    if (pitch == 0.0f) {
+        bool visible = start + extent >= viewMin && start <= viewMax;
+        range.last = visible ? count : 0;
+        return range;
+    }
+
+    float a = (viewMin - extent - start) / pitch;
+    float b = (viewMax - start) / pitch;
+    float lo = std::ceil(std::min(a, b));
+    float hi = std::floor(std::max(a, b)) + 1.0f;
+
+    float n = static_cast<float>(count);
+    range.first = static_cast<size_t>(std::clamp(lo, 0.0f, n));
+    range.last = static_cast<size_t>(std::clamp(hi, 0.0f, n));
+    return range;
+}
+
+} // namespace
+
+CanvasViewport::CanvasViewport(const ImVec2& canvasPos, const ImVec2& canvasSize, float zoom, float margin)
+    : m_min(canvasPos.x - margin, canvasPos.y - margin),
+      m_max(canvasPos.x + canvasSize.x + margin, canvasPos.y + canvasSize.y + margin),
+      m_detail(zoom < LOD_ZOOM_THRESHOLD ? DetailLevel::Reduced : DetailLevel::Full) {
+}
+
+bool CanvasViewport::isRectVisible(const ImVec2& min, const ImVec2& max) const {
+    return max.x >= m_min.x && min.x <= m_max.x &&
+           max.y >= m_min.y && min.y <= m_max.y;
+}
+
+bool CanvasViewport::isCircleVisible(const ImVec2& center, float radius) const {
+    return isRectVisible(ImVec2(center.x - radius, center.y - radius),
+                         ImVec2(center.x + radius, center.y + radius));
+}
+
+bool CanvasViewport::isSegmentVisible(const ImVec2& a, const ImVec2& b) const {
+    return isRectVisible(ImVec2(std::min(a.x, b.x), std::min(a.y, b.y)),
+                         ImVec2(std::max(a.x, b.x), std::max(a.y, b.y)));
+}
+
+IndexRange CanvasViewport::visibleColumns(float startX, float pitch, float width, size_t count) const {
+    return visibleSpan(m_min.x, m_max.x, startX, pitch, width, count);
+}
+
+IndexRange CanvasViewport::visibleRows(float startY, float pitch, float height, size_t count) const {
+    return visibleSpan(m_min.y, m_max.y, startY, pitch, height, count);
+}
+
+void renderElement(ImDrawList* drawList, const VisualElement& elem, const ImVec2& offset, DetailLevel detail) {
     if (!drawList) return;
 
     // Calculate screen position with offset and scale
@@ -28,35 +91,41 @@ void renderElement(ImDrawList* drawList, const VisualElement& elem, const ImVec2
     ImU32 borderCol = ImGui::ColorConvertFloat4ToU32(colors::toImGui(elem.borderColor));
 
     // Draw rounded rectangle background
-    drawList->AddRectFilled(min, max, fillColor, elem.cornerRadius);
+    float rounding = (detail == DetailLevel::Full) ? elem.cornerRadius : 0.0f;
+    drawList->AddRectFilled(min, max, fillColor, rounding);
 
     // Draw border
     if (elem.borderWidth > 0.0f) {
-        drawList->AddRect(min, max, borderCol, elem.cornerRadius, 0, elem.borderWidth);
+        drawList->AddRect(min, max, borderCol, rounding, 0, elem.borderWidth);
+    }
+
+    // Zoomed out: text would be unreadable and the glow sub-pixel
+    if (detail == DetailLevel::Reduced) {
+        return;
     }
 
     // Draw main label (centered)
-    if (!elem.label.empty()) {
-        ImVec2 textSize = ImGui::CalcTextSize(elem.label.c_str());
+    if (elem.label != NO_LABEL) {
+        ImVec2 textSize = labels::textSize(elem.label);
         ImVec2 textPos = ImVec2(
             min.x + (max.x - min.x - textSize.x) * 0.5f,
             min.y + (max.y - min.y - textSize.y) * 0.5f
         );
-        drawList->AddText(textPos,
+        labels::draw(drawList, textPos,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textPrimary)),
-            elem.label.c_str());
+            elem.label);
     }
 
     // Draw sublabel below the element
-    if (!elem.sublabel.empty()) {
-        ImVec2 subSize = ImGui::CalcTextSize(elem.sublabel.c_str());
+    if (elem.sublabel != NO_LABEL) {
+        ImVec2 subSize = labels::textSize(elem.sublabel);
         ImVec2 subPos = ImVec2(
             min.x + (max.x - min.x - subSize.x) * 0.5f,
             max.y + 4.0f  // Slightly below the element
         );
-        drawList->AddText(subPos,
+        labels::draw(drawList, subPos,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary)),
-            elem.sublabel.c_str());
+            elem.sublabel);
     }
 
     // Optional: Draw highlight glow effect
@@ -83,7 +152,7 @@ void renderLine(ImDrawList* drawList, const glm::vec2& start, const glm::vec2& e
 }
 
 void renderArrow(ImDrawList* drawList, const glm::vec2& start, const glm::vec2& end,
-                 const glm::vec4& color, float thickness, float arrowSize) {
+                 const glm::vec4& color, float thickness, float arrowSize, DetailLevel detail) {
     if (!drawList) return;
 
     ImVec2 p1 = ImVec2(start.x, start.y);
@@ -93,6 +162,10 @@ void renderArrow(ImDrawList* drawList, const glm::vec2& start, const glm::vec2&
     // Draw line
     drawList->AddLine(p1, p2, col, thickness);
 
+    if (detail == DetailLevel::Reduced) {
+        return;
+    }
+
     // Calculate arrow head
     float dx = end.x - start.x;
     float dy = end.y - start.y;
@@ -123,4 +196,187 @@ void renderArrow(ImDrawList* drawList, const glm::vec2& start, const glm::vec2&
     }
 }
 
+// ===== CanvasCache =====
+
+CanvasCache::~CanvasCache() {
+    releaseResources();
+}
+
+bool CanvasCache::ensureResources(int width, int height) {
+    if (m_failed) return false;
+    if (m_initialized && width == m_width && height == m_height) return true;
+
+    if (!glGenFramebuffers || !glBindFramebuffer || !glFramebufferTexture2D || !glCheckFramebufferStatus) {
+        m_failed = true;
+        return false;
+    }
+
+    if (!m_initialized) {
+        glGenTextures(1, &m_texture);
+        glGenFramebuffers(1, &m_framebuffer);
+    }
+
+    // Sampled 1:1 with the framebuffer, so no filtering is wanted
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    GLint previous = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous));
+
+    m_initialized = true;
+    m_width = width;
+    m_height = height;
+    m_valid = false;
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        releaseResources();
+        m_failed = true;
+        return false;
+    }
+    return true;
+}
+
+void CanvasCache::releaseResources() {
+    if (!m_initialized) return;
+
+    glDeleteFramebuffers(1, &m_framebuffer);
+    glDeleteTextures(1, &m_texture);
+    m_framebuffer = 0;
+    m_texture = 0;
+    m_width = 0;
+    m_height = 0;
+    m_initialized = false;
+    m_valid = false;
+}
+
+bool CanvasCache::beginStatic(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize,
+                              const CanvasCacheKey& key) {
+    m_pass = Pass::Live;
+    if (!drawList || canvasSize.x <= 0.0f || canvasSize.y <= 0.0f) return true;
+
+    // Framebuffer objects belong to the main context; platform windows have their own
+    ImGuiViewport* viewport = ImGui::GetWindowViewport();
+    if (viewport != ImGui::GetMainViewport()) return true;
+
+    ImVec2 scale = ImGui::GetIO().DisplayFramebufferScale;
+    int width = static_cast<int>(viewport->Size.x * scale.x);
+    int height = static_cast<int>(viewport->Size.y * scale.y);
+    if (width <= 0 || height <= 0 || !ensureResources(width, height)) return true;
+
+    ImVec2 clipMin = drawList->GetClipRectMin();
+    ImVec2 clipMax = drawList->GetClipRectMax();
+    if (m_valid && key == m_key && sameVec(canvasPos, m_canvasPos) && sameVec(canvasSize, m_canvasSize) &&
+        sameVec(clipMin, m_clipMin) && sameVec(clipMax, m_clipMax) && sameVec(viewport->Pos, m_displayPos)) {
+        m_pass = Pass::Cached;
+        return false;
+    }
+
+    m_key = key;
+    m_canvasPos = canvasPos;
+    m_canvasSize = canvasSize;
+    m_clipMin = clipMin;
+    m_clipMax = clipMax;
+    m_displayPos = viewport->Pos;
+
+    // Texture rows run bottom-up, like the framebuffer the commands were meant for
+    float left = (canvasPos.x - viewport->Pos.x) * scale.x;
+    float top = (canvasPos.y - viewport->Pos.y) * scale.y;
+    m_uvMin = ImVec2(left / m_width, 1.0f - top / m_height);
+    m_uvMax = ImVec2((left + canvasSize.x * scale.x) / m_width,
+                     1.0f - (top + canvasSize.y * scale.y) / m_height);
+
+    m_valid = true;
+    m_pass = Pass::Rebuild;
+    m_rebuilds++;
+    drawList->AddCallback(&CanvasCache::beginCallback, this);
+    return true;
+}
+
+void CanvasCache::endStatic(ImDrawList* drawList) {
+    if (m_pass == Pass::Live) return;
+
+    if (m_pass == Pass::Rebuild) {
+        drawList->AddCallback(&CanvasCache::endCallback, this);
+        drawList->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+    }
+
+    // ImTextureID is a pointer or an integer depending on the ImGui build
+    ImTextureID texture = (ImTextureID)(std::intptr_t)m_texture;
+    drawList->AddImage(texture, m_canvasPos,
+                       ImVec2(m_canvasPos.x + m_canvasSize.x, m_canvasPos.y + m_canvasSize.y),
+                       m_uvMin, m_uvMax);
+    m_pass = Pass::Live;
+}
+
+void CanvasCache::beginCallback(const ImDrawList*, const ImDrawCmd* cmd) {
+    auto* cache = static_cast<CanvasCache*>(cmd->UserCallbackData);
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &cache->m_previousFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, cache->m_framebuffer);
+
+    // Same size as the window's framebuffer, so the backend's viewport and scissors carry over
+    glDisable(GL_SCISSOR_TEST);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+}
+
+void CanvasCache::endCallback(const ImDrawList*, const ImDrawCmd* cmd) {
+    auto* cache = static_cast<CanvasCache*>(cmd->UserCallbackData);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(cache->m_previousFramebuffer));
+}
+
+// ===== PixelTexture =====
+
+PixelTexture::~PixelTexture() {
+    release();
+}
+
+void PixelTexture::upload(const std::uint32_t* pixels, int width, int height) {
+    if (width <= 0 || height <= 0) return;
+
+    if (m_texture == 0) {
+        glGenTextures(1, &m_texture);
+        glBindTexture(GL_TEXTURE_2D, m_texture);
+        // One texel per summary cell: keep the cells crisp when stretched
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    } else {
+        glBindTexture(GL_TEXTURE_2D, m_texture);
+    }
+
+    // RGBA rows are always 4-byte aligned, so the default unpack alignment fits
+    if (width == m_width && height == m_height) {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    } else {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        m_width = width;
+        m_height = height;
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void PixelTexture::draw(ImDrawList* drawList, const ImVec2& min, const ImVec2& max) const {
+    if (m_texture == 0) return;
+    drawList->AddImage((ImTextureID)(std::intptr_t)m_texture, min, max);
+}
+
+void PixelTexture::release() {
+    if (m_texture == 0) return;
+    glDeleteTextures(1, &m_texture);
+    m_texture = 0;
+    m_width = 0;
+    m_height = 0;
+}
+
 } // namespace dsav
@@ -0,0 +1,224 @@
+/**
+ * @file trace_writer.cpp
+ * @brief Background Chrome trace writer
+ */
+
+#include "trace_writer.hpp"
+#include "spsc_queue.hpp"
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <thread>
+
+namespace dsav::trace {
+
+namespace detail {
+std::atomic<bool> g_active{false};
+}
+
+namespace {
+
+constexpr size_t FLUSH_BYTES = 64 * 1024;                          ///< Writer buffers this much per fwrite
+constexpr std::chrono::milliseconds IDLE_SLEEP(2);                 ///< Writer nap when the queue is empty
+
+/**
+ * @brief State of one running capture
+ */
+struct Capture {
+    SpscQueue<TraceEvent> queue{QUEUE_CAPACITY};
+    std::FILE* file = nullptr;
+    std::thread writer;
+    std::atomic<bool> stopping{false};
+    std::uint64_t originNs = 0;     ///< Timestamps are written relative to this
+};
+
+std::unique_ptr<Capture> g_capture;          // Render thread only
+std::string g_path;
+std::atomic<std::uint64_t> g_written{0};
+std::uint64_t g_dropped = 0;                 // Render thread only
+
+std::uint64_t steadyNs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void appendString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* c = text; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out += '\\';
+        }
+        out += *c;
+    }
+    out += '"';
+}
+
+void appendMicros(std::string& out, double micros) {
+    char number[32];
+    int length = std::snprintf(number, sizeof(number), "%.3f", micros);
+    out.append(number, static_cast<size_t>(length));
+}
+
+void appendInt(std::string& out, std::int64_t value) {
+    char number[24];
+    int length = std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(value));
+    out.append(number, static_cast<size_t>(length));
+}
+
+void appendEvent(std::string& out, const TraceEvent& event, std::uint64_t originNs) {
+    // Scopes that opened before the capture started get a negative timestamp
+    double ts = static_cast<double>(static_cast<std::int64_t>(event.timestampNs - originNs)) / 1000.0;
+
+    out += ",\n{\"name\":";
+    appendString(out, event.name);
+    out += ",\"cat\":";
+    appendString(out, event.category);
+    out += ",\"ph\":\"";
+    out += static_cast<char>(event.phase);
+    out += "\",\"ts\":";
+    appendMicros(out, ts);
+    if (event.phase == Phase::Complete) {
+        out += ",\"dur\":";
+        appendMicros(out, static_cast<double>(event.durationNs) / 1000.0);
+    } else {
+        out += ",\"s\":\"t\"";
+    }
+    out += ",\"pid\":1,\"tid\":";
+    appendInt(out, event.track);
+
+    if (event.argNames[0] != nullptr) {
+        out += ",\"args\":{";
+        for (int i = 0; i < 2 && event.argNames[i] != nullptr; ++i) {
+            if (i > 0) out += ',';
+            appendString(out, event.argNames[i]);
+            out += ':';
+            appendInt(out, event.args[i]);
+        }
+        out += '}';
+    }
+    out += '}';
+}
+
+void writerLoop(Capture& capture) {
+    std::string buffer;
+    buffer.reserve(FLUSH_BYTES + 1024);
+
+    for (;;) {
+        // Read the flag first: everything queued before stop() is then drained below
+        bool stopping = capture.stopping.load(std::memory_order_acquire);
+
+        std::uint64_t count = 0;
+        while (auto event = capture.queue.tryPop()) {
+            appendEvent(buffer, *event, capture.originNs);
+            ++count;
+            if (buffer.size() >= FLUSH_BYTES) {
+                std::fwrite(buffer.data(), 1, buffer.size(), capture.file);
+                buffer.clear();
+            }
+        }
+        if (!buffer.empty()) {
+            std::fwrite(buffer.data(), 1, buffer.size(), capture.file);
+            buffer.clear();
+        }
+        g_written.fetch_add(count, std::memory_order_relaxed);
+
+        if (stopping) {
+            return;
+        }
+        if (count == 0) {
+            std::this_thread::sleep_for(IDLE_SLEEP);
+        }
+    }
+}
+
+} // namespace
+
+bool start(const std::string& path) {
+    if (g_capture) {
+        return false;
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    // The metadata event names the algorithm track and lets every real event
+    // start with a comma
+    std::fprintf(file, "{\"traceEvents\":[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                       "\"args\":{\"name\":\"Algorithm events\"}}", ALGORITHM_TRACK);
+
+    g_capture = std::make_unique<Capture>();
+    g_capture->file = file;
+    g_capture->originNs = steadyNs();
+    g_path = path;
+    g_written.store(0, std::memory_order_relaxed);
+    g_dropped = 0;
+
+    Capture& capture = *g_capture;
+    capture.writer = std::thread([&capture]() { writerLoop(capture); });
+    detail::g_active.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void stop() {
+    if (!g_capture) {
+        return;
+    }
+
+    detail::g_active.store(false, std::memory_order_relaxed);
+    g_capture->stopping.store(true, std::memory_order_release);
+    g_capture->writer.join();
+
+    std::fputs("\n]}\n", g_capture->file);
+    std::fclose(g_capture->file);
+    g_capture.reset();
+}
+
+void emit(const TraceEvent& event) {
+    if (!g_capture) {
+        return;
+    }
+    TraceEvent copy = event;
+    if (!g_capture->queue.tryPush(std::move(copy))) {
+        ++g_dropped;
+    }
+}
+
+void instant(const char* name, const char* category, std::uint32_t track,
+             const char* arg0, std::int64_t value0,
+             const char* arg1, std::int64_t value1) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = Phase::Instant;
+    event.track = track;
+    event.timestampNs = steadyNs();
+    event.argNames[0] = arg0;
+    event.argNames[1] = arg1;
+    event.args[0] = value0;
+    event.args[1] = value1;
+    emit(event);
+}
+
+std::string defaultPath() {
+    std::time_t now = std::time(nullptr);
+    char name[64];
+    std::strftime(name, sizeof(name), "dsav-trace-%Y%m%d-%H%M%S.json", std::localtime(&now));
+    return name;
+}
+
+const std::string& path() {
+    return g_path;
+}
+
+std::uint64_t writtenEvents() {
+    return g_written.load(std::memory_order_relaxed);
+}
+
+std::uint64_t droppedEvents() {
+    return g_dropped;
+}
+
+} // namespace dsav::trace
@@ -0,0 +1,378 @@
+/**
+ * @file tree_layout.cpp
+ * @brief Implementation of the incremental tidy-tree layout engine
+ */
+
+#include "tree_layout.hpp"
+#include <algorithm>
+
+namespace dsav {
+
+TreeLayout::TreeLayout(float nodeSpacing, float levelSpacing)
+    : m_nodeSpacing(nodeSpacing), m_levelSpacing(levelSpacing) {}
+
+void TreeLayout::ensureCapacity(std::uint32_t id) {
+    if (id < m_left.size()) return;
+
+    size_t size = std::max<size_t>(static_cast<size_t>(id) + 1, m_left.size() * 2);
+    m_left.resize(size, NONE);
+    m_right.resize(size, NONE);
+    m_parent.resize(size, NONE);
+    m_present.resize(size, 0);
+    m_offset.resize(size, 0.0f);
+    m_height.resize(size, 0);
+    m_extLeft.resize(size, NONE);
+    m_extRight.resize(size, NONE);
+    m_extLeftX.resize(size, 0.0f);
+    m_extRightX.resize(size, 0.0f);
+    m_threadLeft.resize(size, NONE);
+    m_threadRight.resize(size, NONE);
+    m_threadLeftX.resize(size, 0.0f);
+    m_threadRightX.resize(size, 0.0f);
+    m_threadOwner.resize(size, NONE);
+    m_threadOwnerLeft.resize(size, 0);
+    m_position.resize(size, glm::vec2(0.0f));
+    m_placed.resize(size, 0);
+    m_inWorkSet.resize(size, 0);
+    m_pending.resize(size, 0);
+}
+
+void TreeLayout::touch(std::uint32_t id) {
+    m_touched.push_back(id);
+}
+
+void TreeLayout::setLinks(std::uint32_t id, std::uint32_t left, std::uint32_t right) {
+    ensureCapacity(id);
+    if (left != NONE) ensureCapacity(left);
+    if (right != NONE) ensureCapacity(right);
+
+    if (!m_present[id]) {
+        m_present[id] = 1;
+        m_placed[id] = 0;
+        m_threadLeft[id] = NONE;
+        m_threadRight[id] = NONE;
+        m_threadOwner[id] = NONE;
+    }
+
+    m_left[id] = left;
+    m_right[id] = right;
+    if (left != NONE) m_parent[left] = id;
+    if (right != NONE) m_parent[right] = id;
+    touch(id);
+}
+
+void TreeLayout::removeNode(std::uint32_t id) {
+    if (id >= m_present.size() || !m_present[id]) return;
+
+    // The thread this node placed lives in a leaf that may survive it
+    clearThread(id);
+    m_present[id] = 0;
+    m_placed[id] = 0;
+    m_left[id] = NONE;
+    m_right[id] = NONE;
+    m_parent[id] = NONE;
+    m_threadLeft[id] = NONE;
+    m_threadRight[id] = NONE;
+    if (m_root == id) m_root = NONE;
+}
+
+void TreeLayout::setRoot(std::uint32_t id) {
+    if (id != NONE) {
+        ensureCapacity(id);
+        m_parent[id] = NONE;
+    }
+    if (id != m_root) {
+        m_root = id;
+        if (id != NONE) touch(id);
+    }
+}
+
+void TreeLayout::setOrigin(const glm::vec2& origin) {
+    if (origin == m_origin) return;
+    m_origin = origin;
+    if (m_root != NONE) touch(m_root);
+}
+
+void TreeLayout::setSpacing(float nodeSpacing, float levelSpacing) {
+    if (nodeSpacing == m_nodeSpacing && levelSpacing == m_levelSpacing) return;
+    m_nodeSpacing = nodeSpacing;
+    m_levelSpacing = levelSpacing;
+    m_fullRelayout = true;
+}
+
+void TreeLayout::clear() {
+    m_left.clear();
+    m_right.clear();
+    m_parent.clear();
+    m_present.clear();
+    m_offset.clear();
+    m_height.clear();
+    m_extLeft.clear();
+    m_extRight.clear();
+    m_extLeftX.clear();
+    m_extRightX.clear();
+    m_threadLeft.clear();
+    m_threadRight.clear();
+    m_threadLeftX.clear();
+    m_threadRightX.clear();
+    m_threadOwner.clear();
+    m_threadOwnerLeft.clear();
+    m_position.clear();
+    m_placed.clear();
+    m_inWorkSet.clear();
+    m_pending.clear();
+    m_touched.clear();
+    m_workSet.clear();
+    m_moved.clear();
+    m_root = NONE;
+    m_fullRelayout = false;
+}
+
+glm::vec2 TreeLayout::position(std::uint32_t id) const {
+    return (id < m_position.size()) ? m_position[id] : m_origin;
+}
+
+bool TreeLayout::contains(std::uint32_t id) const {
+    return id < m_present.size() && m_present[id];
+}
+
+void TreeLayout::clearThread(std::uint32_t owner) {
+    std::uint32_t target = m_threadOwner[owner];
+    if (target == NONE) return;
+
+    if (m_threadOwnerLeft[owner]) {
+        m_threadLeft[target] = NONE;
+    } else {
+        m_threadRight[target] = NONE;
+    }
+    m_threadOwner[owner] = NONE;
+}
+
+bool TreeLayout::nextLeftContour(std::uint32_t& node, float& x) const {
+    std::uint32_t next;
+    float dx;
+    if (m_left[node] != NONE) {
+        next = m_left[node];
+        dx = m_offset[next];
+    } else if (m_right[node] != NONE) {
+        next = m_right[node];
+        dx = m_offset[next];
+    } else if (m_threadLeft[node] != NONE) {
+        next = m_threadLeft[node];
+        dx = m_threadLeftX[node];
+    } else {
+        return false;
+    }
+    node = next;
+    x += dx;
+    return true;
+}
+
+bool TreeLayout::nextRightContour(std::uint32_t& node, float& x) const {
+    std::uint32_t next;
+    float dx;
+    if (m_right[node] != NONE) {
+        next = m_right[node];
+        dx = m_offset[next];
+    } else if (m_left[node] != NONE) {
+        next = m_left[node];
+        dx = m_offset[next];
+    } else if (m_threadRight[node] != NONE) {
+        next = m_threadRight[node];
+        dx = m_threadRightX[node];
+    } else {
+        return false;
+    }
+    node = next;
+    x += dx;
+    return true;
+}
+
+void TreeLayout::merge(std::uint32_t id) {
+    m_lastMergeCount++;
+
+    std::uint32_t left = m_left[id];
+    std::uint32_t right = m_right[id];
+    float half = m_nodeSpacing * 0.5f;
+
+    // Leaf
+    if (left == NONE && right == NONE) {
+        m_height[id] = 0;
+        m_extLeft[id] = id;
+        m_extRight[id] = id;
+        m_extLeftX[id] = 0.0f;
+        m_extRightX[id] = 0.0f;
+        return;
+    }
+
+    // Single child: keep it on its side so left/right stays readable
+    if (left == NONE || right == NONE) {
+        std::uint32_t child = (left != NONE) ? left : right;
+        m_offset[child] = (left != NONE) ? -half : half;
+        m_height[id] = m_height[child] + 1;
+        m_extLeft[id] = m_extLeft[child];
+        m_extRight[id] = m_extRight[child];
+        m_extLeftX[id] = m_offset[child] + m_extLeftX[child];
+        m_extRightX[id] = m_offset[child] + m_extRightX[child];
+        return;
+    }
+
+    // Walk the right contour of the left subtree against the left contour
+    // of the right subtree to find the smallest legal root separation.
+    std::uint32_t lo = left;
+    std::uint32_t ro = right;
+    float lx = 0.0f;   // relative to left child
+    float rx = 0.0f;   // relative to right child
+    float separation = m_nodeSpacing;
+
+    std::uint32_t ln = lo;
+    std::uint32_t rn = ro;
+    float lnx = lx;
+    float rnx = rx;
+    bool leftAdvanced = false;
+    bool rightAdvanced = false;
+
+    while (true) {
+        ln = lo;
+        lnx = lx;
+        rn = ro;
+        rnx = rx;
+        leftAdvanced = nextRightContour(ln, lnx);
+        rightAdvanced = nextLeftContour(rn, rnx);
+        if (!leftAdvanced || !rightAdvanced) break;
+
+        lo = ln;
+        lx = lnx;
+        ro = rn;
+        rx = rnx;
+        separation = std::max(separation, m_nodeSpacing + lx - rx);
+    }
+
+    m_offset[left] = -separation * 0.5f;
+    m_offset[right] = separation * 0.5f;
+
+    // Thread the shallower side's outer contour into the deeper subtree
+    if (!leftAdvanced && rightAdvanced) {
+        std::uint32_t leaf = m_extLeft[left];
+        m_threadLeft[leaf] = rn;
+        m_threadLeftX[leaf] = (separation + rnx) - m_extLeftX[left];
+        m_threadOwner[id] = leaf;
+        m_threadOwnerLeft[id] = 1;
+    } else if (leftAdvanced && !rightAdvanced) {
+        std::uint32_t leaf = m_extRight[right];
+        m_threadRight[leaf] = ln;
+        m_threadRightX[leaf] = (lnx - separation) - m_extRightX[right];
+        m_threadOwner[id] = leaf;
+        m_threadOwnerLeft[id] = 0;
+    }
+
+    std::uint32_t leftHeight = m_height[left];
+    std::uint32_t rightHeight = m_height[right];
+    m_height[id] = std::max(leftHeight, rightHeight) + 1;
+
+    std::uint32_t leftSource = (rightHeight > leftHeight) ? right : left;
+    std::uint32_t rightSource = (leftHeight > rightHeight) ? left : right;
+    m_extLeft[id] = m_extLeft[leftSource];
+    m_extLeftX[id] = m_offset[leftSource] + m_extLeftX[leftSource];
+    m_extRight[id] = m_extRight[rightSource];
+    m_extRightX[id] = m_offset[rightSource] + m_extRightX[rightSource];
+}
+
+void TreeLayout::update() {
+    m_moved.clear();
+    m_lastMergeCount = 0;
+
+    bool full = m_fullRelayout;
+    if (full) {
+        for (std::uint32_t id = 0; id < m_present.size(); ++id) {
+            if (m_present[id]) touch(id);
+        }
+        m_fullRelayout = false;
+    }
+
+    // 1. Work set = touched nodes plus all of their ancestors
+    for (std::uint32_t id : m_touched) {
+        std::uint32_t node = id;
+        while (node != NONE && m_present[node] && !m_inWorkSet[node]) {
+            m_inWorkSet[node] = 1;
+            m_workSet.push_back(node);
+            node = m_parent[node];
+        }
+    }
+    m_touched.clear();
+
+    // 2. Threads placed by any re-merged node are stale
+    for (std::uint32_t id : m_workSet) {
+        clearThread(id);
+    }
+
+    // 3. Re-merge bottom-up: a node is ready once its dirty children are done
+    std::vector<std::uint32_t> ready;
+    for (std::uint32_t id : m_workSet) {
+        std::uint8_t pending = 0;
+        if (m_left[id] != NONE && m_inWorkSet[m_left[id]]) pending++;
+        if (m_right[id] != NONE && m_inWorkSet[m_right[id]]) pending++;
+        m_pending[id] = pending;
+        if (pending == 0) ready.push_back(id);
+    }
+
+    while (!ready.empty()) {
+        std::uint32_t id = ready.back();
+        ready.pop_back();
+        merge(id);
+
+        std::uint32_t parent = m_parent[id];
+        if (parent != NONE && m_inWorkSet[parent] && --m_pending[parent] == 0) {
+            ready.push_back(parent);
+        }
+    }
+
+    // 4. Absolute positions (skips subtrees that neither changed nor moved)
+    if (full) {
+        for (std::uint32_t id = 0; id < m_placed.size(); ++id) m_placed[id] = 0;
+    }
+    resolvePositions();
+
+    for (std::uint32_t id : m_workSet) {
+        m_inWorkSet[id] = 0;
+    }
+    m_workSet.clear();
+}
+
+void TreeLayout::resolvePositions() {
+    if (m_root == NONE || !m_present[m_root]) return;
+
+    struct Visit {
+        std::uint32_t id;
+        glm::vec2 position;
+    };
+    std::vector<Visit> stack;
+    stack.push_back({m_root, m_origin});
+
+    while (!stack.empty()) {
+        Visit visit = stack.back();
+        stack.pop_back();
+        std::uint32_t id = visit.id;
+
+        bool changed = !m_placed[id] || m_position[id] != visit.position;
+        if (!changed && !m_inWorkSet[id]) {
+            continue;  // Whole subtree is where it was
+        }
+
+        if (changed) {
+            m_position[id] = visit.position;
+            m_placed[id] = 1;
+            m_moved.push_back(id);
+        }
+
+        float childY = visit.position.y + m_levelSpacing;
+        if (m_left[id] != NONE) {
+            stack.push_back({m_left[id], glm::vec2(visit.position.x + m_offset[m_left[id]], childY)});
+        }
+        if (m_right[id] != NONE) {
+            stack.push_back({m_right[id], glm::vec2(visit.position.x + m_offset[m_right[id]], childY)});
+        }
+    }
+}
+
+} // namespace dsav
@@ -0,0 +1,125 @@
+/**
+ * @file byte_order.hpp
+ * @brief Little-endian field access and the header prefix shared by the binary file formats
+ *
+ * The compact key format, snapshots and binary workloads all store their
+ * header fields and payload little-endian. On little-endian hosts 32 and
+ * 64-bit loads are a plain memcpy; elsewhere they are assembled byte by
+ * byte.
+ *
+ * All three headers open with the same 24 bytes:
+ *
+ *   offset  size  field
+ *        0     8  magic
+ *        8     2  version
+ *       10     2  two format-specific bytes
+ *       12     4  offset of the first payload record
+ *       16     8  record count
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace dsav::algorithms::detail {
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool HOST_LITTLE_ENDIAN = false;
+#else
+constexpr bool HOST_LITTLE_ENDIAN = true;
+#endif
+
+inline std::uint32_t loadLE32(const std::uint8_t* p) {
+    if constexpr (HOST_LITTLE_ENDIAN) {
+        std::uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    return static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8 |
+           static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+}
+
+inline std::uint64_t loadLE64(const std::uint8_t* p) {
+    if constexpr (HOST_LITTLE_ENDIAN) {
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    return static_cast<std::uint64_t>(loadLE32(p)) | static_cast<std::uint64_t>(loadLE32(p + 4)) << 32;
+}
+
+/**
+ * @brief Read an unsigned field of 1 to 8 bytes
+ */
+inline std::uint64_t loadLE(const std::uint8_t* p, size_t bytes) {
+    if (bytes == 4) return loadLE32(p);
+    if (bytes == 8) return loadLE64(p);
+    std::uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Write the low @p bytes bytes of a value
+ */
+inline void storeLE(std::uint8_t* p, std::uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+        p[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+// ===== Header prefix =====
+
+/**
+ * @brief Fields of the shared header prefix
+ */
+struct FileHeader {
+    std::uint16_t version = 0;
+    std::uint8_t format[2] = {};    ///< Bytes 10 and 11, meaning set by each format
+    std::uint32_t offset = 0;       ///< Offset of the first payload record
+    std::uint64_t count = 0;        ///< Number of payload records
+};
+
+inline void storeFileHeader(std::uint8_t* p, const char (&magic)[8], const FileHeader& header) {
+    std::memcpy(p, magic, sizeof(magic));
+    storeLE(p + 8, header.version, 2);
+    p[10] = header.format[0];
+    p[11] = header.format[1];
+    storeLE(p + 12, header.offset, 4);
+    storeLE(p + 16, header.count, 8);
+}
+
+/**
+ * @brief Read the header prefix of a mapped file
+ *
+ * @param headerBytes Full header size of the format
+ * @return false if the file is shorter than the header or the magic differs
+ */
+inline bool loadFileHeader(const std::uint8_t* p, size_t size, const char (&magic)[8], size_t headerBytes,
+                           FileHeader& header) {
+    if (size < headerBytes || std::memcmp(p, magic, sizeof(magic)) != 0) {
+        return false;
+    }
+    header.version = static_cast<std::uint16_t>(loadLE(p + 8, 2));
+    header.format[0] = p[10];
+    header.format[1] = p[11];
+    header.offset = loadLE32(p + 12);
+    header.count = loadLE64(p + 16);
+    return true;
+}
+
+/**
+ * @brief Whether the records a header announces lie inside the file
+ *
+ * Dividing keeps a corrupt count from overflowing the size check.
+ */
+inline bool payloadFits(const FileHeader& header, size_t size, size_t headerBytes, size_t recordBytes) {
+    return header.offset >= headerBytes && header.offset <= size &&
+           header.count <= (size - header.offset) / recordBytes;
+}
+
+} // namespace dsav::algorithms::detail
@@ -0,0 +1,134 @@
+/**
+ * @file complexity.hpp
+ * @brief Headless complexity sweeps over the data structures
+ *
+ * A sweep builds a structure at n = 2^minExponent, 2^(minExponent + 1), ...
+ * and, at each size, runs a batch of one operation (n / 8 of them, so the
+ * structure barely changes size) while reading the structure's OpCounters
+ * and the clock. Dividing by the batch length gives the cost of one
+ * operation at size n, which the complexity view plots against constant,
+ * log n, n and n log n curves.
+ *
+ * Nothing here touches a window, so sweeps run on a worker thread or in
+ * dsav-bench. With DSAV_OP_COUNTERS=0 only the timings are meaningful.
+ */
+
+#pragma once
+
+#include "data_structures/op_counters.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dsav::algorithms {
+
+/// Smallest exponent a sweep may start from (n = 16)
+constexpr size_t COMPLEXITY_MIN_EXPONENT = 4;
+
+/// Largest exponent a sweep may reach (sorted BST inserts are quadratic to build)
+constexpr size_t COMPLEXITY_MAX_EXPONENT = 16;
+
+/// Batch length is n / COMPLEXITY_BATCH_DIVISOR (at least one operation)
+constexpr size_t COMPLEXITY_BATCH_DIVISOR = 8;
+
+/**
+ * @brief Operations a sweep can measure
+ */
+enum class ComplexityOp : std::uint8_t {
+    StackPush,
+    StackPop,
+    QueueEnqueue,
+    QueueDequeue,
+    ArrayPushBack,
+    ArrayInsertFront,
+    ArrayFind,
+    ListInsertFront,
+    ListInsertBack,
+    ListDeleteBack,
+    ListFind,
+    DListDeleteBack,
+    BstInsertRandom,
+    BstInsertSorted,
+    BstSearch,
+    RbInsertRandom,
+    RbInsertSorted,
+    RbSearch,
+    RbSelect
+};
+
+/// Number of ComplexityOp values
+constexpr size_t COMPLEXITY_OP_COUNT = static_cast<size_t>(ComplexityOp::RbSelect) + 1;
+
+/**
+ * @brief Display names of an operation
+ */
+struct ComplexityOpInfo {
+    const char* structure;  ///< e.g. "Dynamic Array"
+    const char* operation;  ///< e.g. "insert at front"
+    const char* expected;   ///< Textbook cost, e.g. "O(n)"
+};
+
+/**
+ * @brief Names of an operation
+ */
+const ComplexityOpInfo& complexityOpInfo(ComplexityOp op);
+
+/**
+ * @brief Quantity a sample is read as
+ */
+enum class ComplexityMetric : std::uint8_t {
+    Comparisons,
+    Hops,
+    Moves,
+    Allocations,
+    Rotations,
+    TotalOps,       ///< Sum of the five counters
+    Nanoseconds     ///< Wall time
+};
+
+/// Number of ComplexityMetric values
+constexpr size_t COMPLEXITY_METRIC_COUNT = static_cast<size_t>(ComplexityMetric::Nanoseconds) + 1;
+
+/**
+ * @brief Display name of a metric
+ */
+const char* complexityMetricName(ComplexityMetric metric);
+
+/**
+ * @brief One batch of operations at one size
+ */
+struct ComplexitySample {
+    size_t n = 0;               ///< Structure size before the batch
+    size_t operations = 0;      ///< Operations in the batch
+    OpCounters ops;             ///< Work counted during the batch
+    double nanoseconds = 0.0;   ///< Wall time of the batch
+
+    /**
+     * @brief Average cost of one operation in the batch
+     */
+    double perOperation(ComplexityMetric metric) const;
+};
+
+/**
+ * @brief Measure one operation at one size
+ *
+ * @param op Operation to measure
+ * @param n Structure size the batch starts from
+ * @param seed Seed of the shuffled keys
+ */
+ComplexitySample measureComplexity(ComplexityOp op, size_t n, std::uint32_t seed);
+
+/**
+ * @brief Measure one operation at n = 2^minExponent ... 2^maxExponent
+ *
+ * Exponents are clamped to [COMPLEXITY_MIN_EXPONENT, COMPLEXITY_MAX_EXPONENT].
+ *
+ * @param out Receives one sample per size (cleared first)
+ * @param cancel Optional flag polled between sizes
+ * @return false if cancelled (out holds the sizes finished so far)
+ */
+bool runComplexity(ComplexityOp op, size_t minExponent, size_t maxExponent, std::uint32_t seed,
+                   std::vector<ComplexitySample>& out, const std::atomic<bool>* cancel = nullptr);
+
+} // namespace dsav::algorithms
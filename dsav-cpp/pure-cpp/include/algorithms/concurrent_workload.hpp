@@ -0,0 +1,125 @@
+/**
+ * @file concurrent_workload.hpp
+ * @brief Producer/consumer runs over the lock-free containers and their mutex baselines
+ *
+ * A run starts the requested number of real producer and consumer threads,
+ * releases them together, and has each producer push its share of items
+ * while the consumers pop until every producer has finished and the
+ * container is drained. The sums of pushed and popped items are compared at
+ * the end, so a run also checks that nothing was lost or duplicated.
+ *
+ * The baselines are the single-threaded Queue and Stack behind one
+ * std::mutex, which is what the lock-free containers have to beat.
+ */
+
+#pragma once
+
+#include "data_structures/contention_probe.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Container a workload runs on
+ */
+enum class ConcurrentContainer {
+    MutexQueue,         ///< Queue<T, DYNAMIC_CAPACITY> behind a std::mutex
+    MichaelScottQueue,  ///< LockFreeQueue
+    MpmcRing,           ///< MpmcQueue (bounded)
+    MutexStack,         ///< Stack<T, DYNAMIC_CAPACITY> behind a std::mutex
+    TreiberStack        ///< LockFreeStack
+};
+
+constexpr size_t CONCURRENT_CONTAINER_COUNT = 5;
+
+/**
+ * @brief Display name, e.g. "Michael-Scott queue"
+ */
+const char* concurrentContainerName(ConcurrentContainer container);
+
+/**
+ * @brief Command-line key: "mutex-queue", "ms-queue", "ring", "mutex-stack" or "treiber"
+ */
+const char* concurrentContainerKey(ConcurrentContainer container);
+
+/**
+ * @brief Look up a container by its command-line key
+ *
+ * @return false if the key is unknown
+ */
+bool parseConcurrentContainer(const std::string& key, ConcurrentContainer& container);
+
+/**
+ * @brief The mutex baseline with the same order (FIFO or LIFO)
+ */
+ConcurrentContainer mutexBaselineFor(ConcurrentContainer container);
+
+/**
+ * @brief Check whether a container is one of the mutex baselines
+ */
+bool isMutexBaseline(ConcurrentContainer container);
+
+/**
+ * @brief Probe sites a container reports (ring cells for MpmcRing)
+ *
+ * @param ringCapacity Requested ring capacity (rounded up like MpmcQueue does)
+ */
+size_t contentionSiteCount(ConcurrentContainer container, size_t ringCapacity);
+
+/**
+ * @brief Name of a site ("head", "tail", "link", "top", "lock"), or nullptr for ring cells
+ */
+const char* contentionSiteName(ConcurrentContainer container, size_t site);
+
+/**
+ * @brief What to run
+ */
+struct ConcurrentWorkload {
+    static constexpr size_t MAX_PRODUCERS = 32;
+    static constexpr size_t MAX_CONSUMERS = 32;
+
+    ConcurrentContainer container = ConcurrentContainer::MichaelScottQueue;
+    size_t producers = 2;                 ///< Clamped to 1..MAX_PRODUCERS
+    size_t consumers = 2;                 ///< Clamped to 1..MAX_CONSUMERS
+    size_t itemsPerProducer = 100000;
+    size_t ringCapacity = 256;            ///< MpmcRing only
+
+    size_t threadCount() const;           ///< Producers plus consumers after clamping
+};
+
+/**
+ * @brief What a run measured
+ */
+struct ConcurrentResult {
+    double seconds = 0.0;                 ///< From the start signal until every thread finished
+    std::uint64_t itemsPushed = 0;
+    std::uint64_t itemsPopped = 0;
+    bool completed = false;               ///< false if cancelled
+    bool checksumOk = false;              ///< Popped items are exactly the pushed ones
+    ContentionThreadStats totals;         ///< From the probe (zero without one)
+
+    /// Popped items per second
+    double itemsPerSecond() const { return seconds > 0.0 ? static_cast<double>(itemsPopped) / seconds : 0.0; }
+};
+
+/**
+ * @brief Run a workload on fresh threads and wait for it
+ *
+ * Producers bind to probe thread indices 0..producers - 1, consumers to
+ * the indices after them, so the probe needs threadCount() threads and
+ * contentionSiteCount() sites.
+ *
+ * @param workload What to run
+ * @param result Measurements (filled even when cancelled)
+ * @param probe Receives every CAS and completed op (nullptr = unprobed)
+ * @param cancel Stops the producers early; consumers still drain what was pushed
+ * @return false if cancelled or an item was lost
+ */
+bool runConcurrentWorkload(const ConcurrentWorkload& workload, ConcurrentResult& result,
+                           ContentionProbe* probe = nullptr,
+                           const std::atomic<bool>* cancel = nullptr);
+
+} // namespace dsav::algorithms
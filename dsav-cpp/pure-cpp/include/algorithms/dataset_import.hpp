@@ -0,0 +1,337 @@
+/**
+ * @file dataset_import.hpp
+ * @brief Reading recorded key sets from disk for the visualizers and the bench
+ *
+ * Three kinds of file are understood:
+ * - Raw little-endian int32 or int64 arrays (no header), memory-mapped
+ * - Newline-delimited decimal text, streamed through a fixed-size buffer
+ * - The compact key format below: a 64-byte header, then the keys as raw
+ *   little-endian int32 or int64, memory-mapped
+ *
+ * Keys are handed out in chunks decoded straight from the mapping (int32
+ * files are passed through without any decoding), so the only full copy is
+ * the one the consumer keeps. Keys that do not fit an int are narrowed by an
+ * order-preserving shift of their offset from the smallest key.
+ *
+ * Compact format (all fields little-endian):
+ *
+ *   offset  size  field
+ *        0     8  magic "DSAVKEYS"
+ *        8     2  version (1)
+ *       10     1  key width in bytes (4 or 8)
+ *       11     1  flags: bit 0 range present, bit 1 sortedness present
+ *       12     4  offset of the first key (64)
+ *       16     8  key count
+ *       24     8  smallest key (int64, if flagged)
+ *       32     8  largest key (int64, if flagged)
+ *       40     8  descents: positions i with key[i] > key[i + 1] (if flagged)
+ *       48     8  duplicates: positions i with key[i] == key[i + 1] (if flagged)
+ *       56     8  reserved (0)
+ *
+ * A file with the sortedness flag and zero descents is known to be sorted,
+ * which lets the trees bulk-load it in one pass without sorting it first.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief How a dataset file is laid out
+ */
+enum class DatasetFormat {
+    Auto,       ///< Compact if the magic matches, else by extension (.i32, .i64, otherwise text)
+    Int32,
+    Int64,
+    Text,
+    Compact
+};
+
+/**
+ * @brief Display name of a format ("auto", "int32", "int64", "text", "compact")
+ */
+const char* datasetFormatName(DatasetFormat format);
+
+/**
+ * @brief Adjacent-pair statistics of a key sequence
+ */
+struct DatasetSortedness {
+    std::uint64_t descents = 0;    ///< Positions i with key[i] > key[i + 1]
+    std::uint64_t duplicates = 0;  ///< Positions i with key[i] == key[i + 1]
+
+    bool isAscending() const { return descents == 0; }
+    bool isStrictlyAscending() const { return descents == 0 && duplicates == 0; }
+};
+
+/**
+ * @brief What is known about an open dataset
+ */
+struct DatasetInfo {
+    DatasetFormat format = DatasetFormat::Auto;  ///< Resolved format (never Auto once open)
+    unsigned keyBytes = 0;         ///< Stored key width (8 for text)
+    bool hasCount = false;         ///< False for text until scan()
+    std::uint64_t count = 0;
+    bool hasRange = false;         ///< From the header or scan()
+    std::int64_t minKey = 0;
+    std::int64_t maxKey = 0;
+    bool hasSortedness = false;    ///< From the header or scan()
+    DatasetSortedness sortedness;
+    unsigned narrowShift = 0;      ///< Right shift applied to key - minKey (0 = keys exact)
+    bool narrowed = false;         ///< Keys are offset and shifted to fit an int
+};
+
+/// Receives consecutive keys of a read; return false to stop early
+using DatasetChunkSink = std::function<bool(const int* keys, size_t count)>;
+
+/// Same, with the keys at their stored width
+using DatasetWideSink = std::function<bool(const std::int64_t* keys, size_t count)>;
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Map a file (an empty file maps to size 0 and a null pointer)
+     *
+     * @return false if the file cannot be opened or mapped (see error())
+     */
+    bool open(const std::string& path);
+    void close();
+
+    const std::uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool isOpen() const { return m_open; }
+    const std::string& error() const { return m_error; }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+    std::string m_error;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+/**
+ * @brief Opens a dataset file and reads its keys in chunks
+ *
+ * Reads keep the file order. When a read is limited to fewer keys than the
+ * file holds, an evenly spaced sample is taken instead of a prefix, so the
+ * distribution of a huge file survives the cut. Text has to be scanned
+ * once before it is read (for its count and range), the other formats only
+ * when their keys need narrowing and the header has no range.
+ *
+ * Every reading call takes an optional cancel flag (e.g.
+ * JobToken::cancelledFlag()) that is polled once per chunk.
+ */
+class DatasetReader {
+public:
+    static constexpr size_t CHUNK_KEYS = 65536;              ///< Keys per sink call
+    static constexpr size_t TEXT_BUFFER_BYTES = 1u << 20;    ///< Text read size
+    static constexpr size_t NO_LIMIT = static_cast<size_t>(-1);
+    static constexpr size_t COMPACT_HEADER_BYTES = 64;
+    static constexpr std::uint16_t COMPACT_VERSION = 1;
+
+    DatasetReader() = default;
+    ~DatasetReader();
+
+    DatasetReader(const DatasetReader&) = delete;
+    DatasetReader& operator=(const DatasetReader&) = delete;
+
+    /**
+     * @brief Open a file and read its header, if it has one
+     *
+     * @return false if the file cannot be opened or does not match the format (see error())
+     */
+    bool open(const std::string& path, DatasetFormat format = DatasetFormat::Auto);
+    void close();
+
+    bool isOpen() const { return m_open; }
+    const DatasetInfo& info() const { return m_info; }
+    const std::string& error() const { return m_error; }
+
+    /**
+     * @brief Whether the keys are memory-mapped (random access, begin()/end())
+     */
+    bool isMapped() const { return m_open && m_info.format != DatasetFormat::Text; }
+
+    /**
+     * @brief One pass computing the count, range and sortedness
+     *
+     * Does nothing if all three are already known.
+     *
+     * @return false on a parse error or cancellation
+     */
+    bool scan(const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Settle how keys are narrowed, scanning for the range if it is needed and unknown
+     *
+     * Reads call this themselves; keyAt() and the iterators rely on it
+     * having been called.
+     */
+    bool prepare(const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Keys a read limited to maxKeys delivers (count must be known)
+     */
+    size_t sampledCount(size_t maxKeys) const;
+
+    /**
+     * @brief Read the keys as int, in file order
+     *
+     * @param sink Receives the keys chunk by chunk
+     * @param maxKeys Take an evenly spaced sample if the file has more keys
+     * @return false on a parse error, cancellation or if the sink stopped early
+     */
+    bool read(const DatasetChunkSink& sink, size_t maxKeys = NO_LIMIT,
+              const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Append the keys to a vector (reserved once)
+     */
+    bool readInto(std::vector<int>& out, size_t maxKeys = NO_LIMIT,
+                  const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Read every key at its stored width, never narrowed
+     */
+    bool readWide(const DatasetWideSink& sink, const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Forward iterator over the narrowed keys of a mapped file
+     */
+    class KeyIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = int;
+
+        KeyIterator() = default;
+        KeyIterator(const DatasetReader* reader, size_t index) : m_reader(reader), m_index(index) {}
+
+        int operator*() const { return m_reader->keyAt(m_index); }
+        KeyIterator& operator++() { ++m_index; return *this; }
+        KeyIterator operator++(int) { KeyIterator old = *this; ++m_index; return old; }
+        bool operator==(const KeyIterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const KeyIterator& other) const { return m_index != other.m_index; }
+
+    private:
+        const DatasetReader* m_reader = nullptr;
+        size_t m_index = 0;
+    };
+
+    /**
+     * @brief Iterators over a mapped file's keys (empty range if not mapped)
+     *
+     * Call prepare() first so the keys are narrowed like a read would.
+     */
+    KeyIterator begin() const { return KeyIterator(this, 0); }
+    KeyIterator end() const { return KeyIterator(this, isMapped() ? static_cast<size_t>(m_info.count) : 0); }
+
+    /**
+     * @brief Narrowed key at an index of a mapped file
+     */
+    int keyAt(size_t index) const;
+
+private:
+    /**
+     * @brief Stored key at an index of a mapped file
+     */
+    std::int64_t wideKeyAt(size_t index) const;
+
+    int narrow(std::int64_t key) const;
+
+    /**
+     * @brief Parse the text file from the start, calling onKey(key) per key
+     *
+     * @return false on a parse error, cancellation or if onKey returned false
+     */
+    bool streamText(const std::function<bool(std::int64_t)>& onKey, const std::atomic<bool>* cancel);
+
+    bool fail(std::string message);
+
+    std::string m_path;
+    MappedFile m_map;
+    const std::uint8_t* m_keys = nullptr;   ///< First key in the mapping
+    DatasetInfo m_info;
+    std::string m_error;
+    bool m_open = false;
+};
+
+/**
+ * @brief Streams keys into a compact dataset file
+ *
+ * open(), append() any number of times, then close(), which rewrites the
+ * header with the count, range and sortedness measured along the way.
+ */
+class CompactDatasetWriter {
+public:
+    CompactDatasetWriter() = default;
+    ~CompactDatasetWriter();
+
+    CompactDatasetWriter(const CompactDatasetWriter&) = delete;
+    CompactDatasetWriter& operator=(const CompactDatasetWriter&) = delete;
+
+    /**
+     * @brief Create the file (overwritten)
+     *
+     * @param keyBytes 4 or 8; appended keys must fit the width
+     * @return false if a file is already open, the width is invalid or the file cannot be created
+     */
+    bool open(const std::string& path, unsigned keyBytes);
+
+    /**
+     * @brief Append keys
+     *
+     * @return false if no file is open, a key does not fit the width or the write failed
+     */
+    bool append(const std::int64_t* keys, size_t count);
+
+    /**
+     * @brief Write the final header and close
+     *
+     * @return false if writing failed at any point since open()
+     */
+    bool close();
+
+    bool isOpen() const { return m_file != nullptr; }
+    std::uint64_t count() const { return m_count; }
+    const std::string& error() const { return m_error; }
+
+private:
+    bool writeHeader();
+
+    std::FILE* m_file = nullptr;
+    unsigned m_keyBytes = 0;
+    std::uint64_t m_count = 0;
+    std::int64_t m_min = 0;
+    std::int64_t m_max = 0;
+    std::int64_t m_last = 0;
+    DatasetSortedness m_sortedness;
+    std::vector<std::uint8_t> m_buffer;
+    bool m_failed = false;
+    std::string m_error;
+};
+
+} // namespace dsav::algorithms
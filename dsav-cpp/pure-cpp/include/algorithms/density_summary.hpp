@@ -0,0 +1,237 @@
+/**
+ * @file density_summary.hpp
+ * @brief Multi-resolution summaries of huge containers for minimap overviews
+ *
+ * ValueSummary keeps min / max / sum per bucket of a sequence (an array or
+ * a list in order) in a pyramid: level 0 buckets cover LEAF_SIZE elements
+ * and every level above merges pairs. Only the buckets over a changed range
+ * are recomputed, and a query for n columns reads the coarsest level that
+ * still has a bucket per column, so summarizing a million elements into a
+ * 256-pixel-wide image touches a few hundred buckets.
+ *
+ * TreeDensity counts a laid-out tree's nodes per depth and per cell of a
+ * depth x horizontal-position grid. Nodes are placed, moved and removed
+ * one at a time as the layout reports them; when the tree outgrows the
+ * grid, neighbouring cells are merged in place, without revisiting nodes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dsav::algorithms {
+
+// ===== Sequences =====
+
+/**
+ * @brief Aggregate of a run of values
+ */
+struct ValueBucket {
+    int min = 0;
+    int max = 0;
+    std::int64_t sum = 0;
+    std::uint32_t count = 0;
+
+    double mean() const { return count ? static_cast<double>(sum) / count : 0.0; }
+
+    /**
+     * @brief Fold another bucket into this one
+     */
+    void merge(const ValueBucket& other);
+};
+
+/**
+ * @brief Min / max / mean pyramid over a sequence of ints
+ */
+class ValueSummary {
+public:
+    static constexpr size_t LEAF_SIZE = 64;  ///< Elements per level-0 bucket
+
+    /**
+     * @brief Drop every bucket
+     */
+    void clear();
+
+    /**
+     * @brief Summarize a whole sequence from scratch
+     */
+    void rebuild(const int* data, size_t count);
+
+    /**
+     * @brief Bring the summary up to date after elements [first, last) changed
+     *
+     * If count differs from size(), everything from first on has moved and
+     * is recomputed.
+     *
+     * @param data The sequence after the change
+     * @param count Its length
+     */
+    void update(const int* data, size_t count, size_t first, size_t last);
+
+    /**
+     * @brief Update from the sequence before and after a change
+     *
+     * The changed range is whatever lies between the common prefix and the
+     * common suffix of the two, so a push, a pop or an edit in place only
+     * recomputes the buckets around it.
+     */
+    void updateFrom(const std::vector<int>& before, const std::vector<int>& after);
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    /**
+     * @brief Aggregate of the whole sequence (count 0 if empty)
+     */
+    ValueBucket total() const;
+
+    /**
+     * @brief Summarize [first, last) into columns buckets
+     *
+     * Uses the coarsest level that still has a bucket per column, so a
+     * column may take in up to one bucket beyond either edge.
+     *
+     * @param out Resized to columns (empty columns have count 0)
+     */
+    void query(size_t first, size_t last, size_t columns, std::vector<ValueBucket>& out) const;
+
+    /**
+     * @brief Bumped whenever a bucket changes
+     */
+    std::uint64_t version() const { return m_version; }
+
+    /**
+     * @brief Level-0 buckets recomputed by the last update
+     */
+    size_t lastRecomputed() const { return m_lastRecomputed; }
+
+private:
+    /**
+     * @brief Recompute level-0 buckets [firstLeaf, lastLeaf) and their ancestors
+     */
+    void refresh(const int* data, size_t firstLeaf, size_t lastLeaf);
+
+    std::vector<std::vector<ValueBucket>> m_levels;  ///< m_levels[k][i] covers LEAF_SIZE << k elements
+    size_t m_count = 0;
+    std::uint64_t m_version = 0;
+    size_t m_lastRecomputed = 0;
+};
+
+// ===== Trees =====
+
+/**
+ * @brief Per-depth node counts and a depth x position density grid of a laid-out tree
+ *
+ * Columns split the horizontal extent around the root; each row holds
+ * depthsPerRow() consecutive depths. Both double as the tree grows.
+ */
+class TreeDensity {
+public:
+    static constexpr size_t COLUMNS = 256;  ///< Grid columns (a multiple of 4, so merges stay aligned)
+    static constexpr size_t MAX_ROWS = 128; ///< Grid rows before depths are merged
+    static constexpr int ABSENT = -1;
+
+    /**
+     * @brief Forget every node and center the grid
+     *
+     * @param centerX World x the columns are centered on (the root's)
+     * @param columnWidth Initial world width of a column (about one node)
+     */
+    void reset(float centerX, float columnWidth);
+
+    /**
+     * @brief Add a node, or move it if already placed
+     *
+     * @param id Tree node id
+     * @param x World x of the node
+     * @param depth Depth (0 = root)
+     */
+    void place(std::uint32_t id, float x, int depth);
+
+    /**
+     * @brief Remove a node (ignored if not placed)
+     */
+    void remove(std::uint32_t id);
+
+    size_t size() const { return m_size; }
+    size_t columns() const { return COLUMNS; }
+
+    /**
+     * @brief Rows in use (at least one)
+     */
+    size_t rows() const;
+
+    size_t depthsPerRow() const { return m_depthsPerRow; }
+    std::uint32_t cell(size_t row, size_t column) const { return m_cells[row * COLUMNS + column]; }
+
+    /**
+     * @brief Largest cell count (0 if empty)
+     */
+    std::uint32_t maxCell() const;
+
+    /**
+     * @brief World width of a column
+     */
+    float columnWidth() const { return m_unit * static_cast<float>(m_unitsPerColumn); }
+
+    /**
+     * @brief World x of the left edge of column 0 and of the right edge of the last column
+     */
+    float left() const { return m_centerX - columnWidth() * (COLUMNS / 2); }
+    float right() const { return m_centerX + columnWidth() * (COLUMNS / 2); }
+
+    /**
+     * @brief Deepest depth that holds a node, plus one
+     */
+    size_t depthCount() const;
+
+    /**
+     * @brief Nodes at a depth
+     */
+    std::uint32_t nodesAtDepth(size_t depth) const {
+        return depth < m_depthCounts.size() ? m_depthCounts[depth] : 0;
+    }
+
+    /**
+     * @brief Bumped whenever a count changes
+     */
+    std::uint64_t version() const { return m_version; }
+
+private:
+    /**
+     * @brief Column of a quantized x, or COLUMNS if it lies outside the grid
+     */
+    size_t columnOf(std::int64_t units) const;
+
+    /**
+     * @brief Add (sign 1) or take away (sign -1) a placed node's counts
+     */
+    void count(std::uint32_t id, int sign);
+
+    /**
+     * @brief Double the column width, merging column pairs toward the center
+     */
+    void widenColumns();
+
+    /**
+     * @brief Double the depths per row, merging row pairs
+     */
+    void mergeRows();
+
+    std::vector<std::uint32_t> m_cells = std::vector<std::uint32_t>(COLUMNS * MAX_ROWS);
+    std::vector<std::uint32_t> m_depthCounts;   ///< Trailing zeros trimmed
+    std::vector<std::int64_t> m_nodeUnits;      ///< Node x in units from the center, indexed by node id
+    std::vector<int> m_nodeDepth;               ///< ABSENT if not placed
+    size_t m_size = 0;
+
+    // Positions are quantized to m_unit, so merged cells hold exactly the nodes that map to them
+    float m_centerX = 0.0f;
+    float m_unit = 1.0f;                        ///< Initial column width
+    std::int64_t m_unitsPerColumn = 1;          ///< Doubles as the tree widens
+    size_t m_depthsPerRow = 1;
+    std::uint64_t m_version = 0;
+};
+
+} // namespace dsav::algorithms
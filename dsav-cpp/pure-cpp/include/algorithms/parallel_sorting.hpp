@@ -0,0 +1,163 @@
+/**
+ * @file parallel_sorting.hpp
+ * @brief Multi-threaded merge and quick sort steppers
+ *
+ * Both steppers split each step into tasks and run them on a
+ * WorkStealingPool, so every step is one barrier-separated round: a whole
+ * merge level, or one partition of every pending quick sort range. Each step
+ * reports which lane processed which range (getLaneSpans()), which the
+ * visualizer colors to show load balance and merge-tree depth.
+ *
+ * Tasks never touch the recorder or the sorted marks; the stepper reports
+ * the ranges they rewrote from the calling thread once the round is done.
+ */
+
+#pragma once
+
+#include "algorithms/sorting.hpp"
+#include "algorithms/work_stealing_pool.hpp"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsav::algorithms {
+
+/// Most lanes a parallel stepper will use (one bar color each)
+constexpr size_t MAX_SORT_LANES = 8;
+
+/**
+ * @brief Range [begin, end) a lane processed during the last step
+ */
+struct LaneSpan {
+    std::uint32_t lane;
+    size_t begin;
+    size_t end;
+};
+
+/**
+ * @brief Lane count to use when none is requested (hardware threads, capped)
+ */
+size_t defaultSortLanes();
+
+/**
+ * @brief Parallel bottom-up merge sort step-by-step executor
+ *
+ * Each step merges every pair of runs of the current width. The output of
+ * a level is cut into chunks of `grain` elements and each chunk finds its
+ * slice of the two input runs by binary search (merge path), so the last
+ * levels, with only one or two merges, still split across all lanes.
+ */
+class ParallelMergeSortStepper {
+public:
+    /**
+     * @param arr Array to sort in place
+     * @param lanes Worker lanes (0 = defaultSortLanes())
+     * @param grain Elements per task (0 = enough to amortize the task overhead)
+     */
+    explicit ParallelMergeSortStepper(std::vector<int>& arr, size_t lanes = 0, size_t grain = 0);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    size_t getWidth() const { return m_width; }
+    size_t getDepth() const { return m_depth; }
+    size_t getLaneCount() const { return m_pool->laneCount(); }
+    const std::vector<LaneSpan>& getLaneSpans() const { return m_spans; }
+    const std::vector<size_t>& getLaneWork() const { return m_laneWork; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    size_t m_grain;
+    std::unique_ptr<WorkStealingPool> m_pool;
+    std::vector<int> m_buffer;                  // Output of the current level
+    std::vector<LaneSpan> m_spans;
+    std::vector<size_t> m_laneWork;             // Elements processed per lane, cumulative
+    size_t m_width = 1;                         // Run length merged by the next step
+    size_t m_depth = 0;                         // Levels merged so far
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief Parallel quick sort step-by-step executor
+ *
+ * Each step partitions every pending range in parallel, one task per range,
+ * around a median-of-three pivot with a three-way partition so runs of
+ * equal keys settle at once. Ranges of at most `grain` elements are sorted
+ * to completion inside their task instead of being split further.
+ */
+class ParallelQuickSortStepper {
+public:
+    /**
+     * @param arr Array to sort in place
+     * @param lanes Worker lanes (0 = defaultSortLanes())
+     * @param grain Ranges up to this size finish in one task (0 = automatic)
+     */
+    explicit ParallelQuickSortStepper(std::vector<int>& arr, size_t lanes = 0, size_t grain = 0);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    size_t getDepth() const { return m_depth; }
+    size_t getPendingRanges() const { return m_pending.size(); }
+    size_t getLaneCount() const { return m_pool->laneCount(); }
+    const std::vector<LaneSpan>& getLaneSpans() const { return m_spans; }
+    const std::vector<size_t>& getLaneWork() const { return m_laneWork; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    struct Range {
+        size_t begin;
+        size_t end;
+    };
+
+    /// Written by exactly one task, read back once the round is over
+    struct RangeResult {
+        std::uint32_t lane = 0;
+        size_t equalBegin = 0;      // Keys equal to the pivot: [equalBegin, equalEnd)
+        size_t equalEnd = 0;
+        bool finished = false;      // Whole range sorted inside the task
+        size_t comparisons = 0;
+        size_t swaps = 0;
+    };
+
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    size_t m_grain;
+    std::unique_ptr<WorkStealingPool> m_pool;
+    std::vector<Range> m_pending;               // Ranges the next step partitions
+    std::vector<LaneSpan> m_spans;
+    std::vector<size_t> m_laneWork;
+    size_t m_depth = 0;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+} // namespace dsav::algorithms
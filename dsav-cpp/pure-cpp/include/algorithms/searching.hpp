@@ -69,14 +69,32 @@ public:
      */
     int getResult() const { return m_result; }
 
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+    /**
+     * @brief Scan FAST_FORWARD_BLOCK elements per step with the vectorized kernel
+     *
+     * The result and comparison count are the same as checking one element
+     * per step; only the number of steps shrinks.
+     */
+    void setFastForward(bool enabled) { m_fastForward = enabled; }
+
+    /// Elements one fast-forward step scans
+    static constexpr size_t FAST_FORWARD_BLOCK = 4096;
+
 private:
     const std::vector<int>& m_arr;
     int m_target;
     size_t m_n;
+    bool m_fastForward = false;
     int m_currentIdx = 0;
     int m_result = -1;
     bool m_complete = false;
     SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
 };
 
 /**
@@ -135,6 +153,11 @@ public:
      */
     int getResult() const { return m_result; }
 
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
 private:
     const std::vector<int>& m_arr;
     int m_target;
@@ -145,6 +168,325 @@ private:
     int m_result = -1;
     bool m_complete = false;
     SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
+};
+
+/**
+ * @brief Branchless binary search step-by-step executor
+ *
+ * Halves the range every step without looking at whether the probe hit:
+ * the next base is picked with a conditional move instead of a branch, so
+ * every search of an array performs the same number of steps and the CPU
+ * never mispredicts. The last step checks the lower bound for equality.
+ * Assumes array is sorted; finds the first occurrence of the target.
+ */
+class BranchlessBinarySearchStepper {
+public:
+    /**
+     * @brief Construct stepper with sorted array and target
+     * @param arr Reference to sorted array to search
+     * @param target Value to search for
+     */
+    BranchlessBinarySearchStepper(const std::vector<int>& arr, int target);
+
+    /**
+     * @brief Execute one step of the algorithm
+     * @return true if more steps remain, false if search is complete
+     */
+    bool step();
+
+    /**
+     * @brief Reset to initial state
+     */
+    void reset();
+
+    /**
+     * @brief Get current state
+     */
+    SearchState getState() const { return m_state; }
+
+    /**
+     * @brief Get index read by the last step (-1 before the first)
+     */
+    int getProbeIndex() const { return m_probe; }
+
+    /**
+     * @brief Get start of the remaining range
+     */
+    int getBase() const { return static_cast<int>(m_base); }
+
+    /**
+     * @brief Get length of the remaining range
+     */
+    int getLength() const { return static_cast<int>(m_length); }
+
+    /**
+     * @brief Check if search is complete
+     */
+    bool isComplete() const { return m_complete; }
+
+    /**
+     * @brief Get result (-1 if not found, index if found)
+     */
+    int getResult() const { return m_result; }
+
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+private:
+    const std::vector<int>& m_arr;
+    int m_target;
+    size_t m_n;
+    size_t m_base = 0;
+    size_t m_length = 0;
+    int m_probe = -1;
+    int m_result = -1;
+    bool m_complete = false;
+    SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
+};
+
+/**
+ * @brief Reorder a sorted array into Eytzinger (breadth-first) layout
+ *
+ * Element k's children sit at 2k+1 and 2k+2, so the top levels of the
+ * implicit search tree share a few cache lines and each level's nodes are
+ * adjacent, which makes the next levels cheap to prefetch.
+ */
+std::vector<int> eytzingerLayout(const std::vector<int>& sorted);
+
+/**
+ * @brief Binary search over an Eytzinger-ordered array
+ *
+ * Descends the implicit tree one level per step, prefetching the cache
+ * line that holds the node's descendants four levels down. Finds the
+ * smallest element not less than the target, so duplicates resolve to the
+ * first occurrence in sorted order.
+ */
+class EytzingerSearchStepper {
+public:
+    /**
+     * @brief Construct stepper over an array built by eytzingerLayout()
+     * @param layout Reference to the Eytzinger-ordered array to search
+     * @param target Value to search for
+     */
+    EytzingerSearchStepper(const std::vector<int>& layout, int target);
+
+    /**
+     * @brief Execute one step of the algorithm
+     * @return true if more steps remain, false if search is complete
+     */
+    bool step();
+
+    /**
+     * @brief Reset to initial state
+     */
+    void reset();
+
+    /**
+     * @brief Get current state
+     */
+    SearchState getState() const { return m_state; }
+
+    /**
+     * @brief Get array index of the node read by the last step (-1 before the first)
+     */
+    int getNodeIndex() const { return m_probe; }
+
+    /**
+     * @brief Get tree depth of that node (root = 0)
+     */
+    int getDepth() const { return m_depth; }
+
+    /**
+     * @brief Check if search is complete
+     */
+    bool isComplete() const { return m_complete; }
+
+    /**
+     * @brief Get result (-1 if not found, index into the layout if found)
+     */
+    int getResult() const { return m_result; }
+
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+    /// Levels below the current node that each step prefetches
+    static constexpr size_t PREFETCH_LEVELS = 4;
+
+private:
+    const std::vector<int>& m_arr;
+    int m_target;
+    size_t m_n;
+    size_t m_node = 1;              // 1-based node number; array index is m_node - 1
+    int m_probe = -1;
+    int m_depth = -1;
+    int m_result = -1;
+    bool m_complete = false;
+    SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
+};
+
+/**
+ * @brief Interpolation search step-by-step executor
+ *
+ * Probes where the target would sit if the values in the remaining range
+ * were evenly spaced. Uniform data needs about log log n probes; skewed
+ * data can degrade to linear. Assumes array is sorted.
+ */
+class InterpolationSearchStepper {
+public:
+    /**
+     * @brief Construct stepper with sorted array and target
+     * @param arr Reference to sorted array to search
+     * @param target Value to search for
+     */
+    InterpolationSearchStepper(const std::vector<int>& arr, int target);
+
+    /**
+     * @brief Execute one step of the algorithm
+     * @return true if more steps remain, false if search is complete
+     */
+    bool step();
+
+    /**
+     * @brief Reset to initial state
+     */
+    void reset();
+
+    /**
+     * @brief Get current state
+     */
+    SearchState getState() const { return m_state; }
+
+    /**
+     * @brief Get index probed by the last step (-1 before the first)
+     */
+    int getProbeIndex() const { return m_probe; }
+
+    /**
+     * @brief Get current left bound
+     */
+    int getLeftBound() const { return m_left; }
+
+    /**
+     * @brief Get current right bound
+     */
+    int getRightBound() const { return m_right; }
+
+    /**
+     * @brief Check if search is complete
+     */
+    bool isComplete() const { return m_complete; }
+
+    /**
+     * @brief Get result (-1 if not found, index if found)
+     */
+    int getResult() const { return m_result; }
+
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+private:
+    const std::vector<int>& m_arr;
+    int m_target;
+    size_t m_n;
+    int m_left = 0;
+    int m_right = 0;
+    int m_probe = -1;
+    int m_result = -1;
+    bool m_complete = false;
+    SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
+};
+
+/**
+ * @brief Exponential search step-by-step executor
+ *
+ * Gallops through indices 1, 2, 4, 8, ... until it passes the target, then
+ * binary searches the last doubling interval. Costs O(log i) for a target
+ * at index i, so hits near the front stay cheap on huge arrays. Assumes
+ * array is sorted.
+ */
+class ExponentialSearchStepper {
+public:
+    /**
+     * @brief Construct stepper with sorted array and target
+     * @param arr Reference to sorted array to search
+     * @param target Value to search for
+     */
+    ExponentialSearchStepper(const std::vector<int>& arr, int target);
+
+    /**
+     * @brief Execute one step of the algorithm
+     * @return true if more steps remain, false if search is complete
+     */
+    bool step();
+
+    /**
+     * @brief Reset to initial state
+     */
+    void reset();
+
+    /**
+     * @brief Get current state
+     */
+    SearchState getState() const { return m_state; }
+
+    /**
+     * @brief Get index probed by the last step (-1 before the first)
+     */
+    int getProbeIndex() const { return m_probe; }
+
+    /**
+     * @brief Get left bound of the binary search phase (-1 while galloping)
+     */
+    int getLeftBound() const { return m_galloping ? -1 : m_left; }
+
+    /**
+     * @brief Get right bound of the binary search phase (-1 while galloping)
+     */
+    int getRightBound() const { return m_galloping ? -1 : m_right; }
+
+    /**
+     * @brief Check whether the search is still doubling its bound
+     */
+    bool isGalloping() const { return m_galloping; }
+
+    /**
+     * @brief Check if search is complete
+     */
+    bool isComplete() const { return m_complete; }
+
+    /**
+     * @brief Get result (-1 if not found, index if found)
+     */
+    int getResult() const { return m_result; }
+
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+private:
+    const std::vector<int>& m_arr;
+    int m_target;
+    size_t m_n;
+    size_t m_bound = 0;             // Next gallop probe (0 checks the first element)
+    bool m_galloping = true;
+    int m_left = 0;
+    int m_right = 0;
+    int m_probe = -1;
+    int m_result = -1;
+    bool m_complete = false;
+    SearchState m_state = SearchState::Idle;
+    size_t m_comparisons = 0;
 };
 
 } // namespace dsav::algorithms
@@ -0,0 +1,76 @@
+/**
+ * @file simd_kernels.hpp
+ * @brief Vectorized fast paths for the steppers' inner loops
+ *
+ * Kernels for partition, merge and linear search that the steppers switch
+ * to in fast-forward mode, where nothing observes individual element
+ * operations. The implementation is picked once at runtime: AVX2 on x86
+ * CPUs that report it, NEON on ARMv8 (where it is always present), and
+ * portable scalar code everywhere else. Every kernel produces the same
+ * result at every level.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace dsav::algorithms::simd {
+
+/**
+ * @brief Instruction set the kernels run on
+ */
+enum class SimdLevel {
+    Scalar,
+    Avx2,
+    Neon
+};
+
+/**
+ * @brief Level currently used by the kernels (detected on first use)
+ */
+SimdLevel activeLevel();
+
+/**
+ * @brief Best level the CPU supports
+ */
+SimdLevel detectedLevel();
+
+/**
+ * @brief Use a specific level (e.g. Scalar to compare against the vector paths)
+ *
+ * @return false if the CPU or the build does not support it (level unchanged)
+ */
+bool setLevel(SimdLevel level);
+
+/**
+ * @brief Display name of a level ("scalar", "avx2", "neon")
+ */
+const char* levelName(SimdLevel level);
+
+/**
+ * @brief Index of the first element equal to target
+ *
+ * @return Index in [0, n), or n if target does not occur
+ */
+size_t findEqual(const int* data, size_t n, int target);
+
+/**
+ * @brief Partition data[0, n) so every element below pivot comes first
+ *
+ * Elements below the pivot keep their relative order, as do the rest.
+ *
+ * @param scratch Buffer of at least n elements
+ * @return Number of elements below the pivot
+ */
+size_t partitionLess(int* data, size_t n, int pivot, int* scratch);
+
+/**
+ * @brief Merge sorted a[0, lenA) and b[0, lenB) into out
+ *
+ * Blocks are merged through a bitonic network; out must not overlap the inputs.
+ *
+ * @return Number of comparisons a scalar merge of the same inputs would need
+ */
+size_t merge(const int* a, size_t lenA, const int* b, size_t lenB, int* out);
+
+} // namespace dsav::algorithms::simd
@@ -0,0 +1,111 @@
+/**
+ * @file snapshot.hpp
+ * @brief Compact binary snapshots of container contents, for saving and restoring sessions
+ *
+ * A snapshot stores exactly what a container needs to be rebuilt in O(n):
+ * arrays, stacks and queues as their raw element buffer, red-black trees as
+ * their keys in preorder plus one color bit per key, which pins down the
+ * shape so the tree is relinked as saved instead of being rebalanced.
+ * Snapshots are written in one pass and read back through a memory mapping,
+ * and on little-endian hosts the elements are copied out with a single
+ * memcpy.
+ *
+ * Format (all fields little-endian):
+ *
+ *   offset  size  field
+ *        0     8  magic "DSAVSNAP"
+ *        8     2  version (1)
+ *       10     1  container kind (SnapshotKind)
+ *       11     1  element width in bytes (4, int32)
+ *       12     4  offset of the first element (32)
+ *       16     8  element count
+ *       24     8  reserved (0)
+ *       32        elements: array in index order, stack bottom to top,
+ *                 queue front to back, tree keys in preorder
+ *
+ * Tree snapshots are followed by (count + 7) / 8 color bytes; bit i % 8 of
+ * byte i / 8 is set when the i-th preorder node is RED.
+ */
+
+#pragma once
+
+#include "algorithms/dataset_import.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Container a snapshot was taken of
+ */
+enum class SnapshotKind : std::uint8_t {
+    DynamicArray = 1,
+    Stack = 2,
+    Queue = 3,
+    RedBlackTree = 4
+};
+
+/**
+ * @brief Display name of a kind ("array", "stack", "queue", "red-black tree")
+ */
+const char* snapshotKindName(SnapshotKind kind);
+
+constexpr std::uint16_t SNAPSHOT_VERSION = 1;
+constexpr size_t SNAPSHOT_HEADER_BYTES = 32;
+
+/**
+ * @brief Write a snapshot file (overwritten)
+ *
+ * @param colorBits Tree snapshots only: (count + 7) / 8 color bytes (may be null when count is 0)
+ * @param error Receives the reason on failure
+ * @return false if the file cannot be written or the color bits do not match the count
+ */
+bool writeSnapshot(const std::string& path, SnapshotKind kind, const int* elements, size_t count,
+                   const std::uint8_t* colorBits, std::string& error);
+
+/**
+ * @brief Maps a snapshot file and hands out its elements
+ */
+class SnapshotReader {
+public:
+    /**
+     * @brief Map a snapshot and check its header against the file size
+     *
+     * @return false if the file is missing, not a snapshot, of another version or truncated (see error())
+     */
+    bool open(const std::string& path);
+    void close();
+
+    /**
+     * @brief Check that the open snapshot was taken of the given container
+     *
+     * @return false (with error() naming both kinds) if it was not
+     */
+    bool expect(SnapshotKind kind);
+
+    SnapshotKind kind() const { return m_kind; }
+    size_t count() const { return m_count; }
+
+    /**
+     * @brief Copy the elements out (count() of them)
+     */
+    void readElements(std::vector<int>& out) const;
+
+    /**
+     * @brief Color bytes of a tree snapshot (nullptr for other kinds)
+     */
+    const std::uint8_t* colorBits() const;
+
+    const std::string& error() const { return m_error; }
+
+private:
+    MappedFile m_file;
+    SnapshotKind m_kind = SnapshotKind::DynamicArray;
+    size_t m_count = 0;
+    size_t m_offset = 0;        ///< Offset of the first element
+    std::string m_error;
+};
+
+} // namespace dsav::algorithms
@@ -0,0 +1,178 @@
+/**
+ * @file sort_race.hpp
+ * @brief Several sorting steppers racing on copies of the same input
+ *
+ * Every lane copies the input, constructs its stepper and waits at a
+ * common start signal; then each lane steps its algorithm to completion on
+ * its own thread. Counters are published every few hundred steps, and a
+ * lane copies its array into a snapshot buffer only when the reader has
+ * taken the previous one, so a lane never blocks on the UI and the UI never
+ * reads an array that is being sorted.
+ *
+ * Lanes share the machine's cores, so with more lanes than hardware
+ * threads the wall times include time spent waiting for a core.
+ */
+
+#pragma once
+
+#include "algorithms/sort_trace.hpp"
+#include "algorithms/sorting.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dsav::algorithms {
+
+constexpr size_t SORT_ALGORITHM_COUNT = 12;
+
+/**
+ * @brief Display name, e.g. "Merge Sort"
+ */
+const char* sortAlgorithmName(SortAlgorithm algorithm);
+
+/**
+ * @brief Progress of one lane
+ */
+enum class SortRaceState {
+    Running,
+    Finished,   ///< Stepper ran to completion
+    Stopped     ///< Cancelled by stop()
+};
+
+/**
+ * @brief Counters of one lane (final once the lane is no longer Running)
+ */
+struct SortRaceLaneStats {
+    SortRaceState state = SortRaceState::Running;
+    size_t steps = 0;
+    size_t comparisons = 0;
+    size_t swaps = 0;
+    double seconds = 0.0;       ///< Wall time since the start signal
+    bool sorted = false;        ///< Result passed std::is_sorted (Finished lanes only)
+};
+
+/**
+ * @brief Copy of a lane's array, taken between two of its steps
+ */
+struct SortRaceSnapshot {
+    std::vector<int> values;
+    SortedMarks marks;          ///< Stepper's sorted positions at the same moment
+    size_t steps = 0;           ///< Steps taken when the copy was made
+};
+
+/**
+ * @brief Up to MAX_LANES sorting steppers, one thread each
+ */
+class SortRace {
+public:
+    static constexpr size_t MAX_LANES = 5;
+    static constexpr size_t PUBLISH_INTERVAL = 256;  ///< Steps between counter updates, snapshots and cancel checks
+    static constexpr double PACE_TICKS_PER_SECOND = 120.0;  ///< Sleeps per second of a paced lane
+
+    SortRace() = default;
+    ~SortRace();
+
+    SortRace(const SortRace&) = delete;
+    SortRace& operator=(const SortRace&) = delete;
+
+    /**
+     * @brief Start one lane per algorithm on a copy of input
+     *
+     * Stops and joins a previous race first. Returns once every lane has
+     * constructed its stepper and the start signal has been given.
+     *
+     * @param input Array every lane sorts
+     * @param algorithms One entry per lane (1..MAX_LANES; repeats are allowed)
+     * @param stepsPerSecond Pace of every lane (0 = as fast as possible)
+     * @return false if the lane count is out of range (see error())
+     */
+    bool start(const std::vector<int>& input, const std::vector<SortAlgorithm>& algorithms,
+               double stepsPerSecond = 0.0);
+
+    /**
+     * @brief Cancel the running lanes and join every thread
+     */
+    void stop();
+
+    /**
+     * @brief Check whether any lane is still running
+     */
+    bool isRunning() const;
+
+    size_t laneCount() const { return m_lanes.size(); }
+    size_t inputSize() const { return m_input.size(); }
+    SortAlgorithm algorithm(size_t lane) const { return m_lanes[lane]->algorithm; }
+
+    /**
+     * @brief Latest published counters of a lane (any thread)
+     */
+    SortRaceLaneStats stats(size_t lane) const;
+
+    /**
+     * @brief Swap in the lane's newest snapshot, if one arrived since the last call
+     *
+     * Taking a snapshot asks the lane for the next one. The buffers in
+     * snapshot are reused by the lane, so callers keep one per lane.
+     *
+     * @return false if nothing new was published
+     */
+    bool takeSnapshot(size_t lane, SortRaceSnapshot& snapshot);
+
+    const std::string& error() const { return m_error; }
+
+private:
+    struct Lane {
+        SortAlgorithm algorithm = SortAlgorithm::Bubble;
+        std::thread thread;
+        std::vector<int> array;
+
+        // Published by the lane thread
+        std::atomic<SortRaceState> state{SortRaceState::Running};
+        std::atomic<size_t> steps{0};
+        std::atomic<size_t> comparisons{0};
+        std::atomic<size_t> swaps{0};
+        std::atomic<std::int64_t> elapsedNs{0};
+        bool sorted = false;                        ///< Written before state leaves Running
+
+        // Snapshot hand-off
+        std::mutex snapshotMutex;
+        SortRaceSnapshot snapshot;                  ///< Guarded by snapshotMutex
+        std::atomic<bool> snapshotWanted{true};     ///< Reader took the last one
+        std::atomic<bool> snapshotReady{false};     ///< A newer one is waiting
+    };
+
+    /**
+     * @brief Thread body: build the stepper for the lane's algorithm and run it
+     */
+    void runLane(Lane& lane);
+
+    /**
+     * @brief Step one stepper type to completion, publishing as it goes
+     */
+    template<typename Stepper>
+    void drive(Lane& lane);
+
+    /**
+     * @brief Copy the lane's array and marks into its snapshot buffer
+     */
+    static void publishSnapshot(Lane& lane, const SortedMarks& marks, size_t steps);
+
+    void joinAll();
+
+    std::vector<std::unique_ptr<Lane>> m_lanes;
+    std::vector<int> m_input;                        ///< Read by every lane before the start signal
+    double m_stepsPerSecond = 0.0;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::atomic<size_t> m_ready{0};                  ///< Lanes waiting at the start signal
+    std::atomic<bool> m_go{false};
+    std::atomic<bool> m_cancel{false};
+    std::string m_error;
+};
+
+} // namespace dsav::algorithms
@@ -0,0 +1,225 @@
+/**
+ * @file sort_trace.hpp
+ * @brief Precomputed operation traces for the sorting steppers
+ *
+ * Instead of interleaving the algorithm with UI pacing, a trace runs a
+ * stepper to completion up front on a copy of the input and records every
+ * compare, swap, write, range marker and sorted mark into one flat buffer.
+ * TracePlayer then replays that buffer onto the visualized array any
+ * number of operations at a time, so every algorithm steps at the same
+ * granularity and the per-frame cost does not depend on the algorithm.
+ *
+ * Generation only touches its own copy of the array, so it can run on a
+ * worker thread.
+ */
+
+#pragma once
+
+#include "algorithms/sorting.hpp"
+#include "algorithms/parallel_sorting.hpp"
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Sorting algorithms a trace can be generated for
+ */
+enum class SortAlgorithm : std::uint8_t {
+    Bubble,
+    Selection,
+    Insertion,
+    Merge,
+    Quick,
+    Heap,
+    Shell,
+    Radix,
+    Counting,
+    Intro,
+    ParallelMerge,
+    ParallelQuick
+};
+
+/**
+ * @brief Kind of a recorded operation
+ */
+enum class TraceOpKind : std::uint8_t {
+    Compare,        ///< a, b: compared indices
+    Swap,           ///< a, b: exchanged indices
+    Write,          ///< a: index, b: value written
+    Range,          ///< [a, b): sub-range the algorithm moved on to
+    Mark,           ///< a: index reached its final position
+    MarkAll         ///< Whole array is sorted
+};
+
+/**
+ * @brief One recorded operation, packed into 8 bytes
+ *
+ * The kind lives in the top bits of the first operand; indices are limited
+ * to MAX_INDEX, far beyond any array the visualizer can show.
+ */
+class TraceOp {
+public:
+    static constexpr std::uint32_t KIND_SHIFT = 29;
+    static constexpr std::uint32_t MAX_INDEX = (std::uint32_t{1} << KIND_SHIFT) - 1;
+
+    TraceOp(TraceOpKind kind, size_t a, std::int32_t b)
+        : m_word((static_cast<std::uint32_t>(kind) << KIND_SHIFT) | static_cast<std::uint32_t>(a)),
+          m_b(b) {}
+
+    TraceOpKind kind() const { return static_cast<TraceOpKind>(m_word >> KIND_SHIFT); }
+    size_t a() const { return m_word & MAX_INDEX; }
+    std::int32_t b() const { return m_b; }
+
+    /**
+     * @brief Check whether the op is shown as a step (compare, swap or write)
+     */
+    bool isVisible() const { return kind() <= TraceOpKind::Write; }
+
+private:
+    std::uint32_t m_word;
+    std::int32_t m_b;
+};
+
+/**
+ * @brief Flat buffer of the operations of one complete sort
+ */
+class SortTrace : public StepRecorder {
+public:
+    /// Generation gives up beyond this many operations (256 MB of trace)
+    static constexpr size_t MAX_OPS = size_t(32) << 20;
+
+    /**
+     * @brief Run an algorithm to completion on input and record its trace
+     *
+     * @param algorithm Algorithm to run
+     * @param input Initial array (consumed; the sorted result is discarded)
+     * @param cancel Optional flag polled between steps to abandon generation
+     * @return false if cancelled, the input is too large to index, or the
+     *         trace exceeds MAX_OPS (the trace is left empty)
+     */
+    bool generate(SortAlgorithm algorithm, std::vector<int> input,
+                  const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief Record the swaps that carry out a known sorting permutation
+     *
+     * For sorts that only hand back their result (e.g. the assembly
+     * kernels): slot i receives the element that started at source[i].
+     * Slots are filled left to right, each with at most one swap, and
+     * marked sorted as they are filled; no compares are recorded.
+     *
+     * @param source Original index of the element that belongs in each slot
+     *               (a permutation of 0 .. source.size() - 1)
+     * @return false if the array is too large to index or the trace exceeds
+     *         MAX_OPS (the trace is left empty)
+     */
+    bool generateFromPermutation(const std::vector<size_t>& source);
+
+    /**
+     * @brief Drop all operations
+     */
+    void clear();
+
+    const std::vector<TraceOp>& ops() const { return m_ops; }
+    size_t size() const { return m_ops.size(); }
+    bool empty() const { return m_ops.empty(); }
+
+    /**
+     * @brief Length of the array the trace was generated for
+     */
+    size_t arraySize() const { return m_arraySize; }
+
+    /**
+     * @brief Number of compare/swap/write operations (replayable steps)
+     */
+    size_t visibleOps() const { return m_visibleOps; }
+
+    size_t memoryUsage() const { return m_ops.capacity() * sizeof(TraceOp); }
+
+    // StepRecorder
+    void onWrite(size_t index, int value) override;
+    void onSwap(size_t i, size_t j) override;
+    void onMark(size_t begin, size_t end) override;
+    void onMarkAll() override;
+    void onCompare(size_t i, size_t j) override;
+    void onRange(size_t begin, size_t end) override;
+
+private:
+    template <typename Stepper>
+    bool record(std::vector<int>& arr, const std::atomic<bool>* cancel);
+
+    void push(TraceOpKind kind, size_t a, std::int32_t b);
+
+    std::vector<TraceOp> m_ops;
+    size_t m_arraySize = 0;
+    size_t m_visibleOps = 0;
+    bool m_overflowed = false;     ///< Set once MAX_OPS is reached during generate()
+};
+
+/**
+ * @brief Replays a SortTrace onto an array
+ */
+class TracePlayer {
+public:
+    /**
+     * @brief Start replaying a trace from its first operation
+     *
+     * The trace must outlive the player (or the next reset()).
+     */
+    void reset(const SortTrace* trace);
+
+    /**
+     * @brief Apply the next `visibleCount` compare/swap/write ops to arr
+     *
+     * Range and mark ops in between are applied along with them. Array
+     * changes and marks are forwarded to recorder when one is given.
+     *
+     * @return true if operations remain
+     */
+    bool advance(size_t visibleCount, std::vector<int>& arr, StepRecorder* recorder = nullptr);
+
+    /**
+     * @brief Check whether every operation has been applied
+     */
+    bool isComplete() const { return !m_trace || m_next >= m_trace->size(); }
+
+    /**
+     * @brief Last compare/swap/write applied (nullptr before the first)
+     */
+    const TraceOp* lastOp() const { return m_lastOp; }
+
+    /**
+     * @brief Range most recently announced by a Range op ([0, 0) if none)
+     */
+    size_t rangeBegin() const { return m_rangeBegin; }
+    size_t rangeEnd() const { return m_rangeEnd; }
+
+    /**
+     * @brief Sorted marks applied so far
+     */
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+
+    /**
+     * @brief Operations applied so far, and the trace length
+     */
+    size_t position() const { return m_next; }
+    size_t size() const { return m_trace ? m_trace->size() : 0; }
+
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+
+private:
+    const SortTrace* m_trace = nullptr;
+    size_t m_next = 0;
+    const TraceOp* m_lastOp = nullptr;
+    size_t m_rangeBegin = 0;
+    size_t m_rangeEnd = 0;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+} // namespace dsav::algorithms
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "algorithms/step_recorder.hpp"
 #include <vector>
 #include <functional>
+#include <cstddef>
+#include <cstdint>
 
 namespace dsav::algorithms {
 
@@ -23,6 +26,72 @@ enum class SortState {
     Idle            ///< No active operation
 };
 
+/**
+ * @brief Set of array indices known to be in their final sorted position
+ *
+ * Most sorts grow one contiguous sorted block (bubble sort's suffix,
+ * selection and insertion sort's prefix), which is kept as a [begin, end)
+ * range; positions outside it (quick sort pivots, merge runs) go into a
+ * bitset. mark() and isSorted() are O(1).
+ */
+class SortedMarks {
+public:
+    /**
+     * @brief Size for an array of n elements and clear all marks
+     */
+    void resize(size_t n);
+
+    /**
+     * @brief Clear all marks (keeps the size)
+     */
+    void clear();
+
+    /**
+     * @brief Mark one index as sorted
+     */
+    void mark(size_t i);
+
+    /**
+     * @brief Mark every index in [begin, end) as sorted
+     */
+    void markRange(size_t begin, size_t end);
+
+    /**
+     * @brief Mark the whole array as sorted
+     */
+    void markAll();
+
+    /**
+     * @brief Check whether an index is in its final position
+     */
+    bool isSorted(size_t i) const {
+        return m_all
+            || (i >= m_rangeBegin && i < m_rangeEnd)
+            || (i < m_n && ((m_bits[i >> 6] >> (i & 63)) & 1u));
+    }
+
+    /**
+     * @brief Number of indices marked sorted
+     */
+    size_t count() const { return m_count; }
+
+    size_t size() const { return m_n; }
+
+    /**
+     * @brief Report newly marked indices to a recorder (nullptr to detach)
+     */
+    void setRecorder(StepRecorder* recorder) { m_recorder = recorder; }
+
+private:
+    StepRecorder* m_recorder = nullptr;
+    std::vector<std::uint64_t> m_bits;  ///< Marks outside the contiguous range
+    size_t m_n = 0;
+    size_t m_rangeBegin = 0;            ///< Contiguous sorted block [begin, end)
+    size_t m_rangeEnd = 0;
+    size_t m_count = 0;
+    bool m_all = false;
+};
+
 /**
  * @brief Bubble Sort step-by-step executor
  *
@@ -65,12 +134,38 @@ public:
     bool isComplete() const { return m_sorted; }
 
     /**
-     * @brief Get indices that are known to be in final sorted position
+     * @brief Check if an index is known to be in final sorted position (O(1))
+     */
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+
+    /**
+     * @brief Get all indices known to be in final sorted position
+     */
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+
+    /**
+     * @brief Get number of element comparisons performed so far
+     */
+    size_t getComparisons() const { return m_comparisons; }
+
+    /**
+     * @brief Get number of element swaps performed so far
+     *
+     * Shift- and merge-based sorts count element moves instead.
      */
-    const std::vector<int>& getSortedIndices() const { return m_sortedIndices; }
+    size_t getSwaps() const { return m_swaps; }
+
+    /**
+     * @brief Report array writes and sorted marks to a recorder (nullptr to detach)
+     */
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
 
 private:
     std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;  // Optional change observer
     size_t m_n;
     size_t m_i = 0;
     size_t m_j = 0;
@@ -79,7 +174,9 @@ private:
     SortState m_state = SortState::Idle;
     int m_currentI = -1;
     int m_currentJ = -1;
-    std::vector<int> m_sortedIndices;  // Indices known to be sorted
+    SortedMarks m_sortedMarks;         // Indices known to be sorted
+    size_t m_comparisons = 0;          // Element comparisons performed
+    size_t m_swaps = 0;                // Element swaps performed
 };
 
 /**
@@ -99,10 +196,18 @@ public:
     int getMinIndex() const { return static_cast<int>(m_minIdx); }
     int getCompareIndex() const { return static_cast<int>(m_j); }
     bool isComplete() const { return m_sorted; }
-    const std::vector<int>& getSortedIndices() const { return m_sortedIndices; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
 
 private:
     std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
     size_t m_n;
     size_t m_i = 0;
     size_t m_j = 0;
@@ -110,7 +215,9 @@ private:
     bool m_findingMin = true;
     bool m_sorted = false;
     SortState m_state = SortState::Idle;
-    std::vector<int> m_sortedIndices;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
 };
 
 /**
@@ -129,17 +236,27 @@ public:
     int getCurrentIndex() const { return m_i; }
     int getCompareIndex() const { return m_j; }
     bool isComplete() const { return m_sorted; }
-    const std::vector<int>& getSortedIndices() const { return m_sortedIndices; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
 
 private:
     std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
     size_t m_n;
     int m_i = 1;
     int m_j = 0;
     int m_key = 0;
     bool m_sorted = false;
     SortState m_state = SortState::Idle;
-    std::vector<int> m_sortedIndices;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
 };
 
 /**
@@ -159,7 +276,20 @@ public:
     int getRightIndex() const { return m_currentRight; }
     int getMidIndex() const { return m_currentMid; }
     bool isComplete() const { return m_sorted; }
-    const std::vector<int>& getSortedIndices() const { return m_sortedIndices; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+    /**
+     * @brief Use the vectorized merge kernel while no recorder is attached
+     *
+     * Output and counters are identical to the scalar merge.
+     */
+    void setFastForward(bool enabled) { m_fastForward = enabled; }
 
 private:
     struct MergeRange {
@@ -171,7 +301,10 @@ private:
     void merge(int left, int mid, int right);
 
     std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
     size_t m_n;
+    std::vector<int> m_temp;                    // Merge output, reused across steps
+    bool m_fastForward = false;
     std::vector<MergeRange> m_stack;
     int m_currentSize = 1;
     int m_currentLeft = -1;
@@ -179,7 +312,9 @@ private:
     int m_currentMid = -1;
     bool m_sorted = false;
     SortState m_state = SortState::Idle;
-    std::vector<int> m_sortedIndices;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
 };
 
 /**
@@ -199,7 +334,21 @@ public:
     int getLeftIndex() const { return m_leftIdx; }
     int getRightIndex() const { return m_rightIdx; }
     bool isComplete() const { return m_sorted; }
-    const std::vector<int>& getSortedIndices() const { return m_sortedIndices; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+    /**
+     * @brief Use the vectorized partition kernel while no recorder is attached
+     *
+     * Pivot positions and counters match the scalar partition; keys on
+     * either side of the pivot may end up in a different order.
+     */
+    void setFastForward(bool enabled) { m_fastForward = enabled; }
 
 private:
     struct PartitionRange {
@@ -210,7 +359,10 @@ private:
     int partition(int low, int high);
 
     std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
     size_t m_n;
+    std::vector<int> m_scratch;                 // Fast-forward partition buffer
+    bool m_fastForward = false;
     std::vector<PartitionRange> m_stack;
     int m_pivotIdx = -1;
     int m_leftIdx = -1;
@@ -220,7 +372,290 @@ private:
     bool m_isPartitioning = false;
     bool m_sorted = false;
     SortState m_state = SortState::Idle;
-    std::vector<int> m_sortedIndices;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief Heap Sort step-by-step executor
+ *
+ * Builds a max-heap bottom-up, then repeatedly swaps the root to the end of
+ * the heap and sifts the new root down. Each step is one sift-down level or
+ * one root extraction.
+ */
+class HeapSortStepper {
+public:
+    explicit HeapSortStepper(std::vector<int>& arr);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    int getNodeIndex() const { return m_nodeIdx; }
+    int getChildIndex() const { return m_childIdx; }
+    int getHeapSize() const { return static_cast<int>(m_heapSize); }
+    bool isBuildingHeap() const { return m_building; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    void siftLevel();
+
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    size_t m_heapSize = 0;
+    size_t m_nextRoot = 0;         // Build phase: next subtree root to heapify, plus one
+    size_t m_sift = 0;             // Node being sifted down
+    bool m_sifting = false;
+    bool m_building = true;
+    int m_nodeIdx = -1;
+    int m_childIdx = -1;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief Shell Sort step-by-step executor
+ *
+ * Gapped insertion sort over the Ciura gap sequence (extended by a factor
+ * of 2.25 for large arrays), finishing with a plain insertion pass at gap 1.
+ * Each step is one comparison plus the shift or insert it decides.
+ */
+class ShellSortStepper {
+public:
+    explicit ShellSortStepper(std::vector<int>& arr);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    int getGap() const { return m_gapIdx < m_gaps.size() ? static_cast<int>(m_gaps[m_gapIdx]) : 0; }
+    int getCurrentIndex() const { return m_currentIdx; }
+    int getCompareIndex() const { return m_compareIdx; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    std::vector<size_t> m_gaps;    // Descending, ends with 1
+    size_t m_gapIdx = 0;
+    size_t m_i = 0;                // Element being inserted
+    size_t m_j = 0;                // Current slot of the element being inserted
+    int m_key = 0;
+    bool m_inserting = false;
+    int m_currentIdx = -1;
+    int m_compareIdx = -1;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief LSD Radix Sort step-by-step executor
+ *
+ * Sorts by one byte per pass, least significant first, with the sign bit
+ * flipped so negative values order correctly. Each pass counts the digit
+ * of every element (one element per step), then scatters a snapshot of
+ * the array back into it in stable digit order (one write per step).
+ * Passes whose byte is identical across the whole array are skipped.
+ *
+ * Radix sort does not compare elements; getComparisons() stays 0 and
+ * getSwaps() counts element writes.
+ */
+class RadixSortStepper {
+public:
+    static constexpr size_t RADIX_BITS = 8;
+    static constexpr size_t BUCKETS = size_t{1} << RADIX_BITS;
+
+    explicit RadixSortStepper(std::vector<int>& arr);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    int getPass() const { return static_cast<int>(m_shift / RADIX_BITS); }
+    int getCurrentIndex() const { return m_currentIdx; }
+    int getWriteIndex() const { return m_writeIdx; }
+    int getBucket() const { return m_bucket; }
+    bool isScattering() const { return m_scattering; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    static std::uint32_t key(int value) { return static_cast<std::uint32_t>(value) ^ 0x80000000u; }
+    size_t digit(int value) const { return (key(value) >> m_shift) & (BUCKETS - 1); }
+    void skipUniformBytes();
+
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    std::vector<int> m_snapshot;        // Array contents at the start of the scatter
+    std::vector<size_t> m_offsets;      // Bucket counts, then next write slot per bucket
+    std::uint32_t m_differing = 0;      // Key bits that are not the same in every element
+    size_t m_shift = 0;
+    size_t m_i = 0;
+    bool m_scattering = false;
+    int m_currentIdx = -1;
+    int m_writeIdx = -1;
+    int m_bucket = -1;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief Counting Sort step-by-step executor
+ *
+ * Histograms the values over [min, max] (one element per step), then
+ * rewrites the array from the histogram in order (one write per step),
+ * so every written position is final. Memory grows with the value range;
+ * ranges above MAX_RANGE fall back to sorting a key array instead.
+ *
+ * Counting sort does not compare elements; getComparisons() stays 0 and
+ * getSwaps() counts element writes.
+ */
+class CountingSortStepper {
+public:
+    /// Largest max - min the histogram is allowed to cover
+    static constexpr size_t MAX_RANGE = size_t{1} << 24;
+
+    explicit CountingSortStepper(std::vector<int>& arr);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    int getCurrentIndex() const { return m_currentIdx; }
+    int getWriteIndex() const { return m_writeIdx; }
+    bool isWriting() const { return m_writing; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    void startWriting();
+
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    std::int64_t m_min = 0;
+    std::vector<size_t> m_counts;       // Occurrences of min + k
+    std::vector<int> m_keys;            // Sorted values, only when the range exceeds MAX_RANGE
+    size_t m_value = 0;                 // Histogram slot being written out
+    size_t m_i = 0;
+    bool m_writing = false;
+    int m_currentIdx = -1;
+    int m_writeIdx = -1;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
+};
+
+/**
+ * @brief Introsort step-by-step executor
+ *
+ * Quick sort with a median-of-three pivot that switches to heap sort for a
+ * range once the recursion depth exceeds 2*log2(n), and leaves ranges of at
+ * most INSERTION_CUTOFF elements for a final insertion sort pass. Each step
+ * is one partition, one heap sort of a range, or one insertion.
+ */
+class IntroSortStepper {
+public:
+    static constexpr int INSERTION_CUTOFF = 16;
+
+    /**
+     * @brief What the last step did
+     */
+    enum class Phase {
+        Partition,      ///< Quick sort partition of [left, right]
+        HeapFallback,   ///< Depth limit hit: [left, right] was heap sorted
+        Insertion       ///< Final insertion pass over the whole array
+    };
+
+    explicit IntroSortStepper(std::vector<int>& arr);
+    bool step();
+    void reset();
+
+    SortState getState() const { return m_state; }
+    Phase getPhase() const { return m_phase; }
+    int getPivotIndex() const { return m_pivotIdx; }
+    int getLeftIndex() const { return m_leftIdx; }
+    int getRightIndex() const { return m_rightIdx; }
+    bool isComplete() const { return m_sorted; }
+    bool isSorted(size_t i) const { return m_sortedMarks.isSorted(i); }
+    const SortedMarks& getSortedMarks() const { return m_sortedMarks; }
+    size_t getComparisons() const { return m_comparisons; }
+    size_t getSwaps() const { return m_swaps; }
+    void setRecorder(StepRecorder* recorder) {
+        m_recorder = recorder;
+        m_sortedMarks.setRecorder(recorder);
+    }
+
+private:
+    struct IntroRange {
+        int low;
+        int high;
+        int depth;      // Partitions left before falling back to heap sort
+    };
+
+    bool less(int i, int j);
+    void swap(int i, int j);
+    int partition(int low, int high);
+    void heapSort(int low, int high);
+    void siftDown(int low, int root, int size);
+    bool insertNext();
+
+    std::vector<int>& m_arr;
+    StepRecorder* m_recorder = nullptr;
+    size_t m_n;
+    std::vector<IntroRange> m_stack;
+    int m_depthLimit = 0;
+    int m_insertIdx = 1;
+    Phase m_phase = Phase::Partition;
+    int m_pivotIdx = -1;
+    int m_leftIdx = -1;
+    int m_rightIdx = -1;
+    bool m_sorted = false;
+    SortState m_state = SortState::Idle;
+    SortedMarks m_sortedMarks;
+    size_t m_comparisons = 0;
+    size_t m_swaps = 0;
 };
 
 } // namespace dsav::algorithms
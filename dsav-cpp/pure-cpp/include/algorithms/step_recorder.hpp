@@ -0,0 +1,57 @@
+/**
+ * @file step_recorder.hpp
+ * @brief Observer interface for the array changes made by algorithm steppers
+ *
+ * Steppers report every array write and every newly sorted position to an
+ * optional recorder, plus the comparisons and sub-ranges they work on.
+ * Nothing is reported (and nothing is paid beyond a null check) when no
+ * recorder is attached.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Receives the changes a stepper makes while it executes
+ */
+class StepRecorder {
+public:
+    virtual ~StepRecorder() = default;
+
+    /**
+     * @brief arr[index] was assigned value
+     */
+    virtual void onWrite(size_t index, int value) = 0;
+
+    /**
+     * @brief arr[i] and arr[j] were exchanged
+     */
+    virtual void onSwap(size_t i, size_t j) = 0;
+
+    /**
+     * @brief Indices [begin, end) reached their final sorted position
+     */
+    virtual void onMark(size_t begin, size_t end) = 0;
+
+    /**
+     * @brief The whole array is known to be sorted
+     */
+    virtual void onMarkAll() = 0;
+
+    /**
+     * @brief arr[i] and arr[j] were compared (optional)
+     */
+    virtual void onCompare(size_t /*i*/, size_t /*j*/) {}
+
+    /**
+     * @brief The stepper started working on indices [begin, end) (optional)
+     *
+     * Reported per merge by merge sort and per partition by quick sort.
+     */
+    virtual void onRange(size_t /*begin*/, size_t /*end*/) {}
+};
+
+} // namespace dsav::algorithms
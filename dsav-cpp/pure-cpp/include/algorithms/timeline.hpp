@@ -0,0 +1,183 @@
+/**
+ * @file timeline.hpp
+ * @brief Seekable step history for array algorithms
+ *
+ * Records what each stepper step changed (array writes and swaps, newly
+ * sorted positions, and the highlight cursor) as compact deltas, plus a
+ * keyframe of the array every few hundred steps. Seeking restores the
+ * nearest earlier keyframe and replays at most one keyframe interval of
+ * deltas, so stepping backwards never re-runs the algorithm.
+ *
+ * Keyframes are copy-on-write: the array is split into fixed-size chunks
+ * and a keyframe only copies the chunks written since the previous one,
+ * sharing the rest.
+ */
+
+#pragma once
+
+#include "algorithms/step_recorder.hpp"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Highlight state of a stepper after a step
+ *
+ * The meaning of the three indices is chosen by the visualizer for each
+ * algorithm (e.g. the compared pair, or a search's bounds and midpoint).
+ */
+struct StepCursor {
+    std::uint8_t state = 0;          ///< SortState/SearchState value
+    std::int32_t first = -1;
+    std::int32_t second = -1;
+    std::int32_t third = -1;
+};
+
+/**
+ * @brief Step history of one algorithm run over an int array
+ *
+ * Usage: begin() with the initial array, attach as the stepper's recorder,
+ * and commitStep() after every stepper step. While position() is behind
+ * the recorded frontier the stepper must not run; seek back to
+ * stepCount() to resume it.
+ */
+class ArrayTimeline : public StepRecorder {
+public:
+    /// Minimum steps between keyframes (grows with the array so keyframe bookkeeping stays O(1) per step)
+    static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 256;
+
+    /// Elements per copy-on-write chunk
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    /// Recording stops (and the history is dropped) beyond this many bytes
+    static constexpr size_t MAX_MEMORY_BYTES = size_t(256) << 20;
+
+    /**
+     * @brief Start a new history at step 0
+     *
+     * @param initial Array before the first step
+     * @param cursor Cursor to show at step 0
+     */
+    void begin(const std::vector<int>& initial, const StepCursor& cursor = StepCursor{});
+
+    /**
+     * @brief Mark indices [begin, end) as sorted from step 0 on
+     *
+     * For marks a stepper set before recording started (call after begin()).
+     */
+    void markInitial(size_t begin, size_t end);
+
+    /**
+     * @brief Drop the history
+     */
+    void clear();
+
+    /**
+     * @brief Close the step whose changes were reported since the last commit
+     *
+     * @param array Array after the step (used for keyframes)
+     * @param cursor Highlight state after the step
+     */
+    void commitStep(const std::vector<int>& array, const StepCursor& cursor);
+
+    /**
+     * @brief Move to a recorded step, rewriting array to match it
+     *
+     * @param step Target step (clamped to stepCount())
+     * @param array Array holding the state at position(); updated in place
+     */
+    void seek(size_t step, std::vector<int>& array);
+
+    // StepRecorder (only valid at the frontier)
+    void onWrite(size_t index, int value) override;
+    void onSwap(size_t i, size_t j) override;
+    void onMark(size_t begin, size_t end) override;
+    void onMarkAll() override;
+
+    /**
+     * @brief Check whether a history is being kept
+     */
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief Check whether the last history was dropped for exceeding MAX_MEMORY_BYTES
+     */
+    bool overflowed() const { return m_overflowed; }
+
+    /**
+     * @brief Number of recorded steps
+     */
+    size_t stepCount() const { return m_cursors.empty() ? 0 : m_cursors.size() - 1; }
+
+    /**
+     * @brief Step currently shown
+     */
+    size_t position() const { return m_position; }
+
+    /**
+     * @brief Check whether the shown step is the newest recorded one
+     */
+    bool atFrontier() const { return m_position == stepCount(); }
+
+    /**
+     * @brief Cursor at the shown step
+     */
+    const StepCursor& cursor() const { return m_cursors[m_position]; }
+
+    /**
+     * @brief Check whether an index is in its final position at the shown step
+     */
+    bool isSorted(size_t index) const {
+        return m_allMarkedAt <= m_position || (index < m_markedAt.size() && m_markedAt[index] <= m_position);
+    }
+
+    /**
+     * @brief Bytes held by deltas, cursors and keyframe chunks
+     */
+    size_t memoryUsage() const { return m_memory; }
+
+private:
+    using Chunk = std::shared_ptr<const std::vector<int>>;
+
+    /// High bit of ArrayDelta::index marks a swap (value holds the other index)
+    static constexpr std::uint32_t SWAP_FLAG = 0x80000000u;
+    static constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+    static constexpr size_t NO_KEYFRAME = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief One array change: a write, or a swap when SWAP_FLAG is set
+     */
+    struct ArrayDelta {
+        std::uint32_t index;
+        std::int32_t value;
+    };
+
+    void makeKeyframe(const std::vector<int>& array);
+    void restoreKeyframe(size_t keyframe, std::vector<int>& array);
+    void applyDeltas(size_t fromStep, size_t toStep, std::vector<int>& array);
+    void touchChunk(size_t index) { m_dirtyChunks[index / CHUNK_SIZE] = 1; }
+    void dropIfOverBudget();
+
+    bool m_active = false;
+    bool m_overflowed = false;
+    size_t m_size = 0;                              ///< Array length
+    size_t m_interval = DEFAULT_KEYFRAME_INTERVAL;  ///< Steps between keyframes
+    size_t m_position = 0;                          ///< Step currently shown
+
+    std::vector<ArrayDelta> m_deltas;               ///< Array changes of every step, in order
+    std::vector<size_t> m_stepEnd;                  ///< m_stepEnd[s]: end of step s's deltas (step 0 is empty)
+    std::vector<StepCursor> m_cursors;              ///< Cursor after each step (index 0 = initial)
+    std::vector<size_t> m_markedAt;                 ///< Step at which each index was marked sorted
+    size_t m_allMarkedAt = NEVER;                   ///< Step at which the whole array was marked sorted
+
+    std::vector<std::vector<Chunk>> m_keyframes;    ///< Keyframe k holds the array at step k * m_interval
+    size_t m_loadedKeyframe = NO_KEYFRAME;          ///< Keyframe the shown array was derived from
+    std::vector<std::uint8_t> m_dirtyChunks;        ///< Chunks changed since that keyframe
+    size_t m_memory = 0;
+};
+
+} // namespace dsav::algorithms
@@ -0,0 +1,71 @@
+/**
+ * @file work_stealing_pool.hpp
+ * @brief Fixed set of worker lanes that run batches of tasks with stealing
+ *
+ * Each lane is one thread (lane 0 is the thread calling run()) with its own
+ * task deque. A batch is dealt round-robin across the deques; a lane pops
+ * its own deque from the back and, once empty, steals from the front of the
+ * others, so uneven tasks (quick sort ranges) still keep every lane busy.
+ * run() returns when the whole batch has finished, which is the barrier the
+ * parallel steppers use between steps.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dsav::algorithms {
+
+class WorkStealingPool {
+public:
+    /// Task body; receives the index of the lane running it
+    using Task = std::function<void(size_t lane)>;
+
+    /**
+     * @brief Start lanes - 1 worker threads (the caller is lane 0)
+     *
+     * @param lanes Number of lanes (at least 1)
+     */
+    explicit WorkStealingPool(size_t lanes);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Run every task and wait for all of them to finish
+     *
+     * Not reentrant: tasks must not call run().
+     */
+    void run(std::vector<Task>& tasks);
+
+    size_t laneCount() const { return m_lanes.size(); }
+
+private:
+    struct Lane {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool runOne(size_t lane);
+    void workerLoop(size_t lane);
+
+    std::vector<std::unique_ptr<Lane>> m_lanes;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    size_t m_generation = 0;                  ///< Bumped once per run() to wake the workers
+    bool m_stopping = false;
+    std::atomic<size_t> m_remaining{0};       ///< Tasks of the current batch not yet finished
+};
+
+} // namespace dsav::algorithms
@@ -0,0 +1,158 @@
+/**
+ * @file workload_replay.hpp
+ * @brief Seekable replay of a workload script against a visualized container
+ *
+ * The replay applies ops through callbacks, so it works with any container
+ * that can apply an op without visuals and copy its contents out and back
+ * (the snapshot form: elements, plus color bits for a red-black tree).
+ * Like ArrayTimeline, it keeps a keyframe of the contents every few
+ * thousand ops as the replay passes them. Seeking restores the nearest
+ * keyframe at or before the target and applies at most one keyframe
+ * interval of ops, so jumping back in a million-op replay never re-runs
+ * it from the start.
+ *
+ * Every sampleEvery()-th op is left to the visualizer to animate; the ops
+ * in between are applied silently in batches.
+ */
+
+#pragma once
+
+#include "algorithms/workload_script.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Container contents at one point of a replay
+ */
+struct WorkloadKeyframe {
+    std::vector<int> elements;            ///< In snapshot order (index, bottom to top, front to back, preorder)
+    std::vector<std::uint8_t> colorBits;  ///< Red-black trees only, as RedBlackTree::exportPreorder()
+
+    size_t bytes() const { return elements.size() * sizeof(int) + colorBits.size(); }
+};
+
+/**
+ * @brief How a replay reaches the container
+ */
+struct WorkloadHooks {
+    std::function<bool(const WorkloadOp&)> apply;               ///< Apply one op without visuals (true on a hit)
+    std::function<void(WorkloadKeyframe&)> capture;             ///< Copy the contents out
+    std::function<void(const WorkloadKeyframe&)> restore;       ///< Replace the contents
+};
+
+/**
+ * @brief Position, keyframes and sampling of one replay
+ *
+ * Usage: begin() with the script; then, while not atEnd(), either
+ * runSilently() up to the next sampled op, or, when atSample(), animate
+ * current() on the visualizer, call beginSampled(), and commitSampled()
+ * once the animation (and any change it defers) has finished.
+ */
+class WorkloadReplay {
+public:
+    /// Fewest ops between keyframes (more for long scripts, so there are at most MAX_KEYFRAMES)
+    static constexpr size_t MIN_KEYFRAME_INTERVAL = 4096;
+    static constexpr size_t MAX_KEYFRAMES = 64;
+
+    /// No further keyframes are kept beyond this many bytes (seeking just replays further)
+    static constexpr size_t MAX_MEMORY_BYTES = size_t(128) << 20;
+
+    /**
+     * @brief Start a replay at op 0 from the container's current contents
+     *
+     * @param sampleEvery Animate every n-th op (0 = none)
+     */
+    void begin(std::shared_ptr<const WorkloadScript> script, WorkloadHooks hooks, size_t sampleEvery);
+
+    /**
+     * @brief Drop the replay and its keyframes (the contents stay as they are)
+     */
+    void clear();
+
+    bool isActive() const { return m_script != nullptr; }
+    size_t position() const { return m_position; }
+    size_t size() const { return m_script ? m_script->size() : 0; }
+    bool atEnd() const { return m_position >= size(); }
+
+    size_t sampleEvery() const { return m_sampleEvery; }
+    void setSampleEvery(size_t sampleEvery) { m_sampleEvery = sampleEvery; }
+
+    /**
+     * @brief Check whether the op at position() is one to animate
+     */
+    bool atSample() const {
+        return !atEnd() && m_sampleEvery > 0 && (m_position + 1) % m_sampleEvery == 0;
+    }
+
+    /**
+     * @brief Op at position() (only while !atEnd())
+     */
+    const WorkloadOp& current() const { return m_script->ops()[m_position]; }
+
+    /**
+     * @brief Apply ops silently, stopping before the next sampled op
+     *
+     * @param maxOps Most ops to apply
+     * @return Ops applied
+     */
+    size_t runSilently(size_t maxOps);
+
+    /**
+     * @brief Note that the visualizer is animating current()
+     */
+    void beginSampled() { m_sampleInFlight = true; }
+
+    /**
+     * @brief Count the animated op as applied
+     */
+    void commitSampled();
+
+    bool sampleInFlight() const { return m_sampleInFlight; }
+
+    /**
+     * @brief Move to a position, rewriting the contents to match it
+     *
+     * An animated op still in flight is abandoned (the caller clears its
+     * animations first), and the contents are restored from a keyframe.
+     *
+     * @param step Target position (clamped to size())
+     */
+    void seek(size_t step);
+
+    size_t keyframeInterval() const { return m_interval; }
+    size_t keyframeCount() const { return m_keyframes.size(); }
+
+    /**
+     * @brief Bytes held by keyframes
+     */
+    size_t memoryUsage() const { return m_memory; }
+
+    /**
+     * @brief Hits among the ops applied silently since begin() or the last seek
+     */
+    size_t silentHits() const { return m_silentHits; }
+
+private:
+    /**
+     * @brief Keep a keyframe if position() starts a new interval and the budget allows
+     */
+    void captureIfDue();
+
+    std::shared_ptr<const WorkloadScript> m_script;
+    WorkloadHooks m_hooks;
+    size_t m_position = 0;
+    size_t m_sampleEvery = 0;
+    bool m_sampleInFlight = false;
+    size_t m_silentHits = 0;
+
+    size_t m_interval = MIN_KEYFRAME_INTERVAL;
+    std::vector<WorkloadKeyframe> m_keyframes;     ///< Keyframe k holds the contents at op k * m_interval
+    size_t m_memory = 0;
+};
+
+} // namespace dsav::algorithms
@@ -0,0 +1,191 @@
+/**
+ * @file workload_script.hpp
+ * @brief Recorded operation sequences replayed against the containers
+ *
+ * A workload script is a list of operations, each an op code and an int
+ * operand, that reproduces an access pattern: a million mixed inserts,
+ * deletes and lookups against the red-black tree, or push/pop bursts
+ * against a stack or queue. The same three op codes drive every container
+ * (see workload_targets.hpp for what each one does to which container).
+ *
+ * Text format: one op per line, `#` starts a comment.
+ *
+ *   insert 42      (also: push 42, enqueue 42)
+ *   remove 42      (also: delete 42; pop and dequeue take no operand)
+ *   search 42      (also: find 42; peek takes no operand)
+ *
+ * Binary format (all fields little-endian), memory-mapped on load:
+ *
+ *   offset  size  field
+ *        0     8  magic "DSAVWKLD"
+ *        8     2  version (1)
+ *       10     2  record width in bytes (8)
+ *       12     4  offset of the first record (32)
+ *       16     8  op count
+ *       24     8  reserved (0)
+ *       32        records: op code (1 byte), 3 zero bytes, operand (int32)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dsav::algorithms {
+
+/**
+ * @brief What an op does (the meaning per container is in workload_targets.hpp)
+ */
+enum class WorkloadOpCode : std::uint8_t {
+    Insert = 1,
+    Remove = 2,
+    Search = 3
+};
+
+/**
+ * @brief Display name of an op code ("insert", "remove", "search")
+ */
+const char* workloadOpName(WorkloadOpCode code);
+
+/**
+ * @brief One recorded operation
+ */
+struct WorkloadOp {
+    WorkloadOpCode code = WorkloadOpCode::Insert;
+    std::int32_t operand = 0;     ///< Key or value (ignored by pop, dequeue and peek)
+};
+
+/**
+ * @brief How a workload file is laid out
+ */
+enum class WorkloadFormat {
+    Auto,       ///< Binary if the magic matches, else text
+    Text,
+    Binary
+};
+
+/**
+ * @brief Relative op frequencies and shape of a generated workload
+ */
+struct WorkloadMix {
+    unsigned insertWeight = 50;
+    unsigned removeWeight = 25;
+    unsigned searchWeight = 25;
+    size_t burst = 1;             ///< Ops of the same kind in a row (push/pop bursts)
+    std::int32_t keyRange = 0;    ///< Operands are drawn from [1, keyRange] (0 = the op count)
+};
+
+/**
+ * @brief An op sequence with its text and binary file forms
+ */
+class WorkloadScript {
+public:
+    static constexpr std::uint16_t VERSION = 1;
+    static constexpr size_t HEADER_BYTES = 32;
+    static constexpr size_t RECORD_BYTES = 8;
+
+    /**
+     * @brief Replace the ops with a file's
+     *
+     * @return false if the file cannot be read or has a malformed line or header (see error())
+     */
+    bool load(const std::string& path, WorkloadFormat format = WorkloadFormat::Auto);
+
+    /**
+     * @brief Write the ops to a file (overwritten)
+     *
+     * @param format Text or Binary (Auto writes binary)
+     */
+    bool save(const std::string& path, WorkloadFormat format = WorkloadFormat::Binary);
+
+    /**
+     * @brief Replace the ops with a random sequence
+     *
+     * Removes and searches draw their operands from the same range as the
+     * inserts, so their hit rate follows how full the container is.
+     */
+    void generate(size_t count, const WorkloadMix& mix, std::uint32_t seed);
+
+    void append(const WorkloadOp& op) { m_ops.push_back(op); }
+    void clear() { m_ops.clear(); }
+
+    const std::vector<WorkloadOp>& ops() const { return m_ops; }
+    size_t size() const { return m_ops.size(); }
+    bool empty() const { return m_ops.empty(); }
+
+    /**
+     * @brief Number of ops with a given code
+     */
+    size_t count(WorkloadOpCode code) const;
+
+    const std::string& error() const { return m_error; }
+
+private:
+    bool loadText(const std::string& path);
+    bool loadBinary(const std::string& path);
+
+    std::vector<WorkloadOp> m_ops;
+    std::string m_error;
+};
+
+// ===== Headless runs =====
+
+/**
+ * @brief Container a headless run applies a script to
+ */
+enum class WorkloadContainer {
+    DynamicArray,   ///< DynamicArray<int>: removes and searches are linear scans
+    Stack,          ///< Stack<int, DYNAMIC_CAPACITY>
+    Queue,          ///< Queue<int, DYNAMIC_CAPACITY>
+    RedBlackTree    ///< RedBlackTree<int>
+};
+
+constexpr size_t WORKLOAD_CONTAINER_COUNT = 4;
+
+/**
+ * @brief Display name, e.g. "red-black tree"
+ */
+const char* workloadContainerName(WorkloadContainer container);
+
+/**
+ * @brief Command-line key: "array", "stack", "queue" or "rbtree"
+ */
+const char* workloadContainerKey(WorkloadContainer container);
+
+/**
+ * @brief Look up a container by its command-line key
+ *
+ * @return false if the key is unknown
+ */
+bool parseWorkloadContainer(const std::string& key, WorkloadContainer& container);
+
+/**
+ * @brief What a headless run measured
+ */
+struct WorkloadResult {
+    size_t applied = 0;           ///< Ops run (all of them unless cancelled)
+    size_t hits = 0;              ///< Ops that found, added or removed something
+    size_t finalSize = 0;         ///< Elements left in the container
+    size_t batches = 0;
+    double seconds = 0.0;         ///< Time spent applying ops (batch timing excluded)
+    double batchP50Us = 0.0;      ///< Median batch time in microseconds
+    double batchP99Us = 0.0;
+    bool completed = false;       ///< false if cancelled
+
+    /// Applied ops per second
+    double opsPerSecond() const { return seconds > 0.0 ? static_cast<double>(applied) / seconds : 0.0; }
+};
+
+/**
+ * @brief Apply a script to a fresh container in batches, timing each batch
+ *
+ * @param batchSize Ops per timed batch (0 is treated as 1); cancel is checked between batches
+ * @return false if cancelled
+ */
+bool runWorkload(WorkloadContainer container, const WorkloadScript& script, size_t batchSize,
+                 WorkloadResult& result, const std::atomic<bool>* cancel = nullptr);
+
+} // namespace dsav::algorithms
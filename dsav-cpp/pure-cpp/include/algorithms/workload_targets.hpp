@@ -0,0 +1,89 @@
+/**
+ * @file workload_targets.hpp
+ * @brief What each workload op does to each container
+ *
+ *   op      array              stack / queue           red-black tree
+ *   insert  append operand     push / enqueue operand  insert operand
+ *   remove  delete first match pop / dequeue           delete operand
+ *   search  linear scan        peek                    lookup operand
+ *
+ * An op hits when it adds, removes or finds something: an insert of a key
+ * the tree already holds, a pop from an empty stack or a search for a
+ * missing key is a miss. Shared by the headless runner and the replaying
+ * visualizers, so both see the same contents after the same ops.
+ */
+
+#pragma once
+
+#include "algorithms/workload_script.hpp"
+#include "data_structures/dynamic_array.hpp"
+#include "data_structures/red_black_tree.hpp"
+
+namespace dsav::algorithms {
+
+/**
+ * @brief Apply an op to an array
+ *
+ * @return true on a hit
+ */
+inline bool applyArrayOp(DynamicArray<int>& array, const WorkloadOp& op) {
+    switch (op.code) {
+        case WorkloadOpCode::Insert:
+            array.pushBack(op.operand);
+            return true;
+        case WorkloadOpCode::Remove:
+            if (auto index = array.find(op.operand)) {
+                array.deleteAt(*index);
+                return true;
+            }
+            return false;
+        case WorkloadOpCode::Search:
+            return array.find(op.operand).has_value();
+    }
+    return false;
+}
+
+/**
+ * @brief Apply an op to anything with push/pop/peek (Stack, or a stack backend)
+ */
+template<typename StackLike>
+bool applyStackOp(StackLike& stack, const WorkloadOp& op) {
+    switch (op.code) {
+        case WorkloadOpCode::Insert: return stack.push(op.operand);
+        case WorkloadOpCode::Remove: return stack.pop().has_value();
+        case WorkloadOpCode::Search: return stack.peek().has_value();
+    }
+    return false;
+}
+
+/**
+ * @brief Apply an op to anything with enqueue/dequeue/peek (Queue, or a QueueBackend)
+ */
+template<typename QueueLike>
+bool applyQueueOp(QueueLike& queue, const WorkloadOp& op) {
+    switch (op.code) {
+        case WorkloadOpCode::Insert: return queue.enqueue(op.operand);
+        case WorkloadOpCode::Remove: return queue.dequeue().has_value();
+        case WorkloadOpCode::Search: return queue.peek().has_value();
+    }
+    return false;
+}
+
+/**
+ * @brief Apply an op to a red-black tree
+ */
+template<bool OrderStatistics>
+bool applyTreeOp(RedBlackTree<int, OrderStatistics>& tree, const WorkloadOp& op) {
+    switch (op.code) {
+        case WorkloadOpCode::Insert: {
+            size_t before = tree.size();
+            tree.insert(op.operand);
+            return tree.size() != before;
+        }
+        case WorkloadOpCode::Remove: return tree.remove(op.operand);
+        case WorkloadOpCode::Search: return tree.search(op.operand);
+    }
+    return false;
+}
+
+} // namespace dsav::algorithms
@@ -3,44 +3,71 @@
  * @brief Binary Search Tree data structure implementation
  *
  * A template-based binary search tree with visualization-friendly interface.
- * Maintains BST property: left child < parent < right child.
+ * Maintains BST property: left child < parent < right child. With the
+ * OrderStatistics parameter set, nodes also count their subtrees, which
+ * adds O(height) select(k), rank(value) and range counts.
  */
 
 #pragma once
 
-#include <memory>
+#include "node_pool.hpp"
+#include "op_counters.hpp"
+#include "tree_iterators.hpp"
+#include "order_statistics.hpp"
 #include <optional>
 #include <functional>
 #include <vector>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace dsav {
 
 /**
  * @brief Node structure for binary search tree
  *
+ * Links are pool indices (NULL_NODE when absent). The parent link lets
+ * traversals and deletion walk the tree without recursion.
+ *
  * @tparam T Type of data stored in the node
+ * @tparam OrderStatistics Also store the subtree size
  */
-template<typename T>
-struct TreeNode {
+template<typename T, bool OrderStatistics = false>
+struct TreeNode : SubtreeSize<OrderStatistics> {
+    using value_type = T;
+
     T data;
-    std::shared_ptr<TreeNode<T>> left;
-    std::shared_ptr<TreeNode<T>> right;
+    NodeIndex left;
+    NodeIndex right;
+    NodeIndex parent;
 
     explicit TreeNode(const T& value)
-        : data(value), left(nullptr), right(nullptr) {}
+        : data(value), left(NULL_NODE), right(NULL_NODE), parent(NULL_NODE) {}
+    explicit TreeNode(T&& value)
+        : data(std::move(value)), left(NULL_NODE), right(NULL_NODE), parent(NULL_NODE) {}
 };
 
+/// Handle to a BST node as exposed to visualizers
+template<typename T, bool OrderStatistics = false>
+using TreeNodeHandle = NodeHandle<TreeNode<T, OrderStatistics>>;
+
 /**
  * @brief Binary Search Tree data structure
  *
- * Template parameter:
+ * Template parameters:
  * - T: Type of elements stored in the tree
+ * - OrderStatistics: Maintain subtree sizes for select(), rank() and countInRange()
  *
  * Maintains BST property and provides operations for insertion, deletion, and searching.
+ * Nodes are stored in a NodePool, so no per-node heap allocation is performed.
  */
-template<typename T>
-class BinarySearchTree {
+template<typename T, bool OrderStatistics = false>
+class BinarySearchTree : public OpCounted {
 public:
+    using Node = TreeNode<T, OrderStatistics>;
+    using Handle = TreeNodeHandle<T, OrderStatistics>;
+
     /**
      * @brief Construct an empty BST
      */
@@ -49,11 +76,49 @@ public:
     /**
      * @brief Insert a value into the BST
      *
+     * Duplicate values are ignored.
+     *
      * @param value Value to insert
      */
     void insert(const T& value) {
-        m_root = insertRecursive(m_root, value);
-        m_size++;
+        insertValue(value);
+    }
+
+    /**
+     * @brief Move a value into the BST (duplicates are ignored and left untouched)
+     */
+    void insert(T&& value) {
+        insertValue(std::move(value));
+    }
+
+    /**
+     * @brief Construct a value and move it into the BST
+     *
+     * The key has to exist before the tree can be searched for its place,
+     * so this builds a T once and moves it into the new node.
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        insertValue(T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Delete a value from the BST and return it
+     *
+     * @param value Key to delete
+     * @return The stored value (moved out), or std::nullopt if not found
+     */
+    std::optional<T> extract(const T& value) {
+        NodeIndex target = searchIndex(value);
+        if (target == NULL_NODE) {
+            return std::nullopt;
+        }
+        std::optional<T> stored(std::move(m_pool[target].data));
+        countMoves();
+        removeNode(target);
+        return stored;
     }
 
     /**
@@ -63,9 +128,12 @@ public:
      * @return true if value was found and deleted, false otherwise
      */
     bool remove(const T& value) {
-        size_t oldSize = m_size;
-        m_root = removeRecursive(m_root, value);
-        return m_size < oldSize;
+        NodeIndex target = searchIndex(value);
+        if (target == NULL_NODE) {
+            return false;
+        }
+        removeNode(target);
+        return true;
     }
 
     /**
@@ -75,17 +143,17 @@ public:
      * @return true if found, false otherwise
      */
     bool search(const T& value) const {
-        return searchRecursive(m_root, value) != nullptr;
+        return searchIndex(value) != NULL_NODE;
     }
 
     /**
      * @brief Find a node with specific value (for visualization)
      *
      * @param value Value to find
-     * @return Shared pointer to node if found, nullptr otherwise
+     * @return Handle to node if found, empty handle otherwise
      */
-    std::shared_ptr<TreeNode<T>> find(const T& value) const {
-        return searchRecursive(m_root, value);
+    Handle find(const T& value) const {
+        return Handle(&m_pool, searchIndex(value));
     }
 
     /**
@@ -94,7 +162,7 @@ public:
      * @return true if empty
      */
     bool isEmpty() const {
-        return m_root == nullptr;
+        return m_root == NULL_NODE;
     }
 
     /**
@@ -110,17 +178,158 @@ public:
      * @brief Clear all nodes
      */
     void clear() {
-        m_root = nullptr;
+        m_pool.clear();
+        m_root = NULL_NODE;
         m_size = 0;
+        m_changed.clear();
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of nodes
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count);
+    }
+
+    // ===== Bulk loading =====
+
+    /**
+     * @brief Replace the contents with a balanced tree built from sorted input
+     *
+     * O(n): each node is the midpoint of its key range, so the height is
+     * minimal. Adjacent duplicates are skipped.
+     *
+     * @param first Start of a range sorted in ascending order
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void buildFromSorted(InputIt first, InputIt last) {
+        std::vector<T> values;
+        for (; first != last; ++first) {
+            if (values.empty() || values.back() < *first) values.push_back(*first);
+        }
+        rebuild(values);
+    }
+
+    /**
+     * @brief Replace the contents with a balanced tree built from any range
+     *
+     * Sorts a copy of the input, then builds as buildFromSorted().
+     */
+    template<typename InputIt>
+    void bulkLoad(InputIt first, InputIt last) {
+        std::vector<T> values(first, last);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        rebuild(values);
+    }
+
+    /**
+     * @brief Insert a batch of values in order
+     *
+     * The resulting shape is the same as inserting one at a time (a BST's
+     * shape is defined by insertion order); storage is reserved once and
+     * the whole batch shows up as a single change set in the change journal.
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void insertRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            m_pool.reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
     }
 
     /**
      * @brief Get root node (for visualization)
      *
-     * @return Shared pointer to root node
+     * @return Handle to root node (empty if tree is empty)
+     */
+    Handle root() const {
+        return Handle(&m_pool, m_root);
+    }
+
+    // ===== Change tracking (for incremental layout) =====
+
+    /**
+     * @brief Start journaling the ids of nodes whose links, data or color change
+     */
+    void enableChangeTracking() {
+        m_trackChanges = true;
+        m_changed.clear();
+    }
+
+    /**
+     * @brief Stop journaling node changes
+     */
+    void disableChangeTracking() {
+        m_trackChanges = false;
+    }
+
+    /**
+     * @brief Get ids changed since the last call (deduplicated) and clear the journal
+     *
+     * Ids that are no longer live (see isLive) were removed from the tree.
+     *
+     * @return Vector of node ids
+     */
+    std::vector<NodeIndex> takeChangedNodes() {
+        std::vector<NodeIndex> result = std::move(m_changed);
+        m_changed.clear();
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    /**
+     * @brief Check whether a node id is currently part of the tree
+     */
+    bool isLive(NodeIndex id) const {
+        return m_pool.isLive(id);
+    }
+
+    /**
+     * @brief Get a handle to a node by id (for visualization)
+     */
+    Handle node(NodeIndex id) const {
+        return Handle(&m_pool, id);
+    }
+
+    // ===== Traversal ranges (non-recursive, allocation-free) =====
+
+    /**
+     * @brief Inorder range (Left-Root-Right), usable with range-for
+     */
+    DepthFirstRange<Node, TraversalOrder::Inorder> inorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Preorder range (Root-Left-Right), usable with range-for
+     */
+    DepthFirstRange<Node, TraversalOrder::Preorder> preorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Postorder range (Left-Right-Root), usable with range-for
      */
-    std::shared_ptr<TreeNode<T>> root() const {
-        return m_root;
+    DepthFirstRange<Node, TraversalOrder::Postorder> postorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Level-order range (breadth-first), usable with range-for
+     */
+    LevelOrderRange<Node> levelOrder() const {
+        return {&m_pool, m_root, m_size};
     }
 
     /**
@@ -128,8 +337,8 @@ public:
      *
      * @param func Function to apply to each node's data
      */
-    void inorderTraversal(std::function<void(const T&)> func) const {
-        inorderRecursive(m_root, func);
+    void inorderTraversal(const std::function<void(const T&)>& func) const {
+        for (const T& value : inorder()) func(value);
     }
 
     /**
@@ -137,8 +346,8 @@ public:
      *
      * @param func Function to apply to each node's data
      */
-    void preorderTraversal(std::function<void(const T&)> func) const {
-        preorderRecursive(m_root, func);
+    void preorderTraversal(const std::function<void(const T&)>& func) const {
+        for (const T& value : preorder()) func(value);
     }
 
     /**
@@ -146,8 +355,8 @@ public:
      *
      * @param func Function to apply to each node's data
      */
-    void postorderTraversal(std::function<void(const T&)> func) const {
-        postorderRecursive(m_root, func);
+    void postorderTraversal(const std::function<void(const T&)>& func) const {
+        for (const T& value : postorder()) func(value);
     }
 
     /**
@@ -157,127 +366,313 @@ public:
      */
     std::vector<T> levelOrderTraversal() const {
         std::vector<T> result;
-        if (!m_root) return result;
-
-        std::vector<std::shared_ptr<TreeNode<T>>> queue;
-        queue.push_back(m_root);
-
-        while (!queue.empty()) {
-            auto node = queue.front();
-            queue.erase(queue.begin());
-
-            result.push_back(node->data);
-
-            if (node->left) queue.push_back(node->left);
-            if (node->right) queue.push_back(node->right);
-        }
-
+        result.reserve(m_size);
+        for (const T& value : levelOrder()) result.push_back(value);
         return result;
     }
 
     /**
      * @brief Get height of the tree
      *
+     * Computed level by level so degenerate trees cannot overflow the stack.
+     *
      * @return Height (number of edges from root to deepest leaf)
      */
     int height() const {
-        return heightRecursive(m_root);
+        int result = -1;
+        std::vector<NodeIndex> level;
+        std::vector<NodeIndex> next;
+        if (m_root != NULL_NODE) level.push_back(m_root);
+
+        while (!level.empty()) {
+            result++;
+            next.clear();
+            for (NodeIndex index : level) {
+                if (m_pool[index].left != NULL_NODE) next.push_back(m_pool[index].left);
+                if (m_pool[index].right != NULL_NODE) next.push_back(m_pool[index].right);
+            }
+            level.swap(next);
+        }
+        return result;
     }
 
-private:
-    std::shared_ptr<TreeNode<T>> insertRecursive(std::shared_ptr<TreeNode<T>> node, const T& value) {
-        if (!node) {
-            return std::make_shared<TreeNode<T>>(value);
-        }
+    // ===== Order statistics (OrderStatistics = true) =====
 
-        if (value < node->data) {
-            node->left = insertRecursive(node->left, value);
-        } else if (value > node->data) {
-            node->right = insertRecursive(node->right, value);
+    /**
+     * @brief Find the k-th smallest key, O(height)
+     *
+     * @param k Zero-based rank (0 = smallest)
+     * @return Handle to the node, or an empty handle if k >= size()
+     */
+    Handle select(size_t k) const {
+        static_assert(OrderStatistics, "select() needs BinarySearchTree<T, true>");
+        if (k >= m_size) return Handle(&m_pool, NULL_NODE);
+
+        NodeIndex current = m_root;
+        while (true) {
+            const Node& node = m_pool[current];
+            size_t leftSize = detail::subtreeSizeOf(m_pool, node.left);
+            if (k == leftSize) break;
+            if (k < leftSize) {
+                current = node.left;
+            } else {
+                k -= leftSize + 1;
+                current = node.right;
+            }
+            countHops();
         }
-        // If value == node->data, don't insert duplicates
+        return Handle(&m_pool, current);
+    }
 
-        return node;
+    /**
+     * @brief Number of keys less than a value, O(height)
+     *
+     * For a key in the tree this is its zero-based position in sorted order.
+     */
+    size_t rank(const T& value) const {
+        static_assert(OrderStatistics, "rank() needs BinarySearchTree<T, true>");
+        return countBelow(value, false);
     }
 
-    std::shared_ptr<TreeNode<T>> removeRecursive(std::shared_ptr<TreeNode<T>> node, const T& value) {
-        if (!node) {
-            return nullptr;
+    /**
+     * @brief Zero-based sorted position of a live node, O(height)
+     *
+     * Walks parent links, so no key comparisons are made.
+     */
+    size_t rankOf(NodeIndex id) const {
+        static_assert(OrderStatistics, "rankOf() needs BinarySearchTree<T, true>");
+        size_t result = detail::subtreeSizeOf(m_pool, m_pool[id].left);
+        for (NodeIndex parent = m_pool[id].parent; parent != NULL_NODE; parent = m_pool[parent].parent) {
+            if (m_pool[parent].right == id) {
+                result += detail::subtreeSizeOf(m_pool, m_pool[parent].left) + 1;
+            }
+            id = parent;
+            countHops();
         }
+        return result;
+    }
 
-        if (value < node->data) {
-            node->left = removeRecursive(node->left, value);
-        } else if (value > node->data) {
-            node->right = removeRecursive(node->right, value);
-        } else {
-            // Node found, delete it
-            m_size--;
-
-            // Case 1: No children or one child
-            if (!node->left) {
-                return node->right;
-            } else if (!node->right) {
-                return node->left;
+    /**
+     * @brief Number of keys in [low, high], O(height)
+     */
+    size_t countInRange(const T& low, const T& high) const {
+        static_assert(OrderStatistics, "countInRange() needs BinarySearchTree<T, true>");
+        if (high < low) return 0;
+        return countBelow(high, true) - countBelow(low, false);
+    }
+
+private:
+    /**
+     * @brief Number of keys less than (or, if inclusive, equal to) a value
+     */
+    size_t countBelow(const T& value, bool inclusive) const {
+        size_t result = 0;
+        NodeIndex current = m_root;
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            countComparisons();
+            bool goLeft = inclusive ? value < node.data : !(node.data < value);
+            if (goLeft) {
+                current = node.left;
+            } else {
+                result += detail::subtreeSizeOf(m_pool, node.left) + 1;
+                current = node.right;
             }
+            countHops();
+        }
+        return result;
+    }
 
-            // Case 2: Two children
-            // Find inorder successor (smallest in right subtree)
-            auto successor = findMin(node->right);
-            node->data = successor->data;
-            node->right = removeRecursive(node->right, successor->data);
-            m_size++; // Compensate for double decrement
+    /**
+     * @brief Add delta to the subtree sizes of a node and its ancestors
+     *
+     * No-op unless OrderStatistics is set.
+     */
+    void adjustSubtreeSizes(NodeIndex index, int delta) {
+        if constexpr (OrderStatistics) {
+            for (; index != NULL_NODE; index = m_pool[index].parent) {
+                m_pool[index].subtreeSize += static_cast<NodeIndex>(delta);
+            }
         }
+    }
 
-        return node;
+    /// Journal a node for change tracking
+    void touch(NodeIndex index) {
+        if (m_trackChanges && index != NULL_NODE) m_changed.push_back(index);
     }
 
-    std::shared_ptr<TreeNode<T>> searchRecursive(std::shared_ptr<TreeNode<T>> node, const T& value) const {
-        if (!node || node->data == value) {
-            return node;
+    /**
+     * @brief Replace every node with a balanced tree over sorted, unique values
+     *
+     * Old ids are journaled as changed so the change tracker sees them go.
+     */
+    void rebuild(const std::vector<T>& sorted) {
+        if (m_trackChanges) {
+            for (NodeIndex id = 0; id < m_pool.slotCount(); ++id) {
+                if (m_pool.isLive(id)) m_changed.push_back(id);
+            }
         }
 
-        if (value < node->data) {
-            return searchRecursive(node->left, value);
-        } else {
-            return searchRecursive(node->right, value);
+        m_pool.clear();
+        m_pool.reserve(sorted.size());
+        m_size = sorted.size();
+        m_root = buildSubtree(sorted, 0, sorted.size(), NULL_NODE);
+    }
+
+    /**
+     * @brief Build sorted[lo, hi) as a balanced subtree (recursion depth is O(log n))
+     *
+     * @return Index of the subtree root (NULL_NODE for an empty range)
+     */
+    NodeIndex buildSubtree(const std::vector<T>& sorted, size_t lo, size_t hi, NodeIndex parent) {
+        if (lo >= hi) return NULL_NODE;
+
+        size_t mid = lo + (hi - lo) / 2;
+        NodeIndex index = m_pool.allocate(sorted[mid]);
+        touch(index);
+
+        NodeIndex left = buildSubtree(sorted, lo, mid, index);
+        NodeIndex right = buildSubtree(sorted, mid + 1, hi, index);
+
+        Node& node = m_pool[index];
+        node.parent = parent;
+        node.left = left;
+        node.right = right;
+        if constexpr (OrderStatistics) {
+            node.subtreeSize = static_cast<NodeIndex>(hi - lo);
         }
+        return index;
     }
 
-    std::shared_ptr<TreeNode<T>> findMin(std::shared_ptr<TreeNode<T>> node) const {
-        while (node->left) {
-            node = node->left;
+    /**
+     * @brief Walk to the value's place and link a new node there
+     *
+     * The value is only forwarded into the node once the walk is over.
+     */
+    template<typename V>
+    void insertValue(V&& value) {
+        if (m_root == NULL_NODE) {
+            m_root = allocateNode(std::forward<V>(value));
+            touch(m_root);
+            m_size++;
+            return;
         }
-        return node;
+
+        NodeIndex current = m_root;
+        while (true) {
+            Node& node = m_pool[current];
+            countComparisons();
+            if (value < node.data) {
+                if (node.left == NULL_NODE) {
+                    NodeIndex created = allocateNode(std::forward<V>(value));
+                    m_pool[created].parent = current;
+                    m_pool[current].left = created;
+                    touch(created);
+                    touch(current);
+                    adjustSubtreeSizes(current, 1);
+                    break;
+                }
+                current = node.left;
+                countHops();
+            } else if (value > node.data) {
+                if (node.right == NULL_NODE) {
+                    NodeIndex created = allocateNode(std::forward<V>(value));
+                    m_pool[created].parent = current;
+                    m_pool[current].right = created;
+                    touch(created);
+                    touch(current);
+                    adjustSubtreeSizes(current, 1);
+                    break;
+                }
+                current = node.right;
+                countHops();
+            } else {
+                return;  // Don't insert duplicates
+            }
+        }
+        m_size++;
     }
 
-    void inorderRecursive(std::shared_ptr<TreeNode<T>> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        inorderRecursive(node->left, func);
-        func(node->data);
-        inorderRecursive(node->right, func);
+    /**
+     * @brief Unlink a found node and return its slot to the pool
+     */
+    void removeNode(NodeIndex target) {
+        Node& node = m_pool[target];
+        if (node.left != NULL_NODE && node.right != NULL_NODE) {
+            // Two children: move inorder successor up, then unlink the successor
+            NodeIndex successor = node.right;
+            countHops();
+            while (m_pool[successor].left != NULL_NODE) {
+                successor = m_pool[successor].left;
+                countHops();
+            }
+            node.data = std::move(m_pool[successor].data);
+            countMoves();
+            touch(target);
+            target = successor;
+        }
+
+        NodeIndex parent = m_pool[target].parent;
+        unlinkNode(target);
+        adjustSubtreeSizes(parent, -1);
+        m_pool.release(target);
+        m_size--;
     }
 
-    void preorderRecursive(std::shared_ptr<TreeNode<T>> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        func(node->data);
-        preorderRecursive(node->left, func);
-        preorderRecursive(node->right, func);
+    /**
+     * @brief Splice out a node that has at most one child
+     */
+    void unlinkNode(NodeIndex index) {
+        const Node& node = m_pool[index];
+        NodeIndex child = (node.left != NULL_NODE) ? node.left : node.right;
+        NodeIndex parent = node.parent;
+
+        if (child != NULL_NODE) {
+            m_pool[child].parent = parent;
+        }
+
+        if (parent == NULL_NODE) {
+            m_root = child;
+        } else if (m_pool[parent].left == index) {
+            m_pool[parent].left = child;
+        } else {
+            m_pool[parent].right = child;
+        }
+
+        touch(index);
+        touch(parent);
+        touch(child);
     }
 
-    void postorderRecursive(std::shared_ptr<TreeNode<T>> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        postorderRecursive(node->left, func);
-        postorderRecursive(node->right, func);
-        func(node->data);
+    NodeIndex searchIndex(const T& value) const {
+        NodeIndex current = m_root;
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            countComparisons();
+            if (node.data == value) {
+                break;
+            }
+            current = (value < node.data) ? node.left : node.right;
+            countHops();
+        }
+        return current;
     }
 
-    int heightRecursive(std::shared_ptr<TreeNode<T>> node) const {
-        if (!node) return -1;
-        return 1 + std::max(heightRecursive(node->left), heightRecursive(node->right));
+    /**
+     * @brief Take a node from the pool and copy or move the value into it
+     */
+    template<typename V>
+    NodeIndex allocateNode(V&& value) {
+        countAllocations();
+        countMoves();
+        return m_pool.allocate(std::forward<V>(value));
     }
 
-    std::shared_ptr<TreeNode<T>> m_root = nullptr;  ///< Root of the tree
-    size_t m_size = 0;                              ///< Number of nodes
+    NodePool<Node> m_pool;     ///< Node storage
+    NodeIndex m_root = NULL_NODE;     ///< Root of the tree
+    size_t m_size = 0;                ///< Number of nodes
+    bool m_trackChanges = false;      ///< Whether changes are journaled
+    std::vector<NodeIndex> m_changed; ///< Journal of changed node ids
 };
 
 } // namespace dsav
@@ -0,0 +1,545 @@
+/**
+ * @file bplus_tree.hpp
+ * @brief B+ tree data structure implementation
+ *
+ * The leaf-chained variant of BTree: every key lives in a leaf, internal
+ * nodes only hold separator copies that route a search, and each leaf
+ * links to the next one. A lookup always ends in a leaf, and a range scan
+ * finds its first key once and then streams along the leaf chain, reading
+ * whole nodes sequentially instead of climbing back up the tree.
+ *
+ * Like BTree, insertion and deletion are single top-down passes.
+ */
+
+#pragma once
+
+#include "btree.hpp"
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief B+ tree data structure
+ *
+ * Template parameters:
+ * - T: Type of keys stored in the tree
+ * - Order: Maximum children per internal node and keys + 1 per leaf
+ *   (even, at least 4)
+ *
+ * Separators satisfy: keys in children[i] < keys[i] <= keys in children[i + 1].
+ * Duplicate keys are ignored.
+ */
+template<typename T, size_t Order = 16>
+class BPlusTree : public OpCounted {
+    static_assert(Order >= 4 && Order % 2 == 0,
+                  "BPlusTree order must be even and at least 4 (top-down splits need a middle key)");
+
+public:
+    using Node = BTreeNode<T, Order>;
+
+    /// Most keys a node can hold
+    static constexpr size_t MAX_KEYS = Order - 1;
+
+    /// Fewest keys a non-root node keeps
+    static constexpr size_t MIN_KEYS = Order / 2 - 1;
+
+    /**
+     * @brief Construct an empty B+ tree
+     */
+    BPlusTree() = default;
+
+    /**
+     * @brief Insert a key into the B+ tree
+     *
+     * Duplicate keys are ignored.
+     *
+     * @param value Key to insert
+     * @return true if inserted, false if the key was already present
+     */
+    bool insert(const T& value) {
+        if (m_root == NULL_NODE) {
+            m_root = allocateNode(true);
+            Node& root = m_pool[m_root];
+            root.keys[0] = value;
+            root.count = 1;
+            countMoves();
+            m_firstLeaf = m_root;
+            m_size = 1;
+            m_height = 1;
+            return true;
+        }
+
+        if (m_pool[m_root].count == MAX_KEYS) {
+            NodeIndex grown = allocateNode(false);
+            m_pool[grown].children[0] = m_root;
+            m_root = grown;
+            splitChild(grown, 0);
+            m_height++;
+        }
+
+        NodeIndex current = m_root;
+        while (!m_pool[current].leaf) {
+            size_t i = childIndex(m_pool[current], value);
+            if (m_pool[m_pool[current].children[i]].count == MAX_KEYS) {
+                splitChild(current, i);
+                countComparisons();
+                if (!(value < m_pool[current].keys[i])) {
+                    i++;
+                }
+            }
+            current = m_pool[current].children[i];
+            countHops();
+        }
+
+        Node& leaf = m_pool[current];
+        size_t i = lowerBound(leaf, value);
+        if (i < leaf.count && equal(leaf.keys[i], value)) {
+            return false;
+        }
+        for (size_t k = leaf.count; k > i; --k) {
+            leaf.keys[k] = std::move(leaf.keys[k - 1]);
+        }
+        countMoves(leaf.count - i);
+        leaf.keys[i] = value;
+        countMoves();
+        leaf.count++;
+        m_size++;
+        return true;
+    }
+
+    /**
+     * @brief Delete a key from the B+ tree
+     *
+     * Separators equal to a deleted key are left in place: they still route
+     * correctly, since they remain <= every key to their right.
+     *
+     * @param value Key to delete
+     * @return true if the key was found and deleted, false otherwise
+     */
+    bool remove(const T& value) {
+        if (m_root == NULL_NODE) {
+            return false;
+        }
+
+        NodeIndex current = m_root;
+        while (!m_pool[current].leaf) {
+            size_t i = childIndex(m_pool[current], value);
+            if (m_pool[m_pool[current].children[i]].count == MIN_KEYS) {
+                i = refillChild(current, i);
+            }
+            current = m_pool[current].children[i];
+            countHops();
+        }
+
+        bool removed = false;
+        Node& leaf = m_pool[current];
+        size_t i = lowerBound(leaf, value);
+        if (i < leaf.count && equal(leaf.keys[i], value)) {
+            for (size_t k = i + 1; k < leaf.count; ++k) {
+                leaf.keys[k - 1] = std::move(leaf.keys[k]);
+            }
+            countMoves(leaf.count - i - 1);
+            leaf.count--;
+            m_size--;
+            removed = true;
+        }
+
+        Node& root = m_pool[m_root];
+        if (root.count == 0) {
+            NodeIndex old = m_root;
+            m_root = root.leaf ? NULL_NODE : root.children[0];
+            if (root.leaf) {
+                m_firstLeaf = NULL_NODE;
+            }
+            m_pool.release(old);
+            m_height--;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Search for a key in the B+ tree
+     *
+     * @param value Key to search for
+     * @return true if found, false otherwise
+     */
+    bool search(const T& value) const {
+        NodeIndex leaf = findLeaf(value);
+        if (leaf == NULL_NODE) {
+            return false;
+        }
+        const Node& node = m_pool[leaf];
+        size_t i = lowerBound(node, value);
+        return i < node.count && equal(node.keys[i], value);
+    }
+
+    /**
+     * @brief Visit the keys in [low, high] in ascending order
+     *
+     * One descent to the leaf holding low, then a walk along the leaf chain.
+     *
+     * @param low Smallest key to visit
+     * @param high Largest key to visit
+     * @param func Function applied to each key in range
+     * @return Number of keys visited
+     */
+    size_t rangeScan(const T& low, const T& high, std::function<void(const T&)> func) const {
+        size_t visited = 0;
+        NodeIndex current = findLeaf(low);
+        if (current == NULL_NODE) {
+            return 0;
+        }
+
+        size_t i = lowerBound(m_pool[current], low);
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            for (; i < node.count; ++i) {
+                countComparisons();
+                if (high < node.keys[i]) {
+                    return visited;
+                }
+                func(node.keys[i]);
+                visited++;
+            }
+            current = node.next;
+            countHops();
+            i = 0;
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Check if tree is empty
+     */
+    bool isEmpty() const {
+        return m_root == NULL_NODE;
+    }
+
+    /**
+     * @brief Get number of keys
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Get number of levels (0 if empty)
+     */
+    size_t height() const {
+        return m_height;
+    }
+
+    /**
+     * @brief Get number of nodes (leaves and internal)
+     */
+    size_t nodeCount() const {
+        return m_pool.size();
+    }
+
+    /**
+     * @brief Clear all keys
+     */
+    void clear() {
+        m_pool.clear();
+        m_root = NULL_NODE;
+        m_firstLeaf = NULL_NODE;
+        m_size = 0;
+        m_height = 0;
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of keys
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count / (MIN_KEYS + 1) + 1);
+    }
+
+    /**
+     * @brief Insert a batch of keys in order
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void insertRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Visit every key in ascending order along the leaf chain
+     *
+     * @param func Function to apply to each key
+     */
+    void traverse(std::function<void(const T&)> func) const {
+        for (NodeIndex current = m_firstLeaf; current != NULL_NODE; current = m_pool[current].next) {
+            const Node& node = m_pool[current];
+            for (size_t i = 0; i < node.count; ++i) {
+                func(node.keys[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Get root node (for visualization)
+     *
+     * @return Handle to root node (empty if tree is empty)
+     */
+    BTreeNodeHandle<T, Order> root() const {
+        return BTreeNodeHandle<T, Order>(&m_pool, m_root);
+    }
+
+    /**
+     * @brief Get the leftmost leaf, the start of the leaf chain (for visualization)
+     */
+    BTreeNodeHandle<T, Order> firstLeaf() const {
+        return BTreeNodeHandle<T, Order>(&m_pool, m_firstLeaf);
+    }
+
+    /**
+     * @brief Get a node by id (for visualization)
+     */
+    BTreeNodeHandle<T, Order> node(NodeIndex id) const {
+        return BTreeNodeHandle<T, Order>(&m_pool, id);
+    }
+
+private:
+    static bool equal(const T& a, const T& b) {
+        return !(a < b) && !(b < a);
+    }
+
+    /**
+     * @brief Index of the first key not less than value (count if none)
+     */
+    size_t lowerBound(const Node& node, const T& value) const {
+        size_t i = 0;
+        while (i < node.count) {
+            countComparisons();
+            if (!(node.keys[i] < value)) {
+                break;
+            }
+            i++;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Child of an internal node whose range holds value
+     *
+     * The number of separators <= value (keys equal to a separator live to its right).
+     */
+    size_t childIndex(const Node& node, const T& value) const {
+        size_t i = 0;
+        while (i < node.count) {
+            countComparisons();
+            if (value < node.keys[i]) {
+                break;
+            }
+            i++;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Descend to the leaf whose range holds value (NULL_NODE if empty)
+     */
+    NodeIndex findLeaf(const T& value) const {
+        NodeIndex current = m_root;
+        while (current != NULL_NODE && !m_pool[current].leaf) {
+            current = m_pool[current].children[childIndex(m_pool[current], value)];
+            countHops();
+        }
+        return current;
+    }
+
+    /**
+     * @brief Split the full child at position i
+     *
+     * A leaf keeps its lower MIN_KEYS keys, hands the rest to a new chained
+     * leaf and copies that leaf's first key up as the separator. An internal
+     * node splits as in a B-tree: its middle key moves up.
+     */
+    void splitChild(NodeIndex parent, size_t i) {
+        NodeIndex left = m_pool[parent].children[i];
+        bool leaf = m_pool[left].leaf;
+        NodeIndex right = allocateNode(leaf);
+        Node& p = m_pool[parent];
+        Node& l = m_pool[left];
+        Node& r = m_pool[right];
+
+        constexpr size_t half = Order / 2;
+        T separator;
+        if (leaf) {
+            size_t moved = MAX_KEYS - MIN_KEYS;
+            for (size_t k = 0; k < moved; ++k) {
+                r.keys[k] = std::move(l.keys[MIN_KEYS + k]);
+            }
+            r.count = static_cast<std::uint16_t>(moved);
+            l.count = static_cast<std::uint16_t>(MIN_KEYS);
+            r.next = l.next;
+            l.next = right;
+            separator = r.keys[0];
+            countMoves(moved + 1);
+        } else {
+            for (size_t k = 0; k < MIN_KEYS; ++k) {
+                r.keys[k] = std::move(l.keys[k + half]);
+            }
+            for (size_t k = 0; k < half; ++k) {
+                r.children[k] = l.children[k + half];
+            }
+            r.count = static_cast<std::uint16_t>(MIN_KEYS);
+            l.count = static_cast<std::uint16_t>(MIN_KEYS);
+            separator = std::move(l.keys[MIN_KEYS]);
+            countMoves(MIN_KEYS + 1);
+        }
+
+        for (size_t k = p.count; k > i; --k) {
+            p.keys[k] = std::move(p.keys[k - 1]);
+            p.children[k + 1] = p.children[k];
+        }
+        countMoves(p.count - i);
+        p.keys[i] = std::move(separator);
+        p.children[i + 1] = right;
+        p.count++;
+    }
+
+    /**
+     * @brief Give the minimal child at position i an extra key
+     *
+     * Borrows from a sibling that can spare a key (fixing the separator
+     * between them), otherwise merges the child with a sibling.
+     *
+     * @return Position of the child to descend into afterwards
+     */
+    size_t refillChild(NodeIndex parent, size_t i) {
+        size_t parentCount = m_pool[parent].count;
+        NodeIndex child = m_pool[parent].children[i];
+
+        if (i > 0 && m_pool[m_pool[parent].children[i - 1]].count > MIN_KEYS) {
+            Node& p = m_pool[parent];
+            Node& c = m_pool[child];
+            Node& l = m_pool[p.children[i - 1]];
+            for (size_t k = c.count; k > 0; --k) {
+                c.keys[k] = std::move(c.keys[k - 1]);
+            }
+            if (c.leaf) {
+                c.keys[0] = std::move(l.keys[l.count - 1]);
+                p.keys[i - 1] = c.keys[0];
+            } else {
+                for (size_t k = c.count + 1; k > 0; --k) {
+                    c.children[k] = c.children[k - 1];
+                }
+                c.children[0] = l.children[l.count];
+                c.keys[0] = std::move(p.keys[i - 1]);
+                p.keys[i - 1] = std::move(l.keys[l.count - 1]);
+            }
+            c.count++;
+            l.count--;
+            countMoves(c.count + 1);
+            countHops();
+            return i;
+        }
+
+        if (i < parentCount && m_pool[m_pool[parent].children[i + 1]].count > MIN_KEYS) {
+            Node& p = m_pool[parent];
+            Node& c = m_pool[child];
+            Node& r = m_pool[p.children[i + 1]];
+            if (c.leaf) {
+                c.keys[c.count] = std::move(r.keys[0]);
+                for (size_t k = 1; k < r.count; ++k) {
+                    r.keys[k - 1] = std::move(r.keys[k]);
+                }
+                p.keys[i] = r.keys[0];
+            } else {
+                c.keys[c.count] = std::move(p.keys[i]);
+                c.children[c.count + 1] = r.children[0];
+                p.keys[i] = std::move(r.keys[0]);
+                for (size_t k = 1; k < r.count; ++k) {
+                    r.keys[k - 1] = std::move(r.keys[k]);
+                }
+                for (size_t k = 1; k <= r.count; ++k) {
+                    r.children[k - 1] = r.children[k];
+                }
+            }
+            c.count++;
+            r.count--;
+            countMoves(r.count + 2);
+            countHops();
+            return i;
+        }
+
+        if (i < parentCount) {
+            mergeChildren(parent, i);
+            return i;
+        }
+        mergeChildren(parent, i - 1);
+        return i - 1;
+    }
+
+    /**
+     * @brief Merge children i and i + 1 of parent
+     *
+     * Leaves concatenate and drop the separator; internal nodes pull it
+     * down between their keys, as in a B-tree.
+     */
+    void mergeChildren(NodeIndex parent, size_t i) {
+        Node& p = m_pool[parent];
+        NodeIndex rightIndex = p.children[i + 1];
+        Node& l = m_pool[p.children[i]];
+        Node& r = m_pool[rightIndex];
+
+        if (l.leaf) {
+            for (size_t k = 0; k < r.count; ++k) {
+                l.keys[l.count + k] = std::move(r.keys[k]);
+            }
+            l.count = static_cast<std::uint16_t>(l.count + r.count);
+            l.next = r.next;
+        } else {
+            l.keys[l.count] = std::move(p.keys[i]);
+            for (size_t k = 0; k < r.count; ++k) {
+                l.keys[l.count + 1 + k] = std::move(r.keys[k]);
+            }
+            for (size_t k = 0; k <= r.count; ++k) {
+                l.children[l.count + 1 + k] = r.children[k];
+            }
+            l.count = static_cast<std::uint16_t>(l.count + 1 + r.count);
+        }
+
+        for (size_t k = i + 1; k < p.count; ++k) {
+            p.keys[k - 1] = std::move(p.keys[k]);
+            p.children[k] = p.children[k + 1];
+        }
+        p.count--;
+        countMoves(r.count + 1 + (p.count - i));
+        countHops();
+        m_pool.release(rightIndex);
+    }
+
+    /**
+     * @brief Take an empty node from the pool
+     */
+    NodeIndex allocateNode(bool leaf) {
+        countAllocations();
+        NodeIndex index = m_pool.allocate();
+        m_pool[index].leaf = leaf;
+        return index;
+    }
+
+    NodePool<Node> m_pool;                ///< Node storage
+    NodeIndex m_root = NULL_NODE;         ///< Root of the tree
+    NodeIndex m_firstLeaf = NULL_NODE;    ///< Head of the leaf chain
+    size_t m_size = 0;                    ///< Number of keys
+    size_t m_height = 0;                  ///< Number of levels
+};
+
+} // namespace dsav
@@ -0,0 +1,564 @@
+/**
+ * @file btree.hpp
+ * @brief B-tree data structure implementation
+ *
+ * A template-based B-tree with visualization-friendly interface. Every node
+ * holds up to Order - 1 sorted keys and Order children in two fixed arrays,
+ * so a lookup reads a few wide nodes instead of log2(n) scattered binary
+ * nodes: with int keys and Order = 16 a node is about two cache lines and
+ * a million keys fit in a tree of height 5.
+ *
+ * Insertion and deletion are the single-pass top-down algorithms: a full
+ * child is split before the walk enters it, a minimal child is refilled
+ * from a sibling or merged with one, so no operation has to walk back up.
+ */
+
+#pragma once
+
+#include "node_pool.hpp"
+#include "op_counters.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Node of a BTree or BPlusTree
+ *
+ * keys[0, count) are sorted. An internal node has count + 1 children;
+ * children[i] holds the keys below keys[i]. BPlusTree leaves also chain to
+ * the next leaf.
+ *
+ * @tparam T Type of the keys (must be default constructible)
+ * @tparam Order Maximum number of children
+ */
+template<typename T, size_t Order>
+struct BTreeNode {
+    using value_type = T;
+
+    BTreeNode() { children.fill(NULL_NODE); }
+
+    std::array<T, Order - 1> keys{};        ///< Sorted keys
+    std::array<NodeIndex, Order> children;  ///< Child links (internal nodes only)
+    std::uint16_t count = 0;                ///< Number of keys
+    bool leaf = true;                       ///< True if the node has no children
+    NodeIndex next = NULL_NODE;             ///< Next leaf (BPlusTree only)
+};
+
+/// Handle to a B-tree node as exposed to visualizers
+template<typename T, size_t Order>
+using BTreeNodeHandle = NodeHandle<BTreeNode<T, Order>>;
+
+/**
+ * @brief B-tree data structure
+ *
+ * Template parameters:
+ * - T: Type of keys stored in the tree
+ * - Order: Maximum children per node (even, at least 4; 4 is a 2-3-4 tree)
+ *
+ * Every node other than the root keeps at least Order / 2 - 1 keys, so the
+ * height stays below log_{Order/2}(n) + 1. Duplicate keys are ignored.
+ */
+template<typename T, size_t Order = 16>
+class BTree : public OpCounted {
+    static_assert(Order >= 4 && Order % 2 == 0,
+                  "BTree order must be even and at least 4 (top-down splits need a middle key)");
+
+public:
+    using Node = BTreeNode<T, Order>;
+
+    /// Most keys a node can hold
+    static constexpr size_t MAX_KEYS = Order - 1;
+
+    /// Fewest keys a non-root node keeps
+    static constexpr size_t MIN_KEYS = Order / 2 - 1;
+
+    /**
+     * @brief Construct an empty B-tree
+     */
+    BTree() = default;
+
+    /**
+     * @brief Insert a key into the B-tree
+     *
+     * Duplicate keys are ignored.
+     *
+     * @param value Key to insert
+     * @return true if inserted, false if the key was already present
+     */
+    bool insert(const T& value) {
+        if (m_root == NULL_NODE) {
+            m_root = allocateNode(true);
+            Node& root = m_pool[m_root];
+            root.keys[0] = value;
+            root.count = 1;
+            countMoves();
+            m_size = 1;
+            m_height = 1;
+            return true;
+        }
+
+        // A full root splits into two children of a new root: the only way the tree grows
+        if (m_pool[m_root].count == MAX_KEYS) {
+            NodeIndex grown = allocateNode(false);
+            m_pool[grown].children[0] = m_root;
+            m_root = grown;
+            splitChild(grown, 0);
+            m_height++;
+        }
+
+        NodeIndex current = m_root;
+        while (true) {
+            size_t i = lowerBound(m_pool[current], value);
+            if (i < m_pool[current].count && equal(m_pool[current].keys[i], value)) {
+                return false;
+            }
+
+            if (m_pool[current].leaf) {
+                Node& node = m_pool[current];
+                for (size_t k = node.count; k > i; --k) {
+                    node.keys[k] = std::move(node.keys[k - 1]);
+                }
+                countMoves(node.count - i);
+                node.keys[i] = value;
+                countMoves();
+                node.count++;
+                m_size++;
+                return true;
+            }
+
+            if (m_pool[m_pool[current].children[i]].count == MAX_KEYS) {
+                splitChild(current, i);
+                const T& promoted = m_pool[current].keys[i];
+                countComparisons();
+                if (equal(promoted, value)) {
+                    return false;
+                }
+                if (promoted < value) {
+                    i++;
+                }
+            }
+            current = m_pool[current].children[i];
+            countHops();
+        }
+    }
+
+    /**
+     * @brief Delete a key from the B-tree
+     *
+     * @param value Key to delete
+     * @return true if the key was found and deleted, false otherwise
+     */
+    bool remove(const T& value) {
+        if (m_root == NULL_NODE) {
+            return false;
+        }
+
+        bool removed = removeFromSubtree(value);
+
+        // A root emptied by a merge hands over to its only child: the only way the tree shrinks
+        Node& root = m_pool[m_root];
+        if (root.count == 0) {
+            NodeIndex old = m_root;
+            m_root = root.leaf ? NULL_NODE : root.children[0];
+            m_pool.release(old);
+            m_height--;
+        }
+        if (removed) {
+            m_size--;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Search for a key in the B-tree
+     *
+     * @param value Key to search for
+     * @return true if found, false otherwise
+     */
+    bool search(const T& value) const {
+        NodeIndex current = m_root;
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            size_t i = lowerBound(node, value);
+            if (i < node.count && equal(node.keys[i], value)) {
+                return true;
+            }
+            if (node.leaf) {
+                return false;
+            }
+            current = node.children[i];
+            countHops();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check if tree is empty
+     */
+    bool isEmpty() const {
+        return m_root == NULL_NODE;
+    }
+
+    /**
+     * @brief Get number of keys
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Get number of levels (0 if empty)
+     */
+    size_t height() const {
+        return m_height;
+    }
+
+    /**
+     * @brief Get number of nodes
+     */
+    size_t nodeCount() const {
+        return m_pool.size();
+    }
+
+    /**
+     * @brief Clear all keys
+     */
+    void clear() {
+        m_pool.clear();
+        m_root = NULL_NODE;
+        m_size = 0;
+        m_height = 0;
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of keys
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count / (MIN_KEYS + 1) + 1);
+    }
+
+    /**
+     * @brief Insert a batch of keys in order
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void insertRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Visit every key in ascending order
+     *
+     * Walks with an explicit stack of (node, next child) pairs, one per level.
+     *
+     * @param func Function to apply to each key
+     */
+    void traverse(std::function<void(const T&)> func) const {
+        if (m_root == NULL_NODE) {
+            return;
+        }
+
+        std::vector<std::pair<NodeIndex, size_t>> stack;
+        stack.reserve(m_height);
+        stack.emplace_back(m_root, 0);
+        while (!stack.empty()) {
+            auto& [index, child] = stack.back();
+            const Node& node = m_pool[index];
+            if (node.leaf) {
+                for (size_t i = 0; i < node.count; ++i) {
+                    func(node.keys[i]);
+                }
+                stack.pop_back();
+                continue;
+            }
+            if (child > node.count) {
+                stack.pop_back();
+                continue;
+            }
+            if (child > 0) {
+                func(node.keys[child - 1]);
+            }
+            NodeIndex next = node.children[child++];
+            stack.emplace_back(next, 0);
+        }
+    }
+
+    /**
+     * @brief Get root node (for visualization)
+     *
+     * @return Handle to root node (empty if tree is empty)
+     */
+    BTreeNodeHandle<T, Order> root() const {
+        return BTreeNodeHandle<T, Order>(&m_pool, m_root);
+    }
+
+    /**
+     * @brief Get a node by id (for visualization)
+     */
+    BTreeNodeHandle<T, Order> node(NodeIndex id) const {
+        return BTreeNodeHandle<T, Order>(&m_pool, id);
+    }
+
+private:
+    static bool equal(const T& a, const T& b) {
+        return !(a < b) && !(b < a);
+    }
+
+    /**
+     * @brief Index of the first key not less than value (count if none)
+     *
+     * A linear scan: nodes are small and contiguous, so it beats a binary
+     * search's unpredictable branches.
+     */
+    size_t lowerBound(const Node& node, const T& value) const {
+        size_t i = 0;
+        while (i < node.count) {
+            countComparisons();
+            if (!(node.keys[i] < value)) {
+                break;
+            }
+            i++;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Split the full child at position i around its middle key
+     *
+     * The child keeps the lower MIN_KEYS keys, a new right sibling takes the
+     * upper MIN_KEYS, and the middle key moves up into parent.
+     */
+    void splitChild(NodeIndex parent, size_t i) {
+        NodeIndex left = m_pool[parent].children[i];
+        NodeIndex right = allocateNode(m_pool[left].leaf);
+        Node& p = m_pool[parent];
+        Node& l = m_pool[left];
+        Node& r = m_pool[right];
+
+        constexpr size_t half = Order / 2;
+        for (size_t k = 0; k < MIN_KEYS; ++k) {
+            r.keys[k] = std::move(l.keys[k + half]);
+        }
+        if (!l.leaf) {
+            for (size_t k = 0; k < half; ++k) {
+                r.children[k] = l.children[k + half];
+            }
+        }
+        r.count = static_cast<std::uint16_t>(MIN_KEYS);
+        l.count = static_cast<std::uint16_t>(MIN_KEYS);
+
+        for (size_t k = p.count; k > i; --k) {
+            p.keys[k] = std::move(p.keys[k - 1]);
+            p.children[k + 1] = p.children[k];
+        }
+        p.keys[i] = std::move(l.keys[MIN_KEYS]);
+        p.children[i + 1] = right;
+        p.count++;
+        countMoves(MIN_KEYS + 1 + (p.count - 1 - i));
+    }
+
+    /**
+     * @brief Top-down delete below the root (the root may end up empty)
+     */
+    bool removeFromSubtree(T value) {
+        NodeIndex current = m_root;
+        while (true) {
+            size_t i = lowerBound(m_pool[current], value);
+            bool here = i < m_pool[current].count && equal(m_pool[current].keys[i], value);
+
+            if (m_pool[current].leaf) {
+                if (!here) {
+                    return false;
+                }
+                Node& node = m_pool[current];
+                for (size_t k = i + 1; k < node.count; ++k) {
+                    node.keys[k - 1] = std::move(node.keys[k]);
+                }
+                countMoves(node.count - i - 1);
+                node.count--;
+                return true;
+            }
+
+            if (here) {
+                NodeIndex left = m_pool[current].children[i];
+                NodeIndex right = m_pool[current].children[i + 1];
+                if (m_pool[left].count > MIN_KEYS) {
+                    // Replace with the predecessor, then delete that from the left subtree
+                    value = maxKey(left);
+                    m_pool[current].keys[i] = value;
+                    countMoves();
+                    current = left;
+                } else if (m_pool[right].count > MIN_KEYS) {
+                    value = minKey(right);
+                    m_pool[current].keys[i] = value;
+                    countMoves();
+                    current = right;
+                } else {
+                    // Both neighbours minimal: pull the key down into the merged child
+                    mergeChildren(current, i);
+                    current = left;
+                }
+                countHops();
+                continue;
+            }
+
+            // Make sure the child we descend into can lose a key
+            NodeIndex child = m_pool[current].children[i];
+            if (m_pool[child].count == MIN_KEYS) {
+                i = refillChild(current, i);
+                child = m_pool[current].children[i];
+            }
+            current = child;
+            countHops();
+        }
+    }
+
+    /**
+     * @brief Give the minimal child at position i an extra key
+     *
+     * Rotates one through the parent from a sibling that can spare it,
+     * otherwise merges the child with a sibling.
+     *
+     * @return Position of the child to descend into afterwards
+     */
+    size_t refillChild(NodeIndex parent, size_t i) {
+        size_t parentCount = m_pool[parent].count;
+        NodeIndex child = m_pool[parent].children[i];
+
+        if (i > 0 && m_pool[m_pool[parent].children[i - 1]].count > MIN_KEYS) {
+            Node& p = m_pool[parent];
+            Node& c = m_pool[child];
+            Node& l = m_pool[p.children[i - 1]];
+            for (size_t k = c.count; k > 0; --k) {
+                c.keys[k] = std::move(c.keys[k - 1]);
+            }
+            if (!c.leaf) {
+                for (size_t k = c.count + 1; k > 0; --k) {
+                    c.children[k] = c.children[k - 1];
+                }
+                c.children[0] = l.children[l.count];
+            }
+            c.keys[0] = std::move(p.keys[i - 1]);
+            p.keys[i - 1] = std::move(l.keys[l.count - 1]);
+            c.count++;
+            l.count--;
+            countMoves(c.count + 1);
+            countHops();
+            return i;
+        }
+
+        if (i < parentCount && m_pool[m_pool[parent].children[i + 1]].count > MIN_KEYS) {
+            Node& p = m_pool[parent];
+            Node& c = m_pool[child];
+            Node& r = m_pool[p.children[i + 1]];
+            c.keys[c.count] = std::move(p.keys[i]);
+            if (!c.leaf) {
+                c.children[c.count + 1] = r.children[0];
+            }
+            p.keys[i] = std::move(r.keys[0]);
+            for (size_t k = 1; k < r.count; ++k) {
+                r.keys[k - 1] = std::move(r.keys[k]);
+            }
+            if (!r.leaf) {
+                for (size_t k = 1; k <= r.count; ++k) {
+                    r.children[k - 1] = r.children[k];
+                }
+            }
+            c.count++;
+            r.count--;
+            countMoves(r.count + 2);
+            countHops();
+            return i;
+        }
+
+        if (i < parentCount) {
+            mergeChildren(parent, i);
+            return i;
+        }
+        mergeChildren(parent, i - 1);
+        return i - 1;
+    }
+
+    /**
+     * @brief Merge children i and i + 1 of parent around keys[i]
+     *
+     * Both children hold MIN_KEYS keys, so the result is exactly full.
+     */
+    void mergeChildren(NodeIndex parent, size_t i) {
+        Node& p = m_pool[parent];
+        NodeIndex rightIndex = p.children[i + 1];
+        Node& l = m_pool[p.children[i]];
+        Node& r = m_pool[rightIndex];
+
+        l.keys[l.count] = std::move(p.keys[i]);
+        for (size_t k = 0; k < r.count; ++k) {
+            l.keys[l.count + 1 + k] = std::move(r.keys[k]);
+        }
+        if (!l.leaf) {
+            for (size_t k = 0; k <= r.count; ++k) {
+                l.children[l.count + 1 + k] = r.children[k];
+            }
+        }
+        l.count = static_cast<std::uint16_t>(l.count + 1 + r.count);
+
+        for (size_t k = i + 1; k < p.count; ++k) {
+            p.keys[k - 1] = std::move(p.keys[k]);
+            p.children[k] = p.children[k + 1];
+        }
+        p.count--;
+        countMoves(r.count + 1 + (p.count - i));
+        countHops();
+        m_pool.release(rightIndex);
+    }
+
+    /// Largest key of a subtree
+    T maxKey(NodeIndex index) const {
+        while (!m_pool[index].leaf) {
+            index = m_pool[index].children[m_pool[index].count];
+            countHops();
+        }
+        return m_pool[index].keys[m_pool[index].count - 1];
+    }
+
+    /// Smallest key of a subtree
+    T minKey(NodeIndex index) const {
+        while (!m_pool[index].leaf) {
+            index = m_pool[index].children[0];
+            countHops();
+        }
+        return m_pool[index].keys[0];
+    }
+
+    /**
+     * @brief Take an empty node from the pool
+     */
+    NodeIndex allocateNode(bool leaf) {
+        countAllocations();
+        NodeIndex index = m_pool.allocate();
+        m_pool[index].leaf = leaf;
+        return index;
+    }
+
+    NodePool<Node> m_pool;            ///< Node storage
+    NodeIndex m_root = NULL_NODE;     ///< Root of the tree
+    size_t m_size = 0;                ///< Number of keys
+    size_t m_height = 0;              ///< Number of levels
+};
+
+} // namespace dsav
@@ -0,0 +1,123 @@
+/**
+ * @file capacity_event.hpp
+ * @brief Storage events reported by the growable stack and queue
+ *
+ * Stack<T, DYNAMIC_CAPACITY> and Queue<T, DYNAMIC_CAPACITY> can log every
+ * reallocation or block hand-off into a ring buffer, the same way the
+ * red-black tree logs its fixups, so visualizers can animate growth without
+ * the containers knowing about rendering.
+ */
+
+#pragma once
+
+#include "ring_buffer.hpp"
+#include <cstdint>
+#include <cstddef>
+
+namespace dsav {
+
+/// MaxSize that selects the growable Stack and Queue specializations
+inline constexpr size_t DYNAMIC_CAPACITY = 0;
+
+/**
+ * @brief What happened to a container's storage
+ */
+enum class CapacityEventType : std::uint8_t {
+    Grow,           ///< Stack moved to a larger buffer
+    Shrink,         ///< Stack moved to a smaller buffer
+    BlockAllocate,  ///< Queue allocated a new block
+    BlockReuse,     ///< Queue took a block from its spare list
+    BlockRetire,    ///< Queue emptied a block and kept it as a spare
+    BlockFree       ///< Queue emptied a block and returned it to the allocator
+};
+
+/**
+ * @brief One storage event (plain data, recorded into a RingBuffer)
+ */
+struct CapacityEvent {
+    CapacityEventType type = CapacityEventType::Grow;
+    size_t size = 0;            ///< Elements stored when it happened
+    size_t oldCapacity = 0;     ///< Slots before
+    size_t newCapacity = 0;     ///< Slots after
+};
+
+/**
+ * @brief Short display name of an event type
+ */
+inline const char* capacityEventName(CapacityEventType type) {
+    switch (type) {
+        case CapacityEventType::Grow:          return "grow";
+        case CapacityEventType::Shrink:        return "shrink";
+        case CapacityEventType::BlockAllocate: return "allocate block";
+        case CapacityEventType::BlockReuse:    return "reuse block";
+        case CapacityEventType::BlockRetire:   return "retire block";
+        case CapacityEventType::BlockFree:     return "free block";
+    }
+    return "?";
+}
+
+/**
+ * @brief Opt-in log of storage events, shared by the growable containers
+ *
+ * Recording is off by default; when on, each event is a copy into a ring
+ * buffer that keeps the most recent ones.
+ */
+class CapacityEventLog {
+public:
+    /// Default number of events kept by the log
+    static constexpr size_t DEFAULT_EVENT_CAPACITY = 1024;
+
+    /**
+     * @brief Enable event recording
+     *
+     * @param capacity Number of most recent events kept (older ones are overwritten)
+     */
+    void enableEventRecording(size_t capacity = DEFAULT_EVENT_CAPACITY) {
+        m_recordEvents = true;
+        if (m_events.capacity() < capacity) {
+            m_events.setCapacity(capacity);
+        }
+        m_events.clear();
+    }
+
+    /**
+     * @brief Disable event recording
+     */
+    void disableEventRecording() {
+        m_recordEvents = false;
+    }
+
+    /**
+     * @brief Check if events are being recorded
+     */
+    bool isRecordingEvents() const {
+        return m_recordEvents;
+    }
+
+    /**
+     * @brief Recorded events, oldest first
+     */
+    const RingBuffer<CapacityEvent>& events() const {
+        return m_events;
+    }
+
+    /**
+     * @brief Drop every recorded event
+     */
+    void clearEvents() {
+        m_events.clear();
+    }
+
+protected:
+    void recordEvent(CapacityEventType type, size_t size, size_t oldCapacity, size_t newCapacity) {
+        if (m_recordEvents) {
+            m_events.push({type, size, oldCapacity, newCapacity});
+        }
+    }
+
+private:
+    RingBuffer<CapacityEvent> m_events;
+    bool m_recordEvents = false;
+};
+
+} // namespace dsav
@@ -0,0 +1,298 @@
+/**
+ * @file contention_probe.hpp
+ * @brief CAS attempt and retry counters for the lock-free containers
+ *
+ * The lock-free containers report every compare-and-swap they issue to an
+ * optional probe, keyed by a site: the shared word the CAS targeted (a ring
+ * slot, a queue's head or tail). Counters are exact; in addition every
+ * sample-th CAS of a thread is logged as a timestamped event the render
+ * thread can drain while the workload runs.
+ *
+ * Nothing here is shared between writers: each thread owns one row of
+ * counters and one single-producer/single-consumer event log, on cache
+ * lines of its own, so probing adds no contention of its own. Readers sum
+ * the rows with relaxed loads, which gives a slightly stale but consistent
+ * enough picture while the threads are running and exact totals once they
+ * have joined.
+ *
+ * Threads identify themselves with bindThread() before touching a probed
+ * container; unbound threads count as thread 0.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Which side of a container issued a CAS
+ */
+enum class ContentionOp : std::uint8_t {
+    Push,   ///< Push or enqueue
+    Pop     ///< Pop or dequeue
+};
+
+/**
+ * @brief One logged CAS
+ */
+struct ContentionEvent {
+    std::uint64_t timeNs = 0;                 ///< Since the probe was created
+    std::uint32_t site = 0;                   ///< Site the CAS targeted
+    std::uint16_t thread = 0;                 ///< Bound thread index
+    ContentionOp op = ContentionOp::Push;
+    bool success = false;                     ///< false = lost the race and retried
+};
+
+/**
+ * @brief Per-thread totals
+ */
+struct ContentionThreadStats {
+    std::uint64_t attempts = 0;   ///< CAS issued (lock acquisitions for the mutex baselines)
+    std::uint64_t failures = 0;   ///< CAS that lost the race (contended try_lock for the baselines)
+    std::uint64_t pushes = 0;     ///< Completed pushes
+    std::uint64_t pops = 0;       ///< Completed pops
+
+    /// Fraction of attempts that had to be retried
+    double retryRate() const { return attempts == 0 ? 0.0 : static_cast<double>(failures) / static_cast<double>(attempts); }
+};
+
+/**
+ * @brief Counters and sampled event logs for up to MAX_THREADS threads
+ */
+class ContentionProbe {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr size_t DEFAULT_LOG_CAPACITY = 4096;   ///< Events buffered per thread
+
+    /**
+     * @brief Create a probe
+     *
+     * @param sites Distinct CAS sites of the probed container
+     * @param threads Threads that will bind (clamped to 1..MAX_THREADS)
+     * @param sampleEvery Log every n-th CAS of a thread (0 = log nothing)
+     * @param logCapacity Events buffered per thread before new ones are dropped (rounded up to a power of two)
+     */
+    ContentionProbe(size_t sites, size_t threads, size_t sampleEvery = 1,
+                    size_t logCapacity = DEFAULT_LOG_CAPACITY)
+        : m_sites(sites == 0 ? 1 : sites)
+        , m_threads(threads == 0 ? 1 : (threads > MAX_THREADS ? MAX_THREADS : threads))
+        , m_sampleEvery(sampleEvery)
+        , m_start(std::chrono::steady_clock::now()) {
+        size_t capacity = 2;
+        while (capacity < logCapacity) capacity <<= 1;
+
+        m_rows.reserve(m_threads);
+        for (size_t i = 0; i < m_threads; ++i) {
+            m_rows.push_back(std::make_unique<Row>(m_sites, capacity));
+        }
+    }
+
+    ContentionProbe(const ContentionProbe&) = delete;
+    ContentionProbe& operator=(const ContentionProbe&) = delete;
+
+    // ===== Writers (probed threads) =====
+
+    /**
+     * @brief Set the calling thread's index for every probe (before its first op)
+     */
+    static void bindThread(size_t index) { boundThread() = index; }
+
+    /**
+     * @brief Index set by bindThread() on this thread (0 if never set)
+     */
+    static size_t& boundThread() {
+        static thread_local size_t index = 0;
+        return index;
+    }
+
+    /**
+     * @brief Count a CAS on a site
+     */
+    void recordCas(size_t site, ContentionOp op, bool success) {
+        size_t thread = threadIndex();
+        Row& row = *m_rows[thread];
+        if (site >= m_sites) site = m_sites - 1;
+
+        bump(row.siteAttempts[site]);
+        bump(row.attempts);
+        if (!success) {
+            bump(row.siteFailures[site]);
+            bump(row.failures);
+        }
+
+        if (m_sampleEvery != 0 && ++row.sinceSample >= m_sampleEvery) {
+            row.sinceSample = 0;
+            ContentionEvent event;
+            event.timeNs = elapsedNs();
+            event.site = static_cast<std::uint32_t>(site);
+            event.thread = static_cast<std::uint16_t>(thread);
+            event.op = op;
+            event.success = success;
+            log(row, event);
+        }
+    }
+
+    /**
+     * @brief Count a completed push or pop
+     */
+    void recordOp(ContentionOp op) {
+        Row& row = *m_rows[threadIndex()];
+        bump(op == ContentionOp::Push ? row.pushes : row.pops);
+    }
+
+    // ===== Readers =====
+
+    size_t siteCount() const { return m_sites; }
+    size_t threadCount() const { return m_threads; }
+
+    /**
+     * @brief Nanoseconds since the probe was created (same clock as the events)
+     */
+    std::uint64_t elapsedNs() const {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start).count());
+    }
+
+    /**
+     * @brief CAS issued on a site, summed over threads
+     */
+    std::uint64_t siteAttempts(size_t site) const { return sumSite(&Row::siteAttempts, site); }
+
+    /**
+     * @brief CAS that failed on a site, summed over threads
+     */
+    std::uint64_t siteFailures(size_t site) const { return sumSite(&Row::siteFailures, site); }
+
+    /**
+     * @brief Totals of one thread
+     */
+    ContentionThreadStats threadStats(size_t thread) const {
+        ContentionThreadStats stats;
+        if (thread >= m_threads) return stats;
+        const Row& row = *m_rows[thread];
+        stats.attempts = row.attempts.load(std::memory_order_relaxed);
+        stats.failures = row.failures.load(std::memory_order_relaxed);
+        stats.pushes = row.pushes.load(std::memory_order_relaxed);
+        stats.pops = row.pops.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /**
+     * @brief Totals over all threads
+     */
+    ContentionThreadStats totals() const {
+        ContentionThreadStats sum;
+        for (size_t i = 0; i < m_threads; ++i) {
+            ContentionThreadStats stats = threadStats(i);
+            sum.attempts += stats.attempts;
+            sum.failures += stats.failures;
+            sum.pushes += stats.pushes;
+            sum.pops += stats.pops;
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Take the logged events of every thread, oldest first per thread (one reader thread only)
+     *
+     * @param sink Called as sink(const ContentionEvent&)
+     * @return Events delivered
+     */
+    template<typename Sink>
+    size_t drainEvents(Sink&& sink) {
+        size_t delivered = 0;
+        for (auto& rowPtr : m_rows) {
+            Row& row = *rowPtr;
+            std::uint64_t head = row.logHead.load(std::memory_order_relaxed);
+            std::uint64_t tail = row.logTail.load(std::memory_order_acquire);
+            for (; head != tail; ++head) {
+                sink(row.events[head & row.logMask]);
+                ++delivered;
+            }
+            row.logHead.store(head, std::memory_order_release);
+        }
+        return delivered;
+    }
+
+    /**
+     * @brief Events that did not fit a full log
+     */
+    std::uint64_t droppedEvents() const {
+        std::uint64_t dropped = 0;
+        for (const auto& row : m_rows) {
+            dropped += row->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+private:
+    struct alignas(64) Row {
+        Row(size_t sites, size_t logCapacity)
+            : siteAttempts(new std::atomic<std::uint64_t>[sites])
+            , siteFailures(new std::atomic<std::uint64_t>[sites])
+            , events(new ContentionEvent[logCapacity])
+            , logMask(logCapacity - 1) {
+            for (size_t i = 0; i < sites; ++i) {
+                siteAttempts[i].store(0, std::memory_order_relaxed);
+                siteFailures[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<std::uint64_t> attempts{0};
+        std::atomic<std::uint64_t> failures{0};
+        std::atomic<std::uint64_t> pushes{0};
+        std::atomic<std::uint64_t> pops{0};
+        std::atomic<std::uint64_t> dropped{0};
+        size_t sinceSample = 0;                               ///< Owner only
+        std::unique_ptr<std::atomic<std::uint64_t>[]> siteAttempts;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> siteFailures;
+
+        std::unique_ptr<ContentionEvent[]> events;
+        std::uint64_t logMask;
+        alignas(64) std::atomic<std::uint64_t> logTail{0};    ///< Next event to write (owner)
+        alignas(64) std::atomic<std::uint64_t> logHead{0};    ///< Next event to read (reader)
+    };
+
+    /// Increment a counter only its owner writes (no read-modify-write needed)
+    static void bump(std::atomic<std::uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    size_t threadIndex() const {
+        size_t index = boundThread();
+        return index < m_threads ? index : 0;
+    }
+
+    static void log(Row& row, const ContentionEvent& event) {
+        std::uint64_t tail = row.logTail.load(std::memory_order_relaxed);
+        if (tail - row.logHead.load(std::memory_order_acquire) > row.logMask) {
+            bump(row.dropped);
+            return;
+        }
+        row.events[tail & row.logMask] = event;
+        row.logTail.store(tail + 1, std::memory_order_release);
+    }
+
+    std::uint64_t sumSite(std::unique_ptr<std::atomic<std::uint64_t>[]> Row::*counters, size_t site) const {
+        if (site >= m_sites) return 0;
+        std::uint64_t sum = 0;
+        for (const auto& row : m_rows) {
+            sum += ((*row).*counters)[site].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    size_t m_sites;
+    size_t m_threads;
+    size_t m_sampleEvery;
+    std::chrono::steady_clock::time_point m_start;
+    std::vector<std::unique_ptr<Row>> m_rows;
+};
+
+} // namespace dsav
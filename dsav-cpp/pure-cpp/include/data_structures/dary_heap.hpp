@@ -0,0 +1,679 @@
+/**
+ * @file dary_heap.hpp
+ * @brief Binary and d-ary heap priority queues
+ *
+ * DaryHeap<T, D, Compare> keeps a complete D-ary tree in one flat array:
+ * the children of slot i are slots D * i + 1 ... D * i + D and its parent is
+ * slot (i - 1) / D. A wider heap is shallower (log_D(n) levels), so a pop
+ * follows fewer dependent loads down the array, at the price of comparing D
+ * children per level. Because the D children of a slot are adjacent, they
+ * usually share one or two cache lines; with int keys D = 4 to 8 tends to
+ * beat the binary heap once the array no longer fits in cache (see
+ * dsav-bench --containers).
+ *
+ * IndexedDaryHeap adds a position index so a queued element can be found by
+ * its handle and have its priority changed in O(log_D n) (decrease-key, as
+ * used by Dijkstra and by schedulers that re-prioritize waiting work).
+ *
+ * Both heaps can log every swap into a ring buffer (HeapEventLog), the same
+ * way the growable stack logs its reallocations, so visualizers can replay
+ * sift-up and sift-down without the heaps knowing about rendering.
+ */
+
+#pragma once
+
+#include "op_counters.hpp"
+#include "ring_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief What a heap operation did to its array
+ */
+enum class HeapEventType : std::uint8_t {
+    Push,       ///< New element appended at slot a
+    Swap,       ///< Elements at slots a and b exchanged (one sift step)
+    Pop,        ///< Last slot a removed (after the top was swapped into it)
+    Update,     ///< Element at slot a got a new priority in place
+    Rebuild     ///< Array replaced by a new unordered one of size a (heapify follows)
+};
+
+/**
+ * @brief One heap event (plain data, recorded into a RingBuffer)
+ */
+struct HeapEvent {
+    HeapEventType type = HeapEventType::Push;
+    size_t a = 0;    ///< Slot (size for Rebuild)
+    size_t b = 0;    ///< Second slot of a Swap
+};
+
+/**
+ * @brief Opt-in log of heap events, shared by DaryHeap and IndexedDaryHeap
+ *
+ * Sifts move elements through a hole rather than swapping them, but each
+ * level is reported as the swap it is equivalent to, which is what a
+ * visualizer wants to animate. Recording is off by default.
+ */
+class HeapEventLog {
+public:
+    /// Default number of events kept by the log
+    static constexpr size_t DEFAULT_EVENT_CAPACITY = 4096;
+
+    /**
+     * @brief Enable event recording
+     *
+     * @param capacity Number of most recent events kept (older ones are overwritten)
+     */
+    void enableEventRecording(size_t capacity = DEFAULT_EVENT_CAPACITY) {
+        m_recordEvents = true;
+        if (m_events.capacity() < capacity) {
+            m_events.setCapacity(capacity);
+        }
+        m_events.clear();
+    }
+
+    /**
+     * @brief Disable event recording
+     */
+    void disableEventRecording() {
+        m_recordEvents = false;
+    }
+
+    /**
+     * @brief Check if events are being recorded
+     */
+    bool isRecordingEvents() const {
+        return m_recordEvents;
+    }
+
+    /**
+     * @brief Recorded events, oldest first
+     */
+    const RingBuffer<HeapEvent>& events() const {
+        return m_events;
+    }
+
+    /**
+     * @brief Drop every recorded event
+     */
+    void clearEvents() {
+        m_events.clear();
+    }
+
+protected:
+    void recordEvent(HeapEventType type, size_t a, size_t b = 0) {
+        if (m_recordEvents) {
+            m_events.push({type, a, b});
+        }
+    }
+
+private:
+    RingBuffer<HeapEvent> m_events;
+    bool m_recordEvents = false;
+};
+
+/**
+ * @brief Index arithmetic of a complete D-ary tree stored in an array
+ */
+template<size_t D>
+struct DaryShape {
+    static_assert(D >= 2, "a heap needs at least two children per node");
+
+    /// Parent slot of slot i (i > 0)
+    static constexpr size_t parent(size_t i) { return (i - 1) / D; }
+
+    /// First child slot of slot i (may be past the end)
+    static constexpr size_t firstChild(size_t i) { return D * i + 1; }
+
+    /// Depth of slot i (0 for the root)
+    static constexpr size_t depth(size_t i) {
+        size_t level = 0;
+        while (i > 0) {
+            i = parent(i);
+            level++;
+        }
+        return level;
+    }
+};
+
+/**
+ * @brief D-ary heap priority queue
+ *
+ * Template parameters:
+ * - T: Type of elements
+ * - D: Children per node, fixed at compile time (2 = binary heap)
+ * - Compare: Compare(a, b) is true if a must come out before b
+ *
+ * With the default std::less the smallest element is on top (a min-heap),
+ * which is what schedulers and shortest-path searches want. Note this is
+ * the opposite of std::priority_queue; pass std::greater for a max-heap.
+ */
+template<typename T, size_t D = 2, typename Compare = std::less<T>>
+class DaryHeap : public OpCounted, public HeapEventLog {
+public:
+    using Shape = DaryShape<D>;
+
+    /// Children per node
+    static constexpr size_t ARITY = D;
+
+    /**
+     * @brief Construct an empty heap
+     */
+    DaryHeap() = default;
+
+    /**
+     * @brief Construct an empty heap with a comparator instance
+     */
+    explicit DaryHeap(Compare compare) : m_compare(std::move(compare)) {}
+
+    /**
+     * @brief Insert an element (O(log_D n))
+     */
+    void push(const T& value) {
+        countGrowth();
+        m_data.push_back(value);
+        countMoves();
+        recordEvent(HeapEventType::Push, m_data.size() - 1);
+        siftUp(m_data.size() - 1);
+    }
+
+    /**
+     * @brief Move an element in (O(log_D n))
+     */
+    void push(T&& value) {
+        countGrowth();
+        m_data.push_back(std::move(value));
+        countMoves();
+        recordEvent(HeapEventType::Push, m_data.size() - 1);
+        siftUp(m_data.size() - 1);
+    }
+
+    /**
+     * @brief Remove the top element (O(D log_D n))
+     *
+     * @return The element, or std::nullopt if the heap is empty
+     */
+    std::optional<T> pop() {
+        if (m_data.empty()) {
+            return std::nullopt;
+        }
+        T top = std::move(m_data.front());
+        countMoves();
+        size_t last = m_data.size() - 1;
+        if (last > 0) {
+            m_data.front() = std::move(m_data.back());
+            countMoves();
+            recordEvent(HeapEventType::Swap, 0, last);
+        }
+        m_data.pop_back();
+        recordEvent(HeapEventType::Pop, last);
+        if (!m_data.empty()) {
+            siftDown(0);
+        }
+        return top;
+    }
+
+    /**
+     * @brief Look at the top element without removing it
+     */
+    std::optional<T> peek() const {
+        if (m_data.empty()) {
+            return std::nullopt;
+        }
+        return m_data.front();
+    }
+
+    /**
+     * @brief Replace the contents with values and restore the heap order in O(n)
+     *
+     * Floyd's bottom-up construction: sift down every internal slot, last
+     * first. Most slots sit near the bottom and sift only a level or two,
+     * which is why this beats n pushes (O(n log_D n)).
+     */
+    void heapify(std::vector<T> values) {
+        m_data = std::move(values);
+        countAllocations();
+        countMoves(m_data.size());
+        recordEvent(HeapEventType::Rebuild, m_data.size());
+        if (m_data.size() < 2) {
+            return;
+        }
+        for (size_t i = Shape::parent(m_data.size() - 1) + 1; i-- > 0; ) {
+            siftDown(i);
+        }
+    }
+
+    /**
+     * @brief Reserve space for n elements
+     */
+    void reserve(size_t n) {
+        m_data.reserve(n);
+    }
+
+    /**
+     * @brief Remove every element
+     */
+    void clear() {
+        m_data.clear();
+    }
+
+    size_t size() const { return m_data.size(); }
+    bool isEmpty() const { return m_data.empty(); }
+
+    /**
+     * @brief Element at a slot of the array (slot < size())
+     */
+    const T& at(size_t slot) const { return m_data[slot]; }
+
+    /**
+     * @brief The underlying array, in heap order
+     */
+    const std::vector<T>& data() const { return m_data; }
+
+    /**
+     * @brief Check the heap property (no child comes out before its parent)
+     */
+    bool isValid() const {
+        for (size_t i = 1; i < m_data.size(); ++i) {
+            if (m_compare(m_data[i], m_data[Shape::parent(i)])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    void countGrowth() const {
+        if (m_data.size() == m_data.capacity()) {
+            countAllocations();
+            countMoves(m_data.size());
+        }
+    }
+
+    void siftUp(size_t i) {
+        T value = std::move(m_data[i]);
+        while (i > 0) {
+            size_t p = Shape::parent(i);
+            countComparisons();
+            if (!m_compare(value, m_data[p])) {
+                break;
+            }
+            m_data[i] = std::move(m_data[p]);
+            countMoves();
+            countHops();
+            recordEvent(HeapEventType::Swap, p, i);
+            i = p;
+        }
+        m_data[i] = std::move(value);
+        countMoves();
+    }
+
+    void siftDown(size_t i) {
+        const size_t n = m_data.size();
+        T value = std::move(m_data[i]);
+        while (true) {
+            size_t first = Shape::firstChild(i);
+            if (first >= n) {
+                break;
+            }
+            // The D children are adjacent: pick the one that comes out first
+            size_t best = first;
+            size_t end = first + D < n ? first + D : n;
+            for (size_t c = first + 1; c < end; ++c) {
+                if (m_compare(m_data[c], m_data[best])) {
+                    best = c;
+                }
+            }
+            countComparisons(end - first);
+            countHops();
+            if (!m_compare(m_data[best], value)) {
+                break;
+            }
+            m_data[i] = std::move(m_data[best]);
+            countMoves();
+            recordEvent(HeapEventType::Swap, i, best);
+            i = best;
+        }
+        m_data[i] = std::move(value);
+        countMoves();
+    }
+
+    std::vector<T> m_data;   ///< Heap-ordered complete D-ary tree
+    Compare m_compare;
+};
+
+/**
+ * @brief D-ary heap whose elements can be found and re-prioritized by handle
+ *
+ * push() returns a handle that stays valid until the element is popped;
+ * handles of popped elements are reused. Values and handles live in two
+ * parallel arrays so sifting compares a dense array of values, and a third
+ * array maps each handle to its current slot.
+ *
+ * Same ordering convention as DaryHeap: Compare(a, b) is true if a must
+ * come out before b (std::less gives a min-heap).
+ */
+template<typename T, size_t D = 2, typename Compare = std::less<T>>
+class IndexedDaryHeap : public OpCounted, public HeapEventLog {
+public:
+    using Shape = DaryShape<D>;
+    using Handle = std::uint32_t;
+
+    /// Children per node
+    static constexpr size_t ARITY = D;
+
+    /// Handle meaning "no element"
+    static constexpr Handle NO_HANDLE = 0xFFFFFFFFu;
+
+    /**
+     * @brief An element and its handle
+     */
+    struct Entry {
+        Handle handle = NO_HANDLE;
+        T value{};
+    };
+
+    /**
+     * @brief Construct an empty heap
+     */
+    IndexedDaryHeap() = default;
+
+    /**
+     * @brief Construct an empty heap with a comparator instance
+     */
+    explicit IndexedDaryHeap(Compare compare) : m_compare(std::move(compare)) {}
+
+    /**
+     * @brief Insert an element (O(log_D n))
+     *
+     * @return Handle of the new element
+     */
+    Handle push(const T& value) {
+        Handle handle = allocateHandle();
+        if (m_values.size() == m_values.capacity()) {
+            countAllocations();
+            countMoves(m_values.size());
+        }
+        size_t slot = m_values.size();
+        m_values.push_back(value);
+        m_handles.push_back(handle);
+        m_slots[handle] = slot;
+        countMoves();
+        recordEvent(HeapEventType::Push, slot);
+        siftUp(slot);
+        return handle;
+    }
+
+    /**
+     * @brief Remove the top element (O(D log_D n))
+     *
+     * @return The element and its (now released) handle, or std::nullopt if empty
+     */
+    std::optional<Entry> pop() {
+        if (m_values.empty()) {
+            return std::nullopt;
+        }
+        Entry top{m_handles.front(), std::move(m_values.front())};
+        countMoves();
+        size_t last = m_values.size() - 1;
+        if (last > 0) {
+            place(0, std::move(m_values.back()), m_handles.back());
+            recordEvent(HeapEventType::Swap, 0, last);
+        }
+        m_values.pop_back();
+        m_handles.pop_back();
+        recordEvent(HeapEventType::Pop, last);
+        releaseHandle(top.handle);
+        if (!m_values.empty()) {
+            siftDown(0);
+        }
+        return top;
+    }
+
+    /**
+     * @brief Look at the top element without removing it
+     */
+    std::optional<Entry> peek() const {
+        if (m_values.empty()) {
+            return std::nullopt;
+        }
+        return Entry{m_handles.front(), m_values.front()};
+    }
+
+    /**
+     * @brief Move an element toward the top by improving its priority
+     *
+     * @param handle Element to change
+     * @param value New value; must not come out after the current one
+     * @return false if the handle is not queued or the value would sink the element
+     */
+    bool decreaseKey(Handle handle, const T& value) {
+        if (!contains(handle)) {
+            return false;
+        }
+        size_t slot = m_slots[handle];
+        countComparisons();
+        if (m_compare(m_values[slot], value)) {
+            return false;
+        }
+        m_values[slot] = value;
+        countMoves();
+        recordEvent(HeapEventType::Update, slot);
+        siftUp(slot);
+        return true;
+    }
+
+    /**
+     * @brief Give an element any new value and re-sift it in whichever direction
+     *
+     * @return false if the handle is not queued
+     */
+    bool update(Handle handle, const T& value) {
+        if (!contains(handle)) {
+            return false;
+        }
+        size_t slot = m_slots[handle];
+        countComparisons();
+        bool rises = m_compare(value, m_values[slot]);
+        m_values[slot] = value;
+        countMoves();
+        recordEvent(HeapEventType::Update, slot);
+        if (rises) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Replace the contents with values and restore the heap order in O(n)
+     *
+     * Value i gets handle i. Every earlier handle is released.
+     */
+    void heapify(std::vector<T> values) {
+        m_values = std::move(values);
+        countAllocations();
+        countMoves(m_values.size());
+
+        size_t n = m_values.size();
+        m_handles.resize(n);
+        m_slots.assign(n, NO_SLOT);
+        m_freeHandles.clear();
+        for (size_t i = 0; i < n; ++i) {
+            m_handles[i] = static_cast<Handle>(i);
+            m_slots[i] = i;
+        }
+        recordEvent(HeapEventType::Rebuild, n);
+        if (n < 2) {
+            return;
+        }
+        for (size_t i = Shape::parent(n - 1) + 1; i-- > 0; ) {
+            siftDown(i);
+        }
+    }
+
+    /**
+     * @brief Check whether a handle refers to a queued element
+     */
+    bool contains(Handle handle) const {
+        return handle < m_slots.size() && m_slots[handle] != NO_SLOT;
+    }
+
+    /**
+     * @brief Current value of a queued element
+     */
+    std::optional<T> valueOf(Handle handle) const {
+        if (!contains(handle)) {
+            return std::nullopt;
+        }
+        return m_values[m_slots[handle]];
+    }
+
+    /**
+     * @brief Current slot of a queued element (handle must be queued)
+     */
+    size_t slotOf(Handle handle) const { return m_slots[handle]; }
+
+    /**
+     * @brief Handle of the element at a slot (slot < size())
+     */
+    Handle handleAt(size_t slot) const { return m_handles[slot]; }
+
+    /**
+     * @brief Value of the element at a slot (slot < size())
+     */
+    const T& at(size_t slot) const { return m_values[slot]; }
+
+    /**
+     * @brief The value array, in heap order
+     */
+    const std::vector<T>& data() const { return m_values; }
+
+    /**
+     * @brief One past the largest handle ever handed out (sizes per-handle tables)
+     */
+    size_t handleLimit() const { return m_slots.size(); }
+
+    /**
+     * @brief Reserve space for n elements
+     */
+    void reserve(size_t n) {
+        m_values.reserve(n);
+        m_handles.reserve(n);
+        m_slots.reserve(n);
+    }
+
+    /**
+     * @brief Remove every element and release every handle
+     */
+    void clear() {
+        m_values.clear();
+        m_handles.clear();
+        m_slots.clear();
+        m_freeHandles.clear();
+    }
+
+    size_t size() const { return m_values.size(); }
+    bool isEmpty() const { return m_values.empty(); }
+
+    /**
+     * @brief Check the heap property and that the position index matches the array
+     */
+    bool isValid() const {
+        for (size_t i = 0; i < m_values.size(); ++i) {
+            if (m_slots[m_handles[i]] != i) {
+                return false;
+            }
+            if (i > 0 && m_compare(m_values[i], m_values[Shape::parent(i)])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    Handle allocateHandle() {
+        if (!m_freeHandles.empty()) {
+            Handle handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+            return handle;
+        }
+        m_slots.push_back(NO_SLOT);
+        return static_cast<Handle>(m_slots.size() - 1);
+    }
+
+    void releaseHandle(Handle handle) {
+        m_slots[handle] = NO_SLOT;
+        m_freeHandles.push_back(handle);
+    }
+
+    /// Store an element at a slot and point its handle there
+    void place(size_t slot, T&& value, Handle handle) {
+        m_values[slot] = std::move(value);
+        m_handles[slot] = handle;
+        m_slots[handle] = slot;
+        countMoves();
+    }
+
+    void siftUp(size_t i) {
+        T value = std::move(m_values[i]);
+        Handle handle = m_handles[i];
+        while (i > 0) {
+            size_t p = Shape::parent(i);
+            countComparisons();
+            if (!m_compare(value, m_values[p])) {
+                break;
+            }
+            place(i, std::move(m_values[p]), m_handles[p]);
+            countHops();
+            recordEvent(HeapEventType::Swap, p, i);
+            i = p;
+        }
+        place(i, std::move(value), handle);
+    }
+
+    void siftDown(size_t i) {
+        const size_t n = m_values.size();
+        T value = std::move(m_values[i]);
+        Handle handle = m_handles[i];
+        while (true) {
+            size_t first = Shape::firstChild(i);
+            if (first >= n) {
+                break;
+            }
+            size_t best = first;
+            size_t end = first + D < n ? first + D : n;
+            for (size_t c = first + 1; c < end; ++c) {
+                if (m_compare(m_values[c], m_values[best])) {
+                    best = c;
+                }
+            }
+            countComparisons(end - first);
+            countHops();
+            if (!m_compare(m_values[best], value)) {
+                break;
+            }
+            place(i, std::move(m_values[best]), m_handles[best]);
+            recordEvent(HeapEventType::Swap, i, best);
+            i = best;
+        }
+        place(i, std::move(value), handle);
+    }
+
+    std::vector<T> m_values;            ///< Heap-ordered values
+    std::vector<Handle> m_handles;      ///< Handle of the value in the same slot
+    std::vector<size_t> m_slots;        ///< Slot per handle (NO_SLOT if released)
+    std::vector<Handle> m_freeHandles;  ///< Released handles, reused by push()
+    Compare m_compare;
+};
+
+} // namespace dsav
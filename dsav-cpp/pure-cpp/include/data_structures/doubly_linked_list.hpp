@@ -0,0 +1,424 @@
+/**
+ * @file doubly_linked_list.hpp
+ * @brief Doubly linked list data structure implementation
+ *
+ * Same interface as LinkedList, but every node also links to its
+ * predecessor. That makes deleteBack O(1) and lets positional operations
+ * walk from whichever end is closer, at the cost of one more index per node.
+ */
+
+#pragma once
+
+#include "node_pool.hpp"
+#include "op_counters.hpp"
+#include <optional>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Node structure for doubly linked list
+ *
+ * Both links are pool indices (NULL_NODE past either end of the list).
+ *
+ * @tparam T Type of data stored in the node
+ */
+template<typename T>
+struct DListNode {
+    T data;
+    NodeIndex prev;
+    NodeIndex next;
+
+    explicit DListNode(const T& value) : data(value), prev(NULL_NODE), next(NULL_NODE) {}
+    explicit DListNode(T&& value) : data(std::move(value)), prev(NULL_NODE), next(NULL_NODE) {}
+
+    /// Construct the data in place from T's constructor arguments
+    template<typename... Args>
+    explicit DListNode(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), prev(NULL_NODE), next(NULL_NODE) {}
+};
+
+/// Handle to a doubly linked node as exposed to visualizers
+template<typename T>
+using DListNodeHandle = NodeHandle<DListNode<T>>;
+
+/**
+ * @brief Doubly linked list data structure
+ *
+ * Template parameter:
+ * - T: Type of elements stored in the list
+ *
+ * Nodes are stored in a NodePool, so no per-node heap allocation is performed.
+ *
+ * Complexity: insertFront, insertBack, deleteFront, deleteBack, size O(1);
+ * insertAt, deleteAt O(min(i, n - i)); find O(n).
+ */
+template<typename T>
+class DoublyLinkedList : public OpCounted {
+public:
+    /**
+     * @brief Construct an empty doubly linked list
+     */
+    DoublyLinkedList() = default;
+
+    /**
+     * @brief Insert a value at the front of the list
+     *
+     * @param value Value to insert
+     */
+    void insertFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    /**
+     * @brief Move a value in at the front of the list
+     */
+    void insertFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at the front of the list
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplaceFront(Args&&... args) {
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
+        linkBefore(newNode, m_head);
+    }
+
+    /**
+     * @brief Insert a value at the back of the list
+     *
+     * @param value Value to insert
+     */
+    void insertBack(const T& value) {
+        emplaceBack(value);
+    }
+
+    /**
+     * @brief Move a value in at the back of the list
+     */
+    void insertBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at the back of the list
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplaceBack(Args&&... args) {
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
+        linkBefore(newNode, NULL_NODE);
+    }
+
+    /**
+     * @brief Insert a value at a specific position
+     *
+     * @param index Position to insert at (0-based)
+     * @param value Value to insert
+     * @return true if successful, false if index out of range
+     */
+    bool insertAt(size_t index, const T& value) {
+        return emplaceAt(index, value);
+    }
+
+    /**
+     * @brief Move a value in at a specific position
+     *
+     * @return true if successful, false if index out of range
+     */
+    bool insertAt(size_t index, T&& value) {
+        return emplaceAt(index, std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at a specific position
+     *
+     * @param index Position to insert at (0-based, size() appends)
+     * @param args Constructor arguments of T
+     * @return true if successful, false if index out of range
+     */
+    template<typename... Args>
+    bool emplaceAt(size_t index, Args&&... args) {
+        if (index > m_size) {
+            return false;
+        }
+
+        NodeIndex before = (index == m_size) ? NULL_NODE : nodeAt(index);
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
+        linkBefore(newNode, before);
+        return true;
+    }
+
+    /**
+     * @brief Delete the first node (its value is moved out)
+     *
+     * @return The deleted value if successful, std::nullopt if list is empty
+     */
+    std::optional<T> deleteFront() {
+        if (m_head == NULL_NODE) {
+            return std::nullopt;
+        }
+        return unlink(m_head);
+    }
+
+    /**
+     * @brief Delete the last node (its value is moved out)
+     *
+     * O(1): the tail's prev link names the new last node.
+     *
+     * @return The deleted value if successful, std::nullopt if list is empty
+     */
+    std::optional<T> deleteBack() {
+        if (m_tail == NULL_NODE) {
+            return std::nullopt;
+        }
+        return unlink(m_tail);
+    }
+
+    /**
+     * @brief Delete node at a specific position
+     *
+     * @param index Position to delete (0-based)
+     * @return The deleted value if successful, std::nullopt if index out of range
+     */
+    std::optional<T> deleteAt(size_t index) {
+        if (index >= m_size) {
+            return std::nullopt;
+        }
+        return unlink(nodeAt(index));
+    }
+
+    /**
+     * @brief Search for a value in the list
+     *
+     * @param value Value to search for
+     * @return Index of first occurrence, or std::nullopt if not found
+     */
+    std::optional<size_t> find(const T& value) const {
+        NodeIndex current = m_head;
+        size_t index = 0;
+
+        while (current != NULL_NODE) {
+            countComparisons();
+            if (m_pool[current].data == value) {
+                return index;
+            }
+            current = m_pool[current].next;
+            countHops();
+            index++;
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Check if list is empty
+     *
+     * @return true if empty
+     */
+    bool isEmpty() const {
+        return m_head == NULL_NODE;
+    }
+
+    /**
+     * @brief Get current number of nodes
+     *
+     * @return Number of nodes
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Clear all nodes
+     */
+    void clear() {
+        m_pool.clear();
+        m_head = NULL_NODE;
+        m_tail = NULL_NODE;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of nodes
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count);
+    }
+
+    /**
+     * @brief Get head node (for visualization)
+     *
+     * @return Handle to head node (empty if list is empty)
+     */
+    DListNodeHandle<T> head() const {
+        return DListNodeHandle<T>(&m_pool, m_head);
+    }
+
+    /**
+     * @brief Get tail node (for visualization)
+     *
+     * @return Handle to the last node (empty if list is empty)
+     */
+    DListNodeHandle<T> tail() const {
+        return DListNodeHandle<T>(&m_pool, m_tail);
+    }
+
+    // ===== Bulk operations =====
+
+    /**
+     * @brief Append a range of values in order
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            m_pool.reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplaceBack(*first);
+        }
+    }
+
+    /**
+     * @brief Move every node of another list to the back of this one
+     *
+     * As LinkedList::splice: O(1) when this list is empty (the pools are
+     * swapped), otherwise the k values of other are moved across. other is
+     * left empty.
+     *
+     * @param other List to take the nodes from
+     */
+    void splice(DoublyLinkedList& other) {
+        if (&other == this || other.m_head == NULL_NODE) {
+            return;
+        }
+
+        if (m_head == NULL_NODE) {
+            std::swap(m_pool, other.m_pool);
+            std::swap(m_head, other.m_head);
+            std::swap(m_tail, other.m_tail);
+            std::swap(m_size, other.m_size);
+            other.clear();
+            return;
+        }
+
+        m_pool.reserve(m_size + other.m_size);
+        for (NodeIndex current = other.m_head; current != NULL_NODE; current = other.m_pool[current].next) {
+            emplaceBack(std::move(other.m_pool[current].data));
+        }
+        other.clear();
+    }
+
+    /**
+     * @brief Traverse list and apply function to each node
+     *
+     * @param func Function to apply to each node's data
+     */
+    void traverse(std::function<void(const T&)> func) const {
+        NodeIndex current = m_head;
+        while (current != NULL_NODE) {
+            func(m_pool[current].data);
+            current = m_pool[current].next;
+        }
+    }
+
+private:
+    /**
+     * @brief Walk to the node at a position from the nearer end (caller guarantees it exists)
+     */
+    NodeIndex nodeAt(size_t index) const {
+        NodeIndex current;
+        if (index <= m_size / 2) {
+            current = m_head;
+            for (size_t i = 0; i < index; ++i) {
+                current = m_pool[current].next;
+            }
+            countHops(index);
+        } else {
+            current = m_tail;
+            size_t steps = m_size - 1 - index;
+            for (size_t i = 0; i < steps; ++i) {
+                current = m_pool[current].prev;
+            }
+            countHops(steps);
+        }
+        return current;
+    }
+
+    /**
+     * @brief Link a detached node before another (NULL_NODE appends)
+     */
+    void linkBefore(NodeIndex node, NodeIndex before) {
+        NodeIndex after = (before == NULL_NODE) ? m_tail : m_pool[before].prev;
+
+        m_pool[node].prev = after;
+        m_pool[node].next = before;
+        if (after == NULL_NODE) {
+            m_head = node;
+        } else {
+            m_pool[after].next = node;
+        }
+        if (before == NULL_NODE) {
+            m_tail = node;
+        } else {
+            m_pool[before].prev = node;
+        }
+        m_size++;
+    }
+
+    /**
+     * @brief Unlink a live node, release it and move its value out
+     */
+    T unlink(NodeIndex node) {
+        NodeIndex prev = m_pool[node].prev;
+        NodeIndex next = m_pool[node].next;
+
+        if (prev == NULL_NODE) {
+            m_head = next;
+        } else {
+            m_pool[prev].next = next;
+        }
+        if (next == NULL_NODE) {
+            m_tail = prev;
+        } else {
+            m_pool[next].prev = prev;
+        }
+
+        T value = std::move(m_pool[node].data);
+        countMoves();
+        m_pool.release(node);
+        m_size--;
+        return value;
+    }
+
+    /**
+     * @brief Take a node from the pool and construct its value from args
+     */
+    template<typename... Args>
+    NodeIndex allocateNode(Args&&... args) {
+        countAllocations();
+        countMoves();
+        return m_pool.allocate(std::in_place, std::forward<Args>(args)...);
+    }
+
+    NodePool<DListNode<T>> m_pool;    ///< Node storage
+    NodeIndex m_head = NULL_NODE;     ///< First node
+    NodeIndex m_tail = NULL_NODE;     ///< Last node
+    size_t m_size = 0;                ///< Number of nodes
+};
+
+} // namespace dsav
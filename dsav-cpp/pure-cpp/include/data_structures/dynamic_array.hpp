@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include "op_counters.hpp"
 #include <vector>
 #include <optional>
 #include <stdexcept>
 #include <algorithm>
+#include <utility>
 
 namespace dsav {
 
@@ -24,7 +26,7 @@ namespace dsav {
  * Wraps std::vector to provide a clean interface for visualization.
  */
 template<typename T>
-class DynamicArray {
+class DynamicArray : public OpCounted {
 public:
     /**
      * @brief Construct an empty array
@@ -46,9 +48,32 @@ public:
      * @param value Value to insert
      */
     void pushBack(const T& value) {
+        countInsertion(0);
         m_data.push_back(value);
     }
 
+    /**
+     * @brief Move an element onto the end
+     *
+     * @param value Value to move in
+     */
+    void pushBack(T&& value) {
+        countInsertion(0);
+        m_data.push_back(std::move(value));
+    }
+
+    /**
+     * @brief Construct an element in place at the end
+     *
+     * @param args Constructor arguments of T
+     * @return Reference to the new element
+     */
+    template<typename... Args>
+    T& emplaceBack(Args&&... args) {
+        countInsertion(0);
+        return m_data.emplace_back(std::forward<Args>(args)...);
+    }
+
     /**
      * @brief Insert an element at a specific index
      *
@@ -59,17 +84,44 @@ public:
      * @return true if successful, false if index out of range
      */
     bool insert(size_t index, const T& value) {
+        return emplace(index, value);
+    }
+
+    /**
+     * @brief Move an element in at a specific index
+     *
+     * @param index Index where to insert (0 to size)
+     * @param value Value to move in
+     * @return true if successful, false if index out of range
+     */
+    bool insert(size_t index, T&& value) {
+        return emplace(index, std::move(value));
+    }
+
+    /**
+     * @brief Construct an element in place at a specific index
+     *
+     * Shifts elements to the right (by move) to make space.
+     *
+     * @param index Index where to insert (0 to size)
+     * @param args Constructor arguments of T
+     * @return true if successful, false if index out of range
+     */
+    template<typename... Args>
+    bool emplace(size_t index, Args&&... args) {
         if (index > m_data.size()) {
             return false;
         }
-        m_data.insert(m_data.begin() + index, value);
+        countInsertion(m_data.size() - index);
+        m_data.emplace(m_data.begin() + index, std::forward<Args>(args)...);
         return true;
     }
 
     /**
      * @brief Delete element at a specific index
      *
-     * Shifts elements to the left to fill the gap.
+     * Shifts elements to the left to fill the gap. The value is moved out,
+     * not copied.
      *
      * @param index Index of element to delete
      * @return The deleted value if successful, std::nullopt if index out of range
@@ -78,8 +130,9 @@ public:
         if (index >= m_data.size()) {
             return std::nullopt;
         }
-        T value = m_data[index];
+        T value = std::move(m_data[index]);
         m_data.erase(m_data.begin() + index);
+        countMoves(m_data.size() - index + 1);
         return value;
     }
 
@@ -133,6 +186,7 @@ public:
      */
     std::optional<size_t> find(const T& value) const {
         auto it = std::find(m_data.begin(), m_data.end(), value);
+        countComparisons(static_cast<std::uint64_t>(std::distance(m_data.begin(), it)) + (it != m_data.end() ? 1 : 0));
         if (it != m_data.end()) {
             return static_cast<size_t>(std::distance(m_data.begin(), it));
         }
@@ -151,6 +205,23 @@ public:
             return false;
         }
         m_data[index] = value;
+        countMoves();
+        return true;
+    }
+
+    /**
+     * @brief Move a new value into the element at index
+     *
+     * @param index Index to update
+     * @param value New value
+     * @return true if successful, false if index out of range
+     */
+    bool update(size_t index, T&& value) {
+        if (index >= m_data.size()) {
+            return false;
+        }
+        m_data[index] = std::move(value);
+        countMoves();
         return true;
     }
 
@@ -188,6 +259,19 @@ public:
         m_data.clear();
     }
 
+    /**
+     * @brief Replace the contents with count elements copied from first
+     *
+     * One allocation at most, for restoring a saved array in bulk.
+     */
+    void assign(const T* first, size_t count) {
+        if (count > m_data.capacity()) {
+            countAllocations();
+        }
+        countMoves(count);
+        m_data.assign(first, first + count);
+    }
+
     /**
      * @brief Get direct access to internal data (for visualization)
      *
@@ -235,6 +319,19 @@ public:
     }
 
 private:
+    /**
+     * @brief Count an insertion that shifts elements right (and may reallocate)
+     *
+     * @param shifted Elements after the insertion point
+     */
+    void countInsertion(size_t shifted) const {
+        if (m_data.size() == m_data.capacity()) {
+            countAllocations();
+            countMoves(m_data.size());
+        }
+        countMoves(shifted + 1);
+    }
+
     std::vector<T> m_data;  ///< Internal dynamic array
 };
 
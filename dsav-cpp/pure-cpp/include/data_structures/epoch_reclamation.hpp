@@ -0,0 +1,281 @@
+/**
+ * @file epoch_reclamation.hpp
+ * @brief Epoch-based memory reclamation for the lock-free containers
+ *
+ * A lock-free pop unlinks a node while other threads may still be reading
+ * it, so the node cannot be deleted right away. Threads pin the domain
+ * while they touch shared nodes and retire unlinked nodes instead of
+ * deleting them. The global epoch only advances once every pinned thread
+ * has seen the current one, so a node retired in epoch e is unreachable by
+ * everyone once the epoch reaches e + 2 and can be freed then.
+ *
+ * Each thread claims a slot the first time it pins a domain and gives it
+ * back when it exits; whatever it retired and could not free yet is handed
+ * to the domain, which frees it later or in its destructor.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace dsav {
+
+class EpochDomain;
+
+namespace epoch_detail {
+
+/// Domains alive right now; thread exit only releases slots of these
+inline std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline std::unordered_set<std::uint64_t>& liveDomains() {
+    static std::unordered_set<std::uint64_t> domains;
+    return domains;
+}
+
+inline std::uint64_t nextDomainId() {
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace epoch_detail
+
+/**
+ * @brief Reclamation domain shared by the threads of one container
+ *
+ * Usage: hold a Guard for as long as shared nodes are read, and retire()
+ * every node unlinked from the structure exactly once. The destructor frees
+ * everything still retired, so no thread may hold a guard by then.
+ */
+class EpochDomain {
+    struct Slot;
+
+public:
+    static constexpr size_t MAX_THREADS = 256;       ///< Threads that can pin the domain at once
+    static constexpr size_t COLLECT_INTERVAL = 64;   ///< Retires between reclamation passes
+
+    EpochDomain() : m_id(epoch_detail::nextDomainId()), m_slots(std::make_unique<Slot[]>(MAX_THREADS)) {
+        std::lock_guard<std::mutex> lock(epoch_detail::registryMutex());
+        epoch_detail::liveDomains().insert(m_id);
+    }
+
+    ~EpochDomain() {
+        {
+            std::lock_guard<std::mutex> lock(epoch_detail::registryMutex());
+            epoch_detail::liveDomains().erase(m_id);
+        }
+        for (size_t i = 0; i < MAX_THREADS; ++i) {
+            freeAll(m_slots[i].retired);
+        }
+        freeAll(m_orphans);
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /**
+     * @brief Keeps the calling thread pinned to the epoch it entered (nests)
+     */
+    class Guard {
+    public:
+        explicit Guard(EpochDomain& domain) : m_slot(domain.localSlot()) {
+            if (m_slot.depth++ == 0) {
+                std::uint64_t epoch = domain.m_epoch.load(std::memory_order_relaxed);
+                m_slot.state.store((epoch << 1) | 1, std::memory_order_relaxed);
+                // Publish the pin before reading any shared pointer
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        ~Guard() {
+            if (--m_slot.depth == 0) {
+                m_slot.state.store(0, std::memory_order_release);
+            }
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Slot& m_slot;
+    };
+
+    /**
+     * @brief Hand over an unlinked node to be deleted once no thread can reach it
+     *
+     * The caller must have removed the node from the structure already.
+     */
+    template<typename T>
+    void retire(T* node) {
+        retire(node, [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief Same, with the deleter spelled out
+     */
+    void retire(void* node, void (*deleter)(void*)) {
+        Slot& slot = localSlot();
+        slot.retired.push_back({node, deleter, m_epoch.load(std::memory_order_acquire)});
+        if (++slot.sinceCollect >= COLLECT_INTERVAL) {
+            slot.sinceCollect = 0;
+            tryAdvance();
+            collect(slot.retired);
+            if (m_orphanCount.load(std::memory_order_relaxed) != 0 && m_orphanMutex.try_lock()) {
+                collect(m_orphans);
+                m_orphanCount.store(m_orphans.size(), std::memory_order_relaxed);
+                m_orphanMutex.unlock();
+            }
+        }
+    }
+
+    /**
+     * @brief Current global epoch
+     */
+    std::uint64_t epoch() const { return m_epoch.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Nodes retired by the calling thread and not freed yet
+     */
+    size_t pendingOnThisThread() { return localSlot().retired.size(); }
+
+private:
+    struct Retired {
+        void* node;
+        void (*deleter)(void*);
+        std::uint64_t epoch;    ///< Global epoch when the node was retired
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> state{0};   ///< (epoch << 1) | 1 while pinned, 0 otherwise
+        std::atomic<bool> claimed{false};      ///< Owned by a live thread
+        unsigned depth = 0;                    ///< Nested guards (owner only)
+        size_t sinceCollect = 0;               ///< Retires since the last pass (owner only)
+        std::vector<Retired> retired;          ///< Waiting to be freed (owner only)
+    };
+
+    /**
+     * @brief Slots this thread claimed, released when the thread exits
+     */
+    struct ThreadSlots {
+        std::vector<std::pair<EpochDomain*, std::uint64_t>> domains;  ///< Domain and its id
+        std::vector<Slot*> slots;
+
+        ~ThreadSlots() {
+            std::lock_guard<std::mutex> lock(epoch_detail::registryMutex());
+            const auto& live = epoch_detail::liveDomains();
+            for (size_t i = 0; i < domains.size(); ++i) {
+                // The address of a destroyed domain may have been reused; the id may not
+                if (live.count(domains[i].second) != 0) {
+                    domains[i].first->release(*slots[i]);
+                }
+            }
+        }
+    };
+
+    static ThreadSlots& threadSlots() {
+        static thread_local ThreadSlots slots;
+        return slots;
+    }
+
+    Slot& localSlot() {
+        ThreadSlots& local = threadSlots();
+        for (size_t i = 0; i < local.domains.size(); ++i) {
+            if (local.domains[i].first == this && local.domains[i].second == m_id) {
+                return *local.slots[i];
+            }
+        }
+
+        for (size_t i = 0; i < MAX_THREADS; ++i) {
+            bool expected = false;
+            if (!m_slots[i].claimed.load(std::memory_order_relaxed) &&
+                m_slots[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                // Drop entries of destroyed domains before remembering this one
+                std::lock_guard<std::mutex> lock(epoch_detail::registryMutex());
+                const auto& live = epoch_detail::liveDomains();
+                for (size_t j = local.domains.size(); j-- > 0;) {
+                    if (live.count(local.domains[j].second) == 0) {
+                        local.domains.erase(local.domains.begin() + static_cast<std::ptrdiff_t>(j));
+                        local.slots.erase(local.slots.begin() + static_cast<std::ptrdiff_t>(j));
+                    }
+                }
+                local.domains.emplace_back(this, m_id);
+                local.slots.push_back(&m_slots[i]);
+                return m_slots[i];
+            }
+        }
+        throw std::runtime_error("EpochDomain: more than MAX_THREADS threads");
+    }
+
+    /**
+     * @brief Give a slot back when its thread exits (registry mutex held)
+     */
+    void release(Slot& slot) {
+        {
+            std::lock_guard<std::mutex> lock(m_orphanMutex);
+            m_orphans.insert(m_orphans.end(), slot.retired.begin(), slot.retired.end());
+            m_orphanCount.store(m_orphans.size(), std::memory_order_relaxed);
+        }
+        slot.retired.clear();
+        slot.depth = 0;
+        slot.sinceCollect = 0;
+        slot.state.store(0, std::memory_order_relaxed);
+        slot.claimed.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Advance the global epoch if every pinned thread has seen it
+     */
+    void tryAdvance() {
+        std::uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (size_t i = 0; i < MAX_THREADS; ++i) {
+            std::uint64_t state = m_slots[i].state.load(std::memory_order_acquire);
+            if ((state & 1) != 0 && (state >> 1) != epoch) {
+                return;
+            }
+        }
+        m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Free the nodes retired at least two epochs ago
+     */
+    void collect(std::vector<Retired>& retired) {
+        std::uint64_t epoch = m_epoch.load(std::memory_order_acquire);
+        size_t kept = 0;
+        for (Retired& entry : retired) {
+            if (entry.epoch + 2 <= epoch) {
+                entry.deleter(entry.node);
+            } else {
+                retired[kept++] = entry;
+            }
+        }
+        retired.resize(kept);
+    }
+
+    static void freeAll(std::vector<Retired>& retired) {
+        for (Retired& entry : retired) {
+            entry.deleter(entry.node);
+        }
+        retired.clear();
+    }
+
+    const std::uint64_t m_id;                         ///< Never reused, unlike the address
+    alignas(64) std::atomic<std::uint64_t> m_epoch{0};
+    std::unique_ptr<Slot[]> m_slots;
+    std::mutex m_orphanMutex;
+    std::vector<Retired> m_orphans;                   ///< Left behind by exited threads
+    std::atomic<size_t> m_orphanCount{0};
+};
+
+} // namespace dsav
@@ -0,0 +1,1054 @@
+/**
+ * @file hash_map.hpp
+ * @brief Open-addressing hash map with Robin Hood or SwissTable-style probing
+ *
+ * HashMap<K, V, Mode> stores its entries in one flat slot array, so a lookup
+ * walks adjacent memory instead of chasing a bucket list the way
+ * std::unordered_map does. Two probing schemes are available:
+ *
+ * - HashProbing::RobinHood: linear probing where an insert takes the slot of
+ *   any entry that sits closer to its home slot than the new key would
+ *   ("robs the rich"). Probe lengths stay short and even, a lookup can stop
+ *   as soon as it meets an entry closer to home than itself, and erase
+ *   shifts the following entries back so no tombstones build up.
+ * - HashProbing::Swiss: one control byte per slot holding 7 bits of the
+ *   hash. A lookup loads a 16-byte group of control bytes and matches them
+ *   all at once (SSE2 on x86-64, NEON on ARM64, a byte loop elsewhere), so
+ *   it compares keys only for the slots whose 7 bits already match.
+ *
+ * Growing is incremental: when the table reaches its maximum load a table
+ * of twice the capacity is allocated and every later insert or erase moves
+ * a few slots of the old table across (setRehashStep()). No single insert
+ * pays for copying the whole table; lookups check both tables until the
+ * old one is drained.
+ *
+ * Like the heaps, the map can log its probes and moves into a ring buffer
+ * (HashEventLog) so the visualizer can replay them.
+ *
+ * Keys and values must be default-constructible and movable. The hash is
+ * passed through a 64-bit finalizer before use, so identity hashes (such as
+ * std::hash<int> in libstdc++) still spread over the table.
+ */
+
+#pragma once
+
+#include "op_counters.hpp"
+#include "ring_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define DSAV_HASH_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define DSAV_HASH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace dsav {
+
+/**
+ * @brief Probing scheme of a HashMap
+ */
+enum class HashProbing : std::uint8_t {
+    RobinHood,  ///< Linear probing with displacement balancing and backward-shift erase
+    Swiss       ///< Control-byte groups matched 16 slots at a time
+};
+
+/**
+ * @brief Which of the two tables of a rehashing map an event or query refers to
+ */
+enum class HashTableId : std::uint8_t {
+    Current,    ///< The table inserts go to
+    Old         ///< The table being drained by an incremental rehash
+};
+
+/**
+ * @brief What a hash map operation did to its slots
+ */
+enum class HashEventType : std::uint8_t {
+    Probe,          ///< Looked at slots a ... a + b - 1 (one slot, or a Swiss group)
+    Compare,        ///< Compared the key stored in slot a
+    Place,          ///< Stored an entry in slot a
+    Displace,       ///< Robin Hood: took slot a from an entry closer to home
+    Shift,          ///< Robin Hood erase: moved the entry in slot a back to slot b
+    Erase,          ///< Removed the entry in slot a
+    Migrate,        ///< Rehash moved old slot a to current slot b
+    RehashBegin,    ///< Current table became the old one; new capacity a
+    RehashEnd       ///< Old table drained and freed
+};
+
+/**
+ * @brief One hash map event (plain data, recorded into a RingBuffer)
+ */
+struct HashEvent {
+    HashEventType type = HashEventType::Probe;
+    HashTableId table = HashTableId::Current;
+    size_t a = 0;
+    size_t b = 0;
+};
+
+/**
+ * @brief Opt-in log of hash map events
+ *
+ * Recording is off by default. Lookups are const but log their probes
+ * too, so the log is mutable.
+ */
+class HashEventLog {
+public:
+    /// Default number of events kept by the log
+    static constexpr size_t DEFAULT_EVENT_CAPACITY = 4096;
+
+    /**
+     * @brief Enable event recording
+     *
+     * @param capacity Number of most recent events kept (older ones are overwritten)
+     */
+    void enableEventRecording(size_t capacity = DEFAULT_EVENT_CAPACITY) {
+        m_recordEvents = true;
+        if (m_events.capacity() < capacity) {
+            m_events.setCapacity(capacity);
+        }
+        m_events.clear();
+    }
+
+    /**
+     * @brief Disable event recording
+     */
+    void disableEventRecording() {
+        m_recordEvents = false;
+    }
+
+    /**
+     * @brief Check if events are being recorded
+     */
+    bool isRecordingEvents() const {
+        return m_recordEvents;
+    }
+
+    /**
+     * @brief Recorded events, oldest first
+     */
+    const RingBuffer<HashEvent>& events() const {
+        return m_events;
+    }
+
+    /**
+     * @brief Drop every recorded event
+     */
+    void clearEvents() {
+        m_events.clear();
+    }
+
+protected:
+    void recordEvent(HashEventType type, HashTableId table, size_t a = 0, size_t b = 0) const {
+        if (m_recordEvents) {
+            m_events.push({type, table, a, b});
+        }
+    }
+
+private:
+    mutable RingBuffer<HashEvent> m_events;
+    bool m_recordEvents = false;
+};
+
+/**
+ * @brief What one slot holds (for visualizers and checks)
+ */
+struct HashSlotInfo {
+    bool occupied = false;      ///< Holds an entry (possibly a stale one)
+    bool stale = false;         ///< Old table only: already migrated or erased, kept for probing
+    size_t home = 0;            ///< Slot the key hashes to (valid if occupied)
+    size_t distance = 0;        ///< Slots between home and here, in probe order
+    std::uint8_t control = 0;   ///< Swiss control byte (0x00 empty, 0x01 deleted, else 0x80 | 7 hash bits)
+};
+
+/**
+ * @brief Key and value stored in one slot
+ */
+template<typename K, typename V>
+struct HashEntry {
+    K key;      // No default member initializers: they would make int entries non-trivial
+    V value;
+};
+
+namespace hash_detail {
+
+/// Slots matched together by Swiss probing (one SSE2/NEON register of control bytes)
+inline constexpr size_t GROUP_WIDTH = 16;
+
+/// Swiss control bytes; full slots hold 0x80 | the low 7 bits of the hash
+inline constexpr std::uint8_t CTRL_EMPTY = 0x00;
+inline constexpr std::uint8_t CTRL_DELETED = 0x01;
+inline constexpr std::uint8_t CTRL_FULL = 0x80;
+
+/**
+ * @brief 64-bit finalizer (splitmix64) applied to every user hash
+ */
+inline std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+inline size_t lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(bits));
+#else
+    size_t n = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Set of slots within one group, iterated lowest first
+ *
+ * SSE2 and the scalar path produce one bit per slot; NEON has no movemask,
+ * so its mask keeps one bit per 4-bit nibble instead.
+ */
+class GroupMask {
+public:
+#if DSAV_HASH_NEON
+    static constexpr size_t SHIFT = 2;     ///< log2(bits per slot)
+#else
+    static constexpr size_t SHIFT = 0;
+#endif
+
+    explicit GroupMask(std::uint64_t bits) : m_bits(bits) {}
+
+    explicit operator bool() const { return m_bits != 0; }
+
+    /// Index within the group of the lowest slot in the set
+    size_t lowest() const { return lowestBit(m_bits) >> SHIFT; }
+
+    void clearLowest() { m_bits &= m_bits - 1; }
+
+private:
+    std::uint64_t m_bits;
+};
+
+/**
+ * @brief Slots of a group whose control byte equals byte
+ */
+inline GroupMask matchByte(const std::uint8_t* group, std::uint8_t byte) {
+#if DSAV_HASH_SSE2
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    __m128i hits = _mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(byte)));
+    return GroupMask(static_cast<std::uint32_t>(_mm_movemask_epi8(hits)));
+#elif DSAV_HASH_NEON
+    uint8x16_t hits = vceqq_u8(vld1q_u8(group), vdupq_n_u8(byte));
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(hits), 4);
+    return GroupMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL);
+#else
+    std::uint64_t bits = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        bits |= static_cast<std::uint64_t>(group[i] == byte) << i;
+    }
+    return GroupMask(bits);
+#endif
+}
+
+/**
+ * @brief Slots of a group that are empty or deleted (control byte high bit clear)
+ */
+inline GroupMask matchAvailable(const std::uint8_t* group) {
+#if DSAV_HASH_SSE2
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return GroupMask(static_cast<std::uint32_t>(~_mm_movemask_epi8(ctrl)) & 0xFFFFu);
+#elif DSAV_HASH_NEON
+    uint8x16_t clear = vcgezq_s8(vreinterpretq_s8_u8(vld1q_u8(group)));
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(clear), 4);
+    return GroupMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL);
+#else
+    std::uint64_t bits = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        bits |= static_cast<std::uint64_t>((group[i] >> 7) ^ 1) << i;
+    }
+    return GroupMask(bits);
+#endif
+}
+
+/**
+ * @brief Fixed-size table storage that skips initializing what it need not
+ *
+ * Rehashing touches the whole table a step at a time, but allocating and
+ * initializing the new table would still happen in one insert. So trivial
+ * types come straight from malloc: slot storage is left uninitialized (a
+ * slot is only read once its control byte says it is full), and control
+ * bytes come from calloc, which for large blocks hands out lazily zeroed
+ * OS pages. Other types are value-initialized with new[].
+ */
+template<typename T>
+class TableArray {
+public:
+    TableArray() = default;
+
+    /**
+     * @param count Number of elements
+     * @param zeroed Trivial types only: start all-zero (otherwise indeterminate)
+     */
+    TableArray(size_t count, bool zeroed) : m_size(count) {
+        if (count == 0) {
+            return;
+        }
+        if constexpr (TRIVIAL) {
+            m_data = static_cast<T*>(zeroed ? std::calloc(count, sizeof(T)) : std::malloc(count * sizeof(T)));
+            if (!m_data) {
+                throw std::bad_alloc();
+            }
+        } else {
+            m_data = new T[count]();
+        }
+    }
+
+    TableArray(TableArray&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    TableArray& operator=(TableArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    TableArray(const TableArray&) = delete;
+    TableArray& operator=(const TableArray&) = delete;
+
+    ~TableArray() {
+        release();
+    }
+
+    T& operator[](size_t i) { return m_data[i]; }
+    const T& operator[](size_t i) const { return m_data[i]; }
+    size_t size() const { return m_size; }
+
+private:
+    static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>;
+
+    void release() {
+        if constexpr (TRIVIAL) {
+            std::free(m_data);
+        } else {
+            delete[] m_data;
+        }
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    T* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+/// Control byte of a full Swiss slot
+inline std::uint8_t swissTag(std::uint64_t h) {
+    return static_cast<std::uint8_t>(CTRL_FULL | (h & 0x7F));
+}
+
+} // namespace hash_detail
+
+/**
+ * @brief Open-addressing hash map
+ *
+ * Template parameters:
+ * - K, V: Key and value types (default-constructible, movable)
+ * - Mode: Probing scheme (see HashProbing)
+ * - Hash, KeyEqual: As for std::unordered_map
+ *
+ * Counters: a hop is one slot visited (Robin Hood) or one group of control
+ * bytes loaded (Swiss); a comparison is one key equality test; a move is an
+ * entry written to a slot.
+ */
+template<typename K, typename V, HashProbing Mode = HashProbing::RobinHood,
+         typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class HashMap : public OpCounted, public HashEventLog {
+public:
+    /// Probing scheme of this map
+    static constexpr HashProbing MODE = Mode;
+
+    /// Smallest table (one Swiss group)
+    static constexpr size_t MIN_CAPACITY = hash_detail::GROUP_WIDTH;
+
+    /// Old slots migrated by each insert or erase during a rehash
+    static constexpr size_t DEFAULT_REHASH_STEP = 16;
+
+    /// Bounds of setMaxLoadFactor()
+    static constexpr float MIN_MAX_LOAD = 0.5f;
+    static constexpr float MAX_MAX_LOAD = 0.95f;
+    static constexpr float DEFAULT_MAX_LOAD = Mode == HashProbing::Swiss ? 0.875f : 0.8f;
+
+    /// Marker for "no slot"
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    /**
+     * @brief Construct an empty map
+     *
+     * @param capacity Initial slot count (rounded up to a power of two, at least MIN_CAPACITY)
+     */
+    explicit HashMap(size_t capacity = MIN_CAPACITY) {
+        allocate(m_current, roundCapacity(capacity));
+    }
+
+    /**
+     * @brief Insert a key, or assign its value if it is already present
+     *
+     * @return true if the key was new
+     */
+    bool insert(const K& key, const V& value) {
+        advanceRehash();
+
+        std::uint64_t h = hashOf(key);
+        size_t slot = findSlot(m_current, HashTableId::Current, key, h);
+        if (slot != NPOS) {
+            m_current.slots[slot].value = value;
+            countMoves();
+            return false;
+        }
+        if (isRehashing()) {
+            slot = findSlot(m_old, HashTableId::Old, key, h);
+            if (slot != NPOS) {
+                m_old.slots[slot].value = value;
+                countMoves();
+                return false;
+            }
+        }
+
+        makeRoomForOne();
+        insertNew(m_current, HashTableId::Current, HashEntry<K, V>{key, value}, h);
+        return true;
+    }
+
+    /**
+     * @brief Remove a key
+     *
+     * @return true if the key was present
+     */
+    bool remove(const K& key) {
+        advanceRehash();
+
+        std::uint64_t h = hashOf(key);
+        size_t slot = findSlot(m_current, HashTableId::Current, key, h);
+        if (slot != NPOS) {
+            eraseAt(m_current, HashTableId::Current, slot);
+            return true;
+        }
+        if (isRehashing()) {
+            slot = findSlot(m_old, HashTableId::Old, key, h);
+            if (slot != NPOS) {
+                eraseAt(m_old, HashTableId::Old, slot);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Look up a key
+     *
+     * @return Pointer to its value, or nullptr if absent (invalidated by the next insert or erase)
+     */
+    V* find(const K& key) {
+        return const_cast<V*>(static_cast<const HashMap*>(this)->find(key));
+    }
+
+    const V* find(const K& key) const {
+        std::uint64_t h = hashOf(key);
+        size_t slot = findSlot(m_current, HashTableId::Current, key, h);
+        if (slot != NPOS) {
+            return &m_current.slots[slot].value;
+        }
+        if (isRehashing()) {
+            slot = findSlot(m_old, HashTableId::Old, key, h);
+            if (slot != NPOS) {
+                return &m_old.slots[slot].value;
+            }
+        }
+        return nullptr;
+    }
+
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    size_t size() const {
+        return m_current.live + m_old.live;
+    }
+
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Remove every entry (keeps the current capacity)
+     */
+    void clear() {
+        size_t capacity = m_current.capacity();
+        m_old = Table{};
+        m_oldStale.clear();
+        m_rehashCursor = 0;
+        allocate(m_current, capacity);
+    }
+
+    /**
+     * @brief Grow now, all at once, so that count entries fit without rehashing
+     */
+    void reserve(size_t count) {
+        finishRehash();
+        size_t capacity = m_current.capacity();
+        while (count > maxUsed(capacity)) {
+            capacity *= 2;
+        }
+        if (capacity != m_current.capacity()) {
+            beginRehash(capacity);
+            finishRehash();
+        }
+    }
+
+    // ===== Load and rehash =====
+
+    /**
+     * @brief Slot count of the current table
+     */
+    size_t capacity() const {
+        return m_current.capacity();
+    }
+
+    /**
+     * @brief Entries per slot over both tables
+     */
+    float loadFactor() const {
+        return static_cast<float>(size()) / static_cast<float>(m_current.capacity() + m_old.capacity());
+    }
+
+    float maxLoadFactor() const {
+        return m_maxLoad;
+    }
+
+    /**
+     * @brief Set the load (counting Swiss tombstones) at which the table grows
+     *
+     * Clamped to [MIN_MAX_LOAD, MAX_MAX_LOAD]. Takes effect at the next insert.
+     */
+    void setMaxLoadFactor(float load) {
+        m_maxLoad = load < MIN_MAX_LOAD ? MIN_MAX_LOAD : (load > MAX_MAX_LOAD ? MAX_MAX_LOAD : load);
+    }
+
+    /**
+     * @brief Check whether an incremental rehash is in progress
+     */
+    bool isRehashing() const {
+        return m_old.capacity() != 0;
+    }
+
+    /**
+     * @brief Old slots already migrated (0 if not rehashing)
+     */
+    size_t rehashCursor() const {
+        return m_rehashCursor;
+    }
+
+    size_t rehashStep() const {
+        return m_rehashStep;
+    }
+
+    /**
+     * @brief Set how many old slots each insert or erase migrates
+     *
+     * Smaller steps spread the rehash thinner. The step actually used is
+     * raised if needed so the old table drains before the new one fills;
+     * it applies from the next rehash.
+     */
+    void setRehashStep(size_t slots) {
+        m_rehashStep = slots ? slots : 1;
+    }
+
+    /**
+     * @brief Migrate everything left in the old table now
+     */
+    void finishRehash() {
+        while (isRehashing()) {
+            migrateSlots(m_old.capacity());
+        }
+    }
+
+    // ===== Slot inspection =====
+
+    /**
+     * @brief Slot count of a table (0 for the old table when not rehashing)
+     */
+    size_t tableCapacity(HashTableId table) const {
+        return tableOf(table).capacity();
+    }
+
+    /**
+     * @brief Describe one slot of a table
+     */
+    HashSlotInfo slotInfo(HashTableId table, size_t slot) const {
+        const Table& t = tableOf(table);
+        HashSlotInfo info;
+        if constexpr (Mode == HashProbing::Swiss) {
+            info.control = t.meta[slot];
+            info.occupied = t.meta[slot] >= hash_detail::CTRL_FULL;
+            info.stale = table == HashTableId::Old && t.meta[slot] == hash_detail::CTRL_DELETED;
+            info.occupied = info.occupied || info.stale;
+        } else {
+            info.occupied = t.meta[slot] != 0;
+            info.stale = table == HashTableId::Old && info.occupied && m_oldStale[slot];
+        }
+        if (info.occupied && !info.stale) {
+            info.home = homeSlot(t, hashOf(t.slots[slot].key));
+            info.distance = probeDistance(t, info.home, slot);
+        } else if (info.occupied) {
+            // Stale entries have given up their key; Robin Hood still knows how far they sat
+            size_t distance = Mode == HashProbing::RobinHood ? static_cast<size_t>(t.meta[slot] - 1) : 0;
+            info.home = (slot - distance) & t.mask();
+            info.distance = distance;
+        }
+        return info;
+    }
+
+    /**
+     * @brief Entry stored in a slot (meaningful only if slotInfo() says occupied)
+     */
+    const HashEntry<K, V>& slotEntry(HashTableId table, size_t slot) const {
+        return tableOf(table).slots[slot];
+    }
+
+    /**
+     * @brief Slot a key hashes to in a table (Swiss: first slot of its home group)
+     */
+    size_t homeSlotOf(HashTableId table, const K& key) const {
+        return homeSlot(tableOf(table), hashOf(key));
+    }
+
+    /**
+     * @brief Call f(key, value) for every entry, in slot order
+     */
+    template<typename F>
+    void forEach(F&& f) const {
+        for (HashTableId id : {HashTableId::Old, HashTableId::Current}) {
+            const Table& t = tableOf(id);
+            for (size_t i = 0; i < t.capacity(); ++i) {
+                if (isLive(t, id, i)) {
+                    f(t.slots[i].key, t.slots[i].value);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Check the probing invariants and entry counts
+     *
+     * Every live entry must be found from its home slot, the counts must
+     * match, and Robin Hood distances must be exact below saturation.
+     */
+    bool isValid() const {
+        for (HashTableId id : {HashTableId::Current, HashTableId::Old}) {
+            const Table& t = tableOf(id);
+            size_t live = 0;
+            for (size_t i = 0; i < t.capacity(); ++i) {
+                if (!isLive(t, id, i)) {
+                    continue;
+                }
+                live++;
+                std::uint64_t h = hashOf(t.slots[i].key);
+                if constexpr (Mode == HashProbing::RobinHood) {
+                    size_t distance = probeDistance(t, homeSlot(t, h), i);
+                    if (t.meta[i] != encodeDistance(distance)) {
+                        return false;
+                    }
+                } else {
+                    if (t.meta[i] != hash_detail::swissTag(h)) {
+                        return false;
+                    }
+                }
+                if (findSlot(t, id, t.slots[i].key, h) != i) {
+                    return false;
+                }
+            }
+            if (live != t.live) {
+                return false;
+            }
+        }
+        return m_current.live + m_current.tombstones <= m_current.capacity();
+    }
+
+private:
+    struct Table {
+        hash_detail::TableArray<std::uint8_t> meta;     ///< Robin Hood distance + 1 (0 empty), or Swiss control byte
+        hash_detail::TableArray<HashEntry<K, V>> slots;
+        size_t live = 0;                        ///< Entries findable in this table
+        size_t tombstones = 0;                  ///< Swiss deleted bytes / stale old entries
+
+        size_t capacity() const { return meta.size(); }
+        size_t mask() const { return meta.size() - 1; }
+    };
+
+    /// Robin Hood distances at or above this are stored saturated and recomputed from the hash
+    static constexpr size_t SATURATED_DISTANCE = 254;
+
+    static size_t roundCapacity(size_t capacity) {
+        size_t rounded = MIN_CAPACITY;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+
+    static std::uint8_t encodeDistance(size_t distance) {
+        return static_cast<std::uint8_t>((distance < SATURATED_DISTANCE ? distance : SATURATED_DISTANCE) + 1);
+    }
+
+    void allocate(Table& t, size_t capacity) {
+        // Zero is empty in both modes, so the control bytes need no initializing pass
+        t.meta = hash_detail::TableArray<std::uint8_t>(capacity, true);
+        t.slots = hash_detail::TableArray<HashEntry<K, V>>(capacity, false);
+        t.live = 0;
+        t.tombstones = 0;
+        countAllocations();
+    }
+
+    const Table& tableOf(HashTableId id) const {
+        return id == HashTableId::Old ? m_old : m_current;
+    }
+
+    std::uint64_t hashOf(const K& key) const {
+        return hash_detail::mix(static_cast<std::uint64_t>(m_hash(key)));
+    }
+
+    static size_t homeSlot(const Table& t, std::uint64_t h) {
+        if constexpr (Mode == HashProbing::Swiss) {
+            size_t groups = t.capacity() / hash_detail::GROUP_WIDTH;
+            return static_cast<size_t>((h >> 7) & (groups - 1)) * hash_detail::GROUP_WIDTH;
+        } else {
+            return static_cast<size_t>(h >> 7) & t.mask();
+        }
+    }
+
+    /**
+     * @brief Distance from home to slot in probe order
+     *
+     * Robin Hood: slots. Swiss: groups (triangular probing), times the group width.
+     */
+    static size_t probeDistance(const Table& t, size_t home, size_t slot) {
+        if constexpr (Mode == HashProbing::Swiss) {
+            size_t groups = t.capacity() / hash_detail::GROUP_WIDTH;
+            size_t group = home / hash_detail::GROUP_WIDTH;
+            size_t target = slot / hash_detail::GROUP_WIDTH;
+            for (size_t i = 0; i < groups; ++i) {
+                if (group == target) {
+                    return i * hash_detail::GROUP_WIDTH;
+                }
+                group = (group + i + 1) & (groups - 1);
+            }
+            return 0;
+        } else {
+            return (slot - home) & t.mask();
+        }
+    }
+
+    size_t maxUsed(size_t capacity) const {
+        size_t limit = static_cast<size_t>(static_cast<float>(capacity) * m_maxLoad);
+        return limit < capacity ? limit : capacity - 1;
+    }
+
+    bool isLive(const Table& t, HashTableId id, size_t slot) const {
+        if constexpr (Mode == HashProbing::Swiss) {
+            return t.meta[slot] >= hash_detail::CTRL_FULL;
+        } else {
+            return t.meta[slot] != 0 && !(id == HashTableId::Old && m_oldStale[slot]);
+        }
+    }
+
+    // ===== Lookup =====
+
+    size_t findSlot(const Table& t, HashTableId id, const K& key, std::uint64_t h) const {
+        if (t.capacity() == 0) {
+            return NPOS;
+        }
+
+        if constexpr (Mode == HashProbing::Swiss) {
+            size_t groups = t.capacity() / hash_detail::GROUP_WIDTH;
+            size_t group = homeSlot(t, h) / hash_detail::GROUP_WIDTH;
+            std::uint8_t tag = hash_detail::swissTag(h);
+            for (size_t i = 0; i < groups; ++i) {
+                size_t base = group * hash_detail::GROUP_WIDTH;
+                const std::uint8_t* ctrl = &t.meta[base];
+                countHops();
+                recordEvent(HashEventType::Probe, id, base, hash_detail::GROUP_WIDTH);
+                for (hash_detail::GroupMask hits = hash_detail::matchByte(ctrl, tag); hits; hits.clearLowest()) {
+                    size_t slot = base + hits.lowest();
+                    countComparisons();
+                    recordEvent(HashEventType::Compare, id, slot);
+                    if (m_equal(t.slots[slot].key, key)) {
+                        return slot;
+                    }
+                }
+                // A group with an empty slot ends every probe sequence through it
+                if (hash_detail::matchByte(ctrl, hash_detail::CTRL_EMPTY)) {
+                    return NPOS;
+                }
+                group = (group + i + 1) & (groups - 1);
+            }
+            return NPOS;
+        } else {
+            size_t mask = t.mask();
+            size_t slot = homeSlot(t, h);
+            for (size_t distance = 0; distance < t.capacity(); ++distance) {
+                std::uint8_t meta = t.meta[slot];
+                countHops();
+                recordEvent(HashEventType::Probe, id, slot, 1);
+                if (meta == 0) {
+                    return NPOS;
+                }
+                // An entry closer to its home than we are to ours: the key would have taken its slot
+                if (meta != encodeDistance(SATURATED_DISTANCE) && static_cast<size_t>(meta - 1) < distance) {
+                    return NPOS;
+                }
+                if (!(id == HashTableId::Old && m_oldStale[slot])) {
+                    countComparisons();
+                    recordEvent(HashEventType::Compare, id, slot);
+                    if (m_equal(t.slots[slot].key, key)) {
+                        return slot;
+                    }
+                }
+                slot = (slot + 1) & mask;
+            }
+            return NPOS;
+        }
+    }
+
+    // ===== Insertion =====
+
+    /**
+     * @brief Store an entry known to be absent from both tables
+     *
+     * The table must have room for one more entry.
+     *
+     * @return Slot the entry ended up in
+     */
+    size_t insertNew(Table& t, HashTableId id, HashEntry<K, V>&& entry, std::uint64_t h) {
+        if constexpr (Mode == HashProbing::Swiss) {
+            size_t groups = t.capacity() / hash_detail::GROUP_WIDTH;
+            size_t group = homeSlot(t, h) / hash_detail::GROUP_WIDTH;
+            for (size_t i = 0;; ++i) {
+                size_t base = group * hash_detail::GROUP_WIDTH;
+                countHops();
+                recordEvent(HashEventType::Probe, id, base, hash_detail::GROUP_WIDTH);
+                hash_detail::GroupMask free = hash_detail::matchAvailable(&t.meta[base]);
+                if (free) {
+                    size_t slot = base + free.lowest();
+                    if (t.meta[slot] == hash_detail::CTRL_DELETED) {
+                        t.tombstones--;
+                    }
+                    t.meta[slot] = hash_detail::swissTag(h);
+                    t.slots[slot] = std::move(entry);
+                    t.live++;
+                    countMoves();
+                    recordEvent(HashEventType::Place, id, slot);
+                    return slot;
+                }
+                group = (group + i + 1) & (groups - 1);
+            }
+        } else {
+            size_t mask = t.mask();
+            size_t slot = homeSlot(t, h);
+            size_t distance = 0;
+            size_t placed = NPOS;
+            for (;;) {
+                std::uint8_t meta = t.meta[slot];
+                countHops();
+                recordEvent(HashEventType::Probe, id, slot, 1);
+                if (meta == 0) {
+                    t.meta[slot] = encodeDistance(distance);
+                    t.slots[slot] = std::move(entry);
+                    t.live++;
+                    countMoves();
+                    recordEvent(HashEventType::Place, id, slot);
+                    return placed == NPOS ? slot : placed;
+                }
+
+                size_t resident = meta - 1;
+                if (meta == encodeDistance(SATURATED_DISTANCE)) {
+                    resident = probeDistance(t, homeSlot(t, hashOf(t.slots[slot].key)), slot);
+                }
+                if (resident < distance) {
+                    // Take the slot and carry the displaced entry on
+                    t.meta[slot] = encodeDistance(distance);
+                    std::swap(entry, t.slots[slot]);
+                    countMoves();
+                    recordEvent(HashEventType::Displace, id, slot);
+                    if (placed == NPOS) {
+                        placed = slot;
+                    }
+                    distance = resident;
+                }
+                slot = (slot + 1) & mask;
+                distance++;
+            }
+        }
+    }
+
+    /**
+     * @brief Start a rehash (if needed) so the current table can take one more entry
+     */
+    void makeRoomForOne() {
+        if (m_current.live + m_current.tombstones + 1 <= maxUsed(m_current.capacity())) {
+            return;
+        }
+        // Cannot happen with the step chosen in beginRehash(), but never overfill the new table
+        finishRehash();
+        if (m_current.live + m_current.tombstones + 1 <= maxUsed(m_current.capacity())) {
+            return;
+        }
+
+        // Mostly tombstones: rebuild at the same size instead of doubling
+        size_t capacity = m_current.capacity();
+        if (m_current.live + 1 > maxUsed(capacity) / 2) {
+            capacity *= 2;
+        }
+        beginRehash(capacity);
+    }
+
+    void beginRehash(size_t capacity) {
+        m_old = std::move(m_current);
+        m_current = Table{};
+        allocate(m_current, capacity);
+        if constexpr (Mode == HashProbing::RobinHood) {
+            m_oldStale.assign(m_old.capacity(), false);
+        }
+        m_rehashCursor = 0;
+
+        // Each insert or erase adds at most one entry or tombstone to the new table, so
+        // draining oldCapacity slots must take fewer operations than the new table has room for
+        size_t room = maxUsed(capacity) > m_old.live + 1 ? maxUsed(capacity) - m_old.live - 1 : 1;
+        size_t needed = (m_old.capacity() + room - 1) / room;
+        m_activeStep = m_rehashStep > needed ? m_rehashStep : needed;
+
+        recordEvent(HashEventType::RehashBegin, HashTableId::Current, capacity);
+        if (m_old.live == 0) {
+            endRehash();
+        }
+    }
+
+    void endRehash() {
+        m_old = Table{};
+        m_oldStale.clear();
+        m_oldStale.shrink_to_fit();
+        m_rehashCursor = 0;
+        recordEvent(HashEventType::RehashEnd, HashTableId::Old);
+    }
+
+    /**
+     * @brief Migrate the next rehash step of old slots (no-op when not rehashing)
+     */
+    void advanceRehash() {
+        if (isRehashing()) {
+            migrateSlots(m_activeStep);
+        }
+    }
+
+    void migrateSlots(size_t count) {
+        size_t end = count < m_old.capacity() - m_rehashCursor ? m_rehashCursor + count : m_old.capacity();
+        for (; m_rehashCursor < end; ++m_rehashCursor) {
+            size_t slot = m_rehashCursor;
+            if (!isLive(m_old, HashTableId::Old, slot)) {
+                continue;
+            }
+            std::uint64_t h = hashOf(m_old.slots[slot].key);
+            size_t target = insertNew(m_current, HashTableId::Current, std::move(m_old.slots[slot]), h);
+            markStale(slot);
+            recordEvent(HashEventType::Migrate, HashTableId::Old, slot, target);
+        }
+        if (m_rehashCursor >= m_old.capacity() || m_old.live == 0) {
+            endRehash();
+        }
+    }
+
+    // ===== Erase =====
+
+    /**
+     * @brief Old table: keep the slot occupied for probing but stop finding it
+     */
+    void markStale(size_t slot) {
+        if constexpr (Mode == HashProbing::Swiss) {
+            m_old.meta[slot] = hash_detail::CTRL_DELETED;
+        } else {
+            m_oldStale[slot] = true;
+        }
+        m_old.slots[slot] = HashEntry<K, V>{};
+        m_old.live--;
+        m_old.tombstones++;
+    }
+
+    void eraseAt(Table& t, HashTableId id, size_t slot) {
+        recordEvent(HashEventType::Erase, id, slot);
+        if (id == HashTableId::Old) {
+            markStale(slot);
+            return;
+        }
+
+        if constexpr (Mode == HashProbing::Swiss) {
+            // A group that still has an empty slot never made a probe continue past it
+            size_t base = slot - slot % hash_detail::GROUP_WIDTH;
+            if (hash_detail::matchByte(&t.meta[base], hash_detail::CTRL_EMPTY)) {
+                t.meta[slot] = hash_detail::CTRL_EMPTY;
+            } else {
+                t.meta[slot] = hash_detail::CTRL_DELETED;
+                t.tombstones++;
+            }
+            t.slots[slot] = HashEntry<K, V>{};
+            t.live--;
+        } else {
+            // Backward shift: pull the following displaced entries one slot closer to home
+            size_t mask = t.mask();
+            for (;;) {
+                size_t next = (slot + 1) & mask;
+                std::uint8_t meta = t.meta[next];
+                countHops();
+                if (meta <= 1) {
+                    break;
+                }
+                size_t distance = meta - 1;
+                if (meta == encodeDistance(SATURATED_DISTANCE)) {
+                    distance = probeDistance(t, homeSlot(t, hashOf(t.slots[next].key)), next);
+                }
+                t.meta[slot] = encodeDistance(distance - 1);
+                t.slots[slot] = std::move(t.slots[next]);
+                countMoves();
+                recordEvent(HashEventType::Shift, id, next, slot);
+                slot = next;
+            }
+            t.meta[slot] = 0;
+            t.slots[slot] = HashEntry<K, V>{};
+            t.live--;
+        }
+    }
+
+    Table m_current;                    ///< Receives inserts
+    Table m_old;                        ///< Being drained (empty when not rehashing)
+    std::vector<bool> m_oldStale;       ///< Robin Hood: old slots already migrated or erased
+    size_t m_rehashCursor = 0;          ///< Next old slot to migrate
+    size_t m_rehashStep = DEFAULT_REHASH_STEP;
+    size_t m_activeStep = DEFAULT_REHASH_STEP;  ///< Step of the running rehash (at least m_rehashStep)
+    float m_maxLoad = DEFAULT_MAX_LOAD;
+    Hash m_hash;
+    KeyEqual m_equal;
+};
+
+} // namespace dsav
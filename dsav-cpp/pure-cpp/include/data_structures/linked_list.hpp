@@ -3,31 +3,49 @@
  * @brief Singly linked list data structure implementation
  *
  * A template-based singly linked list with visualization-friendly interface.
- * Each node contains data and a pointer to the next node.
+ * Each node contains data and a pointer to the next node. The list keeps a
+ * tail pointer next to the head, so appending is O(1); removing the last
+ * node still walks to its predecessor (see DoublyLinkedList for O(1)).
  */
 
 #pragma once
 
-#include <memory>
+#include "node_pool.hpp"
+#include "op_counters.hpp"
 #include <optional>
 #include <stdexcept>
 #include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace dsav {
 
 /**
  * @brief Node structure for singly linked list
  *
+ * The next link is a pool index (NULL_NODE at the end of the list).
+ *
  * @tparam T Type of data stored in the node
  */
 template<typename T>
 struct ListNode {
     T data;
-    std::shared_ptr<ListNode<T>> next;
+    NodeIndex next;
+
+    explicit ListNode(const T& value) : data(value), next(NULL_NODE) {}
+    explicit ListNode(T&& value) : data(std::move(value)), next(NULL_NODE) {}
 
-    explicit ListNode(const T& value) : data(value), next(nullptr) {}
+    /// Construct the data in place from T's constructor arguments
+    template<typename... Args>
+    explicit ListNode(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(NULL_NODE) {}
 };
 
+/// Handle to a list node as exposed to visualizers
+template<typename T>
+using ListNodeHandle = NodeHandle<ListNode<T>>;
+
 /**
  * @brief Singly linked list data structure
  *
@@ -35,9 +53,13 @@ struct ListNode {
  * - T: Type of elements stored in the list
  *
  * Provides operations for inserting, deleting, and searching nodes.
+ * Nodes are stored in a NodePool, so no per-node heap allocation is performed.
+ *
+ * Complexity: insertFront, insertBack, deleteFront, size O(1);
+ * deleteBack, insertAt, deleteAt, find O(n).
  */
 template<typename T>
-class LinkedList {
+class LinkedList : public OpCounted {
 public:
     /**
      * @brief Construct an empty linked list
@@ -50,9 +72,29 @@ public:
      * @param value Value to insert
      */
     void insertFront(const T& value) {
-        auto newNode = std::make_shared<ListNode<T>>(value);
-        newNode->next = m_head;
+        emplaceFront(value);
+    }
+
+    /**
+     * @brief Move a value in at the front of the list
+     */
+    void insertFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at the front of the list
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplaceFront(Args&&... args) {
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
+        m_pool[newNode].next = m_head;
         m_head = newNode;
+        if (m_tail == NULL_NODE) {
+            m_tail = newNode;
+        }
         m_size++;
     }
 
@@ -62,17 +104,33 @@ public:
      * @param value Value to insert
      */
     void insertBack(const T& value) {
-        auto newNode = std::make_shared<ListNode<T>>(value);
+        emplaceBack(value);
+    }
+
+    /**
+     * @brief Move a value in at the back of the list
+     */
+    void insertBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at the back of the list
+     *
+     * O(1): the new node is linked after the tail, no walk is needed.
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplaceBack(Args&&... args) {
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
 
-        if (!m_head) {
+        if (m_tail == NULL_NODE) {
             m_head = newNode;
         } else {
-            auto current = m_head;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = newNode;
+            m_pool[m_tail].next = newNode;
         }
+        m_tail = newNode;
         m_size++;
     }
 
@@ -84,40 +142,67 @@ public:
      * @return true if successful, false if index out of range
      */
     bool insertAt(size_t index, const T& value) {
+        return emplaceAt(index, value);
+    }
+
+    /**
+     * @brief Move a value in at a specific position
+     *
+     * @return true if successful, false if index out of range
+     */
+    bool insertAt(size_t index, T&& value) {
+        return emplaceAt(index, std::move(value));
+    }
+
+    /**
+     * @brief Construct a value in place at a specific position
+     *
+     * @param index Position to insert at (0-based)
+     * @param args Constructor arguments of T
+     * @return true if successful, false if index out of range
+     */
+    template<typename... Args>
+    bool emplaceAt(size_t index, Args&&... args) {
         if (index > m_size) {
             return false;
         }
 
         if (index == 0) {
-            insertFront(value);
+            emplaceFront(std::forward<Args>(args)...);
             return true;
         }
-
-        auto newNode = std::make_shared<ListNode<T>>(value);
-        auto current = m_head;
-
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
+        if (index == m_size) {
+            emplaceBack(std::forward<Args>(args)...);
+            return true;
         }
 
-        newNode->next = current->next;
-        current->next = newNode;
+        NodeIndex newNode = allocateNode(std::forward<Args>(args)...);
+        NodeIndex current = nodeAt(index - 1);
+
+        m_pool[newNode].next = m_pool[current].next;
+        m_pool[current].next = newNode;
         m_size++;
         return true;
     }
 
     /**
-     * @brief Delete the first node
+     * @brief Delete the first node (its value is moved out)
      *
      * @return The deleted value if successful, std::nullopt if list is empty
      */
     std::optional<T> deleteFront() {
-        if (!m_head) {
+        if (m_head == NULL_NODE) {
             return std::nullopt;
         }
 
-        T value = m_head->data;
-        m_head = m_head->next;
+        NodeIndex removed = m_head;
+        T value = std::move(m_pool[removed].data);
+        countMoves();
+        m_head = m_pool[removed].next;
+        if (m_head == NULL_NODE) {
+            m_tail = NULL_NODE;
+        }
+        m_pool.release(removed);
         m_size--;
         return value;
     }
@@ -125,27 +210,33 @@ public:
     /**
      * @brief Delete the last node
      *
+     * O(n): a singly linked node cannot reach its predecessor, so this walks
+     * from the head to the node before the tail.
+     *
      * @return The deleted value if successful, std::nullopt if list is empty
      */
     std::optional<T> deleteBack() {
-        if (!m_head) {
+        if (m_head == NULL_NODE) {
             return std::nullopt;
         }
 
-        if (!m_head->next) {
-            T value = m_head->data;
-            m_head = nullptr;
-            m_size--;
-            return value;
+        if (m_pool[m_head].next == NULL_NODE) {
+            return deleteFront();
         }
 
-        auto current = m_head;
-        while (current->next && current->next->next) {
-            current = current->next;
+        NodeIndex current = m_head;
+        countHops();
+        while (m_pool[m_pool[current].next].next != NULL_NODE) {
+            current = m_pool[current].next;
+            countHops();
         }
 
-        T value = current->next->data;
-        current->next = nullptr;
+        NodeIndex removed = m_pool[current].next;
+        T value = std::move(m_pool[removed].data);
+        countMoves();
+        m_pool[current].next = NULL_NODE;
+        m_tail = current;
+        m_pool.release(removed);
         m_size--;
         return value;
     }
@@ -157,7 +248,7 @@ public:
      * @return The deleted value if successful, std::nullopt if index out of range
      */
     std::optional<T> deleteAt(size_t index) {
-        if (index >= m_size || !m_head) {
+        if (index >= m_size || m_head == NULL_NODE) {
             return std::nullopt;
         }
 
@@ -165,17 +256,21 @@ public:
             return deleteFront();
         }
 
-        auto current = m_head;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
+        NodeIndex current = nodeAt(index - 1);
+        NodeIndex removed = m_pool[current].next;
+        countHops();
 
-        if (!current->next) {
+        if (removed == NULL_NODE) {
             return std::nullopt;
         }
 
-        T value = current->next->data;
-        current->next = current->next->next;
+        T value = std::move(m_pool[removed].data);
+        countMoves();
+        m_pool[current].next = m_pool[removed].next;
+        if (removed == m_tail) {
+            m_tail = current;
+        }
+        m_pool.release(removed);
         m_size--;
         return value;
     }
@@ -187,14 +282,16 @@ public:
      * @return Index of first occurrence, or std::nullopt if not found
      */
     std::optional<size_t> find(const T& value) const {
-        auto current = m_head;
+        NodeIndex current = m_head;
         size_t index = 0;
 
-        while (current) {
-            if (current->data == value) {
+        while (current != NULL_NODE) {
+            countComparisons();
+            if (m_pool[current].data == value) {
                 return index;
             }
-            current = current->next;
+            current = m_pool[current].next;
+            countHops();
             index++;
         }
 
@@ -207,7 +304,7 @@ public:
      * @return true if empty
      */
     bool isEmpty() const {
-        return m_head == nullptr;
+        return m_head == NULL_NODE;
     }
 
     /**
@@ -223,17 +320,90 @@ public:
      * @brief Clear all nodes
      */
     void clear() {
-        m_head = nullptr;
+        m_pool.clear();
+        m_head = NULL_NODE;
+        m_tail = NULL_NODE;
         m_size = 0;
     }
 
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of nodes
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count);
+    }
+
     /**
      * @brief Get head node (for visualization)
      *
-     * @return Shared pointer to head node
+     * @return Handle to head node (empty if list is empty)
+     */
+    ListNodeHandle<T> head() const {
+        return ListNodeHandle<T>(&m_pool, m_head);
+    }
+
+    /**
+     * @brief Get tail node (for visualization)
+     *
+     * @return Handle to the last node (empty if list is empty)
      */
-    std::shared_ptr<ListNode<T>> head() const {
-        return m_head;
+    ListNodeHandle<T> tail() const {
+        return ListNodeHandle<T>(&m_pool, m_tail);
+    }
+
+    // ===== Bulk operations =====
+
+    /**
+     * @brief Append a range of values in order
+     *
+     * O(k) for k values: storage is reserved once (for forward ranges) and
+     * every value is linked after the tail.
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            m_pool.reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplaceBack(*first);
+        }
+    }
+
+    /**
+     * @brief Move every node of another list to the back of this one
+     *
+     * Each list owns its node pool, so the values are moved across one by
+     * one (O(k) for k nodes of other) but this list is never walked. When
+     * this list is empty the pools are swapped instead, in O(1). other is
+     * left empty.
+     *
+     * @param other List to take the nodes from
+     */
+    void splice(LinkedList& other) {
+        if (&other == this || other.m_head == NULL_NODE) {
+            return;
+        }
+
+        if (m_head == NULL_NODE) {
+            std::swap(m_pool, other.m_pool);
+            std::swap(m_head, other.m_head);
+            std::swap(m_tail, other.m_tail);
+            std::swap(m_size, other.m_size);
+            other.clear();
+            return;
+        }
+
+        m_pool.reserve(m_size + other.m_size);
+        for (NodeIndex current = other.m_head; current != NULL_NODE; current = other.m_pool[current].next) {
+            emplaceBack(std::move(other.m_pool[current].data));
+        }
+        other.clear();
     }
 
     /**
@@ -242,16 +412,40 @@ public:
      * @param func Function to apply to each node's data
      */
     void traverse(std::function<void(const T&)> func) const {
-        auto current = m_head;
-        while (current) {
-            func(current->data);
-            current = current->next;
+        NodeIndex current = m_head;
+        while (current != NULL_NODE) {
+            func(m_pool[current].data);
+            current = m_pool[current].next;
         }
     }
 
 private:
-    std::shared_ptr<ListNode<T>> m_head = nullptr;  ///< Head of the list
-    size_t m_size = 0;                              ///< Number of nodes
+    /**
+     * @brief Walk to the node at a position (caller guarantees it exists)
+     */
+    NodeIndex nodeAt(size_t index) const {
+        NodeIndex current = m_head;
+        for (size_t i = 0; i < index; ++i) {
+            current = m_pool[current].next;
+        }
+        countHops(index);
+        return current;
+    }
+
+    /**
+     * @brief Take a node from the pool and construct its value from args
+     */
+    template<typename... Args>
+    NodeIndex allocateNode(Args&&... args) {
+        countAllocations();
+        countMoves();
+        return m_pool.allocate(std::in_place, std::forward<Args>(args)...);
+    }
+
+    NodePool<ListNode<T>> m_pool;     ///< Node storage
+    NodeIndex m_head = NULL_NODE;     ///< Head of the list
+    NodeIndex m_tail = NULL_NODE;     ///< Last node (NULL_NODE when empty)
+    size_t m_size = 0;                ///< Number of nodes
 };
 
 } // namespace dsav
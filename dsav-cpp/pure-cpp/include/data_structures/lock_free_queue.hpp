@@ -0,0 +1,170 @@
+/**
+ * @file lock_free_queue.hpp
+ * @brief Michael-Scott queue: a lock-free FIFO for any number of threads
+ *
+ * A singly linked list that always starts with a dummy node. Enqueue links
+ * a node after the last one with a CAS on its next pointer and then swings
+ * the tail; dequeue swings the head to the dummy's successor, which becomes
+ * the new dummy. A thread that finds the tail lagging behind swings it
+ * forward itself before retrying, so a stalled enqueuer never blocks the
+ * others. Old dummies are retired through an EpochDomain.
+ *
+ * Probe sites: HEAD_SITE (dequeue CAS), TAIL_SITE (tail swings, including
+ * helping) and LINK_SITE (the CAS that links a new node).
+ */
+
+#pragma once
+
+#include "contention_probe.hpp"
+#include "epoch_reclamation.hpp"
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Unbounded multi-producer/multi-consumer queue
+ *
+ * @tparam T Element type (must be movable)
+ */
+template<typename T>
+class LockFreeQueue {
+public:
+    static constexpr size_t HEAD_SITE = 0;
+    static constexpr size_t TAIL_SITE = 1;
+    static constexpr size_t LINK_SITE = 2;
+    static constexpr size_t SITE_COUNT = 3;
+
+    LockFreeQueue() {
+        Node* dummy = new Node();
+        m_head.store(dummy, std::memory_order_relaxed);
+        m_tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Delete the remaining nodes (no thread may be using the queue)
+     */
+    ~LockFreeQueue() {
+        Node* node = m_head.load(std::memory_order_relaxed);
+        while (node != nullptr) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    /**
+     * @brief Report CAS attempts to a probe (set before threads start; nullptr = off)
+     */
+    void setProbe(ContentionProbe* probe) { m_probe = probe; }
+
+    /**
+     * @brief Append an element (lock-free)
+     */
+    void enqueue(T value) {
+        Node* node = new Node();
+        node->value.emplace(std::move(value));
+
+        EpochDomain::Guard guard(m_epochs);
+        for (;;) {
+            Node* tail = m_tail.load(std::memory_order_acquire);
+            Node* next = tail->next.load(std::memory_order_acquire);
+            if (tail != m_tail.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (next == nullptr) {
+                bool linked = tail->next.compare_exchange_weak(next, node,
+                                                               std::memory_order_release,
+                                                               std::memory_order_relaxed);
+                record(LINK_SITE, ContentionOp::Push, linked);
+                if (linked) {
+                    // Failing here is fine: someone else already swung the tail past us
+                    bool swung = m_tail.compare_exchange_strong(tail, node,
+                                                                std::memory_order_release,
+                                                                std::memory_order_relaxed);
+                    record(TAIL_SITE, ContentionOp::Push, swung);
+                    break;
+                }
+            } else {
+                // Tail is lagging: help the other enqueuer finish
+                bool swung = m_tail.compare_exchange_weak(tail, next,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed);
+                record(TAIL_SITE, ContentionOp::Push, swung);
+            }
+        }
+        if (m_probe) m_probe->recordOp(ContentionOp::Push);
+    }
+
+    /**
+     * @brief Remove the oldest element (lock-free)
+     *
+     * @return The element, or std::nullopt if the queue was empty
+     */
+    std::optional<T> dequeue() {
+        EpochDomain::Guard guard(m_epochs);
+        for (;;) {
+            Node* head = m_head.load(std::memory_order_acquire);
+            Node* tail = m_tail.load(std::memory_order_acquire);
+            Node* next = head->next.load(std::memory_order_acquire);
+            if (head != m_head.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (head == tail) {
+                if (next == nullptr) {
+                    return std::nullopt;
+                }
+                bool swung = m_tail.compare_exchange_weak(tail, next,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed);
+                record(TAIL_SITE, ContentionOp::Pop, swung);
+                continue;
+            }
+
+            bool swapped = m_head.compare_exchange_weak(head, next,
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_relaxed);
+            record(HEAD_SITE, ContentionOp::Pop, swapped);
+            if (swapped) {
+                // next is the new dummy; only the CAS winner touches its value
+                std::optional<T> value(std::move(next->value));
+                next->value.reset();
+                m_epochs.retire(head);
+                if (m_probe) m_probe->recordOp(ContentionOp::Pop);
+                return value;
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether the queue was empty at the time of the call
+     */
+    bool isEmpty() const {
+        EpochDomain::Guard guard(m_epochs);
+        return m_head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;            ///< Empty in the dummy
+    };
+
+    void record(size_t site, ContentionOp op, bool success) {
+        if (m_probe) m_probe->recordCas(site, op, success);
+    }
+
+    alignas(64) std::atomic<Node*> m_head{nullptr};   ///< Dummy node
+    alignas(64) std::atomic<Node*> m_tail{nullptr};   ///< Last node, or one behind it
+    ContentionProbe* m_probe = nullptr;
+    mutable EpochDomain m_epochs;
+};
+
+} // namespace dsav
@@ -0,0 +1,118 @@
+/**
+ * @file lock_free_stack.hpp
+ * @brief Treiber stack: a lock-free LIFO for any number of threads
+ *
+ * The stack is a singly linked list whose top pointer is swung with a
+ * compare-and-swap; a thread that loses the race reloads the top and tries
+ * again, so some thread always makes progress. Popped nodes are retired
+ * through an EpochDomain rather than deleted, which rules out both
+ * use-after-free and the ABA problem: a node's address cannot come back
+ * while any thread that might have read it is still pinned.
+ *
+ * Every CAS on the top is reported to an optional ContentionProbe as site
+ * TOP_SITE.
+ */
+
+#pragma once
+
+#include "contention_probe.hpp"
+#include "epoch_reclamation.hpp"
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Unbounded multi-producer/multi-consumer stack
+ *
+ * @tparam T Element type (must be movable)
+ */
+template<typename T>
+class LockFreeStack {
+public:
+    static constexpr size_t TOP_SITE = 0;     ///< Probe site of the top pointer
+    static constexpr size_t SITE_COUNT = 1;
+
+    LockFreeStack() = default;
+
+    /**
+     * @brief Delete the remaining nodes (no thread may be using the stack)
+     */
+    ~LockFreeStack() {
+        Node* node = m_top.load(std::memory_order_relaxed);
+        while (node != nullptr) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    /**
+     * @brief Report CAS attempts to a probe (set before threads start; nullptr = off)
+     */
+    void setProbe(ContentionProbe* probe) { m_probe = probe; }
+
+    /**
+     * @brief Push an element (lock-free)
+     */
+    void push(T value) {
+        Node* node = new Node{std::move(value), m_top.load(std::memory_order_relaxed)};
+        // Push never dereferences a shared node, so it needs no guard
+        for (;;) {
+            bool swapped = m_top.compare_exchange_weak(node->next, node,
+                                                       std::memory_order_release,
+                                                       std::memory_order_relaxed);
+            if (m_probe) m_probe->recordCas(TOP_SITE, ContentionOp::Push, swapped);
+            if (swapped) break;
+        }
+        if (m_probe) m_probe->recordOp(ContentionOp::Push);
+    }
+
+    /**
+     * @brief Pop the most recently pushed element (lock-free)
+     *
+     * @return The element, or std::nullopt if the stack was empty
+     */
+    std::optional<T> pop() {
+        EpochDomain::Guard guard(m_epochs);
+        Node* top = m_top.load(std::memory_order_acquire);
+        for (;;) {
+            if (top == nullptr) {
+                return std::nullopt;
+            }
+            bool swapped = m_top.compare_exchange_weak(top, top->next,
+                                                       std::memory_order_acquire,
+                                                       std::memory_order_acquire);
+            if (m_probe) m_probe->recordCas(TOP_SITE, ContentionOp::Pop, swapped);
+            if (swapped) break;
+        }
+
+        // Only the winner of the CAS reaches here, so the value is ours to move
+        std::optional<T> value(std::move(top->value));
+        m_epochs.retire(top);
+        if (m_probe) m_probe->recordOp(ContentionOp::Pop);
+        return value;
+    }
+
+    /**
+     * @brief Check whether the stack was empty at the time of the call
+     */
+    bool isEmpty() const { return m_top.load(std::memory_order_acquire) == nullptr; }
+
+private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    alignas(64) std::atomic<Node*> m_top{nullptr};
+    ContentionProbe* m_probe = nullptr;
+    EpochDomain m_epochs;
+};
+
+} // namespace dsav
@@ -0,0 +1,161 @@
+/**
+ * @file mpmc_queue.hpp
+ * @brief Bounded lock-free multi-producer/multi-consumer ring buffer
+ *
+ * The circular Queue made safe for any number of threads, after Dmitry
+ * Vyukov's design. Every cell carries a sequence number that says whose
+ * turn it is: cell i is free for the producer holding position p when its
+ * sequence equals p, and full for the consumer holding position p when it
+ * equals p + 1. Producers and consumers claim positions with a CAS on their
+ * own counter, then fill or empty the cell without further synchronization
+ * and hand it on by publishing the next sequence number. Nothing is ever
+ * allocated after construction, so no reclamation is needed.
+ *
+ * Probe sites are the cells: a CAS is reported on the cell its position
+ * maps to, and a producer or consumer that finds its cell claimed by
+ * somebody else counts as a failed attempt there.
+ */
+
+#pragma once
+
+#include "contention_probe.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Fixed-capacity FIFO for any number of producer and consumer threads
+ *
+ * @tparam T Element type (must be default-constructible and movable)
+ */
+template<typename T>
+class MpmcQueue {
+public:
+    /**
+     * @brief Construct a queue holding up to capacity elements
+     *
+     * @param capacity Requested capacity (rounded up to a power of two, at least 2)
+     */
+    explicit MpmcQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_mask = size - 1;
+        m_cells = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Report CAS attempts to a probe with capacity() sites (set before threads start)
+     */
+    void setProbe(ContentionProbe* probe) { m_probe = probe; }
+
+    /**
+     * @brief Append an element (lock-free)
+     *
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool tryPush(T&& value) {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                size_t site = pos & m_mask;
+                bool claimed = m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed);
+                record(site, ContentionOp::Push, claimed);
+                if (claimed) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                // Another producer took this position first
+                record(pos & m_mask, ContentionOp::Push, false);
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        if (m_probe) m_probe->recordOp(ContentionOp::Push);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (lock-free)
+     *
+     * @return The element, or std::nullopt if the queue is empty
+     */
+    std::optional<T> tryPop() {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                size_t site = pos & m_mask;
+                bool claimed = m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed);
+                record(site, ContentionOp::Pop, claimed);
+                if (claimed) break;
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                record(pos & m_mask, ContentionOp::Pop, false);
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<T> value(std::move(cell->value));
+        cell->value = T{};
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        if (m_probe) m_probe->recordOp(ContentionOp::Pop);
+        return value;
+    }
+
+    /**
+     * @brief Maximum number of queued elements
+     */
+    size_t capacity() const { return m_mask + 1; }
+
+    /**
+     * @brief Elements queued at about the time of the call (exact when no thread is active)
+     */
+    size_t approximateSize() const {
+        size_t enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+        size_t dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    /// One cell per cache line, so neighbouring cells never false-share
+    struct alignas(CACHE_LINE) Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    void record(size_t site, ContentionOp op, bool success) {
+        if (m_probe) m_probe->recordCas(site, op, success);
+    }
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    ContentionProbe* m_probe = nullptr;
+
+    alignas(CACHE_LINE) std::atomic<size_t> m_enqueuePos{0};  ///< Next position a producer claims
+    alignas(CACHE_LINE) std::atomic<size_t> m_dequeuePos{0};  ///< Next position a consumer claims
+};
+
+} // namespace dsav
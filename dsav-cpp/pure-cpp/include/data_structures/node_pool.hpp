@@ -0,0 +1,197 @@
+/**
+ * @file node_pool.hpp
+ * @brief Index-based node storage shared by the linked containers
+ *
+ * Nodes live in one contiguous slab and refer to each other through 32-bit
+ * indices instead of heap pointers. Freed slots are recycled through a free
+ * list, so steady-state insert/remove traffic performs no allocations and
+ * clearing a container releases every node at once (no reference cycles).
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+namespace dsav {
+
+/// Index of a node inside a NodePool
+using NodeIndex = std::uint32_t;
+
+/// Sentinel index meaning "no node" (the pool equivalent of nullptr)
+inline constexpr NodeIndex NULL_NODE = 0xFFFFFFFFu;
+
+/**
+ * @brief Contiguous slab of nodes with a free list
+ *
+ * Template parameter:
+ * - Node: Node type stored in the pool (must be copy/move assignable)
+ *
+ * Indices stay valid until the slot is released or the pool is cleared,
+ * even when the slab grows. References returned by operator[] are only
+ * valid until the next allocate() call.
+ */
+template<typename Node>
+class NodePool {
+public:
+    NodePool() = default;
+
+    /**
+     * @brief Construct a node in a free slot
+     *
+     * @param args Arguments forwarded to the Node constructor
+     * @return Index of the new node
+     */
+    template<typename... Args>
+    NodeIndex allocate(Args&&... args) {
+        if (!m_freeList.empty()) {
+            NodeIndex index = m_freeList.back();
+            m_freeList.pop_back();
+            m_nodes[index] = Node(std::forward<Args>(args)...);
+            m_live[index] = 1;
+            return index;
+        }
+
+        m_nodes.emplace_back(std::forward<Args>(args)...);
+        m_live.push_back(1);
+        return static_cast<NodeIndex>(m_nodes.size() - 1);
+    }
+
+    /**
+     * @brief Return a slot to the free list
+     *
+     * @param index Index of the node to release
+     */
+    void release(NodeIndex index) {
+        m_live[index] = 0;
+        m_freeList.push_back(index);
+    }
+
+    /**
+     * @brief Release every node at once
+     */
+    void clear() {
+        m_nodes.clear();
+        m_freeList.clear();
+        m_live.clear();
+    }
+
+    /**
+     * @brief Reserve slab capacity for a known number of nodes
+     *
+     * @param count Number of nodes to reserve space for
+     */
+    void reserve(size_t count) {
+        m_nodes.reserve(count);
+        m_live.reserve(count);
+    }
+
+    /**
+     * @brief Check whether an index refers to a live (allocated) node
+     *
+     * @param index Index to check (any value, including NULL_NODE)
+     */
+    bool isLive(NodeIndex index) const {
+        return index < m_live.size() && m_live[index];
+    }
+
+    Node& operator[](NodeIndex index) {
+        return m_nodes[index];
+    }
+
+    const Node& operator[](NodeIndex index) const {
+        return m_nodes[index];
+    }
+
+    /**
+     * @brief Get number of live nodes
+     */
+    size_t size() const {
+        return m_nodes.size() - m_freeList.size();
+    }
+
+    /**
+     * @brief Get number of slots in the slab (live + free)
+     */
+    size_t slotCount() const {
+        return m_nodes.size();
+    }
+
+    /**
+     * @brief Get reserved slab capacity
+     */
+    size_t capacity() const {
+        return m_nodes.capacity();
+    }
+
+private:
+    std::vector<Node> m_nodes;           ///< Contiguous node slab
+    std::vector<NodeIndex> m_freeList;   ///< Released slots available for reuse
+    std::vector<std::uint8_t> m_live;    ///< 1 if the slot holds a live node
+};
+
+/**
+ * @brief Read-only handle to a pooled node (for visualization)
+ *
+ * Behaves like the shared_ptr the containers used to hand out: it tests
+ * false when empty, and operator-> reaches the node's fields. Child links
+ * are followed with left()/right()/parent()/next()/prev(), which return handles.
+ * A handle stays valid until its node is removed or the container is
+ * cleared.
+ *
+ * @tparam Node Node type stored in the pool
+ */
+template<typename Node>
+class NodeHandle {
+public:
+    NodeHandle() = default;
+
+    NodeHandle(const NodePool<Node>* pool, NodeIndex index)
+        : m_pool(pool), m_index(index) {}
+
+    explicit operator bool() const {
+        return m_pool != nullptr && m_index != NULL_NODE;
+    }
+
+    const Node* operator->() const {
+        return &(*m_pool)[m_index];
+    }
+
+    const Node& operator*() const {
+        return (*m_pool)[m_index];
+    }
+
+    /**
+     * @brief Get the raw pool index (stable node id)
+     */
+    NodeIndex index() const {
+        return m_index;
+    }
+
+    // Link navigation (only instantiated for node types that have the link)
+    NodeHandle left() const { return link((*m_pool)[m_index].left); }
+    NodeHandle right() const { return link((*m_pool)[m_index].right); }
+    NodeHandle parent() const { return link((*m_pool)[m_index].parent); }
+    NodeHandle next() const { return link((*m_pool)[m_index].next); }
+    NodeHandle prev() const { return link((*m_pool)[m_index].prev); }
+
+    bool operator==(const NodeHandle& other) const {
+        return m_index == other.m_index && (m_index == NULL_NODE || m_pool == other.m_pool);
+    }
+
+    bool operator!=(const NodeHandle& other) const {
+        return !(*this == other);
+    }
+
+private:
+    NodeHandle link(NodeIndex index) const {
+        return NodeHandle(m_pool, index);
+    }
+
+    const NodePool<Node>* m_pool = nullptr;  ///< Owning pool
+    NodeIndex m_index = NULL_NODE;           ///< Node index within the pool
+};
+
+} // namespace dsav
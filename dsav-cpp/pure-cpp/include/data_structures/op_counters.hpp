@@ -0,0 +1,112 @@
+/**
+ * @file op_counters.hpp
+ * @brief Operation counters shared by the data structures
+ *
+ * Every data structure derives from OpCounted and reports the primitive work
+ * its operations do: key comparisons, pointer (link) hops, element moves or
+ * copies, allocations and tree rotations. The complexity runner reads the
+ * counters before and after an operation to plot its cost against n.
+ *
+ * Counting is on by default. Build with DSAV_OP_COUNTERS=0 (CMake
+ * -DENABLE_OP_COUNTERS=OFF) and the count*() calls become empty inline
+ * functions, so the structures compile to the uninstrumented code; the
+ * counters then stay at zero.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#ifndef DSAV_OP_COUNTERS
+#define DSAV_OP_COUNTERS 1
+#endif
+
+namespace dsav {
+
+/**
+ * @brief Primitive operations performed so far
+ */
+struct OpCounters {
+    std::uint64_t comparisons = 0;  ///< Key comparisons
+    std::uint64_t hops = 0;         ///< Links followed (next, left, right, parent)
+    std::uint64_t moves = 0;        ///< Elements moved or copied
+    std::uint64_t allocations = 0;  ///< Buffers, blocks or nodes allocated
+    std::uint64_t rotations = 0;    ///< Tree rotations
+
+    /**
+     * @brief Sum of every counter
+     */
+    std::uint64_t total() const {
+        return comparisons + hops + moves + allocations + rotations;
+    }
+
+    OpCounters& operator+=(const OpCounters& other) {
+        comparisons += other.comparisons;
+        hops += other.hops;
+        moves += other.moves;
+        allocations += other.allocations;
+        rotations += other.rotations;
+        return *this;
+    }
+
+    /// Counters accumulated between two snapshots (this - earlier)
+    OpCounters since(const OpCounters& earlier) const {
+        OpCounters delta;
+        delta.comparisons = comparisons - earlier.comparisons;
+        delta.hops = hops - earlier.hops;
+        delta.moves = moves - earlier.moves;
+        delta.allocations = allocations - earlier.allocations;
+        delta.rotations = rotations - earlier.rotations;
+        return delta;
+    }
+};
+
+/**
+ * @brief Base class that owns a structure's counters
+ *
+ * The counters are mutable so const lookups (find, search, peek) can count
+ * the comparisons and hops they make.
+ */
+class OpCounted {
+public:
+    /**
+     * @brief Check whether counting was compiled in
+     */
+    static constexpr bool countingEnabled() {
+        return DSAV_OP_COUNTERS != 0;
+    }
+
+    /**
+     * @brief Counters since construction or the last resetOpCounters()
+     */
+    const OpCounters& opCounters() const {
+        return m_ops;
+    }
+
+    /**
+     * @brief Zero every counter
+     */
+    void resetOpCounters() {
+        m_ops = OpCounters{};
+    }
+
+protected:
+#if DSAV_OP_COUNTERS
+    void countComparisons(std::uint64_t n = 1) const { m_ops.comparisons += n; }
+    void countHops(std::uint64_t n = 1) const { m_ops.hops += n; }
+    void countMoves(std::uint64_t n = 1) const { m_ops.moves += n; }
+    void countAllocations(std::uint64_t n = 1) const { m_ops.allocations += n; }
+    void countRotations(std::uint64_t n = 1) const { m_ops.rotations += n; }
+#else
+    void countComparisons(std::uint64_t = 1) const {}
+    void countHops(std::uint64_t = 1) const {}
+    void countMoves(std::uint64_t = 1) const {}
+    void countAllocations(std::uint64_t = 1) const {}
+    void countRotations(std::uint64_t = 1) const {}
+#endif
+
+private:
+    mutable OpCounters m_ops;
+};
+
+} // namespace dsav
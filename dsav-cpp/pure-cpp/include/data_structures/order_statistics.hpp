@@ -0,0 +1,48 @@
+/**
+ * @file order_statistics.hpp
+ * @brief Subtree-size augmentation for pooled binary trees
+ *
+ * A tree built with its OrderStatistics parameter set stores in every node
+ * the number of nodes in that node's subtree. The trees keep the count
+ * exact through inserts, deletes and rotations, which gives O(log n)
+ * select(k), rank(value) and range counts. Without the parameter the count
+ * is an empty base class, so plain trees keep their node size.
+ */
+
+#pragma once
+
+#include "node_pool.hpp"
+#include <cstddef>
+
+namespace dsav {
+
+/**
+ * @brief Node mixin holding the subtree size (empty unless enabled)
+ */
+template<bool Enabled>
+struct SubtreeSize {};
+
+template<>
+struct SubtreeSize<true> {
+    NodeIndex subtreeSize = 1;  ///< Nodes in this subtree, including this one
+};
+
+namespace detail {
+
+/// Subtree size of a node (0 for NULL_NODE)
+template<typename Node>
+size_t subtreeSizeOf(const NodePool<Node>& pool, NodeIndex index) {
+    return index == NULL_NODE ? 0 : pool[index].subtreeSize;
+}
+
+/// Recompute a node's subtree size from its children
+template<typename Node>
+void refreshSubtreeSize(NodePool<Node>& pool, NodeIndex index) {
+    Node& node = pool[index];
+    node.subtreeSize = static_cast<NodeIndex>(
+        1 + subtreeSizeOf(pool, node.left) + subtreeSizeOf(pool, node.right));
+}
+
+} // namespace detail
+
+} // namespace dsav
@@ -4,13 +4,21 @@
  *
  * A template-based queue (FIFO - First In First Out) with fixed maximum capacity.
  * Implemented using a circular buffer for efficient enqueue/dequeue operations.
+ * Queue<T, DYNAMIC_CAPACITY> is a growable, block-based variant.
  */
 
 #pragma once
 
+#include "capacity_event.hpp"
+#include "op_counters.hpp"
+#include <algorithm>
 #include <array>
+#include <deque>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 #include <cstddef>
 
 namespace dsav {
@@ -23,9 +31,10 @@ namespace dsav {
  * - MaxSize: Maximum number of elements (default 16)
  *
  * The queue uses a circular buffer internally, making enqueue and dequeue O(1).
+ * Use MaxSize = DYNAMIC_CAPACITY for a queue that grows instead of filling up.
  */
 template<typename T, size_t MaxSize = 16>
-class Queue {
+class Queue : public OpCounted {
 public:
     /**
      * @brief Construct an empty queue
@@ -46,11 +55,44 @@ public:
         m_data[m_rear] = value;
         m_rear = (m_rear + 1) % MaxSize;
         m_size++;
+        countMoves();
         return true;
     }
 
     /**
-     * @brief Dequeue an element from the front
+     * @brief Move an element in at the rear of the queue
+     *
+     * @param value Value to move in
+     * @return true if successful, false if queue is full
+     */
+    bool enqueue(T&& value) {
+        if (isFull()) {
+            return false;
+        }
+
+        m_data[m_rear] = std::move(value);
+        m_rear = (m_rear + 1) % MaxSize;
+        m_size++;
+        countMoves();
+        return true;
+    }
+
+    /**
+     * @brief Construct an element at the rear of the queue
+     *
+     * The slots of a fixed queue always hold a T, so the new value is
+     * built and then move-assigned into its slot.
+     *
+     * @param args Constructor arguments of T
+     * @return true if successful, false if queue is full
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        return enqueue(T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Dequeue an element from the front (moved out, not copied)
      *
      * @return The dequeued value if successful, std::nullopt if queue is empty
      */
@@ -59,9 +101,10 @@ public:
             return std::nullopt;
         }
 
-        T value = m_data[m_front];
+        T value = std::move(m_data[m_front]);
         m_front = (m_front + 1) % MaxSize;
         m_size--;
+        countMoves();
         return value;
     }
 
@@ -189,4 +232,271 @@ private:
     size_t m_size = 0;                ///< Current number of elements
 };
 
+/**
+ * @brief Growable queue data structure built from fixed-size blocks
+ *
+ * Selected with MaxSize = DYNAMIC_CAPACITY. Elements live in a deque-style
+ * chain of blocks: enqueue appends a block when the last one is full and
+ * dequeue retires the first block once it has been read to the end. Elements
+ * never move, so both operations are O(1) and no enqueue ever copies the
+ * queue. Retired blocks go to a small spare list and are reused by the next
+ * enqueue that needs one, so a steady stream allocates nothing.
+ *
+ * Slots are numbered from the start of the first live block, which is also
+ * what frontIndex(), rearIndex() and at() use. With event recording on, each
+ * block hand-off is logged as a CapacityEvent.
+ */
+template<typename T>
+class Queue<T, DYNAMIC_CAPACITY> : public CapacityEventLog, public OpCounted {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64;  ///< Slots per block
+    static constexpr size_t MAX_SPARE_BLOCKS = 4;     ///< Retired blocks kept for reuse
+
+    /**
+     * @brief Construct an empty queue
+     *
+     * @param blockSize Slots per block (at least 1)
+     */
+    explicit Queue(size_t blockSize = DEFAULT_BLOCK_SIZE)
+        : m_blockSize(std::max<size_t>(blockSize, 1)) {}
+
+    Queue(const Queue& other)
+        : CapacityEventLog(other), OpCounted(other), m_blockSize(other.m_blockSize), m_head(other.m_head),
+          m_size(other.m_size) {
+        for (const auto& block : other.m_blocks) {
+            auto copy = std::make_unique<T[]>(m_blockSize);
+            std::copy(block.get(), block.get() + m_blockSize, copy.get());
+            m_blocks.push_back(std::move(copy));
+        }
+    }
+
+    Queue& operator=(const Queue& other) {
+        if (this != &other) {
+            Queue copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    Queue(Queue&&) noexcept = default;
+    Queue& operator=(Queue&&) noexcept = default;
+
+    /**
+     * @brief Enqueue an element at the rear, adding a block if the last one is full
+     *
+     * @param value Value to enqueue
+     * @return Always true (kept for interface parity with the fixed queue)
+     */
+    bool enqueue(const T& value) {
+        return emplace(value);
+    }
+
+    /**
+     * @brief Move an element in at the rear, taking a new block if the last one is full
+     *
+     * @param value Value to move in
+     * @return Always true
+     */
+    bool enqueue(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * @brief Construct an element at the rear, taking a new block if the last one is full
+     *
+     * Blocks never move, so arguments referring to queued elements stay valid.
+     *
+     * @param args Constructor arguments of T
+     * @return Always true
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        size_t slot = m_head + m_size;
+        if (slot == capacity()) {
+            acquireBlock();
+        }
+        m_blocks[slot / m_blockSize][slot % m_blockSize] = T(std::forward<Args>(args)...);
+        m_size++;
+        countMoves();
+        return true;
+    }
+
+    /**
+     * @brief Dequeue an element from the front, retiring its block once it is used up
+     *
+     * @return The dequeued value if successful, std::nullopt if queue is empty
+     */
+    std::optional<T> dequeue() {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+
+        T value = std::move(m_blocks.front()[m_head]);
+        countMoves();
+        m_head++;
+        m_size--;
+        if (m_head == m_blockSize) {
+            retireFrontBlock();
+            m_head = 0;
+        } else if (m_size == 0) {
+            // Empty inside a block: rewind so the block is refilled from its start
+            m_head = 0;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Peek at the front element without removing it
+     *
+     * @return The front value if queue is not empty, std::nullopt otherwise
+     */
+    std::optional<T> peek() const {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        return m_blocks.front()[m_head];
+    }
+
+    /**
+     * @brief Check if the queue is empty
+     */
+    bool isEmpty() const {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Check if the queue is full (never: it grows instead)
+     */
+    constexpr bool isFull() const {
+        return false;
+    }
+
+    /**
+     * @brief Get current number of elements
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the number of slots in the live blocks
+     */
+    size_t capacity() const {
+        return m_blocks.size() * m_blockSize;
+    }
+
+    /**
+     * @brief Get the number of slots per block
+     */
+    size_t blockSize() const {
+        return m_blockSize;
+    }
+
+    /**
+     * @brief Get the number of live blocks
+     */
+    size_t blockCount() const {
+        return m_blocks.size();
+    }
+
+    /**
+     * @brief Get the number of retired blocks kept for reuse
+     */
+    size_t spareBlockCount() const {
+        return m_spares.size();
+    }
+
+    /**
+     * @brief Clear all elements
+     *
+     * Live blocks are retired like any other, so the spare list stays warm.
+     */
+    void clear() {
+        while (!m_blocks.empty()) {
+            retireFrontBlock();
+        }
+        m_head = 0;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Get the front slot (for visualization)
+     *
+     * @return Slot of the front element, counted from the first live block
+     */
+    size_t frontIndex() const {
+        return m_head;
+    }
+
+    /**
+     * @brief Get the rear slot (for visualization)
+     *
+     * @return Slot where the next element will be enqueued
+     */
+    size_t rearIndex() const {
+        return m_head + m_size;
+    }
+
+    /**
+     * @brief Get element at a specific slot (for visualization)
+     *
+     * @param index Slot to access, counted from the first live block
+     * @return Element at the given slot
+     * @throws std::out_of_range if index >= capacity()
+     */
+    const T& at(size_t index) const {
+        if (index >= capacity()) {
+            throw std::out_of_range("Queue index out of range");
+        }
+        return m_blocks[index / m_blockSize][index % m_blockSize];
+    }
+
+    /**
+     * @brief Get element at queue position (0 = front, size-1 = rear)
+     *
+     * @param position Position in queue (0-based from front)
+     * @return Element at the given position
+     * @throws std::out_of_range if position >= size
+     */
+    const T& atPosition(size_t position) const {
+        if (position >= m_size) {
+            throw std::out_of_range("Queue position out of range");
+        }
+        size_t slot = m_head + position;
+        return m_blocks[slot / m_blockSize][slot % m_blockSize];
+    }
+
+private:
+    void acquireBlock() {
+        size_t oldCapacity = capacity();
+        if (!m_spares.empty()) {
+            m_blocks.push_back(std::move(m_spares.back()));
+            m_spares.pop_back();
+            recordEvent(CapacityEventType::BlockReuse, m_size, oldCapacity, capacity());
+        } else {
+            m_blocks.push_back(std::make_unique<T[]>(m_blockSize));
+            countAllocations();
+            recordEvent(CapacityEventType::BlockAllocate, m_size, oldCapacity, capacity());
+        }
+    }
+
+    void retireFrontBlock() {
+        size_t oldCapacity = capacity();
+        std::unique_ptr<T[]> block = std::move(m_blocks.front());
+        m_blocks.pop_front();
+        if (m_spares.size() < MAX_SPARE_BLOCKS) {
+            m_spares.push_back(std::move(block));
+            recordEvent(CapacityEventType::BlockRetire, m_size, oldCapacity, capacity());
+        } else {
+            recordEvent(CapacityEventType::BlockFree, m_size, oldCapacity, capacity());
+        }
+    }
+
+    std::deque<std::unique_ptr<T[]>> m_blocks;   ///< Live blocks, front block first
+    std::vector<std::unique_ptr<T[]>> m_spares;  ///< Retired blocks awaiting reuse
+    size_t m_blockSize = DEFAULT_BLOCK_SIZE;    ///< Slots per block
+    size_t m_head = 0;                          ///< Front slot within the first block
+    size_t m_size = 0;                          ///< Current number of elements
+};
+
 } // namespace dsav
@@ -8,21 +8,35 @@
  * 3. All NIL (null) leaves are BLACK
  * 4. RED nodes have BLACK children (no two consecutive REDs)
  * 5. All paths from root to NIL have same number of BLACK nodes
+ *
+ * With the OrderStatistics parameter set, nodes also count their subtrees
+ * (kept exact through the fixup rotations), which adds O(log n) select(k),
+ * rank(value) and range counts.
  */
 
 #pragma once
 
-#include <memory>
-#include <optional>
+#include "node_pool.hpp"
+#include "op_counters.hpp"
+#include "tree_iterators.hpp"
+#include "order_statistics.hpp"
+#include "ring_buffer.hpp"
 #include <functional>
 #include <vector>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <utility>
 
 namespace dsav {
 
 /**
  * @brief Node color enumeration
  */
-enum class RBColor {
+enum class RBColor : std::uint8_t {
     RED,
     BLACK
 };
@@ -30,24 +44,36 @@ enum class RBColor {
 /**
  * @brief Node structure for red-black tree
  *
+ * Links are pool indices (NULL_NODE when absent). The parent link is a plain
+ * index, so parent/child references never form ownership cycles.
+ *
  * @tparam T Type of data stored in the node
+ * @tparam OrderStatistics Also store the subtree size
  */
-template<typename T>
-struct RBTreeNode {
+template<typename T, bool OrderStatistics = false>
+struct RBTreeNode : SubtreeSize<OrderStatistics> {
+    using value_type = T;
+
     T data;
     RBColor color;
-    std::shared_ptr<RBTreeNode<T>> left;
-    std::shared_ptr<RBTreeNode<T>> right;
-    std::shared_ptr<RBTreeNode<T>> parent;  // Required for RB tree operations
+    NodeIndex left;
+    NodeIndex right;
+    NodeIndex parent;  // Required for RB tree operations
 
     explicit RBTreeNode(const T& value, RBColor nodeColor = RBColor::RED)
-        : data(value), color(nodeColor), left(nullptr), right(nullptr), parent(nullptr) {}
+        : data(value), color(nodeColor), left(NULL_NODE), right(NULL_NODE), parent(NULL_NODE) {}
+    explicit RBTreeNode(T&& value, RBColor nodeColor = RBColor::RED)
+        : data(std::move(value)), color(nodeColor), left(NULL_NODE), right(NULL_NODE), parent(NULL_NODE) {}
 };
 
+/// Handle to an RB tree node as exposed to visualizers
+template<typename T, bool OrderStatistics = false>
+using RBTreeNodeHandle = NodeHandle<RBTreeNode<T, OrderStatistics>>;
+
 /**
  * @brief Event types for RB tree operations (for visualization)
  */
-enum class RBTreeEventType {
+enum class RBTreeEventType : std::uint8_t {
     InsertNode,          // Node inserted at position
     Recolor,             // Node color changed
     RotateLeft,          // Left rotation performed
@@ -61,34 +87,108 @@ enum class RBTreeEventType {
 };
 
 /**
- * @brief Event record for RB tree operations
+ * @brief Compact event record for RB tree operations
+ *
+ * Plain data only: recording is a copy into a ring buffer, and the
+ * human-readable text is produced on demand by describeEvent(). Keys are
+ * captured alongside the ids so old events stay readable after deletes.
  */
 template<typename T>
 struct RBTreeEvent {
-    RBTreeEventType type;
-    T nodeValue;                    // Primary node (z)
-    std::optional<T> parentValue;   // Parent (p)
-    std::optional<T> grandparentValue;  // Grandparent (g)
-    std::optional<T> uncleValue;    // Uncle (u)
-    RBColor fromColor;              // Original color
-    RBColor toColor;                // New color
-    std::string explanation;        // Human-readable explanation
-
-    RBTreeEvent(RBTreeEventType t, const T& val, const std::string& exp = "")
-        : type(t), nodeValue(val), fromColor(RBColor::BLACK), toColor(RBColor::BLACK), explanation(exp) {}
+    RBTreeEventType type = RBTreeEventType::InsertNode;
+    std::uint8_t fixupCase = 0;         // Deletion fixup case (1-4), 0 otherwise
+    RBColor fromColor = RBColor::BLACK; // Original color (Recolor)
+    RBColor toColor = RBColor::BLACK;   // New color (Recolor)
+    NodeIndex node = NULL_NODE;         // Primary node (z, or the rotation pivot)
+    NodeIndex parent = NULL_NODE;       // Parent (p)
+    NodeIndex grandparent = NULL_NODE;  // Grandparent (g)
+    NodeIndex uncle = NULL_NODE;        // Uncle (u), or sibling (w) in deletion fixups
+    T value{};                          // Key of the primary node
+    T parentValue{};                    // Keys of the related nodes (unset when the id is NULL_NODE)
+    T grandparentValue{};
+    T uncleValue{};
 };
 
+/**
+ * @brief Human-readable explanation of a recorded RB tree event
+ *
+ * @param event Event from RedBlackTree::events()
+ * @return Explanation text
+ */
+template<typename T>
+std::string describeEvent(const RBTreeEvent<T>& event) {
+    std::ostringstream oss;
+    auto key = [&oss](NodeIndex id, const T& value) -> std::ostringstream& {
+        if (id == NULL_NODE) {
+            oss << "NIL";
+        } else {
+            oss << value;
+        }
+        return oss;
+    };
+    auto colorName = [](RBColor color) { return color == RBColor::RED ? "RED" : "BLACK"; };
+
+    switch (event.type) {
+        case RBTreeEventType::InsertNode:
+            if (event.parent == NULL_NODE) {
+                oss << "Insert " << event.value << " as BLACK root";
+            } else {
+                oss << "Insert " << event.value << " as RED leaf under " << event.parentValue;
+            }
+            break;
+        case RBTreeEventType::Recolor:
+            oss << "Recolor " << event.value << ": " << colorName(event.fromColor)
+                << " -> " << colorName(event.toColor);
+            break;
+        case RBTreeEventType::RotateLeft:
+        case RBTreeEventType::RotateRight:
+            oss << (event.type == RBTreeEventType::RotateLeft ? "Rotate left" : "Rotate right")
+                << " at " << event.value << " (" << event.parentValue << " moves up)";
+            break;
+        case RBTreeEventType::Case1_UncleRed:
+            oss << "Case 1: parent " << event.parentValue << " and uncle " << event.uncleValue
+                << " are RED - recolor and continue from grandparent " << event.grandparentValue;
+            break;
+        case RBTreeEventType::Case2_Triangle:
+            oss << "Case 2: " << event.value << " forms a triangle with parent " << event.parentValue
+                << " - rotate parent into a line";
+            break;
+        case RBTreeEventType::Case3_Line:
+            oss << "Case 3: " << event.value << ", parent " << event.parentValue << " and grandparent "
+                << event.grandparentValue << " form a line - rotate grandparent and swap colors";
+            break;
+        case RBTreeEventType::SetRootBlack:
+            oss << "Root " << event.value << " set to BLACK";
+            break;
+        case RBTreeEventType::DeleteNode:
+            oss << "Delete " << event.value;
+            break;
+        case RBTreeEventType::DeleteFixup:
+            oss << "Delete fixup case " << static_cast<int>(event.fixupCase) << ": x = ";
+            key(event.node, event.value) << ", parent ";
+            key(event.parent, event.parentValue) << ", sibling ";
+            key(event.uncle, event.uncleValue);
+            break;
+    }
+    return oss.str();
+}
+
 /**
  * @brief Red-Black Tree data structure
  *
- * Template parameter:
+ * Template parameters:
  * - T: Type of elements stored in the tree
+ * - OrderStatistics: Maintain subtree sizes for select(), rank() and countInRange()
  *
  * Self-balancing BST maintaining RB properties through rotations and recoloring.
+ * Nodes are stored in a NodePool, so no per-node heap allocation is performed.
  */
-template<typename T>
-class RedBlackTree {
+template<typename T, bool OrderStatistics = false>
+class RedBlackTree : public OpCounted {
 public:
+    using Node = RBTreeNode<T, OrderStatistics>;
+    using Handle = RBTreeNodeHandle<T, OrderStatistics>;
+
     /**
      * @brief Construct an empty RB tree
      */
@@ -97,26 +197,54 @@ public:
     /**
      * @brief Insert a value into the RB tree
      *
+     * Duplicate values are ignored.
+     *
      * @param value Value to insert
      */
     void insert(const T& value) {
-        auto newNode = std::make_shared<RBTreeNode<T>>(value, RBColor::RED);
+        insertValue(value);
+    }
 
-        if (!m_root) {
-            m_root = newNode;
-            m_root->color = RBColor::BLACK;  // Property 2: root is BLACK
-            m_size++;
-            return;
-        }
+    /**
+     * @brief Move a value into the RB tree (duplicates are ignored and left untouched)
+     */
+    void insert(T&& value) {
+        insertValue(std::move(value));
+    }
 
-        // Standard BST insertion
-        auto parent = insertBST(m_root, newNode);
-        newNode->parent = parent;
+    /**
+     * @brief Construct a value and move it into the RB tree
+     *
+     * The key has to exist before the tree can be searched for its place,
+     * so this builds a T once and moves it into the new node.
+     *
+     * @param args Constructor arguments of T
+     */
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        insertValue(T(std::forward<Args>(args)...));
+    }
 
-        m_size++;
+    /**
+     * @brief Delete a value from the RB tree and return it
+     *
+     * @param value Key to delete
+     * @return The stored value (moved out), or std::nullopt if not found
+     */
+    std::optional<T> extract(const T& value) {
+        NodeIndex nodeToDelete = searchIndex(value);
+        if (nodeToDelete == NULL_NODE) {
+            return std::nullopt;
+        }
 
-        // Fix RB tree properties
-        fixInsert(newNode);
+        recordEvent(RBTreeEventType::DeleteNode, nodeToDelete);  // Records the value, so before the move
+        std::optional<T> stored(std::move(m_pool[nodeToDelete].data));
+        countMoves();
+        deleteNode(nodeToDelete);
+        m_pool.release(nodeToDelete);
+        touch(nodeToDelete);
+        m_size--;
+        return stored;
     }
 
     /**
@@ -126,12 +254,15 @@ public:
      * @return true if value was found and deleted, false otherwise
      */
     bool remove(const T& value) {
-        auto nodeToDelete = searchRecursive(m_root, value);
-        if (!nodeToDelete) {
+        NodeIndex nodeToDelete = searchIndex(value);
+        if (nodeToDelete == NULL_NODE) {
             return false;  // Value not found
         }
 
+        recordEvent(RBTreeEventType::DeleteNode, nodeToDelete);
         deleteNode(nodeToDelete);
+        m_pool.release(nodeToDelete);
+        touch(nodeToDelete);
         m_size--;
         return true;
     }
@@ -143,17 +274,17 @@ public:
      * @return true if found, false otherwise
      */
     bool search(const T& value) const {
-        return searchRecursive(m_root, value) != nullptr;
+        return searchIndex(value) != NULL_NODE;
     }
 
     /**
      * @brief Find a node with specific value (for visualization)
      *
      * @param value Value to find
-     * @return Shared pointer to node if found, nullptr otherwise
+     * @return Handle to node if found, empty handle otherwise
      */
-    std::shared_ptr<RBTreeNode<T>> find(const T& value) const {
-        return searchRecursive(m_root, value);
+    Handle find(const T& value) const {
+        return Handle(&m_pool, searchIndex(value));
     }
 
     /**
@@ -162,7 +293,7 @@ public:
      * @return true if empty
      */
     bool isEmpty() const {
-        return m_root == nullptr;
+        return m_root == NULL_NODE;
     }
 
     /**
@@ -178,17 +309,250 @@ public:
      * @brief Clear all nodes
      */
     void clear() {
-        m_root = nullptr;
+        m_pool.clear();
+        m_root = NULL_NODE;
+        m_size = 0;
+        m_changed.clear();
+        m_events.clear();  // Ids in old events would alias new nodes
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of nodes
+     */
+    void reserve(size_t count) {
+        m_pool.reserve(count);
+    }
+
+    // ===== Bulk loading =====
+
+    /**
+     * @brief Replace the contents with a balanced tree built from sorted input
+     *
+     * O(n): nodes are linked directly (no per-node fixups), every level is
+     * BLACK except an incomplete deepest level, which is RED. Adjacent
+     * duplicates are skipped. No events are recorded.
+     *
+     * @param first Start of a range sorted in ascending order
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void buildFromSorted(InputIt first, InputIt last) {
+        std::vector<T> values;
+        for (; first != last; ++first) {
+            if (values.empty() || values.back() < *first) values.push_back(*first);
+        }
+        rebuild(values);
+    }
+
+    /**
+     * @brief Replace the contents with a balanced tree built from any range
+     *
+     * Sorts a copy of the input, then builds as buildFromSorted().
+     * O(n log n) overall, with no rotations or per-node fixups.
+     */
+    template<typename InputIt>
+    void bulkLoad(InputIt first, InputIt last) {
+        std::vector<T> values(first, last);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        rebuild(values);
+    }
+
+    /**
+     * @brief Insert a batch of values, deferring all fixup reporting to the end
+     *
+     * When the batch is at least as large as the tree, the existing keys
+     * are merged with the sorted batch and the tree is rebuilt in one pass.
+     * Smaller batches are inserted one by one with event recording
+     * suspended, so the whole batch shows up as a single change set in the
+     * change journal. Duplicates (within the batch or with the tree) are
+     * ignored.
+     *
+     * @param first Start of the range (any order)
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void insertRange(InputIt first, InputIt last) {
+        std::vector<T> batch(first, last);
+        if (batch.size() >= m_size) {
+            std::sort(batch.begin(), batch.end());
+            batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+
+            std::vector<T> merged;
+            merged.reserve(m_size + batch.size());
+            std::set_union(inorder().begin(), inorder().end(), batch.begin(), batch.end(),
+                           std::back_inserter(merged));
+            rebuild(merged);
+            return;
+        }
+
+        bool recording = m_recordEvents;
+        m_recordEvents = false;
+        m_pool.reserve(m_size + batch.size());
+        for (const T& value : batch) {
+            insert(value);
+        }
+        m_recordEvents = recording;
+    }
+
+    // ===== Snapshots =====
+
+    /**
+     * @brief Copy out the keys in preorder with one color bit per key
+     *
+     * Together the two arrays fix the shape of the tree, so
+     * restorePreorder() can rebuild it exactly, without rebalancing.
+     *
+     * @param keys Receives the keys in preorder (Root-Left-Right)
+     * @param redBits Receives (size() + 7) / 8 bytes; bit i % 8 of byte i / 8
+     *                is set when the i-th preorder node is RED
+     */
+    void exportPreorder(std::vector<T>& keys, std::vector<std::uint8_t>& redBits) const {
+        keys.clear();
+        keys.reserve(m_size);
+        redBits.assign((m_size + 7) / 8, 0);
+        for (auto it = preorder().begin(); it != preorder().end(); ++it) {
+            if (it.handle()->color == RBColor::RED) {
+                redBits[keys.size() / 8] |= static_cast<std::uint8_t>(1u << (keys.size() % 8));
+            }
+            keys.push_back(*it);
+        }
+    }
+
+    /**
+     * @brief Replace the contents with a tree saved by exportPreorder()
+     *
+     * O(n) and non-recursive: each key is linked under its parent with a
+     * stack of open ancestors, then one bottom-up pass fills in subtree
+     * sizes and checks the red-black properties. No rotations, no events.
+     * Input that is not the preorder of a valid red-black tree with unique
+     * keys leaves the tree empty.
+     *
+     * @param keys Keys in preorder
+     * @param redBits Color bits laid out as by exportPreorder()
+     * @param count Number of keys
+     * @return false if the input was rejected
+     */
+    bool restorePreorder(const T* keys, const std::uint8_t* redBits, size_t count) {
+        if (m_trackChanges) {
+            for (NodeIndex id = 0; id < m_pool.slotCount(); ++id) {
+                if (m_pool.isLive(id)) m_changed.push_back(id);
+            }
+        }
+
+        m_pool.clear();
+        m_events.clear();  // Ids in old events would alias new nodes
+        m_root = NULL_NODE;
         m_size = 0;
+        if (count == 0) return true;
+        m_pool.reserve(count);
+
+        // Preorder ids, so every child comes after its parent
+        std::vector<NodeIndex> ids(count);
+        std::vector<NodeIndex> open;  // Ancestors still able to take a right child, keys decreasing
+        std::optional<T> lowerBound;  // Every later key must exceed the last ancestor left behind
+        bool valid = true;
+
+        for (size_t i = 0; i < count && valid; ++i) {
+            const T& key = keys[i];
+            if (lowerBound && !(*lowerBound < key)) {
+                valid = false;
+                break;
+            }
+
+            NodeIndex parent = NULL_NODE;
+            while (!open.empty() && m_pool[open.back()].data < key) {
+                parent = open.back();
+                open.pop_back();
+                lowerBound = m_pool[parent].data;
+            }
+            if (!open.empty() && !(key < m_pool[open.back()].data)) {
+                valid = false;  // Duplicate key
+                break;
+            }
+
+            bool red = (redBits[i / 8] >> (i % 8)) & 1u;
+            NodeIndex id = m_pool.allocate(key, red ? RBColor::RED : RBColor::BLACK);
+            ids[i] = id;
+            touch(id);
+            if (parent != NULL_NODE) {
+                m_pool[parent].right = id;
+                m_pool[id].parent = parent;
+            } else if (!open.empty()) {
+                m_pool[open.back()].left = id;
+                m_pool[id].parent = open.back();
+            }
+            open.push_back(id);
+        }
+
+        // Children before parents: black heights (NIL = 1) and subtree sizes
+        if (valid) {
+            std::vector<int> blackHeights(m_pool.slotCount(), 1);
+            auto heightOf = [&](NodeIndex id) { return id == NULL_NODE ? 1 : blackHeights[id]; };
+            for (size_t i = count; i-- > 0 && valid;) {
+                Node& node = m_pool[ids[i]];
+                if (node.color == RBColor::RED &&
+                    (colorOf(node.left) == RBColor::RED || colorOf(node.right) == RBColor::RED)) {
+                    valid = false;
+                } else if (heightOf(node.left) != heightOf(node.right)) {
+                    valid = false;
+                }
+                blackHeights[ids[i]] = heightOf(node.left) + (node.color == RBColor::BLACK ? 1 : 0);
+                if constexpr (OrderStatistics) {
+                    detail::refreshSubtreeSize(m_pool, ids[i]);
+                }
+            }
+            valid = valid && m_pool[ids[0]].color == RBColor::BLACK;
+        }
+
+        if (!valid) {
+            m_pool.clear();
+            return false;
+        }
+        m_root = ids[0];
+        m_size = count;
+        return true;
     }
 
     /**
      * @brief Get root node (for visualization)
      *
-     * @return Shared pointer to root node
+     * @return Handle to root node (empty if tree is empty)
+     */
+    Handle root() const {
+        return Handle(&m_pool, m_root);
+    }
+
+    // ===== Traversal ranges (non-recursive, allocation-free) =====
+
+    /**
+     * @brief Inorder range (Left-Root-Right), usable with range-for
+     */
+    DepthFirstRange<Node, TraversalOrder::Inorder> inorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Preorder range (Root-Left-Right), usable with range-for
+     */
+    DepthFirstRange<Node, TraversalOrder::Preorder> preorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Postorder range (Left-Right-Root), usable with range-for
      */
-    std::shared_ptr<RBTreeNode<T>> root() const {
-        return m_root;
+    DepthFirstRange<Node, TraversalOrder::Postorder> postorder() const {
+        return {&m_pool, m_root};
+    }
+
+    /**
+     * @brief Level-order range (breadth-first), usable with range-for
+     */
+    LevelOrderRange<Node> levelOrder() const {
+        return {&m_pool, m_root, m_size};
     }
 
     /**
@@ -196,8 +560,8 @@ public:
      *
      * @param func Function to apply to each node's data
      */
-    void inorderTraversal(std::function<void(const T&)> func) const {
-        inorderRecursive(m_root, func);
+    void inorderTraversal(const std::function<void(const T&)>& func) const {
+        for (const T& value : inorder()) func(value);
     }
 
     /**
@@ -207,21 +571,8 @@ public:
      */
     std::vector<T> levelOrderTraversal() const {
         std::vector<T> result;
-        if (!m_root) return result;
-
-        std::vector<std::shared_ptr<RBTreeNode<T>>> queue;
-        queue.push_back(m_root);
-
-        while (!queue.empty()) {
-            auto node = queue.front();
-            queue.erase(queue.begin());
-
-            result.push_back(node->data);
-
-            if (node->left) queue.push_back(node->left);
-            if (node->right) queue.push_back(node->right);
-        }
-
+        result.reserve(m_size);
+        for (const T& value : levelOrder()) result.push_back(value);
         return result;
     }
 
@@ -249,21 +600,101 @@ public:
      * @return true if all properties are satisfied
      */
     bool verifyProperties() const {
-        if (!m_root) return true;
+        if (m_root == NULL_NODE) return true;
 
         // Property 2: Root must be black
-        if (m_root->color != RBColor::BLACK) return false;
+        if (m_pool[m_root].color != RBColor::BLACK) return false;
 
         // Check all other properties recursively
         int blackHeight = -1;
-        return verifyPropertiesRecursive(m_root, 0, blackHeight);
+        if (!verifyPropertiesRecursive(m_root, 0, blackHeight)) return false;
+
+        if constexpr (OrderStatistics) {
+            bool sizesOk = true;
+            verifySubtreeSizes(m_root, sizesOk);
+            if (!sizesOk) return false;
+        }
+        return true;
+    }
+
+    // ===== Order statistics (OrderStatistics = true) =====
+
+    /**
+     * @brief Find the k-th smallest key, O(log n)
+     *
+     * @param k Zero-based rank (0 = smallest)
+     * @return Handle to the node, or an empty handle if k >= size()
+     */
+    Handle select(size_t k) const {
+        static_assert(OrderStatistics, "select() needs RedBlackTree<T, true>");
+        if (k >= m_size) return Handle(&m_pool, NULL_NODE);
+
+        NodeIndex current = m_root;
+        while (true) {
+            const Node& node = m_pool[current];
+            size_t leftSize = detail::subtreeSizeOf(m_pool, node.left);
+            if (k == leftSize) break;
+            if (k < leftSize) {
+                current = node.left;
+            } else {
+                k -= leftSize + 1;
+                current = node.right;
+            }
+            countHops();
+        }
+        return Handle(&m_pool, current);
+    }
+
+    /**
+     * @brief Number of keys less than a value, O(log n)
+     *
+     * For a key in the tree this is its zero-based position in sorted order.
+     */
+    size_t rank(const T& value) const {
+        static_assert(OrderStatistics, "rank() needs RedBlackTree<T, true>");
+        return countBelow(value, false);
+    }
+
+    /**
+     * @brief Zero-based sorted position of a live node, O(log n)
+     *
+     * Walks parent links, so no key comparisons are made.
+     */
+    size_t rankOf(NodeIndex id) const {
+        static_assert(OrderStatistics, "rankOf() needs RedBlackTree<T, true>");
+        size_t result = detail::subtreeSizeOf(m_pool, m_pool[id].left);
+        for (NodeIndex parent = m_pool[id].parent; parent != NULL_NODE; parent = m_pool[parent].parent) {
+            if (m_pool[parent].right == id) {
+                result += detail::subtreeSizeOf(m_pool, m_pool[parent].left) + 1;
+            }
+            id = parent;
+            countHops();
+        }
+        return result;
     }
 
+    /**
+     * @brief Number of keys in [low, high], O(log n)
+     */
+    size_t countInRange(const T& low, const T& high) const {
+        static_assert(OrderStatistics, "countInRange() needs RedBlackTree<T, true>");
+        if (high < low) return 0;
+        return countBelow(high, true) - countBelow(low, false);
+    }
+
+    /// Default number of events kept by the event log
+    static constexpr size_t DEFAULT_EVENT_CAPACITY = 4096;
+
     /**
      * @brief Enable event recording for visualization
+     *
+     * @param capacity Number of most recent events kept (older ones are overwritten)
      */
-    void enableEventRecording() {
+    void enableEventRecording(size_t capacity = DEFAULT_EVENT_CAPACITY) {
         m_recordEvents = true;
+        if (m_events.capacity() < capacity) {
+            m_events.setCapacity(capacity);
+        }
         m_events.clear();
     }
 
@@ -275,14 +706,17 @@ public:
     }
 
     /**
-     * @brief Get recorded events and clear the list
-     *
-     * @return Vector of events
+     * @brief Recorded events, oldest first
      */
-    std::vector<RBTreeEvent<T>> getAndClearEvents() {
-        std::vector<RBTreeEvent<T>> result = std::move(m_events);
+    const RingBuffer<RBTreeEvent<T>>& events() const {
+        return m_events;
+    }
+
+    /**
+     * @brief Drop every recorded event
+     */
+    void clearEvents() {
         m_events.clear();
-        return result;
     }
 
     /**
@@ -292,29 +726,237 @@ public:
         return m_recordEvents;
     }
 
+    // ===== Change tracking (for incremental layout) =====
+
+    /**
+     * @brief Start journaling the ids of nodes whose links, data or color change
+     */
+    void enableChangeTracking() {
+        m_trackChanges = true;
+        m_changed.clear();
+    }
+
+    /**
+     * @brief Stop journaling node changes
+     */
+    void disableChangeTracking() {
+        m_trackChanges = false;
+    }
+
+    /**
+     * @brief Get ids changed since the last call (deduplicated) and clear the journal
+     *
+     * Ids that are no longer live (see isLive) were removed from the tree.
+     *
+     * @return Vector of node ids
+     */
+    std::vector<NodeIndex> takeChangedNodes() {
+        std::vector<NodeIndex> result = std::move(m_changed);
+        m_changed.clear();
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    /**
+     * @brief Check whether a node id is currently part of the tree
+     */
+    bool isLive(NodeIndex id) const {
+        return m_pool.isLive(id);
+    }
+
+    /**
+     * @brief Get a handle to a node by id (for visualization)
+     */
+    Handle node(NodeIndex id) const {
+        return Handle(&m_pool, id);
+    }
+
 private:
     /**
-     * @brief Insert node using BST rules, return parent
+     * @brief Number of keys less than (or, if inclusive, equal to) a value
      */
-    std::shared_ptr<RBTreeNode<T>> insertBST(std::shared_ptr<RBTreeNode<T>> root,
-                                             std::shared_ptr<RBTreeNode<T>> newNode) {
-        if (newNode->data < root->data) {
-            if (root->left) {
-                return insertBST(root->left, newNode);
+    size_t countBelow(const T& value, bool inclusive) const {
+        size_t result = 0;
+        NodeIndex current = m_root;
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            countComparisons();
+            bool goLeft = inclusive ? value < node.data : !(node.data < value);
+            if (goLeft) {
+                current = node.left;
             } else {
-                root->left = newNode;
-                return root;
+                result += detail::subtreeSizeOf(m_pool, node.left) + 1;
+                current = node.right;
+            }
+            countHops();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Add delta to the subtree sizes of a node and its ancestors
+     *
+     * No-op unless OrderStatistics is set.
+     */
+    void adjustSubtreeSizes(NodeIndex i, int delta) {
+        if constexpr (OrderStatistics) {
+            for (; i != NULL_NODE; i = m_pool[i].parent) {
+                m_pool[i].subtreeSize += static_cast<NodeIndex>(delta);
+            }
+        }
+    }
+
+    /**
+     * @brief Insert below the BST position and fix the colors
+     *
+     * The value is only forwarded into the node once its side is known.
+     */
+    template<typename V>
+    void insertValue(V&& value) {
+        if (m_root == NULL_NODE) {
+            m_root = allocateNode(std::forward<V>(value), RBColor::BLACK);  // Property 2: root is BLACK
+            touch(m_root);
+            m_size++;
+            recordEvent(RBTreeEventType::InsertNode, m_root);
+            return;
+        }
+
+        // Standard BST insertion
+        NodeIndex parent = insertBST(value);
+        if (parent == NULL_NODE) {
+            return;  // Duplicate value - don't insert
+        }
+
+        bool left = value < m_pool[parent].data;
+        NodeIndex newNode = allocateNode(std::forward<V>(value), RBColor::RED);
+        m_pool[newNode].parent = parent;
+        if (left) {
+            m_pool[parent].left = newNode;
+        } else {
+            m_pool[parent].right = newNode;
+        }
+        touch(newNode);
+        touch(parent);
+        adjustSubtreeSizes(parent, 1);
+
+        m_size++;
+        recordEvent(RBTreeEventType::InsertNode, newNode, parent);
+
+        // Fix RB tree properties
+        fixInsert(newNode);
+    }
+
+    // ===== Link helpers (NULL_NODE-safe) =====
+
+    NodeIndex leftOf(NodeIndex i) const { return i == NULL_NODE ? NULL_NODE : m_pool[i].left; }
+    NodeIndex rightOf(NodeIndex i) const { return i == NULL_NODE ? NULL_NODE : m_pool[i].right; }
+    NodeIndex parentOf(NodeIndex i) const { return i == NULL_NODE ? NULL_NODE : m_pool[i].parent; }
+
+    /// NIL leaves count as BLACK (property 3)
+    RBColor colorOf(NodeIndex i) const { return i == NULL_NODE ? RBColor::BLACK : m_pool[i].color; }
+
+    void setColor(NodeIndex i, RBColor color) {
+        if (i != NULL_NODE && m_pool[i].color != color) {
+            if (m_recordEvents) {
+                RBTreeEvent<T> event = makeEvent(RBTreeEventType::Recolor, i);
+                event.fromColor = m_pool[i].color;
+                event.toColor = color;
+                m_events.push(event);
+            }
+            m_pool[i].color = color;
+            touch(i);
+        }
+    }
+
+    /// Force the root BLACK (property 2), logged as its own event
+    void blackenRoot() {
+        if (m_root != NULL_NODE && m_pool[m_root].color != RBColor::BLACK) {
+            recordEvent(RBTreeEventType::SetRootBlack, m_root);
+            m_pool[m_root].color = RBColor::BLACK;
+            touch(m_root);
+        }
+    }
+
+    /// Journal a node for change tracking
+    void touch(NodeIndex i) {
+        if (m_trackChanges && i != NULL_NODE) m_changed.push_back(i);
+    }
+
+    /**
+     * @brief Replace every node with a balanced tree over sorted, unique values
+     *
+     * Old ids are journaled as changed so the change tracker sees them go.
+     */
+    void rebuild(const std::vector<T>& sorted) {
+        if (m_trackChanges) {
+            for (NodeIndex id = 0; id < m_pool.slotCount(); ++id) {
+                if (m_pool.isLive(id)) m_changed.push_back(id);
             }
-        } else if (newNode->data > root->data) {
-            if (root->right) {
-                return insertBST(root->right, newNode);
+        }
+
+        m_pool.clear();
+        m_events.clear();  // Ids in old events would alias new nodes
+        m_pool.reserve(sorted.size());
+        m_size = sorted.size();
+
+        // A midpoint split keeps every NIL at depth d or d + 1, where d is
+        // the depth of the last full level; nodes below it are RED
+        int fullDepth = 0;
+        while ((size_t(2) << fullDepth) - 1 <= sorted.size()) ++fullDepth;
+        m_root = buildSubtree(sorted, 0, sorted.size(), NULL_NODE, 0, fullDepth);
+    }
+
+    /**
+     * @brief Build sorted[lo, hi) as a balanced subtree (recursion depth is O(log n))
+     *
+     * @return Index of the subtree root (NULL_NODE for an empty range)
+     */
+    NodeIndex buildSubtree(const std::vector<T>& sorted, size_t lo, size_t hi,
+                           NodeIndex parent, int depth, int fullDepth) {
+        if (lo >= hi) return NULL_NODE;
+
+        size_t mid = lo + (hi - lo) / 2;
+        NodeIndex index = m_pool.allocate(sorted[mid], depth < fullDepth ? RBColor::BLACK : RBColor::RED);
+        touch(index);
+
+        NodeIndex left = buildSubtree(sorted, lo, mid, index, depth + 1, fullDepth);
+        NodeIndex right = buildSubtree(sorted, mid + 1, hi, index, depth + 1, fullDepth);
+
+        Node& node = m_pool[index];
+        node.parent = parent;
+        node.left = left;
+        node.right = right;
+        if constexpr (OrderStatistics) {
+            node.subtreeSize = static_cast<NodeIndex>(hi - lo);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Walk BST rules to find the parent for a new value
+     *
+     * @return Parent index, or NULL_NODE if the value is already present
+     */
+    NodeIndex insertBST(const T& value) const {
+        NodeIndex current = m_root;
+        while (true) {
+            const Node& node = m_pool[current];
+            NodeIndex next;
+            countComparisons();
+            if (value < node.data) {
+                next = node.left;
+            } else if (value > node.data) {
+                next = node.right;
             } else {
-                root->right = newNode;
-                return root;
+                return NULL_NODE;
+            }
+            if (next == NULL_NODE) {
+                return current;
             }
+            current = next;
+            countHops();
         }
-        // Duplicate value - don't insert
-        return root;
     }
 
     /**
@@ -322,71 +964,77 @@ private:
      *
      * @param node Newly inserted node (starts RED)
      */
-    void fixInsert(std::shared_ptr<RBTreeNode<T>> node) {
-        while (node != m_root && node->parent && node->parent->color == RBColor::RED) {
-            auto parent = node->parent;
-            auto grandparent = parent->parent;
+    void fixInsert(NodeIndex node) {
+        while (node != m_root && colorOf(parentOf(node)) == RBColor::RED) {
+            NodeIndex parent = parentOf(node);
+            NodeIndex grandparent = parentOf(parent);
 
-            if (!grandparent) break;
+            if (grandparent == NULL_NODE) break;
 
             // Parent is left child of grandparent
-            if (parent == grandparent->left) {
-                auto uncle = grandparent->right;
+            if (parent == leftOf(grandparent)) {
+                NodeIndex uncle = rightOf(grandparent);
 
                 // Case 1: Uncle is RED
-                if (uncle && uncle->color == RBColor::RED) {
-                    parent->color = RBColor::BLACK;
-                    uncle->color = RBColor::BLACK;
-                    grandparent->color = RBColor::RED;
+                if (colorOf(uncle) == RBColor::RED) {
+                    recordEvent(RBTreeEventType::Case1_UncleRed, node, parent, grandparent, uncle);
+                    setColor(parent, RBColor::BLACK);
+                    setColor(uncle, RBColor::BLACK);
+                    setColor(grandparent, RBColor::RED);
                     node = grandparent;  // Move up and continue
                 } else {
                     // Case 2: Node is right child (triangle case)
-                    if (node == parent->right) {
+                    if (node == rightOf(parent)) {
+                        recordEvent(RBTreeEventType::Case2_Triangle, node, parent, grandparent, uncle);
                         node = parent;
                         rotateLeft(node);
-                        parent = node->parent;
-                        if (!parent) break;
-                        grandparent = parent->parent;
-                        if (!grandparent) break;
+                        parent = parentOf(node);
+                        if (parent == NULL_NODE) break;
+                        grandparent = parentOf(parent);
+                        if (grandparent == NULL_NODE) break;
                     }
 
                     // Case 3: Node is left child (line case)
-                    parent->color = RBColor::BLACK;
-                    grandparent->color = RBColor::RED;
+                    recordEvent(RBTreeEventType::Case3_Line, node, parent, grandparent);
+                    setColor(parent, RBColor::BLACK);
+                    setColor(grandparent, RBColor::RED);
                     rotateRight(grandparent);
                 }
             }
             // Parent is right child of grandparent (mirror cases)
             else {
-                auto uncle = grandparent->left;
+                NodeIndex uncle = leftOf(grandparent);
 
                 // Case 1: Uncle is RED
-                if (uncle && uncle->color == RBColor::RED) {
-                    parent->color = RBColor::BLACK;
-                    uncle->color = RBColor::BLACK;
-                    grandparent->color = RBColor::RED;
+                if (colorOf(uncle) == RBColor::RED) {
+                    recordEvent(RBTreeEventType::Case1_UncleRed, node, parent, grandparent, uncle);
+                    setColor(parent, RBColor::BLACK);
+                    setColor(uncle, RBColor::BLACK);
+                    setColor(grandparent, RBColor::RED);
                     node = grandparent;
                 } else {
                     // Case 2: Node is left child (triangle case)
-                    if (node == parent->left) {
+                    if (node == leftOf(parent)) {
+                        recordEvent(RBTreeEventType::Case2_Triangle, node, parent, grandparent, uncle);
                         node = parent;
                         rotateRight(node);
-                        parent = node->parent;
-                        if (!parent) break;
-                        grandparent = parent->parent;
-                        if (!grandparent) break;
+                        parent = parentOf(node);
+                        if (parent == NULL_NODE) break;
+                        grandparent = parentOf(parent);
+                        if (grandparent == NULL_NODE) break;
                     }
 
                     // Case 3: Node is right child (line case)
-                    parent->color = RBColor::BLACK;
-                    grandparent->color = RBColor::RED;
+                    recordEvent(RBTreeEventType::Case3_Line, node, parent, grandparent);
+                    setColor(parent, RBColor::BLACK);
+                    setColor(grandparent, RBColor::RED);
                     rotateLeft(grandparent);
                 }
             }
         }
 
         // Ensure root is always black
-        m_root->color = RBColor::BLACK;
+        blackenRoot();
     }
 
     /**
@@ -398,26 +1046,39 @@ private:
      *      / \          / \
      *     b   c        a   b
      */
-    void rotateLeft(std::shared_ptr<RBTreeNode<T>> x) {
-        auto y = x->right;
-        if (!y) return;
-
-        x->right = y->left;
-        if (y->left) {
-            y->left->parent = x;
+    void rotateLeft(NodeIndex x) {
+        NodeIndex y = rightOf(x);
+        if (y == NULL_NODE) return;
+        recordEvent(RBTreeEventType::RotateLeft, x, y);
+        countRotations();
+
+        Node& xn = m_pool[x];
+        Node& yn = m_pool[y];
+
+        xn.right = yn.left;
+        if (yn.left != NULL_NODE) {
+            m_pool[yn.left].parent = x;
         }
 
-        y->parent = x->parent;
-        if (!x->parent) {
+        yn.parent = xn.parent;
+        if (xn.parent == NULL_NODE) {
             m_root = y;
-        } else if (x == x->parent->left) {
-            x->parent->left = y;
+        } else if (x == m_pool[xn.parent].left) {
+            m_pool[xn.parent].left = y;
         } else {
-            x->parent->right = y;
+            m_pool[xn.parent].right = y;
         }
 
-        y->left = x;
-        x->parent = y;
+        touch(yn.parent);
+        touch(x);
+        touch(y);
+        yn.left = x;
+        xn.parent = y;
+
+        if constexpr (OrderStatistics) {
+            yn.subtreeSize = xn.subtreeSize;  // y now spans x's old subtree
+            detail::refreshSubtreeSize(m_pool, x);
+        }
     }
 
     /**
@@ -429,223 +1090,263 @@ private:
      *    / \              / \
      *   a   b            b   c
      */
-    void rotateRight(std::shared_ptr<RBTreeNode<T>> y) {
-        auto x = y->left;
-        if (!x) return;
-
-        y->left = x->right;
-        if (x->right) {
-            x->right->parent = y;
+    void rotateRight(NodeIndex y) {
+        NodeIndex x = leftOf(y);
+        if (x == NULL_NODE) return;
+        recordEvent(RBTreeEventType::RotateRight, y, x);
+        countRotations();
+
+        Node& yn = m_pool[y];
+        Node& xn = m_pool[x];
+
+        yn.left = xn.right;
+        if (xn.right != NULL_NODE) {
+            m_pool[xn.right].parent = y;
         }
 
-        x->parent = y->parent;
-        if (!y->parent) {
+        xn.parent = yn.parent;
+        if (yn.parent == NULL_NODE) {
             m_root = x;
-        } else if (y == y->parent->left) {
-            y->parent->left = x;
+        } else if (y == m_pool[yn.parent].left) {
+            m_pool[yn.parent].left = x;
         } else {
-            y->parent->right = x;
+            m_pool[yn.parent].right = x;
         }
 
-        x->right = y;
-        y->parent = x;
+        touch(xn.parent);
+        touch(x);
+        touch(y);
+        xn.right = y;
+        yn.parent = x;
+
+        if constexpr (OrderStatistics) {
+            xn.subtreeSize = yn.subtreeSize;  // x now spans y's old subtree
+            detail::refreshSubtreeSize(m_pool, y);
+        }
     }
 
     /**
      * @brief Delete a node from the tree (RB tree deletion)
+     *
+     * Unlinks z; the caller releases its slot back to the pool.
      */
-    void deleteNode(std::shared_ptr<RBTreeNode<T>> z) {
-        if (!z) return;
+    void deleteNode(NodeIndex z) {
+        if (z == NULL_NODE) return;
 
-        std::shared_ptr<RBTreeNode<T>> y = z;
-        std::shared_ptr<RBTreeNode<T>> x = nullptr;
-        RBColor yOriginalColor = y->color;
+        NodeIndex y = z;
+        NodeIndex x = NULL_NODE;
+        NodeIndex xParent = NULL_NODE;  // Tracked explicitly since x may be NIL
+        RBColor yOriginalColor = colorOf(y);
 
-        if (!z->left) {
+        if (leftOf(z) == NULL_NODE) {
             // Case 1: No left child
-            x = z->right;
-            transplant(z, z->right);
-        } else if (!z->right) {
+            x = rightOf(z);
+            xParent = parentOf(z);
+            adjustSubtreeSizes(xParent, -1);
+            transplant(z, rightOf(z));
+        } else if (rightOf(z) == NULL_NODE) {
             // Case 2: No right child
-            x = z->left;
-            transplant(z, z->left);
+            x = leftOf(z);
+            xParent = parentOf(z);
+            adjustSubtreeSizes(xParent, -1);
+            transplant(z, leftOf(z));
         } else {
             // Case 3: Two children - find successor
-            y = findMin(z->right);
-            yOriginalColor = y->color;
-            x = y->right;
-
-            if (y->parent == z) {
-                if (x) x->parent = y;
+            y = findMin(rightOf(z));
+            yOriginalColor = colorOf(y);
+            x = rightOf(y);
+            adjustSubtreeSizes(parentOf(y), -1);  // y's old ancestors, z included, lose one node
+
+            if (parentOf(y) == z) {
+                xParent = y;
+                if (x != NULL_NODE) m_pool[x].parent = y;
             } else {
-                transplant(y, y->right);
-                y->right = z->right;
-                if (y->right) y->right->parent = y;
+                xParent = parentOf(y);
+                transplant(y, rightOf(y));
+                m_pool[y].right = rightOf(z);
+                if (rightOf(y) != NULL_NODE) m_pool[rightOf(y)].parent = y;
+                touch(y);
             }
 
             transplant(z, y);
-            y->left = z->left;
-            if (y->left) y->left->parent = y;
-            y->color = z->color;
+            m_pool[y].left = leftOf(z);
+            if (leftOf(y) != NULL_NODE) m_pool[leftOf(y)].parent = y;
+            m_pool[y].color = colorOf(z);
+            if constexpr (OrderStatistics) {
+                m_pool[y].subtreeSize = m_pool[z].subtreeSize;
+            }
+            touch(y);
         }
 
         // If we deleted a BLACK node, we need to fix violations
-        if (yOriginalColor == RBColor::BLACK && x) {
-            fixDelete(x);
+        if (yOriginalColor == RBColor::BLACK) {
+            fixDelete(x, xParent);
         }
-        
+
         // Ensure root is BLACK
-        if (m_root) {
-            m_root->color = RBColor::BLACK;
-        }
+        blackenRoot();
     }
 
     /**
      * @brief Replace subtree rooted at u with subtree rooted at v
      */
-    void transplant(std::shared_ptr<RBTreeNode<T>> u, std::shared_ptr<RBTreeNode<T>> v) {
-        if (!u->parent) {
+    void transplant(NodeIndex u, NodeIndex v) {
+        NodeIndex up = parentOf(u);
+        if (up == NULL_NODE) {
             m_root = v;
-        } else if (u == u->parent->left) {
-            u->parent->left = v;
+        } else if (u == leftOf(up)) {
+            m_pool[up].left = v;
         } else {
-            u->parent->right = v;
+            m_pool[up].right = v;
         }
 
-        if (v) {
-            v->parent = u->parent;
+        if (v != NULL_NODE) {
+            m_pool[v].parent = up;
         }
+
+        touch(up);
+        touch(v);
     }
 
     /**
      * @brief Fix RB tree properties after deletion
+     *
+     * @param x Node carrying the extra black (may be NIL)
+     * @param xParent Parent of x (needed when x is NIL)
      */
-    void fixDelete(std::shared_ptr<RBTreeNode<T>> x) {
-        while (x != m_root && x && x->color == RBColor::BLACK) {
-            if (x == x->parent->left) {
-                auto w = x->parent->right;  // Sibling
+    void fixDelete(NodeIndex x, NodeIndex xParent) {
+        while (x != m_root && colorOf(x) == RBColor::BLACK) {
+            if (x == leftOf(xParent)) {
+                NodeIndex w = rightOf(xParent);  // Sibling
 
-                if (w && w->color == RBColor::RED) {
+                if (colorOf(w) == RBColor::RED) {
                     // Case 1: Sibling is RED
-                    w->color = RBColor::BLACK;
-                    x->parent->color = RBColor::RED;
-                    rotateLeft(x->parent);
-                    w = x->parent->right;
+                    recordFixup(1, x, xParent, w);
+                    setColor(w, RBColor::BLACK);
+                    setColor(xParent, RBColor::RED);
+                    rotateLeft(xParent);
+                    w = rightOf(xParent);
                 }
 
-                if (w && (!w->left || w->left->color == RBColor::BLACK) &&
-                    (!w->right || w->right->color == RBColor::BLACK)) {
+                if (colorOf(leftOf(w)) == RBColor::BLACK && colorOf(rightOf(w)) == RBColor::BLACK) {
                     // Case 2: Sibling is BLACK, both children BLACK
-                    w->color = RBColor::RED;
-                    x = x->parent;
+                    recordFixup(2, x, xParent, w);
+                    setColor(w, RBColor::RED);
+                    x = xParent;
+                    xParent = parentOf(x);
                 } else {
-                    if (w && (!w->right || w->right->color == RBColor::BLACK)) {
+                    if (colorOf(rightOf(w)) == RBColor::BLACK) {
                         // Case 3: Sibling BLACK, left child RED, right child BLACK
-                        if (w->left) w->left->color = RBColor::BLACK;
-                        w->color = RBColor::RED;
+                        recordFixup(3, x, xParent, w);
+                        setColor(leftOf(w), RBColor::BLACK);
+                        setColor(w, RBColor::RED);
                         rotateRight(w);
-                        w = x->parent->right;
+                        w = rightOf(xParent);
                     }
 
                     // Case 4: Sibling BLACK, right child RED
-                    if (w) {
-                        w->color = x->parent->color;
-                        x->parent->color = RBColor::BLACK;
-                        if (w->right) w->right->color = RBColor::BLACK;
-                        rotateLeft(x->parent);
-                    }
+                    recordFixup(4, x, xParent, w);
+                    setColor(w, colorOf(xParent));
+                    setColor(xParent, RBColor::BLACK);
+                    setColor(rightOf(w), RBColor::BLACK);
+                    rotateLeft(xParent);
                     x = m_root;
+                    xParent = NULL_NODE;
                 }
             } else {
                 // Mirror cases (x is right child)
-                auto w = x->parent->left;
-
-                if (w && w->color == RBColor::RED) {
-                    w->color = RBColor::BLACK;
-                    x->parent->color = RBColor::RED;
-                    rotateRight(x->parent);
-                    w = x->parent->left;
+                NodeIndex w = leftOf(xParent);
+
+                if (colorOf(w) == RBColor::RED) {
+                    recordFixup(1, x, xParent, w);
+                    setColor(w, RBColor::BLACK);
+                    setColor(xParent, RBColor::RED);
+                    rotateRight(xParent);
+                    w = leftOf(xParent);
                 }
 
-                if (w && (!w->right || w->right->color == RBColor::BLACK) &&
-                    (!w->left || w->left->color == RBColor::BLACK)) {
-                    w->color = RBColor::RED;
-                    x = x->parent;
+                if (colorOf(rightOf(w)) == RBColor::BLACK && colorOf(leftOf(w)) == RBColor::BLACK) {
+                    recordFixup(2, x, xParent, w);
+                    setColor(w, RBColor::RED);
+                    x = xParent;
+                    xParent = parentOf(x);
                 } else {
-                    if (w && (!w->left || w->left->color == RBColor::BLACK)) {
-                        if (w->right) w->right->color = RBColor::BLACK;
-                        w->color = RBColor::RED;
+                    if (colorOf(leftOf(w)) == RBColor::BLACK) {
+                        recordFixup(3, x, xParent, w);
+                        setColor(rightOf(w), RBColor::BLACK);
+                        setColor(w, RBColor::RED);
                         rotateLeft(w);
-                        w = x->parent->left;
+                        w = leftOf(xParent);
                     }
 
-                    if (w) {
-                        w->color = x->parent->color;
-                        x->parent->color = RBColor::BLACK;
-                        if (w->left) w->left->color = RBColor::BLACK;
-                        rotateRight(x->parent);
-                    }
+                    recordFixup(4, x, xParent, w);
+                    setColor(w, colorOf(xParent));
+                    setColor(xParent, RBColor::BLACK);
+                    setColor(leftOf(w), RBColor::BLACK);
+                    rotateRight(xParent);
                     x = m_root;
+                    xParent = NULL_NODE;
                 }
             }
         }
 
-        if (x) {
-            x->color = RBColor::BLACK;
-        }
+        setColor(x, RBColor::BLACK);
     }
 
     /**
      * @brief Find minimum node in subtree
      */
-    std::shared_ptr<RBTreeNode<T>> findMin(std::shared_ptr<RBTreeNode<T>> node) const {
-        while (node && node->left) {
-            node = node->left;
+    NodeIndex findMin(NodeIndex node) const {
+        while (leftOf(node) != NULL_NODE) {
+            node = leftOf(node);
+            countHops();
         }
         return node;
     }
 
     /**
-     * @brief Search for a value recursively
+     * @brief Search for a value (iterative descent)
      */
-    std::shared_ptr<RBTreeNode<T>> searchRecursive(std::shared_ptr<RBTreeNode<T>> node, const T& value) const {
-        if (!node || node->data == value) {
-            return node;
-        }
-
-        if (value < node->data) {
-            return searchRecursive(node->left, value);
-        } else {
-            return searchRecursive(node->right, value);
+    NodeIndex searchIndex(const T& value) const {
+        NodeIndex current = m_root;
+        while (current != NULL_NODE) {
+            const Node& node = m_pool[current];
+            countComparisons();
+            if (node.data == value) {
+                break;
+            }
+            current = (value < node.data) ? node.left : node.right;
+            countHops();
         }
+        return current;
     }
 
     /**
-     * @brief Inorder traversal helper
+     * @brief Take a node from the pool and copy or move the value into it
      */
-    void inorderRecursive(std::shared_ptr<RBTreeNode<T>> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        inorderRecursive(node->left, func);
-        func(node->data);
-        inorderRecursive(node->right, func);
+    template<typename V>
+    NodeIndex allocateNode(V&& value, RBColor color) {
+        countAllocations();
+        countMoves();
+        return m_pool.allocate(std::forward<V>(value), color);
     }
 
     /**
      * @brief Height calculation helper
      */
-    int heightRecursive(std::shared_ptr<RBTreeNode<T>> node) const {
-        if (!node) return -1;
-        return 1 + std::max(heightRecursive(node->left), heightRecursive(node->right));
+    int heightRecursive(NodeIndex node) const {
+        if (node == NULL_NODE) return -1;
+        return 1 + std::max(heightRecursive(m_pool[node].left), heightRecursive(m_pool[node].right));
     }
 
     /**
      * @brief Black height calculation helper
      */
-    int blackHeightRecursive(std::shared_ptr<RBTreeNode<T>> node) const {
-        if (!node) return 1;  // NIL nodes are black
+    int blackHeightRecursive(NodeIndex node) const {
+        if (node == NULL_NODE) return 1;  // NIL nodes are black
 
-        int leftBH = blackHeightRecursive(node->left);
-        int blackIncrement = (node->color == RBColor::BLACK) ? 1 : 0;
+        int leftBH = blackHeightRecursive(m_pool[node].left);
+        int blackIncrement = (m_pool[node].color == RBColor::BLACK) ? 1 : 0;
 
         return leftBH + blackIncrement;
     }
@@ -653,8 +1354,8 @@ private:
     /**
      * @brief Verify RB tree properties recursively
      */
-    bool verifyPropertiesRecursive(std::shared_ptr<RBTreeNode<T>> node, int blackCount, int& pathBlackHeight) const {
-        if (!node) {
+    bool verifyPropertiesRecursive(NodeIndex node, int blackCount, int& pathBlackHeight) const {
+        if (node == NULL_NODE) {
             // Reached NIL node
             if (pathBlackHeight == -1) {
                 pathBlackHeight = blackCount;
@@ -663,35 +1364,83 @@ private:
             return pathBlackHeight == blackCount;
         }
 
+        const Node& n = m_pool[node];
+
         // Property 4: RED node must have BLACK children
-        if (node->color == RBColor::RED) {
-            if ((node->left && node->left->color == RBColor::RED) ||
-                (node->right && node->right->color == RBColor::RED)) {
+        if (n.color == RBColor::RED) {
+            if (colorOf(n.left) == RBColor::RED || colorOf(n.right) == RBColor::RED) {
                 return false;
             }
         }
 
-        int newBlackCount = blackCount + (node->color == RBColor::BLACK ? 1 : 0);
+        int newBlackCount = blackCount + (n.color == RBColor::BLACK ? 1 : 0);
+
+        return verifyPropertiesRecursive(n.left, newBlackCount, pathBlackHeight) &&
+               verifyPropertiesRecursive(n.right, newBlackCount, pathBlackHeight);
+    }
+
+    /**
+     * @brief Check stored subtree sizes against the actual node counts
+     *
+     * @return Actual size of the subtree
+     */
+    size_t verifySubtreeSizes(NodeIndex node, bool& ok) const {
+        if (node == NULL_NODE) return 0;
+        size_t count = 1 + verifySubtreeSizes(m_pool[node].left, ok)
+                         + verifySubtreeSizes(m_pool[node].right, ok);
+        if (m_pool[node].subtreeSize != count) ok = false;
+        return count;
+    }
 
-        return verifyPropertiesRecursive(node->left, newBlackCount, pathBlackHeight) &&
-               verifyPropertiesRecursive(node->right, newBlackCount, pathBlackHeight);
+    // ===== Event recording (plain records, no formatting) =====
+
+    RBTreeEvent<T> makeEvent(RBTreeEventType type, NodeIndex node, NodeIndex parent = NULL_NODE,
+                             NodeIndex grandparent = NULL_NODE, NodeIndex uncle = NULL_NODE) const {
+        RBTreeEvent<T> event;
+        event.type = type;
+        event.node = node;
+        event.parent = parent;
+        event.grandparent = grandparent;
+        event.uncle = uncle;
+        if (node != NULL_NODE) event.value = m_pool[node].data;
+        if (parent != NULL_NODE) event.parentValue = m_pool[parent].data;
+        if (grandparent != NULL_NODE) event.grandparentValue = m_pool[grandparent].data;
+        if (uncle != NULL_NODE) event.uncleValue = m_pool[uncle].data;
+        return event;
     }
 
     /**
      * @brief Record an event if recording is enabled
      */
-    void recordEvent(RBTreeEvent<T> event) {
+    void recordEvent(RBTreeEventType type, NodeIndex node, NodeIndex parent = NULL_NODE,
+                     NodeIndex grandparent = NULL_NODE, NodeIndex uncle = NULL_NODE) {
         if (m_recordEvents) {
-            m_events.push_back(std::move(event));
+            m_events.push(makeEvent(type, node, parent, grandparent, uncle));
         }
     }
 
-    std::shared_ptr<RBTreeNode<T>> m_root = nullptr;  ///< Root of the tree
+    /**
+     * @brief Record a deletion fixup case (x may be NIL)
+     */
+    void recordFixup(std::uint8_t fixupCase, NodeIndex x, NodeIndex xParent, NodeIndex sibling) {
+        if (m_recordEvents) {
+            RBTreeEvent<T> event = makeEvent(RBTreeEventType::DeleteFixup, x, xParent, NULL_NODE, sibling);
+            event.fixupCase = fixupCase;
+            m_events.push(event);
+        }
+    }
+
+    NodePool<Node> m_pool;                   ///< Node storage
+    NodeIndex m_root = NULL_NODE;                     ///< Root of the tree
     size_t m_size = 0;                                ///< Number of nodes
 
     // Event recording for visualization
     bool m_recordEvents = false;                      ///< Enable/disable event recording
-    std::vector<RBTreeEvent<T>> m_events;             ///< Recorded events
+    RingBuffer<RBTreeEvent<T>> m_events;              ///< Most recent events (overwrites oldest)
+
+    // Change journal for incremental layout
+    bool m_trackChanges = false;                      ///< Enable/disable change tracking
+    std::vector<NodeIndex> m_changed;                 ///< Ids of changed nodes
 };
 
 } // namespace dsav
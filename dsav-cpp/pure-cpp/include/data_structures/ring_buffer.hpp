@@ -0,0 +1,109 @@
+/**
+ * @file ring_buffer.hpp
+ * @brief Fixed-capacity ring buffer that overwrites its oldest entries
+ *
+ * Used for event logs recorded on hot paths: storage is allocated once,
+ * push() is a copy into a slot and an index increment, and when the log is
+ * full the oldest record is dropped instead of growing.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace dsav {
+
+/**
+ * @brief Overwriting ring buffer of trivially copyable records
+ *
+ * Template parameter:
+ * - T: Record type (must be trivially copyable)
+ *
+ * Every record gets a monotonically increasing sequence number, so readers
+ * can track what they have already consumed across pushes and drops.
+ */
+template<typename T>
+class RingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "RingBuffer records must be trivially copyable");
+
+public:
+    /**
+     * @brief Construct a buffer holding up to capacity records (rounded up to a power of two)
+     */
+    explicit RingBuffer(size_t capacity = 0) {
+        setCapacity(capacity);
+    }
+
+    /**
+     * @brief Reallocate storage and drop every record
+     *
+     * @param capacity Maximum number of records kept (rounded up to a power of two)
+     */
+    void setCapacity(size_t capacity) {
+        size_t rounded = capacity ? 1 : 0;
+        while (rounded < capacity) rounded <<= 1;
+
+        m_slots.assign(rounded, T{});
+        m_mask = rounded ? rounded - 1 : 0;
+        clear();
+    }
+
+    /**
+     * @brief Append a record, overwriting the oldest one when full
+     */
+    void push(const T& record) {
+        if (m_slots.empty()) return;
+
+        m_slots[static_cast<size_t>(m_end) & m_mask] = record;
+        ++m_end;
+        if (m_end - m_begin > m_slots.size()) {
+            ++m_begin;
+        }
+    }
+
+    /**
+     * @brief Drop every record (sequence numbers keep counting)
+     */
+    void clear() {
+        m_begin = m_end;
+    }
+
+    /**
+     * @brief Record i, counting from the oldest kept record
+     */
+    const T& operator[](size_t i) const {
+        return m_slots[static_cast<size_t>(m_begin + i) & m_mask];
+    }
+
+    /**
+     * @brief Newest record (buffer must not be empty)
+     */
+    const T& back() const {
+        return m_slots[static_cast<size_t>(m_end - 1) & m_mask];
+    }
+
+    size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+    size_t capacity() const { return m_slots.size(); }
+    bool empty() const { return m_end == m_begin; }
+
+    /**
+     * @brief Sequence number of the oldest kept record
+     */
+    std::uint64_t beginSequence() const { return m_begin; }
+
+    /**
+     * @brief Sequence number the next push will receive
+     */
+    std::uint64_t endSequence() const { return m_end; }
+
+private:
+    std::vector<T> m_slots;            ///< Storage (power-of-two size)
+    size_t m_mask = 0;                 ///< m_slots.size() - 1
+    std::uint64_t m_begin = 0;         ///< Sequence of the oldest record
+    std::uint64_t m_end = 0;           ///< Sequence of the next record
+};
+
+} // namespace dsav
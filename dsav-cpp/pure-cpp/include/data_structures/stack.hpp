@@ -4,13 +4,19 @@
  *
  * A template-based stack (LIFO - Last In First Out) with fixed maximum capacity.
  * Provides standard stack operations: push, pop, peek, isEmpty, isFull.
+ * Stack<T, DYNAMIC_CAPACITY> is a growable variant with the same interface.
  */
 
 #pragma once
 
+#include "capacity_event.hpp"
+#include "op_counters.hpp"
+#include <algorithm>
 #include <array>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <utility>
 #include <cstddef>
 
 namespace dsav {
@@ -23,10 +29,11 @@ namespace dsav {
  * - MaxSize: Maximum number of elements (default 16)
  *
  * The stack uses a fixed-size array internally, making it suitable for
- * visualization where we want predictable bounds.
+ * visualization where we want predictable bounds. Use MaxSize =
+ * DYNAMIC_CAPACITY for a stack that grows instead of filling up.
  */
 template<typename T, size_t MaxSize = 16>
-class Stack {
+class Stack : public OpCounted {
 public:
     /**
      * @brief Construct an empty stack
@@ -44,11 +51,41 @@ public:
             return false;
         }
         m_data[++m_top] = value;
+        countMoves();
         return true;
     }
 
     /**
-     * @brief Pop an element from the stack
+     * @brief Move an element onto the stack
+     *
+     * @param value Value to move in
+     * @return true if successful, false if stack is full
+     */
+    bool push(T&& value) {
+        if (isFull()) {
+            return false;
+        }
+        m_data[++m_top] = std::move(value);
+        countMoves();
+        return true;
+    }
+
+    /**
+     * @brief Construct an element on top of the stack
+     *
+     * The slots of a fixed stack always hold a T, so the new value is
+     * built and then move-assigned into its slot.
+     *
+     * @param args Constructor arguments of T
+     * @return true if successful, false if stack is full
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        return push(T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Pop an element from the stack (moved out, not copied)
      *
      * @return The popped value if successful, std::nullopt if stack is empty
      */
@@ -56,7 +93,8 @@ public:
         if (isEmpty()) {
             return std::nullopt;
         }
-        return m_data[m_top--];
+        countMoves();
+        return std::move(m_data[m_top--]);
     }
 
     /**
@@ -156,4 +194,247 @@ private:
     int m_top = -1;                   ///< Index of top element (-1 when empty)
 };
 
+/**
+ * @brief Growable stack data structure
+ *
+ * Selected with MaxSize = DYNAMIC_CAPACITY. The buffer doubles when a push
+ * finds it full and halves once a pop leaves it a quarter full, so pushes
+ * cost amortized O(1) and a push/pop pair at a size boundary can never
+ * reallocate twice in a row. Capacity never drops below MIN_CAPACITY.
+ *
+ * Every reallocation is counted and, with event recording on, logged as a
+ * Grow or Shrink CapacityEvent for visualizers to animate.
+ */
+template<typename T>
+class Stack<T, DYNAMIC_CAPACITY> : public CapacityEventLog, public OpCounted {
+public:
+    static constexpr size_t MIN_CAPACITY = 16;      ///< Smallest buffer ever allocated
+    static constexpr size_t GROWTH_FACTOR = 2;      ///< Capacity multiplier when full
+    static constexpr size_t SHRINK_DIVISOR = 4;     ///< Halve once size <= capacity / SHRINK_DIVISOR
+
+    /**
+     * @brief Construct an empty stack
+     *
+     * @param initialCapacity Slots allocated up front (at least MIN_CAPACITY)
+     */
+    explicit Stack(size_t initialCapacity = MIN_CAPACITY)
+        : m_capacity(std::max(initialCapacity, MIN_CAPACITY)) {
+        m_data = std::make_unique<T[]>(m_capacity);
+    }
+
+    Stack(const Stack& other)
+        : CapacityEventLog(other), OpCounted(other), m_capacity(other.m_capacity), m_size(other.m_size),
+          m_reallocations(other.m_reallocations) {
+        m_data = std::make_unique<T[]>(m_capacity);
+        std::copy(other.m_data.get(), other.m_data.get() + m_size, m_data.get());
+    }
+
+    Stack& operator=(const Stack& other) {
+        if (this != &other) {
+            Stack copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    Stack(Stack&&) noexcept = default;
+    Stack& operator=(Stack&&) noexcept = default;
+
+    /**
+     * @brief Push an element onto the stack, growing the buffer if it is full
+     *
+     * @param value Value to push
+     * @return Always true (kept for interface parity with the fixed stack)
+     */
+    bool push(const T& value) {
+        return emplace(value);
+    }
+
+    /**
+     * @brief Move an element onto the stack, growing the buffer if it is full
+     *
+     * @param value Value to move in
+     * @return Always true
+     */
+    bool push(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * @brief Construct an element on top of the stack, growing the buffer if it is full
+     *
+     * The value is built before the buffer moves, so arguments referring to
+     * elements of this stack stay valid.
+     *
+     * @param args Constructor arguments of T
+     * @return Always true
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        if (m_size == m_capacity) {
+            reallocate(m_capacity * GROWTH_FACTOR, CapacityEventType::Grow);
+        }
+        m_data[m_size++] = std::move(value);
+        countMoves();
+        return true;
+    }
+
+    /**
+     * @brief Pop an element (moved out), shrinking the buffer once it is mostly empty
+     *
+     * @return The popped value if successful, std::nullopt if stack is empty
+     */
+    std::optional<T> pop() {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        T value = std::move(m_data[--m_size]);
+        countMoves();
+        if (m_capacity > MIN_CAPACITY && m_size <= m_capacity / SHRINK_DIVISOR) {
+            reallocate(std::max(m_capacity / GROWTH_FACTOR, MIN_CAPACITY), CapacityEventType::Shrink);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Peek at the top element without removing it
+     *
+     * @return The top value if stack is not empty, std::nullopt otherwise
+     */
+    std::optional<T> peek() const {
+        if (isEmpty()) {
+            return std::nullopt;
+        }
+        return m_data[m_size - 1];
+    }
+
+    /**
+     * @brief Check if the stack is empty
+     */
+    bool isEmpty() const {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Check if the stack is full (never: it grows instead)
+     */
+    constexpr bool isFull() const {
+        return false;
+    }
+
+    /**
+     * @brief Get current number of elements
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Get the number of allocated slots
+     */
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Get the number of buffer reallocations so far
+     */
+    size_t reallocations() const {
+        return m_reallocations;
+    }
+
+    /**
+     * @brief Grow the buffer to hold at least count elements without reallocating
+     */
+    void reserve(size_t count) {
+        if (count > m_capacity) {
+            reallocate(count, CapacityEventType::Grow);
+        }
+    }
+
+    /**
+     * @brief Shrink the buffer to the current size (never below MIN_CAPACITY)
+     */
+    void shrinkToFit() {
+        size_t target = std::max(m_size, MIN_CAPACITY);
+        if (target < m_capacity) {
+            reallocate(target, CapacityEventType::Shrink);
+        }
+    }
+
+    /**
+     * @brief Clear all elements
+     *
+     * Keeps the current buffer; call shrinkToFit() to release it.
+     */
+    void clear() {
+        m_size = 0;
+    }
+
+    /**
+     * @brief Replace the contents with count elements, bottom first
+     *
+     * Grows the buffer once, if at all, for restoring a saved stack in bulk.
+     */
+    void assign(const T* first, size_t count) {
+        m_size = 0;
+        reserve(count);
+        std::copy(first, first + count, m_data.get());
+        countMoves(count);
+        m_size = count;
+    }
+
+    /**
+     * @brief Get direct access to internal data (for visualization)
+     *
+     * The pointer is invalidated by any push or pop that reallocates.
+     *
+     * @return Const pointer to internal data array
+     */
+    const T* data() const {
+        return m_data.get();
+    }
+
+    /**
+     * @brief Get the current top index (for visualization)
+     *
+     * @return Index of the top element (-1 if empty)
+     */
+    int topIndex() const {
+        return static_cast<int>(m_size) - 1;
+    }
+
+    /**
+     * @brief Get element at a specific index (for visualization)
+     *
+     * @param index Index to access (must be < size())
+     * @return Element at the given index
+     * @throws std::out_of_range if index is invalid
+     */
+    const T& at(size_t index) const {
+        if (index >= m_size) {
+            throw std::out_of_range("Stack index out of range");
+        }
+        return m_data[index];
+    }
+
+private:
+    void reallocate(size_t newCapacity, CapacityEventType type) {
+        auto data = std::make_unique<T[]>(newCapacity);
+        std::move(m_data.get(), m_data.get() + m_size, data.get());
+        countAllocations();
+        countMoves(m_size);
+        recordEvent(type, m_size, m_capacity, newCapacity);
+        m_data = std::move(data);
+        m_capacity = newCapacity;
+        m_reallocations++;
+    }
+
+    std::unique_ptr<T[]> m_data;      ///< Current buffer
+    size_t m_capacity = 0;            ///< Slots in m_data
+    size_t m_size = 0;                ///< Elements stored
+    size_t m_reallocations = 0;       ///< Grow and shrink moves so far
+};
+
 } // namespace dsav
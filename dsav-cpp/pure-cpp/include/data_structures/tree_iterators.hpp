@@ -0,0 +1,260 @@
+/**
+ * @file tree_iterators.hpp
+ * @brief Non-recursive traversal iterators for pooled binary trees
+ *
+ * Works with any pooled node type exposing data, left, right and parent
+ * links (TreeNode, RBTreeNode). Depth-first orders walk parent links and
+ * keep O(1) state, so they never allocate and never recurse; level-order
+ * keeps its frontier in a ring buffer sized once from the tree size.
+ */
+
+#pragma once
+
+#include "node_pool.hpp"
+#include <vector>
+#include <iterator>
+#include <cstddef>
+
+namespace dsav {
+
+/**
+ * @brief Depth-first visiting order
+ */
+enum class TraversalOrder {
+    Inorder,    // Left-Root-Right
+    Preorder,   // Root-Left-Right
+    Postorder   // Left-Right-Root
+};
+
+namespace detail {
+
+/// Leftmost node of a subtree (first in inorder)
+template<typename Node>
+NodeIndex leftmost(const NodePool<Node>& pool, NodeIndex index) {
+    while (pool[index].left != NULL_NODE) {
+        index = pool[index].left;
+    }
+    return index;
+}
+
+/// First node of a subtree in postorder (deepest node, preferring left)
+template<typename Node>
+NodeIndex firstPostorder(const NodePool<Node>& pool, NodeIndex index) {
+    while (true) {
+        const Node& node = pool[index];
+        if (node.left != NULL_NODE) {
+            index = node.left;
+        } else if (node.right != NULL_NODE) {
+            index = node.right;
+        } else {
+            return index;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Forward iterator for inorder/preorder/postorder traversal
+ *
+ * @tparam Node Pooled node type
+ * @tparam Order Visiting order
+ */
+template<typename Node, TraversalOrder Order>
+class DepthFirstIterator {
+public:
+    using value_type = typename Node::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    DepthFirstIterator() = default;
+
+    DepthFirstIterator(const NodePool<Node>* pool, NodeIndex root)
+        : m_pool(pool), m_current(first(root)) {}
+
+    reference operator*() const { return (*m_pool)[m_current].data; }
+    pointer operator->() const { return &(*m_pool)[m_current].data; }
+
+    /**
+     * @brief Handle to the current node (for node ids / colors)
+     */
+    NodeHandle<Node> handle() const { return NodeHandle<Node>(m_pool, m_current); }
+
+    DepthFirstIterator& operator++() {
+        m_current = advance(m_current);
+        return *this;
+    }
+
+    DepthFirstIterator operator++(int) {
+        DepthFirstIterator previous = *this;
+        ++(*this);
+        return previous;
+    }
+
+    bool operator==(const DepthFirstIterator& other) const { return m_current == other.m_current; }
+    bool operator!=(const DepthFirstIterator& other) const { return m_current != other.m_current; }
+
+private:
+    NodeIndex first(NodeIndex root) const {
+        if (root == NULL_NODE) return NULL_NODE;
+        if constexpr (Order == TraversalOrder::Inorder) {
+            return detail::leftmost(*m_pool, root);
+        } else if constexpr (Order == TraversalOrder::Preorder) {
+            return root;
+        } else {
+            return detail::firstPostorder(*m_pool, root);
+        }
+    }
+
+    NodeIndex advance(NodeIndex index) const {
+        const NodePool<Node>& pool = *m_pool;
+
+        if constexpr (Order == TraversalOrder::Inorder) {
+            if (pool[index].right != NULL_NODE) {
+                return detail::leftmost(pool, pool[index].right);
+            }
+            // Climb until we arrive from a left child
+            NodeIndex parent = pool[index].parent;
+            while (parent != NULL_NODE && index == pool[parent].right) {
+                index = parent;
+                parent = pool[index].parent;
+            }
+            return parent;
+        } else if constexpr (Order == TraversalOrder::Preorder) {
+            if (pool[index].left != NULL_NODE) return pool[index].left;
+            if (pool[index].right != NULL_NODE) return pool[index].right;
+            // Climb to the nearest ancestor with an unvisited right subtree
+            NodeIndex parent = pool[index].parent;
+            while (parent != NULL_NODE) {
+                if (index == pool[parent].left && pool[parent].right != NULL_NODE) {
+                    return pool[parent].right;
+                }
+                index = parent;
+                parent = pool[index].parent;
+            }
+            return NULL_NODE;
+        } else {
+            NodeIndex parent = pool[index].parent;
+            if (parent == NULL_NODE) return NULL_NODE;
+            if (index == pool[parent].left && pool[parent].right != NULL_NODE) {
+                return detail::firstPostorder(pool, pool[parent].right);
+            }
+            return parent;
+        }
+    }
+
+    const NodePool<Node>* m_pool = nullptr;  ///< Owning pool
+    NodeIndex m_current = NULL_NODE;         ///< Current node (NULL_NODE = end)
+};
+
+/**
+ * @brief Range adaptor so depth-first traversals work with range-for
+ */
+template<typename Node, TraversalOrder Order>
+class DepthFirstRange {
+public:
+    using iterator = DepthFirstIterator<Node, Order>;
+
+    DepthFirstRange(const NodePool<Node>* pool, NodeIndex root)
+        : m_pool(pool), m_root(root) {}
+
+    iterator begin() const { return iterator(m_pool, m_root); }
+    iterator end() const { return iterator(); }
+
+private:
+    const NodePool<Node>* m_pool;
+    NodeIndex m_root;
+};
+
+/**
+ * @brief Input iterator for level-order (breadth-first) traversal
+ *
+ * The frontier lives in a power-of-two ring buffer allocated once when the
+ * traversal starts; advancing never allocates.
+ *
+ * @tparam Node Pooled node type
+ */
+template<typename Node>
+class LevelOrderIterator {
+public:
+    using value_type = typename Node::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    LevelOrderIterator() = default;
+
+    LevelOrderIterator(const NodePool<Node>* pool, NodeIndex root, size_t nodeCount)
+        : m_pool(pool) {
+        if (root == NULL_NODE) return;
+
+        // The frontier never holds more than every node at once
+        size_t capacity = 1;
+        while (capacity < nodeCount + 1) capacity <<= 1;
+        m_ring.resize(capacity);
+        m_mask = capacity - 1;
+
+        push(root);
+    }
+
+    reference operator*() const { return (*m_pool)[front()].data; }
+    pointer operator->() const { return &(*m_pool)[front()].data; }
+
+    /**
+     * @brief Handle to the current node (for node ids / colors)
+     */
+    NodeHandle<Node> handle() const { return NodeHandle<Node>(m_pool, front()); }
+
+    LevelOrderIterator& operator++() {
+        const Node& node = (*m_pool)[front()];
+        m_head = (m_head + 1) & m_mask;
+        m_count--;
+
+        if (node.left != NULL_NODE) push(node.left);
+        if (node.right != NULL_NODE) push(node.right);
+        return *this;
+    }
+
+    /// Iterators compare equal only when both are exhausted
+    bool operator==(const LevelOrderIterator& other) const { return m_count == 0 && other.m_count == 0; }
+    bool operator!=(const LevelOrderIterator& other) const { return !(*this == other); }
+
+private:
+    NodeIndex front() const { return m_ring[m_head]; }
+
+    void push(NodeIndex index) {
+        m_ring[(m_head + m_count) & m_mask] = index;
+        m_count++;
+    }
+
+    const NodePool<Node>* m_pool = nullptr;  ///< Owning pool
+    std::vector<NodeIndex> m_ring;           ///< Frontier ring buffer
+    size_t m_mask = 0;                       ///< Ring capacity - 1
+    size_t m_head = 0;                       ///< Ring read position
+    size_t m_count = 0;                      ///< Nodes currently queued
+};
+
+/**
+ * @brief Range adaptor so level-order traversal works with range-for
+ */
+template<typename Node>
+class LevelOrderRange {
+public:
+    using iterator = LevelOrderIterator<Node>;
+
+    LevelOrderRange(const NodePool<Node>* pool, NodeIndex root, size_t nodeCount)
+        : m_pool(pool), m_root(root), m_nodeCount(nodeCount) {}
+
+    iterator begin() const { return iterator(m_pool, m_root, m_nodeCount); }
+    iterator end() const { return iterator(); }
+
+private:
+    const NodePool<Node>* m_pool;
+    NodeIndex m_root;
+    size_t m_nodeCount;
+};
+
+} // namespace dsav
@@ -0,0 +1,435 @@
+/**
+ * @file unrolled_linked_list.hpp
+ * @brief Unrolled linked list data structure implementation
+ *
+ * A linked list whose nodes each hold a small array of up to NodeCap
+ * elements. A walk follows one link per NodeCap elements and scans the rest
+ * from contiguous memory, so traversal does a fraction of the dependent
+ * loads (and, at large n, cache misses) of a one-element-per-node list.
+ * Nodes are kept at least half full: a full node splits in two, and a node
+ * that drops below half either borrows from or merges with its successor.
+ */
+
+#pragma once
+
+#include "node_pool.hpp"
+#include "op_counters.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace dsav {
+
+/**
+ * @brief Node of an unrolled linked list: a run of up to NodeCap elements
+ *
+ * @tparam T Type of data stored (must be default constructible)
+ * @tparam NodeCap Elements per node
+ */
+template<typename T, size_t NodeCap>
+struct UnrolledNode {
+    std::array<T, NodeCap> items{};   ///< items[0, count) are live, in list order
+    std::uint32_t count = 0;          ///< Live elements in this node
+    NodeIndex next = NULL_NODE;       ///< Next node (NULL_NODE at the end)
+};
+
+/// Handle to an unrolled list node as exposed to visualizers
+template<typename T, size_t NodeCap>
+using UnrolledNodeHandle = NodeHandle<UnrolledNode<T, NodeCap>>;
+
+/**
+ * @brief Unrolled linked list data structure
+ *
+ * Template parameters:
+ * - T: Type of elements stored in the list
+ * - NodeCap: Elements per node (at least 2)
+ *
+ * Same interface as LinkedList. Positional operations walk node by node
+ * (n / NodeCap hops) and then shift at most NodeCap elements inside one node.
+ *
+ * Complexity: insertBack O(1); insertFront O(NodeCap);
+ * insertAt, deleteAt, deleteBack, find O(n / NodeCap + NodeCap).
+ */
+template<typename T, size_t NodeCap = 16>
+class UnrolledLinkedList : public OpCounted {
+    static_assert(NodeCap >= 2, "UnrolledLinkedList nodes must hold at least two elements");
+
+public:
+    using Node = UnrolledNode<T, NodeCap>;
+
+    /// Elements per node
+    static constexpr size_t NODE_CAPACITY = NodeCap;
+
+    /// Fewest elements a node other than the last keeps after a delete
+    static constexpr size_t MIN_FILL = NodeCap / 2;
+
+    /**
+     * @brief Construct an empty unrolled list
+     */
+    UnrolledLinkedList() = default;
+
+    /**
+     * @brief Insert a value at the front of the list
+     *
+     * @param value Value to insert
+     */
+    void insertFront(const T& value) {
+        insertAt(0, value);
+    }
+
+    /**
+     * @brief Insert a value at the back of the list
+     *
+     * O(1): appends to the tail node, or starts a new one when it is full.
+     *
+     * @param value Value to insert
+     */
+    void insertBack(const T& value) {
+        if (m_tail == NULL_NODE || m_pool[m_tail].count == NodeCap) {
+            NodeIndex created = allocateNode();
+            if (m_tail == NULL_NODE) {
+                m_head = created;
+            } else {
+                m_pool[m_tail].next = created;
+            }
+            m_tail = created;
+        }
+
+        Node& tail = m_pool[m_tail];
+        tail.items[tail.count++] = value;
+        countMoves();
+        m_size++;
+    }
+
+    /**
+     * @brief Insert a value at a specific position
+     *
+     * A full node is split first, moving its upper half into a new node.
+     *
+     * @param index Position to insert at (0-based)
+     * @param value Value to insert
+     * @return true if successful, false if index out of range
+     */
+    bool insertAt(size_t index, const T& value) {
+        if (index > m_size) {
+            return false;
+        }
+        if (index == m_size) {
+            insertBack(value);
+            return true;
+        }
+
+        Location at = locate(index);
+        if (m_pool[at.node].count == NodeCap) {
+            splitNode(at.node);
+            if (at.offset > m_pool[at.node].count) {
+                at.offset -= m_pool[at.node].count;
+                at.node = m_pool[at.node].next;
+                countHops();
+            }
+        }
+
+        Node& node = m_pool[at.node];
+        for (size_t i = node.count; i > at.offset; --i) {
+            node.items[i] = std::move(node.items[i - 1]);
+        }
+        countMoves(node.count - at.offset);
+        node.items[at.offset] = value;
+        countMoves();
+        node.count++;
+        m_size++;
+        return true;
+    }
+
+    /**
+     * @brief Delete the first element (its value is moved out)
+     *
+     * @return The deleted value if successful, std::nullopt if list is empty
+     */
+    std::optional<T> deleteFront() {
+        return deleteAt(0);
+    }
+
+    /**
+     * @brief Delete the last element (its value is moved out)
+     *
+     * @return The deleted value if successful, std::nullopt if list is empty
+     */
+    std::optional<T> deleteBack() {
+        if (m_size == 0) {
+            return std::nullopt;
+        }
+        return deleteAt(m_size - 1);
+    }
+
+    /**
+     * @brief Delete the element at a specific position
+     *
+     * @param index Position to delete (0-based)
+     * @return The deleted value if successful, std::nullopt if index out of range
+     */
+    std::optional<T> deleteAt(size_t index) {
+        if (index >= m_size) {
+            return std::nullopt;
+        }
+
+        Location at = locate(index);
+        Node& node = m_pool[at.node];
+        T value = std::move(node.items[at.offset]);
+        countMoves();
+        for (size_t i = at.offset + 1; i < node.count; ++i) {
+            node.items[i - 1] = std::move(node.items[i]);
+        }
+        countMoves(node.count - at.offset - 1);
+        node.count--;
+        m_size--;
+
+        rebalance(at.node, at.prev);
+        return value;
+    }
+
+    /**
+     * @brief Search for a value in the list
+     *
+     * @param value Value to search for
+     * @return Index of first occurrence, or std::nullopt if not found
+     */
+    std::optional<size_t> find(const T& value) const {
+        size_t base = 0;
+        for (NodeIndex current = m_head; current != NULL_NODE; current = m_pool[current].next) {
+            const Node& node = m_pool[current];
+            for (size_t i = 0; i < node.count; ++i) {
+                countComparisons();
+                if (node.items[i] == value) {
+                    return base + i;
+                }
+            }
+            base += node.count;
+            countHops();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Read the element at a position
+     *
+     * @return The value, or std::nullopt if index out of range
+     */
+    std::optional<T> at(size_t index) const {
+        if (index >= m_size) {
+            return std::nullopt;
+        }
+        Location location = locate(index);
+        return m_pool[location.node].items[location.offset];
+    }
+
+    /**
+     * @brief Check if list is empty
+     *
+     * @return true if empty
+     */
+    bool isEmpty() const {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Get current number of elements
+     *
+     * @return Number of elements
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * @brief Get number of nodes holding the elements
+     */
+    size_t nodeCount() const {
+        return m_pool.size();
+    }
+
+    /**
+     * @brief Clear all elements
+     */
+    void clear() {
+        m_pool.clear();
+        m_head = NULL_NODE;
+        m_tail = NULL_NODE;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Reserve node storage ahead of a large load
+     *
+     * @param count Expected number of elements
+     */
+    void reserve(size_t count) {
+        m_pool.reserve((count + NodeCap - 1) / NodeCap);
+    }
+
+    /**
+     * @brief Get head node (for visualization)
+     *
+     * @return Handle to head node (empty if list is empty)
+     */
+    UnrolledNodeHandle<T, NodeCap> head() const {
+        return UnrolledNodeHandle<T, NodeCap>(&m_pool, m_head);
+    }
+
+    /**
+     * @brief Append a range of values in order
+     *
+     * Appended nodes are filled completely, so a bulk-built list uses
+     * n / NodeCap nodes.
+     *
+     * @param first Start of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            insertBack(*first);
+        }
+    }
+
+    /**
+     * @brief Traverse list and apply function to each element
+     *
+     * @param func Function to apply to each element
+     */
+    void traverse(std::function<void(const T&)> func) const {
+        for (NodeIndex current = m_head; current != NULL_NODE; current = m_pool[current].next) {
+            const Node& node = m_pool[current];
+            for (size_t i = 0; i < node.count; ++i) {
+                func(node.items[i]);
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Node holding an element, its predecessor and the offset inside it
+     */
+    struct Location {
+        NodeIndex node = NULL_NODE;
+        NodeIndex prev = NULL_NODE;
+        size_t offset = 0;
+    };
+
+    /**
+     * @brief Walk node by node to the element at a position (caller guarantees it exists)
+     */
+    Location locate(size_t index) const {
+        Location location;
+        location.node = m_head;
+        while (index >= m_pool[location.node].count) {
+            index -= m_pool[location.node].count;
+            location.prev = location.node;
+            location.node = m_pool[location.node].next;
+            countHops();
+        }
+        location.offset = index;
+        return location;
+    }
+
+    /**
+     * @brief Move the upper half of a full node into a new node after it
+     */
+    void splitNode(NodeIndex index) {
+        NodeIndex created = allocateNode();
+        Node& node = m_pool[index];
+        Node& upper = m_pool[created];
+
+        size_t keep = NodeCap - NodeCap / 2;
+        for (size_t i = keep; i < NodeCap; ++i) {
+            upper.items[i - keep] = std::move(node.items[i]);
+        }
+        countMoves(NodeCap - keep);
+        upper.count = static_cast<std::uint32_t>(NodeCap - keep);
+        node.count = static_cast<std::uint32_t>(keep);
+
+        upper.next = node.next;
+        node.next = created;
+        if (m_tail == index) {
+            m_tail = created;
+        }
+    }
+
+    /**
+     * @brief Restore the fill invariant of a node that just lost an element
+     *
+     * An empty node is unlinked. A node below MIN_FILL absorbs its successor
+     * if both fit in one node, and otherwise borrows its successor's first
+     * element. The last node may stay underfull.
+     */
+    void rebalance(NodeIndex index, NodeIndex prev) {
+        Node& node = m_pool[index];
+        if (node.count == 0) {
+            unlinkNode(index, prev);
+            return;
+        }
+
+        NodeIndex nextIndex = node.next;
+        if (node.count >= MIN_FILL || nextIndex == NULL_NODE) {
+            return;
+        }
+
+        Node& next = m_pool[nextIndex];
+        countHops();
+        if (node.count + next.count <= NodeCap) {
+            for (size_t i = 0; i < next.count; ++i) {
+                node.items[node.count + i] = std::move(next.items[i]);
+            }
+            countMoves(next.count);
+            node.count += next.count;
+            next.count = 0;
+            unlinkNode(nextIndex, index);
+        } else {
+            node.items[node.count++] = std::move(next.items[0]);
+            for (size_t i = 1; i < next.count; ++i) {
+                next.items[i - 1] = std::move(next.items[i]);
+            }
+            countMoves(next.count);
+            next.count--;
+        }
+    }
+
+    /**
+     * @brief Unlink an empty node and return it to the pool
+     */
+    void unlinkNode(NodeIndex index, NodeIndex prev) {
+        NodeIndex next = m_pool[index].next;
+        if (prev == NULL_NODE) {
+            m_head = next;
+        } else {
+            m_pool[prev].next = next;
+        }
+        if (m_tail == index) {
+            m_tail = prev;
+        }
+        m_pool.release(index);
+    }
+
+    /**
+     * @brief Take an empty node from the pool
+     */
+    NodeIndex allocateNode() {
+        countAllocations();
+        return m_pool.allocate();
+    }
+
+    NodePool<Node> m_pool;            ///< Node storage
+    NodeIndex m_head = NULL_NODE;     ///< First node
+    NodeIndex m_tail = NULL_NODE;     ///< Last node
+    size_t m_size = 0;                ///< Number of elements
+};
+
+} // namespace dsav
@@ -13,8 +13,12 @@
 #include "animation.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
+#include "visualizers/workload_panel.hpp"
+#include "visualizers/minimap_panel.hpp"
+#include "algorithms/density_summary.hpp"
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <imgui.h>
 
 namespace dsav {
@@ -50,6 +54,19 @@ public:
     bool isAnimating() const override;
     bool isPaused() const override;
 
+    // Snapshots (raw element buffer)
+    bool supportsSnapshots() const override { return true; }
+    bool saveSnapshot(const std::string& path) override;
+    bool loadSnapshot(const std::string& path) override;
+
+    // Timeline (the active workload replay)
+    bool hasTimeline() const override { return m_workload.replay().isActive(); }
+    bool stepBack() override;
+    bool seek(size_t step) override;
+    size_t currentStep() const override { return m_workload.replay().position(); }
+    size_t stepCount() const override { return m_workload.replay().size(); }
+    void suspend() override { m_canvasCache.release(); }
+
     // Array-specific operations (with animation)
     void insertValue(size_t index, int value);
     void deleteValue(size_t index);
@@ -72,10 +89,29 @@ private:
      */
     glm::vec2 calculatePosition(size_t index) const;
 
+    /**
+     * @brief Pan the camera so an index (may be fractional) sits at the canvas center
+     */
+    void centerOn(double index);
+
+    /**
+     * @brief Animate a workload op the replay sampled (append, delete first match or search)
+     */
+    void animateWorkloadOp(const algorithms::WorkloadOp& op);
+
+    /**
+     * @brief Show the contents a replay reached without animating
+     */
+    void syncWorkload();
+
     // Data
     DynamicArray<int> m_array;                 ///< Underlying array data structure
     std::vector<VisualElement> m_elements;     ///< Visual representation of array elements
     AnimationController m_animator;            ///< Animation controller
+    CanvasCache m_canvasCache;                 ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;          ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedElements;  ///< Elements animated by the current step (drawn live)
+    std::vector<std::uint8_t> m_animatedScratch;   ///< This frame's flags, swapped in when they change
 
     // UI state
     std::string m_statusText;                  ///< Current status message
@@ -84,6 +120,15 @@ private:
     bool m_isPaused = true;                    ///< Pause state
     float m_speed = 1.0f;                      ///< Animation speed multiplier
     int m_initCount = 20;                      ///< Number of elements for random initialization
+    WorkloadPanel m_workload;                  ///< Workload script and replay
+
+    // Minimap
+    algorithms::ValueSummary m_summary;        ///< Value pyramid over the array, updated by syncVisuals
+    std::vector<int> m_summaryValues;          ///< Contents m_summary was last updated from
+    MinimapPanel m_minimap;
+    float m_canvasWidth = 0.0f;                ///< Last canvas width, for centering minimap jumps
+    double m_viewFirst = 0.0;                  ///< Index range the canvas showed last frame
+    double m_viewLast = 0.0;
 
     // Camera/viewport control for scrolling/panning
     float m_cameraOffsetX = 0.0f;              ///< Horizontal camera offset for panning
@@ -108,6 +153,7 @@ private:
     static constexpr float ELEMENT_SPACING = 10.0f;
     static constexpr float START_X = 100.0f;
     static constexpr float START_Y = 150.0f;
+    static constexpr size_t MAX_SCAN_ANIMATION = 32;  ///< Longest array a sampled search scans visibly
 };
 
 } // namespace dsav
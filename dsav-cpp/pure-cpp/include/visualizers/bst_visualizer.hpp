@@ -4,19 +4,27 @@
  *
  * Provides interactive visualization of BST operations with hierarchical tree layout.
  * Shows parent-child relationships with connecting lines and supports tree traversals.
+ * The tree itself sits behind a TreeBackend, so the asm-linked build reuses
+ * this visualizer over the assembly BST.
  */
 
 #pragma once
 
 #include "visualizer.hpp"
-#include "data_structures/binary_search_tree.hpp"
+#include "visualizers/tree_backend.hpp"
 #include "animation.hpp"
+#include "step_budget.hpp"
+#include "job_system.hpp"
+#include "visualizers/dataset_import_panel.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
+#include "tree_layout.hpp"
+#include "visualizers/minimap_panel.hpp"
+#include "algorithms/density_summary.hpp"
 #include <vector>
 #include <string>
 #include <memory>
-#include <map>
+#include <cstdint>
 #include <imgui.h>
 
 namespace dsav {
@@ -29,8 +37,9 @@ struct VisualTreeNode {
     glm::vec2 size;
     glm::vec4 color;
     glm::vec4 borderColor;
-    std::string label;
+    LabelId label = NO_LABEL;
     int value;  // Store value for identification
+    bool active = false;  // Slot holds a live tree node
 };
 
 /**
@@ -46,10 +55,16 @@ struct VisualTreeNode {
 class BSTVisualizer : public IVisualizer {
 public:
     /**
-     * @brief Construct a BST visualizer
+     * @brief Construct a BST visualizer over the pure C++ tree
      */
     BSTVisualizer();
 
+    /**
+     * @brief Construct a BST visualizer over another tree backend
+     */
+    explicit BSTVisualizer(std::unique_ptr<TreeBackend> tree);
+    ~BSTVisualizer() override;
+
     // IVisualizer interface implementation
     void update(float deltaTime) override;
     void renderVisualization() override;
@@ -60,9 +75,10 @@ public:
     void reset() override;
     void setSpeed(float speed) override;
     std::string getStatusText() const override;
-    std::string getName() const override { return "Binary Search Tree"; }
+    std::string getName() const override { return m_tree->name(); }
     bool isAnimating() const override;
     bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
 
     // BST-specific operations (with animation)
     void insertValue(int value);
@@ -74,21 +90,116 @@ public:
     void traverseLevelOrder();
     void initializeRandom(size_t count);
 
+    /**
+     * @brief Animate the walk to the k-th smallest key and center the camera on it
+     *
+     * @param k Zero-based rank
+     */
+    void selectKth(size_t k);
+
+    /**
+     * @brief Select the nearest-rank percentile of the keys (0-100)
+     */
+    void selectPercentile(float percent);
+
+    /**
+     * @brief Count the keys in [low, high] and highlight the first and last of them
+     */
+    void countRange(int low, int high);
+
+    /**
+     * @brief Build a large tree from random keys in a single pass
+     *
+     * Replaces the tree with a balanced bulk load, or batch-inserts into it
+     * when m_bulkKeepExisting is set. Keys are drawn on a worker thread; a
+     * replacement tree is also built and laid out there, so only the visual
+     * nodes are created on the render thread.
+     *
+     * @param count Number of distinct keys to load
+     */
+    void loadRandomKeys(size_t count);
+
+    /**
+     * @brief Replace the tree with a balanced bulk load of a dataset file
+     *
+     * Read, built and laid out on a worker thread like loadRandomKeys().
+     * A compact file whose header marks it sorted is built straight from the
+     * mapping, without sorting or copying its keys first. Files with more
+     * than MAX_IMPORT_KEYS keys are sampled evenly.
+     */
+    void importDataset(const std::string& path, algorithms::DatasetFormat format);
+
 private:
+    /**
+     * @brief Tree and layout produced off the render thread by loadRandomKeys
+     */
+    struct BulkLoad {
+        BinarySearchTree<int, true> tree;
+        TreeLayout layout;
+        std::vector<int> keys;    ///< Keys to batch-insert instead (keep-existing mode)
+    };
+
+    /**
+     * @brief Lay out a replacement tree built with change tracking enabled (worker thread)
+     */
+    static void layOutReplacement(BulkLoad& load);
+
+    /**
+     * @brief Apply a finished bulk load (job completion)
+     *
+     * @param source What was loaded, for the status line (e.g. "10000 random keys")
+     */
+    void finishBulkLoad(BulkLoad& load, const std::string& source);
+
+    /**
+     * @brief Queue the root-to-node highlight of a selected node and center on it
+     *
+     * @param status Status text shown once the node is reached
+     */
+    void animateSelection(NodeIndex id, const std::string& status);
+
+    /**
+     * @brief Create or refresh the visual node of a live tree node
+     */
+    VisualTreeNode& refreshVisual(NodeIndex id);
+
+    /**
+     * @brief Drop every visual node and layout entry (the tree is left as is)
+     */
+    void clearVisuals();
+
     /**
      * @brief Sync visual nodes with current tree state
+     *
+     * Applies only the nodes the tree journaled since the last sync and lets
+     * the layout engine re-place the affected subtrees.
      */
     void syncVisuals();
 
     /**
-     * @brief Calculate positions for all nodes using tree layout algorithm
+     * @brief Record a node's laid-out position in the density grid
+     */
+    void placeDensity(NodeIndex id);
+
+    /**
+     * @brief Draw the minimap and center the camera where it is clicked
+     */
+    void renderMinimap();
+
+    /**
+     * @brief Insert queued bulk values until this frame's time budget is spent
+     *
+     * Visuals are synced once per batch rather than once per insert.
+     */
+    void drainPendingInserts();
+
+    /**
+     * @brief Find the visual node for a value
      *
-     * @param node Current node
-     * @param x X position
-     * @param y Y position (level)
-     * @param xOffset Horizontal offset for this subtree
+     * @param value Value to look up
+     * @return Pointer to the visual node, or nullptr if not in the tree
      */
-    void calculatePositions(std::shared_ptr<TreeNode<int>> node, float x, float y, float xOffset);
+    VisualTreeNode* findVisual(int value);
 
     /**
      * @brief Draw line connecting parent to child
@@ -108,10 +219,16 @@ private:
     std::vector<int> collectTraversalOrder(const std::string& type);
 
     // Data
-    BinarySearchTree<int> m_bst;                      ///< Underlying BST data structure
-    std::vector<VisualTreeNode> m_visualNodes;        ///< Visual representation of nodes
-    std::map<int, glm::vec2> m_nodePositions;         ///< Position map for nodes
+    std::unique_ptr<TreeBackend> m_tree;              ///< Underlying tree (C++ or assembly)
+    std::vector<VisualTreeNode> m_visualNodes;        ///< Visual nodes indexed by tree node id
+    TreeLayout m_layout;                              ///< Incremental tidy-tree layout
+    algorithms::TreeDensity m_density;                ///< Node counts per depth and position, mirrors m_layout
+    MinimapPanel m_minimap;
     AnimationController m_animator;                   ///< Animation controller
+    CanvasCache m_canvasCache;                        ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;                 ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedNodes;        ///< Nodes animated by the current step (drawn live)
+    std::vector<std::uint8_t> m_animatedScratch;      ///< This frame's flags, swapped in when they change
 
     // UI state
     std::string m_statusText;                         ///< Current status message
@@ -119,6 +236,17 @@ private:
     bool m_isPaused = true;                           ///< Pause state
     float m_speed = 1.0f;                             ///< Animation speed multiplier
     int m_initCount = 10;                             ///< Number of nodes for random initialization
+    std::vector<int> m_pendingInserts;                ///< Queued values of a bulk insert
+    size_t m_pendingInsertPos = 0;                    ///< Next queued value to insert
+    int m_bulkCount = 10000;                          ///< Number of keys for a bulk load
+    bool m_bulkKeepExisting = false;                  ///< Batch-insert into the tree instead of replacing it
+    JobHandle m_bulkJob;                              ///< Bulk load in flight (nullptr if none)
+    DatasetImportPanel m_importPanel;                 ///< Path and format of the next import
+    float m_turboBudgetMs = DEFAULT_TURBO_BUDGET_MS;  ///< Per-frame bulk insert budget (ms)
+    int m_selectRank = 1;                             ///< One-based rank for Select k-th
+    float m_percentile = 50.0f;                       ///< Percentile for Percentile mode
+    int m_rangeLow = 0;                               ///< Bounds for Count in Range (inclusive)
+    int m_rangeHigh = 100;
 
     // Camera/viewport control for scrolling/panning
     float m_cameraOffsetX = 0.0f;                     ///< Horizontal camera offset for panning
@@ -126,17 +254,24 @@ private:
     float m_zoomLevel = 1.0f;                         ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
     bool m_isDragging = false;                        ///< Mouse drag state for panning
     ImVec2 m_lastMousePos;                            ///< Last mouse position for drag delta
+    NodeIndex m_jumpTarget = NULL_NODE;               ///< Node to center the camera on next frame
+    ImVec2 m_canvasSize;                              ///< Last canvas size, for the minimap's view outline
 
     // Operation mode
     enum class OperationMode {
         Insert,
         Delete,
         Search,
+        SelectKth,
+        Percentile,
+        CountRange,
         TraverseInorder,
         TraversePreorder,
         TraversePostorder,
         TraverseLevelOrder,
-        Initialize
+        Initialize,
+        LoadRandomKeys,
+        ImportDataset
     };
     OperationMode m_currentMode = OperationMode::Insert;
 
@@ -146,6 +281,8 @@ private:
     static constexpr float HORIZONTAL_SPACING = 60.0f;
     static constexpr float START_X = 400.0f;
     static constexpr float START_Y = 80.0f;
+    static constexpr int MAX_BULK_KEYS = 1000000;    ///< Upper bound of the bulk load slider
+    static constexpr size_t MAX_IMPORT_KEYS = size_t{1} << 22;  ///< Imported keys beyond this are sampled
 };
 
 } // namespace dsav
@@ -0,0 +1,217 @@
+/**
+ * @file btree_visualizer.hpp
+ * @brief Visualizer for B-Tree and B+ Tree data structures
+ *
+ * Draws multi-key nodes level by level with edges hanging from the gaps
+ * between keys. The B+ view also draws the leaf chain and marks internal
+ * keys as separator copies. A RedBlackTree with the same keys shadows every
+ * operation so searches can compare how many nodes each tree visits.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "data_structures/btree.hpp"
+#include "data_structures/bplus_tree.hpp"
+#include "data_structures/red_black_tree.hpp"
+#include "animation.hpp"
+#include "renderer.hpp"
+#include "color_scheme.hpp"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Visual representation of one key cell of a B-tree node
+ */
+struct VisualKeyCell {
+    glm::vec4 color;
+    glm::vec4 borderColor;
+    LabelId label = NO_LABEL;
+};
+
+/**
+ * @brief Visual representation of a B-tree node
+ */
+struct VisualBTreeNode {
+    glm::vec2 position;          ///< Top-left corner in world space
+    float width = 0.0f;          ///< count * KEY_WIDTH
+    size_t firstKey = 0;         ///< Index of the node's first cell in m_keyCells
+    size_t count = 0;            ///< Keys in the node
+    size_t level = 0;            ///< Depth (0 = root)
+    size_t parent = SIZE_MAX;    ///< Visual index of the parent (SIZE_MAX for the root)
+    size_t childSlot = 0;        ///< Which child of the parent this node is
+    size_t firstChild = 0;       ///< Visual index of the first child (children are contiguous)
+    size_t childCount = 0;       ///< Children (0 for a leaf)
+};
+
+/**
+ * @brief Interactive visualizer for B-Tree and B+ Tree data structures
+ *
+ * Features:
+ * - Switch between a B-tree and a leaf-chained B+ tree over the same keys
+ * - Level-by-level layout, parents centered over their children
+ * - Search animation highlighting the root-to-leaf path
+ * - Height, node count and nodes visited next to a red-black tree's
+ */
+class BTreeVisualizer : public IVisualizer {
+public:
+    /// Children per displayed node (small so splits and merges happen often)
+    static constexpr size_t ORDER = 4;
+
+    /**
+     * @brief Which of the two trees is drawn
+     */
+    enum class TreeKind {
+        BTree,      ///< Keys stored once, in internal nodes and leaves
+        BPlusTree   ///< Keys in leaves, internal keys are separator copies
+    };
+
+    /**
+     * @brief Construct a B-tree visualizer
+     */
+    BTreeVisualizer();
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "B-Tree"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
+
+    // B-tree-specific operations (with animation)
+    void insertValue(int value);
+    void deleteValue(int value);
+    void searchValue(int value);
+    void initializeRandom(size_t count);
+    void clearTree();
+
+    /**
+     * @brief Draw the other tree (both always hold the same keys)
+     */
+    void setKind(TreeKind kind);
+
+private:
+    using Handle = BTreeNodeHandle<int, ORDER>;
+
+    /**
+     * @brief One node on a search path and the key matched in it
+     */
+    struct PathStep {
+        size_t visual = 0;           ///< Visual node index
+        size_t matchedKey = SIZE_MAX; ///< Key index that equals the target (SIZE_MAX if none)
+    };
+
+    /**
+     * @brief Handle to the root of the tree being drawn
+     */
+    Handle displayedRoot() const;
+
+    /**
+     * @brief Handle to a node of the tree being drawn
+     */
+    Handle displayedNode(NodeIndex id) const;
+
+    /**
+     * @brief Root-to-leaf path the drawn tree's search follows
+     *
+     * @param value Key to search for
+     * @param keysCompared If set, receives the keys compared along the path
+     */
+    std::vector<PathStep> searchPath(int value, size_t* keysCompared = nullptr) const;
+
+    /**
+     * @brief Nodes the red-black tree visits searching for a value
+     */
+    size_t redBlackVisits(int value) const;
+
+    /**
+     * @brief Rebuild visual nodes and cells from the drawn tree
+     */
+    void syncVisuals();
+
+    /**
+     * @brief Place leaves left-to-right and center each parent over its children
+     *
+     * Relies on m_visualNodes being in level order, so every child comes after its parent.
+     */
+    void layoutNodes();
+
+    /**
+     * @brief Flash the cells on a search path, ending on the matched key
+     *
+     * @param path Path from searchPath()
+     * @param matchColor Color for the matched key
+     * @param onDone Runs once the animation completes
+     */
+    void animatePath(const std::vector<PathStep>& path, const glm::vec4& matchColor,
+                     std::function<void()> onDone);
+
+    void drawArrow(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color);
+
+    // Data
+    BTree<int, ORDER> m_btree;                     ///< B-tree over the keys
+    BPlusTree<int, ORDER> m_bplus;                 ///< B+ tree over the same keys
+    RedBlackTree<int> m_redBlack;                  ///< Same keys, for the nodes-visited comparison
+    TreeKind m_kind = TreeKind::BTree;
+    std::vector<VisualBTreeNode> m_visualNodes;    ///< Drawn tree in level order
+    std::vector<VisualKeyCell> m_keyCells;         ///< Key cells of all nodes
+    std::unordered_map<NodeIndex, size_t> m_visualOf;  ///< Tree node id -> visual index
+    AnimationController m_animator;                ///< Animation controller
+    CanvasCache m_canvasCache;                     ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;              ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedCells;     ///< Cells animated by the current step (drawn live), per m_keyCells
+    std::vector<std::uint8_t> m_animatedScratch;   ///< This frame's flags, swapped in when they change
+
+    // Last search
+    bool m_hasSearch = false;
+    size_t m_lastVisited = 0;                      ///< Nodes the drawn tree visited
+    size_t m_lastKeysScanned = 0;                  ///< Keys compared inside those nodes
+    size_t m_lastRedBlackVisited = 0;              ///< Nodes the red-black tree visited
+
+    // UI state
+    std::string m_statusText;                      ///< Current status message
+    int m_inputValue = 0;                          ///< Value for insert/delete/search
+    bool m_isPaused = true;                        ///< Pause state
+    float m_speed = 1.0f;                          ///< Animation speed multiplier
+    int m_initCount = 20;                          ///< Number of keys for random initialization
+
+    // Camera/viewport control for scrolling/panning
+    float m_cameraOffsetX = 0.0f;                  ///< Horizontal camera offset for panning
+    float m_cameraOffsetY = 0.0f;                  ///< Vertical camera offset for panning
+    float m_zoomLevel = 1.0f;                      ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
+    bool m_isDragging = false;                     ///< Mouse drag state for panning
+    ImVec2 m_lastMousePos;                         ///< Last mouse position for drag delta
+
+    // Operation mode
+    enum class OperationMode {
+        Insert,
+        Delete,
+        Search
+    };
+    OperationMode m_currentMode = OperationMode::Insert;
+
+    // Visual constants
+    static constexpr float KEY_WIDTH = 44.0f;
+    static constexpr float KEY_HEIGHT = 40.0f;
+    static constexpr float NODE_GAP = 24.0f;        // Horizontal gap between leaves
+    static constexpr float LEVEL_SPACING = 100.0f;  // Vertical distance between levels
+    static constexpr float START_X = 60.0f;
+    static constexpr float START_Y = 80.0f;
+    static constexpr int MAX_INIT_COUNT = 200;
+};
+
+} // namespace dsav
@@ -0,0 +1,132 @@
+/**
+ * @file complexity_visualizer.hpp
+ * @brief Complexity mode: measured operation cost plotted against n
+ *
+ * Runs a complexity sweep (algorithms/complexity.hpp) for one data structure
+ * operation, and optionally a second one to compare, on a worker thread,
+ * then plots the counted cost per operation against power-of-two sizes
+ * with constant, log n, n, n log n and n^2 reference curves scaled to
+ * meet the measurement at the largest n.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "algorithms/complexity.hpp"
+#include "job_system.hpp"
+#include "color_scheme.hpp"
+#include <array>
+#include <string>
+#include <vector>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Plots how the cost of a data structure operation grows with n
+ *
+ * Features:
+ * - Any operation of Stack, Queue, DynamicArray, LinkedList, DoublyLinkedList,
+ *   BinarySearchTree and RedBlackTree, plus a second one to compare
+ * - Comparisons, pointer hops, moves, allocations, rotations, their sum,
+ *   or wall time as the cost
+ * - Cost of one operation, or of n of them (per-operation cost x n)
+ * - Reference curves and a log scale for the cost axis
+ * - Sweeps run on the job system so the window stays responsive
+ */
+class ComplexityVisualizer : public IVisualizer {
+public:
+    /**
+     * @brief Reference curves, in legend order
+     */
+    enum class Curve {
+        Constant,
+        Log,
+        Linear,
+        LogLinear,
+        Quadratic
+    };
+    static constexpr size_t CURVE_COUNT = 5;
+
+    /**
+     * @brief Construct the view and start a first sweep
+     */
+    ComplexityVisualizer();
+    ~ComplexityVisualizer() override;
+
+    ComplexityVisualizer(const ComplexityVisualizer&) = delete;
+    ComplexityVisualizer& operator=(const ComplexityVisualizer&) = delete;
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "Complexity Curves"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+
+    /**
+     * @brief Measure the selected operations (cancels a sweep in flight)
+     */
+    void runSweep();
+
+private:
+    static constexpr int DEFAULT_MAX_EXPONENT = 14;   ///< n up to 16384 by default
+    static constexpr std::uint32_t SEED = 42;
+    static constexpr float PLOT_MARGIN_LEFT = 80.0f;
+    static constexpr float PLOT_MARGIN_RIGHT = 30.0f;
+    static constexpr float PLOT_MARGIN_TOP = 40.0f;
+    static constexpr float PLOT_MARGIN_BOTTOM = 50.0f;
+    static constexpr int Y_GRID_LINES = 5;
+
+    /**
+     * @brief Measured samples of one operation
+     */
+    struct Series {
+        algorithms::ComplexityOp op = algorithms::ComplexityOp::StackPush;
+        std::vector<algorithms::ComplexitySample> samples;
+    };
+
+    /**
+     * @brief Combo listing every operation as "Structure: operation"
+     *
+     * @param allowNone Add a leading "None" entry (index -1)
+     * @return true if the selection changed
+     */
+    bool operationCombo(const char* label, int& selected, bool allowNone);
+
+    /**
+     * @brief Plotted cost of a sample under the current metric and mode
+     */
+    double plotValue(const algorithms::ComplexitySample& sample) const;
+
+    /**
+     * @brief Value of a reference curve at n (before scaling)
+     */
+    static double curveValue(Curve curve, double n);
+
+    void renderPlot(ImDrawList* drawList, ImVec2 origin, ImVec2 size);
+
+    // Selection
+    int m_primaryOp = static_cast<int>(algorithms::ComplexityOp::ArrayInsertFront);
+    int m_compareOp = static_cast<int>(algorithms::ComplexityOp::ListInsertFront);  ///< -1 = none
+    int m_metric = static_cast<int>(algorithms::ComplexityMetric::TotalOps);
+    int m_minExponent = static_cast<int>(algorithms::COMPLEXITY_MIN_EXPONENT);
+    int m_maxExponent = DEFAULT_MAX_EXPONENT;
+    bool m_totalCost = false;                       ///< Plot cost of n operations instead of one
+    bool m_logScale = false;                        ///< Logarithmic cost axis
+    std::array<bool, CURVE_COUNT> m_showCurve{{true, true, true, true, false}};
+
+    // Results
+    std::vector<Series> m_series;                   ///< Primary first, then the comparison
+    JobHandle m_job;                                ///< Sweep in flight (nullptr if none)
+    std::string m_statusText;
+};
+
+} // namespace dsav
@@ -0,0 +1,246 @@
+/**
+ * @file concurrent_queue_visualizer.hpp
+ * @brief Visualizer for the lock-free queues and stack under real threads
+ *
+ * A run starts real producer and consumer threads on a worker (see
+ * algorithms::runConcurrentWorkload) with a ContentionProbe attached. Each
+ * frame the visualizer reads the probe's counters and drains its sampled
+ * event log: the CAS sites (ring cells, or the head, tail and link of the
+ * Michael-Scott queue) glow with recent retries, and every thread gets a
+ * lane of ticks, one per logged CAS, over the last few milliseconds.
+ * Finished runs go to a results table next to their mutex baseline, and a
+ * sweep runs both at growing thread counts to show how each one scales.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "algorithms/concurrent_workload.hpp"
+#include "data_structures/contention_probe.hpp"
+#include "job_system.hpp"
+#include "color_scheme.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Interactive visualizer for LockFreeQueue, MpmcQueue and LockFreeStack
+ *
+ * Features:
+ * - Michael-Scott queue, bounded MPMC ring and Treiber stack, plus their
+ *   mutex-wrapped Queue and Stack baselines
+ * - Any number of real producer and consumer threads
+ * - Contention heat per CAS site from retried attempts
+ * - Per-thread lanes of sampled CAS successes and retries
+ * - Throughput, retry rate and speedup over the mutex baseline per run
+ * - Thread-count sweep of a container against its baseline
+ */
+class ConcurrentQueueVisualizer : public IVisualizer {
+public:
+    /**
+     * @brief Construct a concurrent queue visualizer
+     */
+    ConcurrentQueueVisualizer();
+    ~ConcurrentQueueVisualizer() override;
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "Lock-Free Queues"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+    void suspend() override;
+
+    /**
+     * @brief Start a probed run of the selected container on a worker thread
+     */
+    void startRun();
+
+    /**
+     * @brief Stop the running workload (its threads drain and exit)
+     */
+    void stopRun();
+
+    /**
+     * @brief Run the selected container and its baseline at 1, 2, 4, ... producer/consumer pairs
+     */
+    void startSweep();
+
+private:
+    /**
+     * @brief One finished run, for the results table
+     */
+    struct RunRecord {
+        algorithms::ConcurrentWorkload workload;
+        algorithms::ConcurrentResult result;
+        bool fromSweep = false;
+    };
+
+    /**
+     * @brief Sweep progress shared with its job
+     */
+    struct SweepProgress {
+        std::atomic<size_t> done{0};
+        size_t total = 0;
+    };
+
+    /**
+     * @brief Workload from the current settings
+     */
+    algorithms::ConcurrentWorkload currentWorkload() const;
+
+    /**
+     * @brief Workload drawn: the probed run's, or the settings' before the first run
+     */
+    algorithms::ConcurrentWorkload shownWorkload() const;
+
+    /**
+     * @brief Check whether the probed run is still going
+     */
+    bool isRunning() const { return m_runJob != nullptr; }
+
+    /**
+     * @brief Check whether a sweep is going
+     */
+    bool isSweeping() const { return m_sweepJob != nullptr; }
+
+    /**
+     * @brief Install a finished run (job completion)
+     */
+    void finishRun(const algorithms::ConcurrentResult& result, bool ok);
+
+    /**
+     * @brief Install the runs of a finished sweep (job completion)
+     */
+    void finishSweep(std::vector<RunRecord>& records);
+
+    /**
+     * @brief Cancel pending jobs and drop their completions
+     */
+    void discardJobs();
+
+    /**
+     * @brief Read the probe's counters and drain its events into the lanes
+     */
+    void pollProbe();
+
+    /**
+     * @brief Append a record, dropping the oldest past MAX_RESULTS
+     */
+    void addRecord(RunRecord record);
+
+    /**
+     * @brief Latest recorded throughput of a container at a thread split (0 if none)
+     */
+    double recordedRate(algorithms::ConcurrentContainer container, size_t producers, size_t consumers) const;
+
+    /**
+     * @brief Top-left of a site cell (world space)
+     */
+    glm::vec2 sitePosition(size_t site) const;
+
+    /**
+     * @brief Size of a site cell (world space)
+     */
+    glm::vec2 siteSize() const;
+
+    /**
+     * @brief Top of the first thread lane (world space)
+     */
+    float lanesTop() const;
+
+    /**
+     * @brief Lane color of a thread (producers and consumers in separate groups)
+     */
+    glm::vec4 threadColor(size_t thread) const;
+
+    /**
+     * @brief "P0", "C3", ...
+     */
+    std::string threadLabel(size_t thread) const;
+
+    // Run state
+    std::shared_ptr<ContentionProbe> m_probe;        ///< Shared with the running job
+    algorithms::ConcurrentWorkload m_runWorkload;    ///< Workload of m_probe
+    JobHandle m_runJob;                              ///< Probed run in flight (nullptr if none)
+    JobHandle m_sweepJob;                            ///< Sweep in flight (nullptr if none)
+    std::shared_ptr<SweepProgress> m_sweepProgress;
+
+    // Probe readings
+    std::vector<float> m_siteHeat;                   ///< Recent retries per site, decaying
+    std::vector<std::uint64_t> m_siteFailures;       ///< Failures at the last poll
+    std::vector<std::uint64_t> m_siteAttempts;       ///< Attempts at the last poll
+    std::vector<std::deque<ContentionEvent>> m_lanes; ///< Logged events per thread within the window
+    std::vector<ContentionThreadStats> m_threadStats;
+    std::uint64_t m_nowNs = 0;                       ///< Right edge of the lanes (frozen once a run ends)
+    std::uint64_t m_lastPollNs = 0;
+    std::uint64_t m_lastEventNs = 0;                 ///< Newest event drained
+    std::uint64_t m_lastPollPops = 0;
+    double m_liveRate = 0.0;                         ///< Pops per second since the previous poll
+
+    // Results
+    std::vector<RunRecord> m_results;                ///< Oldest first
+
+    // Settings
+    int m_container = static_cast<int>(algorithms::ConcurrentContainer::MichaelScottQueue);
+    int m_producers = 2;
+    int m_consumers = 2;
+    int m_itemsPerProducer = 200000;
+    int m_ringCapacityLog2 = 6;                      ///< Ring cells = 2^this
+    int m_sampleEvery = 16;                          ///< Log every n-th CAS of a thread
+    int m_sweepMaxPairs = 8;                         ///< Largest producer/consumer pair count in a sweep
+    float m_windowMs = 20.0f;                        ///< Time the lanes span
+
+    // UI state
+    std::string m_statusText;                        ///< Current status message
+    float m_speed = 1.0f;                            ///< Scales the heat decay
+    size_t m_hoveredSite = SIZE_MAX;                 ///< Site under the mouse
+
+    // Camera/viewport control for scrolling/panning
+    float m_cameraOffsetX = 0.0f;                    ///< Horizontal camera offset for panning
+    float m_cameraOffsetY = 0.0f;                    ///< Vertical camera offset for panning
+    float m_zoomLevel = 1.0f;                        ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
+    bool m_isDragging = false;                       ///< Mouse drag state for panning
+    ImVec2 m_lastMousePos;                           ///< Last mouse position for drag delta
+
+    // Visual constants
+    static constexpr float START_X = 60.0f;
+    static constexpr float START_Y = 60.0f;
+    static constexpr float TITLE_HEIGHT = 24.0f;     // Caption above each section
+    static constexpr float RING_CELL = 26.0f;
+    static constexpr float RING_GAP = 3.0f;
+    static constexpr size_t RING_ROW_CELLS = 32;
+    static constexpr float SITE_WIDTH = 150.0f;      // Named sites (head, tail, top, lock)
+    static constexpr float SITE_HEIGHT = 56.0f;
+    static constexpr float SITE_GAP = 24.0f;
+    static constexpr float SECTION_GAP = 50.0f;
+    static constexpr float LANE_LABEL_WIDTH = 60.0f;
+    static constexpr float LANE_WIDTH = 900.0f;
+    static constexpr float LANE_HEIGHT = 22.0f;
+    static constexpr float LANE_GAP = 6.0f;
+    static constexpr float LANE_STATS_WIDTH = 260.0f;
+    static constexpr float HEAT_HALF_LIFE = 0.25f;   // Seconds for the heat to halve at speed 1
+    static constexpr size_t MAX_LANE_EVENTS = 1024;  // Ticks kept per lane
+    static constexpr size_t MAX_RESULTS = 64;
+    static constexpr size_t PROBE_LOG_CAPACITY = 8192;
+    static constexpr int MAX_THREADS_PER_SIDE = 16;
+    static constexpr int MIN_ITEMS = 1000;
+    static constexpr int MAX_ITEMS = 50000000;
+    static constexpr int MIN_RING_LOG2 = 2;
+    static constexpr int MAX_RING_LOG2 = 10;
+};
+
+} // namespace dsav
@@ -0,0 +1,66 @@
+/**
+ * @file dataset_import_panel.hpp
+ * @brief File path and format controls shared by the visualizers that import datasets
+ *
+ * The visualizers read the file on a worker thread through
+ * algorithms::DatasetReader; this only holds what the user typed and
+ * formats what the reader reports.
+ */
+
+#pragma once
+
+#include "algorithms/dataset_import.hpp"
+#include "ui_components.hpp"
+#include <imgui.h>
+#include <string>
+
+namespace dsav {
+
+/**
+ * @brief Path field and format picker
+ */
+class DatasetImportPanel {
+public:
+    /**
+     * @brief Draw the path and format fields
+     */
+    void render() {
+        ImGui::InputText("File", m_path, sizeof(m_path));
+        ui::Tooltip("Raw little-endian int32 (.i32) or int64 (.i64) keys, one decimal\n"
+                    "key per line (# starts a comment), or a compact key file");
+
+        // Indexed by algorithms::DatasetFormat
+        const char* formats[] = {"Auto", "int32 (raw)", "int64 (raw)", "Text", "Compact"};
+        ImGui::Combo("Format", &m_format, formats, IM_ARRAYSIZE(formats));
+    }
+
+    bool hasPath() const { return m_path[0] != '\0'; }
+    std::string path() const { return m_path; }
+    algorithms::DatasetFormat format() const { return static_cast<algorithms::DatasetFormat>(m_format); }
+
+    /**
+     * @brief One-line summary of a finished import, e.g. "2000000 keys (int64, sampled from 40000000)"
+     *
+     * @param info Reader state after the read
+     * @param loaded Keys the visualizer received
+     */
+    static std::string describe(const algorithms::DatasetInfo& info, size_t loaded) {
+        std::string text = std::to_string(loaded) + " keys (" + algorithms::datasetFormatName(info.format);
+        if (info.hasCount && info.count > loaded) {
+            text += ", sampled from " + std::to_string(info.count);
+        }
+        if (info.narrowed) {
+            text += ", offset and shifted right by " + std::to_string(info.narrowShift) + " bits";
+        }
+        if (info.hasSortedness && info.sortedness.isAscending()) {
+            text += ", sorted";
+        }
+        return text + ")";
+    }
+
+private:
+    char m_path[1024] = {};
+    int m_format = 0;
+};
+
+} // namespace dsav
@@ -0,0 +1,216 @@
+/**
+ * @file hash_map_visualizer.hpp
+ * @brief Visualizer for the open-addressing hash map
+ *
+ * Draws every slot of the table as a cell, sixteen to a row (one Swiss
+ * control-byte group per row), with each key's displacement from its home
+ * slot underneath. Lookups, inserts and erases replay their probe sequence
+ * from the map's event log. While an incremental rehash runs, the old table
+ * is drawn under the new one with its migration cursor, so the slots moving
+ * across a few per operation can be watched.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "data_structures/hash_map.hpp"
+#include "animation.hpp"
+#include "renderer.hpp"
+#include "color_scheme.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Interactive visualizer for HashMap in both probing modes
+ *
+ * Features:
+ * - Robin Hood or Swiss probing, switched by re-inserting the keys
+ * - Slot cells colored by displacement, Swiss tombstones shown as such
+ * - Probe sequence of every insert, find and remove, step by step
+ * - Incremental rehash with the old table, its cursor and a progress bar
+ * - Adjustable maximum load factor and rehash step
+ * - Probes, key comparisons and moves of the last operation
+ */
+class HashMapVisualizer : public IVisualizer {
+public:
+    /**
+     * @brief Construct a hash map visualizer
+     */
+    HashMapVisualizer();
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "Hash Map"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
+
+    // Hash map operations (with animation)
+    void insertKey(int key);
+    void findKey(int key);
+    void removeKey(int key);
+    void insertRandom(size_t count);
+    void clearMap();
+
+    /**
+     * @brief Switch probing scheme, re-inserting the current keys
+     */
+    void setMode(HashProbing mode);
+
+private:
+    using RobinHoodMap = HashMap<int, int, HashProbing::RobinHood>;
+    using SwissMap = HashMap<int, int, HashProbing::Swiss>;
+
+    /**
+     * @brief Work of one operation, read from the map's counters
+     */
+    struct OperationCost {
+        std::uint64_t probes = 0;       ///< Slots (Robin Hood) or groups (Swiss) looked at
+        std::uint64_t comparisons = 0;  ///< Key equality tests
+        std::uint64_t moves = 0;        ///< Entries written, including migrated ones
+    };
+
+    /**
+     * @brief Call f with the map of the current mode
+     */
+    template<typename F>
+    decltype(auto) withMap(F&& f) {
+        if (m_mode == HashProbing::Swiss) {
+            return f(m_swiss);
+        }
+        return f(m_robinHood);
+    }
+
+    template<typename F>
+    decltype(auto) withMap(F&& f) const {
+        if (m_mode == HashProbing::Swiss) {
+            return f(m_swiss);
+        }
+        return f(m_robinHood);
+    }
+
+    /**
+     * @brief Reset the current map's counters before an operation
+     */
+    void beginOperation();
+
+    /**
+     * @brief Record the counters of the operation just run
+     */
+    void endOperation(const char* name);
+
+    /**
+     * @brief Snap the cells to the map, then queue highlights for its new events
+     *
+     * Events logged before a rehash began refer to the table that is now
+     * the old one, and events on a table freed since are dropped.
+     *
+     * @param message Status text once the animation ends
+     */
+    void animateEvents(const std::string& message);
+
+    /**
+     * @brief Rebuild every cell from the map (no animation)
+     */
+    void syncVisuals();
+
+    /**
+     * @brief Rebuild the cells of one table
+     */
+    void buildTable(HashTableId table, std::vector<VisualElement>& cells, std::vector<HashSlotInfo>& infos);
+
+    /**
+     * @brief Resting fill color of a slot
+     */
+    glm::vec4 baseColor(const HashSlotInfo& info) const;
+
+    /**
+     * @brief Cell top-left of a slot (world space)
+     */
+    glm::vec2 cellPosition(HashTableId table, size_t slot) const;
+
+    /**
+     * @brief Top of a table's first row of cells (world space)
+     */
+    float tableTop(HashTableId table) const;
+
+    /**
+     * @brief Rows of cells a table needs
+     */
+    static size_t rowsFor(size_t capacity);
+
+    // Data (two modes, only m_mode's map holds the keys)
+    RobinHoodMap m_robinHood;
+    SwissMap m_swiss;
+    HashProbing m_mode = HashProbing::RobinHood;
+    std::vector<VisualElement> m_currentCells;     ///< One cell per slot of the current table
+    std::vector<VisualElement> m_oldCells;         ///< One cell per slot of the old table (while rehashing)
+    std::vector<HashSlotInfo> m_currentInfo;       ///< Slot contents behind m_currentCells
+    std::vector<HashSlotInfo> m_oldInfo;           ///< Slot contents behind m_oldCells
+    std::uint64_t m_eventCursor = 0;               ///< First map event not yet animated
+    AnimationController m_animator;                ///< Animation controller
+    CanvasCache m_canvasCache;                     ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;              ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedCurrent;   ///< Cells animated by the current step (drawn live), per m_currentCells
+    std::vector<std::uint8_t> m_animatedOld;       ///< Same, per m_oldCells
+    std::vector<std::uint8_t> m_animatedScratch;   ///< This frame's flags, swapped in when they change
+
+    // Last operation
+    bool m_hasCost = false;
+    std::string m_lastOperation;
+    OperationCost m_lastCost;
+
+    // UI state
+    std::string m_statusText;                      ///< Current status message
+    int m_inputValue = 0;                          ///< Key for the selected operation
+    int m_initCount = 10;                          ///< Number of keys for random insertion
+    float m_maxLoad = 0.8f;                        ///< Maximum load factor slider
+    int m_rehashStep = 2;                          ///< Old slots migrated per operation slider
+    bool m_isPaused = true;                        ///< Pause state
+    float m_speed = 1.0f;                          ///< Animation speed multiplier
+    HashTableId m_hoveredTable = HashTableId::Current;
+    size_t m_hoveredSlot = SIZE_MAX;               ///< Slot under the mouse (probe path drawn)
+
+    // Camera/viewport control for scrolling/panning
+    float m_cameraOffsetX = 0.0f;                  ///< Horizontal camera offset for panning
+    float m_cameraOffsetY = 0.0f;                  ///< Vertical camera offset for panning
+    float m_zoomLevel = 1.0f;                      ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
+    bool m_isDragging = false;                     ///< Mouse drag state for panning
+    ImVec2 m_lastMousePos;                         ///< Last mouse position for drag delta
+
+    // Operation mode
+    enum class OperationMode {
+        Insert,
+        Find,
+        Remove
+    };
+    OperationMode m_currentMode = OperationMode::Insert;
+
+    // Visual constants
+    static constexpr float CELL_WIDTH = 48.0f;
+    static constexpr float CELL_HEIGHT = 40.0f;
+    static constexpr float CELL_GAP = 4.0f;
+    static constexpr float ROW_SPACING = 64.0f;     // Cell plus its displacement label
+    static constexpr float TABLE_GAP = 60.0f;       // Between the current and the old table
+    static constexpr float TITLE_HEIGHT = 24.0f;    // Table caption above the first row
+    static constexpr float START_X = 60.0f;
+    static constexpr float START_Y = 50.0f;
+    static constexpr size_t ROW_CELLS = hash_detail::GROUP_WIDTH;
+    static constexpr size_t INITIAL_CAPACITY = 16;
+    static constexpr int MAX_INIT_COUNT = 64;
+    static constexpr size_t MAX_ELEMENTS = 400;
+};
+
+} // namespace dsav
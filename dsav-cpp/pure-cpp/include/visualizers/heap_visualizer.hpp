@@ -0,0 +1,239 @@
+/**
+ * @file heap_visualizer.hpp
+ * @brief Visualizer for binary and d-ary heap priority queues
+ *
+ * Draws the heap twice: as the implicit complete tree and, beneath it, as
+ * the flat array the tree really is, with every element moving in both views
+ * at once. Sift steps are replayed from the heap's event log, so the
+ * animation shows exactly the swaps the heap made. The arity can be switched
+ * between 2, 3 and 4 to see a wider heap get shallower while the children of
+ * a slot stay adjacent in the array.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "data_structures/dary_heap.hpp"
+#include "animation.hpp"
+#include "renderer.hpp"
+#include "color_scheme.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Visual representation of one heap element (indexed by heap handle)
+ */
+struct VisualHeapItem {
+    glm::vec2 treePosition;      ///< Node center in the tree view (world space)
+    glm::vec2 arrayPosition;     ///< Cell top-left in the array view (world space)
+    glm::vec4 color;
+    glm::vec4 borderColor;
+    LabelId label = NO_LABEL;
+    bool active = false;         ///< Handle holds a queued element
+};
+
+/**
+ * @brief Interactive visualizer for d-ary heaps
+ *
+ * Features:
+ * - Implicit tree and flat array side by side, animated together
+ * - Insert (sift-up), extract-min (sift-down) and decrease-key by slot
+ * - O(n) heapify of random values, with the work n pushes would have done
+ * - Arity 2, 3 or 4, switched by re-heapifying the current elements
+ * - Comparisons, moves and levels walked by the last operation
+ */
+class HeapVisualizer : public IVisualizer {
+public:
+    /// Arities the view can switch between
+    static constexpr int MIN_ARITY = 2;
+    static constexpr int MAX_ARITY = 4;
+
+    /**
+     * @brief Construct a heap visualizer
+     */
+    HeapVisualizer();
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "Priority Queue (Heap)"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
+
+    // Heap-specific operations (with animation)
+    void insertValue(int value);
+    void extractTop();
+    void decreaseKey(size_t slot, int value);
+    void initializeRandom(size_t count);
+    void clearHeap();
+
+    /**
+     * @brief Rebuild the current elements as a heap of another arity (animated heapify)
+     */
+    void setArity(int arity);
+
+private:
+    using Handle = std::uint32_t;
+
+    /**
+     * @brief Work of one operation, read from the heap's counters
+     */
+    struct OperationCost {
+        std::uint64_t comparisons = 0;
+        std::uint64_t moves = 0;
+        std::uint64_t levels = 0;
+    };
+
+    /**
+     * @brief Call f with the heap of the current arity
+     */
+    template<typename F>
+    decltype(auto) withHeap(F&& f) {
+        switch (m_arity) {
+            case 3:  return f(m_heap3);
+            case 4:  return f(m_heap4);
+            default: return f(m_heap2);
+        }
+    }
+
+    template<typename F>
+    decltype(auto) withHeap(F&& f) const {
+        switch (m_arity) {
+            case 3:  return f(m_heap3);
+            case 4:  return f(m_heap4);
+            default: return f(m_heap2);
+        }
+    }
+
+    size_t heapSize() const;
+
+    /**
+     * @brief Reset the counters of the current heap and start its event log afresh
+     */
+    void beginOperation();
+
+    /**
+     * @brief Record the counters of the operation just run
+     */
+    void endOperation(const char* name);
+
+    /**
+     * @brief Queue animations for the events the heap logged since beginOperation()
+     *
+     * m_slotHandles describes the drawn state before the operation and is
+     * advanced event by event, so every step's targets are where the moved
+     * elements are at that point of the replay.
+     *
+     * @param pushed Handle returned by a push (for its Push event)
+     * @param message Status text once the animation ends
+     */
+    void animateEvents(Handle pushed, const std::string& message);
+
+    /**
+     * @brief Snap every visual to the heap (no animation)
+     */
+    void syncVisuals();
+
+    /**
+     * @brief Make room for a handle and set up its item at a slot
+     */
+    VisualHeapItem& activateItem(Handle handle, size_t slot, size_t levels);
+
+    /**
+     * @brief Queue a move of every drawn element to the layout for a new depth
+     */
+    void enqueueRelayout(size_t levels);
+
+    /**
+     * @brief Levels of a complete tree of n elements in the current arity
+     */
+    size_t levelsFor(size_t n) const;
+
+    /**
+     * @brief Node center of a slot in the tree view
+     */
+    glm::vec2 treeSlotPosition(size_t slot, size_t levels) const;
+
+    /**
+     * @brief Cell top-left of a slot in the array view
+     */
+    glm::vec2 arraySlotPosition(size_t slot, size_t levels) const;
+
+    /**
+     * @brief First slot of a tree level
+     */
+    size_t levelStart(size_t level) const;
+
+    // Data (three arities, only m_arity's one holds the elements)
+    IndexedDaryHeap<int, 2> m_heap2;
+    IndexedDaryHeap<int, 3> m_heap3;
+    IndexedDaryHeap<int, 4> m_heap4;
+    int m_arity = 2;
+    std::vector<VisualHeapItem> m_items;           ///< Visuals indexed by heap handle
+    std::vector<Handle> m_slotHandles;             ///< Drawn handle per slot (end state of queued animations)
+    size_t m_drawnLevels = 0;                      ///< Tree depth the drawn positions are laid out for
+    std::uint64_t m_eventCursor = 0;               ///< First heap event not yet animated
+    AnimationController m_animator;                ///< Animation controller
+    CanvasCache m_canvasCache;                     ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;              ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedItems;     ///< Items animated by the current step (drawn live), per m_items
+    std::vector<std::uint8_t> m_animatedScratch;   ///< This frame's flags, swapped in when they change
+
+    // Last operation
+    bool m_hasCost = false;
+    std::string m_lastOperation;
+    OperationCost m_lastCost;
+    bool m_hasBuildComparison = false;             ///< Set by initializeRandom()
+    OperationCost m_heapifyCost;                   ///< Heapify of the random values
+    OperationCost m_pushesCost;                    ///< Pushing the same values one by one
+
+    // UI state
+    std::string m_statusText;                      ///< Current status message
+    int m_inputValue = 0;                          ///< Value for insert / new key
+    int m_inputSlot = 0;                           ///< Slot for decrease-key
+    bool m_isPaused = true;                        ///< Pause state
+    float m_speed = 1.0f;                          ///< Animation speed multiplier
+    int m_initCount = 15;                          ///< Number of values for random initialization
+    size_t m_hoveredSlot = SIZE_MAX;               ///< Slot under the mouse (children highlighted)
+
+    // Camera/viewport control for scrolling/panning
+    float m_cameraOffsetX = 0.0f;                  ///< Horizontal camera offset for panning
+    float m_cameraOffsetY = 0.0f;                  ///< Vertical camera offset for panning
+    float m_zoomLevel = 1.0f;                      ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
+    bool m_isDragging = false;                     ///< Mouse drag state for panning
+    ImVec2 m_lastMousePos;                         ///< Last mouse position for drag delta
+
+    // Operation mode
+    enum class OperationMode {
+        Insert,
+        ExtractMin,
+        DecreaseKey
+    };
+    OperationMode m_currentMode = OperationMode::Insert;
+
+    // Visual constants
+    static constexpr float NODE_RADIUS = 20.0f;
+    static constexpr float LEAF_PITCH = 48.0f;      // Horizontal distance between bottom-level slots
+    static constexpr float LEVEL_SPACING = 80.0f;   // Vertical distance between levels
+    static constexpr float CELL_WIDTH = 44.0f;
+    static constexpr float CELL_HEIGHT = 40.0f;
+    static constexpr float ARRAY_GAP = 70.0f;       // Between the deepest level and the array
+    static constexpr float START_X = 60.0f;
+    static constexpr float START_Y = 60.0f;
+    static constexpr int MAX_INIT_COUNT = 64;
+    static constexpr size_t MAX_ELEMENTS = 200;
+};
+
+} // namespace dsav
@@ -4,18 +4,23 @@
  *
  * Provides interactive visualization of linked list operations with smooth animations.
  * Shows nodes as boxes with arrows representing pointer connections.
+ * The list sits behind a ListBackend, so the same view draws the C++ list
+ * or the assembly one.
  */
 
 #pragma once
 
 #include "visualizer.hpp"
-#include "data_structures/linked_list.hpp"
+#include "visualizers/list_backend.hpp"
 #include "animation.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
+#include "visualizers/minimap_panel.hpp"
+#include "algorithms/density_summary.hpp"
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 #include <imgui.h>
 
 namespace dsav {
@@ -28,7 +33,7 @@ struct VisualNode {
     glm::vec2 size;
     glm::vec4 color;
     glm::vec4 borderColor;
-    std::string label;
+    LabelId label = NO_LABEL;
     bool hasNext;  // Whether this node has a next pointer
     bool isNull;   // Whether this is the NULL terminator node
 };
@@ -43,14 +48,31 @@ struct VisualNode {
  * - HEAD pointer indicator
  * - NULL indicator at the end
  * - Interactive controls for list manipulation
+ * - Singly or doubly linked storage, with the pointer hops of the last
+ *   operation next to what a head-only singly linked list would need
  */
 class LinkedListVisualizer : public IVisualizer {
 public:
+    /**
+     * @brief Pool-backed list the default visualizer can switch between
+     */
+    enum class ListVariant {
+        Singly,     ///< LinkedList: head and tail pointers
+        Doubly      ///< DoublyLinkedList: prev links as well
+    };
+
     /**
      * @brief Construct a linked list visualizer
      */
     LinkedListVisualizer();
 
+    /**
+     * @brief Construct a linked list visualizer over another storage backend
+     *
+     * @param backend List to drive and draw
+     */
+    explicit LinkedListVisualizer(std::unique_ptr<ListBackend> backend);
+
     // IVisualizer interface implementation
     void update(float deltaTime) override;
     void renderVisualization() override;
@@ -61,9 +83,10 @@ public:
     void reset() override;
     void setSpeed(float speed) override;
     std::string getStatusText() const override;
-    std::string getName() const override { return "Linked List"; }
+    std::string getName() const override { return m_list->name(); }
     bool isAnimating() const override;
     bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
 
     // Linked list-specific operations (with animation)
     void insertFrontValue(int value);
@@ -75,7 +98,30 @@ public:
     void searchValue(int value);
     void initializeRandom(size_t count);
 
+    /**
+     * @brief Move the current values into another list variant
+     *
+     * Only available on the pool-backed lists (not over an external backend).
+     */
+    void setVariant(ListVariant variant);
+
 private:
+    /**
+     * @brief Hops counted by the backend so far (0 if it doesn't count)
+     */
+    std::uint64_t hopCount() const;
+
+    /**
+     * @brief Store the hops of an operation for the controls readout
+     *
+     * @param operation Operation name
+     * @param hopsBefore hopCount() before the operation
+     * @param headOnlyHops Hops the same operation costs a singly linked list without a tail pointer
+     */
+    void recordHops(const char* operation, std::uint64_t hopsBefore, std::uint64_t headOnlyHops);
+
+    void renderHopReadout();
+
     /**
      * @brief Sync visual nodes with current list state
      */
@@ -89,6 +135,11 @@ private:
      */
     glm::vec2 calculatePosition(size_t index) const;
 
+    /**
+     * @brief Pan the camera so a node index (may be fractional) sits at the canvas center
+     */
+    void centerOn(double index);
+
     /**
      * @brief Draw arrow from one node to another
      *
@@ -100,9 +151,29 @@ private:
     void drawArrow(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color);
 
     // Data
-    LinkedList<int> m_list;                    ///< Underlying linked list data structure
+    std::unique_ptr<ListBackend> m_list;       ///< Underlying list storage
+    std::vector<int> m_values;                 ///< List values head first, refreshed by syncVisuals
     std::vector<VisualNode> m_visualNodes;     ///< Visual representation of nodes
+
+    // Minimap
+    algorithms::ValueSummary m_summary;        ///< Value pyramid over the list in order, updated by syncVisuals
+    std::vector<int> m_summaryValues;          ///< Values m_summary was last updated from
+    MinimapPanel m_minimap;
+    float m_canvasWidth = 0.0f;                ///< Last canvas width, for centering minimap jumps
+    double m_viewFirst = 0.0;                  ///< Node index range the canvas showed last frame
+    double m_viewLast = 0.0;
     AnimationController m_animator;            ///< Animation controller
+    CanvasCache m_canvasCache;                 ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;          ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedNodes;     ///< Nodes animated by the current step (drawn live)
+    std::vector<std::uint8_t> m_animatedScratch;   ///< This frame's flags, swapped in when they change
+    ListVariant m_variant = ListVariant::Singly;
+    bool m_canSwitchVariant = false;           ///< True when the list is one of the pooled variants
+
+    // Pointer hops of the last counted operation
+    std::string m_hopOperation;                ///< Empty until an operation was counted
+    std::uint64_t m_lastHops = 0;              ///< Hops this list made
+    std::uint64_t m_headOnlyHops = 0;          ///< Hops a head-only singly list would make
 
     // UI state
     std::string m_statusText;                  ///< Current status message
@@ -0,0 +1,138 @@
+/**
+ * @file list_backend.hpp
+ * @brief Storage behind the linked list visualizer
+ *
+ * LinkedListVisualizer reads and edits the list through this interface, so
+ * the same rendering and animation code runs over the pool-backed
+ * LinkedList<int> or DoublyLinkedList<int>, or (in the asm-linked build)
+ * the assembly list.
+ */
+
+#pragma once
+
+#include "data_structures/linked_list.hpp"
+#include "data_structures/doubly_linked_list.hpp"
+#include "data_structures/op_counters.hpp"
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief List operations the visualizer needs
+ *
+ * Positional operations can be narrower than on LinkedList: a backend
+ * reports which indices it can insert at or delete from, and the visualizer
+ * disables the rest.
+ */
+class ListBackend {
+public:
+    virtual ~ListBackend() = default;
+
+    /// Visualizer name reported to the app
+    virtual const char* name() const = 0;
+
+    /// Why some positions are refused (empty if every index is supported)
+    virtual const char* positionalLimits() const { return ""; }
+
+    virtual bool insertFront(int value) = 0;
+    virtual bool insertBack(int value) = 0;
+
+    /**
+     * @brief Append values in order (backends with a bulk path override this)
+     */
+    virtual void appendValues(const std::vector<int>& values) {
+        for (int value : values) {
+            insertBack(value);
+        }
+    }
+
+    /**
+     * @brief Insert before the node at index (index == size() appends)
+     *
+     * @return false if canInsertAt(index) is false
+     */
+    virtual bool insertAt(size_t index, int value) = 0;
+
+    virtual std::optional<int> deleteFront() = 0;
+    virtual std::optional<int> deleteBack() = 0;
+
+    /**
+     * @brief Delete the node at index
+     *
+     * @return The deleted value, or std::nullopt if canDeleteAt(index) is false
+     */
+    virtual std::optional<int> deleteAt(size_t index) = 0;
+
+    virtual bool canInsertAt(size_t index) const { return index <= size(); }
+    virtual bool canDeleteAt(size_t index) const { return index < size(); }
+
+    virtual void clear() = 0;
+    virtual size_t size() const = 0;
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * @brief Copy the values head first into out, reusing its storage
+     */
+    virtual void values(std::vector<int>& out) const = 0;
+
+    /**
+     * @brief Work counted by the list so far, or nullptr if it doesn't count
+     */
+    virtual const OpCounters* opCounters() const { return nullptr; }
+};
+
+/**
+ * @brief Backend over one of the pure C++ pool-backed lists
+ *
+ * @tparam List LinkedList<int> or DoublyLinkedList<int>
+ */
+template<typename List>
+class PooledListBackend final : public ListBackend {
+public:
+    const char* name() const override { return "Linked List"; }
+
+    bool insertFront(int value) override {
+        m_list.insertFront(value);
+        return true;
+    }
+
+    bool insertBack(int value) override {
+        m_list.insertBack(value);
+        return true;
+    }
+
+    void appendValues(const std::vector<int>& values) override {
+        m_list.appendRange(values.begin(), values.end());
+    }
+
+    bool insertAt(size_t index, int value) override { return m_list.insertAt(index, value); }
+
+    std::optional<int> deleteFront() override { return m_list.deleteFront(); }
+    std::optional<int> deleteBack() override { return m_list.deleteBack(); }
+    std::optional<int> deleteAt(size_t index) override { return m_list.deleteAt(index); }
+
+    void clear() override { m_list.clear(); }
+    size_t size() const override { return m_list.size(); }
+
+    void values(std::vector<int>& out) const override {
+        out.clear();
+        for (auto node = m_list.head(); node; node = node.next()) {
+            out.push_back(node->data);
+        }
+    }
+
+    const OpCounters* opCounters() const override { return &m_list.opCounters(); }
+
+private:
+    List m_list;                               ///< Underlying linked list
+};
+
+/// Backend over the singly linked list (head and tail pointers)
+using CppListBackend = PooledListBackend<LinkedList<int>>;
+
+/// Backend over the doubly linked list
+using CppDoublyListBackend = PooledListBackend<DoublyLinkedList<int>>;
+
+} // namespace dsav
@@ -0,0 +1,85 @@
+/**
+ * @file minimap_panel.hpp
+ * @brief Minimap overview shared by the visualizers of large containers
+ *
+ * Renders an algorithms::ValueSummary (a value band per column) or an
+ * algorithms::TreeDensity (node density per depth band and position) into
+ * one small texture, outlines the part of the container the canvas shows
+ * and reports where the user clicks or drags so the visualizer can move
+ * its camera there. The texture is only refilled when the summary's
+ * version changes, so an idle minimap costs a single quad.
+ */
+
+#pragma once
+
+#include "algorithms/density_summary.hpp"
+#include "renderer.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Click-to-navigate overview of a sequence or a tree
+ */
+class MinimapPanel {
+public:
+    static constexpr int SEQUENCE_ROWS = 64;     ///< Texture height of a sequence overview
+    static constexpr float HEIGHT = 96.0f;       ///< On-screen height of the overview
+
+    /**
+     * @brief Draw the min / max / mean overview of a sequence
+     *
+     * @param viewFirst First visible index (may be fractional)
+     * @param viewLast One past the last visible index
+     * @param jumpTo Set to the index under the mouse while the overview is clicked or dragged
+     * @return true if jumpTo was set
+     */
+    bool renderSequence(const algorithms::ValueSummary& summary, double viewFirst, double viewLast,
+                        double& jumpTo);
+
+    /**
+     * @brief Draw the node density overview of a tree
+     *
+     * @param viewMin Visible world x and depth at the canvas' top-left corner
+     * @param viewMax Visible world x and depth at its bottom-right corner
+     * @param jumpTo Set to the world x and depth under the mouse while clicked or dragged
+     * @return true if jumpTo was set
+     */
+    bool renderTree(const algorithms::TreeDensity& density, const glm::vec2& viewMin, const glm::vec2& viewMax,
+                    glm::vec2& jumpTo);
+
+    /**
+     * @brief Force a refill on the next render (e.g. after the summary was replaced)
+     */
+    void invalidate() { m_source = nullptr; }
+
+private:
+    /**
+     * @brief Place the texture, the view outline and the hit area
+     *
+     * @param viewMin, viewMax Visible part as fractions of the overview
+     * @param pick Set to the fraction under the mouse while pressed
+     * @param hover Set to the fraction under the mouse while hovered
+     * @return Bit 0: pressed, bit 1: hovered
+     */
+    int drawOverview(const char* id, const ImVec2& viewMin, const ImVec2& viewMax, ImVec2& pick, ImVec2& hover);
+
+    void fillSequence(const algorithms::ValueSummary& summary);
+    void fillTree(const algorithms::TreeDensity& density);
+
+    PixelTexture m_texture;
+    std::vector<std::uint32_t> m_pixels;
+    std::vector<algorithms::ValueBucket> m_columns;  ///< Last sequence query, for the hover readout
+
+    // What the texture shows
+    const void* m_source = nullptr;
+    std::uint64_t m_version = 0;
+
+    // Tree readout, refreshed with the texture
+    size_t m_widestDepth = 0;
+    std::uint32_t m_widestCount = 0;
+};
+
+} // namespace dsav
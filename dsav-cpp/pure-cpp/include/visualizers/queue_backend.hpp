@@ -0,0 +1,120 @@
+/**
+ * @file queue_backend.hpp
+ * @brief Storage behind the queue visualizer
+ *
+ * QueueVisualizer only draws slots and animates what the queue reports, so
+ * it reads the queue through this interface. CppQueueBackend wraps the
+ * block-based Queue<int, DYNAMIC_CAPACITY>; the asm-linked build supplies a
+ * backend over the assembly ring buffer and reuses the same visualizer.
+ */
+
+#pragma once
+
+#include "data_structures/queue.hpp"
+#include <cstddef>
+#include <optional>
+
+namespace dsav {
+
+/**
+ * @brief Queue operations and layout the visualizer needs
+ *
+ * Slot numbers are whatever the storage uses: the block queue counts from
+ * the first live block, a ring buffer wraps around at capacity().
+ */
+class QueueBackend {
+public:
+    virtual ~QueueBackend() = default;
+
+    /// Visualizer name reported to the app
+    virtual const char* name() const = 0;
+
+    /// Short description of the storage, shown under the queue
+    virtual const char* layoutHint() const = 0;
+
+    /**
+     * @brief Enqueue a value at the rear
+     *
+     * @return false if the queue is full
+     */
+    virtual bool enqueue(int value) = 0;
+
+    /**
+     * @brief Dequeue the front value
+     *
+     * @return The value, or std::nullopt if the queue is empty
+     */
+    virtual std::optional<int> dequeue() = 0;
+
+    virtual std::optional<int> peek() const = 0;
+    virtual void clear() = 0;
+
+    virtual size_t size() const = 0;
+    virtual size_t capacity() const = 0;
+    bool isEmpty() const { return size() == 0; }
+    virtual bool isFull() const = 0;
+
+    /// Slot of the front element
+    virtual size_t frontIndex() const = 0;
+    /// Slot the next enqueue writes to
+    virtual size_t rearIndex() const = 0;
+    /// Slot holding the element at a queue position (0 = front)
+    virtual size_t slotOf(size_t position) const = 0;
+    /// Element at a queue position (0 = front)
+    virtual int atPosition(size_t position) const = 0;
+
+    virtual size_t blockSize() const = 0;
+    virtual size_t blockCount() const = 0;
+    virtual size_t spareBlockCount() const = 0;
+
+    /**
+     * @brief Block hand-offs to animate
+     *
+     * @return The event log, or nullptr if the storage never changes shape
+     */
+    virtual const CapacityEventLog* eventLog() const { return nullptr; }
+};
+
+/**
+ * @brief Backend over the pure C++ block-based queue
+ */
+class CppQueueBackend final : public QueueBackend {
+public:
+    /**
+     * @param blockSize Slots per storage block
+     */
+    explicit CppQueueBackend(size_t blockSize) : m_queue(blockSize) {
+        m_queue.enableEventRecording();
+    }
+
+    const char* name() const override { return "Queue"; }
+
+    const char* layoutHint() const override {
+        return "Block queue: a full rear block gets a new block, a drained front block is retired";
+    }
+
+    bool enqueue(int value) override { return m_queue.enqueue(value); }
+    std::optional<int> dequeue() override { return m_queue.dequeue(); }
+    std::optional<int> peek() const override { return m_queue.peek(); }
+    void clear() override { m_queue.clear(); }
+
+    size_t size() const override { return m_queue.size(); }
+    size_t capacity() const override { return m_queue.capacity(); }
+    bool isFull() const override { return m_queue.isFull(); }
+
+    size_t frontIndex() const override { return m_queue.frontIndex(); }
+    size_t rearIndex() const override { return m_queue.rearIndex(); }
+    size_t slotOf(size_t position) const override { return m_queue.frontIndex() + position; }
+    int atPosition(size_t position) const override { return m_queue.atPosition(position); }
+
+    size_t blockSize() const override { return m_queue.blockSize(); }
+    size_t blockCount() const override { return m_queue.blockCount(); }
+    size_t spareBlockCount() const override { return m_queue.spareBlockCount(); }
+
+    const CapacityEventLog* eventLog() const override { return &m_queue; }
+
+private:
+    Queue<int, DYNAMIC_CAPACITY> m_queue;      ///< Underlying queue (block-based)
+};
+
+} // namespace dsav
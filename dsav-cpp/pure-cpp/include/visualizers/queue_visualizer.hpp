@@ -4,15 +4,20 @@
  *
  * Provides interactive visualization of queue operations with smooth animations.
  * Displays queue as a horizontal arrangement with front and rear indicators.
+ * The queue itself sits behind a QueueBackend, so the same view draws the
+ * C++ block queue or the assembly ring buffer.
  */
 
 #pragma once
 
 #include "visualizer.hpp"
-#include "data_structures/queue.hpp"
+#include "visualizers/queue_backend.hpp"
 #include "animation.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
+#include "visualizers/workload_panel.hpp"
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include <imgui.h>
@@ -24,8 +29,9 @@ namespace dsav {
  *
  * Features:
  * - Horizontal layout showing elements from front to rear
- * - Circular buffer visualization with array indices
+ * - Block-by-block storage layout with slot indices
  * - Smooth animations for enqueue/dequeue operations
+ * - Block allocation, reuse and retirement animations
  * - Front and rear pointer indicators
  * - Interactive controls for queue manipulation
  */
@@ -34,9 +40,16 @@ public:
     /**
      * @brief Construct a queue visualizer
      *
-     * @param maxSize Maximum queue capacity (default 16)
+     * @param blockSize Slots per storage block (default 8); the queue grows a block at a time
      */
-    explicit QueueVisualizer(size_t maxSize = 16);
+    explicit QueueVisualizer(size_t blockSize = 8);
+
+    /**
+     * @brief Construct a queue visualizer over another storage backend
+     *
+     * @param backend Queue to drive and draw
+     */
+    explicit QueueVisualizer(std::unique_ptr<QueueBackend> backend);
 
     // IVisualizer interface implementation
     void update(float deltaTime) override;
@@ -48,10 +61,22 @@ public:
     void reset() override;
     void setSpeed(float speed) override;
     std::string getStatusText() const override;
-    std::string getName() const override { return "Queue"; }
+    std::string getName() const override { return m_queue->name(); }
     bool isAnimating() const override;
     bool isPaused() const override;
 
+    // Snapshots (elements front to rear; any backend can load them)
+    bool supportsSnapshots() const override { return true; }
+    bool saveSnapshot(const std::string& path) override;
+    bool loadSnapshot(const std::string& path) override;
+
+    // Timeline (the active workload replay)
+    bool hasTimeline() const override { return m_workload.replay().isActive(); }
+    bool stepBack() override;
+    bool seek(size_t step) override;
+    size_t currentStep() const override { return m_workload.replay().position(); }
+    size_t stepCount() const override { return m_workload.replay().size(); }
+
     // Queue-specific operations (with animation)
     void enqueueValue(int value);
     void dequeueValue();
@@ -69,15 +94,42 @@ private:
     /**
      * @brief Calculate position for element at given array index
      *
-     * Elements are arranged horizontally in a circular pattern.
+     * Slots are arranged horizontally, block after block.
      *
-     * @param arrayIndex Array index in the circular buffer
+     * @param arrayIndex Slot index, counted from the first live block
      * @return Position for rendering
      */
     glm::vec2 calculatePosition(size_t arrayIndex) const;
 
+    /**
+     * @brief Number of slots to draw (at least one block, even when empty)
+     */
+    size_t shownSlots() const;
+
+    /**
+     * @brief Animate the block hand-offs the queue logged since the last call
+     *
+     * @return Number of new events
+     */
+    size_t animateCapacityEvents();
+
+    /**
+     * @brief Mark every logged event as already shown
+     */
+    void skipCapacityEvents();
+
+    /**
+     * @brief Animate a workload op the replay sampled (enqueue, dequeue or peek)
+     */
+    void animateWorkloadOp(const algorithms::WorkloadOp& op);
+
+    /**
+     * @brief Show the contents a replay reached without animating
+     */
+    void syncWorkload();
+
     // Data
-    Queue<int, 16> m_queue;                    ///< Underlying queue data structure
+    std::unique_ptr<QueueBackend> m_queue;     ///< Underlying queue storage
     std::vector<VisualElement> m_elements;     ///< Visual representation of queue elements
     AnimationController m_animator;            ///< Animation controller
 
@@ -87,6 +139,12 @@ private:
     bool m_isPaused = true;                    ///< Pause state
     float m_speed = 1.0f;                      ///< Animation speed multiplier
     int m_initCount = 16;                      ///< Number of elements for random initialization
+    WorkloadPanel m_workload;                  ///< Workload script and replay
+
+    // Block animation state
+    std::uint64_t m_eventCursor = 0;           ///< Sequence number of the next unseen capacity event
+    size_t m_newSlotsFrom = 0;                 ///< First slot of the last block added
+    float m_blockFlash = 0.0f;                 ///< Remaining highlight time for that block
 
     // Camera/viewport control for scrolling/panning
     float m_cameraOffsetX = 0.0f;              ///< Horizontal camera offset for panning
@@ -100,6 +158,9 @@ private:
     static constexpr float ELEMENT_SPACING = 15.0f;
     static constexpr float START_X = 150.0f;
     static constexpr float START_Y = 100.0f;
+    static constexpr float BLOCK_FLASH_SECONDS = 0.8f;  ///< How long a new block stays highlighted
+    static constexpr int MAX_INIT_COUNT = 100000;        ///< Largest random initialization
+    static constexpr size_t MAX_CASCADE = 16;            ///< Elements animated by initialization
 };
 
 } // namespace dsav
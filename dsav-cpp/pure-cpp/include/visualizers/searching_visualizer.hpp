@@ -10,7 +10,11 @@
 
 #include "visualizer.hpp"
 #include "algorithms/searching.hpp"
+#include "algorithms/timeline.hpp"
 #include "animation.hpp"
+#include "step_budget.hpp"
+#include "job_system.hpp"
+#include "visualizers/dataset_import_panel.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
 #include <vector>
@@ -28,7 +32,7 @@ struct VisualSearchElement {
     glm::vec2 size;
     glm::vec4 color;
     glm::vec4 borderColor;
-    std::string label;
+    LabelId label = NO_LABEL;
     int value;
     bool isChecked = false;
     bool isFound = false;
@@ -38,10 +42,12 @@ struct VisualSearchElement {
  * @brief Interactive visualizer for search algorithms
  *
  * Features:
- * - Linear Search and Binary Search
+ * - Linear, binary, branchless binary, Eytzinger, interpolation and exponential search
+ * - Memory-access plot of every element each search has read so far
  * - Step-by-step execution with animations
  * - Color-coded states (checking, found, not checked)
  * - Array initialization and target input
+ * - Evenly spaced sample of a dataset file, to search a recorded key distribution
  * - Speed control and playback
  */
 class SearchingVisualizer : public IVisualizer {
@@ -50,6 +56,7 @@ public:
      * @brief Construct a searching visualizer
      */
     SearchingVisualizer();
+    ~SearchingVisualizer() override;
 
     // IVisualizer interface implementation
     void update(float deltaTime) override;
@@ -64,6 +71,11 @@ public:
     std::string getName() const override { return "Search Algorithms"; }
     bool isAnimating() const override;
     bool isPaused() const override;
+    bool hasTimeline() const override { return m_timeline.isActive(); }
+    bool stepBack() override;
+    bool seek(size_t step) override;
+    size_t currentStep() const override { return m_timeline.position(); }
+    size_t stepCount() const override { return m_timeline.stepCount(); }
 
     // Search-specific operations
     void startSearch();
@@ -71,6 +83,15 @@ public:
     void sortArray();  // For binary search
     void setArray(const std::vector<int>& arr);
 
+    /**
+     * @brief Replace the array with an evenly spaced sample of a dataset file (worker thread)
+     *
+     * Every element is drawn as a cell, so MAX_ARRAY_SIZE keys are taken:
+     * the quantiles of a sorted file, which keeps its skew for interpolation
+     * search to run into.
+     */
+    void importDataset(const std::string& path, algorithms::DatasetFormat format);
+
 private:
     /**
      * @brief Sync visual elements with current array state
@@ -87,11 +108,76 @@ private:
      */
     void executeStep();
 
+    /**
+     * @brief Turbo mode: run as many steps as fit in the frame budget, then sync once
+     */
+    void executeTurboBatch();
+
+    /**
+     * @brief Advance the active searcher by one step (no visual sync)
+     *
+     * Behind the recorded frontier this replays the next recorded step
+     * instead of running the search.
+     *
+     * @return true if more steps remain
+     */
+    bool advanceSearcher();
+
+    /**
+     * @brief Highlight state of the active searcher, packed for the timeline
+     */
+    algorithms::StepCursor captureCursor() const;
+
+    /**
+     * @brief Cursor of the shown step (recorded or live)
+     */
+    const algorithms::StepCursor& cursor() const;
+
+    /**
+     * @brief Check whether the active searcher has finished
+     */
+    bool searcherComplete() const;
+
+    /**
+     * @brief Set the final status text (found/not found) from the shown step
+     */
+    void describeResult();
+
+    /**
+     * @brief Set the status text from the active searcher's current state
+     */
+    void describeStep();
+
     /**
      * @brief Update element colors based on current state
      */
     void updateColors();
 
+    /**
+     * @brief Draw the probe order under the array, one row per element read
+     */
+    void renderAccessPattern(ImDrawList* drawList, ImVec2 canvasPos, ImVec2 canvasSize) const;
+
+    /**
+     * @brief Check whether the selected algorithm needs the array sorted
+     */
+    bool needsSortedArray() const;
+
+    /**
+     * @brief Install an imported sample (job completion)
+     */
+    void finishImport(std::vector<int>& keys, bool ok, const std::string& message);
+
+    /**
+     * @brief Widen the target range to the array's values
+     */
+    void updateTargetRange();
+
+    /**
+     * @brief Comparisons the active searcher has made (0 if none is running)
+     */
+    size_t searcherComparisons() const;
+
     // Data
     std::vector<int> m_array;                          ///< Array being searched
     std::vector<VisualSearchElement> m_elements;       ///< Visual representation
@@ -100,12 +186,33 @@ private:
     // Algorithm state
     enum class Algorithm {
         LinearSearch,
-        BinarySearch
+        BinarySearch,
+        BranchlessBinarySearch,
+        EytzingerSearch,
+        InterpolationSearch,
+        ExponentialSearch
     };
     Algorithm m_currentAlgorithm = Algorithm::LinearSearch;
 
     std::unique_ptr<algorithms::LinearSearchStepper> m_linearSearcher;
     std::unique_ptr<algorithms::BinarySearchStepper> m_binarySearcher;
+    std::unique_ptr<algorithms::BranchlessBinarySearchStepper> m_branchlessSearcher;
+    std::unique_ptr<algorithms::EytzingerSearchStepper> m_eytzingerSearcher;
+    std::unique_ptr<algorithms::InterpolationSearchStepper> m_interpolationSearcher;
+    std::unique_ptr<algorithms::ExponentialSearchStepper> m_exponentialSearcher;
+
+    /// One element read by the live searcher
+    struct Probe {
+        size_t step;    ///< Step (1-based) that read it
+        int index;
+    };
+    std::vector<Probe> m_probes;                       ///< Reads of the current search, in order
+    size_t m_liveSteps = 0;                            ///< Steps the searcher itself has run
+
+    // Step history (stepBack/seek)
+    algorithms::ArrayTimeline m_timeline;              ///< Recorded cursors of the current search
+    algorithms::StepCursor m_liveCursor;               ///< Cursor of the searcher when no history is kept
+    bool m_recordHistory = true;                       ///< Record a timeline for new searches
 
     // UI state
     std::string m_statusText;                          ///< Current status message
@@ -114,8 +221,15 @@ private:
     float m_speed = 1.0f;                              ///< Animation speed multiplier
     int m_arraySize = 10;                              ///< Size of array to search
     int m_target = 50;                                 ///< Target value to find
+    int m_targetMin = 1;                               ///< Target input range (covers the array)
+    int m_targetMax = MAX_VALUE;
+    DatasetImportPanel m_importPanel;                  ///< Path and format of the next import
+    JobHandle m_importJob;                             ///< Import in flight (nullptr if none)
     int m_stepDelay = 500;                             ///< Delay between steps (ms)
     float m_timeSinceLastStep = 0.0f;                  ///< Time accumulator for auto-step
+    bool m_turboMode = false;                          ///< Run many steps per frame
+    float m_turboBudgetMs = DEFAULT_TURBO_BUDGET_MS;   ///< Per-frame stepping budget (ms)
+    size_t m_lastBatchSteps = 0;                       ///< Steps executed in the last turbo frame
 
     // Visual constants
     static constexpr float ELEMENT_WIDTH = 60.0f;
@@ -125,6 +239,8 @@ private:
     static constexpr float START_Y = 300.0f;
     static constexpr int MAX_ARRAY_SIZE = 15;
     static constexpr int MAX_VALUE = 100;
+    static constexpr float ACCESS_ROW_HEIGHT = 14.0f;  ///< One probe per row in the access plot
+    static constexpr size_t CACHE_LINE_BYTES = 64;     ///< Line size assumed by the access stats
 };
 
 } // namespace dsav
@@ -0,0 +1,93 @@
+/**
+ * @file sort_backend.hpp
+ * @brief Algorithms behind the sorting visualizer
+ *
+ * SortingVisualizer draws bars, keeps the step history and replays traces;
+ * the backend supplies the algorithms. CppSortBackend offers the pure C++
+ * steppers, which the visualizer can also drive live. A backend over sorts
+ * that run to completion in one call (the asm-linked build's assembly
+ * kernels) records each run as a trace of the permutation it applied, and
+ * every run of it is replayed from that trace.
+ */
+
+#pragma once
+
+#include "algorithms/sort_trace.hpp"
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Sorting algorithms the visualizer can run
+ */
+class SortBackend {
+public:
+    virtual ~SortBackend() = default;
+
+    /// Visualizer name reported to the app
+    virtual const char* name() const = 0;
+
+    virtual size_t algorithmCount() const = 0;
+    virtual const char* algorithmName(size_t algorithm) const = 0;
+
+    /**
+     * @brief Whether the visualizer's live steppers implement these algorithms
+     *
+     * Index i then is SortingVisualizer's i-th stepper (the order of
+     * algorithms::SortAlgorithm). Without steppers every run replays a
+     * trace and race mode is unavailable.
+     */
+    virtual bool hasSteppers() const { return false; }
+
+    /**
+     * @brief Run an algorithm to completion on input and record it into trace
+     *
+     * Called on a worker thread, so it must not touch state the render
+     * thread uses.
+     *
+     * @param note Set to a one-line summary of the run, or the reason it failed
+     * @param cancel Optional flag polled to abandon the run
+     * @return false if the run failed or was cancelled (the trace is left empty)
+     */
+    virtual bool record(size_t algorithm, std::vector<int> input, algorithms::SortTrace& trace,
+                        std::string& note, const std::atomic<bool>* cancel) const = 0;
+
+    /**
+     * @brief Backend-specific controls, drawn below the visualizer's own
+     */
+    virtual void renderControls() {}
+};
+
+/**
+ * @brief Backend over the pure C++ sorting steppers
+ */
+class CppSortBackend final : public SortBackend {
+public:
+    /// Indexed by algorithms::SortAlgorithm; also the trace category of a run
+    static constexpr const char* NAMES[] = {
+        "Bubble Sort", "Selection Sort", "Insertion Sort", "Merge Sort", "Quick Sort",
+        "Heap Sort", "Shell Sort", "Radix Sort (LSD)", "Counting Sort", "Introsort",
+        "Parallel Merge Sort", "Parallel Quick Sort"
+    };
+
+    const char* name() const override { return "Sorting Algorithms"; }
+    size_t algorithmCount() const override { return std::size(NAMES); }
+    const char* algorithmName(size_t algorithm) const override { return NAMES[algorithm]; }
+    bool hasSteppers() const override { return true; }
+
+    bool record(size_t algorithm, std::vector<int> input, algorithms::SortTrace& trace,
+                std::string& note, const std::atomic<bool>* cancel) const override {
+        if (!trace.generate(static_cast<algorithms::SortAlgorithm>(algorithm), std::move(input), cancel)) {
+            note = "trace too large";
+            return false;
+        }
+        note.clear();
+        return true;
+    }
+};
+
+} // namespace dsav
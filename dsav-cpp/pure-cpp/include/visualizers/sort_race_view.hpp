@@ -0,0 +1,136 @@
+/**
+ * @file sort_race_view.hpp
+ * @brief Split-panel view of a sort race, shown by SortingVisualizer in race mode
+ *
+ * Holds the race settings and an algorithms::SortRace, and draws one panel
+ * per lane: the lane's latest snapshot as bars (one instanced draw per
+ * lane, so even million-element inputs cost little per frame) under its
+ * live step, compare, swap and wall-time counters. Snapshots are taken at
+ * most SNAPSHOT_HZ times a second, which bounds the copying the lanes do
+ * for the UI.
+ */
+
+#pragma once
+
+#include "algorithms/sort_race.hpp"
+#include "bar_renderer.hpp"
+#include "color_scheme.hpp"
+#include <array>
+#include <string>
+#include <vector>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Settings, panels and results table of a sort race
+ */
+class SortRaceView {
+public:
+    static constexpr size_t MAX_LANES = algorithms::SortRace::MAX_LANES;
+
+    SortRaceView();
+
+    /**
+     * @brief Race the selected algorithms on copies of input
+     *
+     * @return false if the race could not start (see error())
+     */
+    bool start(const std::vector<int>& input);
+
+    /**
+     * @brief Stop the running lanes (their counters freeze where they were)
+     */
+    void stop() { m_race.stop(); }
+
+    /**
+     * @brief Check whether any lane is still sorting
+     */
+    bool isRunning() const { return m_race.isRunning(); }
+
+    /**
+     * @brief Check whether a race has been started since construction
+     */
+    bool hasRace() const { return m_race.laneCount() > 0; }
+
+    /**
+     * @brief Take new lane snapshots when due
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Draw one panel per lane into the given canvas rectangle
+     */
+    void render(ImDrawList* drawList, ImVec2 canvasPos, ImVec2 canvasSize);
+
+    /**
+     * @brief Lane count, per-lane algorithm and pace controls
+     */
+    void renderSettings();
+
+    /**
+     * @brief Final timings of a finished or stopped race, fastest first
+     */
+    void renderResults();
+
+    /**
+     * @brief Free the lanes' GL buffers (re-uploaded when shown again)
+     */
+    void suspend();
+
+    /**
+     * @brief One-line outcome, e.g. "Quick Sort won in 1.25 ms (3 lanes)"
+     */
+    std::string summary() const;
+
+    const std::string& error() const { return m_race.error(); }
+
+private:
+    /**
+     * @brief What a panel shows of its lane
+     */
+    struct LanePanel {
+        algorithms::SortRaceSnapshot snapshot;   ///< Latest copy of the lane's array
+        std::vector<BarState> states;            ///< Sorted marks of the snapshot as bar states
+        InstancedBarRenderer renderer;           ///< One per lane: a renderer draws once per frame
+        bool dirty = false;                      ///< Snapshot not uploaded yet
+    };
+
+    /**
+     * @brief Swap in new snapshots and rebuild their bar states
+     */
+    void takeSnapshots();
+
+    /**
+     * @brief Finish position of a lane among the finished lanes (0 if not finished)
+     */
+    size_t rank(size_t lane) const;
+
+    /**
+     * @brief Draw a lane's bars into [min, max) without the GPU path, one bar per pixel column at most
+     */
+    void renderFallbackBars(ImDrawList* drawList, const LanePanel& panel, ImVec2 min, ImVec2 max,
+                            float heightScale) const;
+
+    algorithms::SortRace m_race;
+    std::array<LanePanel, MAX_LANES> m_panels;
+    float m_unitHeight = 1.0f;                   ///< Largest key magnitude of the race input
+    float m_sinceSnapshot = 0.0f;                ///< Seconds since snapshots were last taken
+
+    // Settings
+    int m_laneCount = 3;
+    std::array<int, MAX_LANES> m_algorithms;     ///< algorithms::SortAlgorithm per lane
+    bool m_paced = true;                         ///< Limit every lane to m_stepsPerSecond
+    float m_stepsPerSecond = 200.0f;
+
+    // Visual constants
+    static constexpr float PADDING = 12.0f;
+    static constexpr float PANEL_GAP = 8.0f;
+    static constexpr float HEADER_HEIGHT = 42.0f;  // Title and counter lines above the bars
+    static constexpr float HINT_HEIGHT = 28.0f;    // Reserved for the hint line at the bottom
+    static constexpr float SNAPSHOT_HZ = 30.0f;
+    static constexpr float MIN_STEPS_PER_SECOND = 1.0f;
+    static constexpr float MAX_STEPS_PER_SECOND = 1000000.0f;
+};
+
+} // namespace dsav
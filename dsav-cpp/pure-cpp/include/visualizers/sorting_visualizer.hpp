@@ -3,15 +3,27 @@
  * @brief Visualizer for sorting algorithms
  *
  * Provides interactive visualization of sorting algorithms with step-by-step
- * execution and animated comparisons/swaps.
+ * execution and animated comparisons/swaps. The algorithms come from a
+ * SortBackend, so the asm-linked build reuses this visualizer over the
+ * assembly sort kernels.
  */
 
 #pragma once
 
 #include "visualizer.hpp"
 #include "algorithms/sorting.hpp"
+#include "algorithms/timeline.hpp"
+#include "algorithms/sort_trace.hpp"
+#include "algorithms/parallel_sorting.hpp"
+#include "visualizers/trace_step_recorder.hpp"
+#include "visualizers/dataset_import_panel.hpp"
+#include "visualizers/sort_race_view.hpp"
+#include "visualizers/sort_backend.hpp"
 #include "animation.hpp"
+#include "step_budget.hpp"
+#include "job_system.hpp"
 #include "renderer.hpp"
+#include "bar_renderer.hpp"
 #include "color_scheme.hpp"
 #include <vector>
 #include <string>
@@ -20,19 +32,6 @@
 
 namespace dsav {
 
-/**
- * @brief Visual representation of an array element during sorting
- */
-struct VisualSortElement {
-    glm::vec2 position;
-    glm::vec2 size;
-    glm::vec4 color;
-    glm::vec4 borderColor;
-    std::string label;
-    int value;
-    bool isSorted = false;
-};
-
 /**
  * @brief Interactive visualizer for sorting algorithms
  *
@@ -41,15 +40,23 @@ struct VisualSortElement {
  * - Step-by-step execution with animations
  * - Color-coded states (comparing, swapping, sorted)
  * - Array randomization and custom input
+ * - Import of recorded keys from disk (memory-mapped or streamed)
+ * - Race mode: up to five algorithms sorting the same array on their own threads
  * - Speed control and playback
  */
 class SortingVisualizer : public IVisualizer {
 public:
     /**
-     * @brief Construct a sorting visualizer
+     * @brief Construct a sorting visualizer over the pure C++ steppers
      */
     SortingVisualizer();
 
+    /**
+     * @brief Construct a sorting visualizer over another sort backend
+     */
+    explicit SortingVisualizer(std::unique_ptr<SortBackend> sorts);
+    ~SortingVisualizer() override;
+
     // IVisualizer interface implementation
     void update(float deltaTime) override;
     void renderVisualization() override;
@@ -60,39 +67,190 @@ public:
     void reset() override;
     void setSpeed(float speed) override;
     std::string getStatusText() const override;
-    std::string getName() const override { return "Sorting Algorithms"; }
+    std::string getName() const override { return m_sorts->name(); }
     bool isAnimating() const override;
     bool isPaused() const override;
+    bool hasTimeline() const override { return !m_raceMode && m_timeline.isActive(); }
+    bool stepBack() override;
+    bool seek(size_t step) override;
+    size_t currentStep() const override { return m_timeline.position(); }
+    size_t stepCount() const override { return m_timeline.stepCount(); }
+    void suspend() override;
 
     // Sorting-specific operations
     void startSort();
     void randomizeArray();
     void setArray(const std::vector<int>& arr);
+    void setArray(std::vector<int>&& arr);
+
+    /**
+     * @brief Load the array from a dataset file on a worker thread
+     *
+     * Files with more than MAX_IMPORT_SIZE keys are sampled evenly. Bars
+     * are scaled so the largest key keeps the height of MAX_VALUE.
+     */
+    void importDataset(const std::string& path, algorithms::DatasetFormat format);
+
+    /**
+     * @brief Race the selected lanes on copies of the current array
+     */
+    void startRace();
+
+    /**
+     * @brief Stop a running race (its counters and bars stay as they were)
+     */
+    void stopRace();
 
 private:
+    /**
+     * @brief Install an imported array (job completion)
+     */
+    void finishImport(std::vector<int>& keys, bool ok, const std::string& message);
+
+    /**
+     * @brief Cancel a pending import
+     */
+    void discardImport();
+
+    /**
+     * @brief Pick the bar height scale for the current values
+     */
+    void updateValueScale();
+
     /**
      * @brief Sync visual elements with current array state
      */
     void syncVisuals();
 
     /**
-     * @brief Calculate position for element at index
+     * @brief Horizontal distance between bars at zoom 1 (shrinks to fit large arrays)
+     */
+    float barPitch() const;
+
+    /**
+     * @brief Bar width at zoom 1
+     */
+    float barWidth() const;
+
+    /**
+     * @brief Largest allowed zoom (always enough to reach labeled bars)
+     */
+    float maxZoom() const;
+
+    /**
+     * @brief Draw bars [first, last) through ImGui, with labels when wide enough
      */
-    glm::vec2 calculatePosition(size_t index) const;
+    void renderLabeledBars(ImDrawList* drawList, const BarLayout& layout, size_t first, size_t last);
+
+    /**
+     * @brief Palette color for a bar state
+     */
+    static glm::vec4 barColor(BarState state);
+
+    /**
+     * @brief Create the live stepper of the selected algorithm over m_array
+     */
+    void createStepper();
 
     /**
      * @brief Execute one step of the current algorithm
      */
     void executeStep();
 
+    /**
+     * @brief Turbo mode: run as many steps as fit in the frame budget, then sync once
+     */
+    void executeTurboBatch();
+
+    /**
+     * @brief Advance the active stepper by one step (no visual sync)
+     *
+     * Behind the recorded frontier this replays the next recorded step
+     * instead of running the algorithm.
+     *
+     * @return true if more steps remain
+     */
+    bool advanceStepper();
+
+    /**
+     * @brief Let the merge and quick sort steppers use their vectorized kernels
+     *
+     * Only turbo batches enable this, since nothing is drawn between their steps.
+     */
+    void setFastForward(bool enabled);
+
+    /**
+     * @brief Start generating a trace of the selected algorithm on a worker thread
+     */
+    void launchTrace();
+
+    /**
+     * @brief Install a generated trace (job completion)
+     *
+     * nullptr falls back to the live stepper, or ends the run if the backend has none.
+     *
+     * @param note The backend's summary of the run, or why it failed
+     */
+    void onTraceReady(std::shared_ptr<algorithms::SortTrace> trace, const std::string& note);
+
+    /**
+     * @brief Cancel any pending generation and drop the current trace
+     */
+    void discardTrace();
+
+    /**
+     * @brief Attach the timeline to the active stepper and record step 0
+     */
+    void beginTimeline();
+
+    /**
+     * @brief Highlight state of the active stepper, packed for the timeline
+     */
+    algorithms::StepCursor captureCursor() const;
+
+    /**
+     * @brief Cursor of the shown step (recorded or live)
+     */
+    const algorithms::StepCursor& cursor() const;
+
+    /**
+     * @brief Check whether the active stepper has finished
+     */
+    bool stepperComplete() const;
+
+    /**
+     * @brief Set the status text from the active stepper's current state
+     */
+    void describeStep();
+
     /**
      * @brief Update element colors based on current state
      */
     void updateColors();
 
+    /**
+     * @brief Sorted-position marks of the active stepper (nullptr if none)
+     */
+    const algorithms::SortedMarks* sortedMarks() const;
+
+    /**
+     * @brief Ranges each lane processed in the last step of a parallel sort (nullptr if none)
+     */
+    const std::vector<algorithms::LaneSpan>* laneSpans() const;
+
+    /**
+     * @brief Per-lane element counts of the running parallel sort (nullptr if none)
+     */
+    const std::vector<size_t>* laneWork() const;
+
     // Data
+    std::shared_ptr<SortBackend> m_sorts;              ///< Algorithms (shared with trace jobs in flight)
+    std::vector<const char*> m_algorithmNames;         ///< Backend's algorithm names, for the combo
     std::vector<int> m_array;                          ///< Array being sorted
-    std::vector<VisualSortElement> m_elements;         ///< Visual representation
+    std::vector<BarState> m_barStates;                 ///< Per-bar color state
+    float m_valueScale = 1.0f;                         ///< Bar height per unit of value (shrinks for large keys)
+    InstancedBarRenderer m_barRenderer;                ///< GPU path for large arrays
+    bool m_barsDirty = true;                           ///< Bars need re-upload
     AnimationController m_animator;                    ///< Animation controller
 
     // Algorithm state
@@ -101,15 +259,59 @@ private:
         SelectionSort,
         InsertionSort,
         MergeSort,
-        QuickSort
+        QuickSort,
+        HeapSort,
+        ShellSort,
+        RadixSort,
+        CountingSort,
+        IntroSort,
+        ParallelMergeSort,
+        ParallelQuickSort
     };
-    Algorithm m_currentAlgorithm = Algorithm::BubbleSort;
+    size_t m_algorithm = 0;                            ///< Selected backend algorithm
+
+    /**
+     * @brief Stepper of the selected algorithm (backends with steppers only)
+     */
+    Algorithm currentAlgorithm() const { return static_cast<Algorithm>(m_algorithm); }
 
     std::unique_ptr<algorithms::BubbleSortStepper> m_bubbleSorter;
     std::unique_ptr<algorithms::SelectionSortStepper> m_selectionSorter;
     std::unique_ptr<algorithms::InsertionSortStepper> m_insertionSorter;
     std::unique_ptr<algorithms::MergeSortStepper> m_mergeSorter;
     std::unique_ptr<algorithms::QuickSortStepper> m_quickSorter;
+    std::unique_ptr<algorithms::HeapSortStepper> m_heapSorter;
+    std::unique_ptr<algorithms::ShellSortStepper> m_shellSorter;
+    std::unique_ptr<algorithms::RadixSortStepper> m_radixSorter;
+    std::unique_ptr<algorithms::CountingSortStepper> m_countingSorter;
+    std::unique_ptr<algorithms::IntroSortStepper> m_introSorter;
+    std::unique_ptr<algorithms::ParallelMergeSortStepper> m_parallelMergeSorter;
+    std::unique_ptr<algorithms::ParallelQuickSortStepper> m_parallelQuickSorter;
+    int m_parallelLanes = static_cast<int>(algorithms::defaultSortLanes()); ///< Lanes for the next parallel run
+
+    // Precomputed trace mode
+    JobHandle m_traceJob;                              ///< Generation in flight (nullptr if none)
+    std::shared_ptr<algorithms::SortTrace> m_trace;    ///< Trace being replayed
+    algorithms::TracePlayer m_tracePlayer;             ///< Replay position within m_trace
+    bool m_useTrace = false;                           ///< Replay a precomputed trace for new runs
+    bool m_runUsesTrace = false;                       ///< Current run replays m_trace
+    int m_traceOpsPerStep = 1;                         ///< Compare/swap/write ops applied per step
+    std::string m_runNote;                             ///< Backend's summary of the last recorded run
+
+    // Dataset import
+    DatasetImportPanel m_importPanel;                  ///< Path and format of the next import
+    JobHandle m_importJob;                             ///< Import in flight (nullptr if none)
+
+    // Race mode
+    SortRaceView m_raceView;                           ///< Lanes, panels and results of the race
+    bool m_raceMode = false;                           ///< Show the race instead of the single-algorithm view
+    bool m_raceReported = true;                        ///< Outcome of the last race is in m_statusText
+
+    // Step history (stepBack/seek)
+    algorithms::ArrayTimeline m_timeline;              ///< Recorded deltas and keyframes of the current run
+    algorithms::StepCursor m_liveCursor;               ///< Cursor of the stepper when no history is kept
+    TraceStepRecorder m_traceRecorder;                 ///< Copies the run into a trace capture, if one is running
+    bool m_recordHistory = true;                       ///< Record a timeline for new runs
 
     // UI state
     std::string m_statusText;                          ///< Current status message
@@ -119,6 +321,9 @@ private:
     int m_arraySize = 10;                              ///< Size of array to sort
     int m_stepDelay = 500;                             ///< Delay between steps (ms)
     float m_timeSinceLastStep = 0.0f;                  ///< Time accumulator for auto-step
+    bool m_turboMode = false;                          ///< Run many steps per frame
+    float m_turboBudgetMs = DEFAULT_TURBO_BUDGET_MS;   ///< Per-frame stepping budget (ms)
+    size_t m_lastBatchSteps = 0;                       ///< Steps executed in the last turbo frame
 
     // Camera/viewport control for scrolling/panning
     float m_cameraOffsetX = 0.0f;                      ///< Horizontal camera offset for panning
@@ -133,8 +338,15 @@ private:
     static constexpr float ELEMENT_SPACING = 10.0f;
     static constexpr float START_X = 100.0f;
     static constexpr float BASE_Y = 500.0f;              // Baseline for bars
-    static constexpr int MAX_ARRAY_SIZE = 20;
+    static constexpr int MAX_ARRAY_SIZE = 1000000;
+    static constexpr size_t MAX_IMPORT_SIZE = size_t{1} << 25;  // Imported keys beyond this are sampled
+    static constexpr float LABELED_BAR_MIN_PITCH = 40.0f; // Screen pitch (px) below which bars go unlabeled and instanced
+    static constexpr float FIT_WIDTH = 1600.0f;           // Large arrays are squeezed into this width at zoom 1
+    static constexpr float MIN_ZOOM = 0.3f;
+    static constexpr float MAX_ZOOM = 3.0f;
     static constexpr int MAX_VALUE = 100;
+    static constexpr int MAX_TRACE_OPS_PER_STEP = 4096;
+    static constexpr size_t PARALLEL_TASKS_PER_LANE = 4; // Tasks per lane and step, so stealing shows on small arrays
 };
 
 } // namespace dsav
@@ -12,6 +12,8 @@
 #include "animation.hpp"
 #include "renderer.hpp"
 #include "color_scheme.hpp"
+#include "visualizers/workload_panel.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <imgui.h>
@@ -24,6 +26,7 @@ namespace dsav {
  * Features:
  * - Visual representation of stack elements as colored boxes
  * - Smooth animations for push/pop operations
+ * - Growth and shrink animations as the buffer is reallocated
  * - Interactive controls for stack manipulation
  * - Real-time status updates
  */
@@ -32,7 +35,7 @@ public:
     /**
      * @brief Construct a stack visualizer
      *
-     * @param maxSize Maximum stack capacity (default 10)
+     * @param maxSize Initial stack capacity (default 10); the stack grows past it
      */
     explicit StackVisualizer(size_t maxSize = 10);
 
@@ -50,6 +53,18 @@ public:
     bool isAnimating() const override;
     bool isPaused() const override;
 
+    // Snapshots (raw element buffer, bottom to top)
+    bool supportsSnapshots() const override { return true; }
+    bool saveSnapshot(const std::string& path) override;
+    bool loadSnapshot(const std::string& path) override;
+
+    // Timeline (the active workload replay)
+    bool hasTimeline() const override { return m_workload.replay().isActive(); }
+    bool stepBack() override;
+    bool seek(size_t step) override;
+    size_t currentStep() const override { return m_workload.replay().position(); }
+    size_t stepCount() const override { return m_workload.replay().size(); }
+
     // Stack-specific operations (with animation)
     void pushValue(int value);
     void popValue();
@@ -74,8 +89,30 @@ private:
      */
     glm::vec2 calculatePosition(size_t index) const;
 
+    /**
+     * @brief Animate the reallocations the stack logged since the last call
+     *
+     * @return Number of new events
+     */
+    size_t animateCapacityEvents();
+
+    /**
+     * @brief Mark every logged event as already shown
+     */
+    void skipCapacityEvents();
+
+    /**
+     * @brief Animate a workload op the replay sampled (push, pop or peek)
+     */
+    void animateWorkloadOp(const algorithms::WorkloadOp& op);
+
+    /**
+     * @brief Show the contents a replay reached without animating
+     */
+    void syncWorkload();
+
     // Data
-    Stack<int, 16> m_stack;                    ///< Underlying stack data structure
+    Stack<int, DYNAMIC_CAPACITY> m_stack;      ///< Underlying stack data structure (growable)
     std::vector<VisualElement> m_elements;     ///< Visual representation of stack elements
     AnimationController m_animator;            ///< Animation controller
 
@@ -85,6 +122,12 @@ private:
     bool m_isPaused = true;                    ///< Pause state
     float m_speed = 1.0f;                      ///< Animation speed multiplier
     int m_initCount = 16;                      ///< Number of elements for random initialization
+    WorkloadPanel m_workload;                  ///< Workload script and replay
+
+    // Growth animation state
+    std::uint64_t m_eventCursor = 0;           ///< Sequence number of the next unseen capacity event
+    size_t m_newSlotsFrom = 0;                 ///< First slot added by the last growth
+    float m_growthFlash = 0.0f;                ///< Remaining highlight time for new slots
 
     // Camera/viewport control for scrolling/panning
     float m_cameraOffsetY = 0.0f;              ///< Vertical camera offset for panning
@@ -98,6 +141,9 @@ private:
     static constexpr float ELEMENT_SPACING = 10.0f;
     static constexpr float START_X = 100.0f;
     static constexpr float START_Y = 500.0f;  // Bottom of visualization area
+    static constexpr float GROWTH_FLASH_SECONDS = 0.8f;  ///< How long new slots stay highlighted
+    static constexpr int MAX_INIT_COUNT = 100000;         ///< Largest random initialization
+    static constexpr size_t MAX_CASCADE = 16;             ///< Elements animated by initialization
 };
 
 } // namespace dsav
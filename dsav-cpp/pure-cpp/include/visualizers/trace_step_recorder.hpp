@@ -0,0 +1,76 @@
+/**
+ * @file trace_step_recorder.hpp
+ * @brief StepRecorder that copies a stepper's operations into the trace capture
+ *
+ * A stepper reports to a single recorder, so this one sits in front of the
+ * visualizer's own recorder (the history timeline, or none) and forwards
+ * every call to it after queueing a trace event. Attach it only while
+ * trace::isActive(): with a recorder attached the merge and quick sort
+ * steppers leave their vectorized fast-forward kernels.
+ */
+
+#pragma once
+
+#include "algorithms/step_recorder.hpp"
+#include "trace_writer.hpp"
+#include <cstdint>
+
+namespace dsav {
+
+/**
+ * @brief Tee from a stepper to the trace writer and an optional inner recorder
+ */
+class TraceStepRecorder final : public algorithms::StepRecorder {
+public:
+    /**
+     * @brief Start tracing a run
+     *
+     * @param inner Recorder that still receives every call (may be nullptr)
+     * @param category Event category, usually the algorithm name (must outlive the capture)
+     */
+    void attach(algorithms::StepRecorder* inner, const char* category) {
+        m_inner = inner;
+        m_category = category;
+    }
+
+    void onWrite(size_t index, int value) override {
+        emit("write", "index", static_cast<std::int64_t>(index), "value", value);
+        if (m_inner) m_inner->onWrite(index, value);
+    }
+
+    void onSwap(size_t i, size_t j) override {
+        emit("swap", "i", static_cast<std::int64_t>(i), "j", static_cast<std::int64_t>(j));
+        if (m_inner) m_inner->onSwap(i, j);
+    }
+
+    void onMark(size_t begin, size_t end) override {
+        emit("mark", "begin", static_cast<std::int64_t>(begin), "end", static_cast<std::int64_t>(end));
+        if (m_inner) m_inner->onMark(begin, end);
+    }
+
+    void onMarkAll() override {
+        trace::instant("markAll", m_category, trace::ALGORITHM_TRACK);
+        if (m_inner) m_inner->onMarkAll();
+    }
+
+    void onCompare(size_t i, size_t j) override {
+        emit("compare", "i", static_cast<std::int64_t>(i), "j", static_cast<std::int64_t>(j));
+        if (m_inner) m_inner->onCompare(i, j);
+    }
+
+    void onRange(size_t begin, size_t end) override {
+        emit("range", "begin", static_cast<std::int64_t>(begin), "end", static_cast<std::int64_t>(end));
+        if (m_inner) m_inner->onRange(begin, end);
+    }
+
+private:
+    void emit(const char* name, const char* arg0, std::int64_t value0,
+              const char* arg1, std::int64_t value1) {
+        trace::instant(name, m_category, trace::ALGORITHM_TRACK, arg0, value0, arg1, value1);
+    }
+
+    algorithms::StepRecorder* m_inner = nullptr;
+    const char* m_category = "sort";
+};
+
+} // namespace dsav
@@ -0,0 +1,172 @@
+/**
+ * @file tree_backend.hpp
+ * @brief Storage behind the binary search tree visualizer
+ *
+ * BSTVisualizer lays out and animates nodes by id, so it reads the tree
+ * through this interface: stable node ids, each node's key and child ids,
+ * and a journal of the ids that changed since the last sync. CppTreeBackend
+ * wraps BinarySearchTree<int, true>, whose pool indices and change journal
+ * already are exactly that; the asm-linked build supplies a backend that
+ * derives them from the assembly tree.
+ */
+
+#pragma once
+
+#include "data_structures/binary_search_tree.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace dsav {
+
+/**
+ * @brief Key and child ids of one live node
+ */
+struct TreeNodeLinks {
+    int key;
+    NodeIndex left;                            ///< NULL_NODE if absent
+    NodeIndex right;                           ///< NULL_NODE if absent
+};
+
+/**
+ * @brief Tree operations, node ids and change journal the visualizer needs
+ *
+ * Ids are small integers (the visualizer indexes vectors with them) and
+ * stay attached to a node for as long as it is in the tree.
+ */
+class TreeBackend {
+public:
+    virtual ~TreeBackend() = default;
+
+    /// Visualizer name reported to the app
+    virtual const char* name() const = 0;
+
+    /// Insert a key (duplicates are ignored)
+    virtual void insert(int value) = 0;
+
+    /**
+     * @brief Insert keys in order (backends with a bulk path override this)
+     */
+    virtual void insertRange(const std::vector<int>& values) {
+        for (int value : values) {
+            insert(value);
+        }
+    }
+
+    /**
+     * @brief Delete a key
+     *
+     * @return false if the key was not in the tree
+     */
+    virtual bool remove(int value) = 0;
+
+    /**
+     * @brief Id of the node holding a key, or NULL_NODE
+     */
+    virtual NodeIndex find(int value) const = 0;
+
+    bool contains(int value) const { return find(value) != NULL_NODE; }
+
+    /**
+     * @brief Remove every node (the journal is dropped too)
+     */
+    virtual void clear() = 0;
+
+    virtual size_t size() const = 0;
+    bool isEmpty() const { return size() == 0; }
+
+    /**
+     * @brief Edges from the root to the deepest leaf (-1 if empty)
+     */
+    virtual int height() const = 0;
+
+    /// Root id, or NULL_NODE if empty
+    virtual NodeIndex root() const = 0;
+
+    /// Whether an id currently names a node in the tree
+    virtual bool isLive(NodeIndex id) const = 0;
+
+    /**
+     * @brief Key and children of a live node
+     */
+    virtual TreeNodeLinks node(NodeIndex id) const = 0;
+
+    /**
+     * @brief Ids whose key or links changed since the last call (sorted, deduplicated)
+     *
+     * Ids that are no longer live (see isLive) were removed from the tree.
+     */
+    virtual std::vector<NodeIndex> takeChangedNodes() = 0;
+
+    /**
+     * @brief Id of the k-th smallest key (zero-based), or NULL_NODE if k >= size()
+     */
+    virtual NodeIndex select(size_t k) const = 0;
+
+    /// Number of keys less than a value
+    virtual size_t rank(int value) const = 0;
+
+    /// Number of keys in [low, high]
+    virtual size_t countInRange(int low, int high) const = 0;
+
+    /**
+     * @brief Replace the contents with a tree built off the render thread
+     *
+     * The tree must have change tracking enabled and its journal already
+     * taken (by the layout built alongside it).
+     *
+     * @return true if the tree's node ids carry over, so a layout built from
+     *         them stays valid; false if every node was journaled afresh
+     */
+    virtual bool adopt(BinarySearchTree<int, true>&& tree) = 0;
+};
+
+/**
+ * @brief Backend over the pure C++ order-statistics tree
+ *
+ * Node ids are the tree's pool indices.
+ */
+class CppTreeBackend final : public TreeBackend {
+public:
+    CppTreeBackend() {
+        m_tree.enableChangeTracking();
+    }
+
+    const char* name() const override { return "Binary Search Tree"; }
+
+    void insert(int value) override { m_tree.insert(value); }
+
+    void insertRange(const std::vector<int>& values) override {
+        m_tree.insertRange(values.begin(), values.end());
+    }
+
+    bool remove(int value) override { return m_tree.remove(value); }
+    NodeIndex find(int value) const override { return m_tree.find(value).index(); }
+
+    void clear() override { m_tree.clear(); }
+    size_t size() const override { return m_tree.size(); }
+    int height() const override { return m_tree.height(); }
+
+    NodeIndex root() const override { return m_tree.root().index(); }
+    bool isLive(NodeIndex id) const override { return m_tree.isLive(id); }
+
+    TreeNodeLinks node(NodeIndex id) const override {
+        auto handle = m_tree.node(id);
+        return {handle->data, handle->left, handle->right};
+    }
+
+    std::vector<NodeIndex> takeChangedNodes() override { return m_tree.takeChangedNodes(); }
+
+    NodeIndex select(size_t k) const override { return m_tree.select(k).index(); }
+    size_t rank(int value) const override { return m_tree.rank(value); }
+    size_t countInRange(int low, int high) const override { return m_tree.countInRange(low, high); }
+
+    bool adopt(BinarySearchTree<int, true>&& tree) override {
+        m_tree = std::move(tree);
+        return true;
+    }
+
+private:
+    BinarySearchTree<int, true> m_tree;        ///< Underlying tree, journaling its changes
+};
+
+} // namespace dsav
@@ -0,0 +1,183 @@
+/**
+ * @file unrolled_list_visualizer.hpp
+ * @brief Visualizer for Unrolled Linked List data structure
+ *
+ * Draws each node as a row of NODE_CAP element slots (empty slots dimmed)
+ * with pointer arrows between nodes, so splits, merges and borrows are
+ * visible as they happen. A one-element-per-node LinkedList shadows every
+ * operation to compare pointer hops.
+ */
+
+#pragma once
+
+#include "visualizer.hpp"
+#include "data_structures/unrolled_linked_list.hpp"
+#include "data_structures/linked_list.hpp"
+#include "animation.hpp"
+#include "renderer.hpp"
+#include "color_scheme.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <imgui.h>
+
+namespace dsav {
+
+/**
+ * @brief Visual representation of one element slot of an unrolled node
+ */
+struct VisualSlot {
+    glm::vec4 color;
+    glm::vec4 borderColor;
+    LabelId label = NO_LABEL;
+    bool isLive = false;    ///< Holds an element (slots past the node's count are empty)
+};
+
+/**
+ * @brief Visual representation of an unrolled list node
+ */
+struct VisualChunk {
+    glm::vec2 position;     ///< Top-left corner in world space
+    size_t firstSlot = 0;   ///< Index of the node's first slot in m_slots
+    size_t count = 0;       ///< Live elements
+    LabelId fillLabel = NO_LABEL;  ///< "count/capacity" caption
+};
+
+/**
+ * @brief Interactive visualizer for Unrolled Linked List data structure
+ *
+ * Features:
+ * - Nodes drawn as fixed-capacity slot rows with arrows between them
+ * - Split on insert into a full node, merge/borrow on delete below half fill
+ * - Search animation scanning node by node
+ * - Pointer hops of the last operation next to those of a LinkedList
+ *   holding the same values one per node
+ */
+class UnrolledListVisualizer : public IVisualizer {
+public:
+    /// Elements per displayed node (small so splits happen often)
+    static constexpr size_t NODE_CAP = 4;
+
+    /**
+     * @brief Construct an unrolled linked list visualizer
+     */
+    UnrolledListVisualizer();
+
+    // IVisualizer interface implementation
+    void update(float deltaTime) override;
+    void renderVisualization() override;
+    void renderControls() override;
+    void play() override;
+    void pause() override;
+    void step() override;
+    void reset() override;
+    void setSpeed(float speed) override;
+    std::string getStatusText() const override;
+    std::string getName() const override { return "Unrolled Linked List"; }
+    bool isAnimating() const override;
+    bool isPaused() const override;
+    void suspend() override { m_canvasCache.release(); }
+
+    // Unrolled list-specific operations (with animation)
+    void insertFrontValue(int value);
+    void insertBackValue(int value);
+    void insertAtValue(size_t index, int value);
+    void deleteFrontValue();
+    void deleteBackValue();
+    void deleteAtValue(size_t index);
+    void searchValue(int value);
+    void initializeRandom(size_t count);
+
+private:
+    /**
+     * @brief Hop counters of both lists before an operation
+     */
+    struct HopMark {
+        std::uint64_t unrolled = 0;
+        std::uint64_t linked = 0;
+    };
+
+    HopMark markHops() const;
+
+    /**
+     * @brief Store the hops both lists made since a mark
+     */
+    void recordHops(const char* operation, const HopMark& before);
+
+    void renderHopReadout();
+
+    /**
+     * @brief Rebuild chunks and slots from the current list state
+     */
+    void syncVisuals();
+
+    /**
+     * @brief Flash the slot holding an element, then restore it
+     *
+     * @param index Element position (0-based)
+     * @param color Flash color
+     * @param message Status text once the flash completes
+     */
+    void flashElement(size_t index, const glm::vec4& color, const std::string& message);
+
+    /**
+     * @brief Flash an element red, then delete it from both lists
+     */
+    void animateDelete(size_t index, const char* operation);
+
+    void drawArrow(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color);
+
+    // Data
+    UnrolledLinkedList<int, NODE_CAP> m_list;  ///< Underlying unrolled list
+    LinkedList<int> m_linked;                  ///< Same values one per node, for the hop comparison
+    std::vector<VisualChunk> m_chunks;         ///< One per node, head first
+    std::vector<VisualSlot> m_slots;           ///< NODE_CAP per chunk
+    std::vector<size_t> m_slotOfElement;       ///< Element position -> slot index
+    AnimationController m_animator;            ///< Animation controller
+    CanvasCache m_canvasCache;                 ///< Static layer of the canvas
+    std::uint64_t m_sceneVersion = 0;          ///< Bumped when the static layer changes
+    std::vector<std::uint8_t> m_animatedSlots; ///< Slots animated by the current step (drawn live)
+    std::vector<std::uint8_t> m_animatedScratch; ///< This frame's flags, swapped in when they change
+
+    // Pointer hops of the last operation
+    std::string m_hopOperation;                ///< Empty until an operation was counted
+    std::uint64_t m_lastHops = 0;              ///< Hops the unrolled list made
+    std::uint64_t m_linkedHops = 0;            ///< Hops the LinkedList made
+
+    // UI state
+    std::string m_statusText;                  ///< Current status message
+    int m_inputValue = 0;                      ///< Value for insert/search
+    int m_inputIndex = 0;                      ///< Index for insert/delete
+    bool m_isPaused = true;                    ///< Pause state
+    float m_speed = 1.0f;                      ///< Animation speed multiplier
+    int m_initCount = 16;                      ///< Number of elements for random initialization
+
+    // Camera/viewport control for scrolling/panning
+    float m_cameraOffsetX = 0.0f;              ///< Horizontal camera offset for panning
+    float m_zoomLevel = 1.0f;                  ///< Zoom level (1.0 = normal, >1 = zoomed in, <1 = zoomed out)
+    bool m_isDragging = false;                 ///< Mouse drag state for panning
+    ImVec2 m_lastMousePos;                     ///< Last mouse position for drag delta
+
+    // Operation mode
+    enum class OperationMode {
+        InsertFront,
+        InsertBack,
+        InsertAt,
+        DeleteFront,
+        DeleteBack,
+        DeleteAt,
+        Search
+    };
+    OperationMode m_currentMode = OperationMode::InsertBack;
+
+    // Visual constants
+    static constexpr float SLOT_WIDTH = 48.0f;
+    static constexpr float SLOT_HEIGHT = 48.0f;
+    static constexpr float CHUNK_PADDING = 6.0f;   // Frame padding around the slots
+    static constexpr float CHUNK_GAP = 50.0f;      // Arrow space between nodes
+    static constexpr float START_X = 120.0f;
+    static constexpr float START_Y = 200.0f;
+    static constexpr int MAX_INIT_COUNT = 64;
+};
+
+} // namespace dsav
@@ -0,0 +1,98 @@
+/**
+ * @file workload_panel.hpp
+ * @brief Script, replay and timeline controls shared by the visualizers that replay workloads
+ *
+ * Holds the loaded (or generated) algorithms::WorkloadScript and the
+ * algorithms::WorkloadReplay running it. The visualizer supplies the
+ * replay hooks, calls advance() from update() whenever its animations are
+ * done, and animates the ops the replay samples; everything between two
+ * samples is applied in batches and shown with one visual sync.
+ */
+
+#pragma once
+
+#include "algorithms/workload_replay.hpp"
+#include "algorithms/workload_script.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace dsav {
+
+/**
+ * @brief Workload script source, replay settings and scrubber
+ */
+class WorkloadPanel {
+public:
+    static constexpr int MAX_BATCH = 1 << 20;
+    static constexpr int MAX_GENERATE_OPS = 10000000;
+
+    /**
+     * @brief Set how replays reach the visualizer's container (call once, before render())
+     */
+    void setHooks(algorithms::WorkloadHooks hooks) { m_hooks = std::move(hooks); }
+
+    /**
+     * @brief Draw the script, replay and timeline controls
+     *
+     * @return true if a seek rewrote the container; the caller drops its
+     *         animations and resyncs its visuals
+     */
+    bool render();
+
+    /**
+     * @brief Move a playing replay forward by one batch or one sampled op
+     *
+     * @param animate Starts the visualizer's own animation of an op (which applies it)
+     * @return true if ops were applied silently and the visuals need a sync
+     */
+    bool advance(const std::function<void(const algorithms::WorkloadOp&)>& animate);
+
+    /**
+     * @brief Pause and jump to a position (see WorkloadReplay::seek)
+     *
+     * @return false if no replay is active
+     */
+    bool seek(size_t step);
+
+    /**
+     * @brief End the replay, keeping the contents it reached
+     */
+    void stop();
+
+    bool isPlaying() const { return m_playing; }
+    const algorithms::WorkloadReplay& replay() const { return m_replay; }
+
+    /**
+     * @brief Progress line, e.g. "Replay: 20000 / 1000000 ops (1 in 1000 animated)"
+     */
+    std::string statusText() const;
+
+private:
+    void loadScript();
+    void saveScript();
+    void generateScript();
+
+    algorithms::WorkloadHooks m_hooks;
+    std::shared_ptr<algorithms::WorkloadScript> m_script;
+    algorithms::WorkloadReplay m_replay;
+    bool m_playing = false;
+    std::string m_message;              ///< Result of the last load, save or generate
+
+    // Script source
+    char m_path[1024] = {};
+    int m_format = 0;                   ///< algorithms::WorkloadFormat
+    int m_generateOps = 100000;
+    int m_insertWeight = 50;
+    int m_removeWeight = 25;
+    int m_searchWeight = 25;
+    int m_burst = 1;
+    int m_keyRange = 0;                 ///< 0 = the op count
+    int m_seed = 42;
+
+    // Replay settings
+    int m_sampleEvery = 1000;           ///< Animate every n-th op (0 = none)
+    int m_batch = 4096;                 ///< Silent ops per frame
+};
+
+} // namespace dsav
@@ -0,0 +1,291 @@
+/**
+ * @file complexity.cpp
+ * @brief Implementation of the complexity sweeps
+ */
+
+#include "algorithms/complexity.hpp"
+#include "data_structures/stack.hpp"
+#include "data_structures/queue.hpp"
+#include "data_structures/dynamic_array.hpp"
+#include "data_structures/linked_list.hpp"
+#include "data_structures/doubly_linked_list.hpp"
+#include "data_structures/binary_search_tree.hpp"
+#include "data_structures/red_black_tree.hpp"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace dsav::algorithms {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const ComplexityOpInfo OP_INFO[COMPLEXITY_OP_COUNT] = {
+    {"Stack", "push", "O(1) amortized"},
+    {"Stack", "pop", "O(1) amortized"},
+    {"Queue", "enqueue", "O(1)"},
+    {"Queue", "dequeue", "O(1)"},
+    {"Dynamic Array", "push back", "O(1) amortized"},
+    {"Dynamic Array", "insert at front", "O(n)"},
+    {"Dynamic Array", "find", "O(n)"},
+    {"Linked List", "insert front", "O(1)"},
+    {"Linked List", "insert back", "O(1)"},
+    {"Linked List", "delete back", "O(n)"},
+    {"Linked List", "find", "O(n)"},
+    {"Doubly Linked List", "delete back", "O(1)"},
+    {"Binary Search Tree", "insert (random keys)", "O(log n) expected"},
+    {"Binary Search Tree", "insert (sorted keys)", "O(n)"},
+    {"Binary Search Tree", "search", "O(log n) expected"},
+    {"Red-Black Tree", "insert (random keys)", "O(log n)"},
+    {"Red-Black Tree", "insert (sorted keys)", "O(log n)"},
+    {"Red-Black Tree", "search", "O(log n)"},
+    {"Red-Black Tree", "select k-th (order statistics)", "O(log n)"},
+};
+
+/**
+ * @brief Keys of one measurement
+ *
+ * The structure is built from the even numbers 0, 2, ..., 2(n - 1), so the
+ * odd probes are never present and the even ones always are.
+ */
+struct Keys {
+    std::vector<int> build;     ///< n even keys, shuffled (or ascending for sorted ops)
+    std::vector<int> fresh;     ///< Batch of keys not in the structure
+    std::vector<int> present;   ///< Batch of keys in the structure
+};
+
+Keys makeKeys(size_t n, size_t batch, bool sorted, std::uint32_t seed) {
+    std::mt19937 rng(seed ^ static_cast<std::uint32_t>(n * 2654435761u));
+    Keys keys;
+
+    keys.build.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.build[i] = static_cast<int>(2 * i);
+    }
+
+    keys.fresh.resize(batch);
+    if (sorted) {
+        // Keep ascending past the largest key so every insert follows the spine
+        for (size_t i = 0; i < batch; ++i) {
+            keys.fresh[i] = static_cast<int>(2 * (n + i));
+        }
+    } else {
+        std::shuffle(keys.build.begin(), keys.build.end(), rng);
+        std::uniform_int_distribution<size_t> pick(0, n - 1);
+        for (size_t i = 0; i < batch; ++i) {
+            keys.fresh[i] = static_cast<int>(2 * pick(rng) + 1);
+        }
+    }
+
+    keys.present.resize(batch);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    for (size_t i = 0; i < batch; ++i) {
+        keys.present[i] = keys.build[pick(rng)];
+    }
+    return keys;
+}
+
+/// Keeps lookups from being optimized away
+volatile std::uint64_t g_sink = 0;
+
+/**
+ * @brief Build a structure uncounted, then count and time a batch on it
+ *
+ * @param build Fills the structure with the n keys
+ * @param op Performs the i-th operation of the batch
+ */
+template <typename Structure, typename Build, typename Op>
+ComplexitySample measureBatch(Structure& structure, size_t n, size_t batch, Build&& build, Op&& op) {
+    build(structure);
+    structure.resetOpCounters();
+
+    ComplexitySample sample;
+    sample.n = n;
+    sample.operations = batch;
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < batch; ++i) {
+        op(structure, i);
+    }
+    auto elapsed = Clock::now() - start;
+
+    sample.nanoseconds = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    sample.ops = structure.opCounters();
+    return sample;
+}
+
+} // namespace
+
+const ComplexityOpInfo& complexityOpInfo(ComplexityOp op) {
+    return OP_INFO[static_cast<size_t>(op)];
+}
+
+const char* complexityMetricName(ComplexityMetric metric) {
+    switch (metric) {
+        case ComplexityMetric::Comparisons: return "Comparisons";
+        case ComplexityMetric::Hops:        return "Pointer hops";
+        case ComplexityMetric::Moves:       return "Moves / copies";
+        case ComplexityMetric::Allocations: return "Allocations";
+        case ComplexityMetric::Rotations:   return "Rotations";
+        case ComplexityMetric::TotalOps:    return "All counted operations";
+        case ComplexityMetric::Nanoseconds: return "Time (ns)";
+    }
+    return "?";
+}
+
+double ComplexitySample::perOperation(ComplexityMetric metric) const {
+    double value = 0.0;
+    switch (metric) {
+        case ComplexityMetric::Comparisons: value = static_cast<double>(ops.comparisons); break;
+        case ComplexityMetric::Hops:        value = static_cast<double>(ops.hops); break;
+        case ComplexityMetric::Moves:       value = static_cast<double>(ops.moves); break;
+        case ComplexityMetric::Allocations: value = static_cast<double>(ops.allocations); break;
+        case ComplexityMetric::Rotations:   value = static_cast<double>(ops.rotations); break;
+        case ComplexityMetric::TotalOps:    value = static_cast<double>(ops.total()); break;
+        case ComplexityMetric::Nanoseconds: value = nanoseconds; break;
+    }
+    return operations > 0 ? value / static_cast<double>(operations) : 0.0;
+}
+
+ComplexitySample measureComplexity(ComplexityOp op, size_t n, std::uint32_t seed) {
+    n = std::max<size_t>(n, 1);
+    size_t batch = std::max<size_t>(n / COMPLEXITY_BATCH_DIVISOR, 1);
+    bool sorted = (op == ComplexityOp::BstInsertSorted || op == ComplexityOp::RbInsertSorted);
+    Keys keys = makeKeys(n, batch, sorted, seed);
+
+    auto fillSequence = [&keys](auto& structure, auto insert) {
+        for (int key : keys.build) insert(structure, key);
+    };
+
+    switch (op) {
+        case ComplexityOp::StackPush:
+        case ComplexityOp::StackPop: {
+            Stack<int, DYNAMIC_CAPACITY> stack;
+            auto build = [&](auto& s) { fillSequence(s, [](auto& t, int key) { t.push(key); }); };
+            if (op == ComplexityOp::StackPush) {
+                return measureBatch(stack, n, batch, build,
+                    [&keys](auto& s, size_t i) { s.push(keys.fresh[i]); });
+            }
+            return measureBatch(stack, n, batch, build,
+                [](auto& s, size_t) { g_sink = g_sink + static_cast<std::uint64_t>(*s.pop()); });
+        }
+
+        case ComplexityOp::QueueEnqueue:
+        case ComplexityOp::QueueDequeue: {
+            Queue<int, DYNAMIC_CAPACITY> queue;
+            auto build = [&](auto& q) { fillSequence(q, [](auto& t, int key) { t.enqueue(key); }); };
+            if (op == ComplexityOp::QueueEnqueue) {
+                return measureBatch(queue, n, batch, build,
+                    [&keys](auto& q, size_t i) { q.enqueue(keys.fresh[i]); });
+            }
+            return measureBatch(queue, n, batch, build,
+                [](auto& q, size_t) { g_sink = g_sink + static_cast<std::uint64_t>(*q.dequeue()); });
+        }
+
+        case ComplexityOp::ArrayPushBack:
+        case ComplexityOp::ArrayInsertFront:
+        case ComplexityOp::ArrayFind: {
+            DynamicArray<int> array;
+            auto build = [&](auto& a) { fillSequence(a, [](auto& t, int key) { t.pushBack(key); }); };
+            if (op == ComplexityOp::ArrayPushBack) {
+                return measureBatch(array, n, batch, build,
+                    [&keys](auto& a, size_t i) { a.pushBack(keys.fresh[i]); });
+            }
+            if (op == ComplexityOp::ArrayInsertFront) {
+                return measureBatch(array, n, batch, build,
+                    [&keys](auto& a, size_t i) { a.insert(0, keys.fresh[i]); });
+            }
+            return measureBatch(array, n, batch, build,
+                [&keys](auto& a, size_t i) { g_sink = g_sink + a.find(keys.present[i]).value_or(0); });
+        }
+
+        case ComplexityOp::ListInsertFront:
+        case ComplexityOp::ListInsertBack:
+        case ComplexityOp::ListDeleteBack:
+        case ComplexityOp::ListFind: {
+            LinkedList<int> list;
+            list.reserve(n + batch);
+            auto build = [&](auto& l) { fillSequence(l, [](auto& t, int key) { t.insertFront(key); }); };
+            if (op == ComplexityOp::ListInsertFront) {
+                return measureBatch(list, n, batch, build,
+                    [&keys](auto& l, size_t i) { l.insertFront(keys.fresh[i]); });
+            }
+            if (op == ComplexityOp::ListInsertBack) {
+                return measureBatch(list, n, batch, build,
+                    [&keys](auto& l, size_t i) { l.insertBack(keys.fresh[i]); });
+            }
+            if (op == ComplexityOp::ListDeleteBack) {
+                return measureBatch(list, n, batch, build,
+                    [](auto& l, size_t) { g_sink = g_sink + static_cast<std::uint64_t>(*l.deleteBack()); });
+            }
+            return measureBatch(list, n, batch, build,
+                [&keys](auto& l, size_t i) { g_sink = g_sink + l.find(keys.present[i]).value_or(0); });
+        }
+
+        case ComplexityOp::DListDeleteBack: {
+            DoublyLinkedList<int> list;
+            list.reserve(n);
+            return measureBatch(list, n, batch,
+                [&keys](auto& l) { l.appendRange(keys.build.begin(), keys.build.end()); },
+                [](auto& l, size_t) { g_sink = g_sink + static_cast<std::uint64_t>(*l.deleteBack()); });
+        }
+
+        case ComplexityOp::BstInsertRandom:
+        case ComplexityOp::BstInsertSorted:
+        case ComplexityOp::BstSearch: {
+            BinarySearchTree<int> tree;
+            tree.reserve(n + batch);
+            auto build = [&](auto& t) { fillSequence(t, [](auto& u, int key) { u.insert(key); }); };
+            if (op == ComplexityOp::BstSearch) {
+                return measureBatch(tree, n, batch, build,
+                    [&keys](auto& t, size_t i) { g_sink = g_sink + (t.search(keys.present[i]) ? 1 : 0); });
+            }
+            return measureBatch(tree, n, batch, build,
+                [&keys](auto& t, size_t i) { t.insert(keys.fresh[i]); });
+        }
+
+        case ComplexityOp::RbInsertRandom:
+        case ComplexityOp::RbInsertSorted:
+        case ComplexityOp::RbSearch: {
+            RedBlackTree<int> tree;
+            tree.reserve(n + batch);
+            auto build = [&](auto& t) { fillSequence(t, [](auto& u, int key) { u.insert(key); }); };
+            if (op == ComplexityOp::RbSearch) {
+                return measureBatch(tree, n, batch, build,
+                    [&keys](auto& t, size_t i) { g_sink = g_sink + (t.search(keys.present[i]) ? 1 : 0); });
+            }
+            return measureBatch(tree, n, batch, build,
+                [&keys](auto& t, size_t i) { t.insert(keys.fresh[i]); });
+        }
+
+        case ComplexityOp::RbSelect: {
+            RedBlackTree<int, true> tree;
+            tree.reserve(n);
+            auto build = [&](auto& t) { fillSequence(t, [](auto& u, int key) { u.insert(key); }); };
+            // Key 2k has rank k, so the present keys double as ranks
+            return measureBatch(tree, n, batch, build, [&keys](auto& t, size_t i) {
+                g_sink = g_sink + static_cast<std::uint64_t>(t.select(keys.present[i] / 2)->data);
+            });
+        }
+    }
+    return ComplexitySample{};
+}
+
+bool runComplexity(ComplexityOp op, size_t minExponent, size_t maxExponent, std::uint32_t seed,
+                   std::vector<ComplexitySample>& out, const std::atomic<bool>* cancel) {
+    out.clear();
+    minExponent = std::clamp(minExponent, COMPLEXITY_MIN_EXPONENT, COMPLEXITY_MAX_EXPONENT);
+    maxExponent = std::clamp(maxExponent, minExponent, COMPLEXITY_MAX_EXPONENT);
+
+    for (size_t exponent = minExponent; exponent <= maxExponent; ++exponent) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) {
+            return false;
+        }
+        out.push_back(measureComplexity(op, size_t{1} << exponent, seed));
+    }
+    return true;
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,353 @@
+/**
+ * @file concurrent_workload.cpp
+ * @brief Implementation of the producer/consumer workload runner
+ */
+
+#include "algorithms/concurrent_workload.hpp"
+#include "data_structures/lock_free_queue.hpp"
+#include "data_structures/lock_free_stack.hpp"
+#include "data_structures/mpmc_queue.hpp"
+#include "data_structures/queue.hpp"
+#include "data_structures/stack.hpp"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace dsav::algorithms {
+
+namespace {
+
+using Item = std::uint64_t;
+
+/// Producers check the cancel flag once per this many items
+constexpr size_t CANCEL_POLL_INTERVAL = 1024;
+
+/// Probe site of the baselines' mutex
+constexpr size_t LOCK_SITE = 0;
+
+/**
+ * @brief Take a mutex, reporting a contended try_lock as a failed attempt
+ */
+void lockProbed(std::mutex& mutex, ContentionProbe* probe, ContentionOp op) {
+    if (mutex.try_lock()) {
+        if (probe) probe->recordCas(LOCK_SITE, op, true);
+        return;
+    }
+    if (probe) probe->recordCas(LOCK_SITE, op, false);
+    mutex.lock();
+}
+
+// Adapters giving every container the same tryPush/tryPop shape
+
+class MutexQueueAdapter {
+public:
+    explicit MutexQueueAdapter(ContentionProbe* probe) : m_probe(probe) {}
+
+    bool tryPush(Item value) {
+        lockProbed(m_mutex, m_probe, ContentionOp::Push);
+        m_queue.enqueue(value);
+        m_mutex.unlock();
+        if (m_probe) m_probe->recordOp(ContentionOp::Push);
+        return true;
+    }
+
+    std::optional<Item> tryPop() {
+        lockProbed(m_mutex, m_probe, ContentionOp::Pop);
+        std::optional<Item> value = m_queue.dequeue();
+        m_mutex.unlock();
+        if (value && m_probe) m_probe->recordOp(ContentionOp::Pop);
+        return value;
+    }
+
+private:
+    std::mutex m_mutex;
+    Queue<Item, DYNAMIC_CAPACITY> m_queue;
+    ContentionProbe* m_probe;
+};
+
+class MutexStackAdapter {
+public:
+    explicit MutexStackAdapter(ContentionProbe* probe) : m_probe(probe) {}
+
+    bool tryPush(Item value) {
+        lockProbed(m_mutex, m_probe, ContentionOp::Push);
+        m_stack.push(value);
+        m_mutex.unlock();
+        if (m_probe) m_probe->recordOp(ContentionOp::Push);
+        return true;
+    }
+
+    std::optional<Item> tryPop() {
+        lockProbed(m_mutex, m_probe, ContentionOp::Pop);
+        std::optional<Item> value = m_stack.pop();
+        m_mutex.unlock();
+        if (value && m_probe) m_probe->recordOp(ContentionOp::Pop);
+        return value;
+    }
+
+private:
+    std::mutex m_mutex;
+    Stack<Item, DYNAMIC_CAPACITY> m_stack;
+    ContentionProbe* m_probe;
+};
+
+class MichaelScottAdapter {
+public:
+    explicit MichaelScottAdapter(ContentionProbe* probe) { m_queue.setProbe(probe); }
+    bool tryPush(Item value) { m_queue.enqueue(value); return true; }
+    std::optional<Item> tryPop() { return m_queue.dequeue(); }
+
+private:
+    LockFreeQueue<Item> m_queue;
+};
+
+class RingAdapter {
+public:
+    RingAdapter(ContentionProbe* probe, size_t capacity) : m_queue(capacity) { m_queue.setProbe(probe); }
+    bool tryPush(Item value) { return m_queue.tryPush(std::move(value)); }
+    std::optional<Item> tryPop() { return m_queue.tryPop(); }
+
+private:
+    MpmcQueue<Item> m_queue;
+};
+
+class TreiberAdapter {
+public:
+    explicit TreiberAdapter(ContentionProbe* probe) { m_stack.setProbe(probe); }
+    bool tryPush(Item value) { m_stack.push(value); return true; }
+    std::optional<Item> tryPop() { return m_stack.pop(); }
+
+private:
+    LockFreeStack<Item> m_stack;
+};
+
+/// Per-thread sums compared at the end (sum and sum of squares catch both loss and duplication)
+struct Checksum {
+    std::uint64_t count = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t squares = 0;
+
+    void add(Item value) {
+        ++count;
+        sum += value;
+        squares += value * value;
+    }
+};
+
+template<typename Container>
+bool runOn(Container& container, size_t producers, size_t consumers, size_t itemsPerProducer,
+           ConcurrentResult& result, const std::atomic<bool>* cancel) {
+    std::atomic<bool> go{false};
+    std::atomic<size_t> ready{0};
+    std::atomic<size_t> producersDone{0};
+    std::atomic<bool> cancelled{false};
+
+    std::vector<Checksum> pushed(producers);
+    std::vector<Checksum> popped(consumers);
+    std::vector<std::thread> threads;
+    threads.reserve(producers + consumers);
+
+    auto waitForStart = [&]() {
+        ready.fetch_add(1, std::memory_order_acq_rel);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    };
+
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            ContentionProbe::bindThread(p);
+            waitForStart();
+            Checksum local;
+            Item base = static_cast<Item>(p) * itemsPerProducer;
+            for (size_t i = 0; i < itemsPerProducer; ++i) {
+                if (i % CANCEL_POLL_INTERVAL == 0 && cancel &&
+                    cancel->load(std::memory_order_relaxed)) {
+                    cancelled.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                Item value = base + i + 1;
+                while (!container.tryPush(value)) {
+                    std::this_thread::yield();  // Bounded ring is full
+                }
+                local.add(value);
+            }
+            pushed[p] = local;
+            producersDone.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            ContentionProbe::bindThread(producers + c);
+            waitForStart();
+            Checksum local;
+            for (;;) {
+                // Read the flag before popping: an empty pop after every producer finished is final
+                bool finished = producersDone.load(std::memory_order_acquire) == producers;
+                std::optional<Item> value = container.tryPop();
+                if (value) {
+                    local.add(*value);
+                } else if (finished) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            popped[c] = local;
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) != producers + consumers) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Checksum in;
+    Checksum out;
+    for (const Checksum& c : pushed) { in.count += c.count; in.sum += c.sum; in.squares += c.squares; }
+    for (const Checksum& c : popped) { out.count += c.count; out.sum += c.sum; out.squares += c.squares; }
+
+    result.itemsPushed = in.count;
+    result.itemsPopped = out.count;
+    result.completed = !cancelled.load(std::memory_order_relaxed);
+    result.checksumOk = in.count == out.count && in.sum == out.sum && in.squares == out.squares;
+    return result.completed && result.checksumOk;
+}
+
+} // namespace
+
+const char* concurrentContainerName(ConcurrentContainer container) {
+    switch (container) {
+        case ConcurrentContainer::MutexQueue: return "mutex Queue";
+        case ConcurrentContainer::MichaelScottQueue: return "Michael-Scott queue";
+        case ConcurrentContainer::MpmcRing: return "MPMC ring";
+        case ConcurrentContainer::MutexStack: return "mutex Stack";
+        case ConcurrentContainer::TreiberStack: return "Treiber stack";
+    }
+    return "?";
+}
+
+const char* concurrentContainerKey(ConcurrentContainer container) {
+    switch (container) {
+        case ConcurrentContainer::MutexQueue: return "mutex-queue";
+        case ConcurrentContainer::MichaelScottQueue: return "ms-queue";
+        case ConcurrentContainer::MpmcRing: return "ring";
+        case ConcurrentContainer::MutexStack: return "mutex-stack";
+        case ConcurrentContainer::TreiberStack: return "treiber";
+    }
+    return "?";
+}
+
+bool parseConcurrentContainer(const std::string& key, ConcurrentContainer& container) {
+    for (size_t i = 0; i < CONCURRENT_CONTAINER_COUNT; ++i) {
+        auto candidate = static_cast<ConcurrentContainer>(i);
+        if (key == concurrentContainerKey(candidate)) {
+            container = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+ConcurrentContainer mutexBaselineFor(ConcurrentContainer container) {
+    switch (container) {
+        case ConcurrentContainer::MutexStack:
+        case ConcurrentContainer::TreiberStack:
+            return ConcurrentContainer::MutexStack;
+        default:
+            return ConcurrentContainer::MutexQueue;
+    }
+}
+
+bool isMutexBaseline(ConcurrentContainer container) {
+    return container == ConcurrentContainer::MutexQueue || container == ConcurrentContainer::MutexStack;
+}
+
+size_t contentionSiteCount(ConcurrentContainer container, size_t ringCapacity) {
+    switch (container) {
+        case ConcurrentContainer::MichaelScottQueue: return LockFreeQueue<Item>::SITE_COUNT;
+        case ConcurrentContainer::TreiberStack: return LockFreeStack<Item>::SITE_COUNT;
+        case ConcurrentContainer::MpmcRing: {
+            size_t size = 2;
+            while (size < ringCapacity) size <<= 1;
+            return size;
+        }
+        default:
+            return 1;
+    }
+}
+
+const char* contentionSiteName(ConcurrentContainer container, size_t site) {
+    switch (container) {
+        case ConcurrentContainer::MichaelScottQueue:
+            switch (site) {
+                case LockFreeQueue<Item>::HEAD_SITE: return "head";
+                case LockFreeQueue<Item>::TAIL_SITE: return "tail";
+                case LockFreeQueue<Item>::LINK_SITE: return "link";
+                default: return nullptr;
+            }
+        case ConcurrentContainer::TreiberStack:
+            return site == LockFreeStack<Item>::TOP_SITE ? "top" : nullptr;
+        case ConcurrentContainer::MpmcRing:
+            return nullptr;
+        default:
+            return site == LOCK_SITE ? "lock" : nullptr;
+    }
+}
+
+size_t ConcurrentWorkload::threadCount() const {
+    return std::clamp<size_t>(producers, 1, MAX_PRODUCERS) + std::clamp<size_t>(consumers, 1, MAX_CONSUMERS);
+}
+
+bool runConcurrentWorkload(const ConcurrentWorkload& workload, ConcurrentResult& result,
+                           ContentionProbe* probe, const std::atomic<bool>* cancel) {
+    result = ConcurrentResult();
+    size_t producers = std::clamp<size_t>(workload.producers, 1, ConcurrentWorkload::MAX_PRODUCERS);
+    size_t consumers = std::clamp<size_t>(workload.consumers, 1, ConcurrentWorkload::MAX_CONSUMERS);
+    size_t items = workload.itemsPerProducer;
+
+    bool ok = false;
+    switch (workload.container) {
+        case ConcurrentContainer::MutexQueue: {
+            MutexQueueAdapter container(probe);
+            ok = runOn(container, producers, consumers, items, result, cancel);
+            break;
+        }
+        case ConcurrentContainer::MichaelScottQueue: {
+            MichaelScottAdapter container(probe);
+            ok = runOn(container, producers, consumers, items, result, cancel);
+            break;
+        }
+        case ConcurrentContainer::MpmcRing: {
+            RingAdapter container(probe, workload.ringCapacity);
+            ok = runOn(container, producers, consumers, items, result, cancel);
+            break;
+        }
+        case ConcurrentContainer::MutexStack: {
+            MutexStackAdapter container(probe);
+            ok = runOn(container, producers, consumers, items, result, cancel);
+            break;
+        }
+        case ConcurrentContainer::TreiberStack: {
+            TreiberAdapter container(probe);
+            ok = runOn(container, producers, consumers, items, result, cancel);
+            break;
+        }
+    }
+
+    if (probe) {
+        result.totals = probe->totals();
+    }
+    return ok;
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,721 @@
+/**
+ * @file dataset_import.cpp
+ * @brief Memory-mapped and streamed dataset readers, compact format writer
+ */
+
+#include "algorithms/dataset_import.hpp"
+#include "algorithms/byte_order.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dsav::algorithms {
+
+namespace {
+
+using detail::HOST_LITTLE_ENDIAN;
+using detail::loadLE32;
+using detail::loadLE64;
+using detail::storeLE;
+
+constexpr char COMPACT_MAGIC[8] = {'D', 'S', 'A', 'V', 'K', 'E', 'Y', 'S'};
+constexpr std::uint8_t FLAG_RANGE = 0x01;
+constexpr std::uint8_t FLAG_SORTEDNESS = 0x02;
+constexpr size_t MAX_TOKEN_BYTES = 64;   ///< Longer text tokens cannot be integers
+
+bool hasSuffix(const std::string& path, const char* suffix) {
+    size_t n = std::strlen(suffix);
+    if (path.size() < n) return false;
+    for (size_t i = 0; i < n; ++i) {
+        char c = path[path.size() - n + i];
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+        if (c != suffix[i]) return false;
+    }
+    return true;
+}
+
+bool isCancelled(const std::atomic<bool>* cancel) {
+    return cancel && cancel->load(std::memory_order_relaxed);
+}
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+/**
+ * @brief Index of the j-th of take evenly spaced keys out of total
+ *
+ * floor(j * total / take) without the product overflowing.
+ */
+size_t sampleIndex(size_t j, size_t total, size_t take) {
+    size_t q = total / take;
+    size_t r = total % take;
+    return q * j + static_cast<size_t>((static_cast<std::uint64_t>(r) * j) / take);
+}
+
+} // namespace
+
+const char* datasetFormatName(DatasetFormat format) {
+    switch (format) {
+        case DatasetFormat::Auto:    return "auto";
+        case DatasetFormat::Int32:   return "int32";
+        case DatasetFormat::Int64:   return "int64";
+        case DatasetFormat::Text:    return "text";
+        case DatasetFormat::Compact: return "compact";
+    }
+    return "?";
+}
+
+// ===== MappedFile =====
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        m_error = "Cannot open " + path;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        m_error = "Cannot read the size of " + path;
+        return false;
+    }
+    m_file = file;
+    m_size = static_cast<size_t>(size.QuadPart);
+    m_open = true;
+    if (m_size == 0) {
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        close();
+        m_error = "Cannot map " + path;
+        return false;
+    }
+    m_mapping = mapping;
+    m_data = static_cast<const std::uint8_t*>(view);
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(static_cast<HANDLE>(m_mapping));
+    if (m_file) CloseHandle(static_cast<HANDLE>(m_file));
+    m_data = nullptr;
+    m_mapping = nullptr;
+    m_file = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+#else
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        m_error = "Cannot open " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        m_error = path + " is not a regular file";
+        return false;
+    }
+
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size > 0) {
+        void* view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            m_size = 0;
+            m_error = "Cannot map " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        // Reads are front to back; let the kernel read ahead aggressively
+        madvise(view, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const std::uint8_t*>(view);
+    }
+    // The mapping keeps the file alive
+    ::close(fd);
+    m_open = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) {
+        munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+#endif
+
+// ===== DatasetReader =====
+
+DatasetReader::~DatasetReader() {
+    close();
+}
+
+bool DatasetReader::fail(std::string message) {
+    m_error = std::move(message);
+    return false;
+}
+
+void DatasetReader::close() {
+    m_map.close();
+    m_keys = nullptr;
+    m_info = DatasetInfo();
+    m_path.clear();
+    m_open = false;
+}
+
+bool DatasetReader::open(const std::string& path, DatasetFormat format) {
+    close();
+    m_error.clear();
+    m_path = path;
+
+    if (format != DatasetFormat::Text) {
+        if (!m_map.open(path)) {
+            return fail(m_map.error());
+        }
+        const std::uint8_t* data = m_map.data();
+        size_t size = m_map.size();
+
+        if (format == DatasetFormat::Auto) {
+            if (size >= COMPACT_HEADER_BYTES && std::memcmp(data, COMPACT_MAGIC, sizeof(COMPACT_MAGIC)) == 0) {
+                format = DatasetFormat::Compact;
+            } else if (hasSuffix(path, ".i32") || hasSuffix(path, ".int32")) {
+                format = DatasetFormat::Int32;
+            } else if (hasSuffix(path, ".i64") || hasSuffix(path, ".int64")) {
+                format = DatasetFormat::Int64;
+            } else {
+                format = DatasetFormat::Text;
+                m_map.close();
+            }
+        }
+
+        if (format == DatasetFormat::Int32 || format == DatasetFormat::Int64) {
+            unsigned width = format == DatasetFormat::Int32 ? 4 : 8;
+            if (size % width != 0) {
+                close();
+                return fail(path + ": size is not a multiple of " + std::to_string(width) + " bytes");
+            }
+            m_keys = data;
+            m_info.keyBytes = width;
+            m_info.hasCount = true;
+            m_info.count = size / width;
+        } else if (format == DatasetFormat::Compact) {
+            detail::FileHeader header;
+            if (!detail::loadFileHeader(data, size, COMPACT_MAGIC, COMPACT_HEADER_BYTES, header)) {
+                close();
+                return fail(path + ": not a compact key file");
+            }
+            // Bytes 10 and 11 hold the key width and the flags
+            unsigned width = header.format[0];
+            std::uint8_t flags = header.format[1];
+            std::uint64_t count = header.count;
+            if (header.version != COMPACT_VERSION) {
+                close();
+                return fail(path + ": unsupported compact version " + std::to_string(header.version));
+            }
+            if ((width != 4 && width != 8) || !detail::payloadFits(header, size, COMPACT_HEADER_BYTES, width)) {
+                close();
+                return fail(path + ": corrupt or truncated compact header");
+            }
+            m_keys = data + header.offset;
+            m_info.keyBytes = width;
+            m_info.hasCount = true;
+            m_info.count = count;
+            if (flags & FLAG_RANGE) {
+                m_info.hasRange = true;
+                m_info.minKey = static_cast<std::int64_t>(loadLE64(data + 24));
+                m_info.maxKey = static_cast<std::int64_t>(loadLE64(data + 32));
+                if (m_info.minKey > m_info.maxKey && count > 0) {
+                    close();
+                    return fail(path + ": corrupt key range in compact header");
+                }
+            }
+            if (flags & FLAG_SORTEDNESS) {
+                m_info.hasSortedness = true;
+                m_info.sortedness.descents = loadLE64(data + 40);
+                m_info.sortedness.duplicates = loadLE64(data + 48);
+            }
+        }
+    }
+
+    if (format == DatasetFormat::Text) {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) {
+            return fail("Cannot open " + path);
+        }
+        std::fclose(file);
+        m_info.keyBytes = 8;
+    }
+
+    m_info.format = format;
+    m_open = true;
+    return true;
+}
+
+std::int64_t DatasetReader::wideKeyAt(size_t index) const {
+    const std::uint8_t* p = m_keys + index * m_info.keyBytes;
+    if (m_info.keyBytes == 4) {
+        return static_cast<std::int32_t>(loadLE32(p));
+    }
+    return static_cast<std::int64_t>(loadLE64(p));
+}
+
+int DatasetReader::narrow(std::int64_t key) const {
+    if (!m_info.narrowed) {
+        return static_cast<int>(key);
+    }
+    std::uint64_t offset = static_cast<std::uint64_t>(key) - static_cast<std::uint64_t>(m_info.minKey);
+    return static_cast<int>(offset >> m_info.narrowShift);
+}
+
+int DatasetReader::keyAt(size_t index) const {
+    return narrow(wideKeyAt(index));
+}
+
+bool DatasetReader::streamText(const std::function<bool(std::int64_t)>& onKey, const std::atomic<bool>* cancel) {
+    std::FILE* file = std::fopen(m_path.c_str(), "rb");
+    if (!file) {
+        return fail("Cannot open " + m_path);
+    }
+
+    std::vector<char> buffer(TEXT_BUFFER_BYTES + MAX_TOKEN_BYTES);
+    size_t kept = 0;             // Bytes of a token cut by the previous read
+    size_t line = 1;
+    bool inComment = false;
+    bool ok = true;
+
+    while (ok) {
+        if (isCancelled(cancel)) {
+            ok = fail("Cancelled");
+            break;
+        }
+        size_t got = std::fread(buffer.data() + kept, 1, TEXT_BUFFER_BYTES, file);
+        bool atEnd = got < TEXT_BUFFER_BYTES;
+        size_t length = kept + got;
+        const char* p = buffer.data();
+        const char* end = p + length;
+        kept = 0;
+
+        while (p < end) {
+            char c = *p;
+            if (inComment) {
+                if (c == '\n') {
+                    inComment = false;
+                    ++line;
+                }
+                ++p;
+                continue;
+            }
+            if (isSpace(c)) {
+                line += (c == '\n') ? 1 : 0;
+                ++p;
+                continue;
+            }
+            if (c == '#') {
+                inComment = true;
+                ++p;
+                continue;
+            }
+
+            const char* tokenEnd = p;
+            while (tokenEnd < end && !isSpace(*tokenEnd) && *tokenEnd != '#') ++tokenEnd;
+            if (tokenEnd == end && !atEnd) {
+                // Token runs past this buffer: carry it into the next read
+                kept = static_cast<size_t>(end - p);
+                if (kept > MAX_TOKEN_BYTES) {
+                    ok = fail(m_path + ":" + std::to_string(line) + ": token too long for an integer");
+                    break;
+                }
+                std::memmove(buffer.data(), p, kept);
+                break;
+            }
+
+            // A leading '+' is allowed only before a digit ("+-5" is malformed)
+            bool plus = *p == '+' && p + 1 < tokenEnd && p[1] >= '0' && p[1] <= '9';
+            const char* digits = plus ? p + 1 : p;
+            std::int64_t key = 0;
+            auto result = std::from_chars(digits, tokenEnd, key);
+            if (result.ec != std::errc() || result.ptr != tokenEnd || digits == tokenEnd) {
+                std::string token(p, static_cast<size_t>(std::min<std::ptrdiff_t>(tokenEnd - p, 32)));
+                ok = fail(m_path + ":" + std::to_string(line) + ": '" + token + "' is not a 64-bit integer");
+                break;
+            }
+            if (!onKey(key)) {
+                ok = false;
+                break;
+            }
+            p = tokenEnd;
+        }
+
+        if (atEnd) {
+            if (ok && std::ferror(file)) {
+                ok = fail("Read error in " + m_path);
+            }
+            break;
+        }
+    }
+
+    std::fclose(file);
+    return ok;
+}
+
+bool DatasetReader::scan(const std::atomic<bool>* cancel) {
+    if (!m_open) {
+        return fail("No dataset open");
+    }
+    if (m_info.hasCount && m_info.hasRange && m_info.hasSortedness) {
+        return true;
+    }
+
+    std::uint64_t count = 0;
+    std::int64_t minKey = std::numeric_limits<std::int64_t>::max();
+    std::int64_t maxKey = std::numeric_limits<std::int64_t>::min();
+    std::int64_t previous = 0;
+    DatasetSortedness sortedness;
+    auto visit = [&](std::int64_t key) {
+        if (count > 0) {
+            sortedness.descents += (previous > key) ? 1 : 0;
+            sortedness.duplicates += (previous == key) ? 1 : 0;
+        }
+        minKey = std::min(minKey, key);
+        maxKey = std::max(maxKey, key);
+        previous = key;
+        ++count;
+    };
+
+    if (isMapped()) {
+        size_t n = static_cast<size_t>(m_info.count);
+        for (size_t first = 0; first < n; first += CHUNK_KEYS) {
+            if (isCancelled(cancel)) {
+                return fail("Cancelled");
+            }
+            size_t last = std::min(n, first + CHUNK_KEYS);
+            for (size_t i = first; i < last; ++i) {
+                visit(wideKeyAt(i));
+            }
+        }
+    } else if (!streamText([&](std::int64_t key) { visit(key); return true; }, cancel)) {
+        return false;
+    }
+
+    m_info.hasCount = true;
+    m_info.count = count;
+    m_info.hasRange = true;
+    m_info.minKey = count > 0 ? minKey : 0;
+    m_info.maxKey = count > 0 ? maxKey : 0;
+    m_info.hasSortedness = true;
+    m_info.sortedness = sortedness;
+    return true;
+}
+
+bool DatasetReader::prepare(const std::atomic<bool>* cancel) {
+    if (!m_open) {
+        return fail("No dataset open");
+    }
+    m_info.narrowed = false;
+    m_info.narrowShift = 0;
+
+    // int32 files are exact; everything else needs the range (text also its count)
+    if (isMapped() && m_info.keyBytes == 4) {
+        return true;
+    }
+    if ((!m_info.hasRange || !m_info.hasCount) && !scan(cancel)) {
+        return false;
+    }
+    if (m_info.minKey >= INT_MIN && m_info.maxKey <= INT_MAX) {
+        return true;
+    }
+
+    std::uint64_t span = static_cast<std::uint64_t>(m_info.maxKey) - static_cast<std::uint64_t>(m_info.minKey);
+    while ((span >> m_info.narrowShift) > static_cast<std::uint64_t>(INT_MAX)) {
+        ++m_info.narrowShift;
+    }
+    m_info.narrowed = true;
+    return true;
+}
+
+size_t DatasetReader::sampledCount(size_t maxKeys) const {
+    size_t total = static_cast<size_t>(m_info.count);
+    return std::min(total, maxKeys);
+}
+
+bool DatasetReader::read(const DatasetChunkSink& sink, size_t maxKeys, const std::atomic<bool>* cancel) {
+    if (!prepare(cancel)) {
+        return false;
+    }
+
+    size_t total = static_cast<size_t>(m_info.count);
+    size_t take = sampledCount(maxKeys);
+    bool sampling = take < total;
+    if (take == 0) {
+        return true;
+    }
+
+    // Aligned int32 keys in host order are handed out straight from the mapping
+    if (isMapped() && !sampling && m_info.keyBytes == 4 && HOST_LITTLE_ENDIAN &&
+        reinterpret_cast<std::uintptr_t>(m_keys) % alignof(int) == 0) {
+        const int* keys = reinterpret_cast<const int*>(m_keys);
+        for (size_t first = 0; first < total; first += CHUNK_KEYS) {
+            if (isCancelled(cancel)) {
+                return fail("Cancelled");
+            }
+            if (!sink(keys + first, std::min(CHUNK_KEYS, total - first))) {
+                return fail("Read stopped early");
+            }
+        }
+        return true;
+    }
+
+    std::vector<int> chunk;
+    chunk.reserve(std::min(CHUNK_KEYS, take));
+    auto flush = [&]() {
+        bool more = chunk.empty() || sink(chunk.data(), chunk.size());
+        chunk.clear();
+        return more;
+    };
+
+    if (isMapped()) {
+        for (size_t j = 0; j < take; ++j) {
+            chunk.push_back(keyAt(sampling ? sampleIndex(j, total, take) : j));
+            if (chunk.size() == CHUNK_KEYS) {
+                if (isCancelled(cancel)) {
+                    return fail("Cancelled");
+                }
+                if (!flush()) {
+                    return fail("Read stopped early");
+                }
+            }
+        }
+        return flush() || fail("Read stopped early");
+    }
+
+    // Text: pick the sampled positions while streaming
+    size_t position = 0;
+    size_t picked = 0;
+    size_t nextPick = 0;
+    bool sinkStopped = false;
+    bool ok = streamText([&](std::int64_t key) {
+        if (position++ == nextPick) {
+            chunk.push_back(narrow(key));
+            ++picked;
+            nextPick = sampling ? sampleIndex(picked, total, take) : picked;
+            if (chunk.size() == CHUNK_KEYS && !flush()) {
+                sinkStopped = true;
+                return false;
+            }
+        }
+        return picked < take;
+    }, cancel);
+    if (sinkStopped) {
+        return fail("Read stopped early");
+    }
+    if (picked < take) {
+        // Parse error or cancellation (already reported), or the file shrank since scan()
+        return ok ? fail(m_path + " changed while it was read") : false;
+    }
+    return flush() || fail("Read stopped early");
+}
+
+bool DatasetReader::readInto(std::vector<int>& out, size_t maxKeys, const std::atomic<bool>* cancel) {
+    if (!prepare(cancel)) {
+        return false;
+    }
+    out.reserve(out.size() + sampledCount(maxKeys));
+    return read([&out](const int* keys, size_t count) {
+        out.insert(out.end(), keys, keys + count);
+        return true;
+    }, maxKeys, cancel);
+}
+
+bool DatasetReader::readWide(const DatasetWideSink& sink, const std::atomic<bool>* cancel) {
+    if (!m_open) {
+        return fail("No dataset open");
+    }
+
+    std::vector<std::int64_t> chunk;
+    chunk.reserve(CHUNK_KEYS);
+    auto flush = [&]() {
+        bool more = chunk.empty() || sink(chunk.data(), chunk.size());
+        chunk.clear();
+        return more;
+    };
+
+    if (isMapped()) {
+        size_t n = static_cast<size_t>(m_info.count);
+        for (size_t i = 0; i < n; ++i) {
+            chunk.push_back(wideKeyAt(i));
+            if (chunk.size() == CHUNK_KEYS) {
+                if (isCancelled(cancel)) {
+                    return fail("Cancelled");
+                }
+                if (!flush()) {
+                    return fail("Read stopped early");
+                }
+            }
+        }
+        return flush() || fail("Read stopped early");
+    }
+
+    bool sinkStopped = false;
+    bool ok = streamText([&](std::int64_t key) {
+        chunk.push_back(key);
+        if (chunk.size() == CHUNK_KEYS && !flush()) {
+            sinkStopped = true;
+            return false;
+        }
+        return true;
+    }, cancel);
+    if (sinkStopped) {
+        return fail("Read stopped early");
+    }
+    return ok && (flush() || fail("Read stopped early"));
+}
+
+// ===== CompactDatasetWriter =====
+
+CompactDatasetWriter::~CompactDatasetWriter() {
+    close();
+}
+
+bool CompactDatasetWriter::open(const std::string& path, unsigned keyBytes) {
+    if (m_file) {
+        m_error = "A file is already open";
+        return false;
+    }
+    if (keyBytes != 4 && keyBytes != 8) {
+        m_error = "Key width must be 4 or 8 bytes";
+        return false;
+    }
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        m_error = "Cannot create " + path;
+        return false;
+    }
+    m_keyBytes = keyBytes;
+    m_count = 0;
+    m_sortedness = DatasetSortedness();
+    m_failed = false;
+    m_error.clear();
+    m_buffer.clear();
+    m_buffer.reserve(DatasetReader::CHUNK_KEYS * keyBytes);
+
+    // Placeholder until close() knows the count and statistics
+    if (!writeHeader()) {
+        m_failed = true;
+        m_error = "Cannot write " + path;
+    }
+    return !m_failed;
+}
+
+bool CompactDatasetWriter::writeHeader() {
+    std::uint8_t header[DatasetReader::COMPACT_HEADER_BYTES] = {};
+    detail::FileHeader prefix;
+    prefix.version = DatasetReader::COMPACT_VERSION;
+    prefix.format[0] = static_cast<std::uint8_t>(m_keyBytes);
+    prefix.format[1] = m_count > 0 ? (FLAG_RANGE | FLAG_SORTEDNESS) : FLAG_SORTEDNESS;
+    prefix.offset = DatasetReader::COMPACT_HEADER_BYTES;
+    prefix.count = m_count;
+    detail::storeFileHeader(header, COMPACT_MAGIC, prefix);
+    storeLE(header + 24, static_cast<std::uint64_t>(m_min), 8);
+    storeLE(header + 32, static_cast<std::uint64_t>(m_max), 8);
+    storeLE(header + 40, m_sortedness.descents, 8);
+    storeLE(header + 48, m_sortedness.duplicates, 8);
+    return std::fseek(m_file, 0, SEEK_SET) == 0 &&
+           std::fwrite(header, 1, sizeof(header), m_file) == sizeof(header);
+}
+
+bool CompactDatasetWriter::append(const std::int64_t* keys, size_t count) {
+    if (!m_file) {
+        m_error = "No file open";
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        std::int64_t key = keys[i];
+        if (m_keyBytes == 4 && (key < INT32_MIN || key > INT32_MAX)) {
+            m_failed = true;
+            m_error = "Key " + std::to_string(key) + " does not fit 4 bytes";
+            return false;
+        }
+        if (m_count == 0) {
+            m_min = m_max = key;
+        } else {
+            m_sortedness.descents += (m_last > key) ? 1 : 0;
+            m_sortedness.duplicates += (m_last == key) ? 1 : 0;
+            m_min = std::min(m_min, key);
+            m_max = std::max(m_max, key);
+        }
+        m_last = key;
+        ++m_count;
+
+        size_t at = m_buffer.size();
+        m_buffer.resize(at + m_keyBytes);
+        storeLE(m_buffer.data() + at, static_cast<std::uint64_t>(key), m_keyBytes);
+        if (m_buffer.size() >= DatasetReader::CHUNK_KEYS * m_keyBytes) {
+            if (std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()) {
+                m_failed = true;
+                m_error = "Write failed";
+                return false;
+            }
+            m_buffer.clear();
+        }
+    }
+    return !m_failed;
+}
+
+bool CompactDatasetWriter::close() {
+    if (!m_file) {
+        return !m_failed;
+    }
+    if (!m_buffer.empty() && std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()) {
+        m_failed = true;
+    }
+    m_buffer.clear();
+    if (!m_failed && !writeHeader()) {
+        m_failed = true;
+    }
+    if (std::fclose(m_file) != 0) {
+        m_failed = true;
+    }
+    m_file = nullptr;
+    if (m_failed && m_error.empty()) {
+        m_error = "Write failed";
+    }
+    return !m_failed;
+}
+
+} // namespace dsav::algorithms
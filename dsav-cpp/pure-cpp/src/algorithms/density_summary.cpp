@@ -0,0 +1,300 @@
+/**
+ * @file density_summary.cpp
+ * @brief Bucket pyramid and tree density grid updates
+ */
+
+#include "algorithms/density_summary.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace dsav::algorithms {
+
+namespace {
+
+/**
+ * @brief Number of pyramid levels and level-0 buckets for a sequence length
+ */
+size_t leafCount(size_t count) {
+    return (count + ValueSummary::LEAF_SIZE - 1) / ValueSummary::LEAF_SIZE;
+}
+
+size_t levelCount(size_t count) {
+    size_t levels = 0;
+    for (size_t buckets = leafCount(count); buckets > 0; buckets = buckets > 1 ? (buckets + 1) / 2 : 0) {
+        ++levels;
+    }
+    return levels;
+}
+
+/**
+ * @brief Floor division (rounds toward negative infinity)
+ */
+std::int64_t floorDiv(std::int64_t a, std::int64_t b) {
+    std::int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+} // namespace
+
+// ===== ValueBucket =====
+
+void ValueBucket::merge(const ValueBucket& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    count += other.count;
+}
+
+// ===== ValueSummary =====
+
+void ValueSummary::clear() {
+    m_levels.clear();
+    m_count = 0;
+    m_lastRecomputed = 0;
+    ++m_version;
+}
+
+void ValueSummary::rebuild(const int* data, size_t count) {
+    m_levels.assign(levelCount(count), {});
+    m_count = count;
+    size_t buckets = leafCount(count);
+    for (auto& level : m_levels) {
+        level.resize(buckets);
+        buckets = (buckets + 1) / 2;
+    }
+    refresh(data, 0, leafCount(count));
+}
+
+void ValueSummary::update(const int* data, size_t count, size_t first, size_t last) {
+    if (count == 0) {
+        clear();
+        return;
+    }
+    if (count != m_count) {
+        // A new level seldom appears (the length doubled or halved): start over
+        if (levelCount(count) != m_levels.size()) {
+            rebuild(data, count);
+            return;
+        }
+        m_count = count;
+        size_t buckets = leafCount(count);
+        for (auto& level : m_levels) {
+            level.resize(buckets);
+            buckets = (buckets + 1) / 2;
+        }
+        // Everything after first moved; first may lie past a shrunken end
+        first = std::min(first, count - 1);
+        last = count;
+    } else {
+        last = std::min(last, count);
+        if (first >= last) return;
+    }
+    refresh(data, first / LEAF_SIZE, leafCount(last));
+}
+
+void ValueSummary::updateFrom(const std::vector<int>& before, const std::vector<int>& after) {
+    if (before.size() != m_count) {
+        rebuild(after.data(), after.size());
+        return;
+    }
+    size_t common = std::min(before.size(), after.size());
+    size_t prefix = static_cast<size_t>(
+        std::mismatch(before.begin(), before.begin() + common, after.begin()).first - before.begin());
+    if (before.size() != after.size()) {
+        update(after.data(), after.size(), prefix, after.size());
+        return;
+    }
+
+    size_t suffix = 0;
+    while (suffix < common - prefix && before[common - 1 - suffix] == after[common - 1 - suffix]) {
+        ++suffix;
+    }
+    update(after.data(), after.size(), prefix, common - suffix);
+}
+
+ValueBucket ValueSummary::total() const {
+    return m_levels.empty() ? ValueBucket{} : m_levels.back().front();
+}
+
+void ValueSummary::query(size_t first, size_t last, size_t columns, std::vector<ValueBucket>& out) const {
+    out.assign(columns, ValueBucket{});
+    last = std::min(last, m_count);
+    if (columns == 0 || first >= last) return;
+
+    // Coarsest level whose buckets still fit in a column
+    size_t span = last - first;
+    size_t perColumn = std::max<size_t>(1, span / columns);
+    size_t level = 0;
+    while (level + 1 < m_levels.size() && (LEAF_SIZE << (level + 1)) <= perColumn) {
+        ++level;
+    }
+    const std::vector<ValueBucket>& buckets = m_levels[level];
+    size_t width = LEAF_SIZE << level;
+
+    for (size_t c = 0; c < columns; ++c) {
+        size_t a = first + static_cast<size_t>(static_cast<std::uint64_t>(span) * c / columns);
+        size_t b = first + static_cast<size_t>(static_cast<std::uint64_t>(span) * (c + 1) / columns);
+        b = std::max(b, a + 1);
+        for (size_t i = a / width; i <= (b - 1) / width; ++i) {
+            out[c].merge(buckets[i]);
+        }
+    }
+}
+
+void ValueSummary::refresh(const int* data, size_t firstLeaf, size_t lastLeaf) {
+    if (m_levels.empty() || firstLeaf >= lastLeaf) return;
+
+    std::vector<ValueBucket>& leaves = m_levels.front();
+    for (size_t i = firstLeaf; i < lastLeaf; ++i) {
+        size_t begin = i * LEAF_SIZE;
+        size_t end = std::min(begin + LEAF_SIZE, m_count);
+        ValueBucket bucket;
+        bucket.min = data[begin];
+        bucket.max = data[begin];
+        for (size_t j = begin; j < end; ++j) {
+            bucket.min = std::min(bucket.min, data[j]);
+            bucket.max = std::max(bucket.max, data[j]);
+            bucket.sum += data[j];
+        }
+        bucket.count = static_cast<std::uint32_t>(end - begin);
+        leaves[i] = bucket;
+    }
+
+    // Only the ancestors of the recomputed leaves change
+    size_t lo = firstLeaf;
+    size_t hi = lastLeaf;
+    for (size_t k = 1; k < m_levels.size(); ++k) {
+        const std::vector<ValueBucket>& below = m_levels[k - 1];
+        std::vector<ValueBucket>& level = m_levels[k];
+        lo /= 2;
+        hi = (hi - 1) / 2 + 1;
+        for (size_t i = lo; i < hi; ++i) {
+            ValueBucket bucket = below[2 * i];
+            if (2 * i + 1 < below.size()) {
+                bucket.merge(below[2 * i + 1]);
+            }
+            level[i] = bucket;
+        }
+    }
+
+    m_lastRecomputed = lastLeaf - firstLeaf;
+    ++m_version;
+}
+
+// ===== TreeDensity =====
+
+void TreeDensity::reset(float centerX, float columnWidth) {
+    std::fill(m_cells.begin(), m_cells.end(), 0u);
+    m_depthCounts.clear();
+    m_nodeUnits.clear();
+    m_nodeDepth.clear();
+    m_size = 0;
+    m_centerX = centerX;
+    m_unit = std::max(columnWidth, 1e-3f);
+    m_unitsPerColumn = 1;
+    m_depthsPerRow = 1;
+    ++m_version;
+}
+
+void TreeDensity::place(std::uint32_t id, float x, int depth) {
+    depth = std::max(depth, 0);
+    auto units = static_cast<std::int64_t>(std::floor((x - m_centerX) / m_unit));
+
+    if (id >= m_nodeDepth.size()) {
+        m_nodeUnits.resize(id + 1, 0);
+        m_nodeDepth.resize(id + 1, ABSENT);
+    }
+    if (m_nodeDepth[id] != ABSENT) {
+        if (m_nodeUnits[id] == units && m_nodeDepth[id] == depth) return;
+        count(id, -1);
+    } else {
+        ++m_size;
+    }
+
+    m_nodeUnits[id] = units;
+    m_nodeDepth[id] = depth;
+    while (columnOf(units) == COLUMNS) {
+        widenColumns();
+    }
+    while (static_cast<size_t>(depth) / m_depthsPerRow >= MAX_ROWS) {
+        mergeRows();
+    }
+    count(id, 1);
+    ++m_version;
+}
+
+void TreeDensity::remove(std::uint32_t id) {
+    if (id >= m_nodeDepth.size() || m_nodeDepth[id] == ABSENT) return;
+    count(id, -1);
+    m_nodeDepth[id] = ABSENT;
+    --m_size;
+    while (!m_depthCounts.empty() && m_depthCounts.back() == 0) {
+        m_depthCounts.pop_back();
+    }
+    ++m_version;
+}
+
+size_t TreeDensity::rows() const {
+    return std::max<size_t>(1, (depthCount() + m_depthsPerRow - 1) / m_depthsPerRow);
+}
+
+std::uint32_t TreeDensity::maxCell() const {
+    auto end = m_cells.begin() + static_cast<std::ptrdiff_t>(rows() * COLUMNS);
+    return *std::max_element(m_cells.begin(), end);
+}
+
+size_t TreeDensity::depthCount() const {
+    return m_depthCounts.size();
+}
+
+size_t TreeDensity::columnOf(std::int64_t units) const {
+    std::int64_t column = floorDiv(units, m_unitsPerColumn) + static_cast<std::int64_t>(COLUMNS / 2);
+    return column >= 0 && column < static_cast<std::int64_t>(COLUMNS) ? static_cast<size_t>(column) : COLUMNS;
+}
+
+void TreeDensity::count(std::uint32_t id, int sign) {
+    auto depth = static_cast<size_t>(m_nodeDepth[id]);
+    size_t index = (depth / m_depthsPerRow) * COLUMNS + columnOf(m_nodeUnits[id]);
+    if (depth >= m_depthCounts.size()) {
+        m_depthCounts.resize(depth + 1, 0);
+    }
+    m_cells[index] += static_cast<std::uint32_t>(sign);
+    m_depthCounts[depth] += static_cast<std::uint32_t>(sign);
+}
+
+void TreeDensity::widenColumns() {
+    // Column c covers units [(c - C/2) * w, (c - C/2 + 1) * w); at 2w it lands in C/4 + c/2
+    std::vector<std::uint32_t> row(COLUMNS);
+    for (size_t r = 0; r < MAX_ROWS; ++r) {
+        std::uint32_t* cells = &m_cells[r * COLUMNS];
+        std::fill(row.begin(), row.end(), 0u);
+        for (size_t c = 0; c < COLUMNS; ++c) {
+            row[COLUMNS / 4 + c / 2] += cells[c];
+        }
+        std::copy(row.begin(), row.end(), cells);
+    }
+    m_unitsPerColumn *= 2;
+}
+
+void TreeDensity::mergeRows() {
+    for (size_t r = 0; r < MAX_ROWS; ++r) {
+        std::uint32_t* target = &m_cells[(r / 2) * COLUMNS];
+        const std::uint32_t* source = &m_cells[r * COLUMNS];
+        if (r % 2 == 0) {
+            std::copy(source, source + COLUMNS, target);
+        } else {
+            for (size_t c = 0; c < COLUMNS; ++c) {
+                target[c] += source[c];
+            }
+        }
+    }
+    std::fill(m_cells.begin() + static_cast<std::ptrdiff_t>((MAX_ROWS / 2) * COLUMNS), m_cells.end(), 0u);
+    m_depthsPerRow *= 2;
+}
+
+} // namespace dsav::algorithms
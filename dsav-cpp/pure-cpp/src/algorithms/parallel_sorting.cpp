@@ -0,0 +1,366 @@
+/**
+ * @file parallel_sorting.cpp
+ * @brief Implementation of the parallel merge and quick sort steppers
+ */
+
+#include "algorithms/parallel_sorting.hpp"
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace dsav::algorithms {
+
+namespace {
+
+/// Automatic grain never drops below this; smaller tasks cost more to hand out than to run
+constexpr size_t MIN_AUTO_GRAIN = 8192;
+
+/// Tasks per lane the automatic grain aims for, so stealing has something to balance
+constexpr size_t TASKS_PER_LANE = 4;
+
+/// Ranges this small are insertion sorted inside a task
+constexpr size_t INSERTION_CUTOFF = 16;
+
+size_t resolveLanes(size_t lanes) {
+    return std::clamp<size_t>(lanes == 0 ? defaultSortLanes() : lanes, 1, MAX_SORT_LANES);
+}
+
+size_t resolveGrain(size_t grain, size_t n, size_t lanes) {
+    if (grain > 0) {
+        return grain;
+    }
+    size_t perTask = (n + lanes * TASKS_PER_LANE - 1) / (lanes * TASKS_PER_LANE);
+    return std::max(perTask, MIN_AUTO_GRAIN);
+}
+
+/**
+ * @brief Number of elements of a among the first k outputs of a stable merge of a and b
+ */
+size_t coRank(size_t k, const int* a, size_t lenA, const int* b, size_t lenB) {
+    size_t lo = k > lenB ? k - lenB : 0;
+    size_t hi = std::min(k, lenA);
+    for (;;) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (i < lenA && j > 0 && a[i] <= b[j - 1]) {
+            lo = i + 1;         // a[i] is output before b[j - 1]: take more of a
+        } else if (i > 0 && j < lenB && a[i - 1] > b[j]) {
+            hi = i - 1;         // b[j] is output before a[i - 1]: take less of a
+        } else {
+            return i;
+        }
+    }
+}
+
+/**
+ * @brief Write outputs [outBegin, outEnd) of one merge level from src into dst
+ * @return Comparisons performed
+ */
+size_t mergeSlice(const int* src, int* dst, size_t n, size_t width, size_t outBegin, size_t outEnd) {
+    size_t comparisons = 0;
+    for (size_t left = outBegin / (2 * width) * (2 * width); left < outEnd; left += 2 * width) {
+        size_t mid = std::min(left + width, n);
+        size_t right = std::min(left + 2 * width, n);
+        size_t begin = std::max(outBegin, left);
+        size_t end = std::min(outEnd, right);
+
+        const int* a = src + left;
+        const int* b = src + mid;
+        size_t lenA = mid - left;
+        size_t lenB = right - mid;
+        size_t i = coRank(begin - left, a, lenA, b, lenB);
+        size_t j = (begin - left) - i;
+
+        for (size_t k = begin; k < end; ++k) {
+            if (j >= lenB || (i < lenA && (++comparisons, a[i] <= b[j]))) {
+                dst[k] = a[i++];
+            } else {
+                dst[k] = b[j++];
+            }
+        }
+    }
+    return comparisons;
+}
+
+/**
+ * @brief Three-way partition of a[0, n) around the median of its first, middle and last keys
+ * @return Bounds [lt, gt) of the keys equal to the pivot
+ */
+std::pair<size_t, size_t> partition3(int* a, size_t n, size_t& comparisons, size_t& swaps) {
+    int x = a[0];
+    int y = a[n / 2];
+    int z = a[n - 1];
+    comparisons += 3;
+    int pivot = (x < y) ? ((y < z) ? y : (x < z ? z : x))
+                        : ((x < z) ? x : (y < z ? z : y));
+
+    // Two Lomuto passes: smaller keys to the front, then equal keys right after them.
+    // Unlike a Dijkstra partition this keeps presorted input presorted.
+    size_t lt = 0;
+    for (size_t i = 0; i < n; ++i) {
+        comparisons++;
+        if (a[i] < pivot) {
+            if (lt != i) {
+                std::swap(a[lt], a[i]);
+                swaps++;
+            }
+            lt++;
+        }
+    }
+    size_t gt = lt;
+    for (size_t i = lt; i < n; ++i) {
+        comparisons++;
+        if (a[i] == pivot) {
+            if (gt != i) {
+                std::swap(a[gt], a[i]);
+                swaps++;
+            }
+            gt++;
+        }
+    }
+    return {lt, gt};
+}
+
+void insertionSort(int* a, size_t n, size_t& comparisons, size_t& swaps) {
+    for (size_t i = 1; i < n; ++i) {
+        int key = a[i];
+        size_t j = i;
+        while (j > 0 && (++comparisons, a[j - 1] > key)) {
+            a[j] = a[j - 1];
+            swaps++;
+            j--;
+        }
+        a[j] = key;
+    }
+}
+
+/**
+ * @brief Sort a[0, n) completely on the calling thread
+ */
+void sequentialSort(int* a, size_t n, size_t& comparisons, size_t& swaps) {
+    std::vector<std::pair<size_t, size_t>> stack{{0, n}};
+    while (!stack.empty()) {
+        auto [begin, end] = stack.back();
+        stack.pop_back();
+        if (end - begin <= INSERTION_CUTOFF) {
+            insertionSort(a + begin, end - begin, comparisons, swaps);
+            continue;
+        }
+        auto [lt, gt] = partition3(a + begin, end - begin, comparisons, swaps);
+        stack.push_back({begin, begin + lt});
+        stack.push_back({begin + gt, end});
+    }
+}
+
+} // namespace
+
+size_t defaultSortLanes() {
+    size_t hardware = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hardware, 1, MAX_SORT_LANES);
+}
+
+// ===== ParallelMergeSortStepper =====
+
+ParallelMergeSortStepper::ParallelMergeSortStepper(std::vector<int>& arr, size_t lanes, size_t grain)
+    : m_arr(arr), m_n(arr.size()) {
+    lanes = resolveLanes(lanes);
+    m_grain = resolveGrain(grain, m_n, lanes);
+    m_pool = std::make_unique<WorkStealingPool>(lanes);
+    m_sortedMarks.resize(m_n);
+    reset();
+}
+
+bool ParallelMergeSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (m_width >= m_n) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    size_t lanes = m_pool->laneCount();
+    std::vector<std::vector<LaneSpan>> laneSpans(lanes);
+    std::vector<size_t> laneComparisons(lanes, 0);
+    m_buffer.resize(m_n);
+
+    // Each task owns one slice of the output; lane indices are per thread, so no sharing
+    std::vector<WorkStealingPool::Task> tasks;
+    const int* src = m_arr.data();
+    int* dst = m_buffer.data();
+    size_t n = m_n;
+    size_t width = m_width;
+    for (size_t begin = 0; begin < m_n; begin += m_grain) {
+        size_t end = std::min(begin + m_grain, m_n);
+        tasks.push_back([=, &laneSpans, &laneComparisons](size_t lane) {
+            laneComparisons[lane] += mergeSlice(src, dst, n, width, begin, end);
+            laneSpans[lane].push_back({static_cast<std::uint32_t>(lane), begin, end});
+        });
+    }
+    m_pool->run(tasks);
+
+    // The merged level becomes the array; the old storage is next level's output
+    m_arr.swap(m_buffer);
+
+    m_spans.clear();
+    for (size_t lane = 0; lane < lanes; ++lane) {
+        m_comparisons += laneComparisons[lane];
+        for (const LaneSpan& span : laneSpans[lane]) {
+            m_laneWork[lane] += span.end - span.begin;
+            m_spans.push_back(span);
+        }
+    }
+    std::sort(m_spans.begin(), m_spans.end(),
+              [](const LaneSpan& a, const LaneSpan& b) { return a.begin < b.begin; });
+    m_swaps += m_n;
+
+    if (m_recorder) {
+        for (const LaneSpan& span : m_spans) {
+            m_recorder->onRange(span.begin, span.end);
+            for (size_t i = span.begin; i < span.end; ++i) {
+                m_recorder->onWrite(i, m_arr[i]);
+            }
+        }
+    }
+
+    m_state = SortState::Swapping;
+    m_width *= 2;
+    m_depth++;
+
+    if (m_width >= m_n) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+    return true;
+}
+
+void ParallelMergeSortStepper::reset() {
+    m_buffer.clear();
+    m_spans.clear();
+    m_laneWork.assign(m_pool->laneCount(), 0);
+    m_width = 1;
+    m_depth = 0;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== ParallelQuickSortStepper =====
+
+ParallelQuickSortStepper::ParallelQuickSortStepper(std::vector<int>& arr, size_t lanes, size_t grain)
+    : m_arr(arr), m_n(arr.size()) {
+    lanes = resolveLanes(lanes);
+    m_grain = resolveGrain(grain, m_n, lanes);
+    m_pool = std::make_unique<WorkStealingPool>(lanes);
+    m_sortedMarks.resize(m_n);
+    reset();
+}
+
+bool ParallelQuickSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (m_pending.empty()) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    // One task per pending range; each task writes only its own result slot
+    std::vector<RangeResult> results(m_pending.size());
+    std::vector<WorkStealingPool::Task> tasks;
+    int* data = m_arr.data();
+    size_t grain = m_grain;
+    for (size_t r = 0; r < m_pending.size(); ++r) {
+        Range range = m_pending[r];
+        RangeResult* result = &results[r];
+        tasks.push_back([=](size_t lane) {
+            int* a = data + range.begin;
+            size_t size = range.end - range.begin;
+            result->lane = static_cast<std::uint32_t>(lane);
+            if (size <= grain) {
+                sequentialSort(a, size, result->comparisons, result->swaps);
+                result->finished = true;
+            } else {
+                auto [lt, gt] = partition3(a, size, result->comparisons, result->swaps);
+                result->equalBegin = range.begin + lt;
+                result->equalEnd = range.begin + gt;
+            }
+        });
+    }
+    m_pool->run(tasks);
+
+    if (m_recorder) {
+        for (const Range& range : m_pending) {
+            m_recorder->onRange(range.begin, range.end);
+            for (size_t i = range.begin; i < range.end; ++i) {
+                m_recorder->onWrite(i, m_arr[i]);
+            }
+        }
+    }
+
+    // Collect results and queue the next round's ranges
+    std::vector<Range> next;
+    m_spans.clear();
+    for (size_t r = 0; r < m_pending.size(); ++r) {
+        const Range& range = m_pending[r];
+        const RangeResult& result = results[r];
+        m_spans.push_back({result.lane, range.begin, range.end});
+        m_laneWork[result.lane] += range.end - range.begin;
+        m_comparisons += result.comparisons;
+        m_swaps += result.swaps;
+
+        if (result.finished) {
+            m_sortedMarks.markRange(range.begin, range.end);
+            continue;
+        }
+
+        // Keys equal to the pivot are final; recurse on both sides
+        m_sortedMarks.markRange(result.equalBegin, result.equalEnd);
+        for (Range side : {Range{range.begin, result.equalBegin}, Range{result.equalEnd, range.end}}) {
+            if (side.end - side.begin > 1) {
+                next.push_back(side);
+            } else if (side.end > side.begin) {
+                m_sortedMarks.mark(side.begin);
+            }
+        }
+    }
+    m_pending = std::move(next);
+
+    m_state = SortState::Swapping;
+    m_depth++;
+
+    if (m_pending.empty()) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+    return true;
+}
+
+void ParallelQuickSortStepper::reset() {
+    m_pending.clear();
+    if (m_n > 1) {
+        m_pending.push_back({0, m_n});
+    }
+    m_spans.clear();
+    m_laneWork.assign(m_pool->laneCount(), 0);
+    m_depth = 0;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+} // namespace dsav::algorithms
@@ -4,9 +4,35 @@
  */
 
 #include "algorithms/searching.hpp"
+#include "algorithms/simd_kernels.hpp"
+#include <algorithm>
+#include <cstdint>
 
 namespace dsav::algorithms {
 
+namespace {
+
+/// Hint that p will be read soon (no-op where the builtin is unavailable)
+inline void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+/// Fill out[k - 1] for the subtree rooted at 1-based node k with sorted[i...] in order
+size_t fillEytzinger(const std::vector<int>& sorted, std::vector<int>& out, size_t i, size_t k) {
+    if (k <= sorted.size()) {
+        i = fillEytzinger(sorted, out, i, 2 * k);
+        out[k - 1] = sorted[i++];
+        i = fillEytzinger(sorted, out, i, 2 * k + 1);
+    }
+    return i;
+}
+
+} // namespace
+
 // ===== LinearSearchStepper =====
 
 LinearSearchStepper::LinearSearchStepper(const std::vector<int>& arr, int target)
@@ -29,6 +55,24 @@ bool LinearSearchStepper::step() {
     // Check current element
     m_state = SearchState::Checking;
 
+    if (m_fastForward) {
+        size_t begin = static_cast<size_t>(m_currentIdx);
+        size_t count = std::min(FAST_FORWARD_BLOCK, m_n - begin);
+        size_t hit = simd::findEqual(m_arr.data() + begin, count, m_target);
+        if (hit < count) {
+            m_comparisons += hit + 1;
+            m_currentIdx = static_cast<int>(begin + hit);
+            m_state = SearchState::Found;
+            m_result = m_currentIdx;
+            m_complete = true;
+            return false;
+        }
+        m_comparisons += count;
+        m_currentIdx = static_cast<int>(begin + count);
+        return true;
+    }
+
+    m_comparisons++;
     if (m_arr[m_currentIdx] == m_target) {
         // Found target
         m_state = SearchState::Found;
@@ -48,6 +92,7 @@ void LinearSearchStepper::reset() {
     m_result = -1;
     m_complete = false;
     m_state = SearchState::Idle;
+    m_comparisons = 0;
 }
 
 // ===== BinarySearchStepper =====
@@ -74,6 +119,7 @@ bool BinarySearchStepper::step() {
     // Calculate mid point
     m_mid = m_left + (m_right - m_left) / 2;
     m_state = SearchState::Checking;
+    m_comparisons++;
 
     if (m_arr[m_mid] == m_target) {
         // Found target
@@ -99,6 +145,279 @@ void BinarySearchStepper::reset() {
     m_result = -1;
     m_complete = false;
     m_state = SearchState::Idle;
+    m_comparisons = 0;
+}
+
+// ===== BranchlessBinarySearchStepper =====
+
+BranchlessBinarySearchStepper::BranchlessBinarySearchStepper(const std::vector<int>& arr, int target)
+    : m_arr(arr), m_target(target), m_n(arr.size()) {
+    m_length = m_n;
+}
+
+bool BranchlessBinarySearchStepper::step() {
+    if (m_complete) {
+        return false;
+    }
+
+    if (m_n == 0) {
+        m_state = SearchState::NotFound;
+        m_result = -1;
+        m_complete = true;
+        return false;
+    }
+
+    m_state = SearchState::Checking;
+
+    if (m_length > 1) {
+        // Keep the upper half if its first element is still too small; no branch on the outcome
+        size_t half = m_length / 2;
+        size_t probe = m_base + half;
+        m_probe = static_cast<int>(probe);
+        m_comparisons++;
+        m_base = (m_arr[probe] < m_target) ? probe : m_base;
+        m_length -= half;
+        return true;
+    }
+
+    // One candidate left: the lower bound is it or the element after it
+    m_probe = static_cast<int>(m_base);
+    m_comparisons++;
+    size_t lowerBound = m_base + (m_arr[m_base] < m_target ? 1 : 0);
+    if (lowerBound < m_n) {
+        m_comparisons++;
+        if (m_arr[lowerBound] == m_target) {
+            m_probe = static_cast<int>(lowerBound);
+            m_state = SearchState::Found;
+            m_result = m_probe;
+            m_complete = true;
+            return false;
+        }
+    }
+
+    m_state = SearchState::NotFound;
+    m_result = -1;
+    m_complete = true;
+    return false;
+}
+
+void BranchlessBinarySearchStepper::reset() {
+    m_base = 0;
+    m_length = m_n;
+    m_probe = -1;
+    m_result = -1;
+    m_complete = false;
+    m_state = SearchState::Idle;
+    m_comparisons = 0;
+}
+
+// ===== EytzingerSearchStepper =====
+
+std::vector<int> eytzingerLayout(const std::vector<int>& sorted) {
+    std::vector<int> layout(sorted.size());
+    fillEytzinger(sorted, layout, 0, 1);
+    return layout;
+}
+
+EytzingerSearchStepper::EytzingerSearchStepper(const std::vector<int>& layout, int target)
+    : m_arr(layout), m_target(target), m_n(layout.size()) {
+}
+
+bool EytzingerSearchStepper::step() {
+    if (m_complete) {
+        return false;
+    }
+
+    m_state = SearchState::Checking;
+
+    if (m_node <= m_n) {
+        // Node k's descendants PREFETCH_LEVELS down start at k << PREFETCH_LEVELS (1-based)
+        size_t ahead = m_node << PREFETCH_LEVELS;
+        if (ahead <= m_n) {
+            prefetch(m_arr.data() + ahead - 1);
+        }
+
+        m_probe = static_cast<int>(m_node - 1);
+        m_depth++;
+        m_comparisons++;
+        m_node = 2 * m_node + (m_arr[m_node - 1] < m_target ? 1 : 0);
+        return true;
+    }
+
+    // Fell off the tree: undo the trailing right turns and the last left turn
+    while (m_node & 1) {
+        m_node >>= 1;
+    }
+    m_node >>= 1;
+
+    if (m_node > 0) {
+        m_probe = static_cast<int>(m_node - 1);
+        m_comparisons++;
+        if (m_arr[m_node - 1] == m_target) {
+            m_state = SearchState::Found;
+            m_result = m_probe;
+            m_complete = true;
+            return false;
+        }
+    }
+
+    m_state = SearchState::NotFound;
+    m_result = -1;
+    m_complete = true;
+    return false;
+}
+
+void EytzingerSearchStepper::reset() {
+    m_node = 1;
+    m_probe = -1;
+    m_depth = -1;
+    m_result = -1;
+    m_complete = false;
+    m_state = SearchState::Idle;
+    m_comparisons = 0;
+}
+
+// ===== InterpolationSearchStepper =====
+
+InterpolationSearchStepper::InterpolationSearchStepper(const std::vector<int>& arr, int target)
+    : m_arr(arr), m_target(target), m_n(arr.size()) {
+    m_left = 0;
+    m_right = static_cast<int>(m_n) - 1;
+}
+
+bool InterpolationSearchStepper::step() {
+    if (m_complete) {
+        return false;
+    }
+
+    // Empty range, or the target lies outside the values it still spans
+    if (m_left > m_right || m_target < m_arr[m_left] || m_target > m_arr[m_right]) {
+        m_state = SearchState::NotFound;
+        m_result = -1;
+        m_complete = true;
+        return false;
+    }
+
+    // Estimate the position from the values at the bounds (64-bit: the spans can overflow int)
+    std::int64_t lowValue = m_arr[m_left];
+    std::int64_t valueSpan = static_cast<std::int64_t>(m_arr[m_right]) - lowValue;
+    m_probe = m_left;
+    if (valueSpan > 0) {
+        std::int64_t offset = (m_target - lowValue) * (m_right - m_left) / valueSpan;
+        m_probe = m_left + static_cast<int>(offset);
+    }
+
+    m_state = SearchState::Checking;
+    m_comparisons++;
+
+    if (m_arr[m_probe] == m_target) {
+        m_state = SearchState::Found;
+        m_result = m_probe;
+        m_complete = true;
+        return false;
+    } else if (m_arr[m_probe] < m_target) {
+        m_left = m_probe + 1;
+    } else {
+        m_right = m_probe - 1;
+    }
+
+    return true;
+}
+
+void InterpolationSearchStepper::reset() {
+    m_left = 0;
+    m_right = static_cast<int>(m_n) - 1;
+    m_probe = -1;
+    m_result = -1;
+    m_complete = false;
+    m_state = SearchState::Idle;
+    m_comparisons = 0;
+}
+
+// ===== ExponentialSearchStepper =====
+
+ExponentialSearchStepper::ExponentialSearchStepper(const std::vector<int>& arr, int target)
+    : m_arr(arr), m_target(target), m_n(arr.size()) {
+}
+
+bool ExponentialSearchStepper::step() {
+    if (m_complete) {
+        return false;
+    }
+
+    if (m_galloping) {
+        if (m_n == 0) {
+            m_state = SearchState::NotFound;
+            m_result = -1;
+            m_complete = true;
+            return false;
+        }
+
+        m_probe = static_cast<int>(m_bound);
+        m_state = SearchState::Checking;
+        m_comparisons++;
+
+        int value = m_arr[m_bound];
+        if (value == m_target) {
+            m_state = SearchState::Found;
+            m_result = m_probe;
+            m_complete = true;
+            return false;
+        }
+
+        if (value < m_target) {
+            size_t next = (m_bound == 0) ? 1 : m_bound * 2;
+            if (next < m_n) {
+                m_bound = next;
+                return true;
+            }
+            // Ran off the end: the target can only be past the last probe
+            m_left = static_cast<int>(m_bound) + 1;
+            m_right = static_cast<int>(m_n) - 1;
+        } else {
+            // Overshot: the target is between the previous probe and this one
+            m_left = (m_bound == 0) ? 0 : static_cast<int>(m_bound / 2) + 1;
+            m_right = static_cast<int>(m_bound) - 1;
+        }
+        m_galloping = false;
+        return true;
+    }
+
+    if (m_left > m_right) {
+        m_state = SearchState::NotFound;
+        m_result = -1;
+        m_complete = true;
+        return false;
+    }
+
+    m_probe = m_left + (m_right - m_left) / 2;
+    m_state = SearchState::Checking;
+    m_comparisons++;
+
+    if (m_arr[m_probe] == m_target) {
+        m_state = SearchState::Found;
+        m_result = m_probe;
+        m_complete = true;
+        return false;
+    } else if (m_arr[m_probe] < m_target) {
+        m_left = m_probe + 1;
+    } else {
+        m_right = m_probe - 1;
+    }
+
+    return true;
+}
+
+void ExponentialSearchStepper::reset() {
+    m_bound = 0;
+    m_galloping = true;
+    m_left = 0;
+    m_right = 0;
+    m_probe = -1;
+    m_result = -1;
+    m_complete = false;
+    m_state = SearchState::Idle;
+    m_comparisons = 0;
 }
 
 } // namespace dsav::algorithms
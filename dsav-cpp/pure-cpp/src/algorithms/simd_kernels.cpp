@@ -0,0 +1,460 @@
+/**
+ * @file simd_kernels.cpp
+ * @brief Scalar, AVX2 and NEON implementations of the fast-path kernels
+ *
+ * AVX2 code is compiled per function with a target attribute, so the rest
+ * of the build keeps its baseline flags and the AVX2 paths only run after
+ * the CPU has been checked. NEON is part of ARMv8, so it is compiled in
+ * whenever the target has it.
+ */
+
+#include "algorithms/simd_kernels.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+// Per-function target attributes and CPU checks are GCC/Clang builtins; other compilers stay scalar
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define DSAV_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__) && defined(__ARM_NEON)
+#define DSAV_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace dsav::algorithms::simd {
+
+namespace {
+
+// ===== Scalar =====
+
+size_t findEqualScalar(const int* data, size_t n, int target) {
+    for (size_t i = 0; i < n; ++i) {
+        if (data[i] == target) return i;
+    }
+    return n;
+}
+
+size_t partitionLessScalar(int* data, size_t n, int pivot, int* scratch) {
+    // Smaller elements compact in place (the write cursor never passes the read cursor)
+    size_t lo = 0;
+    size_t hi = 0;
+    for (size_t i = 0; i < n; ++i) {
+        int v = data[i];
+        if (v < pivot) {
+            data[lo++] = v;
+        } else {
+            scratch[hi++] = v;
+        }
+    }
+    std::copy(scratch, scratch + hi, data + lo);
+    return lo;
+}
+
+void mergeScalar(const int* a, size_t lenA, const int* b, size_t lenB, int* out) {
+    size_t i = 0;
+    size_t j = 0;
+    while (i < lenA && j < lenB) {
+        *out++ = (a[i] <= b[j]) ? a[i++] : b[j++];
+    }
+    out = std::copy(a + i, a + lenA, out);
+    std::copy(b + j, b + lenB, out);
+}
+
+/// Widest vector block (AVX2: 8 lanes); bounds the tail buffer below
+constexpr size_t MAX_BLOCK = 8;
+
+/**
+ * @brief Finish a vector merge: the carried block and both input tails, all sorted
+ *
+ * The vector loop stops when the input it needs has less than a block left,
+ * so the shorter tail and the carry always fit one small buffer.
+ */
+void mergeTails(const int* carry, size_t lenCarry, const int* a, size_t lenA,
+                const int* b, size_t lenB, int* out) {
+    int merged[2 * MAX_BLOCK];
+    if (lenA > lenB) {
+        std::swap(a, b);
+        std::swap(lenA, lenB);
+    }
+    mergeScalar(carry, lenCarry, a, lenA, merged);
+    mergeScalar(merged, lenCarry + lenA, b, lenB, out);
+}
+
+// ===== AVX2 =====
+
+#ifdef DSAV_SIMD_AVX2
+
+/// Lane permutation that packs the lanes set in an 8-bit mask to the front, in order
+struct CompressTable {
+    alignas(32) std::int32_t lanes[256][8];
+
+    constexpr CompressTable() : lanes() {
+        for (int mask = 0; mask < 256; ++mask) {
+            int k = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (mask & (1 << lane)) lanes[mask][k++] = lane;
+            }
+            for (int lane = 0; lane < 8; ++lane) {
+                if (!(mask & (1 << lane))) lanes[mask][k++] = lane;
+            }
+        }
+    }
+};
+
+constexpr CompressTable COMPRESS_8X32{};
+
+__attribute__((target("avx2")))
+size_t findEqualAvx2(const int* data, size_t n, int target) {
+    const __m256i needle = _mm256_set1_epi32(target);
+    size_t i = 0;
+
+    // Four vectors per iteration; only a hit pays for locating the lane
+    for (; i + 32 <= n; i += 32) {
+        __m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        __m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)), needle);
+        __m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16)), needle);
+        __m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 24)), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (!_mm256_testz_si256(any, any)) {
+            break;
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask) {
+            return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+    }
+    return i + findEqualScalar(data + i, n - i, target);
+}
+
+__attribute__((target("avx2")))
+size_t partitionLessAvx2(int* data, size_t n, int pivot, int* scratch) {
+    const __m256i vpivot = _mm256_set1_epi32(pivot);
+    size_t lo = 0;
+    size_t hi = 0;
+    size_t i = 0;
+
+    // Full-width stores are safe: lo <= i, so they only overwrite lanes already loaded
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(vpivot, v))));
+        __m256i less = _mm256_permutevar8x32_epi32(
+            v, _mm256_load_si256(reinterpret_cast<const __m256i*>(COMPRESS_8X32.lanes[mask])));
+        __m256i rest = _mm256_permutevar8x32_epi32(
+            v, _mm256_load_si256(reinterpret_cast<const __m256i*>(COMPRESS_8X32.lanes[~mask & 0xFFu])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + lo), less);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(scratch + hi), rest);
+
+        size_t count = static_cast<size_t>(__builtin_popcount(mask));
+        lo += count;
+        hi += 8 - count;
+    }
+    for (; i < n; ++i) {
+        int v = data[i];
+        if (v < pivot) {
+            data[lo++] = v;
+        } else {
+            scratch[hi++] = v;
+        }
+    }
+    std::copy(scratch, scratch + hi, data + lo);
+    return lo;
+}
+
+/// Sort a bitonic sequence of 8 lanes (half-cleaner at distance 4, 2, 1)
+__attribute__((target("avx2")))
+inline __m256i bitonicSort8(__m256i v) {
+    __m256i t = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xF0);
+    t = _mm256_shuffle_epi32(v, 0x4E);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xCC);
+    t = _mm256_shuffle_epi32(v, 0xB1);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xAA);
+    return v;
+}
+
+/// Merge two sorted vectors: lo gets the 8 smallest, hi the 8 largest, both sorted
+__attribute__((target("avx2")))
+inline void bitonicMerge16(__m256i& lo, __m256i& hi) {
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256i flipped = _mm256_permutevar8x32_epi32(hi, reverse);
+    __m256i small = _mm256_min_epi32(lo, flipped);
+    __m256i large = _mm256_max_epi32(lo, flipped);
+    lo = bitonicSort8(small);
+    hi = bitonicSort8(large);
+}
+
+__attribute__((target("avx2")))
+void mergeAvx2(const int* a, size_t lenA, const int* b, size_t lenB, int* out) {
+    if (lenA < 8 || lenB < 8) {
+        mergeScalar(a, lenA, b, lenB, out);
+        return;
+    }
+
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+    size_t i = 8;
+    size_t j = 8;
+
+    // hi carries the 8 largest seen so far; refill from the input with the smaller head
+    for (;;) {
+        bitonicMerge16(lo, hi);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), lo);
+        out += 8;
+
+        bool takeA = j >= lenB || (i < lenA && a[i] <= b[j]);
+        if (takeA && i + 8 <= lenA) {
+            lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            i += 8;
+        } else if (!takeA && j + 8 <= lenB) {
+            lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+            j += 8;
+        } else {
+            break;
+        }
+    }
+
+    alignas(32) int carry[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(carry), hi);
+    mergeTails(carry, 8, a + i, lenA - i, b + j, lenB - j, out);
+}
+
+bool cpuHasAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // DSAV_SIMD_AVX2
+
+// ===== NEON =====
+
+#ifdef DSAV_SIMD_NEON
+
+/// Byte shuffle that packs the 32-bit lanes set in a 4-bit mask to the front, in order
+struct CompressTable4 {
+    std::uint8_t bytes[16][16];
+
+    constexpr CompressTable4() : bytes() {
+        for (int mask = 0; mask < 16; ++mask) {
+            int k = 0;
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int lane = 0; lane < 4; ++lane) {
+                    bool set = (mask & (1 << lane)) != 0;
+                    if (set != (pass == 0)) continue;
+                    for (int byte = 0; byte < 4; ++byte) {
+                        bytes[mask][k++] = static_cast<std::uint8_t>(lane * 4 + byte);
+                    }
+                }
+            }
+        }
+    }
+};
+
+constexpr CompressTable4 COMPRESS_4X32{};
+
+inline unsigned laneMask(uint32x4_t cmp) {
+    const uint32x4_t bits = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(cmp, bits));
+}
+
+size_t findEqualNeon(const int* data, size_t n, int target) {
+    const int32x4_t needle = vdupq_n_s32(target);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        uint32x4_t e0 = vceqq_s32(vld1q_s32(data + i), needle);
+        uint32x4_t e1 = vceqq_s32(vld1q_s32(data + i + 4), needle);
+        uint32x4_t e2 = vceqq_s32(vld1q_s32(data + i + 8), needle);
+        uint32x4_t e3 = vceqq_s32(vld1q_s32(data + i + 12), needle);
+        uint32x4_t any = vorrq_u32(vorrq_u32(e0, e1), vorrq_u32(e2, e3));
+        if (vmaxvq_u32(any) != 0) {
+            break;
+        }
+    }
+    for (; i + 4 <= n; i += 4) {
+        unsigned mask = laneMask(vceqq_s32(vld1q_s32(data + i), needle));
+        if (mask) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+    return i + findEqualScalar(data + i, n - i, target);
+}
+
+size_t partitionLessNeon(int* data, size_t n, int pivot, int* scratch) {
+    const int32x4_t vpivot = vdupq_n_s32(pivot);
+    size_t lo = 0;
+    size_t hi = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t v = vld1q_s32(data + i);
+        unsigned mask = laneMask(vcltq_s32(v, vpivot));
+        uint8x16_t bytes = vreinterpretq_u8_s32(v);
+        int32x4_t less = vreinterpretq_s32_u8(vqtbl1q_u8(bytes, vld1q_u8(COMPRESS_4X32.bytes[mask])));
+        int32x4_t rest = vreinterpretq_s32_u8(vqtbl1q_u8(bytes, vld1q_u8(COMPRESS_4X32.bytes[~mask & 0xFu])));
+        vst1q_s32(data + lo, less);
+        vst1q_s32(scratch + hi, rest);
+
+        size_t count = static_cast<size_t>(__builtin_popcount(mask));
+        lo += count;
+        hi += 4 - count;
+    }
+    for (; i < n; ++i) {
+        int v = data[i];
+        if (v < pivot) {
+            data[lo++] = v;
+        } else {
+            scratch[hi++] = v;
+        }
+    }
+    std::copy(scratch, scratch + hi, data + lo);
+    return lo;
+}
+
+/// Sort a bitonic sequence of 4 lanes
+inline int32x4_t bitonicSort4(int32x4_t v) {
+    int32x4_t t = vextq_s32(v, v, 2);
+    v = vcombine_s32(vget_low_s32(vminq_s32(v, t)), vget_high_s32(vmaxq_s32(v, t)));
+    t = vrev64q_s32(v);
+    v = vtrn1q_s32(vminq_s32(v, t), vmaxq_s32(v, t));
+    return v;
+}
+
+inline void bitonicMerge8(int32x4_t& lo, int32x4_t& hi) {
+    int32x4_t reversed = vrev64q_s32(hi);
+    int32x4_t flipped = vcombine_s32(vget_high_s32(reversed), vget_low_s32(reversed));
+    int32x4_t small = vminq_s32(lo, flipped);
+    int32x4_t large = vmaxq_s32(lo, flipped);
+    lo = bitonicSort4(small);
+    hi = bitonicSort4(large);
+}
+
+void mergeNeon(const int* a, size_t lenA, const int* b, size_t lenB, int* out) {
+    if (lenA < 4 || lenB < 4) {
+        mergeScalar(a, lenA, b, lenB, out);
+        return;
+    }
+
+    int32x4_t lo = vld1q_s32(a);
+    int32x4_t hi = vld1q_s32(b);
+    size_t i = 4;
+    size_t j = 4;
+    for (;;) {
+        bitonicMerge8(lo, hi);
+        vst1q_s32(out, lo);
+        out += 4;
+
+        bool takeA = j >= lenB || (i < lenA && a[i] <= b[j]);
+        if (takeA && i + 4 <= lenA) {
+            lo = vld1q_s32(a + i);
+            i += 4;
+        } else if (!takeA && j + 4 <= lenB) {
+            lo = vld1q_s32(b + j);
+            j += 4;
+        } else {
+            break;
+        }
+    }
+
+    int carry[4];
+    vst1q_s32(carry, hi);
+    mergeTails(carry, 4, a + i, lenA - i, b + j, lenB - j, out);
+}
+
+#endif // DSAV_SIMD_NEON
+
+SimdLevel detect() {
+#ifdef DSAV_SIMD_AVX2
+    if (cpuHasAvx2()) return SimdLevel::Avx2;
+#endif
+#ifdef DSAV_SIMD_NEON
+    return SimdLevel::Neon;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel& currentLevel() {
+    static SimdLevel level = detect();
+    return level;
+}
+
+} // namespace
+
+SimdLevel activeLevel() {
+    return currentLevel();
+}
+
+SimdLevel detectedLevel() {
+    static const SimdLevel level = detect();
+    return level;
+}
+
+bool setLevel(SimdLevel level) {
+    if (level != SimdLevel::Scalar && level != detectedLevel()) {
+        return false;
+    }
+    currentLevel() = level;
+    return true;
+}
+
+const char* levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::Avx2:   return "avx2";
+        case SimdLevel::Neon:   return "neon";
+    }
+    return "scalar";
+}
+
+size_t findEqual(const int* data, size_t n, int target) {
+    switch (activeLevel()) {
+#ifdef DSAV_SIMD_AVX2
+        case SimdLevel::Avx2: return findEqualAvx2(data, n, target);
+#endif
+#ifdef DSAV_SIMD_NEON
+        case SimdLevel::Neon: return findEqualNeon(data, n, target);
+#endif
+        default:              return findEqualScalar(data, n, target);
+    }
+}
+
+size_t partitionLess(int* data, size_t n, int pivot, int* scratch) {
+    switch (activeLevel()) {
+#ifdef DSAV_SIMD_AVX2
+        case SimdLevel::Avx2: return partitionLessAvx2(data, n, pivot, scratch);
+#endif
+#ifdef DSAV_SIMD_NEON
+        case SimdLevel::Neon: return partitionLessNeon(data, n, pivot, scratch);
+#endif
+        default:              return partitionLessScalar(data, n, pivot, scratch);
+    }
+}
+
+size_t merge(const int* a, size_t lenA, const int* b, size_t lenB, int* out) {
+    switch (activeLevel()) {
+#ifdef DSAV_SIMD_AVX2
+        case SimdLevel::Avx2: mergeAvx2(a, lenA, b, lenB, out); break;
+#endif
+#ifdef DSAV_SIMD_NEON
+        case SimdLevel::Neon: mergeNeon(a, lenA, b, lenB, out); break;
+#endif
+        default:              mergeScalar(a, lenA, b, lenB, out); break;
+    }
+
+    // A scalar merge compares until one input runs out; the other's tail is copied
+    if (lenA == 0 || lenB == 0) {
+        return 0;
+    }
+    if (a[lenA - 1] <= b[lenB - 1]) {
+        size_t before = static_cast<size_t>(std::lower_bound(b, b + lenB, a[lenA - 1]) - b);
+        return lenA + before;
+    }
+    size_t before = static_cast<size_t>(std::upper_bound(a, a + lenA, b[lenB - 1]) - a);
+    return before + lenB;
+}
+
+} // namespace dsav::algorithms::simd
@@ -0,0 +1,150 @@
+/**
+ * @file snapshot.cpp
+ * @brief Snapshot writer and memory-mapped snapshot reader
+ */
+
+#include "algorithms/snapshot.hpp"
+#include "algorithms/byte_order.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace dsav::algorithms {
+
+namespace {
+
+using detail::HOST_LITTLE_ENDIAN;
+using detail::loadLE;
+using detail::storeLE;
+
+constexpr char SNAPSHOT_MAGIC[8] = {'D', 'S', 'A', 'V', 'S', 'N', 'A', 'P'};
+constexpr size_t ELEMENT_BYTES = 4;
+
+bool isKnownKind(std::uint8_t kind) {
+    return kind >= static_cast<std::uint8_t>(SnapshotKind::DynamicArray) &&
+           kind <= static_cast<std::uint8_t>(SnapshotKind::RedBlackTree);
+}
+
+size_t colorBytes(size_t count) {
+    return (count + 7) / 8;
+}
+
+} // namespace
+
+const char* snapshotKindName(SnapshotKind kind) {
+    switch (kind) {
+        case SnapshotKind::DynamicArray: return "array";
+        case SnapshotKind::Stack:        return "stack";
+        case SnapshotKind::Queue:        return "queue";
+        case SnapshotKind::RedBlackTree: return "red-black tree";
+    }
+    return "?";
+}
+
+bool writeSnapshot(const std::string& path, SnapshotKind kind, const int* elements, size_t count,
+                   const std::uint8_t* colorBits, std::string& error) {
+    bool tree = kind == SnapshotKind::RedBlackTree;
+    if (tree ? (count > 0 && !colorBits) : colorBits != nullptr) {
+        error = tree ? "Tree snapshots need color bits" : "Only tree snapshots have color bits";
+        return false;
+    }
+
+    // Header, elements and colors go out as one buffer in one write
+    size_t extra = tree ? colorBytes(count) : 0;
+    std::vector<std::uint8_t> buffer(SNAPSHOT_HEADER_BYTES + count * ELEMENT_BYTES + extra);
+    std::uint8_t* p = buffer.data();
+    detail::FileHeader header;
+    header.version = SNAPSHOT_VERSION;
+    header.format[0] = static_cast<std::uint8_t>(kind);
+    header.format[1] = static_cast<std::uint8_t>(ELEMENT_BYTES);
+    header.offset = SNAPSHOT_HEADER_BYTES;
+    header.count = count;
+    detail::storeFileHeader(p, SNAPSHOT_MAGIC, header);
+
+    p += SNAPSHOT_HEADER_BYTES;
+    if constexpr (HOST_LITTLE_ENDIAN) {
+        if (count > 0) std::memcpy(p, elements, count * ELEMENT_BYTES);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            storeLE(p + i * ELEMENT_BYTES, static_cast<std::uint32_t>(elements[i]), ELEMENT_BYTES);
+        }
+    }
+    if (extra > 0) {
+        std::memcpy(p + count * ELEMENT_BYTES, colorBits, extra);
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "Cannot create " + path;
+        return false;
+    }
+    bool ok = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        error = "Write failed for " + path;
+    }
+    return ok;
+}
+
+bool SnapshotReader::open(const std::string& path) {
+    close();
+    if (!m_file.open(path)) {
+        m_error = m_file.error();
+        return false;
+    }
+
+    const std::uint8_t* p = m_file.data();
+    size_t size = m_file.size();
+    detail::FileHeader header;
+    if (!detail::loadFileHeader(p, size, SNAPSHOT_MAGIC, SNAPSHOT_HEADER_BYTES, header)) {
+        m_error = path + " is not a snapshot";
+    } else if (header.version != SNAPSHOT_VERSION) {
+        m_error = "Unsupported snapshot version " + std::to_string(header.version);
+    } else if (!isKnownKind(header.format[0]) || header.format[1] != ELEMENT_BYTES) {
+        m_error = "Unknown snapshot contents in " + path;
+    } else {
+        m_kind = static_cast<SnapshotKind>(header.format[0]);
+        m_offset = header.offset;
+        bool tree = m_kind == SnapshotKind::RedBlackTree;
+        if (!detail::payloadFits(header, size, SNAPSHOT_HEADER_BYTES, ELEMENT_BYTES) ||
+            (tree && colorBytes(header.count) > size - m_offset - header.count * ELEMENT_BYTES)) {
+            m_error = "Truncated snapshot " + path;
+        } else {
+            m_count = static_cast<size_t>(header.count);
+            m_error.clear();
+            return true;
+        }
+    }
+    m_file.close();
+    return false;
+}
+
+void SnapshotReader::close() {
+    m_file.close();
+    m_count = 0;
+    m_offset = 0;
+}
+
+bool SnapshotReader::expect(SnapshotKind kind) {
+    if (m_kind == kind) return true;
+    m_error = std::string("Snapshot holds a ") + snapshotKindName(m_kind) + ", not a " + snapshotKindName(kind);
+    return false;
+}
+
+void SnapshotReader::readElements(std::vector<int>& out) const {
+    out.resize(m_count);
+    const std::uint8_t* p = m_file.data() + m_offset;
+    if constexpr (HOST_LITTLE_ENDIAN) {
+        if (m_count > 0) std::memcpy(out.data(), p, m_count * ELEMENT_BYTES);
+    } else {
+        for (size_t i = 0; i < m_count; ++i) {
+            out[i] = static_cast<int>(static_cast<std::uint32_t>(loadLE(p + i * ELEMENT_BYTES, ELEMENT_BYTES)));
+        }
+    }
+}
+
+const std::uint8_t* SnapshotReader::colorBits() const {
+    if (m_kind != SnapshotKind::RedBlackTree) return nullptr;
+    return m_file.data() + m_offset + m_count * ELEMENT_BYTES;
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,210 @@
+/**
+ * @file sort_race.cpp
+ * @brief Implementation of the multi-lane sort race
+ */
+
+#include "algorithms/sort_race.hpp"
+#include "algorithms/parallel_sorting.hpp"
+#include <algorithm>
+
+namespace dsav::algorithms {
+
+const char* sortAlgorithmName(SortAlgorithm algorithm) {
+    switch (algorithm) {
+        case SortAlgorithm::Bubble:    return "Bubble Sort";
+        case SortAlgorithm::Selection: return "Selection Sort";
+        case SortAlgorithm::Insertion: return "Insertion Sort";
+        case SortAlgorithm::Merge:     return "Merge Sort";
+        case SortAlgorithm::Quick:     return "Quick Sort";
+        case SortAlgorithm::Heap:      return "Heap Sort";
+        case SortAlgorithm::Shell:     return "Shell Sort";
+        case SortAlgorithm::Radix:     return "Radix Sort (LSD)";
+        case SortAlgorithm::Counting:  return "Counting Sort";
+        case SortAlgorithm::Intro:     return "Introsort";
+        case SortAlgorithm::ParallelMerge: return "Parallel Merge Sort";
+        case SortAlgorithm::ParallelQuick: return "Parallel Quick Sort";
+    }
+    return "?";
+}
+
+SortRace::~SortRace() {
+    stop();
+}
+
+bool SortRace::start(const std::vector<int>& input, const std::vector<SortAlgorithm>& algorithms,
+                     double stepsPerSecond) {
+    stop();
+    m_lanes.clear();
+    if (algorithms.empty() || algorithms.size() > MAX_LANES) {
+        m_error = "A race needs 1 to " + std::to_string(MAX_LANES) + " lanes";
+        return false;
+    }
+    m_error.clear();
+
+    m_input = input;
+    m_stepsPerSecond = std::max(0.0, stepsPerSecond);
+    m_ready.store(0, std::memory_order_relaxed);
+    m_go.store(false, std::memory_order_relaxed);
+    m_cancel.store(false, std::memory_order_relaxed);
+
+    for (SortAlgorithm algorithm : algorithms) {
+        auto lane = std::make_unique<Lane>();
+        lane->algorithm = algorithm;
+        m_lanes.push_back(std::move(lane));
+    }
+    for (auto& lane : m_lanes) {
+        Lane* target = lane.get();
+        lane->thread = std::thread([this, target]() { runLane(*target); });
+    }
+
+    // Copying and stepper setup stay out of the timings
+    while (m_ready.load(std::memory_order_acquire) != m_lanes.size()) {
+        std::this_thread::yield();
+    }
+    m_startTime = std::chrono::steady_clock::now();
+    m_go.store(true, std::memory_order_release);
+    return true;
+}
+
+void SortRace::stop() {
+    m_cancel.store(true, std::memory_order_relaxed);
+    joinAll();
+}
+
+bool SortRace::isRunning() const {
+    for (const auto& lane : m_lanes) {
+        if (lane->state.load(std::memory_order_acquire) == SortRaceState::Running) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SortRaceLaneStats SortRace::stats(size_t lane) const {
+    const Lane& l = *m_lanes[lane];
+    SortRaceLaneStats stats;
+    stats.state = l.state.load(std::memory_order_acquire);
+    stats.steps = l.steps.load(std::memory_order_relaxed);
+    stats.comparisons = l.comparisons.load(std::memory_order_relaxed);
+    stats.swaps = l.swaps.load(std::memory_order_relaxed);
+    stats.seconds = static_cast<double>(l.elapsedNs.load(std::memory_order_relaxed)) * 1e-9;
+    stats.sorted = stats.state == SortRaceState::Finished && l.sorted;
+    return stats;
+}
+
+bool SortRace::takeSnapshot(size_t lane, SortRaceSnapshot& snapshot) {
+    Lane& l = *m_lanes[lane];
+    if (!l.snapshotReady.load(std::memory_order_acquire)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(l.snapshotMutex);
+        std::swap(snapshot, l.snapshot);
+        l.snapshotReady.store(false, std::memory_order_relaxed);
+    }
+    l.snapshotWanted.store(true, std::memory_order_release);
+    return true;
+}
+
+void SortRace::runLane(Lane& lane) {
+    switch (lane.algorithm) {
+        case SortAlgorithm::Bubble:    drive<BubbleSortStepper>(lane); break;
+        case SortAlgorithm::Selection: drive<SelectionSortStepper>(lane); break;
+        case SortAlgorithm::Insertion: drive<InsertionSortStepper>(lane); break;
+        case SortAlgorithm::Merge:     drive<MergeSortStepper>(lane); break;
+        case SortAlgorithm::Quick:     drive<QuickSortStepper>(lane); break;
+        case SortAlgorithm::Heap:      drive<HeapSortStepper>(lane); break;
+        case SortAlgorithm::Shell:     drive<ShellSortStepper>(lane); break;
+        case SortAlgorithm::Radix:     drive<RadixSortStepper>(lane); break;
+        case SortAlgorithm::Counting:  drive<CountingSortStepper>(lane); break;
+        case SortAlgorithm::Intro:     drive<IntroSortStepper>(lane); break;
+        case SortAlgorithm::ParallelMerge: drive<ParallelMergeSortStepper>(lane); break;
+        case SortAlgorithm::ParallelQuick: drive<ParallelQuickSortStepper>(lane); break;
+    }
+}
+
+template<typename Stepper>
+void SortRace::drive(Lane& lane) {
+    using Clock = std::chrono::steady_clock;
+
+    lane.array = m_input;
+    // The steppers assume at least two elements
+    std::unique_ptr<Stepper> stepper;
+    if (lane.array.size() >= 2) {
+        stepper = std::make_unique<Stepper>(lane.array);
+    }
+
+    m_ready.fetch_add(1, std::memory_order_acq_rel);
+    while (!m_go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    Clock::time_point start = m_startTime;
+
+    // A paced lane runs a tick's worth of steps, then sleeps until the tick is due
+    size_t batch = PUBLISH_INTERVAL;
+    if (m_stepsPerSecond > 0.0) {
+        batch = std::clamp<size_t>(static_cast<size_t>(m_stepsPerSecond / PACE_TICKS_PER_SECOND),
+                                   1, PUBLISH_INTERVAL);
+    }
+
+    size_t steps = 0;
+    bool more = stepper != nullptr;
+    bool cancelled = false;
+    while (more) {
+        for (size_t i = 0; i < batch && more; ++i) {
+            more = stepper->step();
+            ++steps;
+        }
+        lane.steps.store(steps, std::memory_order_relaxed);
+        lane.comparisons.store(stepper->getComparisons(), std::memory_order_relaxed);
+        lane.swaps.store(stepper->getSwaps(), std::memory_order_relaxed);
+        lane.elapsedNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count(),
+                             std::memory_order_relaxed);
+
+        if (lane.snapshotWanted.exchange(false, std::memory_order_acquire)) {
+            publishSnapshot(lane, stepper->getSortedMarks(), steps);
+        }
+        if (m_cancel.load(std::memory_order_relaxed)) {
+            cancelled = more;
+            break;
+        }
+        if (more && m_stepsPerSecond > 0.0) {
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(static_cast<double>(steps) / m_stepsPerSecond)));
+        }
+    }
+
+    lane.elapsedNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count(),
+                         std::memory_order_relaxed);
+    lane.sorted = !cancelled && std::is_sorted(lane.array.begin(), lane.array.end());
+
+    // The final arrangement is always published, whether or not the reader asked
+    if (stepper) {
+        publishSnapshot(lane, stepper->getSortedMarks(), steps);
+    } else {
+        SortedMarks empty;
+        empty.resize(lane.array.size());
+        empty.markAll();
+        publishSnapshot(lane, empty, steps);
+    }
+    lane.state.store(cancelled ? SortRaceState::Stopped : SortRaceState::Finished, std::memory_order_release);
+}
+
+void SortRace::publishSnapshot(Lane& lane, const SortedMarks& marks, size_t steps) {
+    std::lock_guard<std::mutex> lock(lane.snapshotMutex);
+    lane.snapshot.values.assign(lane.array.begin(), lane.array.end());
+    lane.snapshot.marks = marks;
+    lane.snapshot.marks.setRecorder(nullptr);
+    lane.snapshot.steps = steps;
+    lane.snapshotReady.store(true, std::memory_order_release);
+}
+
+void SortRace::joinAll() {
+    for (auto& lane : m_lanes) {
+        if (lane->thread.joinable()) {
+            lane->thread.join();
+        }
+    }
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,221 @@
+/**
+ * @file sort_trace.cpp
+ * @brief Implementation of precomputed sort traces and their replay
+ */
+
+#include "algorithms/sort_trace.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace dsav::algorithms {
+
+// ===== SortTrace =====
+
+bool SortTrace::generate(SortAlgorithm algorithm, std::vector<int> input,
+                         const std::atomic<bool>* cancel) {
+    clear();
+    m_arraySize = input.size();
+    if (input.size() > TraceOp::MAX_INDEX) {
+        return false;
+    }
+
+    // Nothing to compare; the steppers also assume at least two elements
+    if (input.size() < 2) {
+        push(TraceOpKind::MarkAll, 0, 0);
+        return true;
+    }
+
+    bool complete = false;
+    switch (algorithm) {
+        case SortAlgorithm::Bubble:    complete = record<BubbleSortStepper>(input, cancel); break;
+        case SortAlgorithm::Selection: complete = record<SelectionSortStepper>(input, cancel); break;
+        case SortAlgorithm::Insertion: complete = record<InsertionSortStepper>(input, cancel); break;
+        case SortAlgorithm::Merge:     complete = record<MergeSortStepper>(input, cancel); break;
+        case SortAlgorithm::Quick:     complete = record<QuickSortStepper>(input, cancel); break;
+        case SortAlgorithm::Heap:      complete = record<HeapSortStepper>(input, cancel); break;
+        case SortAlgorithm::Shell:     complete = record<ShellSortStepper>(input, cancel); break;
+        case SortAlgorithm::Radix:     complete = record<RadixSortStepper>(input, cancel); break;
+        case SortAlgorithm::Counting:  complete = record<CountingSortStepper>(input, cancel); break;
+        case SortAlgorithm::Intro:     complete = record<IntroSortStepper>(input, cancel); break;
+        case SortAlgorithm::ParallelMerge: complete = record<ParallelMergeSortStepper>(input, cancel); break;
+        case SortAlgorithm::ParallelQuick: complete = record<ParallelQuickSortStepper>(input, cancel); break;
+    }
+
+    if (!complete) {
+        clear();
+        return false;
+    }
+    m_ops.shrink_to_fit();
+    return true;
+}
+
+bool SortTrace::generateFromPermutation(const std::vector<size_t>& source) {
+    clear();
+    m_arraySize = source.size();
+    if (source.size() > TraceOp::MAX_INDEX) {
+        return false;
+    }
+
+    // at[slot]: original index of the element now in slot; where[original]: its slot
+    std::vector<size_t> at(source.size());
+    std::vector<size_t> where(source.size());
+    for (size_t i = 0; i < source.size(); ++i) {
+        at[i] = i;
+        where[i] = i;
+    }
+
+    for (size_t slot = 0; slot < source.size(); ++slot) {
+        size_t from = where[source[slot]];
+        if (from != slot) {
+            onSwap(slot, from);
+            std::swap(at[slot], at[from]);
+            where[at[slot]] = slot;
+            where[at[from]] = from;
+        }
+        onMark(slot, slot + 1);
+    }
+    onMarkAll();
+
+    if (m_overflowed) {
+        clear();
+        return false;
+    }
+    m_ops.shrink_to_fit();
+    return true;
+}
+
+template <typename Stepper>
+bool SortTrace::record(std::vector<int>& arr, const std::atomic<bool>* cancel) {
+    Stepper stepper(arr);
+
+    // Marks set by the constructor happen before a recorder can be attached
+    const SortedMarks& marks = stepper.getSortedMarks();
+    for (size_t i = 0; i < arr.size(); ++i) {
+        if (marks.isSorted(i)) onMark(i, i + 1);
+    }
+
+    stepper.setRecorder(this);
+    while (stepper.step()) {
+        if (m_overflowed || (cancel && cancel->load(std::memory_order_relaxed))) {
+            return false;
+        }
+    }
+    return !m_overflowed;
+}
+
+void SortTrace::clear() {
+    m_ops.clear();
+    m_arraySize = 0;
+    m_visibleOps = 0;
+    m_overflowed = false;
+}
+
+void SortTrace::push(TraceOpKind kind, size_t a, std::int32_t b) {
+    if (m_ops.size() >= MAX_OPS) {
+        m_overflowed = true;
+        return;
+    }
+    m_ops.emplace_back(kind, a, b);
+}
+
+void SortTrace::onWrite(size_t index, int value) {
+    push(TraceOpKind::Write, index, value);
+    m_visibleOps++;
+}
+
+void SortTrace::onSwap(size_t i, size_t j) {
+    push(TraceOpKind::Swap, i, static_cast<std::int32_t>(j));
+    m_visibleOps++;
+}
+
+void SortTrace::onMark(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        push(TraceOpKind::Mark, i, 0);
+    }
+}
+
+void SortTrace::onMarkAll() {
+    push(TraceOpKind::MarkAll, 0, 0);
+}
+
+void SortTrace::onCompare(size_t i, size_t j) {
+    push(TraceOpKind::Compare, i, static_cast<std::int32_t>(j));
+    m_visibleOps++;
+}
+
+void SortTrace::onRange(size_t begin, size_t end) {
+    push(TraceOpKind::Range, begin, static_cast<std::int32_t>(end));
+}
+
+// ===== TracePlayer =====
+
+void TracePlayer::reset(const SortTrace* trace) {
+    m_trace = trace;
+    m_next = 0;
+    m_lastOp = nullptr;
+    m_rangeBegin = 0;
+    m_rangeEnd = 0;
+    m_sortedMarks.resize(trace ? trace->arraySize() : 0);
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+bool TracePlayer::advance(size_t visibleCount, std::vector<int>& arr, StepRecorder* recorder) {
+    if (!m_trace) {
+        return false;
+    }
+
+    // The trace's own marks are applied directly; the recorder sees them separately
+    m_sortedMarks.setRecorder(recorder);
+
+    const std::vector<TraceOp>& ops = m_trace->ops();
+    while (m_next < ops.size()) {
+        const TraceOp& op = ops[m_next];
+
+        // Stop in front of the next visible op once the quota is used up
+        if (op.isVisible()) {
+            if (visibleCount == 0) break;
+            visibleCount--;
+            m_lastOp = &op;
+        }
+        m_next++;
+
+        switch (op.kind()) {
+            case TraceOpKind::Compare:
+                m_comparisons++;
+                if (recorder) recorder->onCompare(op.a(), static_cast<size_t>(op.b()));
+                break;
+
+            case TraceOpKind::Swap:
+                std::swap(arr[op.a()], arr[static_cast<size_t>(op.b())]);
+                m_swaps++;
+                if (recorder) recorder->onSwap(op.a(), static_cast<size_t>(op.b()));
+                break;
+
+            case TraceOpKind::Write:
+                arr[op.a()] = op.b();
+                m_swaps++;
+                if (recorder) recorder->onWrite(op.a(), op.b());
+                break;
+
+            case TraceOpKind::Range:
+                m_rangeBegin = op.a();
+                m_rangeEnd = static_cast<size_t>(op.b());
+                if (recorder) recorder->onRange(m_rangeBegin, m_rangeEnd);
+                break;
+
+            case TraceOpKind::Mark:
+                m_sortedMarks.mark(op.a());
+                break;
+
+            case TraceOpKind::MarkAll:
+                m_sortedMarks.markAll();
+                break;
+        }
+    }
+
+    m_sortedMarks.setRecorder(nullptr);
+    return !isComplete();
+}
+
+} // namespace dsav::algorithms
@@ -4,15 +4,91 @@
  */
 
 #include "algorithms/sorting.hpp"
+#include "algorithms/simd_kernels.hpp"
 #include <algorithm>
 
 namespace dsav::algorithms {
 
+namespace {
+
+/// Swap two elements and report the change
+void swapElements(std::vector<int>& arr, size_t i, size_t j, StepRecorder* recorder) {
+    std::swap(arr[i], arr[j]);
+    if (recorder) recorder->onSwap(i, j);
+}
+
+/// Report a comparison of arr[i] and arr[j]
+void noteCompare(size_t i, size_t j, StepRecorder* recorder) {
+    if (recorder) recorder->onCompare(i, j);
+}
+
+/// Assign one element and report the change
+void writeElement(std::vector<int>& arr, size_t i, int value, StepRecorder* recorder) {
+    arr[i] = value;
+    if (recorder) recorder->onWrite(i, value);
+}
+
+} // namespace
+
+// ===== SortedMarks =====
+
+void SortedMarks::resize(size_t n) {
+    m_n = n;
+    m_bits.assign((n + 63) / 64, 0);
+    m_rangeBegin = 0;
+    m_rangeEnd = 0;
+    m_count = 0;
+    m_all = false;
+}
+
+void SortedMarks::clear() {
+    std::fill(m_bits.begin(), m_bits.end(), 0);
+    m_rangeBegin = 0;
+    m_rangeEnd = 0;
+    m_count = 0;
+    m_all = false;
+}
+
+void SortedMarks::mark(size_t i) {
+    if (i >= m_n || isSorted(i)) {
+        return;
+    }
+
+    if (m_rangeBegin == m_rangeEnd) {
+        // First mark starts the contiguous block
+        m_rangeBegin = i;
+        m_rangeEnd = i + 1;
+    } else if (i + 1 == m_rangeBegin) {
+        m_rangeBegin = i;
+    } else if (i == m_rangeEnd) {
+        m_rangeEnd = i + 1;
+    } else {
+        m_bits[i >> 6] |= std::uint64_t{1} << (i & 63);
+    }
+    m_count++;
+
+    if (m_recorder) m_recorder->onMark(i, i + 1);
+}
+
+void SortedMarks::markRange(size_t begin, size_t end) {
+    end = std::min(end, m_n);
+    for (size_t i = begin; i < end; ++i) {
+        mark(i);
+    }
+}
+
+void SortedMarks::markAll() {
+    m_all = true;
+    m_count = m_n;
+
+    if (m_recorder) m_recorder->onMarkAll();
+}
+
 // ===== BubbleSortStepper =====
 
 BubbleSortStepper::BubbleSortStepper(std::vector<int>& arr)
     : m_arr(arr), m_n(arr.size()) {
-    m_sortedIndices.reserve(m_n);
+    m_sortedMarks.resize(m_n);
 }
 
 bool BubbleSortStepper::step() {
@@ -20,15 +96,26 @@ bool BubbleSortStepper::step() {
         return false;
     }
 
+    // Fewer than two elements: nothing to compare, already in order
+    if (m_n < 2) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
     // Compare current adjacent elements
     m_state = SortState::Comparing;
     m_currentI = static_cast<int>(m_i);
     m_currentJ = static_cast<int>(m_j);
 
+    m_comparisons++;
+    noteCompare(m_j, m_j + 1, m_recorder);
     if (m_arr[m_j] > m_arr[m_j + 1]) {
         // Need to swap
         m_state = SortState::Swapping;
-        std::swap(m_arr[m_j], m_arr[m_j + 1]);
+        swapElements(m_arr, m_j, m_j + 1, m_recorder);
+        m_swaps++;
         m_swapped = true;
     }
 
@@ -38,23 +125,11 @@ bool BubbleSortStepper::step() {
     // Check if we completed a pass
     if (m_j >= m_n - 1 - m_i) {
         // Mark the last element as sorted (it's in final position)
-        m_sortedIndices.push_back(static_cast<int>(m_n - 1 - m_i));
+        m_sortedMarks.mark(m_n - 1 - m_i);
 
         if (!m_swapped) {
             // No swaps in this pass - array is sorted
-            // Mark all remaining elements as sorted
-            for (int idx = 0; idx < static_cast<int>(m_n - 1 - m_i); ++idx) {
-                bool alreadySorted = false;
-                for (int sorted : m_sortedIndices) {
-                    if (sorted == idx) {
-                        alreadySorted = true;
-                        break;
-                    }
-                }
-                if (!alreadySorted) {
-                    m_sortedIndices.push_back(idx);
-                }
-            }
+            m_sortedMarks.markAll();
             m_sorted = true;
             m_state = SortState::Sorted;
             return false;
@@ -66,19 +141,7 @@ bool BubbleSortStepper::step() {
 
         if (m_i >= m_n - 1) {
             // Completed all passes
-            // Mark all elements as sorted
-            for (size_t idx = 0; idx < m_n; ++idx) {
-                bool alreadySorted = false;
-                for (int sorted : m_sortedIndices) {
-                    if (sorted == static_cast<int>(idx)) {
-                        alreadySorted = true;
-                        break;
-                    }
-                }
-                if (!alreadySorted) {
-                    m_sortedIndices.push_back(static_cast<int>(idx));
-                }
-            }
+            m_sortedMarks.markAll();
             m_sorted = true;
             m_state = SortState::Sorted;
             return false;
@@ -96,14 +159,16 @@ void BubbleSortStepper::reset() {
     m_state = SortState::Idle;
     m_currentI = -1;
     m_currentJ = -1;
-    m_sortedIndices.clear();
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
 }
 
 // ===== SelectionSortStepper =====
 
 SelectionSortStepper::SelectionSortStepper(std::vector<int>& arr)
     : m_arr(arr), m_n(arr.size()) {
-    m_sortedIndices.reserve(m_n);
+    m_sortedMarks.resize(m_n);
 }
 
 bool SelectionSortStepper::step() {
@@ -111,6 +176,14 @@ bool SelectionSortStepper::step() {
         return false;
     }
 
+    // Fewer than two elements: nothing to compare, already in order
+    if (m_n < 2) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
     if (m_findingMin) {
         // Finding minimum in unsorted portion
         m_state = SortState::Comparing;
@@ -121,6 +194,8 @@ bool SelectionSortStepper::step() {
         }
 
         // Check if current element is smaller than current minimum
+        m_comparisons++;
+        noteCompare(m_j, m_minIdx, m_recorder);
         if (m_arr[m_j] < m_arr[m_minIdx]) {
             m_minIdx = m_j;
         }
@@ -137,11 +212,12 @@ bool SelectionSortStepper::step() {
         // Swap minimum with current position
         if (m_minIdx != m_i) {
             m_state = SortState::Swapping;
-            std::swap(m_arr[m_i], m_arr[m_minIdx]);
+            swapElements(m_arr, m_i, m_minIdx, m_recorder);
+            m_swaps++;
         }
 
         // Mark current position as sorted
-        m_sortedIndices.push_back(static_cast<int>(m_i));
+        m_sortedMarks.mark(m_i);
 
         // Move to next position
         m_i++;
@@ -149,7 +225,7 @@ bool SelectionSortStepper::step() {
 
         if (m_i >= m_n - 1) {
             // All elements sorted (last one is automatically in place)
-            m_sortedIndices.push_back(static_cast<int>(m_n - 1));
+            m_sortedMarks.mark(m_n - 1);
             m_sorted = true;
             m_state = SortState::Sorted;
             return false;
@@ -169,7 +245,9 @@ void SelectionSortStepper::reset() {
     m_findingMin = true;
     m_sorted = false;
     m_state = SortState::Idle;
-    m_sortedIndices.clear();
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
 }
 
 // ===== InsertionSortStepper =====
@@ -177,9 +255,8 @@ void SelectionSortStepper::reset() {
 InsertionSortStepper::InsertionSortStepper(std::vector<int>& arr)
     : m_arr(arr), m_n(arr.size()) {
     // First element is considered sorted
-    if (m_n > 0) {
-        m_sortedIndices.push_back(0);
-    }
+    m_sortedMarks.resize(m_n);
+    m_sortedMarks.mark(0);
 }
 
 bool InsertionSortStepper::step() {
@@ -200,16 +277,22 @@ bool InsertionSortStepper::step() {
     }
 
     // Compare and shift
+    if (m_j >= 0) {
+        // The key's slot is the gap at j + 1
+        m_comparisons++;
+        noteCompare(static_cast<size_t>(m_j), static_cast<size_t>(m_j + 1), m_recorder);
+    }
     if (m_j >= 0 && m_arr[m_j] > m_key) {
         m_state = SortState::Swapping;
-        m_arr[m_j + 1] = m_arr[m_j];
+        writeElement(m_arr, static_cast<size_t>(m_j + 1), m_arr[m_j], m_recorder);
+        m_swaps++;
         m_j--;
     } else {
         // Found the correct position - insert key
-        m_arr[m_j + 1] = m_key;
+        writeElement(m_arr, static_cast<size_t>(m_j + 1), m_key, m_recorder);
 
         // Mark newly inserted position as sorted
-        m_sortedIndices.push_back(m_i);
+        m_sortedMarks.mark(static_cast<size_t>(m_i));
 
         // Move to next element
         m_i++;
@@ -233,17 +316,17 @@ void InsertionSortStepper::reset() {
     m_key = 0;
     m_sorted = false;
     m_state = SortState::Idle;
-    m_sortedIndices.clear();
-    if (m_n > 0) {
-        m_sortedIndices.push_back(0);
-    }
+    m_sortedMarks.clear();
+    m_sortedMarks.mark(0);
+    m_comparisons = 0;
+    m_swaps = 0;
 }
 
 // ===== MergeSortStepper =====
 
 MergeSortStepper::MergeSortStepper(std::vector<int>& arr)
     : m_arr(arr), m_n(arr.size()) {
-    m_sortedIndices.reserve(m_n);
+    m_sortedMarks.resize(m_n);
 }
 
 bool MergeSortStepper::step() {
@@ -265,9 +348,7 @@ bool MergeSortStepper::step() {
 
         if (m_currentSize >= static_cast<int>(m_n)) {
             // Sorting complete
-            for (size_t i = 0; i < m_n; ++i) {
-                m_sortedIndices.push_back(static_cast<int>(i));
-            }
+            m_sortedMarks.markAll();
             m_sorted = true;
             m_state = SortState::Sorted;
             return false;
@@ -281,20 +362,13 @@ bool MergeSortStepper::step() {
 
     // Perform merge
     m_state = SortState::Comparing;
+    if (m_recorder) m_recorder->onRange(static_cast<size_t>(m_currentLeft), static_cast<size_t>(m_currentRight) + 1);
     merge(m_currentLeft, m_currentMid, m_currentRight);
 
-    // Mark merged range as sorted for this pass
-    for (int i = m_currentLeft; i <= m_currentRight; ++i) {
-        bool alreadySorted = false;
-        for (int sorted : m_sortedIndices) {
-            if (sorted == i) {
-                alreadySorted = true;
-                break;
-            }
-        }
-        if (!alreadySorted && m_currentSize >= static_cast<int>(m_n) / 2) {
-            m_sortedIndices.push_back(i);
-        }
+    // Mark merged range as sorted on the final pass
+    if (m_currentSize >= static_cast<int>(m_n) / 2) {
+        m_sortedMarks.markRange(static_cast<size_t>(m_currentLeft),
+                                static_cast<size_t>(m_currentRight) + 1);
     }
 
     // Move to next subarray
@@ -304,6 +378,19 @@ bool MergeSortStepper::step() {
 }
 
 void MergeSortStepper::merge(int left, int mid, int right) {
+    if (m_fastForward && !m_recorder) {
+        // Same output and counts as the loop below, without per-element reporting
+        const int* a = m_arr.data() + left;
+        size_t lenA = static_cast<size_t>(mid - left + 1);
+        size_t lenB = static_cast<size_t>(right - mid);
+        m_temp.resize(lenA + lenB);
+        m_comparisons += simd::merge(a, lenA, a + lenA, lenB, m_temp.data());
+        m_state = (lenB > 0 && a[lenA] < a[lenA - 1]) ? SortState::Swapping : SortState::Comparing;
+        std::copy(m_temp.begin(), m_temp.end(), m_arr.begin() + left);
+        m_swaps += lenA + lenB;
+        return;
+    }
+
     std::vector<int> temp(right - left + 1);
     int i = left;
     int j = mid + 1;
@@ -313,6 +400,8 @@ void MergeSortStepper::merge(int left, int mid, int right) {
 
     // Merge two sorted subarrays
     while (i <= mid && j <= right) {
+        m_comparisons++;
+        noteCompare(static_cast<size_t>(i), static_cast<size_t>(j), m_recorder);
         if (m_arr[i] <= m_arr[j]) {
             temp[k++] = m_arr[i++];
         } else {
@@ -331,8 +420,9 @@ void MergeSortStepper::merge(int left, int mid, int right) {
 
     // Copy back to original array
     for (int idx = 0; idx < k; ++idx) {
-        m_arr[left + idx] = temp[idx];
+        writeElement(m_arr, static_cast<size_t>(left + idx), temp[idx], m_recorder);
     }
+    m_swaps += static_cast<size_t>(k);
 }
 
 void MergeSortStepper::reset() {
@@ -342,14 +432,16 @@ void MergeSortStepper::reset() {
     m_currentMid = -1;
     m_sorted = false;
     m_state = SortState::Idle;
-    m_sortedIndices.clear();
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
 }
 
 // ===== QuickSortStepper =====
 
 QuickSortStepper::QuickSortStepper(std::vector<int>& arr)
     : m_arr(arr), m_n(arr.size()) {
-    m_sortedIndices.reserve(m_n);
+    m_sortedMarks.resize(m_n);
     // Initialize with full array range
     if (m_n > 0) {
         m_stack.push_back({0, static_cast<int>(m_n) - 1});
@@ -363,9 +455,7 @@ bool QuickSortStepper::step() {
 
     if (m_stack.empty()) {
         // All partitions processed
-        for (size_t i = 0; i < m_n; ++i) {
-            m_sortedIndices.push_back(static_cast<int>(i));
-        }
+        m_sortedMarks.markAll();
         m_sorted = true;
         m_state = SortState::Sorted;
         return false;
@@ -380,12 +470,13 @@ bool QuickSortStepper::step() {
         m_state = SortState::Comparing;
         m_partitionLow = range.low;
         m_partitionHigh = range.high;
+        if (m_recorder) m_recorder->onRange(static_cast<size_t>(range.low), static_cast<size_t>(range.high) + 1);
 
         int pivotIdx = partition(range.low, range.high);
         m_pivotIdx = pivotIdx;
 
         // Mark pivot as in final sorted position
-        m_sortedIndices.push_back(pivotIdx);
+        m_sortedMarks.mark(static_cast<size_t>(pivotIdx));
 
         // Push left partition
         if (pivotIdx - 1 > range.low) {
@@ -393,7 +484,7 @@ bool QuickSortStepper::step() {
         } else {
             // Mark single element as sorted
             if (range.low == pivotIdx - 1) {
-                m_sortedIndices.push_back(range.low);
+                m_sortedMarks.mark(static_cast<size_t>(range.low));
             }
         }
 
@@ -403,12 +494,12 @@ bool QuickSortStepper::step() {
         } else {
             // Mark single element as sorted
             if (range.high == pivotIdx + 1) {
-                m_sortedIndices.push_back(range.high);
+                m_sortedMarks.mark(static_cast<size_t>(range.high));
             }
         }
     } else if (range.low == range.high) {
         // Single element is already sorted
-        m_sortedIndices.push_back(range.low);
+        m_sortedMarks.mark(static_cast<size_t>(range.low));
     }
 
     return true;
@@ -422,15 +513,43 @@ int QuickSortStepper::partition(int low, int high) {
 
     m_state = SortState::Comparing;
 
+    if (m_fastForward && !m_recorder) {
+        // The scalar loop swaps every smaller key that follows the first larger one
+        int* data = m_arr.data() + low;
+        size_t n = static_cast<size_t>(high - low);
+        size_t prefix = 0;
+        while (prefix < n && data[prefix] < pivot) {
+            prefix++;
+        }
+        m_scratch.resize(n);
+        size_t less = simd::partitionLess(data, n, pivot, m_scratch.data());
+        m_comparisons += n;
+        m_swaps += less - prefix;
+
+        i = low + static_cast<int>(less) - 1;
+        m_leftIdx = high - 1;
+        m_rightIdx = high;
+        if (less != prefix) m_state = SortState::Swapping;
+        if (i + 1 != high) {
+            m_state = SortState::Swapping;
+            std::swap(m_arr[i + 1], m_arr[high]);
+            m_swaps++;
+        }
+        return i + 1;
+    }
+
     for (int j = low; j < high; ++j) {
         m_leftIdx = j;
         m_rightIdx = high;
 
+        m_comparisons++;
+        noteCompare(static_cast<size_t>(j), static_cast<size_t>(high), m_recorder);
         if (m_arr[j] < pivot) {
             i++;
             if (i != j) {
                 m_state = SortState::Swapping;
-                std::swap(m_arr[i], m_arr[j]);
+                swapElements(m_arr, static_cast<size_t>(i), static_cast<size_t>(j), m_recorder);
+                m_swaps++;
             }
         }
     }
@@ -438,7 +557,8 @@ int QuickSortStepper::partition(int low, int high) {
     // Place pivot in correct position
     if (i + 1 != high) {
         m_state = SortState::Swapping;
-        std::swap(m_arr[i + 1], m_arr[high]);
+        swapElements(m_arr, static_cast<size_t>(i + 1), static_cast<size_t>(high), m_recorder);
+        m_swaps++;
     }
 
     return i + 1;
@@ -457,7 +577,572 @@ void QuickSortStepper::reset() {
     m_isPartitioning = false;
     m_sorted = false;
     m_state = SortState::Idle;
-    m_sortedIndices.clear();
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== HeapSortStepper =====
+
+HeapSortStepper::HeapSortStepper(std::vector<int>& arr)
+    : m_arr(arr), m_n(arr.size()) {
+    m_sortedMarks.resize(m_n);
+    reset();
+}
+
+bool HeapSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (m_sifting) {
+        siftLevel();
+        return true;
+    }
+
+    if (m_building) {
+        if (m_nextRoot > 0) {
+            // Heapify the next subtree; every root below n/2 has a child
+            m_sift = --m_nextRoot;
+            siftLevel();
+            return true;
+        }
+        m_building = false;
+    }
+
+    if (m_heapSize <= 1) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    // Move the maximum to the end of the heap, where it is final
+    m_state = SortState::Swapping;
+    m_nodeIdx = 0;
+    m_childIdx = static_cast<int>(m_heapSize - 1);
+    swapElements(m_arr, 0, m_heapSize - 1, m_recorder);
+    m_swaps++;
+    m_heapSize--;
+    m_sortedMarks.mark(m_heapSize);
+    if (m_recorder) m_recorder->onRange(0, m_heapSize);
+
+    m_sift = 0;
+    m_sifting = m_heapSize > 1;
+    return true;
+}
+
+void HeapSortStepper::siftLevel() {
+    size_t largest = m_sift;
+    size_t left = 2 * m_sift + 1;
+    size_t right = left + 1;
+
+    m_state = SortState::Comparing;
+    m_nodeIdx = static_cast<int>(m_sift);
+
+    m_comparisons++;
+    noteCompare(left, largest, m_recorder);
+    if (m_arr[left] > m_arr[largest]) {
+        largest = left;
+    }
+    if (right < m_heapSize) {
+        m_comparisons++;
+        noteCompare(right, largest, m_recorder);
+        if (m_arr[right] > m_arr[largest]) {
+            largest = right;
+        }
+    }
+    m_childIdx = static_cast<int>(largest == m_sift ? left : largest);
+
+    if (largest == m_sift) {
+        // Heap property holds below this node
+        m_sifting = false;
+        return;
+    }
+
+    m_state = SortState::Swapping;
+    swapElements(m_arr, m_sift, largest, m_recorder);
+    m_swaps++;
+    m_sift = largest;
+    m_sifting = 2 * m_sift + 1 < m_heapSize;
+}
+
+void HeapSortStepper::reset() {
+    m_heapSize = m_n;
+    m_nextRoot = m_n / 2;
+    m_sift = 0;
+    m_sifting = false;
+    m_building = m_n > 1;
+    m_nodeIdx = -1;
+    m_childIdx = -1;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== ShellSortStepper =====
+
+ShellSortStepper::ShellSortStepper(std::vector<int>& arr)
+    : m_arr(arr), m_n(arr.size()) {
+    m_sortedMarks.resize(m_n);
+
+    // Ciura's empirically best gaps, extended geometrically past 1750
+    static const size_t CIURA_GAPS[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+    for (size_t gap : CIURA_GAPS) {
+        if (gap >= m_n) break;
+        m_gaps.push_back(gap);
+    }
+    if (!m_gaps.empty() && m_gaps.back() == 1750) {
+        for (size_t gap = 1750 * 9 / 4; gap < m_n; gap = gap * 9 / 4) {
+            m_gaps.push_back(gap);
+        }
+    }
+    std::reverse(m_gaps.begin(), m_gaps.end());
+
+    reset();
+}
+
+bool ShellSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (!m_inserting) {
+        if (m_gapIdx < m_gaps.size() && m_i >= m_n) {
+            // Gap pass complete, shrink the gap
+            m_gapIdx++;
+            if (m_gapIdx < m_gaps.size()) {
+                m_i = m_gaps[m_gapIdx];
+            }
+        }
+        if (m_gapIdx >= m_gaps.size()) {
+            m_sortedMarks.markAll();
+            m_sorted = true;
+            m_state = SortState::Sorted;
+            return false;
+        }
+
+        // Take the next element of this pass out of the array
+        m_key = m_arr[m_i];
+        m_j = m_i;
+        m_inserting = true;
+    }
+
+    size_t gap = m_gaps[m_gapIdx];
+    m_currentIdx = static_cast<int>(m_j);
+    m_compareIdx = static_cast<int>(m_j - gap);
+    m_state = SortState::Comparing;
+
+    // The key's slot is the gap at j
+    m_comparisons++;
+    noteCompare(m_j - gap, m_j, m_recorder);
+    bool shift = m_arr[m_j - gap] > m_key;
+    if (shift) {
+        m_state = SortState::Swapping;
+        writeElement(m_arr, m_j, m_arr[m_j - gap], m_recorder);
+        m_swaps++;
+        m_j -= gap;
+    }
+
+    if (!shift || m_j < gap) {
+        // Found the slot - drop the key into it
+        if (m_j != m_i) {
+            writeElement(m_arr, m_j, m_key, m_recorder);
+        }
+        m_inserting = false;
+        m_i++;
+    }
+
+    return true;
+}
+
+void ShellSortStepper::reset() {
+    m_gapIdx = 0;
+    m_i = m_gaps.empty() ? 0 : m_gaps.front();
+    m_j = 0;
+    m_key = 0;
+    m_inserting = false;
+    m_currentIdx = -1;
+    m_compareIdx = -1;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== RadixSortStepper =====
+
+RadixSortStepper::RadixSortStepper(std::vector<int>& arr)
+    : m_arr(arr), m_n(arr.size()) {
+    m_sortedMarks.resize(m_n);
+    m_offsets.resize(BUCKETS);
+    reset();
+}
+
+bool RadixSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (m_shift >= 32) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    if (!m_scattering) {
+        // Count phase: histogram this pass's digit
+        m_state = SortState::Comparing;
+        m_currentIdx = static_cast<int>(m_i);
+        m_writeIdx = -1;
+        m_bucket = static_cast<int>(digit(m_arr[m_i]));
+        m_offsets[static_cast<size_t>(m_bucket)]++;
+
+        if (++m_i == m_n) {
+            // Turn counts into each bucket's first output slot
+            size_t sum = 0;
+            for (size_t& offset : m_offsets) {
+                size_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+            m_snapshot.assign(m_arr.begin(), m_arr.end());
+            m_scattering = true;
+            m_i = 0;
+        }
+        return true;
+    }
+
+    // Scatter phase: stable write of the next snapshot element into its bucket
+    int value = m_snapshot[m_i];
+    size_t bucket = digit(value);
+    size_t dest = m_offsets[bucket]++;
+
+    m_state = SortState::Swapping;
+    m_currentIdx = static_cast<int>(m_i);
+    m_writeIdx = static_cast<int>(dest);
+    m_bucket = static_cast<int>(bucket);
+    writeElement(m_arr, dest, value, m_recorder);
+    m_swaps++;
+
+    if (++m_i == m_n) {
+        m_scattering = false;
+        m_i = 0;
+        std::fill(m_offsets.begin(), m_offsets.end(), 0);
+        m_shift += RADIX_BITS;
+        skipUniformBytes();
+        if (m_recorder) m_recorder->onRange(0, m_n);
+
+        if (m_shift >= 32) {
+            m_sortedMarks.markAll();
+            m_sorted = true;
+            m_state = SortState::Sorted;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void RadixSortStepper::skipUniformBytes() {
+    // A byte shared by every element cannot change the order
+    while (m_shift < 32 && ((m_differing >> m_shift) & (BUCKETS - 1)) == 0) {
+        m_shift += RADIX_BITS;
+    }
+}
+
+void RadixSortStepper::reset() {
+    m_differing = 0;
+    for (int value : m_arr) {
+        m_differing |= key(value) ^ key(m_arr[0]);
+    }
+    m_snapshot.clear();
+    std::fill(m_offsets.begin(), m_offsets.end(), 0);
+    m_shift = 0;
+    skipUniformBytes();
+    m_i = 0;
+    m_scattering = false;
+    m_currentIdx = -1;
+    m_writeIdx = -1;
+    m_bucket = -1;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== CountingSortStepper =====
+
+CountingSortStepper::CountingSortStepper(std::vector<int>& arr)
+    : m_arr(arr), m_n(arr.size()) {
+    m_sortedMarks.resize(m_n);
+    reset();
+}
+
+bool CountingSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    if (!m_writing && m_i < m_n) {
+        // Count phase: tally one element
+        m_state = SortState::Comparing;
+        m_currentIdx = static_cast<int>(m_i);
+        if (!m_counts.empty()) {
+            m_counts[static_cast<size_t>(m_arr[m_i] - m_min)]++;
+        }
+
+        if (++m_i == m_n) {
+            startWriting();
+        }
+        return true;
+    }
+
+    if (m_i >= m_n) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    // Write phase: emit the next value in order; its position is final
+    int value;
+    if (m_keys.empty()) {
+        while (m_counts[m_value] == 0) {
+            m_value++;
+        }
+        m_counts[m_value]--;
+        value = static_cast<int>(m_min + static_cast<std::int64_t>(m_value));
+    } else {
+        value = m_keys[m_i];
+    }
+
+    m_state = SortState::Swapping;
+    m_currentIdx = -1;
+    m_writeIdx = static_cast<int>(m_i);
+    writeElement(m_arr, m_i, value, m_recorder);
+    m_swaps++;
+    m_sortedMarks.mark(m_i);
+
+    if (++m_i == m_n) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+    return true;
+}
+
+void CountingSortStepper::startWriting() {
+    if (m_counts.empty()) {
+        // Range too wide for a histogram: take the order from a sorted copy
+        m_keys.assign(m_arr.begin(), m_arr.end());
+        std::sort(m_keys.begin(), m_keys.end());
+    }
+    m_writing = true;
+    m_value = 0;
+    m_i = 0;
+}
+
+void CountingSortStepper::reset() {
+    m_counts.clear();
+    m_keys.clear();
+    m_min = 0;
+    if (m_n > 0) {
+        auto [lo, hi] = std::minmax_element(m_arr.begin(), m_arr.end());
+        m_min = *lo;
+        std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(*hi) - m_min);
+        if (range < MAX_RANGE) {
+            m_counts.assign(static_cast<size_t>(range) + 1, 0);
+        }
+    }
+    m_value = 0;
+    m_i = 0;
+    m_writing = false;
+    m_currentIdx = -1;
+    m_writeIdx = -1;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
+}
+
+// ===== IntroSortStepper =====
+
+IntroSortStepper::IntroSortStepper(std::vector<int>& arr)
+    : m_arr(arr), m_n(arr.size()) {
+    m_sortedMarks.resize(m_n);
+    for (size_t n = m_n; n > 1; n >>= 1) {
+        m_depthLimit += 2;
+    }
+    reset();
+}
+
+bool IntroSortStepper::step() {
+    if (m_sorted) {
+        return false;
+    }
+
+    while (!m_stack.empty()) {
+        IntroRange range = m_stack.back();
+        m_stack.pop_back();
+
+        if (range.high - range.low + 1 <= INSERTION_CUTOFF) {
+            // Small ranges wait for the final insertion pass
+            continue;
+        }
+
+        m_leftIdx = range.low;
+        m_rightIdx = range.high;
+        m_state = SortState::Comparing;
+        if (m_recorder) m_recorder->onRange(static_cast<size_t>(range.low), static_cast<size_t>(range.high) + 1);
+
+        if (range.depth == 0) {
+            // Partitions are going badly: heap sort guarantees n log n here
+            m_phase = Phase::HeapFallback;
+            m_pivotIdx = -1;
+            heapSort(range.low, range.high);
+            m_sortedMarks.markRange(static_cast<size_t>(range.low), static_cast<size_t>(range.high) + 1);
+            return true;
+        }
+
+        m_phase = Phase::Partition;
+        int pivotIdx = partition(range.low, range.high);
+        m_pivotIdx = pivotIdx;
+        m_sortedMarks.mark(static_cast<size_t>(pivotIdx));
+
+        // Push the larger side first so the stack stays O(log n)
+        IntroRange left{range.low, pivotIdx - 1, range.depth - 1};
+        IntroRange right{pivotIdx + 1, range.high, range.depth - 1};
+        if (left.high - left.low > right.high - right.low) {
+            std::swap(left, right);
+        }
+        m_stack.push_back(right);
+        m_stack.push_back(left);
+        return true;
+    }
+
+    m_phase = Phase::Insertion;
+    return insertNext();
+}
+
+bool IntroSortStepper::less(int i, int j) {
+    m_comparisons++;
+    noteCompare(static_cast<size_t>(i), static_cast<size_t>(j), m_recorder);
+    return m_arr[i] < m_arr[j];
+}
+
+void IntroSortStepper::swap(int i, int j) {
+    if (i == j) {
+        return;
+    }
+    m_state = SortState::Swapping;
+    swapElements(m_arr, static_cast<size_t>(i), static_cast<size_t>(j), m_recorder);
+    m_swaps++;
+}
+
+int IntroSortStepper::partition(int low, int high) {
+    // Median of three: order low, mid, high, then park the median at high
+    int mid = low + (high - low) / 2;
+    if (less(mid, low)) swap(mid, low);
+    if (less(high, low)) swap(high, low);
+    if (less(high, mid)) swap(high, mid);
+    swap(mid, high);
+
+    int i = low - 1;
+    for (int j = low; j < high; ++j) {
+        if (less(j, high)) {
+            swap(++i, j);
+        }
+    }
+    swap(i + 1, high);
+    return i + 1;
+}
+
+void IntroSortStepper::heapSort(int low, int high) {
+    int size = high - low + 1;
+    for (int root = size / 2 - 1; root >= 0; --root) {
+        siftDown(low, root, size);
+    }
+    for (int end = size - 1; end > 0; --end) {
+        swap(low, low + end);
+        siftDown(low, 0, end);
+    }
+}
+
+void IntroSortStepper::siftDown(int low, int root, int size) {
+    for (int child = 2 * root + 1; child < size; child = 2 * root + 1) {
+        if (child + 1 < size && less(low + child, low + child + 1)) {
+            child++;
+        }
+        if (!less(low + root, low + child)) {
+            return;
+        }
+        swap(low + root, low + child);
+        root = child;
+    }
+}
+
+bool IntroSortStepper::insertNext() {
+    if (m_insertIdx >= static_cast<int>(m_n)) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+
+    // Every element is at most INSERTION_CUTOFF slots from home by now
+    m_state = SortState::Comparing;
+    int key = m_arr[m_insertIdx];
+    int j = m_insertIdx - 1;
+    while (j >= 0) {
+        m_comparisons++;
+        noteCompare(static_cast<size_t>(j), static_cast<size_t>(j + 1), m_recorder);
+        if (m_arr[j] <= key) break;
+        m_state = SortState::Swapping;
+        writeElement(m_arr, static_cast<size_t>(j + 1), m_arr[j], m_recorder);
+        m_swaps++;
+        j--;
+    }
+    if (j + 1 != m_insertIdx) {
+        writeElement(m_arr, static_cast<size_t>(j + 1), key, m_recorder);
+    }
+
+    m_pivotIdx = -1;
+    m_leftIdx = j + 1;
+    m_rightIdx = m_insertIdx;
+    m_insertIdx++;
+
+    if (m_insertIdx >= static_cast<int>(m_n)) {
+        m_sortedMarks.markAll();
+        m_sorted = true;
+        m_state = SortState::Sorted;
+        return false;
+    }
+    return true;
+}
+
+void IntroSortStepper::reset() {
+    m_stack.clear();
+    if (m_n > 1) {
+        m_stack.push_back({0, static_cast<int>(m_n) - 1, m_depthLimit});
+    }
+    m_insertIdx = 1;
+    m_phase = Phase::Partition;
+    m_pivotIdx = -1;
+    m_leftIdx = -1;
+    m_rightIdx = -1;
+    m_sorted = false;
+    m_state = SortState::Idle;
+    m_sortedMarks.clear();
+    m_comparisons = 0;
+    m_swaps = 0;
 }
 
 } // namespace dsav::algorithms
@@ -0,0 +1,194 @@
+/**
+ * @file timeline.cpp
+ * @brief Implementation of the seekable step history
+ */
+
+#include "algorithms/timeline.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace dsav::algorithms {
+
+void ArrayTimeline::begin(const std::vector<int>& initial, const StepCursor& cursor) {
+    clear();
+    m_active = true;
+    m_size = initial.size();
+
+    size_t chunkCount = (m_size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_interval = std::max(DEFAULT_KEYFRAME_INTERVAL, chunkCount);
+
+    m_stepEnd.push_back(0);
+    m_cursors.push_back(cursor);
+    m_markedAt.assign(m_size, NEVER);
+    m_dirtyChunks.assign(chunkCount, 1);
+    makeKeyframe(initial);
+}
+
+void ArrayTimeline::markInitial(size_t begin, size_t end) {
+    end = std::min(end, m_size);
+    for (size_t i = begin; i < end; ++i) {
+        m_markedAt[i] = 0;
+    }
+}
+
+void ArrayTimeline::clear() {
+    m_active = false;
+    m_overflowed = false;
+    m_size = 0;
+    m_interval = DEFAULT_KEYFRAME_INTERVAL;
+    m_position = 0;
+    m_deltas.clear();
+    m_stepEnd.clear();
+    m_cursors.clear();
+    m_markedAt.clear();
+    m_allMarkedAt = NEVER;
+    m_keyframes.clear();
+    m_loadedKeyframe = NO_KEYFRAME;
+    m_dirtyChunks.clear();
+    m_memory = 0;
+}
+
+void ArrayTimeline::commitStep(const std::vector<int>& array, const StepCursor& cursor) {
+    if (!m_active) {
+        return;
+    }
+
+    m_stepEnd.push_back(m_deltas.size());
+    m_cursors.push_back(cursor);
+    m_memory += sizeof(size_t) + sizeof(StepCursor);
+    m_position = stepCount();
+
+    if (m_position % m_interval == 0) {
+        makeKeyframe(array);
+    }
+    dropIfOverBudget();
+}
+
+void ArrayTimeline::seek(size_t step, std::vector<int>& array) {
+    if (!m_active) {
+        return;
+    }
+
+    size_t target = std::min(step, stepCount());
+    if (target == m_position) {
+        return;
+    }
+
+    // The shown array always derives from the keyframe of its own block
+    size_t block = target / m_interval;
+    if (target > m_position && block == m_position / m_interval) {
+        applyDeltas(m_position, target, array);
+    } else {
+        restoreKeyframe(block, array);
+        applyDeltas(block * m_interval, target, array);
+    }
+    m_position = target;
+}
+
+// ===== Recording =====
+
+void ArrayTimeline::onWrite(size_t index, int value) {
+    if (!m_active) {
+        return;
+    }
+
+    m_deltas.push_back({static_cast<std::uint32_t>(index), value});
+    m_memory += sizeof(ArrayDelta);
+    touchChunk(index);
+}
+
+void ArrayTimeline::onSwap(size_t i, size_t j) {
+    if (!m_active) {
+        return;
+    }
+
+    m_deltas.push_back({static_cast<std::uint32_t>(i) | SWAP_FLAG, static_cast<std::int32_t>(j)});
+    m_memory += sizeof(ArrayDelta);
+    touchChunk(i);
+    touchChunk(j);
+}
+
+void ArrayTimeline::onMark(size_t begin, size_t end) {
+    if (!m_active) {
+        return;
+    }
+
+    // Marks only ever grow during a run, so the first step is all we keep
+    size_t step = m_cursors.size();
+    end = std::min(end, m_size);
+    for (size_t i = begin; i < end; ++i) {
+        m_markedAt[i] = std::min(m_markedAt[i], step);
+    }
+}
+
+void ArrayTimeline::onMarkAll() {
+    if (m_active) {
+        m_allMarkedAt = std::min(m_allMarkedAt, m_cursors.size());
+    }
+}
+
+// ===== Keyframes =====
+
+void ArrayTimeline::makeKeyframe(const std::vector<int>& array) {
+    size_t chunkCount = m_dirtyChunks.size();
+    const std::vector<Chunk>* previous = m_keyframes.empty() ? nullptr : &m_keyframes.back();
+
+    // Share every chunk untouched since the previous keyframe
+    std::vector<Chunk> chunks(chunkCount);
+    for (size_t c = 0; c < chunkCount; ++c) {
+        if (previous && !m_dirtyChunks[c]) {
+            chunks[c] = (*previous)[c];
+            continue;
+        }
+        size_t first = c * CHUNK_SIZE;
+        size_t last = std::min(first + CHUNK_SIZE, m_size);
+        chunks[c] = std::make_shared<const std::vector<int>>(array.begin() + first, array.begin() + last);
+        m_memory += (last - first) * sizeof(int);
+    }
+    m_memory += chunkCount * sizeof(Chunk);
+
+    m_keyframes.push_back(std::move(chunks));
+    m_loadedKeyframe = m_keyframes.size() - 1;
+    std::fill(m_dirtyChunks.begin(), m_dirtyChunks.end(), 0);
+}
+
+void ArrayTimeline::restoreKeyframe(size_t keyframe, std::vector<int>& array) {
+    const std::vector<Chunk>& target = m_keyframes[keyframe];
+    const std::vector<Chunk>* loaded = (m_loadedKeyframe != NO_KEYFRAME) ? &m_keyframes[m_loadedKeyframe] : nullptr;
+
+    // Only chunks that differ from what the array already holds are copied
+    for (size_t c = 0; c < target.size(); ++c) {
+        if (loaded && !m_dirtyChunks[c] && (*loaded)[c] == target[c]) {
+            continue;
+        }
+        std::copy(target[c]->begin(), target[c]->end(), array.begin() + c * CHUNK_SIZE);
+    }
+
+    m_loadedKeyframe = keyframe;
+    std::fill(m_dirtyChunks.begin(), m_dirtyChunks.end(), 0);
+}
+
+void ArrayTimeline::applyDeltas(size_t fromStep, size_t toStep, std::vector<int>& array) {
+    for (size_t d = m_stepEnd[fromStep]; d < m_stepEnd[toStep]; ++d) {
+        const ArrayDelta& delta = m_deltas[d];
+        if (delta.index & SWAP_FLAG) {
+            size_t i = delta.index & ~SWAP_FLAG;
+            size_t j = static_cast<size_t>(delta.value);
+            std::swap(array[i], array[j]);
+            touchChunk(i);
+            touchChunk(j);
+        } else {
+            array[delta.index] = delta.value;
+            touchChunk(delta.index);
+        }
+    }
+}
+
+void ArrayTimeline::dropIfOverBudget() {
+    if (m_memory > MAX_MEMORY_BYTES) {
+        clear();
+        m_overflowed = true;
+    }
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,115 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @brief Implementation of the work-stealing task pool
+ */
+
+#include "algorithms/work_stealing_pool.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace dsav::algorithms {
+
+WorkStealingPool::WorkStealingPool(size_t lanes) {
+    lanes = std::max<size_t>(lanes, 1);
+    for (size_t i = 0; i < lanes; ++i) {
+        m_lanes.push_back(std::make_unique<Lane>());
+    }
+    for (size_t i = 1; i < lanes; ++i) {
+        m_threads.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::run(std::vector<Task>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+
+    // One lane, or nothing to share: skip the hand-off entirely
+    if (m_threads.empty() || tasks.size() == 1) {
+        for (Task& task : tasks) {
+            task(0);
+        }
+        return;
+    }
+
+    m_remaining.store(tasks.size(), std::memory_order_relaxed);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        Lane& lane = *m_lanes[i % m_lanes.size()];
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.tasks.push_back(std::move(tasks[i]));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    // The caller works as lane 0 until the last task, wherever it ran, is done
+    while (m_remaining.load(std::memory_order_acquire) > 0) {
+        if (!runOne(0)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool WorkStealingPool::runOne(size_t lane) {
+    Task task;
+
+    // Own deque from the back: the most recently dealt task is the warmest
+    {
+        Lane& own = *m_lanes[lane];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+
+    // Otherwise steal the oldest task of the next lane that has one
+    for (size_t k = 1; !task && k < m_lanes.size(); ++k) {
+        Lane& victim = *m_lanes[(lane + k) % m_lanes.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+
+    if (!task) {
+        return false;
+    }
+    task(lane);
+    m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+void WorkStealingPool::workerLoop(size_t lane) {
+    size_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this, seen]() { return m_stopping || m_generation != seen; });
+            if (m_stopping) return;
+            seen = m_generation;
+        }
+
+        while (m_remaining.load(std::memory_order_acquire) > 0) {
+            if (!runOne(lane)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+} // namespace dsav::algorithms
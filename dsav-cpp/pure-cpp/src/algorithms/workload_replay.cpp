@@ -0,0 +1,85 @@
+/**
+ * @file workload_replay.cpp
+ * @brief Keyframed, seekable workload replay
+ */
+
+#include "algorithms/workload_replay.hpp"
+#include <algorithm>
+
+namespace dsav::algorithms {
+
+void WorkloadReplay::begin(std::shared_ptr<const WorkloadScript> script, WorkloadHooks hooks, size_t sampleEvery) {
+    clear();
+    m_script = std::move(script);
+    m_hooks = std::move(hooks);
+    m_sampleEvery = sampleEvery;
+    m_interval = std::max(MIN_KEYFRAME_INTERVAL, (m_script->size() + MAX_KEYFRAMES - 1) / MAX_KEYFRAMES);
+
+    // Keyframe 0 is always kept, so every position can be reached
+    m_keyframes.emplace_back();
+    m_hooks.capture(m_keyframes.back());
+    m_memory = m_keyframes.back().bytes();
+}
+
+void WorkloadReplay::clear() {
+    m_script.reset();
+    m_hooks = WorkloadHooks();
+    m_position = 0;
+    m_sampleInFlight = false;
+    m_silentHits = 0;
+    m_keyframes.clear();
+    m_memory = 0;
+}
+
+size_t WorkloadReplay::runSilently(size_t maxOps) {
+    const std::vector<WorkloadOp>& ops = m_script->ops();
+    size_t applied = 0;
+    while (applied < maxOps && !atEnd() && !atSample()) {
+        m_silentHits += m_hooks.apply(ops[m_position]) ? 1 : 0;
+        ++m_position;
+        ++applied;
+        captureIfDue();
+    }
+    return applied;
+}
+
+void WorkloadReplay::commitSampled() {
+    if (!m_sampleInFlight) return;
+    m_sampleInFlight = false;
+    ++m_position;
+    captureIfDue();
+}
+
+void WorkloadReplay::seek(size_t step) {
+    if (!isActive()) return;
+    step = std::min(step, size());
+
+    // Forward from a settled position needs no restore
+    if (m_sampleInFlight || step < m_position ||
+        (step / m_interval > m_position / m_interval && step / m_interval < m_keyframes.size())) {
+        size_t keyframe = std::min(step / m_interval, m_keyframes.size() - 1);
+        m_hooks.restore(m_keyframes[keyframe]);
+        m_position = keyframe * m_interval;
+        m_sampleInFlight = false;
+    }
+
+    const std::vector<WorkloadOp>& ops = m_script->ops();
+    m_silentHits = 0;
+    while (m_position < step) {
+        m_silentHits += m_hooks.apply(ops[m_position]) ? 1 : 0;
+        ++m_position;
+        captureIfDue();
+    }
+}
+
+void WorkloadReplay::captureIfDue() {
+    if (m_position % m_interval != 0 || m_position / m_interval != m_keyframes.size() ||
+        m_memory >= MAX_MEMORY_BYTES) {
+        return;
+    }
+    m_keyframes.emplace_back();
+    m_hooks.capture(m_keyframes.back());
+    m_memory += m_keyframes.back().bytes();
+}
+
+} // namespace dsav::algorithms
@@ -0,0 +1,365 @@
+/**
+ * @file workload_script.cpp
+ * @brief Workload script files, generation and the headless batched runner
+ */
+
+#include "algorithms/workload_script.hpp"
+#include "algorithms/workload_targets.hpp"
+#include "algorithms/dataset_import.hpp"
+#include "algorithms/byte_order.hpp"
+#include "data_structures/queue.hpp"
+#include "data_structures/stack.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+namespace dsav::algorithms {
+
+namespace {
+
+using detail::loadLE32;
+using detail::storeLE;
+
+constexpr char WORKLOAD_MAGIC[8] = {'D', 'S', 'A', 'V', 'W', 'K', 'L', 'D'};
+
+bool isOpCode(std::uint8_t code) {
+    return code >= static_cast<std::uint8_t>(WorkloadOpCode::Insert) &&
+           code <= static_cast<std::uint8_t>(WorkloadOpCode::Search);
+}
+
+/**
+ * @brief Text keyword of an op
+ *
+ * @param takesOperand Set when the keyword needs an operand (pop, dequeue and peek do not)
+ * @return false if the word is not an op
+ */
+bool parseKeyword(const char* word, size_t length, WorkloadOpCode& code, bool& takesOperand) {
+    struct Keyword {
+        const char* text;
+        WorkloadOpCode code;
+        bool operand;
+    };
+    static constexpr Keyword KEYWORDS[] = {
+        {"insert", WorkloadOpCode::Insert, true},  {"push", WorkloadOpCode::Insert, true},
+        {"enqueue", WorkloadOpCode::Insert, true}, {"remove", WorkloadOpCode::Remove, true},
+        {"delete", WorkloadOpCode::Remove, true},  {"pop", WorkloadOpCode::Remove, false},
+        {"dequeue", WorkloadOpCode::Remove, false}, {"search", WorkloadOpCode::Search, true},
+        {"find", WorkloadOpCode::Search, true},    {"peek", WorkloadOpCode::Search, false},
+    };
+    for (const Keyword& keyword : KEYWORDS) {
+        if (std::strlen(keyword.text) == length && std::memcmp(keyword.text, word, length) == 0) {
+            code = keyword.code;
+            takesOperand = keyword.operand;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * @brief Percentile of batch times (sorts the vector)
+ */
+double percentile(std::vector<double>& values, double fraction) {
+    if (values.empty()) return 0.0;
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * static_cast<double>(values.size())));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+template<typename Container, typename Apply>
+void runBatches(Container& container, const WorkloadScript& script, size_t batchSize, Apply apply,
+                WorkloadResult& result, const std::atomic<bool>* cancel) {
+    using Clock = std::chrono::steady_clock;
+    const std::vector<WorkloadOp>& ops = script.ops();
+    std::vector<double> batchUs;
+    batchUs.reserve(ops.size() / batchSize + 1);
+
+    size_t hits = 0;
+    size_t next = 0;
+    while (next < ops.size()) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) break;
+        size_t end = std::min(ops.size(), next + batchSize);
+        auto start = Clock::now();
+        for (; next < end; ++next) {
+            hits += apply(container, ops[next]) ? 1 : 0;
+        }
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        batchUs.push_back(us);
+        result.seconds += us * 1e-6;
+    }
+
+    result.applied = next;
+    result.hits = hits;
+    result.finalSize = container.size();
+    result.batches = batchUs.size();
+    result.batchP50Us = percentile(batchUs, 0.5);
+    result.batchP99Us = percentile(batchUs, 0.99);
+    result.completed = next == ops.size();
+}
+
+} // namespace
+
+const char* workloadOpName(WorkloadOpCode code) {
+    switch (code) {
+        case WorkloadOpCode::Insert: return "insert";
+        case WorkloadOpCode::Remove: return "remove";
+        case WorkloadOpCode::Search: return "search";
+    }
+    return "?";
+}
+
+// ===== Files =====
+
+bool WorkloadScript::load(const std::string& path, WorkloadFormat format) {
+    if (format == WorkloadFormat::Auto) {
+        MappedFile probe;
+        if (!probe.open(path)) {
+            m_error = probe.error();
+            return false;
+        }
+        bool binary = probe.size() >= sizeof(WORKLOAD_MAGIC) &&
+                      std::memcmp(probe.data(), WORKLOAD_MAGIC, sizeof(WORKLOAD_MAGIC)) == 0;
+        format = binary ? WorkloadFormat::Binary : WorkloadFormat::Text;
+    }
+    return format == WorkloadFormat::Binary ? loadBinary(path) : loadText(path);
+}
+
+bool WorkloadScript::loadText(const std::string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        m_error = file.error();
+        return false;
+    }
+
+    std::vector<WorkloadOp> ops;
+    const char* p = reinterpret_cast<const char*>(file.data());
+    const char* end = p + file.size();
+    size_t line = 0;
+    while (p < end) {
+        ++line;
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd) lineEnd = end;
+        const char* hash = static_cast<const char*>(std::memchr(p, '#', static_cast<size_t>(lineEnd - p)));
+        const char* stop = hash ? hash : lineEnd;
+
+        while (p < stop && isSpace(*p)) ++p;
+        if (p < stop) {
+            const char* word = p;
+            while (p < stop && !isSpace(*p)) ++p;
+            WorkloadOp op;
+            bool takesOperand = false;
+            if (!parseKeyword(word, static_cast<size_t>(p - word), op.code, takesOperand)) {
+                m_error = path + ":" + std::to_string(line) + ": unknown op '" +
+                          std::string(word, static_cast<size_t>(p - word)) + "'";
+                return false;
+            }
+            while (p < stop && isSpace(*p)) ++p;
+            if (p < stop) {
+                auto parsed = std::from_chars(p, stop, op.operand);
+                p = parsed.ptr;
+                while (p < stop && isSpace(*p)) ++p;
+                if (parsed.ec != std::errc() || p != stop) {
+                    m_error = path + ":" + std::to_string(line) + ": bad operand";
+                    return false;
+                }
+            } else if (takesOperand) {
+                m_error = path + ":" + std::to_string(line) + ": missing operand";
+                return false;
+            }
+            ops.push_back(op);
+        }
+        p = lineEnd < end ? lineEnd + 1 : end;
+    }
+
+    m_ops = std::move(ops);
+    m_error.clear();
+    return true;
+}
+
+bool WorkloadScript::loadBinary(const std::string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        m_error = file.error();
+        return false;
+    }
+
+    const std::uint8_t* p = file.data();
+    size_t size = file.size();
+    detail::FileHeader header;
+    if (!detail::loadFileHeader(p, size, WORKLOAD_MAGIC, HEADER_BYTES, header)) {
+        m_error = path + " is not a binary workload";
+        return false;
+    }
+    // Bytes 10 and 11 hold the record size
+    if (header.version != VERSION || (header.format[0] | header.format[1] << 8) != RECORD_BYTES) {
+        m_error = "Unsupported workload version " + std::to_string(header.version);
+        return false;
+    }
+    if (!detail::payloadFits(header, size, HEADER_BYTES, RECORD_BYTES)) {
+        m_error = "Truncated workload " + path;
+        return false;
+    }
+
+    std::vector<WorkloadOp> ops(static_cast<size_t>(header.count));
+    const std::uint8_t* record = p + header.offset;
+    for (size_t i = 0; i < ops.size(); ++i, record += RECORD_BYTES) {
+        if (!isOpCode(record[0])) {
+            m_error = "Unknown op code " + std::to_string(record[0]) + " in record " + std::to_string(i);
+            return false;
+        }
+        ops[i].code = static_cast<WorkloadOpCode>(record[0]);
+        ops[i].operand = static_cast<std::int32_t>(loadLE32(record + 4));
+    }
+
+    m_ops = std::move(ops);
+    m_error.clear();
+    return true;
+}
+
+bool WorkloadScript::save(const std::string& path, WorkloadFormat format) {
+    std::vector<std::uint8_t> buffer;
+    if (format == WorkloadFormat::Text) {
+        std::string text;
+        text.reserve(m_ops.size() * 12);
+        for (const WorkloadOp& op : m_ops) {
+            text += workloadOpName(op.code);
+            text += ' ';
+            text += std::to_string(op.operand);
+            text += '\n';
+        }
+        buffer.assign(text.begin(), text.end());
+    } else {
+        buffer.assign(HEADER_BYTES + m_ops.size() * RECORD_BYTES, 0);
+        std::uint8_t* p = buffer.data();
+        detail::FileHeader header;
+        header.version = VERSION;
+        header.format[0] = static_cast<std::uint8_t>(RECORD_BYTES);
+        header.offset = HEADER_BYTES;
+        header.count = m_ops.size();
+        detail::storeFileHeader(p, WORKLOAD_MAGIC, header);
+        std::uint8_t* record = p + HEADER_BYTES;
+        for (const WorkloadOp& op : m_ops) {
+            record[0] = static_cast<std::uint8_t>(op.code);
+            storeLE(record + 4, static_cast<std::uint32_t>(op.operand), 4);
+            record += RECORD_BYTES;
+        }
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        m_error = "Cannot create " + path;
+        return false;
+    }
+    bool ok = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        m_error = "Write failed for " + path;
+    }
+    return ok;
+}
+
+void WorkloadScript::generate(size_t count, const WorkloadMix& mix, std::uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::int32_t keyRange = mix.keyRange > 0
+        ? mix.keyRange
+        : static_cast<std::int32_t>(std::clamp<size_t>(count, 1, 0x7FFFFFFF));
+    std::uniform_int_distribution<std::int32_t> key(1, keyRange);
+
+    unsigned total = mix.insertWeight + mix.removeWeight + mix.searchWeight;
+    std::uniform_int_distribution<unsigned> pick(0, total > 0 ? total - 1 : 0);
+    size_t burst = std::max<size_t>(1, mix.burst);
+
+    m_ops.clear();
+    m_ops.reserve(count);
+    while (m_ops.size() < count) {
+        WorkloadOpCode code = WorkloadOpCode::Insert;
+        if (total > 0) {
+            unsigned r = pick(gen);
+            if (r >= mix.insertWeight + mix.removeWeight) {
+                code = WorkloadOpCode::Search;
+            } else if (r >= mix.insertWeight) {
+                code = WorkloadOpCode::Remove;
+            }
+        }
+        for (size_t i = 0; i < burst && m_ops.size() < count; ++i) {
+            m_ops.push_back(WorkloadOp{code, key(gen)});
+        }
+    }
+}
+
+size_t WorkloadScript::count(WorkloadOpCode code) const {
+    return static_cast<size_t>(std::count_if(m_ops.begin(), m_ops.end(),
+                                             [code](const WorkloadOp& op) { return op.code == code; }));
+}
+
+// ===== Headless runs =====
+
+const char* workloadContainerName(WorkloadContainer container) {
+    switch (container) {
+        case WorkloadContainer::DynamicArray: return "dynamic array";
+        case WorkloadContainer::Stack:        return "stack";
+        case WorkloadContainer::Queue:        return "queue";
+        case WorkloadContainer::RedBlackTree: return "red-black tree";
+    }
+    return "?";
+}
+
+const char* workloadContainerKey(WorkloadContainer container) {
+    switch (container) {
+        case WorkloadContainer::DynamicArray: return "array";
+        case WorkloadContainer::Stack:        return "stack";
+        case WorkloadContainer::Queue:        return "queue";
+        case WorkloadContainer::RedBlackTree: return "rbtree";
+    }
+    return "?";
+}
+
+bool parseWorkloadContainer(const std::string& key, WorkloadContainer& container) {
+    for (size_t i = 0; i < WORKLOAD_CONTAINER_COUNT; ++i) {
+        auto candidate = static_cast<WorkloadContainer>(i);
+        if (key == workloadContainerKey(candidate)) {
+            container = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool runWorkload(WorkloadContainer container, const WorkloadScript& script, size_t batchSize,
+                 WorkloadResult& result, const std::atomic<bool>* cancel) {
+    result = WorkloadResult();
+    batchSize = std::max<size_t>(1, batchSize);
+
+    switch (container) {
+        case WorkloadContainer::DynamicArray: {
+            DynamicArray<int> array;
+            runBatches(array, script, batchSize, applyArrayOp, result, cancel);
+            break;
+        }
+        case WorkloadContainer::Stack: {
+            Stack<int, DYNAMIC_CAPACITY> stack;
+            runBatches(stack, script, batchSize, applyStackOp<Stack<int, DYNAMIC_CAPACITY>>, result, cancel);
+            break;
+        }
+        case WorkloadContainer::Queue: {
+            Queue<int, DYNAMIC_CAPACITY> queue;
+            runBatches(queue, script, batchSize, applyQueueOp<Queue<int, DYNAMIC_CAPACITY>>, result, cancel);
+            break;
+        }
+        case WorkloadContainer::RedBlackTree: {
+            RedBlackTree<int> tree;
+            runBatches(tree, script, batchSize, applyTreeOp<false>, result, cancel);
+            break;
+        }
+    }
+    return result.completed;
+}
+
+} // namespace dsav::algorithms
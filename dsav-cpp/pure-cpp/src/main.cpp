@@ -8,6 +8,8 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <chrono>
+#include <cstdio>
 
 // OpenGL and windowing
 #include <glad/glad.h>
@@ -24,16 +26,28 @@
 #include "renderer.hpp"
 #include "animation.hpp"
 #include "ui_components.hpp"
+#include "job_system.hpp"
+#include "profiler_overlay.hpp"
+#include "trace_writer.hpp"
+#include "render_scheduler.hpp"
+#include "frame_export.hpp"
+#include "visualizer_registry.hpp"
 
 // DSAV visualizers
 #include "visualizers/stack_visualizer.hpp"
 #include "visualizers/queue_visualizer.hpp"
 #include "visualizers/array_visualizer.hpp"
 #include "visualizers/linked_list_visualizer.hpp"
+#include "visualizers/unrolled_list_visualizer.hpp"
 #include "visualizers/bst_visualizer.hpp"
 #include "visualizers/rbtree_visualizer.hpp"
+#include "visualizers/btree_visualizer.hpp"
+#include "visualizers/heap_visualizer.hpp"
+#include "visualizers/hash_map_visualizer.hpp"
+#include "visualizers/concurrent_queue_visualizer.hpp"
 #include "visualizers/sorting_visualizer.hpp"
 #include "visualizers/searching_visualizer.hpp"
+#include "visualizers/complexity_visualizer.hpp"
 
 // GLM for math
 #include <glm/glm.hpp>
@@ -44,6 +58,8 @@ constexpr int WINDOW_WIDTH = 1920;
 constexpr int WINDOW_HEIGHT = 1080;
 constexpr const char* WINDOW_TITLE = "DSAV - Data Structures & Algorithms Visualizer";
 constexpr const char* GLSL_VERSION = "#version 330 core";
+constexpr int FRAME_CAP_CHOICES[] = {0, 30, 60, 120};  ///< View > Frame Cap entries (0 = display refresh)
+constexpr int EXPORT_FPS_CHOICES[] = {24, 30, 60};     ///< File > Export frame rates
 
 // ===== Forward Declarations =====
 
@@ -53,18 +69,47 @@ static void glfwKeyCallback(GLFWwindow* window, int key, int scancode, int actio
 
 // ===== Application State =====
 
+/**
+ * @brief Sidebar entries, in sidebar order
+ */
+enum class VisualizerId {
+    Array,
+    Stack,
+    Queue,
+    LinkedList,
+    UnrolledList,
+    BST,
+    RedBlackTree,
+    BTree,
+    Heap,
+    HashMap,
+    LockFree,
+    Sorting,
+    Searching,
+    Complexity
+};
+
 struct ApplicationState {
     bool showDemoWindow = false;
+    bool showProfiler = false;
     bool showSidebar = true;
     bool showLogPanel = true;
     bool showVisualization = true;
 
-    // Current visualizer
-    std::unique_ptr<dsav::IVisualizer> currentVisualizer;
+    // Every visualizer opened so far; the selected one is visualizers.current()
+    dsav::VisualizerRegistry<VisualizerId> visualizers;
 
     std::string statusMessage = "Ready";
+
+    int exportFps = 30;
+    char snapshotPath[256] = "dsav-session.snap";  ///< File > Snapshot target
 };
 
+static void registerVisualizers(ApplicationState& appState);
+static void sidebarButton(ApplicationState& appState, VisualizerId id);
+static bool isVisualizerMoving(const ApplicationState& appState);
+static bool needsContinuousFrames(const ApplicationState& appState);
+
 // ===== Main Function =====
 
 int main(int argc, char** argv) {
@@ -72,6 +117,11 @@ int main(int argc, char** argv) {
     std::cout << "Pure C++ Version with OpenGL\n";
     std::cout << "==============================================\n\n";
 
+    dsav::RenderSchedulerConfig schedulerConfig;
+    if (!dsav::parseRenderSchedulerArgs(argc, argv, schedulerConfig)) {
+        return 1;
+    }
+
     // ===== 1. Initialize GLFW =====
 
     glfwSetErrorCallback(glfwErrorCallback);
@@ -162,21 +212,41 @@ int main(int argc, char** argv) {
 
     ApplicationState appState;
 
-    // Initialize with Stack visualizer
-    appState.currentVisualizer = std::make_unique<dsav::StackVisualizer>(16);
+    // Visualizers are built on first selection; start with the Stack
+    registerVisualizers(appState);
+    appState.visualizers.select(VisualizerId::Stack);
 
     // ===== 5. Main Loop =====
 
-    // Track delta time
-    float lastFrame = 0.0f;
+    // Renders every frame while something moves, sleeps on events otherwise
+    dsav::RenderScheduler scheduler(schedulerConfig);
+
+    // A finished background job ends an idle wait at once
+    dsav::jobs::setCompletionListener(dsav::RenderScheduler::wake);
+
+    // Owns GL buffers: released before the context goes away
+    auto exporter = std::make_unique<dsav::FrameExporter>();
 
     while (!glfwWindowShouldClose(window)) {
-        // Calculate delta time
-        float currentFrame = static_cast<float>(glfwGetTime());
-        float deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
-        // Poll events
-        glfwPollEvents();
+        // While exporting, moving frames advance by a fixed step and run uncapped
+        bool exportFrame = exporter->beginFrame(isVisualizerMoving(appState));
+        scheduler.setUnpaced(exportFrame);
+
+        // Wait for the next frame and process events (also yields the delta time)
+        float deltaTime;
+        {
+            DSAV_PROFILE_SCOPE("Wait Events");
+            deltaTime = scheduler.beginFrame(exportFrame || needsContinuousFrames(appState));
+        }
+        if (exportFrame) {
+            deltaTime = exporter->timestep();
+        }
+
+        // Apply results of finished background jobs before anything reads visualizer state
+        {
+            DSAV_PROFILE_SCOPE("Job Completions");
+            dsav::jobs::runCompletions();
+        }
 
         // Start new ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -184,8 +254,9 @@ int main(int argc, char** argv) {
         ImGui::NewFrame();
 
         // Update visualizer
-        if (appState.currentVisualizer) {
-            appState.currentVisualizer->update(deltaTime);
+        if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+            DSAV_PROFILE_SCOPE("Visualizer Update");
+            visualizer->update(deltaTime);
         }
 
         // ===== Setup Dockspace =====
@@ -222,6 +293,84 @@ int main(int argc, char** argv) {
                 if (ImGui::MenuItem("Reset", "Ctrl+R")) {
                     appState.statusMessage = "Reset!";
                 }
+                if (!dsav::trace::isActive()) {
+                    if (ImGui::MenuItem("Start Trace Capture")) {
+                        std::string path = dsav::trace::defaultPath();
+                        appState.statusMessage = dsav::trace::start(path)
+                            ? "Tracing to " + path
+                            : "Error: cannot open " + path;
+                    }
+                } else if (ImGui::MenuItem("Stop Trace Capture")) {
+                    dsav::trace::stop();
+                    appState.statusMessage = "Trace saved to " + dsav::trace::path();
+                }
+                ImGui::Separator();
+                if (!exporter->isActive()) {
+                    if (ImGui::BeginMenu("Export")) {
+                        dsav::ExportSettings settings;
+                        settings.fps = appState.exportFps;
+                        bool startExport = false;
+                        if (ImGui::MenuItem("PNG Sequence")) {
+                            settings.format = dsav::ExportFormat::PngSequence;
+                            startExport = true;
+                        }
+                        if (ImGui::MenuItem("Animated GIF")) {
+                            settings.format = dsav::ExportFormat::Gif;
+                            startExport = true;
+                        }
+                        ImGui::Separator();
+                        for (int fps : EXPORT_FPS_CHOICES) {
+                            std::string label = std::to_string(fps) + " FPS";
+                            if (ImGui::MenuItem(label.c_str(), nullptr, appState.exportFps == fps)) {
+                                appState.exportFps = fps;
+                            }
+                        }
+                        if (startExport) {
+                            appState.statusMessage = exporter->start(settings)
+                                ? "Exporting to " + exporter->path()
+                                : "Error: " + exporter->error();
+                        }
+                        ImGui::EndMenu();
+                    }
+                } else {
+                    std::string label = "Stop Export (" + std::to_string(exporter->capturedFrames()) + " frames)";
+                    if (ImGui::MenuItem(label.c_str())) {
+                        exporter->stop();
+                        appState.statusMessage = exporter->error().empty()
+                            ? "Exported " + std::to_string(exporter->writtenFrames()) + " frames to " + exporter->path()
+                            : "Error: " + exporter->error();
+                    }
+                }
+                if (ImGui::BeginMenu("Snapshot")) {
+                    dsav::IVisualizer* visualizer = appState.visualizers.current();
+                    bool supported = visualizer && visualizer->supportsSnapshots();
+                    ImGui::SetNextItemWidth(240.0f);
+                    ImGui::InputText("Path", appState.snapshotPath, sizeof(appState.snapshotPath));
+                    ImGui::BeginDisabled(!supported || appState.snapshotPath[0] == '\0');
+                    if (ImGui::MenuItem("Save")) {
+                        visualizer->saveSnapshot(appState.snapshotPath);
+                        appState.statusMessage = visualizer->getStatusText();
+                    }
+                    if (ImGui::MenuItem("Load")) {
+                        auto start = std::chrono::steady_clock::now();
+                        bool loaded = visualizer->loadSnapshot(appState.snapshotPath);
+                        double ms = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start).count();
+                        char timing[32];
+                        std::snprintf(timing, sizeof(timing), " (%.1f ms)", ms);
+                        appState.statusMessage = visualizer->getStatusText() + (loaded ? timing : "");
+                    }
+                    ImGui::EndDisabled();
+                    if (!supported) {
+                        ImGui::TextDisabled("Array, Stack, Queue and Red-Black Tree only");
+                    }
+                    ImGui::EndMenu();
+                }
+                ImGui::Separator();
+                if (ImGui::MenuItem("Free Hidden Visualizers")) {
+                    size_t released = appState.visualizers.releaseInactive();
+                    appState.statusMessage = "Freed " + std::to_string(released) + " hidden visualizer(s)";
+                }
                 ImGui::Separator();
                 if (ImGui::MenuItem("Exit", "ESC")) {
                     glfwSetWindowShouldClose(window, true);
@@ -234,7 +383,22 @@ int main(int argc, char** argv) {
                 ImGui::MenuItem("Visualization", nullptr, &appState.showVisualization);
                 ImGui::MenuItem("Log Panel", nullptr, &appState.showLogPanel);
                 ImGui::Separator();
+                ImGui::MenuItem("Profiler", nullptr, &appState.showProfiler);
                 ImGui::MenuItem("ImGui Demo", nullptr, &appState.showDemoWindow);
+                ImGui::Separator();
+                bool idleThrottling = scheduler.config().idleThrottling;
+                if (ImGui::MenuItem("Idle Throttling", nullptr, &idleThrottling)) {
+                    scheduler.setIdleThrottling(idleThrottling);
+                }
+                if (ImGui::BeginMenu("Frame Cap")) {
+                    for (int fps : FRAME_CAP_CHOICES) {
+                        std::string label = fps == 0 ? "Display Refresh" : std::to_string(fps) + " FPS";
+                        if (ImGui::MenuItem(label.c_str(), nullptr, scheduler.config().maxFps == fps)) {
+                            scheduler.setMaxFps(fps);
+                        }
+                    }
+                    ImGui::EndMenu();
+                }
                 ImGui::EndMenu();
             }
 
@@ -261,132 +425,28 @@ int main(int argc, char** argv) {
 
             // Data Structures Section
             if (ImGui::CollapsingHeader("Data Structures", ImGuiTreeNodeFlags_DefaultOpen)) {
-                // Array button
-                bool isArrayActive = appState.currentVisualizer &&
-                                     appState.currentVisualizer->getName() == "Array";
-                if (isArrayActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Array", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::ArrayVisualizer>();
-                    appState.statusMessage = "Array selected";
-                }
-                if (isArrayActive) {
-                    ImGui::PopStyleColor();
-                }
-
-                // Stack button
-                bool isStackActive = appState.currentVisualizer &&
-                                     appState.currentVisualizer->getName() == "Stack";
-                if (isStackActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Stack", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::StackVisualizer>(16);
-                    appState.statusMessage = "Stack selected";
-                }
-                if (isStackActive) {
-                    ImGui::PopStyleColor();
-                }
-
-                // Queue button
-                bool isQueueActive = appState.currentVisualizer &&
-                                     appState.currentVisualizer->getName() == "Queue";
-                if (isQueueActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Queue", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::QueueVisualizer>(16);
-                    appState.statusMessage = "Queue selected";
-                }
-                if (isQueueActive) {
-                    ImGui::PopStyleColor();
-                }
-
-                // Linked List button
-                bool isLinkedListActive = appState.currentVisualizer &&
-                                          appState.currentVisualizer->getName() == "Linked List";
-                if (isLinkedListActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Linked List", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::LinkedListVisualizer>();
-                    appState.statusMessage = "Linked List selected";
-                }
-                if (isLinkedListActive) {
-                    ImGui::PopStyleColor();
-                }
-
-                // Binary Search Tree button
-                bool isBSTActive = appState.currentVisualizer &&
-                                   appState.currentVisualizer->getName() == "Binary Search Tree";
-                if (isBSTActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Binary Search Tree", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::BSTVisualizer>();
-                    appState.statusMessage = "Binary Search Tree selected";
-                }
-                if (isBSTActive) {
-                    ImGui::PopStyleColor();
-                }
-
-                // Red-Black Tree button
-                bool isRBTreeActive = appState.currentVisualizer &&
-                                      appState.currentVisualizer->getName() == "Red-Black Tree";
-                if (isRBTreeActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Red-Black Tree", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::RBTreeVisualizer>();
-                    appState.statusMessage = "Red-Black Tree selected";
-                }
-                if (isRBTreeActive) {
-                    ImGui::PopStyleColor();
-                }
+                sidebarButton(appState, VisualizerId::Array);
+                sidebarButton(appState, VisualizerId::Stack);
+                sidebarButton(appState, VisualizerId::Queue);
+                sidebarButton(appState, VisualizerId::LinkedList);
+                sidebarButton(appState, VisualizerId::UnrolledList);
+                sidebarButton(appState, VisualizerId::BST);
+                sidebarButton(appState, VisualizerId::RedBlackTree);
+                sidebarButton(appState, VisualizerId::BTree);
+                sidebarButton(appState, VisualizerId::Heap);
+                sidebarButton(appState, VisualizerId::HashMap);
+                sidebarButton(appState, VisualizerId::LockFree);
             }
 
             ImGui::Spacing();
 
             // Algorithms Section
             if (ImGui::CollapsingHeader("Algorithms")) {
-                // Sorting Algorithms button
-                bool isSortingActive = appState.currentVisualizer &&
-                                       appState.currentVisualizer->getName() == "Sorting Algorithms";
-                if (isSortingActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Sorting Algorithms", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::SortingVisualizer>();
-                    appState.statusMessage = "Sorting Algorithms selected";
-                }
-                if (isSortingActive) {
-                    ImGui::PopStyleColor();
-                }
-
+                sidebarButton(appState, VisualizerId::Sorting);
                 ImGui::Spacing();
-
-                // Search Algorithms button
-                bool isSearchingActive = appState.currentVisualizer &&
-                                         appState.currentVisualizer->getName() == "Search Algorithms";
-                if (isSearchingActive) {
-                    ImGui::PushStyleColor(ImGuiCol_Button,
-                        dsav::colors::toImGui(dsav::colors::semantic::active));
-                }
-                if (ImGui::Button("Search Algorithms", ImVec2(-1, 0))) {
-                    appState.currentVisualizer = std::make_unique<dsav::SearchingVisualizer>();
-                    appState.statusMessage = "Search Algorithms selected";
-                }
-                if (isSearchingActive) {
-                    ImGui::PopStyleColor();
-                }
+                sidebarButton(appState, VisualizerId::Searching);
+                ImGui::Spacing();
+                sidebarButton(appState, VisualizerId::Complexity);
             }
 
             ImGui::End();
@@ -397,8 +457,10 @@ int main(int argc, char** argv) {
         if (appState.showVisualization) {
             ImGui::Begin("Visualization", &appState.showVisualization);
 
-            if (appState.currentVisualizer) {
-                appState.currentVisualizer->renderVisualization();
+            if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+                DSAV_PROFILE_SCOPE("Render Visualization");
+                exporter->setSource(ImGui::GetCursorScreenPos(), ImGui::GetContentRegionAvail());
+                visualizer->renderVisualization();
             } else {
                 ImGui::TextColored(
                     dsav::colors::toImGui(dsav::colors::semantic::textSecondary),
@@ -412,8 +474,9 @@ int main(int argc, char** argv) {
         // ===== Visualizer Controls =====
 
         // Let the visualizer render its own control panel
-        if (appState.currentVisualizer) {
-            appState.currentVisualizer->renderControls();
+        if (dsav::IVisualizer* visualizer = appState.visualizers.current()) {
+            DSAV_PROFILE_SCOPE("Render Controls");
+            visualizer->renderControls();
         }
 
         // ===== Log Panel =====
@@ -442,9 +505,19 @@ int main(int argc, char** argv) {
             ImGui::ShowDemoWindow(&appState.showDemoWindow);
         }
 
+        // ===== Profiler Overlay =====
+
+        if (appState.showProfiler) {
+            dsav::profiler::renderOverlay(&appState.showProfiler);
+        }
+
         // ===== Rendering =====
 
-        ImGui::Render();
+        {
+            DSAV_PROFILE_SCOPE("ImGui Render");
+            ImGui::Render();
+        }
+        dsav::profiler::captureDrawData(ImGui::GetDrawData());
 
         int display_w, display_h;
         glfwGetFramebufferSize(window, &display_w, &display_h);
@@ -460,27 +533,56 @@ int main(int argc, char** argv) {
         glClear(GL_COLOR_BUFFER_BIT);
 
         // Render ImGui
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        {
+            DSAV_PROFILE_SCOPE("OpenGL Draw");
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
+
+        // Read the canvas back before the swap (asynchronous, lands next frame)
+        {
+            DSAV_PROFILE_SCOPE("Frame Capture");
+            exporter->captureFrame();
+        }
 
         // Update and render additional Platform Windows
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
+            DSAV_PROFILE_SCOPE("Platform Windows");
             GLFWwindow* backup_current_context = glfwGetCurrentContext();
             ImGui::UpdatePlatformWindows();
             ImGui::RenderPlatformWindowsDefault();
             glfwMakeContextCurrent(backup_current_context);
         }
 
-        glfwSwapBuffers(window);
+        {
+            DSAV_PROFILE_SCOPE("Swap Buffers");
+            glfwSwapBuffers(window);
+        }
+
+        // Close the frame: gather every thread's scopes for the overlay
+        dsav::profiler::endFrame();
     }
 
     // ===== 6. Cleanup =====
 
     std::cout << "\nShutting down...\n";
 
+    // Close the trace file properly if a capture is still running
+    dsav::trace::stop();
+
+    // Finish a running export and free its pixel buffers
+    exporter->stop();
+    exporter.reset();
+
+    // Visualizers may own GL objects; release them while the context is alive
+    appState.visualizers.clear();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 
+    // Workers may still finish after the window system is gone
+    dsav::jobs::setCompletionListener(nullptr);
+
     glfwDestroyWindow(window);
     glfwTerminate();
 
@@ -489,6 +591,79 @@ int main(int argc, char** argv) {
     return 0;
 }
 
+// ===== Visualizer Selection =====
+
+/**
+ * @brief Register a factory per sidebar entry (nothing is constructed here)
+ */
+static void registerVisualizers(ApplicationState& appState) {
+    auto& registry = appState.visualizers;
+    registry.add(VisualizerId::Array, "Array", [] { return std::make_unique<dsav::ArrayVisualizer>(); });
+    registry.add(VisualizerId::Stack, "Stack", [] { return std::make_unique<dsav::StackVisualizer>(16); });
+    registry.add(VisualizerId::Queue, "Queue", [] { return std::make_unique<dsav::QueueVisualizer>(8); });
+    registry.add(VisualizerId::LinkedList, "Linked List",
+                 [] { return std::make_unique<dsav::LinkedListVisualizer>(); });
+    registry.add(VisualizerId::UnrolledList, "Unrolled Linked List",
+                 [] { return std::make_unique<dsav::UnrolledListVisualizer>(); });
+    registry.add(VisualizerId::BST, "Binary Search Tree", [] { return std::make_unique<dsav::BSTVisualizer>(); });
+    registry.add(VisualizerId::RedBlackTree, "Red-Black Tree",
+                 [] { return std::make_unique<dsav::RBTreeVisualizer>(); });
+    registry.add(VisualizerId::BTree, "B-Tree", [] { return std::make_unique<dsav::BTreeVisualizer>(); });
+    registry.add(VisualizerId::Heap, "Priority Queue (Heap)",
+                 [] { return std::make_unique<dsav::HeapVisualizer>(); });
+    registry.add(VisualizerId::HashMap, "Hash Map",
+                 [] { return std::make_unique<dsav::HashMapVisualizer>(); });
+    registry.add(VisualizerId::LockFree, "Lock-Free Queues",
+                 [] { return std::make_unique<dsav::ConcurrentQueueVisualizer>(); });
+    registry.add(VisualizerId::Sorting, "Sorting Algorithms",
+                 [] { return std::make_unique<dsav::SortingVisualizer>(); });
+    registry.add(VisualizerId::Searching, "Search Algorithms",
+                 [] { return std::make_unique<dsav::SearchingVisualizer>(); });
+    registry.add(VisualizerId::Complexity, "Complexity Curves",
+                 [] { return std::make_unique<dsav::ComplexityVisualizer>(); });
+}
+
+/**
+ * @brief Full-width sidebar button that selects a visualizer, highlighted while selected
+ */
+static void sidebarButton(ApplicationState& appState, VisualizerId id) {
+    bool isActive = appState.visualizers.isCurrent(id);
+    if (isActive) {
+        ImGui::PushStyleColor(ImGuiCol_Button,
+            dsav::colors::toImGui(dsav::colors::semantic::active));
+    }
+    const char* label = appState.visualizers.label(id);
+    if (ImGui::Button(label, ImVec2(-1, 0))) {
+        bool resumed = !isActive && appState.visualizers.isConstructed(id);
+        appState.visualizers.select(id);
+        appState.statusMessage = std::string(label) + (resumed ? " resumed" : " selected");
+    }
+    if (isActive) {
+        ImGui::PopStyleColor();
+    }
+}
+
+// ===== Frame Scheduling =====
+
+/**
+ * @brief True while the screen changes without input, so frames can't be skipped
+ */
+static bool needsContinuousFrames(const ApplicationState& appState) {
+    // Background jobs drive progress bars; the profiler graphs every frame
+    if (dsav::jobs::pendingCount() > 0 || appState.showProfiler) {
+        return true;
+    }
+    return isVisualizerMoving(appState);
+}
+
+/**
+ * @brief True while the visualization animates or plays back on its own
+ */
+static bool isVisualizerMoving(const ApplicationState& appState) {
+    const dsav::IVisualizer* visualizer = appState.visualizers.current();
+    return visualizer && (visualizer->isAnimating() || !visualizer->isPaused());
+}
+
 // ===== GLFW Callbacks =====
 
 static void glfwErrorCallback(int error, const char* description) {
@@ -5,6 +5,8 @@
 
 #include "visualizers/array_visualizer.hpp"
 #include "ui_components.hpp"
+#include "algorithms/snapshot.hpp"
+#include "algorithms/workload_targets.hpp"
 #include <sstream>
 #include <iomanip>
 #include <random>
@@ -14,20 +16,41 @@ namespace dsav {
 
 ArrayVisualizer::ArrayVisualizer()
     : m_statusText("Array is empty") {
+    m_animator.bindContainer(m_elements);
+
     // Initialize with a few elements for demonstration
     m_array.pushBack(10);
     m_array.pushBack(20);
     m_array.pushBack(30);
     syncVisuals();
+
+    algorithms::WorkloadHooks hooks;
+    hooks.apply = [this](const algorithms::WorkloadOp& op) { return algorithms::applyArrayOp(m_array, op); };
+    hooks.capture = [this](algorithms::WorkloadKeyframe& keyframe) {
+        keyframe.elements.assign(m_array.data(), m_array.data() + m_array.size());
+    };
+    hooks.restore = [this](const algorithms::WorkloadKeyframe& keyframe) {
+        m_array.assign(keyframe.elements.data(), keyframe.elements.size());
+    };
+    m_workload.setHooks(std::move(hooks));
 }
 
 void ArrayVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
 
+    // A playing replay moves on once the last sampled op has finished animating
+    if (m_workload.isPlaying() && !isAnimating()) {
+        if (m_workload.advance([this](const algorithms::WorkloadOp& op) { animateWorkloadOp(op); })) {
+            syncWorkload();
+        }
+    }
+
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_array.isEmpty()) {
+        if (m_workload.replay().isActive()) {
+            m_statusText = m_workload.statusText();
+        } else if (m_array.isEmpty()) {
             m_statusText = "Array is empty";
         } else {
             std::ostringstream oss;
@@ -42,13 +65,6 @@ void ArrayVisualizer::renderVisualization() {
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
     ImVec2 canvasSize = ImGui::GetContentRegionAvail();
 
-    // Draw background
-    drawList->AddRectFilled(
-        canvasPos,
-        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
-        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
-    );
-
     // Calculate total width with zoom applied
     float scaledElementWidth = ELEMENT_WIDTH * m_zoomLevel;
     float scaledElementHeight = ELEMENT_HEIGHT * m_zoomLevel;
@@ -170,44 +186,96 @@ void ArrayVisualizer::renderVisualization() {
         horizontalOffset = minOffset;
     }
 
-    // Draw array elements with zoom applied
-    for (size_t i = 0; i < m_elements.size(); ++i) {
-        VisualElement renderElem = m_elements[i];
-
-        // Apply zoom to position and size
-        float scaledX = m_elements[i].position.x * m_zoomLevel;
-        renderElem.position.x = canvasPos.x + horizontalOffset + scaledX;
-        renderElem.position.y = canvasPos.y + START_Y;
-        renderElem.size = glm::vec2(scaledElementWidth, scaledElementHeight);
-
-        renderElement(drawList, renderElem);
-
-        // Draw index below element
-        std::string indexLabel = "[" + std::to_string(i) + "]";
-        ImVec2 indexSize = ImGui::CalcTextSize(indexLabel.c_str());
-        ImVec2 indexPos = ImVec2(
-            renderElem.position.x + (scaledElementWidth - indexSize.x) / 2.0f,
-            renderElem.position.y + scaledElementHeight + 5.0f
-        );
-        drawList->AddText(
-            indexPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            indexLabel.c_str()
-        );
+    // Visible index range, outlined on the minimap
+    float pitch = (ELEMENT_WIDTH + ELEMENT_SPACING) * m_zoomLevel;
+    m_canvasWidth = canvasSize.x;
+    m_viewFirst = (-horizontalOffset - START_X * m_zoomLevel) / pitch;
+    m_viewLast = (canvasSize.x - horizontalOffset - START_X * m_zoomLevel) / pitch;
+
+    // Elements the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_elements, m_animatedScratch);
+    if (m_animatedScratch != m_animatedElements) {
+        m_animatedElements.swap(m_animatedScratch);
+        m_sceneVersion++;
     }
 
-    // Draw info text
-    if (m_array.isEmpty()) {
-        ImVec2 textPos = ImVec2(
-            canvasPos.x + canvasSize.x / 2.0f - 100.0f,
-            canvasPos.y + canvasSize.y / 2.0f
-        );
-        drawList->AddText(
-            textPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            "Array is empty. Use Insert to add elements."
+    // Draw array elements with zoom applied, skipping those panned off-canvas
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    auto drawElements = [&](bool animated) {
+        for (size_t i = 0; i < m_elements.size(); ++i) {
+            if ((m_animatedElements[i] != 0) != animated) {
+                continue;
+            }
+
+            // Apply zoom to position and size
+            float scaledX = m_elements[i].position.x * m_zoomLevel;
+            ImVec2 elemMin = ImVec2(canvasPos.x + horizontalOffset + scaledX, canvasPos.y + START_Y);
+            ImVec2 elemMax = ImVec2(elemMin.x + scaledElementWidth, elemMin.y + scaledElementHeight);
+            if (!viewport.isRectVisible(elemMin, elemMax)) {
+                continue;
+            }
+
+            VisualElement renderElem = m_elements[i];
+            renderElem.position = glm::vec2(elemMin.x, elemMin.y);
+            renderElem.size = glm::vec2(scaledElementWidth, scaledElementHeight);
+
+            renderElement(drawList, renderElem, ImVec2(0, 0), viewport.detail());
+            if (!viewport.isFullDetail()) {
+                continue;
+            }
+
+            // Draw index below element
+            LabelId indexLabel = labels::fromIndex(i);
+            ImVec2 indexSize = labels::textSize(indexLabel);
+            ImVec2 indexPos = ImVec2(
+                renderElem.position.x + (scaledElementWidth - indexSize.x) / 2.0f,
+                renderElem.position.y + scaledElementHeight + 5.0f
+            );
+            labels::draw(
+                drawList,
+                indexPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                indexLabel
+            );
+        }
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = m_zoomLevel;
+    cacheKey.offsetX = horizontalOffset;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Draw background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
         );
-    } else {
+
+        drawElements(false);
+
+        // Draw info text
+        if (m_array.isEmpty()) {
+            ImVec2 textPos = ImVec2(
+                canvasPos.x + canvasSize.x / 2.0f - 100.0f,
+                canvasPos.y + canvasSize.y / 2.0f
+            );
+            drawList->AddText(
+                textPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "Array is empty. Use Insert to add elements."
+            );
+        }
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating elements on top
+    if (animatedCount > 0) {
+        drawElements(true);
+    }
+
+    if (!m_array.isEmpty()) {
         // Show interaction hints
         std::string hintText = "Drag to pan | Scroll to move | Ctrl+Scroll to zoom";
         if (m_zoomLevel != 1.0f) {
@@ -272,7 +340,7 @@ void ArrayVisualizer::renderControls() {
     ImGui::Spacing();
 
     // Execute button
-    ImGui::BeginDisabled(isAnimating());
+    ImGui::BeginDisabled(isAnimating() || m_workload.isPlaying());
 
     bool canExecute = true;
     std::string buttonLabel = "Execute";
@@ -347,6 +415,23 @@ void ArrayVisualizer::renderControls() {
 
     ImGui::Separator();
 
+    // Minimap: click or drag to center the canvas on that part of the array
+    if (ImGui::CollapsingHeader("Minimap")) {
+        double index = 0.0;
+        if (m_minimap.renderSequence(m_summary, m_viewFirst, m_viewLast, index)) {
+            centerOn(index);
+        }
+    }
+
+    // Workload replay: insert appends, remove deletes the first match, search scans
+    if (ImGui::CollapsingHeader("Workload Replay")) {
+        if (m_workload.render()) {
+            syncWorkload();
+        }
+    }
+
+    ImGui::Separator();
+
     // Playback controls
     ui::PlaybackControls(
         m_isPaused,
@@ -548,7 +633,7 @@ void ArrayVisualizer::updateValue(size_t index, int value) {
             m_array.update(index, value);
             // Update the visual label
             if (index < m_elements.size()) {
-                m_elements[index].label = std::to_string(value);
+                m_elements[index].label = labels::fromInt(value);
             }
 
             std::ostringstream oss;
@@ -564,6 +649,7 @@ void ArrayVisualizer::updateValue(size_t index, int value) {
 
 void ArrayVisualizer::initializeRandomArray(size_t count) {
     // Clear existing array
+    m_workload.stop();
     m_array.clear();
     m_animator.clear();
 
@@ -622,6 +708,7 @@ void ArrayVisualizer::step() {
 }
 
 void ArrayVisualizer::reset() {
+    m_workload.stop();
     m_array.clear();
     m_elements.clear();
     m_animator.clear();
@@ -636,6 +723,83 @@ void ArrayVisualizer::reset() {
     m_isPaused = true;
 }
 
+bool ArrayVisualizer::saveSnapshot(const std::string& path) {
+    std::string error;
+    if (!algorithms::writeSnapshot(path, algorithms::SnapshotKind::DynamicArray, m_array.data(), m_array.size(),
+                                   nullptr, error)) {
+        m_statusText = "Save failed: " + error;
+        return false;
+    }
+    m_statusText = "Saved " + std::to_string(m_array.size()) + " elements to " + path;
+    return true;
+}
+
+bool ArrayVisualizer::loadSnapshot(const std::string& path) {
+    algorithms::SnapshotReader reader;
+    std::vector<int> values;
+    if (!reader.open(path) || !reader.expect(algorithms::SnapshotKind::DynamicArray)) {
+        m_statusText = "Load failed: " + reader.error();
+        return false;
+    }
+    reader.readElements(values);
+
+    m_workload.stop();
+    m_animator.clear();
+    m_elements.clear();
+    m_array.assign(values.data(), values.size());
+    syncVisuals();
+
+    m_cameraOffsetX = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Loaded " + std::to_string(m_array.size()) + " elements from " + path;
+    m_isPaused = true;
+    return true;
+}
+
+bool ArrayVisualizer::stepBack() {
+    size_t position = m_workload.replay().position();
+    return position > 0 && seek(position - 1);
+}
+
+bool ArrayVisualizer::seek(size_t step) {
+    if (!m_workload.seek(step)) {
+        return false;
+    }
+    syncWorkload();
+    m_statusText = m_workload.statusText();
+    return true;
+}
+
+void ArrayVisualizer::animateWorkloadOp(const algorithms::WorkloadOp& op) {
+    switch (op.code) {
+        case algorithms::WorkloadOpCode::Insert:
+            insertValue(m_array.size(), op.operand);
+            break;
+        case algorithms::WorkloadOpCode::Remove:
+            if (auto index = m_array.find(op.operand)) {
+                deleteValue(*index);
+            } else {
+                m_statusText = "Value " + std::to_string(op.operand) + " not found in array";
+            }
+            break;
+        case algorithms::WorkloadOpCode::Search:
+            // A scan of a long array would animate one element at a time; jump to the match instead
+            if (m_array.size() <= MAX_SCAN_ANIMATION) {
+                searchValue(op.operand);
+            } else if (auto index = m_array.find(op.operand)) {
+                accessValue(*index);
+            } else {
+                m_statusText = "Value " + std::to_string(op.operand) + " not found in array";
+            }
+            break;
+    }
+}
+
+void ArrayVisualizer::syncWorkload() {
+    m_animator.clear();
+    syncVisuals();
+}
+
 void ArrayVisualizer::setSpeed(float speed) {
     m_speed = speed;
     m_animator.setSpeedMultiplier(speed);
@@ -654,21 +818,37 @@ bool ArrayVisualizer::isPaused() const {
 }
 
 void ArrayVisualizer::syncVisuals() {
+    m_sceneVersion++;
     m_elements.clear();
 
+    // Only the buckets between the unchanged prefix and suffix are recomputed
+    std::vector<int> values(m_array.data(), m_array.data() + m_array.size());
+    m_summary.updateFrom(m_summaryValues, values);
+    m_summaryValues.swap(values);
+
     for (size_t i = 0; i < m_array.size(); ++i) {
         VisualElement elem;
         elem.position = calculatePosition(i);
         elem.size = glm::vec2(ELEMENT_WIDTH, ELEMENT_HEIGHT);
         elem.color = colors::semantic::elementBase;
         elem.borderColor = colors::semantic::elementBorder;
-        elem.label = std::to_string(m_array[i]);
-        elem.sublabel = "";
+        elem.label = labels::fromInt(m_array[i]);
 
         m_elements.push_back(elem);
     }
 }
 
+void ArrayVisualizer::centerOn(double index) {
+    float pitch = (ELEMENT_WIDTH + ELEMENT_SPACING) * m_zoomLevel;
+    float totalWidth = m_elements.empty() ? 0.0f
+        : m_elements.size() * pitch - ELEMENT_SPACING * m_zoomLevel;
+    float baseOffset = std::max(20.0f, (m_canvasWidth - totalWidth) / 2.0f);
+
+    // renderVisualization() clamps this to the array's extent
+    float x = (START_X + static_cast<float>(index) * (ELEMENT_WIDTH + ELEMENT_SPACING)) * m_zoomLevel;
+    m_cameraOffsetX = m_canvasWidth / 2.0f - x - baseOffset;
+}
+
 glm::vec2 ArrayVisualizer::calculatePosition(size_t index) const {
     // Elements arranged horizontally
     float x = START_X + index * (ELEMENT_WIDTH + ELEMENT_SPACING);
@@ -15,29 +15,47 @@
 namespace dsav {
 
 BSTVisualizer::BSTVisualizer()
-    : m_statusText("Binary Search Tree is empty") {
+    : BSTVisualizer(std::make_unique<CppTreeBackend>()) {
+}
+
+BSTVisualizer::BSTVisualizer(std::unique_ptr<TreeBackend> tree)
+    : m_tree(std::move(tree)),
+      m_layout(HORIZONTAL_SPACING, VERTICAL_SPACING),
+      m_statusText("Binary Search Tree is empty") {
+    m_layout.setOrigin(glm::vec2(START_X, START_Y));
+    m_density.reset(START_X, HORIZONTAL_SPACING);
+    m_animator.bindContainer(m_visualNodes);
+
     // Initialize with a balanced tree for demonstration
-    m_bst.insert(50);
-    m_bst.insert(30);
-    m_bst.insert(70);
-    m_bst.insert(20);
-    m_bst.insert(40);
-    m_bst.insert(60);
-    m_bst.insert(80);
+    m_tree->insert(50);
+    m_tree->insert(30);
+    m_tree->insert(70);
+    m_tree->insert(20);
+    m_tree->insert(40);
+    m_tree->insert(60);
+    m_tree->insert(80);
     syncVisuals();
 }
 
+BSTVisualizer::~BSTVisualizer() {
+    // The pending completion captures this; cancelling drops it
+    if (m_bulkJob) m_bulkJob->cancel();
+}
+
 void BSTVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
 
+    // Continue a pending bulk insert within this frame's budget
+    drainPendingInserts();
+
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_bst.isEmpty()) {
+        if (m_tree->isEmpty()) {
             m_statusText = "Binary Search Tree is empty";
         } else {
             std::ostringstream oss;
-            oss << "Tree has " << m_bst.size() << " node(s), Height: " << m_bst.height();
+            oss << "Tree has " << m_tree->size() << " node(s), Height: " << m_tree->height();
             m_statusText = oss.str();
         }
     }
@@ -47,13 +65,7 @@ void BSTVisualizer::renderVisualization() {
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
     ImVec2 canvasSize = ImGui::GetContentRegionAvail();
-
-    // Draw background
-    drawList->AddRectFilled(
-        canvasPos,
-        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
-        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
-    );
+    m_canvasSize = canvasSize;
 
     // Calculate smaller hitbox (with padding on all sides)
     const float padding = 20.0f;
@@ -108,68 +120,33 @@ void BSTVisualizer::renderVisualization() {
         }
     }
 
+    // Center once on a node picked by select, so panning still works afterwards
+    if (m_jumpTarget != NULL_NODE) {
+        if (m_tree->isLive(m_jumpTarget)) {
+            const glm::vec2& world = m_visualNodes[m_jumpTarget].position;
+            m_cameraOffsetX = canvasSize.x * 0.5f - world.x * m_zoomLevel;
+            m_cameraOffsetY = canvasSize.y * 0.5f - world.y * m_zoomLevel;
+        }
+        m_jumpTarget = NULL_NODE;
+    }
+
     // Apply camera offset
     float horizontalOffset = m_cameraOffsetX;
     float verticalOffset = m_cameraOffsetY;
 
-    // Draw connections first (so they appear behind nodes)
-    auto root = m_bst.root();
-    if (root) {
-        std::function<void(std::shared_ptr<TreeNode<int>>)> drawConnections;
-        drawConnections = [&](std::shared_ptr<TreeNode<int>> node) {
-            if (!node) return;
-
-            auto parentIt = m_nodePositions.find(node->data);
-            if (parentIt == m_nodePositions.end()) return;
-
-            // Apply zoom and camera offset to parent position
-            float scaledParentX = parentIt->second.x * m_zoomLevel;
-            float scaledParentY = parentIt->second.y * m_zoomLevel;
-            ImVec2 parentPos = ImVec2(
-                canvasPos.x + scaledParentX + horizontalOffset,
-                canvasPos.y + scaledParentY + verticalOffset
-            );
+    // Everything outside the canvas is culled; zoomed out drops labels
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    ImU32 connectionColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0));
 
-            // Draw connection to left child
-            if (node->left) {
-                auto leftIt = m_nodePositions.find(node->left->data);
-                if (leftIt != m_nodePositions.end()) {
-                    float scaledLeftX = leftIt->second.x * m_zoomLevel;
-                    float scaledLeftY = leftIt->second.y * m_zoomLevel;
-                    ImVec2 leftPos = ImVec2(
-                        canvasPos.x + scaledLeftX + horizontalOffset,
-                        canvasPos.y + scaledLeftY + verticalOffset
-                    );
-                    drawConnection(drawList, parentPos, leftPos,
-                                 ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)));
-                }
-            }
-
-            // Draw connection to right child
-            if (node->right) {
-                auto rightIt = m_nodePositions.find(node->right->data);
-                if (rightIt != m_nodePositions.end()) {
-                    float scaledRightX = rightIt->second.x * m_zoomLevel;
-                    float scaledRightY = rightIt->second.y * m_zoomLevel;
-                    ImVec2 rightPos = ImVec2(
-                        canvasPos.x + scaledRightX + horizontalOffset,
-                        canvasPos.y + scaledRightY + verticalOffset
-                    );
-                    drawConnection(drawList, parentPos, rightPos,
-                                 ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)));
-                }
-            }
-
-            drawConnections(node->left);
-            drawConnections(node->right);
-        };
-
-        drawConnections(root);
+    // Nodes the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_visualNodes, m_animatedScratch);
+    if (m_animatedScratch != m_animatedNodes) {
+        m_animatedNodes.swap(m_animatedScratch);
+        m_sceneVersion++;
     }
 
-    // Draw nodes
     float scaledRadius = NODE_RADIUS * m_zoomLevel;
-    for (const auto& vnode : m_visualNodes) {
+    auto drawNode = [&](const VisualTreeNode& vnode) {
         // Apply zoom and camera offset to node position
         float scaledX = vnode.position.x * m_zoomLevel;
         float scaledY = vnode.position.y * m_zoomLevel;
@@ -177,12 +154,14 @@ void BSTVisualizer::renderVisualization() {
             canvasPos.x + scaledX + horizontalOffset,
             canvasPos.y + scaledY + verticalOffset
         );
+        if (!viewport.isCircleVisible(center, scaledRadius)) return;
 
         // Draw circle
         drawList->AddCircleFilled(
             center,
             scaledRadius,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.color))
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.color)),
+            viewport.circleSegments()
         );
 
         // Draw border
@@ -190,34 +169,90 @@ void BSTVisualizer::renderVisualization() {
             center,
             scaledRadius,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.borderColor)),
-            0,
+            viewport.circleSegments(),
             2.0f
         );
 
+        if (!viewport.isFullDetail()) return;
+
         // Draw label (centered)
-        ImVec2 textSize = ImGui::CalcTextSize(vnode.label.c_str());
-        ImVec2 textPos = ImVec2(
-            center.x - textSize.x / 2.0f,
-            center.y - textSize.y / 2.0f
-        );
-        drawList->AddText(
-            textPos,
+        labels::drawCentered(
+            drawList,
+            center,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::text)),
-            vnode.label.c_str()
+            vnode.label
         );
-    }
+    };
 
-    // Draw info text if empty
-    if (m_bst.isEmpty()) {
-        ImVec2 textPos = ImVec2(
-            canvasPos.x + canvasSize.x / 2.0f - 120.0f,
-            canvasPos.y + canvasSize.y / 2.0f
-        );
-        drawList->AddText(
-            textPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            "BST is empty. Use Insert to add nodes."
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = m_zoomLevel;
+    cacheKey.offsetX = horizontalOffset;
+    cacheKey.offsetY = verticalOffset;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Draw background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
         );
+
+        // Draw connections first (so they appear behind nodes)
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (!m_visualNodes[id].active) continue;
+            TreeNodeLinks node = m_tree->node(id);
+
+            // Apply zoom and camera offset to parent position
+            const glm::vec2& parentWorld = m_visualNodes[id].position;
+            ImVec2 parentPos = ImVec2(
+                canvasPos.x + parentWorld.x * m_zoomLevel + horizontalOffset,
+                canvasPos.y + parentWorld.y * m_zoomLevel + verticalOffset
+            );
+
+            for (NodeIndex child : {node.left, node.right}) {
+                if (child == NULL_NODE) continue;
+
+                const glm::vec2& childWorld = m_visualNodes[child].position;
+                ImVec2 childPos = ImVec2(
+                    canvasPos.x + childWorld.x * m_zoomLevel + horizontalOffset,
+                    canvasPos.y + childWorld.y * m_zoomLevel + verticalOffset
+                );
+                if (viewport.isSegmentVisible(parentPos, childPos)) {
+                    drawConnection(drawList, parentPos, childPos, connectionColor);
+                }
+            }
+        }
+
+        // Draw resting nodes
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (m_visualNodes[id].active && !m_animatedNodes[id]) {
+                drawNode(m_visualNodes[id]);
+            }
+        }
+
+        // Draw info text if empty
+        if (m_tree->isEmpty()) {
+            ImVec2 textPos = ImVec2(
+                canvasPos.x + canvasSize.x / 2.0f - 120.0f,
+                canvasPos.y + canvasSize.y / 2.0f
+            );
+            drawList->AddText(
+                textPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "BST is empty. Use Insert to add nodes."
+            );
+        }
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating nodes on top
+    if (animatedCount > 0) {
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (m_visualNodes[id].active && m_animatedNodes[id]) {
+                drawNode(m_visualNodes[id]);
+            }
+        }
     }
 
     // Draw hint text at bottom showing controls and zoom level
@@ -245,11 +280,16 @@ void BSTVisualizer::renderControls() {
         "Insert",
         "Delete",
         "Search",
+        "Select k-th Smallest",
+        "Percentile",
+        "Count in Range",
         "Traverse: Inorder",
         "Traverse: Preorder",
         "Traverse: Postorder",
         "Traverse: Level-order",
-        "Initialize Random"
+        "Initialize Random",
+        "Load Random Keys",
+        "Import Dataset"
     };
     int currentModeIdx = static_cast<int>(m_currentMode);
     if (ImGui::Combo("##Mode", &currentModeIdx, modes, IM_ARRAYSIZE(modes))) {
@@ -268,11 +308,41 @@ void BSTVisualizer::renderControls() {
         m_currentMode == OperationMode::Search) {
         ImGui::InputInt("Value", &m_inputValue);
     }
+    // Rank input (for Select k-th)
+    else if (m_currentMode == OperationMode::SelectKth) {
+        ImGui::InputInt("k (1 = smallest)", &m_selectRank);
+        m_selectRank = std::clamp(m_selectRank, 1, std::max(1, static_cast<int>(m_tree->size())));
+    }
+    // Percentile (for Percentile)
+    else if (m_currentMode == OperationMode::Percentile) {
+        ImGui::SliderFloat("Percentile", &m_percentile, 0.0f, 100.0f, "%.1f");
+    }
+    // Bounds (for Count in Range)
+    else if (m_currentMode == OperationMode::CountRange) {
+        ImGui::InputInt("Low", &m_rangeLow);
+        ImGui::InputInt("High", &m_rangeHigh);
+    }
     // Count input (for Initialize)
     else if (m_currentMode == OperationMode::Initialize) {
         ImGui::InputInt("Count (1-20)", &m_initCount);
         m_initCount = std::clamp(m_initCount, 1, 20);
     }
+    // Key count (for bulk load)
+    else if (m_currentMode == OperationMode::LoadRandomKeys) {
+        ImGui::SliderInt("Keys", &m_bulkCount, 1, MAX_BULK_KEYS, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::Checkbox("Keep existing keys", &m_bulkKeepExisting);
+        ui::Tooltip("Batch-insert into the current tree instead of replacing it");
+        if (m_bulkJob) {
+            ImGui::Text("Loading keys...");
+        }
+    }
+    // File (for dataset import)
+    else if (m_currentMode == OperationMode::ImportDataset) {
+        m_importPanel.render();
+        if (m_bulkJob) {
+            ImGui::Text("Loading keys...");
+        }
+    }
 
     ImGui::PopItemWidth();
 
@@ -293,37 +363,61 @@ void BSTVisualizer::renderControls() {
         case OperationMode::Delete:
             buttonLabel = "Delete";
             tooltipText = "Delete value from BST";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::Search:
             buttonLabel = "Search";
             tooltipText = "Search for value in BST";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
+            break;
+        case OperationMode::SelectKth:
+            buttonLabel = "Select";
+            tooltipText = "Walk down by subtree sizes to the k-th smallest key (O(height))";
+            canExecute = !m_tree->isEmpty();
+            break;
+        case OperationMode::Percentile:
+            buttonLabel = "Select Percentile";
+            tooltipText = "Nearest-rank percentile: select(ceil(p / 100 * n) - 1)";
+            canExecute = !m_tree->isEmpty();
+            break;
+        case OperationMode::CountRange:
+            buttonLabel = "Count";
+            tooltipText = "Count keys in [Low, High] from two rank queries (O(height))";
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::TraverseInorder:
             buttonLabel = "Traverse Inorder";
             tooltipText = "Inorder traversal (Left-Root-Right)";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::TraversePreorder:
             buttonLabel = "Traverse Preorder";
             tooltipText = "Preorder traversal (Root-Left-Right)";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::TraversePostorder:
             buttonLabel = "Traverse Postorder";
             tooltipText = "Postorder traversal (Left-Right-Root)";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::TraverseLevelOrder:
             buttonLabel = "Traverse Level-order";
             tooltipText = "Level-order traversal (Breadth-first)";
-            canExecute = !m_bst.isEmpty();
+            canExecute = !m_tree->isEmpty();
             break;
         case OperationMode::Initialize:
             buttonLabel = "Initialize Random";
             tooltipText = "Create BST with random values";
             break;
+        case OperationMode::LoadRandomKeys:
+            buttonLabel = "Load Random Keys";
+            tooltipText = "Bulk-load random keys in one pass (no per-insert animation)";
+            break;
+        case OperationMode::ImportDataset:
+            buttonLabel = "Import";
+            tooltipText = "Replace the tree with a balanced bulk load of the file's keys";
+            canExecute = m_importPanel.hasPath();
+            break;
     }
 
     if (!canExecute) {
@@ -341,6 +435,15 @@ void BSTVisualizer::renderControls() {
             case OperationMode::Search:
                 searchValue(m_inputValue);
                 break;
+            case OperationMode::SelectKth:
+                selectKth(static_cast<size_t>(m_selectRank - 1));
+                break;
+            case OperationMode::Percentile:
+                selectPercentile(m_percentile);
+                break;
+            case OperationMode::CountRange:
+                countRange(m_rangeLow, m_rangeHigh);
+                break;
             case OperationMode::TraverseInorder:
                 traverseInorder();
                 break;
@@ -356,6 +459,12 @@ void BSTVisualizer::renderControls() {
             case OperationMode::Initialize:
                 initializeRandom(m_initCount);
                 break;
+            case OperationMode::LoadRandomKeys:
+                loadRandomKeys(static_cast<size_t>(m_bulkCount));
+                break;
+            case OperationMode::ImportDataset:
+                importDataset(m_importPanel.path(), m_importPanel.format());
+                break;
         }
     }
 
@@ -368,6 +477,8 @@ void BSTVisualizer::renderControls() {
 
     ImGui::Separator();
 
+    renderMinimap();
+
     // Playback controls
     ui::PlaybackControls(
         m_isPaused,
@@ -384,9 +495,9 @@ void BSTVisualizer::renderControls() {
 
     // Tree info
     ImGui::Text("Tree Info:");
-    ImGui::Text("Nodes: %zu", m_bst.size());
-    if (!m_bst.isEmpty()) {
-        ImGui::Text("Height: %d", m_bst.height());
+    ImGui::Text("Nodes: %zu", m_tree->size());
+    if (!m_tree->isEmpty()) {
+        ImGui::Text("Height: %d", m_tree->height());
     }
 
     ImGui::End();
@@ -399,44 +510,41 @@ void BSTVisualizer::insertValue(int value) {
     m_statusText = oss.str();
 
     // Insert into actual BST
-    m_bst.insert(value);
+    m_tree->insert(value);
 
     // Recreate visuals
     syncVisuals();
 
     // Animate: find and highlight the new node
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.value == value) {
-            Animation flashGreen = createColorAnimation(
-                vnode.color,
-                colors::semantic::sorted,
-                0.3f
-            );
-            m_animator.enqueue(flashGreen);
+    if (VisualTreeNode* vnode = findVisual(value)) {
+        Animation flashGreen = createColorAnimation(
+            vnode->color,
+            colors::semantic::sorted,
+            0.3f
+        );
+        m_animator.enqueue(flashGreen);
 
-            Animation flashBack = createColorAnimation(
-                vnode.color,
-                colors::semantic::elementBase,
-                0.3f
-            );
-            flashBack.onComplete = [this, value]() {
-                std::ostringstream oss;
-                oss << "Inserted " << value;
-                m_statusText = oss.str();
-            };
-            m_animator.enqueue(flashBack);
-            break;
-        }
+        Animation flashBack = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
+        flashBack.onComplete = [this, value]() {
+            std::ostringstream oss;
+            oss << "Inserted " << value;
+            m_statusText = oss.str();
+        };
+        m_animator.enqueue(flashBack);
     }
 }
 
 void BSTVisualizer::deleteValue(int value) {
-    if (m_bst.isEmpty()) {
+    if (m_tree->isEmpty()) {
         m_statusText = "Error: Tree is empty!";
         return;
     }
 
-    if (!m_bst.search(value)) {
+    if (!m_tree->contains(value)) {
         std::ostringstream oss;
         oss << "Value " << value << " not found in tree";
         m_statusText = oss.str();
@@ -449,26 +557,23 @@ void BSTVisualizer::deleteValue(int value) {
     m_statusText = oss.str();
 
     // Find and animate the node before deleting
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.value == value) {
-            Animation flashRed = createColorAnimation(vnode.color, colors::semantic::error, 0.3f);
-            flashRed.onComplete = [this, value]() {
-                // Actually delete from tree
-                m_bst.remove(value);
-                syncVisuals();
+    if (VisualTreeNode* vnode = findVisual(value)) {
+        Animation flashRed = createColorAnimation(vnode->color, colors::semantic::error, 0.3f);
+        flashRed.onComplete = [this, value]() {
+            // Actually delete from tree
+            m_tree->remove(value);
+            syncVisuals();
 
-                std::ostringstream oss;
-                oss << "Deleted " << value;
-                m_statusText = oss.str();
-            };
-            m_animator.enqueue(flashRed);
-            break;
-        }
+            std::ostringstream oss;
+            oss << "Deleted " << value;
+            m_statusText = oss.str();
+        };
+        m_animator.enqueue(flashRed);
     }
 }
 
 void BSTVisualizer::searchValue(int value) {
-    if (m_bst.isEmpty()) {
+    if (m_tree->isEmpty()) {
         m_statusText = "Error: Tree is empty!";
         return;
     }
@@ -478,63 +583,57 @@ void BSTVisualizer::searchValue(int value) {
     oss << "Searching for " << value << "...";
     m_statusText = oss.str();
 
+    size_t rank = m_tree->rank(value);
+
     // Traverse from root following BST property
-    auto current = m_bst.root();
+    NodeIndex current = m_tree->root();
     bool found = false;
 
-    while (current) {
-        // Find visual node
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == current->data) {
-                if (current->data == value) {
-                    // Found!
-                    Animation highlightFound = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::sorted,
-                        0.3f
-                    );
-                    highlightFound.onComplete = [this, value]() {
-                        std::ostringstream oss;
-                        oss << "Found " << value << " in tree";
-                        m_statusText = oss.str();
-                    };
-                    m_animator.enqueue(highlightFound);
-
-                    Animation restore = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::elementBase,
-                        0.3f
-                    );
-                    m_animator.enqueue(restore);
-                    found = true;
-                } else {
-                    // Checking this node
-                    Animation checking = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::comparing,
-                        0.2f
-                    );
-                    m_animator.enqueue(checking);
-
-                    Animation restore = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::elementBase,
-                        0.2f
-                    );
-                    m_animator.enqueue(restore);
-                }
-                break;
-            }
+    while (current != NULL_NODE) {
+        VisualTreeNode& vnode = m_visualNodes[current];
+        TreeNodeLinks node = m_tree->node(current);
+        if (node.key == value) {
+            // Found!
+            Animation highlightFound = createColorAnimation(
+                vnode.color,
+                colors::semantic::sorted,
+                0.3f
+            );
+            highlightFound.onComplete = [this, value, rank]() {
+                std::ostringstream oss;
+                oss << "Found " << value << " in tree (rank " << rank + 1 << " of " << m_tree->size() << ")";
+                m_statusText = oss.str();
+            };
+            m_animator.enqueue(highlightFound);
+
+            Animation restore = createColorAnimation(
+                vnode.color,
+                colors::semantic::elementBase,
+                0.3f
+            );
+            m_animator.enqueue(restore);
+            found = true;
+        } else {
+            // Checking this node
+            Animation checking = createColorAnimation(
+                vnode.color,
+                colors::semantic::comparing,
+                0.2f
+            );
+            m_animator.enqueue(checking);
+
+            Animation restore = createColorAnimation(
+                vnode.color,
+                colors::semantic::elementBase,
+                0.2f
+            );
+            m_animator.enqueue(restore);
         }
 
         if (found) break;
 
         // Move to next node
-        if (value < current->data) {
-            current = current->left;
-        } else {
-            current = current->right;
-        }
+        current = value < node.key ? node.left : node.right;
     }
 
     if (!found) {
@@ -554,32 +653,29 @@ void BSTVisualizer::traverseInorder() {
     m_statusText = "Inorder traversal: Left-Root-Right";
 
     for (size_t i = 0; i < order.size(); ++i) {
-        int value = order[i];
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == value) {
-                Animation highlight = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::highlight,
-                    0.3f
-                );
-                m_animator.enqueue(highlight);
+        VisualTreeNode* vnode = findVisual(order[i]);
+        if (!vnode) continue;
 
-                Animation restore = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::elementBase,
-                    0.3f
-                );
+        Animation highlight = createColorAnimation(
+            vnode->color,
+            colors::semantic::highlight,
+            0.3f
+        );
+        m_animator.enqueue(highlight);
 
-                if (i == order.size() - 1) {
-                    restore.onComplete = [this]() {
-                        m_statusText = "Inorder traversal complete";
-                    };
-                }
+        Animation restore = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
 
-                m_animator.enqueue(restore);
-                break;
-            }
+        if (i == order.size() - 1) {
+            restore.onComplete = [this]() {
+                m_statusText = "Inorder traversal complete";
+            };
         }
+
+        m_animator.enqueue(restore);
     }
 }
 
@@ -589,32 +685,29 @@ void BSTVisualizer::traversePreorder() {
     m_statusText = "Preorder traversal: Root-Left-Right";
 
     for (size_t i = 0; i < order.size(); ++i) {
-        int value = order[i];
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == value) {
-                Animation highlight = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::highlight,
-                    0.3f
-                );
-                m_animator.enqueue(highlight);
+        VisualTreeNode* vnode = findVisual(order[i]);
+        if (!vnode) continue;
 
-                Animation restore = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::elementBase,
-                    0.3f
-                );
+        Animation highlight = createColorAnimation(
+            vnode->color,
+            colors::semantic::highlight,
+            0.3f
+        );
+        m_animator.enqueue(highlight);
 
-                if (i == order.size() - 1) {
-                    restore.onComplete = [this]() {
-                        m_statusText = "Preorder traversal complete";
-                    };
-                }
+        Animation restore = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
 
-                m_animator.enqueue(restore);
-                break;
-            }
+        if (i == order.size() - 1) {
+            restore.onComplete = [this]() {
+                m_statusText = "Preorder traversal complete";
+            };
         }
+
+        m_animator.enqueue(restore);
     }
 }
 
@@ -624,68 +717,143 @@ void BSTVisualizer::traversePostorder() {
     m_statusText = "Postorder traversal: Left-Right-Root";
 
     for (size_t i = 0; i < order.size(); ++i) {
-        int value = order[i];
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == value) {
-                Animation highlight = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::highlight,
-                    0.3f
-                );
-                m_animator.enqueue(highlight);
+        VisualTreeNode* vnode = findVisual(order[i]);
+        if (!vnode) continue;
 
-                Animation restore = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::elementBase,
-                    0.3f
-                );
+        Animation highlight = createColorAnimation(
+            vnode->color,
+            colors::semantic::highlight,
+            0.3f
+        );
+        m_animator.enqueue(highlight);
 
-                if (i == order.size() - 1) {
-                    restore.onComplete = [this]() {
-                        m_statusText = "Postorder traversal complete";
-                    };
-                }
+        Animation restore = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
 
-                m_animator.enqueue(restore);
-                break;
-            }
+        if (i == order.size() - 1) {
+            restore.onComplete = [this]() {
+                m_statusText = "Postorder traversal complete";
+            };
         }
+
+        m_animator.enqueue(restore);
     }
 }
 
 void BSTVisualizer::traverseLevelOrder() {
-    auto order = m_bst.levelOrderTraversal();
+    auto order = collectTraversalOrder("levelorder");
 
     m_statusText = "Level-order traversal: Breadth-first";
 
     for (size_t i = 0; i < order.size(); ++i) {
-        int value = order[i];
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == value) {
-                Animation highlight = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::highlight,
-                    0.3f
-                );
-                m_animator.enqueue(highlight);
+        VisualTreeNode* vnode = findVisual(order[i]);
+        if (!vnode) continue;
 
-                Animation restore = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::elementBase,
-                    0.3f
-                );
+        Animation highlight = createColorAnimation(
+            vnode->color,
+            colors::semantic::highlight,
+            0.3f
+        );
+        m_animator.enqueue(highlight);
 
-                if (i == order.size() - 1) {
-                    restore.onComplete = [this]() {
-                        m_statusText = "Level-order traversal complete";
-                    };
-                }
+        Animation restore = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
 
-                m_animator.enqueue(restore);
-                break;
-            }
+        if (i == order.size() - 1) {
+            restore.onComplete = [this]() {
+                m_statusText = "Level-order traversal complete";
+            };
         }
+
+        m_animator.enqueue(restore);
+    }
+}
+
+void BSTVisualizer::selectKth(size_t k) {
+    NodeIndex node = m_tree->select(k);
+    if (node == NULL_NODE) {
+        m_statusText = "Error: rank is out of range";
+        return;
     }
+
+    std::ostringstream oss;
+    oss << "Rank " << k + 1 << " of " << m_tree->size() << " is " << m_tree->node(node).key;
+    m_statusText = "Selecting rank " + std::to_string(k + 1) + "...";
+    animateSelection(node, oss.str());
+}
+
+void BSTVisualizer::selectPercentile(float percent) {
+    if (m_tree->isEmpty()) {
+        m_statusText = "Error: Tree is empty!";
+        return;
+    }
+
+    // Nearest rank: the smallest key with at least percent% of the keys at or below it
+    size_t n = m_tree->size();
+    auto rank = static_cast<size_t>(std::ceil(static_cast<double>(percent) / 100.0 * static_cast<double>(n)));
+    size_t k = std::clamp<size_t>(rank, 1, n) - 1;
+    NodeIndex node = m_tree->select(k);
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << "P" << percent << " = " << m_tree->node(node).key
+        << " (rank " << k + 1 << " of " << n << ")";
+    m_statusText = "Selecting rank " + std::to_string(k + 1) + "...";
+    animateSelection(node, oss.str());
+}
+
+void BSTVisualizer::countRange(int low, int high) {
+    if (low > high) std::swap(low, high);
+
+    size_t count = m_tree->countInRange(low, high);
+    std::ostringstream oss;
+    oss << count << " keys in [" << low << ", " << high << "]";
+    if (count == 0) {
+        m_statusText = oss.str();
+        return;
+    }
+
+    size_t first = m_tree->rank(low);
+    NodeIndex firstNode = m_tree->select(first);
+    NodeIndex lastNode = m_tree->select(first + count - 1);
+    oss << ": ranks " << first + 1 << " to " << first + count
+        << " (" << m_tree->node(firstNode).key << " .. " << m_tree->node(lastNode).key << ")";
+    m_statusText = "Counting keys in range...";
+
+    if (count > 1) animateSelection(lastNode, oss.str());
+    animateSelection(firstNode, oss.str());
+}
+
+void BSTVisualizer::animateSelection(NodeIndex id, const std::string& status) {
+    // Root-to-node path: descend by key (backends need not keep parent links)
+    int key = m_tree->node(id).key;
+    std::vector<NodeIndex> path;
+    for (NodeIndex current = m_tree->root(); current != NULL_NODE;) {
+        path.push_back(current);
+        if (current == id) break;
+        TreeNodeLinks node = m_tree->node(current);
+        current = key < node.key ? node.left : node.right;
+    }
+
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        VisualTreeNode& vnode = m_visualNodes[path[i]];
+        m_animator.enqueue(createColorAnimation(vnode.color, colors::semantic::comparing, 0.2f));
+        m_animator.enqueue(createColorAnimation(vnode.color, colors::semantic::elementBase, 0.2f));
+    }
+
+    VisualTreeNode& target = m_visualNodes[id];
+    Animation highlight = createColorAnimation(target.color, colors::semantic::sorted, 0.3f);
+    highlight.onComplete = [this, status]() {
+        m_statusText = status;
+    };
+    m_animator.enqueue(highlight);
+    m_animator.enqueue(createColorAnimation(target.color, colors::semantic::elementBase, 0.3f));
+    m_jumpTarget = id;
 }
 
 void BSTVisualizer::play() {
@@ -704,19 +872,24 @@ void BSTVisualizer::step() {
 }
 
 void BSTVisualizer::reset() {
-    m_bst.clear();
-    m_visualNodes.clear();
-    m_nodePositions.clear();
+    if (m_bulkJob) {
+        m_bulkJob->cancel();
+        m_bulkJob.reset();
+    }
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_tree->clear();
+    clearVisuals();
     m_animator.clear();
 
     // Add initial balanced tree
-    m_bst.insert(50);
-    m_bst.insert(30);
-    m_bst.insert(70);
-    m_bst.insert(20);
-    m_bst.insert(40);
-    m_bst.insert(60);
-    m_bst.insert(80);
+    m_tree->insert(50);
+    m_tree->insert(30);
+    m_tree->insert(70);
+    m_tree->insert(20);
+    m_tree->insert(40);
+    m_tree->insert(60);
+    m_tree->insert(80);
     syncVisuals();
 
     m_statusText = "Tree reset";
@@ -733,51 +906,96 @@ std::string BSTVisualizer::getStatusText() const {
 }
 
 bool BSTVisualizer::isAnimating() const {
-    return m_animator.hasAnimations();
+    return m_animator.hasAnimations() || m_pendingInsertPos < m_pendingInserts.size();
 }
 
 bool BSTVisualizer::isPaused() const {
     return m_isPaused;
 }
 
-void BSTVisualizer::syncVisuals() {
+void BSTVisualizer::clearVisuals() {
+    m_sceneVersion++;
     m_visualNodes.clear();
-    m_nodePositions.clear();
+    m_layout.clear();
+    m_density.reset(START_X, HORIZONTAL_SPACING);
+}
 
-    // Calculate positions using recursive layout algorithm
-    calculatePositions(m_bst.root(), START_X, START_Y, 200.0f);
+void BSTVisualizer::syncVisuals() {
+    m_sceneVersion++;
+
+    // Apply journaled changes to the visuals and the layout mirror
+    for (NodeIndex id : m_tree->takeChangedNodes()) {
+        if (!m_tree->isLive(id)) {
+            m_layout.removeNode(id);
+            m_density.remove(id);
+            if (id < m_visualNodes.size()) {
+                m_visualNodes[id].active = false;
+            }
+            continue;
+        }
 
-    // Create visual nodes from positions
-    for (const auto& [value, pos] : m_nodePositions) {
-        VisualTreeNode vnode;
-        vnode.position = pos;
-        vnode.size = glm::vec2(NODE_RADIUS * 2, NODE_RADIUS * 2);
-        vnode.color = colors::semantic::elementBase;
-        vnode.borderColor = colors::semantic::elementBorder;
-        vnode.label = std::to_string(value);
-        vnode.value = value;
+        TreeNodeLinks node = m_tree->node(id);
+        m_layout.setLinks(id, node.left, node.right);
+        refreshVisual(id);
+    }
+
+    m_layout.setRoot(m_tree->root());
+    m_layout.update();
 
-        m_visualNodes.push_back(vnode);
+    for (NodeIndex id : m_layout.movedNodes()) {
+        m_visualNodes[id].position = m_layout.position(id);
+        placeDensity(id);
     }
 }
 
-void BSTVisualizer::calculatePositions(std::shared_ptr<TreeNode<int>> node, float x, float y, float xOffset) {
-    if (!node) return;
+VisualTreeNode& BSTVisualizer::refreshVisual(NodeIndex id) {
+    if (id >= m_visualNodes.size()) {
+        m_visualNodes.resize(id + 1);
+    }
 
-    // Store position for this node
-    m_nodePositions[node->data] = glm::vec2(x, y);
+    int key = m_tree->node(id).key;
+    VisualTreeNode& vnode = m_visualNodes[id];
+    if (!vnode.active) {
+        vnode.size = glm::vec2(NODE_RADIUS * 2, NODE_RADIUS * 2);
+        vnode.color = colors::semantic::elementBase;
+        vnode.borderColor = colors::semantic::elementBorder;
+        vnode.active = true;
+    }
+    if (vnode.label == NO_LABEL || vnode.value != key) {
+        vnode.value = key;
+        vnode.label = labels::fromInt(key);
+    }
+    return vnode;
+}
 
-    // Calculate positions for children
-    float nextY = y + VERTICAL_SPACING;
-    float nextOffset = xOffset * 0.6f;  // Reduce offset for deeper levels
+void BSTVisualizer::placeDensity(NodeIndex id) {
+    glm::vec2 position = m_layout.position(id);
+    auto depth = static_cast<int>(std::lround((position.y - START_Y) / VERTICAL_SPACING));
+    m_density.place(id, position.x, depth);
+}
 
-    if (node->left) {
-        calculatePositions(node->left, x - xOffset, nextY, nextOffset);
+void BSTVisualizer::renderMinimap() {
+    // Click or drag to center the canvas on that part of the tree
+    if (!ImGui::CollapsingHeader("Minimap")) {
+        return;
     }
 
-    if (node->right) {
-        calculatePositions(node->right, x + xOffset, nextY, nextOffset);
+    // Canvas corners in world x and depth (node centers sit on whole depths)
+    auto depthAt = [](float worldY) { return (worldY - START_Y) / VERTICAL_SPACING; };
+    glm::vec2 viewMin(-m_cameraOffsetX / m_zoomLevel, depthAt(-m_cameraOffsetY / m_zoomLevel));
+    glm::vec2 viewMax((m_canvasSize.x - m_cameraOffsetX) / m_zoomLevel,
+                      depthAt((m_canvasSize.y - m_cameraOffsetY) / m_zoomLevel));
+    glm::vec2 target;
+    if (m_minimap.renderTree(m_density, viewMin, viewMax, target)) {
+        m_cameraOffsetX = m_canvasSize.x * 0.5f - target.x * m_zoomLevel;
+        m_cameraOffsetY = m_canvasSize.y * 0.5f - (START_Y + target.y * VERTICAL_SPACING) * m_zoomLevel;
     }
+    ImGui::Separator();
+}
+
+VisualTreeNode* BSTVisualizer::findVisual(int value) {
+    NodeIndex id = m_tree->find(value);
+    return id != NULL_NODE ? &m_visualNodes[id] : nullptr;
 }
 
 void BSTVisualizer::drawConnection(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color) {
@@ -787,19 +1005,45 @@ void BSTVisualizer::drawConnection(ImDrawList* drawList, const ImVec2& from, con
 
 std::vector<int> BSTVisualizer::collectTraversalOrder(const std::string& type) {
     std::vector<int> result;
+    result.reserve(m_tree->size());
 
+    // Walk the backend's ids with an explicit stack, so deep trees cannot overflow
+    std::vector<NodeIndex> pending;
     if (type == "inorder") {
-        m_bst.inorderTraversal([&result](const int& val) {
-            result.push_back(val);
-        });
-    } else if (type == "preorder") {
-        m_bst.preorderTraversal([&result](const int& val) {
-            result.push_back(val);
-        });
-    } else if (type == "postorder") {
-        m_bst.postorderTraversal([&result](const int& val) {
-            result.push_back(val);
-        });
+        NodeIndex current = m_tree->root();
+        while (current != NULL_NODE || !pending.empty()) {
+            for (; current != NULL_NODE; current = m_tree->node(current).left) {
+                pending.push_back(current);
+            }
+            TreeNodeLinks node = m_tree->node(pending.back());
+            pending.pop_back();
+            result.push_back(node.key);
+            current = node.right;
+        }
+    } else if (type == "preorder" || type == "postorder") {
+        // Postorder is the reverse of a Root-Right-Left preorder
+        bool post = type == "postorder";
+        if (m_tree->root() != NULL_NODE) pending.push_back(m_tree->root());
+        while (!pending.empty()) {
+            TreeNodeLinks node = m_tree->node(pending.back());
+            pending.pop_back();
+            result.push_back(node.key);
+            NodeIndex first = post ? node.left : node.right;
+            NodeIndex second = post ? node.right : node.left;
+            if (first != NULL_NODE) pending.push_back(first);
+            if (second != NULL_NODE) pending.push_back(second);
+        }
+        if (post) std::reverse(result.begin(), result.end());
+    } else if (type == "levelorder") {
+        std::queue<NodeIndex> level;
+        if (m_tree->root() != NULL_NODE) level.push(m_tree->root());
+        while (!level.empty()) {
+            TreeNodeLinks node = m_tree->node(level.front());
+            level.pop();
+            result.push_back(node.key);
+            if (node.left != NULL_NODE) level.push(node.left);
+            if (node.right != NULL_NODE) level.push(node.right);
+        }
     }
 
     return result;
@@ -807,9 +1051,8 @@ std::vector<int> BSTVisualizer::collectTraversalOrder(const std::string& type) {
 
 void BSTVisualizer::initializeRandom(size_t count) {
     // Clear existing tree and animations
-    m_bst.clear();
-    m_visualNodes.clear();
-    m_nodePositions.clear();
+    m_tree->clear();
+    clearVisuals();
     m_animator.clear();
 
     // Reset camera
@@ -835,18 +1078,182 @@ void BSTVisualizer::initializeRandom(size_t count) {
     // Shuffle the values to ensure random insertion order
     std::shuffle(values.begin(), values.end(), gen);
 
-    // Insert values into BST in shuffled order
-    for (int value : values) {
-        m_bst.insert(value);
+    // Insert in time-budgeted batches, syncing visuals once per batch
+    m_pendingInserts = std::move(values);
+    m_pendingInsertPos = 0;
+    drainPendingInserts();
+}
+
+void BSTVisualizer::loadRandomKeys(size_t count) {
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_animator.clear();
+    if (m_bulkJob) m_bulkJob->cancel();
+
+    bool keepExisting = m_bulkKeepExisting;
+    m_bulkJob = jobs::submit([this, count, keepExisting](const JobToken& token) {
+        // Draw distinct keys from a range wide enough to make collisions rare
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        int maxKey = static_cast<int>(std::min<size_t>(count * 8, 0x3FFFFFFF)) + 99;
+        std::uniform_int_distribution<> dis(1, maxKey);
+        auto load = std::make_shared<BulkLoad>();
+        std::vector<int>& keys = load->keys;
+        keys.reserve(count);
+
+        while (keys.size() < count && !token.isCancelled()) {
+            while (keys.size() < count) {
+                keys.push_back(dis(gen));
+            }
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        }
+
+        if (keepExisting) {
+            // The live tree belongs to the render thread: insert there
+            std::shuffle(keys.begin(), keys.end(), gen);
+        } else {
+            // Build and lay out a replacement tree here, with the same journal/layout setup
+            load->tree.enableChangeTracking();
+            load->tree.buildFromSorted(keys.begin(), keys.end());
+            load->keys = {};
+            layOutReplacement(*load);
+        }
+
+        return JobCompletion([this, load, count]() {
+            finishBulkLoad(*load, std::to_string(count) + " random keys");
+        });
+    });
+
+    m_statusText = "Loading " + std::to_string(count) + " random keys...";
+}
+
+void BSTVisualizer::importDataset(const std::string& path, algorithms::DatasetFormat format) {
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_animator.clear();
+    if (m_bulkJob) m_bulkJob->cancel();
+
+    m_bulkJob = jobs::submit([this, path, format](const JobToken& token) {
+        auto load = std::make_shared<BulkLoad>();
+        algorithms::DatasetReader reader;
+        bool ok = reader.open(path, format) && reader.prepare(&token.cancelledFlag());
+        size_t loaded = 0;
+
+        if (ok) {
+            const algorithms::DatasetInfo& info = reader.info();
+            bool sorted = info.hasSortedness && info.sortedness.isAscending();
+            load->tree.enableChangeTracking();
+            if (sorted && reader.isMapped() && info.count <= MAX_IMPORT_KEYS) {
+                // Known sorted: decode from the mapping as the tree is built
+                load->tree.buildFromSorted(reader.begin(), reader.end());
+                loaded = static_cast<size_t>(info.count);
+            } else {
+                // A sample of a sorted file stays sorted
+                ok = reader.readInto(load->keys, MAX_IMPORT_KEYS, &token.cancelledFlag());
+                if (ok && sorted) {
+                    load->tree.buildFromSorted(load->keys.begin(), load->keys.end());
+                } else if (ok) {
+                    load->tree.bulkLoad(load->keys.begin(), load->keys.end());
+                }
+                loaded = load->keys.size();
+                load->keys = {};
+            }
+        }
+        std::string failure = ok ? "" : reader.error();
+        if (ok && loaded == 0) {
+            ok = false;
+            failure = "the file has no keys";
+        }
+        if (ok) {
+            layOutReplacement(*load);
+        }
+
+        std::string source = ok ? DatasetImportPanel::describe(reader.info(), loaded) : failure;
+        return JobCompletion([this, load, ok, source]() {
+            if (ok) {
+                finishBulkLoad(*load, source);
+            } else {
+                m_bulkJob.reset();
+                m_statusText = "Import failed: " + source;
+            }
+        });
+    });
+
+    m_statusText = "Importing " + path + "...";
+}
+
+void BSTVisualizer::layOutReplacement(BulkLoad& load) {
+    load.layout = TreeLayout(HORIZONTAL_SPACING, VERTICAL_SPACING);
+    load.layout.setOrigin(glm::vec2(START_X, START_Y));
+    for (NodeIndex id : load.tree.takeChangedNodes()) {
+        auto node = load.tree.node(id);
+        load.layout.setLinks(id, node->left, node->right);
+    }
+    load.layout.setRoot(load.tree.root().index());
+    load.layout.update();
+}
+
+void BSTVisualizer::finishBulkLoad(BulkLoad& load, const std::string& source) {
+    m_bulkJob.reset();
+
+    if (!load.keys.empty()) {
+        m_tree->insertRange(load.keys);
+
+        // One sync for the whole batch
+        syncVisuals();
+    } else if (m_tree->adopt(std::move(load.tree))) {
+        // Adopt the prepared tree: every node is new and already placed
+        m_layout = std::move(load.layout);
+        m_sceneVersion++;
+        m_visualNodes.clear();
+        m_density.reset(START_X, HORIZONTAL_SPACING);
+        for (NodeIndex id : m_layout.movedNodes()) {
+            refreshVisual(id).position = m_layout.position(id);
+            placeDensity(id);
+        }
+
+        m_cameraOffsetX = 0.0f;
+        m_cameraOffsetY = 0.0f;
+        m_zoomLevel = 1.0f;
+    } else {
+        // The backend rebuilt the tree under its own ids: lay it out afresh
+        clearVisuals();
+        syncVisuals();
+
+        m_cameraOffsetX = 0.0f;
+        m_cameraOffsetY = 0.0f;
+        m_zoomLevel = 1.0f;
+    }
+
+    std::ostringstream oss;
+    oss << "Loaded " << source << ": " << m_tree->size() << " nodes, Height: " << m_tree->height();
+    m_statusText = oss.str();
+}
+
+void BSTVisualizer::drainPendingInserts() {
+    if (m_pendingInsertPos >= m_pendingInserts.size()) {
+        return;
     }
 
-    // Sync visuals
+    runStepsWithinBudget([this]() {
+        m_tree->insert(m_pendingInserts[m_pendingInsertPos++]);
+        return m_pendingInsertPos < m_pendingInserts.size();
+    }, m_turboBudgetMs);
+
     syncVisuals();
 
-    // Update status immediately (no animation blocking)
     std::ostringstream oss;
-    oss << "Initialized BST with " << count << " nodes, Height: " << m_bst.height();
+    if (m_pendingInsertPos < m_pendingInserts.size()) {
+        oss << "Inserting... " << m_pendingInsertPos << " / " << m_pendingInserts.size();
+        m_statusText = oss.str();
+        return;
+    }
+
+    oss << "Initialized BST with " << m_pendingInserts.size() << " nodes, Height: " << m_tree->height();
     m_statusText = oss.str();
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
 }
 
 } // namespace dsav
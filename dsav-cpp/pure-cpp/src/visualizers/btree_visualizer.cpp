@@ -0,0 +1,753 @@
+/**
+ * @file btree_visualizer.cpp
+ * @brief Implementation of B-Tree visualizer
+ */
+
+#include "visualizers/btree_visualizer.hpp"
+#include "ui_components.hpp"
+#include <sstream>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+namespace dsav {
+
+namespace {
+
+/// Keys the visualizer starts with (and returns to on reset)
+constexpr int INITIAL_KEYS[] = {50, 20, 80, 10, 30, 60, 90, 40, 70, 25, 85};
+
+} // namespace
+
+BTreeVisualizer::BTreeVisualizer()
+    : m_statusText("B-tree is empty") {
+    m_animator.bindContainer(m_keyCells);
+
+    for (int key : INITIAL_KEYS) {
+        m_btree.insert(key);
+        m_bplus.insert(key);
+        m_redBlack.insert(key);
+    }
+    syncVisuals();
+}
+
+void BTreeVisualizer::update(float deltaTime) {
+    // Update animations
+    m_animator.update(deltaTime);
+
+    // Update status if not animating
+    if (!isAnimating()) {
+        if (m_btree.isEmpty()) {
+            m_statusText = "B-tree is empty";
+        } else {
+            std::ostringstream oss;
+            oss << (m_kind == TreeKind::BTree ? "B-tree" : "B+ tree") << " has "
+                << m_btree.size() << " key(s), height " << m_btree.height();
+            m_statusText = oss.str();
+        }
+    }
+}
+
+void BTreeVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Whole canvas is the drag/zoom surface
+    ImGui::InvisibleButton("btree_canvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    bool isHovered = ImGui::IsItemHovered();
+    bool isActive = ImGui::IsItemActive();
+
+    // Handle mouse drag for panning
+    if (isActive && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        if (!m_isDragging) {
+            m_isDragging = true;
+            m_lastMousePos = ImGui::GetMousePos();
+        } else {
+            ImVec2 currentMousePos = ImGui::GetMousePos();
+            m_cameraOffsetX += currentMousePos.x - m_lastMousePos.x;
+            m_cameraOffsetY += currentMousePos.y - m_lastMousePos.y;
+            m_lastMousePos = currentMousePos;
+        }
+    } else {
+        m_isDragging = false;
+    }
+
+    // Tree extent, for centering when it fits
+    float treeWidth = 0.0f;
+    for (const VisualBTreeNode& node : m_visualNodes) {
+        treeWidth = std::max(treeWidth, node.position.x + node.width);
+    }
+    treeWidth += START_X;
+    float centerX = std::max(0.0f, (canvasSize.x - treeWidth * m_zoomLevel) / 2.0f);
+
+    // Handle mouse wheel
+    if (isHovered) {
+        float wheel = ImGui::GetIO().MouseWheel;
+        if (wheel != 0.0f) {
+            if (ImGui::GetIO().KeyCtrl) {
+                // Zoom toward the mouse position
+                float oldZoom = m_zoomLevel;
+                m_zoomLevel = std::clamp(m_zoomLevel + wheel * 0.1f, 0.3f, 3.0f);
+                float zoomRatio = m_zoomLevel / oldZoom;
+                ImVec2 mousePos = ImGui::GetMousePos();
+                float mouseX = mousePos.x - canvasPos.x - centerX;
+                float mouseY = mousePos.y - canvasPos.y;
+                m_cameraOffsetX = mouseX - (mouseX - m_cameraOffsetX) * zoomRatio;
+                m_cameraOffsetY = mouseY - (mouseY - m_cameraOffsetY) * zoomRatio;
+                centerX = std::max(0.0f, (canvasSize.x - treeWidth * m_zoomLevel) / 2.0f);
+            } else {
+                // Regular vertical scrolling
+                m_cameraOffsetY += wheel * 50.0f;
+            }
+        }
+    }
+
+    float zoom = m_zoomLevel;
+    auto toScreen = [&](float x, float y) {
+        return ImVec2(canvasPos.x + centerX + m_cameraOffsetX + x * zoom,
+                      canvasPos.y + m_cameraOffsetY + y * zoom);
+    };
+
+    CanvasViewport viewport(canvasPos, canvasSize, zoom);
+    ImU32 edgeColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0));
+    ImU32 chainColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::blue));
+
+    // Cells the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_keyCells, m_animatedScratch);
+    if (m_animatedScratch != m_animatedCells) {
+        m_animatedCells.swap(m_animatedScratch);
+        m_sceneVersion++;
+    }
+
+    auto drawCell = [&](const VisualBTreeNode& node, const ImVec2& nodeMin, size_t k) {
+        const VisualKeyCell& cell = m_keyCells[node.firstKey + k];
+        VisualElement elem;
+        elem.position = glm::vec2(nodeMin.x + k * KEY_WIDTH * zoom, nodeMin.y);
+        elem.size = glm::vec2(KEY_WIDTH * zoom, KEY_HEIGHT * zoom);
+        elem.color = cell.color;
+        elem.borderColor = cell.borderColor;
+        elem.borderWidth = 2.0f;
+        elem.cornerRadius = 4.0f;
+        elem.label = cell.label;
+        renderElement(drawList, elem, ImVec2(0, 0), viewport.detail());
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = zoom;
+    cacheKey.offsetX = centerX + m_cameraOffsetX;
+    cacheKey.offsetY = m_cameraOffsetY;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
+
+        // Edges hang from the gap between keys childSlot - 1 and childSlot
+        for (const VisualBTreeNode& node : m_visualNodes) {
+            if (node.parent == SIZE_MAX) {
+                continue;
+            }
+            const VisualBTreeNode& parent = m_visualNodes[node.parent];
+            ImVec2 from = toScreen(parent.position.x + node.childSlot * KEY_WIDTH, parent.position.y + KEY_HEIGHT);
+            ImVec2 to = toScreen(node.position.x + node.width / 2.0f, node.position.y);
+            if (viewport.isSegmentVisible(from, to)) {
+                drawList->AddLine(from, to, edgeColor, 1.5f);
+            }
+        }
+
+        // B+ leaf chain: each leaf points at its right neighbour
+        if (m_kind == TreeKind::BPlusTree) {
+            const VisualBTreeNode* previous = nullptr;
+            for (const VisualBTreeNode& node : m_visualNodes) {
+                if (node.childCount != 0) {
+                    continue;
+                }
+                if (previous) {
+                    float y = node.position.y + KEY_HEIGHT / 2.0f;
+                    ImVec2 from = toScreen(previous->position.x + previous->width, y);
+                    ImVec2 to = toScreen(node.position.x, y);
+                    if (viewport.isSegmentVisible(from, to)) {
+                        if (viewport.isFullDetail()) {
+                            drawArrow(drawList, from, to, chainColor);
+                        } else {
+                            drawList->AddLine(from, to, chainColor, 2.0f);
+                        }
+                    }
+                }
+                previous = &node;
+            }
+        }
+
+        // Resting nodes: one cell per key
+        for (const VisualBTreeNode& node : m_visualNodes) {
+            ImVec2 nodeMin = toScreen(node.position.x, node.position.y);
+            ImVec2 nodeMax = ImVec2(nodeMin.x + node.width * zoom, nodeMin.y + KEY_HEIGHT * zoom);
+            if (!viewport.isRectVisible(nodeMin, nodeMax)) {
+                continue;
+            }
+            for (size_t k = 0; k < node.count; ++k) {
+                if (!m_animatedCells[node.firstKey + k]) {
+                    drawCell(node, nodeMin, k);
+                }
+            }
+        }
+
+        // Draw info text if empty
+        if (m_visualNodes.empty()) {
+            ImVec2 textPos = ImVec2(
+                canvasPos.x + canvasSize.x / 2.0f - 120.0f,
+                canvasPos.y + canvasSize.y / 2.0f
+            );
+            drawList->AddText(
+                textPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "Tree is empty. Use Insert to add keys."
+            );
+        }
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating cells on top
+    if (animatedCount > 0) {
+        for (const VisualBTreeNode& node : m_visualNodes) {
+            ImVec2 nodeMin = toScreen(node.position.x, node.position.y);
+            ImVec2 nodeMax = ImVec2(nodeMin.x + node.width * zoom, nodeMin.y + KEY_HEIGHT * zoom);
+            if (!viewport.isRectVisible(nodeMin, nodeMax)) {
+                continue;
+            }
+            for (size_t k = 0; k < node.count; ++k) {
+                if (m_animatedCells[node.firstKey + k]) {
+                    drawCell(node, nodeMin, k);
+                }
+            }
+        }
+    }
+
+    if (m_visualNodes.empty()) {
+        return;
+    }
+
+    // Show interaction hints
+    std::string hintText = "Drag to pan | Scroll to move | Ctrl+Scroll to zoom";
+    if (m_zoomLevel != 1.0f) {
+        hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
+    }
+    ImVec2 hintSize = ImGui::CalcTextSize(hintText.c_str());
+    drawList->AddText(
+        ImVec2(canvasPos.x + canvasSize.x - hintSize.x - 10.0f, canvasPos.y + 10.0f),
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)),
+        hintText.c_str()
+    );
+}
+
+void BTreeVisualizer::renderControls() {
+    ImGui::Begin("B-Tree Controls");
+
+    // Status
+    ui::StatusText(m_statusText.c_str(), "info");
+    ImGui::Separator();
+
+    // Tree type
+    ImGui::Text("Tree Type:");
+    const char* kinds[] = {
+        "B-tree",
+        "B+ tree (leaf chained)"
+    };
+    int kindIdx = static_cast<int>(m_kind);
+    ImGui::BeginDisabled(isAnimating());
+    if (ImGui::Combo("##Kind", &kindIdx, kinds, IM_ARRAYSIZE(kinds))) {
+        setKind(static_cast<TreeKind>(kindIdx));
+    }
+    ImGui::EndDisabled();
+    ui::Tooltip("A B+ tree keeps every key in the leaves and chains them,\n"
+                "so internal keys (dimmed) are only separator copies");
+    ImGui::Separator();
+
+    // Operation mode selection
+    ImGui::Text("Operation Mode:");
+    const char* modes[] = {"Insert", "Delete", "Search"};
+    int currentModeIdx = static_cast<int>(m_currentMode);
+    if (ImGui::Combo("##Mode", &currentModeIdx, modes, IM_ARRAYSIZE(modes))) {
+        m_currentMode = static_cast<OperationMode>(currentModeIdx);
+    }
+
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Value", &m_inputValue);
+    ImGui::PopItemWidth();
+
+    ImGui::Spacing();
+
+    // Execute button
+    ImGui::BeginDisabled(isAnimating());
+
+    bool canExecute = m_currentMode == OperationMode::Insert || !m_btree.isEmpty();
+    const char* buttonLabel = "Execute";
+    const char* tooltipText = "";
+    switch (m_currentMode) {
+        case OperationMode::Insert:
+            buttonLabel = "Insert";
+            tooltipText = "Insert a key (full nodes split on the way down)";
+            break;
+        case OperationMode::Delete:
+            buttonLabel = "Delete";
+            tooltipText = "Delete a key (thin nodes borrow or merge on the way down)";
+            break;
+        case OperationMode::Search:
+            buttonLabel = "Search";
+            tooltipText = "Search for a key from the root";
+            break;
+    }
+
+    if (!canExecute) {
+        ImGui::BeginDisabled();
+    }
+    if (ui::ButtonPrimary(buttonLabel, ImVec2(200, 0))) {
+        switch (m_currentMode) {
+            case OperationMode::Insert: insertValue(m_inputValue); break;
+            case OperationMode::Delete: deleteValue(m_inputValue); break;
+            case OperationMode::Search: searchValue(m_inputValue); break;
+        }
+    }
+    if (!canExecute) {
+        ImGui::EndDisabled();
+    }
+
+    ImGui::EndDisabled();
+    ui::Tooltip(tooltipText);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Initialize operation
+    ImGui::Text("Initialize:");
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Count", &m_initCount);
+    m_initCount = std::clamp(m_initCount, 1, MAX_INIT_COUNT);
+    ImGui::PopItemWidth();
+
+    ImGui::BeginDisabled(isAnimating());
+    if (ui::ButtonPrimary("Initialize Random", ImVec2(200, 0))) {
+        initializeRandom(static_cast<size_t>(m_initCount));
+    }
+    ui::Tooltip("Fill the trees with distinct random keys (clears existing keys)");
+    if (ImGui::Button("Clear", ImVec2(200, 0))) {
+        clearTree();
+    }
+    ImGui::EndDisabled();
+
+    ImGui::Separator();
+
+    // Playback controls
+    ui::PlaybackControls(
+        m_isPaused,
+        [this]() { play(); },
+        [this]() { pause(); },
+        [this]() { step(); },
+        [this]() { reset(); }
+    );
+
+    ImGui::Spacing();
+    ui::SpeedSlider(m_speed, 0.1f, 5.0f);
+
+    ImGui::Separator();
+
+    // Tree info
+    size_t height = m_kind == TreeKind::BTree ? m_btree.height() : m_bplus.height();
+    size_t nodes = m_kind == TreeKind::BTree ? m_btree.nodeCount() : m_bplus.nodeCount();
+    ImGui::Text("Tree Info (order %zu, up to %zu keys per node):", ORDER, ORDER - 1);
+    ImGui::Text("Keys: %zu", m_btree.size());
+    ImGui::Text("Height: %zu (red-black: %d)", height, m_redBlack.height());
+    ImGui::Text("Nodes: %zu (red-black: %zu)", nodes, m_redBlack.size());
+
+    ImGui::Separator();
+    ImGui::Text("Last Search:");
+    if (!m_hasSearch) {
+        ImGui::TextDisabled("Search for a key to compare node visits");
+    } else {
+        ImGui::BulletText("%s: %zu nodes, %zu key comparisons",
+                          m_kind == TreeKind::BTree ? "B-tree" : "B+ tree",
+                          m_lastVisited, m_lastKeysScanned);
+        ImGui::BulletText("Red-black tree: %zu nodes", m_lastRedBlackVisited);
+        ui::Tooltip("Each node visited is a dependent load; on a large tree most are cache misses.\n"
+                    "A wide node pays for one miss and then compares its keys in cache");
+    }
+
+    ImGui::End();
+}
+
+void BTreeVisualizer::insertValue(int value) {
+    if (!m_btree.insert(value)) {
+        std::ostringstream oss;
+        oss << "Key " << value << " is already in the tree";
+        m_statusText = oss.str();
+        return;
+    }
+    m_bplus.insert(value);
+    m_redBlack.insert(value);
+
+    syncVisuals();
+    std::ostringstream oss;
+    oss << "Inserted " << value;
+    std::string message = oss.str();
+    animatePath(searchPath(value), colors::semantic::sorted, [this, message]() {
+        m_statusText = message;
+    });
+}
+
+void BTreeVisualizer::deleteValue(int value) {
+    if (!m_btree.search(value)) {
+        std::ostringstream oss;
+        oss << "Key " << value << " not found";
+        m_statusText = oss.str();
+        return;
+    }
+
+    std::ostringstream oss;
+    oss << "Deleting " << value << "...";
+    m_statusText = oss.str();
+
+    animatePath(searchPath(value), colors::semantic::error, [this, value]() {
+        size_t nodesBefore = m_btree.nodeCount();
+        m_btree.remove(value);
+        m_bplus.remove(value);
+        m_redBlack.remove(value);
+        syncVisuals();
+
+        std::ostringstream oss;
+        oss << "Deleted " << value;
+        if (m_btree.nodeCount() < nodesBefore) {
+            oss << " (nodes merged)";
+        }
+        m_statusText = oss.str();
+    });
+}
+
+void BTreeVisualizer::searchValue(int value) {
+    if (m_btree.isEmpty()) {
+        m_statusText = "Error: Tree is empty!";
+        return;
+    }
+
+    std::ostringstream oss;
+    oss << "Searching for " << value << "...";
+    m_statusText = oss.str();
+
+    std::vector<PathStep> path = searchPath(value, &m_lastKeysScanned);
+    bool found = !path.empty() && path.back().matchedKey != SIZE_MAX;
+
+    m_hasSearch = true;
+    m_lastVisited = path.size();
+    m_lastRedBlackVisited = redBlackVisits(value);
+
+    animatePath(path, colors::semantic::sorted, [this, value, found]() {
+        std::ostringstream oss;
+        if (found) {
+            oss << "Found " << value << " after " << m_lastVisited << " node(s)";
+        } else {
+            oss << "Key " << value << " not found (" << m_lastVisited << " node(s) visited)";
+        }
+        m_statusText = oss.str();
+    });
+}
+
+void BTreeVisualizer::initializeRandom(size_t count) {
+    m_btree.clear();
+    m_bplus.clear();
+    m_redBlack.clear();
+    m_animator.clear();
+    m_hasSearch = false;
+
+    // Distinct keys in [1, 999]
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::vector<int> keys(999);
+    std::iota(keys.begin(), keys.end(), 1);
+    std::shuffle(keys.begin(), keys.end(), gen);
+    keys.resize(std::min(count, keys.size()));
+
+    for (int key : keys) {
+        m_btree.insert(key);
+        m_bplus.insert(key);
+        m_redBlack.insert(key);
+    }
+    syncVisuals();
+
+    // Fade every cell in at once
+    std::vector<Animation> appear;
+    for (VisualKeyCell& cell : m_keyCells) {
+        glm::vec4 target = cell.color;
+        cell.color = colors::semantic::sorted;
+        appear.push_back(createColorAnimation(cell.color, target, 0.4f));
+    }
+    m_animator.enqueueParallel(std::move(appear));
+
+    std::ostringstream oss;
+    oss << "Initialized with " << keys.size() << " random keys";
+    m_statusText = oss.str();
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+}
+
+void BTreeVisualizer::clearTree() {
+    m_btree.clear();
+    m_bplus.clear();
+    m_redBlack.clear();
+    m_animator.clear();
+    m_hasSearch = false;
+    syncVisuals();
+    m_statusText = "Tree cleared";
+}
+
+void BTreeVisualizer::setKind(TreeKind kind) {
+    if (kind == m_kind) {
+        return;
+    }
+    m_kind = kind;
+    m_animator.clear();
+    m_hasSearch = false;
+    syncVisuals();
+    m_statusText = (kind == TreeKind::BTree) ? "Showing the B-tree" : "Showing the B+ tree";
+}
+
+void BTreeVisualizer::play() {
+    m_isPaused = false;
+    m_animator.setPaused(false);
+}
+
+void BTreeVisualizer::pause() {
+    m_isPaused = true;
+    m_animator.setPaused(true);
+}
+
+void BTreeVisualizer::step() {
+    m_animator.stepForward();
+}
+
+void BTreeVisualizer::reset() {
+    clearTree();
+    for (int key : INITIAL_KEYS) {
+        m_btree.insert(key);
+        m_bplus.insert(key);
+        m_redBlack.insert(key);
+    }
+    syncVisuals();
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Tree reset";
+    m_isPaused = true;
+}
+
+void BTreeVisualizer::setSpeed(float speed) {
+    m_speed = speed;
+    m_animator.setSpeedMultiplier(speed);
+}
+
+std::string BTreeVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool BTreeVisualizer::isAnimating() const {
+    return m_animator.hasAnimations();
+}
+
+bool BTreeVisualizer::isPaused() const {
+    return m_isPaused;
+}
+
+BTreeVisualizer::Handle BTreeVisualizer::displayedRoot() const {
+    return m_kind == TreeKind::BTree ? m_btree.root() : m_bplus.root();
+}
+
+BTreeVisualizer::Handle BTreeVisualizer::displayedNode(NodeIndex id) const {
+    return m_kind == TreeKind::BTree ? m_btree.node(id) : m_bplus.node(id);
+}
+
+std::vector<BTreeVisualizer::PathStep> BTreeVisualizer::searchPath(int value, size_t* keysCompared) const {
+    std::vector<PathStep> path;
+    size_t keysScanned = 0;
+
+    for (Handle node = displayedRoot(); node; ) {
+        PathStep step;
+        step.visual = m_visualOf.at(node.index());
+
+        // B-tree: first key >= value. B+ internal: keys <= value pick the child.
+        size_t i = 0;
+        if (m_kind == TreeKind::BPlusTree && !node->leaf) {
+            while (i < node->count && node->keys[i] <= value) ++i;
+        } else {
+            while (i < node->count && node->keys[i] < value) ++i;
+        }
+        keysScanned += std::min<size_t>(i + 1, node->count);
+
+        bool matched = i < node->count && node->keys[i] == value &&
+                       (m_kind == TreeKind::BTree || node->leaf);
+        if (matched) {
+            step.matchedKey = i;
+        }
+        path.push_back(step);
+        if (matched || node->leaf) {
+            break;
+        }
+        node = displayedNode(node->children[i]);
+    }
+
+    if (keysCompared) {
+        *keysCompared = keysScanned;
+    }
+    return path;
+}
+
+size_t BTreeVisualizer::redBlackVisits(int value) const {
+    size_t visited = 0;
+    for (auto node = m_redBlack.root(); node; ) {
+        visited++;
+        if (node->data == value) {
+            break;
+        }
+        node = value < node->data ? node.left() : node.right();
+    }
+    return visited;
+}
+
+void BTreeVisualizer::syncVisuals() {
+    m_sceneVersion++;
+    m_visualNodes.clear();
+    m_keyCells.clear();
+    m_visualOf.clear();
+
+    Handle root = displayedRoot();
+    if (!root) {
+        return;
+    }
+
+    // Breadth-first, so each node's children are contiguous and follow it
+    std::vector<NodeIndex> ids{root.index()};
+    m_visualNodes.push_back(VisualBTreeNode{});
+    for (size_t v = 0; v < ids.size(); ++v) {
+        Handle node = displayedNode(ids[v]);
+        m_visualOf[ids[v]] = v;
+
+        VisualBTreeNode& visual = m_visualNodes[v];
+        visual.count = node->count;
+        visual.width = node->count * KEY_WIDTH;
+        visual.firstKey = m_keyCells.size();
+
+        bool separator = m_kind == TreeKind::BPlusTree && !node->leaf;
+        for (size_t k = 0; k < node->count; ++k) {
+            VisualKeyCell cell;
+            cell.color = separator ? colors::mocha::surface1 : colors::semantic::elementBase;
+            cell.borderColor = separator ? colors::mocha::overlay0 : colors::semantic::elementBorder;
+            cell.label = labels::fromInt(node->keys[k]);
+            m_keyCells.push_back(cell);
+        }
+
+        if (!node->leaf) {
+            size_t level = visual.level;
+            visual.firstChild = m_visualNodes.size();
+            visual.childCount = node->count + 1;
+            for (size_t c = 0; c <= node->count; ++c) {
+                VisualBTreeNode child;
+                child.level = level + 1;
+                child.parent = v;
+                child.childSlot = c;
+                ids.push_back(node->children[c]);
+                m_visualNodes.push_back(child);  // invalidates `visual`
+            }
+        }
+    }
+
+    layoutNodes();
+}
+
+void BTreeVisualizer::layoutNodes() {
+    // Leaves: left to right in level order
+    float cursor = START_X;
+    for (VisualBTreeNode& node : m_visualNodes) {
+        node.position.y = START_Y + node.level * LEVEL_SPACING;
+        if (node.childCount == 0) {
+            node.position.x = cursor;
+            cursor += node.width + NODE_GAP;
+        }
+    }
+
+    // Parents: centered over their children, deepest first
+    for (size_t v = m_visualNodes.size(); v-- > 0; ) {
+        VisualBTreeNode& node = m_visualNodes[v];
+        if (node.childCount == 0) {
+            continue;
+        }
+        const VisualBTreeNode& first = m_visualNodes[node.firstChild];
+        const VisualBTreeNode& last = m_visualNodes[node.firstChild + node.childCount - 1];
+        float center = (first.position.x + last.position.x + last.width) / 2.0f;
+        node.position.x = center - node.width / 2.0f;
+    }
+}
+
+void BTreeVisualizer::animatePath(const std::vector<PathStep>& path, const glm::vec4& matchColor,
+                                  std::function<void()> onDone) {
+    if (path.empty()) {
+        onDone();
+        return;
+    }
+
+    for (size_t p = 0; p < path.size(); ++p) {
+        const PathStep& step = path[p];
+        const VisualBTreeNode& node = m_visualNodes[step.visual];
+        bool last = p + 1 == path.size();
+
+        std::vector<Animation> checking;
+        std::vector<Animation> restore;
+        for (size_t k = 0; k < node.count; ++k) {
+            VisualKeyCell& cell = m_keyCells[node.firstKey + k];
+            if (k == step.matchedKey) {
+                continue;
+            }
+            checking.push_back(createColorAnimation(cell.color, colors::semantic::comparing, 0.2f));
+            restore.push_back(createColorAnimation(cell.color, cell.color, 0.2f));
+        }
+        if (step.matchedKey != SIZE_MAX) {
+            VisualKeyCell& cell = m_keyCells[node.firstKey + step.matchedKey];
+            checking.push_back(createColorAnimation(cell.color, matchColor, 0.3f));
+            restore.push_back(createColorAnimation(cell.color, cell.color, 0.3f));
+        }
+
+        if (last) {
+            restore.back().onComplete = onDone;
+        }
+        m_animator.enqueueParallel(std::move(checking));
+        m_animator.enqueueParallel(std::move(restore));
+    }
+}
+
+void BTreeVisualizer::drawArrow(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color) {
+    // Draw line
+    drawList->AddLine(from, to, color, 2.0f);
+
+    // Draw arrowhead
+    float angle = std::atan2(to.y - from.y, to.x - from.x);
+    float arrowSize = 8.0f;
+
+    ImVec2 p1 = ImVec2(
+        to.x - arrowSize * std::cos(angle - 0.5f),
+        to.y - arrowSize * std::sin(angle - 0.5f)
+    );
+    ImVec2 p2 = ImVec2(
+        to.x - arrowSize * std::cos(angle + 0.5f),
+        to.y - arrowSize * std::sin(angle + 0.5f)
+    );
+
+    drawList->AddTriangleFilled(to, p1, p2, color);
+}
+
+} // namespace dsav
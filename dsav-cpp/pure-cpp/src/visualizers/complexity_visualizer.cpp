@@ -0,0 +1,439 @@
+/**
+ * @file complexity_visualizer.cpp
+ * @brief Implementation of the complexity curve view
+ */
+
+#include "visualizers/complexity_visualizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+namespace dsav {
+
+using algorithms::ComplexityMetric;
+using algorithms::ComplexityOp;
+using algorithms::ComplexitySample;
+
+namespace {
+
+const char* const CURVE_NAMES[ComplexityVisualizer::CURVE_COUNT] = {
+    "1", "log n", "n", "n log n", "n^2"
+};
+
+// Measured series first, then the reference curves
+const glm::vec4 SERIES_COLORS[] = {colors::mocha::blue, colors::mocha::peach};
+const glm::vec4 CURVE_COLORS[ComplexityVisualizer::CURVE_COUNT] = {
+    colors::mocha::overlay1, colors::mocha::green, colors::mocha::yellow,
+    colors::mocha::mauve, colors::mocha::red
+};
+
+ImU32 toU32(const glm::vec4& color, float alpha = 1.0f) {
+    ImVec4 c = colors::toImGui(color);
+    c.w *= alpha;
+    return ImGui::ColorConvertFloat4ToU32(c);
+}
+
+std::string operationLabel(ComplexityOp op) {
+    const algorithms::ComplexityOpInfo& info = algorithms::complexityOpInfo(op);
+    return std::string(info.structure) + ": " + info.operation;
+}
+
+} // namespace
+
+ComplexityVisualizer::ComplexityVisualizer() {
+    runSweep();
+}
+
+ComplexityVisualizer::~ComplexityVisualizer() {
+    // The pending completion captures this; cancelling drops it
+    if (m_job) m_job->cancel();
+}
+
+void ComplexityVisualizer::update(float /*deltaTime*/) {
+    // Results arrive through the job completion
+}
+
+// ===== Sweeps =====
+
+void ComplexityVisualizer::runSweep() {
+    if (m_job) {
+        m_job->cancel();
+    }
+
+    std::vector<ComplexityOp> ops{static_cast<ComplexityOp>(m_primaryOp)};
+    if (m_compareOp >= 0 && m_compareOp != m_primaryOp) {
+        ops.push_back(static_cast<ComplexityOp>(m_compareOp));
+    }
+    size_t minExponent = static_cast<size_t>(m_minExponent);
+    size_t maxExponent = static_cast<size_t>(m_maxExponent);
+
+    auto result = std::make_shared<std::vector<Series>>();
+    m_job = jobs::submit([this, ops, minExponent, maxExponent, result](const JobToken& token) {
+        for (ComplexityOp op : ops) {
+            Series series;
+            series.op = op;
+            if (!algorithms::runComplexity(op, minExponent, maxExponent, SEED, series.samples,
+                                           &token.cancelledFlag())) {
+                return JobCompletion();
+            }
+            result->push_back(std::move(series));
+        }
+
+        return JobCompletion([this, result]() {
+            m_job.reset();
+            m_series = std::move(*result);
+            m_statusText = "Measured " + operationLabel(m_series.front().op) + " up to n = "
+                         + std::to_string(m_series.front().samples.back().n);
+        });
+    });
+
+    m_statusText = "Measuring " + operationLabel(ops.front()) + "...";
+}
+
+double ComplexityVisualizer::plotValue(const ComplexitySample& sample) const {
+    double value = sample.perOperation(static_cast<ComplexityMetric>(m_metric));
+    return m_totalCost ? value * static_cast<double>(sample.n) : value;
+}
+
+double ComplexityVisualizer::curveValue(Curve curve, double n) {
+    switch (curve) {
+        case Curve::Constant:  return 1.0;
+        case Curve::Log:       return std::log2(n);
+        case Curve::Linear:    return n;
+        case Curve::LogLinear: return n * std::log2(n);
+        case Curve::Quadratic: return n * n;
+    }
+    return 1.0;
+}
+
+// ===== Rendering =====
+
+void ComplexityVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Ensure minimum canvas size
+    if (canvasSize.x < 50.0f) canvasSize.x = 900.0f;
+    if (canvasSize.y < 50.0f) canvasSize.y = 600.0f;
+
+    drawList->AddRectFilled(
+        canvasPos,
+        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+        toU32(colors::mocha::base)
+    );
+
+    if (m_series.empty() || m_series.front().samples.empty()) {
+        drawList->AddText(ImVec2(canvasPos.x + 20.0f, canvasPos.y + 20.0f),
+                          toU32(colors::semantic::textSecondary),
+                          m_job ? "Measuring..." : "Press Run to measure");
+        return;
+    }
+
+    renderPlot(drawList, canvasPos, canvasSize);
+}
+
+void ComplexityVisualizer::renderPlot(ImDrawList* drawList, ImVec2 origin, ImVec2 size) {
+    const std::vector<ComplexitySample>& primary = m_series.front().samples;
+    ImVec2 plotMin(origin.x + PLOT_MARGIN_LEFT, origin.y + PLOT_MARGIN_TOP);
+    ImVec2 plotMax(origin.x + size.x - PLOT_MARGIN_RIGHT, origin.y + size.y - PLOT_MARGIN_BOTTOM);
+    if (plotMax.x - plotMin.x < 50.0f || plotMax.y - plotMin.y < 50.0f) {
+        return;
+    }
+
+    // Reference curves meet the primary measurement at the largest n
+    double lastN = static_cast<double>(primary.back().n);
+    double anchor = plotValue(primary.back());
+    std::array<double, CURVE_COUNT> curveScale{};
+    for (size_t c = 0; c < CURVE_COUNT; ++c) {
+        curveScale[c] = anchor / curveValue(static_cast<Curve>(c), lastN);
+    }
+    bool showCurves = anchor > 0.0;
+
+    // Value range over everything drawn
+    double maxValue = 0.0;
+    double minPositive = anchor > 0.0 ? anchor : 1.0;
+    auto include = [&](double value) {
+        maxValue = std::max(maxValue, value);
+        if (value > 0.0) minPositive = std::min(minPositive, value);
+    };
+    for (const Series& series : m_series) {
+        for (const ComplexitySample& sample : series.samples) include(plotValue(sample));
+    }
+    if (showCurves) {
+        for (size_t c = 0; c < CURVE_COUNT; ++c) {
+            if (!m_showCurve[c]) continue;
+            for (const ComplexitySample& sample : primary) {
+                include(curveScale[c] * curveValue(static_cast<Curve>(c), static_cast<double>(sample.n)));
+            }
+        }
+    }
+    if (maxValue <= 0.0) maxValue = 1.0;
+
+    double xFirst = std::log2(static_cast<double>(primary.front().n));
+    double xLast = std::log2(lastN);
+    double xSpan = std::max(xLast - xFirst, 1.0);
+    double yLow = m_logScale ? std::log10(minPositive) : 0.0;
+    double yHigh = m_logScale ? std::log10(maxValue) : maxValue;
+    if (yHigh - yLow < 1e-9) yHigh = yLow + 1.0;
+
+    auto toScreen = [&](double n, double value) {
+        double x = (std::log2(n) - xFirst) / xSpan;
+        double y = m_logScale ? std::log10(std::max(value, minPositive)) : value;
+        y = (y - yLow) / (yHigh - yLow);
+        return ImVec2(plotMin.x + static_cast<float>(x) * (plotMax.x - plotMin.x),
+                      plotMax.y - static_cast<float>(y) * (plotMax.y - plotMin.y));
+    };
+
+    // ===== Axes and grid =====
+
+    ImU32 gridColor = toU32(colors::semantic::border, 0.5f);
+    ImU32 axisColor = toU32(colors::semantic::border);
+    ImU32 labelColor = toU32(colors::semantic::textSecondary);
+    char text[64];
+
+    for (int i = 0; i <= Y_GRID_LINES; ++i) {
+        float t = static_cast<float>(i) / Y_GRID_LINES;
+        float y = plotMax.y - t * (plotMax.y - plotMin.y);
+        drawList->AddLine(ImVec2(plotMin.x, y), ImVec2(plotMax.x, y), gridColor);
+        double value = yLow + t * (yHigh - yLow);
+        std::snprintf(text, sizeof(text), "%.3g", m_logScale ? std::pow(10.0, value) : value);
+        ImVec2 textSize = ImGui::CalcTextSize(text);
+        drawList->AddText(ImVec2(plotMin.x - textSize.x - 8.0f, y - textSize.y / 2.0f), labelColor, text);
+    }
+
+    for (const ComplexitySample& sample : primary) {
+        ImVec2 p = toScreen(static_cast<double>(sample.n), 0.0);
+        drawList->AddLine(ImVec2(p.x, plotMin.y), ImVec2(p.x, plotMax.y), gridColor);
+        std::snprintf(text, sizeof(text), "2^%d", static_cast<int>(std::lround(std::log2(static_cast<double>(sample.n)))));
+        ImVec2 textSize = ImGui::CalcTextSize(text);
+        drawList->AddText(ImVec2(p.x - textSize.x / 2.0f, plotMax.y + 6.0f), labelColor, text);
+    }
+
+    drawList->AddLine(plotMin, ImVec2(plotMin.x, plotMax.y), axisColor, 1.5f);
+    drawList->AddLine(ImVec2(plotMin.x, plotMax.y), plotMax, axisColor, 1.5f);
+    drawList->AddText(ImVec2((plotMin.x + plotMax.x) / 2.0f - 10.0f, plotMax.y + 26.0f), labelColor, "n");
+
+    std::string yLabel = algorithms::complexityMetricName(static_cast<ComplexityMetric>(m_metric));
+    yLabel += m_totalCost ? " for n operations" : " per operation";
+    drawList->AddText(ImVec2(plotMin.x, origin.y + 12.0f), labelColor, yLabel.c_str());
+
+    // ===== Curves and measurements =====
+
+    std::vector<ImVec2> points;
+    if (showCurves) {
+        for (size_t c = 0; c < CURVE_COUNT; ++c) {
+            if (!m_showCurve[c]) continue;
+            points.clear();
+            for (const ComplexitySample& sample : primary) {
+                double n = static_cast<double>(sample.n);
+                points.push_back(toScreen(n, curveScale[c] * curveValue(static_cast<Curve>(c), n)));
+            }
+            drawList->AddPolyline(points.data(), static_cast<int>(points.size()),
+                                  toU32(CURVE_COLORS[c], 0.7f), 0, 1.5f);
+        }
+    }
+
+    for (size_t s = 0; s < m_series.size(); ++s) {
+        points.clear();
+        for (const ComplexitySample& sample : m_series[s].samples) {
+            points.push_back(toScreen(static_cast<double>(sample.n), plotValue(sample)));
+        }
+        ImU32 color = toU32(SERIES_COLORS[s]);
+        drawList->AddPolyline(points.data(), static_cast<int>(points.size()), color, 0, 3.0f);
+        for (const ImVec2& p : points) {
+            drawList->AddCircleFilled(p, 4.0f, color);
+        }
+    }
+
+    // ===== Legend =====
+
+    ImVec2 legend(plotMin.x + 12.0f, plotMin.y + 8.0f);
+    auto legendRow = [&](ImU32 color, const std::string& label) {
+        drawList->AddLine(ImVec2(legend.x, legend.y + 8.0f), ImVec2(legend.x + 20.0f, legend.y + 8.0f), color, 3.0f);
+        drawList->AddText(ImVec2(legend.x + 28.0f, legend.y), toU32(colors::semantic::textPrimary), label.c_str());
+        legend.y += 18.0f;
+    };
+    for (size_t s = 0; s < m_series.size(); ++s) {
+        legendRow(toU32(SERIES_COLORS[s]), operationLabel(m_series[s].op) + "  ("
+                  + algorithms::complexityOpInfo(m_series[s].op).expected + ")");
+    }
+    if (showCurves) {
+        for (size_t c = 0; c < CURVE_COUNT; ++c) {
+            if (m_showCurve[c]) legendRow(toU32(CURVE_COLORS[c], 0.7f), CURVE_NAMES[c]);
+        }
+    }
+
+    // ===== Hover readout =====
+
+    ImVec2 mouse = ImGui::GetMousePos();
+    if (mouse.x >= plotMin.x && mouse.x <= plotMax.x && mouse.y >= plotMin.y && mouse.y <= plotMax.y) {
+        size_t nearest = 0;
+        float bestDistance = 1e9f;
+        for (size_t i = 0; i < primary.size(); ++i) {
+            float distance = std::abs(toScreen(static_cast<double>(primary[i].n), 0.0).x - mouse.x);
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                nearest = i;
+            }
+        }
+
+        ImGui::BeginTooltip();
+        ImGui::Text("n = %zu", primary[nearest].n);
+        for (const Series& series : m_series) {
+            if (nearest < series.samples.size()) {
+                ImGui::Text("%s: %.3g", operationLabel(series.op).c_str(), plotValue(series.samples[nearest]));
+            }
+        }
+        ImGui::EndTooltip();
+    }
+}
+
+bool ComplexityVisualizer::operationCombo(const char* label, int& selected, bool allowNone) {
+    std::string preview = selected < 0 ? "None" : operationLabel(static_cast<ComplexityOp>(selected));
+    bool changed = false;
+    if (ImGui::BeginCombo(label, preview.c_str())) {
+        if (allowNone && ImGui::Selectable("None", selected < 0)) {
+            selected = -1;
+            changed = true;
+        }
+        for (int i = 0; i < static_cast<int>(algorithms::COMPLEXITY_OP_COUNT); ++i) {
+            std::string name = operationLabel(static_cast<ComplexityOp>(i));
+            if (ImGui::Selectable(name.c_str(), selected == i)) {
+                selected = i;
+                changed = true;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    return changed;
+}
+
+void ComplexityVisualizer::renderControls() {
+    ImGui::Begin("Complexity Controls");
+
+    ImGui::Text("Operation:");
+    bool changed = operationCombo("##Operation", m_primaryOp, false);
+    ImGui::Text("Compare with:");
+    changed |= operationCombo("##Compare", m_compareOp, true);
+
+    ImGui::Separator();
+
+    ImGui::Text("Sizes (n = 2^k):");
+    int lowest = static_cast<int>(algorithms::COMPLEXITY_MIN_EXPONENT);
+    int highest = static_cast<int>(algorithms::COMPLEXITY_MAX_EXPONENT);
+    changed |= ImGui::SliderInt("Smallest k", &m_minExponent, lowest, highest);
+    changed |= ImGui::SliderInt("Largest k", &m_maxExponent, lowest, highest);
+    m_maxExponent = std::max(m_maxExponent, m_minExponent);
+    if (m_maxExponent > DEFAULT_MAX_EXPONENT) {
+        ImGui::TextWrapped("Large k: the O(n) inserts take a few seconds to build.");
+    }
+
+    if (changed) {
+        runSweep();
+    }
+    if (ImGui::Button(m_job ? "Measuring..." : "Run", ImVec2(-1, 0))) {
+        runSweep();
+    }
+
+    ImGui::Separator();
+
+    ImGui::Text("Cost:");
+    const char* metricNames[algorithms::COMPLEXITY_METRIC_COUNT];
+    for (size_t i = 0; i < algorithms::COMPLEXITY_METRIC_COUNT; ++i) {
+        metricNames[i] = algorithms::complexityMetricName(static_cast<ComplexityMetric>(i));
+    }
+    ImGui::Combo("##Metric", &m_metric, metricNames, static_cast<int>(algorithms::COMPLEXITY_METRIC_COUNT));
+    ImGui::Checkbox("Cost of n operations", &m_totalCost);
+    ImGui::Checkbox("Log scale", &m_logScale);
+
+    ImGui::Text("Reference curves:");
+    for (size_t c = 0; c < CURVE_COUNT; ++c) {
+        if (c > 0) ImGui::SameLine();
+        ImGui::Checkbox(CURVE_NAMES[c], &m_showCurve[c]);
+    }
+
+    if (!OpCounted::countingEnabled()) {
+        ImGui::TextColored(colors::toImGui(colors::mocha::peach),
+            "Operation counters were compiled out (ENABLE_OP_COUNTERS=OFF); only time is measured.");
+    }
+
+    ImGui::Separator();
+
+    if (!m_series.empty()) {
+        const Series& primary = m_series.front();
+        const algorithms::ComplexityOpInfo& info = algorithms::complexityOpInfo(primary.op);
+        ImGui::Text("Expected: %s", info.expected);
+        if (ImGui::BeginTable("##complexity_samples", 3, ImGuiTableFlags_BordersInnerV)) {
+            ImGui::TableSetupColumn("n");
+            ImGui::TableSetupColumn("Cost");
+            ImGui::TableSetupColumn("Growth");
+            ImGui::TableHeadersRow();
+            for (size_t i = 0; i < primary.samples.size(); ++i) {
+                double value = plotValue(primary.samples[i]);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", primary.samples[i].n);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3g", value);
+                ImGui::TableNextColumn();
+                double previous = i > 0 ? plotValue(primary.samples[i - 1]) : 0.0;
+                if (previous > 0.0) {
+                    ImGui::Text("x%.2f", value / previous);
+                } else {
+                    ImGui::TextUnformatted("-");
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TextWrapped("Doubling n multiplies a constant cost by 1, log n by a little over 1, "
+                           "n by 2 and n log n by a little over 2.");
+    }
+
+    ImGui::Separator();
+    ImGui::TextWrapped("Status: %s", m_statusText.c_str());
+
+    ImGui::End();
+}
+
+// ===== IVisualizer =====
+
+void ComplexityVisualizer::play() {
+    runSweep();
+}
+
+void ComplexityVisualizer::pause() {
+    // Sweeps run to completion; reset() cancels one
+}
+
+void ComplexityVisualizer::step() {
+    runSweep();
+}
+
+void ComplexityVisualizer::reset() {
+    if (m_job) {
+        m_job->cancel();
+        m_job.reset();
+    }
+    m_series.clear();
+    m_statusText = "Press Run to measure";
+}
+
+void ComplexityVisualizer::setSpeed(float /*speed*/) {
+    // Sweeps are not animated
+}
+
+std::string ComplexityVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool ComplexityVisualizer::isAnimating() const {
+    return m_job != nullptr;
+}
+
+bool ComplexityVisualizer::isPaused() const {
+    return m_job == nullptr;
+}
+
+} // namespace dsav
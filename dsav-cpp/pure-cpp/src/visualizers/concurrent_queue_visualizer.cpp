@@ -0,0 +1,793 @@
+/**
+ * @file concurrent_queue_visualizer.cpp
+ * @brief Implementation of the concurrent queue visualizer
+ */
+
+#include "visualizers/concurrent_queue_visualizer.hpp"
+#include "renderer.hpp"
+#include "ui_components.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace dsav {
+
+using algorithms::ConcurrentContainer;
+using algorithms::ConcurrentResult;
+using algorithms::ConcurrentWorkload;
+
+namespace {
+
+/// Retries per site below which a cell never looks fully hot
+constexpr float MIN_HEAT_SCALE = 8.0f;
+
+std::string describeRate(double itemsPerSecond) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << itemsPerSecond / 1e6 << " M items/s";
+    return oss.str();
+}
+
+std::string describePercent(double fraction) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << 100.0 * fraction << "%";
+    return oss.str();
+}
+
+} // namespace
+
+ConcurrentQueueVisualizer::ConcurrentQueueVisualizer()
+    : m_statusText("Pick a container and press Run") {
+}
+
+ConcurrentQueueVisualizer::~ConcurrentQueueVisualizer() {
+    // The pending completions capture this; cancelling drops them
+    discardJobs();
+}
+
+void ConcurrentQueueVisualizer::update(float deltaTime) {
+    (void)deltaTime;
+    if (!isRunning()) {
+        return;
+    }
+
+    pollProbe();
+    ContentionThreadStats totals = m_probe->totals();
+    std::ostringstream oss;
+    oss << "Running " << algorithms::concurrentContainerName(m_runWorkload.container) << ": "
+        << totals.pops << " items popped, " << describeRate(m_liveRate) << ", "
+        << describePercent(totals.retryRate()) << " of CAS retried";
+    m_statusText = oss.str();
+}
+
+void ConcurrentQueueVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Whole canvas is the drag/zoom surface
+    ImGui::InvisibleButton("concurrent_canvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    bool isHovered = ImGui::IsItemHovered();
+    bool isActive = ImGui::IsItemActive();
+
+    // Handle mouse drag for panning
+    if (isActive && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        if (!m_isDragging) {
+            m_isDragging = true;
+            m_lastMousePos = ImGui::GetMousePos();
+        } else {
+            ImVec2 currentMousePos = ImGui::GetMousePos();
+            m_cameraOffsetX += currentMousePos.x - m_lastMousePos.x;
+            m_cameraOffsetY += currentMousePos.y - m_lastMousePos.y;
+            m_lastMousePos = currentMousePos;
+        }
+    } else {
+        m_isDragging = false;
+    }
+
+    float sceneWidth = START_X + LANE_LABEL_WIDTH + LANE_WIDTH + LANE_STATS_WIDTH + START_X;
+    float centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+
+    // Handle mouse wheel
+    if (isHovered) {
+        float wheel = ImGui::GetIO().MouseWheel;
+        if (wheel != 0.0f) {
+            if (ImGui::GetIO().KeyCtrl) {
+                // Zoom toward the mouse position
+                float oldZoom = m_zoomLevel;
+                m_zoomLevel = std::clamp(m_zoomLevel + wheel * 0.1f, 0.3f, 3.0f);
+                float zoomRatio = m_zoomLevel / oldZoom;
+                ImVec2 mousePos = ImGui::GetMousePos();
+                float mouseX = mousePos.x - canvasPos.x - centerX;
+                float mouseY = mousePos.y - canvasPos.y;
+                m_cameraOffsetX = mouseX - (mouseX - m_cameraOffsetX) * zoomRatio;
+                m_cameraOffsetY = mouseY - (mouseY - m_cameraOffsetY) * zoomRatio;
+                centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+            } else {
+                // Regular vertical scrolling
+                m_cameraOffsetY += wheel * 50.0f;
+            }
+        }
+    }
+
+    float zoom = m_zoomLevel;
+    auto toScreen = [&](const glm::vec2& world) {
+        return ImVec2(canvasPos.x + centerX + m_cameraOffsetX + world.x * zoom,
+                      canvasPos.y + m_cameraOffsetY + world.y * zoom);
+    };
+    auto toU32 = [](const glm::vec4& color) {
+        return ImGui::ColorConvertFloat4ToU32(colors::toImGui(color));
+    };
+
+    CanvasViewport viewport(canvasPos, canvasSize, zoom);
+    ImU32 textColor = toU32(colors::semantic::textSecondary);
+    ImU32 dimColor = toU32(colors::semantic::textDim);
+    ImU32 panelColor = toU32(colors::semantic::panel);
+
+    // Background
+    drawList->AddRectFilled(
+        canvasPos,
+        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+        toU32(colors::mocha::mantle)
+    );
+
+    ConcurrentWorkload shown = shownWorkload();
+    bool isRing = shown.container == ConcurrentContainer::MpmcRing;
+    size_t siteCount = algorithms::contentionSiteCount(shown.container, shown.ringCapacity);
+    glm::vec2 cell = siteSize();
+    ImVec2 cellSize(cell.x * zoom, cell.y * zoom);
+
+    // ===== CAS sites =====
+    std::ostringstream caption;
+    caption << algorithms::concurrentContainerName(shown.container) << ": ";
+    if (isRing) {
+        caption << siteCount << " cells, heat = CAS retried on the cell recently";
+    } else if (algorithms::isMutexBaseline(shown.container)) {
+        caption << "one lock, heat = contended acquisitions recently";
+    } else {
+        caption << "CAS sites, heat = CAS retried recently";
+    }
+    drawList->AddText(toScreen(glm::vec2(START_X, START_Y - TITLE_HEIGHT)), textColor, caption.str().c_str());
+
+    float maxHeat = MIN_HEAT_SCALE;
+    for (float heat : m_siteHeat) {
+        maxHeat = std::max(maxHeat, heat);
+    }
+
+    m_hoveredSite = SIZE_MAX;
+    ImVec2 mouse = ImGui::GetMousePos();
+    for (size_t s = 0; s < siteCount; ++s) {
+        ImVec2 cellMin = toScreen(sitePosition(s));
+        ImVec2 cellMax(cellMin.x + cellSize.x, cellMin.y + cellSize.y);
+        bool hovered = isHovered && !m_isDragging && mouse.x >= cellMin.x && mouse.x < cellMax.x &&
+                       mouse.y >= cellMin.y && mouse.y < cellMax.y;
+        if (hovered) {
+            m_hoveredSite = s;
+        }
+        if (!viewport.isRectVisible(cellMin, cellMax)) {
+            continue;
+        }
+
+        float heat = s < m_siteHeat.size() ? m_siteHeat[s] / maxHeat : 0.0f;
+        glm::vec4 fill = colors::lerp(colors::semantic::elementBase, colors::semantic::error, std::clamp(heat, 0.0f, 1.0f));
+        drawList->AddRectFilled(cellMin, cellMax, toU32(fill), 4.0f * zoom);
+        drawList->AddRect(cellMin, cellMax,
+                          toU32(hovered ? colors::semantic::active : colors::semantic::elementBorder),
+                          4.0f * zoom, 0, hovered ? 2.0f : 1.0f);
+
+        const char* name = algorithms::contentionSiteName(shown.container, s);
+        if (name != nullptr) {
+            ImVec2 nameSize = ImGui::CalcTextSize(name);
+            drawList->AddText(ImVec2(cellMin.x + (cellSize.x - nameSize.x) * 0.5f, cellMin.y + 6.0f * zoom),
+                              toU32(colors::semantic::textPrimary), name);
+            if (viewport.isFullDetail() && s < m_siteAttempts.size()) {
+                std::string counts = std::to_string(m_siteAttempts[s]) + " / " + std::to_string(m_siteFailures[s]);
+                ImVec2 countSize = ImGui::CalcTextSize(counts.c_str());
+                drawList->AddText(ImVec2(cellMin.x + (cellSize.x - countSize.x) * 0.5f,
+                                         cellMax.y - countSize.y - 6.0f * zoom),
+                                  textColor, counts.c_str());
+            }
+        }
+    }
+
+    // Hovered site: its totals
+    if (m_hoveredSite != SIZE_MAX) {
+        std::ostringstream oss;
+        const char* name = algorithms::contentionSiteName(shown.container, m_hoveredSite);
+        if (name != nullptr) {
+            oss << name;
+        } else {
+            oss << "cell " << m_hoveredSite;
+        }
+        if (m_hoveredSite < m_siteAttempts.size() && m_siteAttempts[m_hoveredSite] != 0) {
+            std::uint64_t attempts = m_siteAttempts[m_hoveredSite];
+            std::uint64_t failures = m_siteFailures[m_hoveredSite];
+            oss << ": " << attempts << (algorithms::isMutexBaseline(shown.container) ? " acquisitions, " : " CAS, ")
+                << failures << " contended ("
+                << describePercent(static_cast<double>(failures) / static_cast<double>(attempts)) << ")";
+        } else {
+            oss << ": untouched";
+        }
+        drawList->AddText(ImVec2(canvasPos.x + 10.0f, canvasPos.y + 10.0f), toU32(colors::semantic::active),
+                          oss.str().c_str());
+    }
+
+    // ===== Thread lanes =====
+    float top = lanesTop();
+    float laneX = START_X + LANE_LABEL_WIDTH;
+    std::ostringstream laneCaption;
+    laneCaption << "Threads: one tick per logged CAS (every " << m_sampleEvery
+                << "), tall red ticks lost the race and retried";
+    drawList->AddText(toScreen(glm::vec2(START_X, top - TITLE_HEIGHT)), textColor, laneCaption.str().c_str());
+
+    size_t threads = m_lanes.size();
+    auto windowNs = static_cast<std::uint64_t>(static_cast<double>(m_windowMs) * 1e6);
+    ImU32 retryColor = toU32(colors::semantic::error);
+    for (size_t t = 0; t < threads; ++t) {
+        float y = top + static_cast<float>(t) * (LANE_HEIGHT + LANE_GAP);
+        ImVec2 stripMin = toScreen(glm::vec2(laneX, y));
+        ImVec2 stripMax = toScreen(glm::vec2(laneX + LANE_WIDTH, y + LANE_HEIGHT));
+        if (!viewport.isRectVisible(toScreen(glm::vec2(START_X, y)),
+                                    toScreen(glm::vec2(laneX + LANE_WIDTH + LANE_STATS_WIDTH, y + LANE_HEIGHT)))) {
+            continue;
+        }
+
+        ImU32 laneColor = toU32(threadColor(t));
+        std::string label = threadLabel(t);
+        ImVec2 labelSize = ImGui::CalcTextSize(label.c_str());
+        drawList->AddText(ImVec2(toScreen(glm::vec2(START_X, y)).x, stripMin.y + (stripMax.y - stripMin.y - labelSize.y) * 0.5f),
+                          laneColor, label.c_str());
+        drawList->AddRectFilled(stripMin, stripMax, panelColor, 3.0f * zoom);
+
+        // Ticks: position = age within the window, newest on the right
+        for (const ContentionEvent& event : m_lanes[t]) {
+            if (event.timeNs > m_nowNs || m_nowNs - event.timeNs > windowNs) {
+                continue;
+            }
+            float age = static_cast<float>(m_nowNs - event.timeNs) / static_cast<float>(windowNs);
+            float x = stripMax.x - age * (stripMax.x - stripMin.x);
+            if (event.success) {
+                float inset = (stripMax.y - stripMin.y) * 0.3f;
+                drawList->AddLine(ImVec2(x, stripMin.y + inset), ImVec2(x, stripMax.y - inset), laneColor, 1.0f);
+            } else {
+                drawList->AddLine(ImVec2(x, stripMin.y), ImVec2(x, stripMax.y), retryColor, 2.0f);
+            }
+        }
+
+        if (t < m_threadStats.size()) {
+            const ContentionThreadStats& stats = m_threadStats[t];
+            std::ostringstream oss;
+            oss << (stats.pushes != 0 ? stats.pushes : stats.pops)
+                << (t < m_runWorkload.producers ? " pushed, " : " popped, ")
+                << describePercent(stats.retryRate()) << " retried";
+            ImVec2 at = toScreen(glm::vec2(laneX + LANE_WIDTH + 12.0f, y));
+            drawList->AddText(ImVec2(at.x, stripMin.y + (stripMax.y - stripMin.y - labelSize.y) * 0.5f),
+                              textColor, oss.str().c_str());
+        }
+    }
+
+    if (threads > 0) {
+        float axisY = top + static_cast<float>(threads) * (LANE_HEIGHT + LANE_GAP);
+        std::ostringstream left;
+        left << "-" << std::fixed << std::setprecision(1) << m_windowMs << " ms";
+        drawList->AddText(toScreen(glm::vec2(laneX, axisY)), dimColor, left.str().c_str());
+        const char* right = isRunning() ? "now" : "end of run";
+        ImVec2 rightSize = ImGui::CalcTextSize(right);
+        ImVec2 rightAt = toScreen(glm::vec2(laneX + LANE_WIDTH, axisY));
+        drawList->AddText(ImVec2(rightAt.x - rightSize.x, rightAt.y), dimColor, right);
+    } else {
+        std::ostringstream hint;
+        hint << "Press Run to start " << shown.producers << " producer and " << shown.consumers
+             << " consumer threads (" << std::thread::hardware_concurrency() << " hardware threads here)";
+        drawList->AddText(toScreen(glm::vec2(START_X, top)), toU32(colors::mocha::overlay1), hint.str().c_str());
+    }
+
+    // Show interaction hints
+    std::string hintText = "Hover a site for its totals | Drag to pan | Ctrl+Scroll to zoom";
+    if (m_zoomLevel != 1.0f) {
+        hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
+    }
+    ImVec2 hintSize = ImGui::CalcTextSize(hintText.c_str());
+    drawList->AddText(
+        ImVec2(canvasPos.x + canvasSize.x - hintSize.x - 10.0f, canvasPos.y + 10.0f),
+        toU32(colors::mocha::overlay0),
+        hintText.c_str()
+    );
+}
+
+void ConcurrentQueueVisualizer::renderControls() {
+    ImGui::Begin("Lock-Free Queue Controls");
+
+    // Status
+    ui::StatusText(m_statusText.c_str(), "info");
+    ImGui::Separator();
+
+    bool busy = isRunning() || isSweeping();
+    ImGui::BeginDisabled(busy);
+
+    // Container selection, indexed by algorithms::ConcurrentContainer
+    ImGui::Text("Container:");
+    const char* containers[algorithms::CONCURRENT_CONTAINER_COUNT];
+    for (size_t i = 0; i < algorithms::CONCURRENT_CONTAINER_COUNT; ++i) {
+        containers[i] = algorithms::concurrentContainerName(static_cast<ConcurrentContainer>(i));
+    }
+    ImGui::Combo("##Container", &m_container, containers, IM_ARRAYSIZE(containers));
+    ui::Tooltip("Michael-Scott queue: linked FIFO, CAS on the tail's next pointer,\n"
+                "then on the tail and the head; popped nodes reclaimed by epochs.\n"
+                "MPMC ring: bounded circular buffer, threads claim positions with a\n"
+                "CAS and hand cells over through per-cell sequence numbers.\n"
+                "Treiber stack: linked LIFO, every op is a CAS on the top.\n"
+                "Mutex Queue/Stack: the single-threaded containers behind one lock");
+
+    ImGui::PushItemWidth(150.0f);
+    ImGui::SliderInt("Producers", &m_producers, 1, MAX_THREADS_PER_SIDE);
+    ImGui::SliderInt("Consumers", &m_consumers, 1, MAX_THREADS_PER_SIDE);
+    ImGui::InputInt("Items / producer", &m_itemsPerProducer, 10000, 100000);
+    m_itemsPerProducer = std::clamp(m_itemsPerProducer, MIN_ITEMS, MAX_ITEMS);
+    if (static_cast<ConcurrentContainer>(m_container) == ConcurrentContainer::MpmcRing) {
+        std::string cells = std::to_string(1 << m_ringCapacityLog2) + " cells";
+        ImGui::SliderInt("Ring size", &m_ringCapacityLog2, MIN_RING_LOG2, MAX_RING_LOG2, cells.c_str());
+        ui::Tooltip("Small rings fill up: producers then spin until a consumer frees a cell");
+    }
+    ImGui::SliderInt("Log every", &m_sampleEvery, 1, 256, "%d-th CAS");
+    ui::Tooltip("Counters are exact; only every n-th CAS of a thread is logged as a tick.\n"
+                "Logs that fill up between frames drop their newest events");
+    ImGui::PopItemWidth();
+
+    ImGui::EndDisabled();
+
+    ImGui::PushItemWidth(150.0f);
+    ImGui::SliderFloat("Lane window", &m_windowMs, 1.0f, 200.0f, "%.1f ms");
+    ImGui::PopItemWidth();
+
+    ImGui::Spacing();
+
+    if (isRunning()) {
+        if (ui::ButtonDanger("Stop", ImVec2(200, 0))) {
+            stopRun();
+        }
+    } else {
+        ImGui::BeginDisabled(isSweeping());
+        if (ui::ButtonPrimary("Run", ImVec2(200, 0))) {
+            startRun();
+        }
+        ImGui::EndDisabled();
+        ui::Tooltip("Start the threads together; each producer pushes its items while\n"
+                    "the consumers pop until everything pushed has been popped");
+    }
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Scaling sweep
+    ImGui::Text("Scaling:");
+    ImGui::BeginDisabled(busy);
+    ImGui::PushItemWidth(150.0f);
+    ImGui::SliderInt("Up to pairs", &m_sweepMaxPairs, 1, MAX_THREADS_PER_SIDE);
+    ImGui::PopItemWidth();
+    ImGui::EndDisabled();
+    if (isSweeping()) {
+        size_t done = m_sweepProgress->done.load(std::memory_order_relaxed);
+        float progress = static_cast<float>(done) / static_cast<float>(std::max<size_t>(m_sweepProgress->total, 1));
+        std::string overlay = std::to_string(done) + " / " + std::to_string(m_sweepProgress->total) + " runs";
+        ImGui::ProgressBar(progress, ImVec2(200, 0), overlay.c_str());
+        if (ui::ButtonDanger("Stop Sweep", ImVec2(200, 0))) {
+            discardJobs();
+            m_statusText = "Sweep stopped";
+        }
+    } else {
+        ImGui::BeginDisabled(isRunning());
+        if (ui::ButtonPrimary("Scaling Sweep", ImVec2(200, 0))) {
+            startSweep();
+        }
+        ImGui::EndDisabled();
+        ui::Tooltip("Run the container and its mutex baseline with 1, 2, 4, ... producers\n"
+                    "and as many consumers, moving the same number of items each time.\n"
+                    "On a machine with few cores the extra threads only take turns");
+    }
+
+    ImGui::Separator();
+
+    // Playback controls
+    ui::PlaybackControls(
+        !isRunning(),
+        [this]() { play(); },
+        [this]() { pause(); },
+        [this]() { step(); },
+        [this]() { reset(); }
+    );
+
+    ImGui::Spacing();
+    ui::SpeedSlider(m_speed, 0.1f, 5.0f);
+    ui::Tooltip("How fast the heat of a site fades");
+
+    ImGui::Separator();
+
+    // Results
+    ImGui::Text("Results (%u hardware threads):", std::thread::hardware_concurrency());
+    if (m_results.empty()) {
+        ImGui::TextDisabled("Finished runs are listed here");
+    } else if (ImGui::BeginTable("##concurrent_results", 5, ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("Container");
+        ImGui::TableSetupColumn("P/C");
+        ImGui::TableSetupColumn("M items/s");
+        ImGui::TableSetupColumn("vs mutex");
+        ImGui::TableSetupColumn("Retry");
+        ImGui::TableHeadersRow();
+        for (size_t i = m_results.size(); i-- > 0;) {
+            const RunRecord& record = m_results[i];
+            const ConcurrentWorkload& w = record.workload;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(algorithms::concurrentContainerName(w.container));
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu/%zu", w.producers, w.consumers);
+            ImGui::TableNextColumn();
+            if (!record.result.checksumOk) {
+                ImGui::TextColored(colors::toImGui(colors::semantic::error), "lost items");
+            } else {
+                ImGui::Text("%.2f%s", record.result.itemsPerSecond() / 1e6, record.result.completed ? "" : " (stopped)");
+            }
+            ImGui::TableNextColumn();
+            double baseline = recordedRate(algorithms::mutexBaselineFor(w.container), w.producers, w.consumers);
+            if (algorithms::isMutexBaseline(w.container) || baseline <= 0.0) {
+                ImGui::TextUnformatted("-");
+            } else {
+                double speedup = record.result.itemsPerSecond() / baseline;
+                ImGui::TextColored(colors::toImGui(speedup >= 1.0 ? colors::semantic::success : colors::semantic::warning),
+                                   "x%.2f", speedup);
+            }
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(describePercent(record.result.totals.retryRate()).c_str());
+        }
+        ImGui::EndTable();
+    }
+    if (!m_results.empty() && ImGui::Button("Clear Results", ImVec2(200, 0))) {
+        m_results.clear();
+    }
+
+    ImGui::End();
+}
+
+// ===== Runs =====
+
+void ConcurrentQueueVisualizer::startRun() {
+    discardJobs();
+
+    m_runWorkload = currentWorkload();
+    size_t sites = algorithms::contentionSiteCount(m_runWorkload.container, m_runWorkload.ringCapacity);
+    size_t threads = m_runWorkload.threadCount();
+    m_probe = std::make_shared<ContentionProbe>(sites, threads, static_cast<size_t>(m_sampleEvery),
+                                                PROBE_LOG_CAPACITY);
+
+    m_siteHeat.assign(sites, 0.0f);
+    m_siteFailures.assign(sites, 0);
+    m_siteAttempts.assign(sites, 0);
+    m_lanes.assign(threads, std::deque<ContentionEvent>());
+    m_threadStats.assign(threads, ContentionThreadStats());
+    m_nowNs = 0;
+    m_lastPollNs = 0;
+    m_lastEventNs = 0;
+    m_lastPollPops = 0;
+    m_liveRate = 0.0;
+
+    // The probe outlives a cancelled run: the job keeps its own reference
+    std::shared_ptr<ContentionProbe> probe = m_probe;
+    ConcurrentWorkload workload = m_runWorkload;
+    m_runJob = jobs::submit([this, probe, workload](const JobToken& token) {
+        ConcurrentResult result;
+        bool ok = algorithms::runConcurrentWorkload(workload, result, probe.get(), &token.cancelledFlag());
+        return JobCompletion([this, result, ok]() { finishRun(result, ok); });
+    });
+
+    m_statusText = std::string("Starting ") + std::to_string(threads) + " threads...";
+}
+
+void ConcurrentQueueVisualizer::stopRun() {
+    if (!isRunning()) {
+        return;
+    }
+    pollProbe();
+    discardJobs();
+    m_nowNs = std::max(m_lastEventNs, m_nowNs);
+    m_statusText = "Run stopped";
+}
+
+void ConcurrentQueueVisualizer::finishRun(const ConcurrentResult& result, bool ok) {
+    m_runJob.reset();
+    pollProbe();
+    // Freeze the lanes at the last logged CAS rather than at the frame that saw the end
+    m_nowNs = m_lastEventNs;
+
+    RunRecord record;
+    record.workload = m_runWorkload;
+    record.result = result;
+    addRecord(record);
+
+    std::ostringstream oss;
+    oss << algorithms::concurrentContainerName(m_runWorkload.container) << ": " << result.itemsPopped
+        << " items in " << std::fixed << std::setprecision(1) << result.seconds * 1e3 << " ms ("
+        << describeRate(result.itemsPerSecond()) << "), " << describePercent(result.totals.retryRate())
+        << " contended";
+    if (!ok && !result.checksumOk) {
+        oss << " - ITEMS LOST OR DUPLICATED";
+    }
+    m_statusText = oss.str();
+}
+
+void ConcurrentQueueVisualizer::startSweep() {
+    discardJobs();
+
+    ConcurrentWorkload base = currentWorkload();
+    std::vector<ConcurrentContainer> containers;
+    if (!algorithms::isMutexBaseline(base.container)) {
+        containers.push_back(algorithms::mutexBaselineFor(base.container));
+    }
+    containers.push_back(base.container);
+
+    // Same number of items at every size
+    size_t totalItems = base.itemsPerProducer * base.producers;
+    std::vector<ConcurrentWorkload> workloads;
+    for (size_t pairs = 1; pairs <= static_cast<size_t>(m_sweepMaxPairs); pairs *= 2) {
+        for (ConcurrentContainer container : containers) {
+            ConcurrentWorkload workload = base;
+            workload.container = container;
+            workload.producers = pairs;
+            workload.consumers = pairs;
+            workload.itemsPerProducer = std::max<size_t>(1, totalItems / pairs);
+            workloads.push_back(workload);
+        }
+    }
+
+    m_sweepProgress = std::make_shared<SweepProgress>();
+    m_sweepProgress->total = workloads.size();
+    std::shared_ptr<SweepProgress> progress = m_sweepProgress;
+    m_sweepJob = jobs::submit([this, workloads, progress](const JobToken& token) {
+        auto records = std::make_shared<std::vector<RunRecord>>();
+        for (const ConcurrentWorkload& workload : workloads) {
+            if (token.isCancelled()) {
+                break;
+            }
+            // Counters only, so the retry rate is known without logging events
+            ContentionProbe probe(algorithms::contentionSiteCount(workload.container, workload.ringCapacity),
+                                  workload.threadCount(), 0, 2);
+            RunRecord record;
+            record.workload = workload;
+            record.fromSweep = true;
+            algorithms::runConcurrentWorkload(workload, record.result, &probe, &token.cancelledFlag());
+            records->push_back(record);
+            progress->done.fetch_add(1, std::memory_order_relaxed);
+        }
+        return JobCompletion([this, records]() { finishSweep(*records); });
+    });
+
+    m_statusText = "Sweeping " + std::string(algorithms::concurrentContainerName(base.container)) + "...";
+}
+
+void ConcurrentQueueVisualizer::finishSweep(std::vector<RunRecord>& records) {
+    m_sweepJob.reset();
+    m_sweepProgress.reset();
+    for (RunRecord& record : records) {
+        addRecord(record);
+    }
+    if (records.empty()) {
+        m_statusText = "Sweep produced no runs";
+        return;
+    }
+
+    // Compare at the largest thread count swept
+    const RunRecord& last = records.back();
+    double rate = last.result.itemsPerSecond();
+    double baseline = recordedRate(algorithms::mutexBaselineFor(last.workload.container),
+                                   last.workload.producers, last.workload.consumers);
+    std::ostringstream oss;
+    oss << "Sweep done: " << algorithms::concurrentContainerName(last.workload.container) << " at "
+        << last.workload.producers << "/" << last.workload.consumers << " threads: " << describeRate(rate);
+    if (!algorithms::isMutexBaseline(last.workload.container) && baseline > 0.0) {
+        oss << ", x" << std::fixed << std::setprecision(2) << rate / baseline << " the mutex baseline";
+    }
+    m_statusText = oss.str();
+}
+
+void ConcurrentQueueVisualizer::discardJobs() {
+    if (m_runJob) {
+        m_runJob->cancel();
+        m_runJob.reset();
+    }
+    if (m_sweepJob) {
+        m_sweepJob->cancel();
+        m_sweepJob.reset();
+    }
+    m_sweepProgress.reset();
+}
+
+void ConcurrentQueueVisualizer::pollProbe() {
+    if (!m_probe) {
+        return;
+    }
+
+    std::uint64_t now = m_probe->elapsedNs();
+    float seconds = static_cast<float>(now - m_lastPollNs) / 1e9f;
+    float decay = std::pow(0.5f, seconds * m_speed / HEAT_HALF_LIFE);
+
+    for (size_t s = 0; s < m_siteHeat.size(); ++s) {
+        std::uint64_t failures = m_probe->siteFailures(s);
+        std::uint64_t fresh = failures >= m_siteFailures[s] ? failures - m_siteFailures[s] : 0;
+        m_siteHeat[s] = m_siteHeat[s] * decay + static_cast<float>(fresh);
+        m_siteFailures[s] = failures;
+        m_siteAttempts[s] = m_probe->siteAttempts(s);
+    }
+
+    std::uint64_t pops = 0;
+    for (size_t t = 0; t < m_threadStats.size(); ++t) {
+        m_threadStats[t] = m_probe->threadStats(t);
+        pops += m_threadStats[t].pops;
+    }
+    if (seconds > 0.0f) {
+        m_liveRate = static_cast<double>(pops - m_lastPollPops) / static_cast<double>(seconds);
+    }
+
+    m_probe->drainEvents([this](const ContentionEvent& event) {
+        if (event.thread >= m_lanes.size()) {
+            return;
+        }
+        std::deque<ContentionEvent>& lane = m_lanes[event.thread];
+        lane.push_back(event);
+        if (lane.size() > MAX_LANE_EVENTS) {
+            lane.pop_front();
+        }
+        m_lastEventNs = std::max(m_lastEventNs, event.timeNs);
+    });
+
+    // Ticks older than the widest window are never drawn again
+    m_nowNs = now;
+    auto keepNs = static_cast<std::uint64_t>(200.0 * 1e6);
+    for (std::deque<ContentionEvent>& lane : m_lanes) {
+        while (!lane.empty() && lane.front().timeNs + keepNs < now) {
+            lane.pop_front();
+        }
+    }
+
+    m_lastPollNs = now;
+    m_lastPollPops = pops;
+}
+
+void ConcurrentQueueVisualizer::addRecord(RunRecord record) {
+    m_results.push_back(std::move(record));
+    if (m_results.size() > MAX_RESULTS) {
+        m_results.erase(m_results.begin());
+    }
+}
+
+double ConcurrentQueueVisualizer::recordedRate(ConcurrentContainer container, size_t producers,
+                                               size_t consumers) const {
+    for (size_t i = m_results.size(); i-- > 0;) {
+        const RunRecord& record = m_results[i];
+        if (record.workload.container == container && record.workload.producers == producers &&
+            record.workload.consumers == consumers && record.result.checksumOk) {
+            return record.result.itemsPerSecond();
+        }
+    }
+    return 0.0;
+}
+
+// ===== IVisualizer =====
+
+void ConcurrentQueueVisualizer::play() {
+    if (!isRunning() && !isSweeping()) {
+        startRun();
+    }
+}
+
+void ConcurrentQueueVisualizer::pause() {
+    stopRun();
+}
+
+void ConcurrentQueueVisualizer::step() {
+    m_statusText = "Real threads cannot be stepped; Run starts them, Pause stops them";
+}
+
+void ConcurrentQueueVisualizer::reset() {
+    discardJobs();
+    m_probe.reset();
+    m_siteHeat.clear();
+    m_siteFailures.clear();
+    m_siteAttempts.clear();
+    m_lanes.clear();
+    m_threadStats.clear();
+    m_nowNs = 0;
+    m_lastEventNs = 0;
+    m_results.clear();
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Lock-free queues reset";
+}
+
+void ConcurrentQueueVisualizer::setSpeed(float speed) {
+    m_speed = speed;
+}
+
+std::string ConcurrentQueueVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool ConcurrentQueueVisualizer::isAnimating() const {
+    return isRunning() || isSweeping();
+}
+
+bool ConcurrentQueueVisualizer::isPaused() const {
+    return !isRunning();
+}
+
+void ConcurrentQueueVisualizer::suspend() {
+    // Threads spinning for a hidden view only steal cores from the one shown
+    stopRun();
+    if (isSweeping()) {
+        discardJobs();
+        m_statusText = "Sweep stopped";
+    }
+}
+
+// ===== Layout =====
+
+ConcurrentWorkload ConcurrentQueueVisualizer::currentWorkload() const {
+    ConcurrentWorkload workload;
+    workload.container = static_cast<ConcurrentContainer>(m_container);
+    workload.producers = static_cast<size_t>(m_producers);
+    workload.consumers = static_cast<size_t>(m_consumers);
+    workload.itemsPerProducer = static_cast<size_t>(m_itemsPerProducer);
+    workload.ringCapacity = size_t{1} << m_ringCapacityLog2;
+    return workload;
+}
+
+ConcurrentWorkload ConcurrentQueueVisualizer::shownWorkload() const {
+    return m_probe ? m_runWorkload : currentWorkload();
+}
+
+glm::vec2 ConcurrentQueueVisualizer::sitePosition(size_t site) const {
+    if (shownWorkload().container == ConcurrentContainer::MpmcRing) {
+        return glm::vec2(START_X + static_cast<float>(site % RING_ROW_CELLS) * (RING_CELL + RING_GAP),
+                         START_Y + static_cast<float>(site / RING_ROW_CELLS) * (RING_CELL + RING_GAP));
+    }
+    return glm::vec2(START_X + static_cast<float>(site) * (SITE_WIDTH + SITE_GAP), START_Y);
+}
+
+glm::vec2 ConcurrentQueueVisualizer::siteSize() const {
+    if (shownWorkload().container == ConcurrentContainer::MpmcRing) {
+        return glm::vec2(RING_CELL, RING_CELL);
+    }
+    return glm::vec2(SITE_WIDTH, SITE_HEIGHT);
+}
+
+float ConcurrentQueueVisualizer::lanesTop() const {
+    ConcurrentWorkload shown = shownWorkload();
+    float sitesHeight = SITE_HEIGHT;
+    if (shown.container == ConcurrentContainer::MpmcRing) {
+        size_t cells = algorithms::contentionSiteCount(shown.container, shown.ringCapacity);
+        size_t rows = (cells + RING_ROW_CELLS - 1) / RING_ROW_CELLS;
+        sitesHeight = static_cast<float>(rows) * (RING_CELL + RING_GAP);
+    }
+    return START_Y + sitesHeight + SECTION_GAP + TITLE_HEIGHT;
+}
+
+glm::vec4 ConcurrentQueueVisualizer::threadColor(size_t thread) const {
+    constexpr size_t PALETTE = sizeof(colors::semantic::lanes) / sizeof(colors::semantic::lanes[0]);
+    // Producers take the first half of the palette, consumers the second
+    size_t producers = m_runWorkload.producers;
+    size_t half = PALETTE / 2;
+    if (thread < producers) {
+        return colors::semantic::lanes[thread % half];
+    }
+    return colors::semantic::lanes[half + (thread - producers) % half];
+}
+
+std::string ConcurrentQueueVisualizer::threadLabel(size_t thread) const {
+    size_t producers = m_runWorkload.producers;
+    return thread < producers ? "P" + std::to_string(thread) : "C" + std::to_string(thread - producers);
+}
+
+} // namespace dsav
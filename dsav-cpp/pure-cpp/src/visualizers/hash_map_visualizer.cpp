@@ -0,0 +1,869 @@
+/**
+ * @file hash_map_visualizer.cpp
+ * @brief Implementation of the hash map visualizer
+ */
+
+#include "visualizers/hash_map_visualizer.hpp"
+#include "ui_components.hpp"
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+
+namespace dsav {
+
+namespace {
+
+/// Keys the visualizer starts with (and returns to on reset)
+constexpr int INITIAL_KEYS[] = {42, 17, 63, 8, 25, 91, 36};
+
+constexpr float STEP_DURATION = 0.18f;
+constexpr float RESTORE_DURATION = 0.3f;
+
+/// Beyond this many highlight steps an operation is shown without its probes
+constexpr size_t MAX_ANIMATED_STEPS = 160;
+
+/**
+ * @brief One cell range to flash, resolved against the tables as they are now
+ */
+struct Highlight {
+    HashEventType type;
+    HashTableId table;
+    size_t first;
+    size_t count;
+    bool valid = true;
+};
+
+glm::vec4 highlightColor(HashEventType type) {
+    switch (type) {
+        case HashEventType::Probe:    return colors::semantic::comparing;
+        case HashEventType::Compare:  return colors::semantic::highlight;
+        case HashEventType::Place:    return colors::semantic::sorted;
+        case HashEventType::Displace: return colors::semantic::swapping;
+        case HashEventType::Shift:    return colors::semantic::swapping;
+        case HashEventType::Erase:    return colors::semantic::error;
+        case HashEventType::Migrate:  return colors::semantic::special;
+        default:                      return colors::semantic::active;
+    }
+}
+
+} // namespace
+
+HashMapVisualizer::HashMapVisualizer()
+    : m_robinHood(INITIAL_CAPACITY)
+    , m_swiss(INITIAL_CAPACITY)
+    , m_statusText("Hash map is empty") {
+    m_animator.bindContainer(m_currentCells);
+    m_animator.bindContainer(m_oldCells);
+
+    m_robinHood.enableEventRecording();
+    m_swiss.enableEventRecording();
+    withMap([this](auto& map) {
+        map.setMaxLoadFactor(m_maxLoad);
+        map.setRehashStep(static_cast<size_t>(m_rehashStep));
+        for (int key : INITIAL_KEYS) {
+            map.insert(key, key);
+        }
+    });
+    syncVisuals();
+}
+
+void HashMapVisualizer::update(float deltaTime) {
+    // Update animations
+    m_animator.update(deltaTime);
+
+    // Update status if not animating
+    if (!isAnimating()) {
+        size_t size = withMap([](const auto& map) { return map.size(); });
+        if (size == 0) {
+            m_statusText = "Hash map is empty";
+        } else {
+            std::ostringstream oss;
+            oss << size << " key(s) in " << m_currentCells.size() << " slots";
+            if (!m_oldCells.empty()) {
+                oss << ", rehashing from " << m_oldCells.size();
+            }
+            m_statusText = oss.str();
+        }
+    }
+}
+
+void HashMapVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Whole canvas is the drag/zoom surface
+    ImGui::InvisibleButton("hash_canvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    bool isHovered = ImGui::IsItemHovered();
+    bool isActive = ImGui::IsItemActive();
+
+    // Handle mouse drag for panning
+    if (isActive && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        if (!m_isDragging) {
+            m_isDragging = true;
+            m_lastMousePos = ImGui::GetMousePos();
+        } else {
+            ImVec2 currentMousePos = ImGui::GetMousePos();
+            m_cameraOffsetX += currentMousePos.x - m_lastMousePos.x;
+            m_cameraOffsetY += currentMousePos.y - m_lastMousePos.y;
+            m_lastMousePos = currentMousePos;
+        }
+    } else {
+        m_isDragging = false;
+    }
+
+    float sceneWidth = START_X + ROW_CELLS * (CELL_WIDTH + CELL_GAP) + START_X;
+    float centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+
+    // Handle mouse wheel
+    if (isHovered) {
+        float wheel = ImGui::GetIO().MouseWheel;
+        if (wheel != 0.0f) {
+            if (ImGui::GetIO().KeyCtrl) {
+                // Zoom toward the mouse position
+                float oldZoom = m_zoomLevel;
+                m_zoomLevel = std::clamp(m_zoomLevel + wheel * 0.1f, 0.3f, 3.0f);
+                float zoomRatio = m_zoomLevel / oldZoom;
+                ImVec2 mousePos = ImGui::GetMousePos();
+                float mouseX = mousePos.x - canvasPos.x - centerX;
+                float mouseY = mousePos.y - canvasPos.y;
+                m_cameraOffsetX = mouseX - (mouseX - m_cameraOffsetX) * zoomRatio;
+                m_cameraOffsetY = mouseY - (mouseY - m_cameraOffsetY) * zoomRatio;
+                centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+            } else {
+                // Regular vertical scrolling
+                m_cameraOffsetY += wheel * 50.0f;
+            }
+        }
+    }
+
+    float zoom = m_zoomLevel;
+    auto toScreen = [&](const glm::vec2& world) {
+        return ImVec2(canvasPos.x + centerX + m_cameraOffsetX + world.x * zoom,
+                      canvasPos.y + m_cameraOffsetY + world.y * zoom);
+    };
+
+    CanvasViewport viewport(canvasPos, canvasSize, zoom);
+    ImU32 dimColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textDim));
+    ImU32 textColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary));
+    ImU32 pathColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::active));
+    ImVec2 cellSize(CELL_WIDTH * zoom, CELL_HEIGHT * zoom);
+
+    // Slot under the mouse, in either table
+    HashTableId hoveredTable = HashTableId::Current;
+    size_t hoveredSlot = SIZE_MAX;
+    if (isHovered && !m_isDragging) {
+        ImVec2 mouse = ImGui::GetMousePos();
+        for (HashTableId table : {HashTableId::Current, HashTableId::Old}) {
+            const std::vector<VisualElement>& cells = table == HashTableId::Old ? m_oldCells : m_currentCells;
+            for (size_t s = 0; s < cells.size() && hoveredSlot == SIZE_MAX; ++s) {
+                ImVec2 cellMin = toScreen(cellPosition(table, s));
+                if (mouse.x >= cellMin.x && mouse.x < cellMin.x + cellSize.x &&
+                    mouse.y >= cellMin.y && mouse.y < cellMin.y + cellSize.y) {
+                    hoveredTable = table;
+                    hoveredSlot = s;
+                }
+            }
+        }
+    }
+    // The hovered cell is drawn with its own border
+    if (hoveredSlot != m_hoveredSlot || (hoveredSlot != SIZE_MAX && hoveredTable != m_hoveredTable)) {
+        m_hoveredTable = hoveredTable;
+        m_hoveredSlot = hoveredSlot;
+        m_sceneVersion++;
+    }
+
+    size_t rehashCursor = withMap([](const auto& map) { return map.rehashCursor(); });
+    size_t keyCount = withMap([](const auto& map) { return map.size(); });
+    float maxLoad = withMap([](const auto& map) { return map.maxLoadFactor(); });
+
+    // Cells the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_currentCells, m_animatedScratch);
+    if (m_animatedScratch != m_animatedCurrent) {
+        m_animatedCurrent.swap(m_animatedScratch);
+        m_sceneVersion++;
+    }
+    animatedCount += m_animator.markAnimated(m_oldCells, m_animatedScratch);
+    if (m_animatedScratch != m_animatedOld) {
+        m_animatedOld.swap(m_animatedScratch);
+        m_sceneVersion++;
+    }
+
+    auto drawCells = [&](HashTableId table, bool animated) {
+        const std::vector<VisualElement>& cells = table == HashTableId::Old ? m_oldCells : m_currentCells;
+        const std::vector<std::uint8_t>& live = table == HashTableId::Old ? m_animatedOld : m_animatedCurrent;
+        for (size_t s = 0; s < cells.size(); ++s) {
+            if ((live[s] != 0) != animated) {
+                continue;
+            }
+            VisualElement elem = cells[s];
+            ImVec2 cellMin = toScreen(elem.position);
+            if (!viewport.isRectVisible(cellMin, ImVec2(cellMin.x + cellSize.x, cellMin.y + cellSize.y + 20.0f * zoom))) {
+                continue;
+            }
+            elem.position = glm::vec2(cellMin.x, cellMin.y);
+            elem.size = glm::vec2(cellSize.x, cellSize.y);
+            if (table == m_hoveredTable && s == m_hoveredSlot) {
+                elem.borderColor = colors::semantic::active;
+            }
+            renderElement(drawList, elem, ImVec2(0, 0), viewport.detail());
+        }
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = zoom;
+    cacheKey.offsetX = centerX + m_cameraOffsetX;
+    cacheKey.offsetY = m_cameraOffsetY;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
+
+        for (HashTableId table : {HashTableId::Current, HashTableId::Old}) {
+            const std::vector<VisualElement>& cells = table == HashTableId::Old ? m_oldCells : m_currentCells;
+            if (cells.empty()) {
+                continue;
+            }
+
+            // Caption
+            std::ostringstream caption;
+            if (table == HashTableId::Current) {
+                size_t used = 0;
+                for (const HashSlotInfo& info : m_currentInfo) {
+                    used += info.occupied ? 1 : 0;
+                }
+                caption << (m_oldCells.empty() ? "Table" : "New table") << ": " << cells.size() << " slots, "
+                        << used << " used, load " << std::fixed << std::setprecision(0)
+                        << 100.0f * static_cast<float>(used) / static_cast<float>(cells.size())
+                        << "% (grows at " << 100.0f * maxLoad << "%)";
+            } else {
+                caption << "Old table: " << rehashCursor << " / " << cells.size() << " slots migrated";
+            }
+            ImVec2 captionPos = toScreen(glm::vec2(START_X, tableTop(table) - TITLE_HEIGHT));
+            drawList->AddText(captionPos, textColor, caption.str().c_str());
+
+            // Row starts, Swiss groups framed
+            for (size_t row = 0; row < rowsFor(cells.size()); ++row) {
+                glm::vec2 rowPos = cellPosition(table, row * ROW_CELLS);
+                if (viewport.isFullDetail()) {
+                    LabelId index = labels::fromIndex(row * ROW_CELLS);
+                    ImVec2 indexSize = labels::textSize(index);
+                    ImVec2 at = toScreen(glm::vec2(rowPos.x - 8.0f, rowPos.y + CELL_HEIGHT * 0.5f));
+                    labels::draw(drawList, ImVec2(at.x - indexSize.x, at.y - indexSize.y * 0.5f), dimColor, index);
+                }
+                if (m_mode == HashProbing::Swiss) {
+                    ImVec2 groupMin = toScreen(glm::vec2(rowPos.x - 2.0f, rowPos.y - 2.0f));
+                    ImVec2 groupMax = toScreen(glm::vec2(rowPos.x + ROW_CELLS * (CELL_WIDTH + CELL_GAP) - CELL_GAP + 2.0f,
+                                                         rowPos.y + CELL_HEIGHT + 2.0f));
+                    drawList->AddRect(groupMin, groupMax, dimColor, 4.0f, 0, 1.0f);
+                }
+            }
+
+            // Resting cells
+            drawCells(table, false);
+
+            // Migration cursor: everything left of it has moved to the new table
+            if (table == HashTableId::Old && rehashCursor < cells.size()) {
+                glm::vec2 at = cellPosition(table, rehashCursor);
+                ImVec2 top = toScreen(glm::vec2(at.x - CELL_GAP * 0.5f, at.y - 6.0f));
+                ImVec2 bottom = toScreen(glm::vec2(at.x - CELL_GAP * 0.5f, at.y + CELL_HEIGHT + 6.0f));
+                drawList->AddLine(top, bottom, ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::special)), 3.0f);
+            }
+        }
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating cells on top
+    if (animatedCount > 0) {
+        drawCells(HashTableId::Current, true);
+        drawCells(HashTableId::Old, true);
+    }
+
+    // Probe path of the hovered key: home slot to where it sits
+    if (m_hoveredSlot != SIZE_MAX) {
+        const std::vector<HashSlotInfo>& infos = m_hoveredTable == HashTableId::Old ? m_oldInfo : m_currentInfo;
+        const HashSlotInfo& info = infos[m_hoveredSlot];
+        std::ostringstream oss;
+        oss << (m_hoveredTable == HashTableId::Old ? "old " : "") << "slot " << m_hoveredSlot;
+        if (!info.occupied) {
+            oss << ": empty";
+        } else if (info.stale) {
+            oss << ": " << (rehashCursor > m_hoveredSlot ? "migrated" : "erased") << ", kept so probes pass it";
+        } else {
+            const auto& entry = withMap([this](const auto& map) -> const HashEntry<int, int>& {
+                return map.slotEntry(m_hoveredTable, m_hoveredSlot);
+            });
+            oss << ": key " << entry.key << ", home " << info.home;
+            if (m_mode == HashProbing::Swiss) {
+                oss << " (group " << info.home / ROW_CELLS << "), " << info.distance / ROW_CELLS
+                    << " group(s) further, tag 0x" << std::hex << std::setw(2) << std::setfill('0')
+                    << static_cast<int>(info.control & 0x7F);
+            } else {
+                oss << ", displaced " << info.distance;
+            }
+
+            ImVec2 homeMin = toScreen(cellPosition(m_hoveredTable, info.home));
+            ImVec2 slotMin = toScreen(cellPosition(m_hoveredTable, m_hoveredSlot));
+            ImVec2 homeTop(homeMin.x + cellSize.x * 0.5f, homeMin.y - 3.0f);
+            ImVec2 slotTop(slotMin.x + cellSize.x * 0.5f, slotMin.y - 3.0f);
+            drawList->AddRect(ImVec2(homeMin.x - 2.0f, homeMin.y - 2.0f),
+                              ImVec2(homeMin.x + cellSize.x + 2.0f, homeMin.y + cellSize.y + 2.0f), pathColor, 4.0f, 0, 2.0f);
+            if (info.home != m_hoveredSlot) {
+                float lift = 28.0f * zoom;
+                drawList->AddBezierCubic(homeTop, ImVec2(homeTop.x, homeTop.y - lift),
+                                         ImVec2(slotTop.x, slotTop.y - lift), slotTop, pathColor, 2.0f);
+            }
+        }
+        drawList->AddText(ImVec2(canvasPos.x + 10.0f, canvasPos.y + 10.0f), pathColor, oss.str().c_str());
+    }
+
+    // Draw info text if empty
+    if (keyCount == 0) {
+        ImVec2 textPos = ImVec2(
+            canvasPos.x + canvasSize.x / 2.0f - 140.0f,
+            canvasPos.y + canvasSize.y / 2.0f
+        );
+        drawList->AddText(
+            textPos,
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+            "Hash map is empty. Use Insert to add keys."
+        );
+    }
+
+    // Show interaction hints
+    std::string hintText = "Hover a slot for its probe path | Drag to pan | Ctrl+Scroll to zoom";
+    if (m_zoomLevel != 1.0f) {
+        hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
+    }
+    ImVec2 hintSize = ImGui::CalcTextSize(hintText.c_str());
+    drawList->AddText(
+        ImVec2(canvasPos.x + canvasSize.x - hintSize.x - 10.0f, canvasPos.y + 10.0f),
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)),
+        hintText.c_str()
+    );
+}
+
+void HashMapVisualizer::renderControls() {
+    ImGui::Begin("Hash Map Controls");
+
+    // Status
+    ui::StatusText(m_statusText.c_str(), "info");
+    ImGui::Separator();
+
+    ImGui::BeginDisabled(isAnimating());
+
+    // Probing scheme
+    ImGui::Text("Probing:");
+    const char* modes[] = {"Robin Hood (linear)", "Swiss (16-slot groups)"};
+    int modeIdx = m_mode == HashProbing::Swiss ? 1 : 0;
+    if (ImGui::Combo("##Probing", &modeIdx, modes, IM_ARRAYSIZE(modes))) {
+        setMode(modeIdx == 1 ? HashProbing::Swiss : HashProbing::RobinHood);
+    }
+    ui::Tooltip("Robin Hood: an insert takes the slot of any key closer to its home,\n"
+                "so probe lengths stay even and erase shifts keys back.\n"
+                "Swiss: 7 hash bits per slot in a control byte; a probe matches a\n"
+                "whole 16-byte group at once and only compares keys whose bits match");
+
+    // Load and rehash tuning
+    ImGui::PushItemWidth(150.0f);
+    if (ImGui::SliderFloat("Max load", &m_maxLoad, RobinHoodMap::MIN_MAX_LOAD, RobinHoodMap::MAX_MAX_LOAD, "%.2f")) {
+        withMap([this](auto& map) { map.setMaxLoadFactor(m_maxLoad); });
+        m_sceneVersion++;  // Table caption shows the threshold
+    }
+    ui::Tooltip("Share of slots in use (Swiss tombstones included) that starts a rehash");
+    if (ImGui::SliderInt("Rehash step", &m_rehashStep, 1, 16)) {
+        withMap([this](auto& map) { map.setRehashStep(static_cast<size_t>(m_rehashStep)); });
+    }
+    ui::Tooltip("Old slots moved to the new table by each insert or remove.\n"
+                "Raised automatically if the new table would fill up first");
+    ImGui::PopItemWidth();
+    ImGui::Separator();
+
+    // Operation mode selection
+    ImGui::Text("Operation Mode:");
+    const char* operations[] = {"Insert", "Find", "Remove"};
+    int currentModeIdx = static_cast<int>(m_currentMode);
+    if (ImGui::Combo("##Mode", &currentModeIdx, operations, IM_ARRAYSIZE(operations))) {
+        m_currentMode = static_cast<OperationMode>(currentModeIdx);
+    }
+
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Key", &m_inputValue);
+    ImGui::PopItemWidth();
+
+    ImGui::Spacing();
+
+    // Execute button
+    size_t size = withMap([](const auto& map) { return map.size(); });
+    bool canExecute = m_currentMode != OperationMode::Insert || size < MAX_ELEMENTS;
+    const char* buttonLabel = "Execute";
+    const char* tooltipText = "";
+    switch (m_currentMode) {
+        case OperationMode::Insert:
+            buttonLabel = "Insert";
+            tooltipText = "Probe from the key's home slot to a free slot (or the key itself)";
+            break;
+        case OperationMode::Find:
+            buttonLabel = "Find";
+            tooltipText = "Probe from the key's home slot until the key, an empty slot or\n"
+                          "(Robin Hood) a key closer to its own home";
+            break;
+        case OperationMode::Remove:
+            buttonLabel = "Remove";
+            tooltipText = "Find the key, then shift the following keys back (Robin Hood)\n"
+                          "or leave a tombstone if its group has no empty slot (Swiss)";
+            break;
+    }
+
+    if (!canExecute) {
+        ImGui::BeginDisabled();
+    }
+    if (ui::ButtonPrimary(buttonLabel, ImVec2(200, 0))) {
+        switch (m_currentMode) {
+            case OperationMode::Insert: insertKey(m_inputValue); break;
+            case OperationMode::Find:   findKey(m_inputValue); break;
+            case OperationMode::Remove: removeKey(m_inputValue); break;
+        }
+    }
+    if (!canExecute) {
+        ImGui::EndDisabled();
+    }
+    ui::Tooltip(tooltipText);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Bulk insertion
+    ImGui::Text("Initialize:");
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Count", &m_initCount);
+    m_initCount = std::clamp(m_initCount, 1, MAX_INIT_COUNT);
+    ImGui::PopItemWidth();
+
+    if (ui::ButtonPrimary("Insert Random", ImVec2(200, 0))) {
+        insertRandom(static_cast<size_t>(m_initCount));
+    }
+    ui::Tooltip("Insert random keys; only where each one lands is animated");
+    if (ImGui::Button("Clear", ImVec2(200, 0))) {
+        clearMap();
+    }
+
+    ImGui::EndDisabled();
+
+    ImGui::Separator();
+
+    // Playback controls
+    ui::PlaybackControls(
+        m_isPaused,
+        [this]() { play(); },
+        [this]() { pause(); },
+        [this]() { step(); },
+        [this]() { reset(); }
+    );
+
+    ImGui::Spacing();
+    ui::SpeedSlider(m_speed, 0.1f, 5.0f);
+
+    ImGui::Separator();
+
+    // Table info
+    ImGui::Text("Map Info:");
+    ImGui::Text("Keys: %zu", size);
+    ImGui::Text("Slots: %zu", m_currentCells.size());
+    if (!m_oldCells.empty()) {
+        size_t cursor = withMap([](const auto& map) { return map.rehashCursor(); });
+        float progress = static_cast<float>(cursor) / static_cast<float>(m_oldCells.size());
+        std::string overlay = "Rehash " + std::to_string(cursor) + " / " + std::to_string(m_oldCells.size());
+        ImGui::ProgressBar(progress, ImVec2(200, 0), overlay.c_str());
+        ui::Tooltip("Lookups check both tables until the old one is drained");
+    }
+
+    ImGui::Separator();
+    ImGui::Text("Last Operation:");
+    if (!m_hasCost) {
+        ImGui::TextDisabled("Run an operation to see its cost");
+    } else {
+        ImGui::BulletText("%s: %llu %s, %llu key comparisons, %llu moves",
+                          m_lastOperation.c_str(),
+                          static_cast<unsigned long long>(m_lastCost.probes),
+                          m_mode == HashProbing::Swiss ? "group loads" : "slots probed",
+                          static_cast<unsigned long long>(m_lastCost.comparisons),
+                          static_cast<unsigned long long>(m_lastCost.moves));
+    }
+
+    ImGui::End();
+}
+
+void HashMapVisualizer::insertKey(int key) {
+    if (withMap([](const auto& map) { return map.size(); }) >= MAX_ELEMENTS) {
+        m_statusText = "Error: Hash map is full!";
+        return;
+    }
+
+    beginOperation();
+    bool inserted = withMap([key](auto& map) { return map.insert(key, key); });
+    endOperation("Insert");
+
+    std::ostringstream oss;
+    oss << (inserted ? "Inserted " : "Already present: ") << key;
+    animateEvents(oss.str());
+}
+
+void HashMapVisualizer::findKey(int key) {
+    beginOperation();
+    bool found = withMap([key](const auto& map) { return map.contains(key); });
+    endOperation("Find");
+
+    std::ostringstream oss;
+    oss << (found ? "Found " : "Not found: ") << key;
+    animateEvents(oss.str());
+}
+
+void HashMapVisualizer::removeKey(int key) {
+    beginOperation();
+    bool removed = withMap([key](auto& map) { return map.remove(key); });
+    endOperation("Remove");
+
+    std::ostringstream oss;
+    oss << (removed ? "Removed " : "Not found: ") << key;
+    animateEvents(oss.str());
+}
+
+void HashMapVisualizer::insertRandom(size_t count) {
+    m_animator.clear();
+    syncVisuals();
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> dist(1, 999);
+
+    beginOperation();
+    size_t inserted = withMap([&](auto& map) {
+        size_t added = 0;
+        for (size_t i = 0; i < count && map.size() < MAX_ELEMENTS; ++i) {
+            int key = dist(gen);
+            added += map.insert(key, key) ? 1 : 0;
+        }
+        return added;
+    });
+    endOperation("Insert random");
+
+    // Only the landing slots: the probes of dozens of inserts would take minutes to watch
+    m_eventCursor = withMap([](const auto& map) { return map.events().endSequence(); });
+    syncVisuals();
+    std::vector<Animation> flash;
+    std::vector<Animation> restore;
+    for (size_t s = 0; s < m_currentCells.size(); ++s) {
+        if (m_currentInfo[s].occupied) {
+            m_currentCells[s].color = colors::semantic::sorted;
+            restore.push_back(createColorAnimation(m_currentCells[s].color, baseColor(m_currentInfo[s]), RESTORE_DURATION));
+        }
+    }
+    if (!restore.empty()) {
+        flash.push_back(createDelayAnimation(STEP_DURATION));
+        m_animator.enqueueParallel(std::move(flash));
+        m_animator.enqueueParallel(std::move(restore));
+    }
+
+    std::ostringstream oss;
+    oss << "Inserted " << inserted << " random key(s)";
+    m_statusText = oss.str();
+}
+
+void HashMapVisualizer::clearMap() {
+    m_animator.clear();
+    withMap([](auto& map) { map.clear(); });
+    m_hasCost = false;
+    syncVisuals();
+    m_statusText = "Hash map cleared";
+}
+
+void HashMapVisualizer::setMode(HashProbing mode) {
+    if (mode == m_mode) {
+        return;
+    }
+    m_animator.clear();
+
+    std::vector<int> keys;
+    withMap([&keys](const auto& map) {
+        map.forEach([&keys](const int& key, const int&) { keys.push_back(key); });
+    });
+    withMap([](auto& map) { map.clear(); });
+
+    m_mode = mode;
+    withMap([&](auto& map) {
+        map.setMaxLoadFactor(m_maxLoad);
+        map.setRehashStep(static_cast<size_t>(m_rehashStep));
+        map.reserve(keys.size());
+        for (int key : keys) {
+            map.insert(key, key);
+        }
+    });
+    m_hasCost = false;
+    syncVisuals();
+
+    std::ostringstream oss;
+    oss << "Re-inserted " << keys.size() << " key(s) with "
+        << (mode == HashProbing::Swiss ? "Swiss" : "Robin Hood") << " probing";
+    m_statusText = oss.str();
+}
+
+void HashMapVisualizer::play() {
+    m_isPaused = false;
+    m_animator.setPaused(false);
+}
+
+void HashMapVisualizer::pause() {
+    m_isPaused = true;
+    m_animator.setPaused(true);
+}
+
+void HashMapVisualizer::step() {
+    m_animator.stepForward();
+}
+
+void HashMapVisualizer::reset() {
+    m_animator.clear();
+    m_robinHood.clear();
+    m_swiss.clear();
+    m_robinHood = RobinHoodMap(INITIAL_CAPACITY);
+    m_swiss = SwissMap(INITIAL_CAPACITY);
+    m_robinHood.enableEventRecording();
+    m_swiss.enableEventRecording();
+
+    m_mode = HashProbing::RobinHood;
+    m_maxLoad = 0.8f;
+    m_rehashStep = 2;
+    withMap([this](auto& map) {
+        map.setMaxLoadFactor(m_maxLoad);
+        map.setRehashStep(static_cast<size_t>(m_rehashStep));
+        for (int key : INITIAL_KEYS) {
+            map.insert(key, key);
+        }
+    });
+    m_hasCost = false;
+    syncVisuals();
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Hash map reset";
+    m_isPaused = true;
+}
+
+void HashMapVisualizer::setSpeed(float speed) {
+    m_speed = speed;
+    m_animator.setSpeedMultiplier(speed);
+}
+
+std::string HashMapVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool HashMapVisualizer::isAnimating() const {
+    return m_animator.hasAnimations();
+}
+
+bool HashMapVisualizer::isPaused() const {
+    return m_isPaused;
+}
+
+void HashMapVisualizer::beginOperation() {
+    withMap([](auto& map) { map.resetOpCounters(); });
+}
+
+void HashMapVisualizer::endOperation(const char* name) {
+    const OpCounters& ops = withMap([](const auto& map) -> const OpCounters& { return map.opCounters(); });
+    m_lastCost.probes = ops.hops;
+    m_lastCost.comparisons = ops.comparisons;
+    m_lastCost.moves = ops.moves;
+    m_lastOperation = name;
+    m_hasCost = true;
+}
+
+void HashMapVisualizer::animateEvents(const std::string& message) {
+    const RingBuffer<HashEvent>& events =
+        withMap([](const auto& map) -> const RingBuffer<HashEvent>& { return map.events(); });
+
+    m_animator.clear();
+    syncVisuals();
+
+    // Lost events (log wrapped) cannot be replayed: show the result only
+    if (events.beginSequence() > m_eventCursor) {
+        m_eventCursor = events.endSequence();
+        m_statusText = message;
+        return;
+    }
+
+    std::vector<Highlight> highlights;
+    for (std::uint64_t seq = m_eventCursor; seq < events.endSequence(); ++seq) {
+        const HashEvent& event = events[static_cast<size_t>(seq - events.beginSequence())];
+        switch (event.type) {
+            case HashEventType::RehashBegin:
+                // The table everything so far happened in is the old one now
+                for (Highlight& h : highlights) {
+                    if (h.table == HashTableId::Current) {
+                        h.table = HashTableId::Old;
+                    }
+                }
+                break;
+            case HashEventType::RehashEnd:
+                for (Highlight& h : highlights) {
+                    if (h.table == HashTableId::Old) {
+                        h.valid = false;
+                    }
+                }
+                break;
+            case HashEventType::Probe:
+                highlights.push_back({event.type, event.table, event.a, event.b});
+                break;
+            case HashEventType::Shift:
+                highlights.push_back({event.type, event.table, event.b, 1});
+                break;
+            case HashEventType::Migrate:
+                highlights.push_back({event.type, HashTableId::Old, event.a, 1});
+                highlights.push_back({HashEventType::Place, HashTableId::Current, event.b, 1});
+                break;
+            default:
+                highlights.push_back({event.type, event.table, event.a, 1});
+                break;
+        }
+    }
+    m_eventCursor = events.endSequence();
+
+    size_t steps = 0;
+    for (const Highlight& h : highlights) {
+        steps += h.valid ? 1 : 0;
+    }
+    if (steps > MAX_ANIMATED_STEPS) {
+        m_statusText = message;
+        return;
+    }
+
+    // One step per event, then every touched cell fades back together
+    std::vector<std::uint8_t> touchedCurrent(m_currentCells.size(), 0);
+    std::vector<std::uint8_t> touchedOld(m_oldCells.size(), 0);
+    for (const Highlight& h : highlights) {
+        if (!h.valid) {
+            continue;
+        }
+        std::vector<VisualElement>& cells = h.table == HashTableId::Old ? m_oldCells : m_currentCells;
+        std::vector<std::uint8_t>& touched = h.table == HashTableId::Old ? touchedOld : touchedCurrent;
+        std::vector<Animation> flash;
+        for (size_t s = h.first; s < h.first + h.count && s < cells.size(); ++s) {
+            flash.push_back(createColorAnimation(cells[s].color, highlightColor(h.type), STEP_DURATION));
+            touched[s] = 1;
+        }
+        if (!flash.empty()) {
+            m_animator.enqueueParallel(std::move(flash));
+        }
+    }
+
+    std::vector<Animation> restore;
+    for (size_t s = 0; s < touchedCurrent.size(); ++s) {
+        if (touchedCurrent[s]) {
+            restore.push_back(createColorAnimation(m_currentCells[s].color, baseColor(m_currentInfo[s]), RESTORE_DURATION));
+        }
+    }
+    for (size_t s = 0; s < touchedOld.size(); ++s) {
+        if (touchedOld[s]) {
+            restore.push_back(createColorAnimation(m_oldCells[s].color, baseColor(m_oldInfo[s]), RESTORE_DURATION));
+        }
+    }
+    if (!restore.empty()) {
+        m_animator.enqueueParallel(std::move(restore));
+    }
+
+    Animation done = createDelayAnimation(0.05f);
+    done.onComplete = [this, message]() {
+        m_statusText = message;
+    };
+    m_animator.enqueue(std::move(done));
+}
+
+void HashMapVisualizer::syncVisuals() {
+    m_sceneVersion++;
+    buildTable(HashTableId::Current, m_currentCells, m_currentInfo);
+    buildTable(HashTableId::Old, m_oldCells, m_oldInfo);
+    m_eventCursor = withMap([](const auto& map) { return map.events().endSequence(); });
+}
+
+void HashMapVisualizer::buildTable(HashTableId table, std::vector<VisualElement>& cells,
+                                   std::vector<HashSlotInfo>& infos) {
+    size_t capacity = withMap([table](const auto& map) { return map.tableCapacity(table); });
+    cells.resize(capacity);
+    infos.resize(capacity);
+
+    for (size_t s = 0; s < capacity; ++s) {
+        HashSlotInfo info = withMap([table, s](const auto& map) { return map.slotInfo(table, s); });
+        infos[s] = info;
+
+        VisualElement& cell = cells[s];
+        cell.position = cellPosition(table, s);
+        cell.size = glm::vec2(CELL_WIDTH, CELL_HEIGHT);
+        cell.color = baseColor(info);
+        cell.borderColor = info.occupied && !info.stale ? colors::semantic::elementBorder : colors::semantic::border;
+        cell.borderWidth = 1.5f;
+        cell.cornerRadius = 4.0f;
+        cell.label = NO_LABEL;
+        cell.sublabel = NO_LABEL;
+
+        if (info.stale) {
+            cell.label = labels::intern(table == HashTableId::Old ? "moved" : "del");
+        } else if (info.occupied) {
+            int key = withMap([table, s](const auto& map) { return map.slotEntry(table, s).key; });
+            cell.label = labels::fromInt(key);
+            std::ostringstream sub;
+            if (m_mode == HashProbing::Swiss) {
+                sub << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(info.control & 0x7F);
+            } else {
+                sub << "d=" << info.distance;
+            }
+            cell.sublabel = labels::intern(sub.str());
+        } else if (m_mode == HashProbing::Swiss && info.control == hash_detail::CTRL_DELETED) {
+            cell.label = labels::intern("del");
+        }
+    }
+}
+
+glm::vec4 HashMapVisualizer::baseColor(const HashSlotInfo& info) const {
+    if (!info.occupied) {
+        return info.control == hash_detail::CTRL_DELETED && m_mode == HashProbing::Swiss
+            ? colors::mocha::surface0 : colors::mocha::base;
+    }
+    if (info.stale) {
+        return colors::mocha::surface0;
+    }
+    // Warmer the further a key sits from home (Swiss distances are whole groups)
+    float far = m_mode == HashProbing::Swiss
+        ? static_cast<float>(info.distance / ROW_CELLS) / 3.0f
+        : static_cast<float>(info.distance) / 6.0f;
+    return colors::lerp(colors::semantic::elementBase, colors::semantic::swapping, std::min(far, 1.0f) * 0.7f);
+}
+
+glm::vec2 HashMapVisualizer::cellPosition(HashTableId table, size_t slot) const {
+    size_t row = slot / ROW_CELLS;
+    size_t col = slot % ROW_CELLS;
+    return glm::vec2(START_X + col * (CELL_WIDTH + CELL_GAP), tableTop(table) + row * ROW_SPACING);
+}
+
+float HashMapVisualizer::tableTop(HashTableId table) const {
+    float top = START_Y + TITLE_HEIGHT;
+    if (table == HashTableId::Old) {
+        top += rowsFor(m_currentCells.size()) * ROW_SPACING + TABLE_GAP;
+    }
+    return top;
+}
+
+size_t HashMapVisualizer::rowsFor(size_t capacity) {
+    return (capacity + ROW_CELLS - 1) / ROW_CELLS;
+}
+
+} // namespace dsav
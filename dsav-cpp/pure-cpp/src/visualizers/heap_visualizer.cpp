@@ -0,0 +1,863 @@
+/**
+ * @file heap_visualizer.cpp
+ * @brief Implementation of the d-ary heap visualizer
+ */
+
+#include "visualizers/heap_visualizer.hpp"
+#include "ui_components.hpp"
+#include <sstream>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <type_traits>
+
+namespace dsav {
+
+namespace {
+
+/// Values the visualizer starts with (and returns to on reset), heapified
+constexpr int INITIAL_VALUES[] = {42, 17, 63, 8, 25, 91, 36, 12, 55, 4};
+
+constexpr float SWAP_DURATION = 0.4f;
+constexpr float FLASH_DURATION = 0.2f;
+constexpr float RELAYOUT_DURATION = 0.3f;
+
+} // namespace
+
+HeapVisualizer::HeapVisualizer()
+    : m_statusText("Heap is empty") {
+    m_animator.bindContainer(m_items);
+
+    m_heap2.enableEventRecording();
+    m_heap3.enableEventRecording();
+    m_heap4.enableEventRecording();
+
+    withHeap([](auto& heap) {
+        heap.heapify(std::vector<int>(std::begin(INITIAL_VALUES), std::end(INITIAL_VALUES)));
+    });
+    syncVisuals();
+}
+
+void HeapVisualizer::update(float deltaTime) {
+    // Update animations
+    m_animator.update(deltaTime);
+
+    // Update status if not animating
+    if (!isAnimating()) {
+        size_t size = heapSize();
+        if (size == 0) {
+            m_statusText = "Heap is empty";
+        } else {
+            std::ostringstream oss;
+            oss << m_arity << "-ary heap has " << size << " element(s) in "
+                << levelsFor(size) << " level(s), min "
+                << withHeap([](const auto& heap) { return heap.at(0); });
+            m_statusText = oss.str();
+        }
+    }
+}
+
+void HeapVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Whole canvas is the drag/zoom surface
+    ImGui::InvisibleButton("heap_canvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    bool isHovered = ImGui::IsItemHovered();
+    bool isActive = ImGui::IsItemActive();
+
+    // Handle mouse drag for panning
+    if (isActive && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        if (!m_isDragging) {
+            m_isDragging = true;
+            m_lastMousePos = ImGui::GetMousePos();
+        } else {
+            ImVec2 currentMousePos = ImGui::GetMousePos();
+            m_cameraOffsetX += currentMousePos.x - m_lastMousePos.x;
+            m_cameraOffsetY += currentMousePos.y - m_lastMousePos.y;
+            m_lastMousePos = currentMousePos;
+        }
+    } else {
+        m_isDragging = false;
+    }
+
+    // Extent of both views, for centering when they fit
+    size_t slots = m_slotHandles.size();
+    size_t levels = std::max<size_t>(m_drawnLevels, 1);
+    float treeWidth = static_cast<float>(std::pow(m_arity, levels - 1)) * LEAF_PITCH;
+    float arrayWidth = slots * CELL_WIDTH;
+    float sceneWidth = START_X + std::max(treeWidth, arrayWidth) + START_X;
+    float centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+
+    // Handle mouse wheel
+    if (isHovered) {
+        float wheel = ImGui::GetIO().MouseWheel;
+        if (wheel != 0.0f) {
+            if (ImGui::GetIO().KeyCtrl) {
+                // Zoom toward the mouse position
+                float oldZoom = m_zoomLevel;
+                m_zoomLevel = std::clamp(m_zoomLevel + wheel * 0.1f, 0.3f, 3.0f);
+                float zoomRatio = m_zoomLevel / oldZoom;
+                ImVec2 mousePos = ImGui::GetMousePos();
+                float mouseX = mousePos.x - canvasPos.x - centerX;
+                float mouseY = mousePos.y - canvasPos.y;
+                m_cameraOffsetX = mouseX - (mouseX - m_cameraOffsetX) * zoomRatio;
+                m_cameraOffsetY = mouseY - (mouseY - m_cameraOffsetY) * zoomRatio;
+                centerX = std::max(0.0f, (canvasSize.x - sceneWidth * m_zoomLevel) / 2.0f);
+            } else {
+                // Regular vertical scrolling
+                m_cameraOffsetY += wheel * 50.0f;
+            }
+        }
+    }
+
+    float zoom = m_zoomLevel;
+    auto toScreen = [&](const glm::vec2& world) {
+        return ImVec2(canvasPos.x + centerX + m_cameraOffsetX + world.x * zoom,
+                      canvasPos.y + m_cameraOffsetY + world.y * zoom);
+    };
+
+    CanvasViewport viewport(canvasPos, canvasSize, zoom);
+    ImU32 edgeColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0));
+    ImU32 dimColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textDim));
+    ImU32 childColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::highlight));
+    ImU32 hoverColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::active));
+    float radius = NODE_RADIUS * zoom;
+    ImVec2 cellSize(CELL_WIDTH * zoom, CELL_HEIGHT * zoom);
+
+    // Slot under the mouse, in either view
+    size_t hoveredSlot = SIZE_MAX;
+    if (isHovered && !m_isDragging) {
+        ImVec2 mouse = ImGui::GetMousePos();
+        for (size_t s = 0; s < slots && hoveredSlot == SIZE_MAX; ++s) {
+            ImVec2 center = toScreen(treeSlotPosition(s, levels));
+            float dx = mouse.x - center.x;
+            float dy = mouse.y - center.y;
+            ImVec2 cellMin = toScreen(arraySlotPosition(s, levels));
+            bool overNode = dx * dx + dy * dy <= radius * radius;
+            bool overCell = mouse.x >= cellMin.x && mouse.x < cellMin.x + cellSize.x &&
+                            mouse.y >= cellMin.y && mouse.y < cellMin.y + cellSize.y;
+            if (overNode || overCell) {
+                hoveredSlot = s;
+            }
+        }
+    }
+    // The hovered slot and its children are drawn with their own borders
+    if (hoveredSlot != m_hoveredSlot) {
+        m_hoveredSlot = hoveredSlot;
+        m_sceneVersion++;
+    }
+    size_t childBegin = m_hoveredSlot == SIZE_MAX ? 0 : std::min(m_hoveredSlot * m_arity + 1, slots);
+    size_t childEnd = m_hoveredSlot == SIZE_MAX ? 0 : std::min(m_hoveredSlot * m_arity + 1 + m_arity, slots);
+
+    // Items the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_items, m_animatedScratch);
+    if (m_animatedScratch != m_animatedItems) {
+        m_animatedItems.swap(m_animatedScratch);
+        m_sceneVersion++;
+    }
+
+    // Elements: the same item drawn as a tree node and as an array cell
+    auto drawItems = [&](bool animated) {
+        for (size_t s = 0; s < slots; ++s) {
+            Handle handle = m_slotHandles[s];
+            if (handle >= m_items.size() || !m_items[handle].active || (m_animatedItems[handle] != 0) != animated) {
+                continue;
+            }
+            const VisualHeapItem& item = m_items[handle];
+            bool isChild = s >= childBegin && s < childEnd;
+            glm::vec4 border = s == m_hoveredSlot ? colors::semantic::active
+                             : isChild ? colors::semantic::highlight : item.borderColor;
+
+            ImVec2 center = toScreen(item.treePosition);
+            if (viewport.isCircleVisible(center, radius)) {
+                drawList->AddCircleFilled(center, radius,
+                    ImGui::ColorConvertFloat4ToU32(colors::toImGui(item.color)), viewport.circleSegments());
+                drawList->AddCircle(center, radius,
+                    ImGui::ColorConvertFloat4ToU32(colors::toImGui(border)), viewport.circleSegments(), 2.0f);
+                if (viewport.isFullDetail()) {
+                    labels::drawCentered(drawList, center,
+                        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::text)), item.label);
+                }
+            }
+
+            ImVec2 cellMin = toScreen(item.arrayPosition);
+            if (viewport.isRectVisible(cellMin, ImVec2(cellMin.x + cellSize.x, cellMin.y + cellSize.y))) {
+                VisualElement elem;
+                elem.position = glm::vec2(cellMin.x, cellMin.y);
+                elem.size = glm::vec2(cellSize.x, cellSize.y);
+                elem.color = item.color;
+                elem.borderColor = border;
+                elem.borderWidth = 2.0f;
+                elem.cornerRadius = 4.0f;
+                elem.label = item.label;
+                renderElement(drawList, elem, ImVec2(0, 0), viewport.detail());
+            }
+        }
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = zoom;
+    cacheKey.offsetX = centerX + m_cameraOffsetX;
+    cacheKey.offsetY = m_cameraOffsetY;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
+
+        // Tree edges join fixed slot positions; elements travel along them
+        for (size_t s = 1; s < slots; ++s) {
+            ImVec2 from = toScreen(treeSlotPosition((s - 1) / m_arity, levels));
+            ImVec2 to = toScreen(treeSlotPosition(s, levels));
+            if (viewport.isSegmentVisible(from, to)) {
+                drawList->AddLine(from, to, edgeColor, 1.5f);
+            }
+        }
+
+        // Array frame: one outlined slot per element, index below, levels bracketed underneath
+        for (size_t s = 0; s < slots; ++s) {
+            ImVec2 cellMin = toScreen(arraySlotPosition(s, levels));
+            ImVec2 cellMax(cellMin.x + cellSize.x, cellMin.y + cellSize.y);
+            if (!viewport.isRectVisible(cellMin, ImVec2(cellMax.x, cellMax.y + 40.0f * zoom))) {
+                continue;
+            }
+            drawList->AddRect(cellMin, cellMax, dimColor, 0.0f, 0, 1.0f);
+            if (viewport.isFullDetail()) {
+                LabelId index = labels::fromIndex(s);
+                ImVec2 indexSize = labels::textSize(index);
+                labels::draw(drawList, ImVec2(cellMin.x + (cellSize.x - indexSize.x) * 0.5f, cellMax.y + 4.0f),
+                             dimColor, index);
+            }
+        }
+        for (size_t level = 0; level < m_drawnLevels; ++level) {
+            size_t first = levelStart(level);
+            size_t last = std::min(levelStart(level + 1), slots);
+            if (first >= last) {
+                break;
+            }
+            glm::vec2 left = arraySlotPosition(first, levels);
+            glm::vec2 right = arraySlotPosition(last - 1, levels);
+            float y = left.y + CELL_HEIGHT + 26.0f;
+            ImVec2 from = toScreen(glm::vec2(left.x + 3.0f, y));
+            ImVec2 to = toScreen(glm::vec2(right.x + CELL_WIDTH - 3.0f, y));
+            drawList->AddLine(from, to, edgeColor, 2.0f);
+            if (viewport.isFullDetail()) {
+                std::string text = "level " + std::to_string(level);
+                drawList->AddText(ImVec2(from.x, from.y + 3.0f), dimColor, text.c_str());
+            }
+        }
+
+        drawItems(false);
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating items on top
+    if (animatedCount > 0) {
+        drawItems(true);
+    }
+
+    // The hovered slot's children are one contiguous run of the array
+    if (childBegin < childEnd) {
+        ImVec2 runMin = toScreen(arraySlotPosition(childBegin, levels));
+        ImVec2 runMax = toScreen(arraySlotPosition(childEnd - 1, levels));
+        runMax = ImVec2(runMax.x + cellSize.x, runMax.y + cellSize.y);
+        drawList->AddRect(ImVec2(runMin.x - 3.0f, runMin.y - 3.0f), ImVec2(runMax.x + 3.0f, runMax.y + 3.0f),
+                          childColor, 4.0f, 0, 2.0f);
+        ImVec2 parentMin = toScreen(arraySlotPosition(m_hoveredSlot, levels));
+        ImVec2 parentTop(parentMin.x + cellSize.x * 0.5f, parentMin.y - 3.0f);
+        ImVec2 runTop((runMin.x + runMax.x) * 0.5f, runMin.y - 3.0f);
+        float lift = 24.0f * zoom;
+        drawList->AddBezierCubic(parentTop, ImVec2(parentTop.x, parentTop.y - lift),
+                                 ImVec2(runTop.x, runTop.y - lift), runTop, hoverColor, 1.5f);
+    }
+
+    // Draw info text if empty
+    if (slots == 0) {
+        ImVec2 textPos = ImVec2(
+            canvasPos.x + canvasSize.x / 2.0f - 120.0f,
+            canvasPos.y + canvasSize.y / 2.0f
+        );
+        drawList->AddText(
+            textPos,
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+            "Heap is empty. Use Insert to add values."
+        );
+        return;
+    }
+
+    // Show interaction hints
+    std::string hintText = "Hover a slot to see its children | Drag to pan | Ctrl+Scroll to zoom";
+    if (m_zoomLevel != 1.0f) {
+        hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
+    }
+    ImVec2 hintSize = ImGui::CalcTextSize(hintText.c_str());
+    drawList->AddText(
+        ImVec2(canvasPos.x + canvasSize.x - hintSize.x - 10.0f, canvasPos.y + 10.0f),
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)),
+        hintText.c_str()
+    );
+    if (m_hoveredSlot != SIZE_MAX) {
+        std::ostringstream oss;
+        oss << "slot " << m_hoveredSlot << ": parent " ;
+        if (m_hoveredSlot == 0) {
+            oss << "none";
+        } else {
+            oss << (m_hoveredSlot - 1) / m_arity;
+        }
+        if (childBegin < childEnd) {
+            oss << ", children " << childBegin << ".." << childEnd - 1;
+        } else {
+            oss << ", leaf";
+        }
+        drawList->AddText(ImVec2(canvasPos.x + 10.0f, canvasPos.y + 10.0f), hoverColor, oss.str().c_str());
+    }
+}
+
+void HeapVisualizer::renderControls() {
+    ImGui::Begin("Heap Controls");
+
+    // Status
+    ui::StatusText(m_statusText.c_str(), "info");
+    ImGui::Separator();
+
+    // Arity
+    ImGui::Text("Children per node:");
+    const char* arities[] = {"2 (binary heap)", "3", "4"};
+    int arityIdx = m_arity - MIN_ARITY;
+    ImGui::BeginDisabled(isAnimating());
+    if (ImGui::Combo("##Arity", &arityIdx, arities, IM_ARRAYSIZE(arities))) {
+        setArity(arityIdx + MIN_ARITY);
+    }
+    ImGui::EndDisabled();
+    ui::Tooltip("Rebuilds the current elements with heapify.\n"
+                "A wider heap has fewer levels, and the children of a slot\n"
+                "stay next to each other in the array (one cache line or two)");
+    ImGui::Separator();
+
+    // Operation mode selection
+    ImGui::Text("Operation Mode:");
+    const char* modes[] = {"Insert", "Extract Min", "Decrease Key"};
+    int currentModeIdx = static_cast<int>(m_currentMode);
+    if (ImGui::Combo("##Mode", &currentModeIdx, modes, IM_ARRAYSIZE(modes))) {
+        m_currentMode = static_cast<OperationMode>(currentModeIdx);
+    }
+
+    ImGui::PushItemWidth(150.0f);
+    if (m_currentMode == OperationMode::DecreaseKey) {
+        ImGui::InputInt("Slot", &m_inputSlot);
+        m_inputSlot = std::clamp(m_inputSlot, 0, static_cast<int>(std::max<size_t>(heapSize(), 1) - 1));
+        ImGui::InputInt("New Key", &m_inputValue);
+    } else if (m_currentMode == OperationMode::Insert) {
+        ImGui::InputInt("Value", &m_inputValue);
+    }
+    ImGui::PopItemWidth();
+
+    ImGui::Spacing();
+
+    // Execute button
+    ImGui::BeginDisabled(isAnimating());
+
+    bool canExecute = m_currentMode == OperationMode::Insert ? heapSize() < MAX_ELEMENTS : heapSize() > 0;
+    const char* buttonLabel = "Execute";
+    const char* tooltipText = "";
+    switch (m_currentMode) {
+        case OperationMode::Insert:
+            buttonLabel = "Insert";
+            tooltipText = "Append the value and sift it up past larger parents";
+            break;
+        case OperationMode::ExtractMin:
+            buttonLabel = "Extract Min";
+            tooltipText = "Remove the root, move the last element up and sift it down";
+            break;
+        case OperationMode::DecreaseKey:
+            buttonLabel = "Decrease Key";
+            tooltipText = "Lower the key at a slot and sift it up (found through the position index)";
+            break;
+    }
+
+    if (!canExecute) {
+        ImGui::BeginDisabled();
+    }
+    if (ui::ButtonPrimary(buttonLabel, ImVec2(200, 0))) {
+        switch (m_currentMode) {
+            case OperationMode::Insert:      insertValue(m_inputValue); break;
+            case OperationMode::ExtractMin:  extractTop(); break;
+            case OperationMode::DecreaseKey: decreaseKey(static_cast<size_t>(m_inputSlot), m_inputValue); break;
+        }
+    }
+    if (!canExecute) {
+        ImGui::EndDisabled();
+    }
+
+    ImGui::EndDisabled();
+    ui::Tooltip(tooltipText);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Initialize operation
+    ImGui::Text("Initialize:");
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Count", &m_initCount);
+    m_initCount = std::clamp(m_initCount, 1, MAX_INIT_COUNT);
+    ImGui::PopItemWidth();
+
+    ImGui::BeginDisabled(isAnimating());
+    if (ui::ButtonPrimary("Heapify Random", ImVec2(200, 0))) {
+        initializeRandom(static_cast<size_t>(m_initCount));
+    }
+    ui::Tooltip("Fill the array with random values, then sift down every internal slot,\n"
+                "last first (Floyd's O(n) construction)");
+    if (ImGui::Button("Clear", ImVec2(200, 0))) {
+        clearHeap();
+    }
+    ImGui::EndDisabled();
+
+    ImGui::Separator();
+
+    // Playback controls
+    ui::PlaybackControls(
+        m_isPaused,
+        [this]() { play(); },
+        [this]() { pause(); },
+        [this]() { step(); },
+        [this]() { reset(); }
+    );
+
+    ImGui::Spacing();
+    ui::SpeedSlider(m_speed, 0.1f, 5.0f);
+
+    ImGui::Separator();
+
+    // Heap info
+    size_t size = heapSize();
+    ImGui::Text("Heap Info (%d-ary, min on top):", m_arity);
+    ImGui::Text("Elements: %zu", size);
+    ImGui::Text("Levels: %zu", levelsFor(size));
+
+    ImGui::Separator();
+    ImGui::Text("Last Operation:");
+    if (!m_hasCost) {
+        ImGui::TextDisabled("Run an operation to see its cost");
+    } else {
+        ImGui::BulletText("%s: %llu comparisons, %llu moves, %llu levels",
+                          m_lastOperation.c_str(),
+                          static_cast<unsigned long long>(m_lastCost.comparisons),
+                          static_cast<unsigned long long>(m_lastCost.moves),
+                          static_cast<unsigned long long>(m_lastCost.levels));
+    }
+    if (m_hasBuildComparison) {
+        ImGui::BulletText("Heapify: %llu comparisons",
+                          static_cast<unsigned long long>(m_heapifyCost.comparisons));
+        ImGui::BulletText("Same values pushed one by one: %llu comparisons",
+                          static_cast<unsigned long long>(m_pushesCost.comparisons));
+        ui::Tooltip("Heapify sifts down from the bottom, where most slots are and where\n"
+                    "sifts are short; pushes sift up from the bottom, the long way");
+    }
+
+    ImGui::End();
+}
+
+void HeapVisualizer::insertValue(int value) {
+    if (heapSize() >= MAX_ELEMENTS) {
+        m_statusText = "Error: Heap is full!";
+        return;
+    }
+
+    beginOperation();
+    Handle handle = withHeap([value](auto& heap) { return heap.push(value); });
+    endOperation("Insert");
+
+    std::ostringstream oss;
+    oss << "Inserted " << value << " (rose " << m_lastCost.levels << " level(s))";
+    animateEvents(handle, oss.str());
+}
+
+void HeapVisualizer::extractTop() {
+    if (heapSize() == 0) {
+        m_statusText = "Error: Heap is empty!";
+        return;
+    }
+
+    beginOperation();
+    int top = withHeap([](auto& heap) { return heap.pop()->value; });
+    endOperation("Extract min");
+
+    std::ostringstream oss;
+    oss << "Extracted " << top << " (last element sank " << m_lastCost.levels << " level(s))";
+    animateEvents(IndexedDaryHeap<int>::NO_HANDLE, oss.str());
+}
+
+void HeapVisualizer::decreaseKey(size_t slot, int value) {
+    if (slot >= heapSize()) {
+        m_statusText = "Error: No element at that slot!";
+        return;
+    }
+    int current = withHeap([slot](const auto& heap) { return heap.at(slot); });
+    if (value > current) {
+        std::ostringstream oss;
+        oss << "Error: " << value << " is larger than the key at slot " << slot << " (" << current << ")";
+        m_statusText = oss.str();
+        return;
+    }
+
+    beginOperation();
+    withHeap([slot, value](auto& heap) { heap.decreaseKey(heap.handleAt(slot), value); });
+    endOperation("Decrease key");
+
+    std::ostringstream oss;
+    oss << "Decreased slot " << slot << " from " << current << " to " << value
+        << " (rose " << m_lastCost.levels << " level(s))";
+    animateEvents(IndexedDaryHeap<int>::NO_HANDLE, oss.str());
+}
+
+void HeapVisualizer::initializeRandom(size_t count) {
+    m_animator.clear();
+    syncVisuals();
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> dist(1, 99);
+    std::vector<int> values(count);
+    for (int& value : values) {
+        value = dist(gen);
+    }
+
+    // What building the same heap by n pushes would have cost
+    withHeap([&](auto& heap) {
+        std::decay_t<decltype(heap)> scratch;
+        for (int value : values) {
+            scratch.push(value);
+        }
+        m_pushesCost.comparisons = scratch.opCounters().comparisons;
+        m_pushesCost.moves = scratch.opCounters().moves;
+        m_pushesCost.levels = scratch.opCounters().hops;
+    });
+
+    beginOperation();
+    withHeap([&values](auto& heap) { heap.heapify(values); });
+    endOperation("Heapify");
+    m_heapifyCost = m_lastCost;
+    m_hasBuildComparison = true;
+
+    std::ostringstream oss;
+    oss << "Heapified " << count << " random values with " << m_heapifyCost.comparisons
+        << " comparisons (" << m_pushesCost.comparisons << " for " << count << " pushes)";
+    animateEvents(IndexedDaryHeap<int>::NO_HANDLE, oss.str());
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+}
+
+void HeapVisualizer::clearHeap() {
+    m_animator.clear();
+    withHeap([](auto& heap) { heap.clear(); });
+    m_hasCost = false;
+    m_hasBuildComparison = false;
+    syncVisuals();
+    m_statusText = "Heap cleared";
+}
+
+void HeapVisualizer::setArity(int arity) {
+    arity = std::clamp(arity, MIN_ARITY, MAX_ARITY);
+    if (arity == m_arity) {
+        return;
+    }
+    m_animator.clear();
+
+    // The old array, slot by slot, becomes the new heap's unordered input
+    std::vector<int> values = withHeap([](const auto& heap) { return heap.data(); });
+    withHeap([](auto& heap) { heap.clear(); });
+    m_arity = arity;
+    syncVisuals();
+
+    beginOperation();
+    withHeap([&values](auto& heap) { heap.heapify(values); });
+    endOperation("Heapify");
+
+    std::ostringstream oss;
+    oss << "Rebuilt as a " << arity << "-ary heap: " << levelsFor(values.size()) << " level(s), "
+        << m_lastCost.comparisons << " comparisons";
+    animateEvents(IndexedDaryHeap<int>::NO_HANDLE, oss.str());
+}
+
+void HeapVisualizer::play() {
+    m_isPaused = false;
+    m_animator.setPaused(false);
+}
+
+void HeapVisualizer::pause() {
+    m_isPaused = true;
+    m_animator.setPaused(true);
+}
+
+void HeapVisualizer::step() {
+    m_animator.stepForward();
+}
+
+void HeapVisualizer::reset() {
+    clearHeap();
+    m_arity = 2;
+    withHeap([](auto& heap) {
+        heap.heapify(std::vector<int>(std::begin(INITIAL_VALUES), std::end(INITIAL_VALUES)));
+    });
+    syncVisuals();
+
+    m_cameraOffsetX = 0.0f;
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Heap reset";
+    m_isPaused = true;
+}
+
+void HeapVisualizer::setSpeed(float speed) {
+    m_speed = speed;
+    m_animator.setSpeedMultiplier(speed);
+}
+
+std::string HeapVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool HeapVisualizer::isAnimating() const {
+    return m_animator.hasAnimations();
+}
+
+bool HeapVisualizer::isPaused() const {
+    return m_isPaused;
+}
+
+size_t HeapVisualizer::heapSize() const {
+    return withHeap([](const auto& heap) { return heap.size(); });
+}
+
+void HeapVisualizer::beginOperation() {
+    withHeap([](auto& heap) { heap.resetOpCounters(); });
+}
+
+void HeapVisualizer::endOperation(const char* name) {
+    const OpCounters& ops = withHeap([](const auto& heap) -> const OpCounters& { return heap.opCounters(); });
+    m_lastCost.comparisons = ops.comparisons;
+    m_lastCost.moves = ops.moves;
+    m_lastCost.levels = ops.hops;
+    m_lastOperation = name;
+    m_hasCost = true;
+}
+
+void HeapVisualizer::animateEvents(Handle pushed, const std::string& message) {
+    // Slots and levels below take their end state now, ahead of the animations
+    m_sceneVersion++;
+
+    const RingBuffer<HeapEvent>& events =
+        withHeap([](const auto& heap) -> const RingBuffer<HeapEvent>& { return heap.events(); });
+
+    // Lost events (log wrapped) cannot be replayed: show the result instead
+    if (events.beginSequence() > m_eventCursor) {
+        syncVisuals();
+        m_statusText = message;
+        return;
+    }
+
+    for (std::uint64_t seq = m_eventCursor; seq < events.endSequence(); ++seq) {
+        const HeapEvent& event = events[static_cast<size_t>(seq - events.beginSequence())];
+
+        switch (event.type) {
+            case HeapEventType::Push: {
+                size_t levels = levelsFor(m_slotHandles.size() + 1);
+                if (levels != m_drawnLevels) {
+                    enqueueRelayout(levels);
+                }
+                m_slotHandles.push_back(pushed);
+                VisualHeapItem& item = activateItem(pushed, event.a, levels);
+                item.label = labels::fromInt(withHeap([pushed](const auto& heap) { return *heap.valueOf(pushed); }));
+                item.color = colors::semantic::sorted;
+                m_animator.enqueue(createColorAnimation(item.color, colors::semantic::elementBase, FLASH_DURATION));
+                break;
+            }
+            case HeapEventType::Swap: {
+                Handle a = m_slotHandles[event.a];
+                Handle b = m_slotHandles[event.b];
+                VisualHeapItem& itemA = m_items[a];
+                VisualHeapItem& itemB = m_items[b];
+                std::vector<Animation> swap;
+                swap.push_back(createMoveAnimation(itemA.treePosition, treeSlotPosition(event.b, m_drawnLevels), SWAP_DURATION));
+                swap.push_back(createMoveAnimation(itemA.arrayPosition, arraySlotPosition(event.b, m_drawnLevels), SWAP_DURATION));
+                swap.push_back(createMoveAnimation(itemB.treePosition, treeSlotPosition(event.a, m_drawnLevels), SWAP_DURATION));
+                swap.push_back(createMoveAnimation(itemB.arrayPosition, arraySlotPosition(event.a, m_drawnLevels), SWAP_DURATION));
+                swap.push_back(createColorAnimation(itemA.color, colors::semantic::swapping, FLASH_DURATION));
+                swap.push_back(createColorAnimation(itemB.color, colors::semantic::swapping, FLASH_DURATION));
+                m_animator.enqueueParallel(std::move(swap));
+
+                std::vector<Animation> restore;
+                restore.push_back(createColorAnimation(itemA.color, colors::semantic::elementBase, FLASH_DURATION));
+                restore.push_back(createColorAnimation(itemB.color, colors::semantic::elementBase, FLASH_DURATION));
+                m_animator.enqueueParallel(std::move(restore));
+
+                std::swap(m_slotHandles[event.a], m_slotHandles[event.b]);
+                break;
+            }
+            case HeapEventType::Pop: {
+                Handle handle = m_slotHandles[event.a];
+                Animation fade = createColorAnimation(m_items[handle].color, colors::semantic::error, SWAP_DURATION);
+                fade.onComplete = [this, handle]() {
+                    m_items[handle].active = false;
+                };
+                m_animator.enqueue(std::move(fade));
+                m_slotHandles.pop_back();
+
+                size_t levels = levelsFor(m_slotHandles.size());
+                if (levels != m_drawnLevels && levels > 0) {
+                    enqueueRelayout(levels);
+                }
+                m_drawnLevels = levels;
+                break;
+            }
+            case HeapEventType::Update: {
+                Handle handle = m_slotHandles[event.a];
+                VisualHeapItem& item = m_items[handle];
+                item.label = labels::fromInt(withHeap([handle](const auto& heap) { return *heap.valueOf(handle); }));
+                m_animator.enqueue(createColorAnimation(item.color, colors::semantic::comparing, FLASH_DURATION));
+                m_animator.enqueue(createColorAnimation(item.color, colors::semantic::elementBase, FLASH_DURATION));
+                break;
+            }
+            case HeapEventType::Rebuild: {
+                // Heapify numbers handles by input position: handle i starts in slot i
+                for (VisualHeapItem& item : m_items) {
+                    item.active = false;
+                }
+                m_slotHandles.resize(event.a);
+                size_t levels = levelsFor(event.a);
+                m_drawnLevels = levels;
+                std::vector<Animation> appear;
+                for (size_t s = 0; s < event.a; ++s) {
+                    Handle handle = static_cast<Handle>(s);
+                    m_slotHandles[s] = handle;
+                    VisualHeapItem& item = activateItem(handle, s, levels);
+                    item.label = labels::fromInt(withHeap([handle](const auto& heap) { return *heap.valueOf(handle); }));
+                    item.color = colors::semantic::comparing;
+                }
+                for (size_t s = 0; s < event.a; ++s) {
+                    appear.push_back(createColorAnimation(m_items[s].color, colors::semantic::elementBase, FLASH_DURATION));
+                }
+                if (!appear.empty()) {
+                    m_animator.enqueueParallel(std::move(appear));
+                }
+                break;
+            }
+        }
+    }
+    m_eventCursor = events.endSequence();
+
+    // The replay must land on the heap's own order; if not, trust the heap
+    bool matches = m_slotHandles.size() == heapSize();
+    for (size_t s = 0; matches && s < m_slotHandles.size(); ++s) {
+        matches = m_slotHandles[s] == withHeap([s](const auto& heap) { return heap.handleAt(s); });
+    }
+    if (!matches) {
+        m_animator.clear();
+        syncVisuals();
+        m_statusText = message;
+        return;
+    }
+
+    Animation done = createDelayAnimation(0.05f);
+    done.onComplete = [this, message]() {
+        m_statusText = message;
+    };
+    m_animator.enqueue(std::move(done));
+}
+
+void HeapVisualizer::syncVisuals() {
+    m_sceneVersion++;
+    for (VisualHeapItem& item : m_items) {
+        item.active = false;
+    }
+
+    size_t size = heapSize();
+    size_t levels = levelsFor(size);
+    m_slotHandles.resize(size);
+    for (size_t s = 0; s < size; ++s) {
+        Handle handle = withHeap([s](const auto& heap) { return heap.handleAt(s); });
+        m_slotHandles[s] = handle;
+        VisualHeapItem& item = activateItem(handle, s, levels);
+        item.label = labels::fromInt(withHeap([s](const auto& heap) { return heap.at(s); }));
+    }
+    m_drawnLevels = levels;
+    m_eventCursor = withHeap([](const auto& heap) { return heap.events().endSequence(); });
+}
+
+VisualHeapItem& HeapVisualizer::activateItem(Handle handle, size_t slot, size_t levels) {
+    if (handle >= m_items.size()) {
+        m_items.resize(handle + 1);
+    }
+    VisualHeapItem& item = m_items[handle];
+    item.treePosition = treeSlotPosition(slot, levels);
+    item.arrayPosition = arraySlotPosition(slot, levels);
+    item.color = colors::semantic::elementBase;
+    item.borderColor = colors::semantic::elementBorder;
+    item.active = true;
+    return item;
+}
+
+void HeapVisualizer::enqueueRelayout(size_t levels) {
+    m_drawnLevels = levels;
+    std::vector<Animation> moves;
+    for (size_t s = 0; s < m_slotHandles.size(); ++s) {
+        VisualHeapItem& item = m_items[m_slotHandles[s]];
+        moves.push_back(createMoveAnimation(item.treePosition, treeSlotPosition(s, levels), RELAYOUT_DURATION));
+        moves.push_back(createMoveAnimation(item.arrayPosition, arraySlotPosition(s, levels), RELAYOUT_DURATION));
+    }
+    if (!moves.empty()) {
+        m_animator.enqueueParallel(std::move(moves));
+    }
+}
+
+size_t HeapVisualizer::levelsFor(size_t n) const {
+    size_t levels = 0;
+    while (levelStart(levels) < n) {
+        levels++;
+    }
+    return levels;
+}
+
+size_t HeapVisualizer::levelStart(size_t level) const {
+    // 1 + D + D^2 + ... + D^(level - 1)
+    size_t start = 0;
+    size_t width = 1;
+    for (size_t k = 0; k < level; ++k) {
+        start += width;
+        width *= static_cast<size_t>(m_arity);
+    }
+    return start;
+}
+
+glm::vec2 HeapVisualizer::treeSlotPosition(size_t slot, size_t levels) const {
+    // Slot j of level k gets 1 / D^k of the bottom level's width
+    size_t level = 0;
+    size_t first = 0;
+    size_t width = 1;
+    while (slot >= first + width) {
+        first += width;
+        width *= static_cast<size_t>(m_arity);
+        level++;
+    }
+    float treeWidth = static_cast<float>(std::pow(m_arity, std::max<size_t>(levels, 1) - 1)) * LEAF_PITCH;
+    float pitch = treeWidth / static_cast<float>(width);
+    return glm::vec2(START_X + (static_cast<float>(slot - first) + 0.5f) * pitch,
+                     START_Y + NODE_RADIUS + level * LEVEL_SPACING);
+}
+
+glm::vec2 HeapVisualizer::arraySlotPosition(size_t slot, size_t levels) const {
+    float deepest = START_Y + NODE_RADIUS + (std::max<size_t>(levels, 1) - 1) * LEVEL_SPACING;
+    return glm::vec2(START_X + slot * CELL_WIDTH, deepest + NODE_RADIUS + ARRAY_GAP);
+}
+
+} // namespace dsav
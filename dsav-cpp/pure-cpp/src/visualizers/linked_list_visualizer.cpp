@@ -5,6 +5,7 @@
 
 #include "visualizers/linked_list_visualizer.hpp"
 #include "ui_components.hpp"
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
@@ -14,11 +15,18 @@
 namespace dsav {
 
 LinkedListVisualizer::LinkedListVisualizer()
-    : m_statusText("Linked list is empty") {
+    : LinkedListVisualizer(std::make_unique<CppListBackend>()) {
+    m_canSwitchVariant = true;
+}
+
+LinkedListVisualizer::LinkedListVisualizer(std::unique_ptr<ListBackend> backend)
+    : m_list(std::move(backend)), m_statusText("Linked list is empty") {
+    m_animator.bindContainer(m_visualNodes);
+
     // Initialize with a few nodes for demonstration
-    m_list.insertBack(10);
-    m_list.insertBack(20);
-    m_list.insertBack(30);
+    m_list->insertBack(10);
+    m_list->insertBack(20);
+    m_list->insertBack(30);
     syncVisuals();
 }
 
@@ -28,11 +36,11 @@ void LinkedListVisualizer::update(float deltaTime) {
 
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_list.isEmpty()) {
+        if (m_list->isEmpty()) {
             m_statusText = "Linked list is empty";
         } else {
             std::ostringstream oss;
-            oss << "List has " << m_list.size() << " node(s)";
+            oss << "List has " << m_list->size() << " node(s)";
             m_statusText = oss.str();
         }
     }
@@ -43,13 +51,6 @@ void LinkedListVisualizer::renderVisualization() {
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
     ImVec2 canvasSize = ImGui::GetContentRegionAvail();
 
-    // Draw background
-    drawList->AddRectFilled(
-        canvasPos,
-        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
-        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
-    );
-
     // Calculate scaled dimensions with zoom
     float scaledNodeWidth = NODE_WIDTH * m_zoomLevel;
     float scaledNodeHeight = NODE_HEIGHT * m_zoomLevel;
@@ -172,76 +173,128 @@ void LinkedListVisualizer::renderVisualization() {
         horizontalOffset = minOffset;
     }
 
-    // Draw "HEAD →" indicator (positioned close to first node)
-    if (!m_visualNodes.empty() && !m_visualNodes[0].isNull) {
-        float scaledY = START_Y * m_zoomLevel;
-        float firstNodeX = START_X * m_zoomLevel;  // First node's actual X position
-        ImVec2 headTextPos = ImVec2(
-            canvasPos.x + horizontalOffset + firstNodeX - 60.0f,  // 60px left of first node
-            canvasPos.y + scaledY + scaledNodeHeight / 2.0f - 10.0f
-        );
-        drawList->AddText(
-            headTextPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::green)),
-            "HEAD →"
-        );
+    // Visible node range, outlined on the minimap
+    float pitch = NODE_SPACING * m_zoomLevel;
+    m_canvasWidth = canvasSize.x;
+    m_viewFirst = (-horizontalOffset - START_X * m_zoomLevel) / pitch;
+    m_viewLast = (canvasSize.x - horizontalOffset - START_X * m_zoomLevel) / pitch;
+
+    // Nodes the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_visualNodes, m_animatedScratch);
+    if (m_animatedScratch != m_animatedNodes) {
+        m_animatedNodes.swap(m_animatedScratch);
+        m_sceneVersion++;
     }
 
-    // Draw nodes and arrows with zoom
-    for (size_t i = 0; i < m_visualNodes.size(); ++i) {
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    float scaledY = START_Y * m_zoomLevel;
+    auto drawNode = [&](size_t i) {
         const auto& visualNode = m_visualNodes[i];
-
         float scaledX = visualNode.position.x * m_zoomLevel;
-        float scaledY = START_Y * m_zoomLevel;
+        ImVec2 nodeMin = ImVec2(canvasPos.x + horizontalOffset + scaledX, canvasPos.y + scaledY);
+        ImVec2 nodeMax = ImVec2(nodeMin.x + scaledNodeWidth, nodeMin.y + scaledNodeHeight);
+        if (!viewport.isRectVisible(nodeMin, nodeMax)) {
+            return;
+        }
 
         // Create VisualElement for rendering
         VisualElement elem;
-        elem.position = glm::vec2(
-            canvasPos.x + horizontalOffset + scaledX,
-            canvasPos.y + scaledY
-        );
+        elem.position = glm::vec2(nodeMin.x, nodeMin.y);
         elem.size = glm::vec2(scaledNodeWidth, scaledNodeHeight);
         elem.color = visualNode.color;
         elem.borderColor = visualNode.borderColor;
         elem.borderWidth = 2.0f;
         elem.label = visualNode.label;
-        elem.sublabel = "";
 
-        renderElement(drawList, elem);
+        renderElement(drawList, elem, ImVec2(0, 0), viewport.detail());
+    };
 
-        // Draw arrow to next node
-        if (visualNode.hasNext && i < m_visualNodes.size() - 1) {
-            ImVec2 arrowStart = ImVec2(
-                elem.position.x + scaledNodeWidth,
-                elem.position.y + scaledNodeHeight / 2.0f
-            );
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = m_zoomLevel;
+    cacheKey.offsetX = horizontalOffset;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Draw background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
 
-            float nextScaledX = m_visualNodes[i + 1].position.x * m_zoomLevel;
-            ImVec2 arrowEnd = ImVec2(
-                canvasPos.x + horizontalOffset + nextScaledX,
-                canvasPos.y + scaledY + scaledNodeHeight / 2.0f
+        // Draw "HEAD →" indicator (positioned close to first node)
+        if (!m_visualNodes.empty() && !m_visualNodes[0].isNull) {
+            float firstNodeX = START_X * m_zoomLevel;  // First node's actual X position
+            ImVec2 headTextPos = ImVec2(
+                canvasPos.x + horizontalOffset + firstNodeX - 60.0f,  // 60px left of first node
+                canvasPos.y + scaledY + scaledNodeHeight / 2.0f - 10.0f
             );
+            drawList->AddText(
+                headTextPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::green)),
+                "HEAD →"
+            );
+        }
+
+        // Draw resting nodes and arrows with zoom, skipping everything panned off-canvas
+        ImU32 arrowColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::blue));
+        for (size_t i = 0; i < m_visualNodes.size(); ++i) {
+            const auto& visualNode = m_visualNodes[i];
+            if (!m_animatedNodes[i]) {
+                drawNode(i);
+            }
+
+            // Draw arrow to next node
+            if (visualNode.hasNext && i < m_visualNodes.size() - 1) {
+                float scaledX = visualNode.position.x * m_zoomLevel;
+                ImVec2 arrowStart = ImVec2(
+                    canvasPos.x + horizontalOffset + scaledX + scaledNodeWidth,
+                    canvasPos.y + scaledY + scaledNodeHeight / 2.0f
+                );
+
+                float nextScaledX = m_visualNodes[i + 1].position.x * m_zoomLevel;
+                ImVec2 arrowEnd = ImVec2(
+                    canvasPos.x + horizontalOffset + nextScaledX,
+                    canvasPos.y + scaledY + scaledNodeHeight / 2.0f
+                );
 
-            drawArrow(drawList, arrowStart, arrowEnd,
-                     ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::blue)));
+                if (!viewport.isSegmentVisible(arrowStart, arrowEnd)) {
+                    continue;
+                }
+                if (viewport.isFullDetail()) {
+                    drawArrow(drawList, arrowStart, arrowEnd, arrowColor);
+                } else {
+                    drawList->AddLine(arrowStart, arrowEnd, arrowColor, 2.0f);
+                }
+            }
+        }
+
+        // Draw info text if empty (only NULL node)
+        if (m_list->isEmpty()) {
+            ImVec2 textPos = ImVec2(
+                canvasPos.x + canvasSize.x / 2.0f - 120.0f,
+                canvasPos.y + canvasSize.y / 2.0f
+            );
+            drawList->AddText(
+                textPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "Linked list is empty. Use Insert to add nodes."
+            );
         }
     }
+    m_canvasCache.endStatic(drawList);
 
-    // Draw info text if empty (only NULL node)
-    if (m_list.isEmpty()) {
-        ImVec2 textPos = ImVec2(
-            canvasPos.x + canvasSize.x / 2.0f - 120.0f,
-            canvasPos.y + canvasSize.y / 2.0f
-        );
-        drawList->AddText(
-            textPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            "Linked list is empty. Use Insert to add nodes."
-        );
+    // Animating nodes on top
+    if (animatedCount > 0) {
+        for (size_t i = 0; i < m_visualNodes.size(); ++i) {
+            if (m_animatedNodes[i]) {
+                drawNode(i);
+            }
+        }
     }
 
     // Show interaction hints
-    if (!m_list.isEmpty()) {
+    if (!m_list->isEmpty()) {
         std::string hintText = "Drag to pan | Scroll to move | Ctrl+Scroll to zoom";
         if (m_zoomLevel != 1.0f) {
             hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
@@ -266,6 +319,24 @@ void LinkedListVisualizer::renderControls() {
     ui::StatusText(m_statusText.c_str(), "info");
     ImGui::Separator();
 
+    // List variant (pooled lists only)
+    if (m_canSwitchVariant) {
+        ImGui::Text("List Type:");
+        const char* variants[] = {
+            "Singly linked (head + tail)",
+            "Doubly linked"
+        };
+        int variantIdx = static_cast<int>(m_variant);
+        ImGui::BeginDisabled(isAnimating());
+        if (ImGui::Combo("##Variant", &variantIdx, variants, IM_ARRAYSIZE(variants))) {
+            setVariant(static_cast<ListVariant>(variantIdx));
+        }
+        ImGui::EndDisabled();
+        ui::Tooltip("Doubly linked nodes also link to their predecessor,\n"
+                    "so Delete Back no longer walks the list");
+        ImGui::Separator();
+    }
+
     // Operation mode selection
     ImGui::Text("Operation Mode:");
     const char* modes[] = {
@@ -326,30 +397,38 @@ void LinkedListVisualizer::renderControls() {
         case OperationMode::InsertAt:
             buttonLabel = "Insert At";
             tooltipText = "Insert node at specific index";
-            canExecute = static_cast<size_t>(m_inputIndex) <= m_list.size();
+            canExecute = m_list->canInsertAt(static_cast<size_t>(m_inputIndex));
             break;
         case OperationMode::DeleteFront:
             buttonLabel = "Delete Front";
             tooltipText = "Delete first node";
-            canExecute = !m_list.isEmpty();
+            canExecute = !m_list->isEmpty();
             break;
         case OperationMode::DeleteBack:
             buttonLabel = "Delete Back";
             tooltipText = "Delete last node";
-            canExecute = !m_list.isEmpty();
+            canExecute = !m_list->isEmpty() && m_list->canDeleteAt(m_list->size() - 1);
             break;
         case OperationMode::DeleteAt:
             buttonLabel = "Delete At";
             tooltipText = "Delete node at specific index";
-            canExecute = !m_list.isEmpty() && static_cast<size_t>(m_inputIndex) < m_list.size();
+            canExecute = m_list->canDeleteAt(static_cast<size_t>(m_inputIndex));
             break;
         case OperationMode::Search:
             buttonLabel = "Search";
             tooltipText = "Search for value in list";
-            canExecute = !m_list.isEmpty();
+            canExecute = !m_list->isEmpty();
             break;
     }
 
+    // Fixed-function backends refuse some positions; say why
+    if (!canExecute && !m_list->isEmpty() && *m_list->positionalLimits() != '\0' &&
+        (m_currentMode == OperationMode::InsertAt ||
+         m_currentMode == OperationMode::DeleteBack ||
+         m_currentMode == OperationMode::DeleteAt)) {
+        tooltipText += std::string("\n") + m_list->positionalLimits();
+    }
+
     if (!canExecute) {
         ImGui::BeginDisabled();
     }
@@ -408,6 +487,16 @@ void LinkedListVisualizer::renderControls() {
 
     ImGui::Separator();
 
+    // Minimap: click or drag to center the canvas on that part of the list
+    if (ImGui::CollapsingHeader("Minimap")) {
+        double index = 0.0;
+        if (m_minimap.renderSequence(m_summary, m_viewFirst, m_viewLast, index)) {
+            centerOn(index);
+        }
+    }
+
+    ImGui::Separator();
+
     // Playback controls
     ui::PlaybackControls(
         m_isPaused,
@@ -424,11 +513,37 @@ void LinkedListVisualizer::renderControls() {
 
     // List info
     ImGui::Text("List Info:");
-    ImGui::Text("Size: %zu nodes", m_list.size());
+    ImGui::Text("Size: %zu nodes", m_list->size());
+
+    renderHopReadout();
 
     ImGui::End();
 }
 
+void LinkedListVisualizer::renderHopReadout() {
+    const OpCounters* counters = m_list->opCounters();
+    if (!counters) {
+        return;
+    }
+
+    ImGui::Separator();
+    ImGui::Text("Pointer Hops:");
+    if (!OpCounted::countingEnabled()) {
+        ImGui::TextDisabled("Operation counting is compiled out");
+        return;
+    }
+    if (m_hopOperation.empty()) {
+        ImGui::TextDisabled("Run an operation to count its hops");
+    } else {
+        ImGui::Text("Last: %s", m_hopOperation.c_str());
+        ImGui::BulletText("This list: %llu", static_cast<unsigned long long>(m_lastHops));
+        ImGui::BulletText("Head-only singly list: %llu", static_cast<unsigned long long>(m_headOnlyHops));
+        ui::Tooltip("Hops the same operation needs when the list keeps only a head pointer\n"
+                    "(every append and every back delete walks from the head)");
+    }
+    ImGui::Text("Total: %llu", static_cast<unsigned long long>(counters->hops));
+}
+
 void LinkedListVisualizer::insertFrontValue(int value) {
     // Update status
     std::ostringstream oss;
@@ -436,7 +551,9 @@ void LinkedListVisualizer::insertFrontValue(int value) {
     m_statusText = oss.str();
 
     // Insert into actual list
-    m_list.insertFront(value);
+    std::uint64_t hopsBefore = hopCount();
+    m_list->insertFront(value);
+    recordHops("Insert Front", hopsBefore, 0);
 
     // Recreate visuals
     syncVisuals();
@@ -472,8 +589,11 @@ void LinkedListVisualizer::insertBackValue(int value) {
     oss << "Inserting " << value << " at back...";
     m_statusText = oss.str();
 
-    // Insert into actual list
-    m_list.insertBack(value);
+    // Insert into actual list (a head-only list walks to the last node)
+    size_t sizeBefore = m_list->size();
+    std::uint64_t hopsBefore = hopCount();
+    m_list->insertBack(value);
+    recordHops("Insert Back", hopsBefore, sizeBefore > 0 ? sizeBefore - 1 : 0);
 
     // Recreate visuals
     syncVisuals();
@@ -504,18 +624,24 @@ void LinkedListVisualizer::insertBackValue(int value) {
 }
 
 void LinkedListVisualizer::insertAtValue(size_t index, int value) {
-    if (index > m_list.size()) {
+    if (index > m_list->size()) {
         m_statusText = "Error: Index out of range!";
         return;
     }
+    if (!m_list->canInsertAt(index)) {
+        m_statusText = "Error: This backend cannot insert there!";
+        return;
+    }
 
     // Update status
     std::ostringstream oss;
     oss << "Inserting " << value << " at index " << index << "...";
     m_statusText = oss.str();
 
-    // Insert into actual list
-    m_list.insertAt(index, value);
+    // Insert into actual list (a head-only list walks to the predecessor)
+    std::uint64_t hopsBefore = hopCount();
+    m_list->insertAt(index, value);
+    recordHops("Insert At", hopsBefore, index > 0 ? index - 1 : 0);
 
     // Recreate visuals
     syncVisuals();
@@ -546,14 +672,13 @@ void LinkedListVisualizer::insertAtValue(size_t index, int value) {
 }
 
 void LinkedListVisualizer::deleteFrontValue() {
-    if (m_list.isEmpty()) {
+    if (m_list->isEmpty()) {
         m_statusText = "Error: List is empty!";
         return;
     }
 
     // Get the value before deleting
-    auto current = m_list.head();
-    int value = current->data;
+    int value = m_values.front();
 
     // Update status
     std::ostringstream oss;
@@ -567,7 +692,9 @@ void LinkedListVisualizer::deleteFrontValue() {
         Animation flashRed = createColorAnimation(node.color, colors::semantic::error, 0.3f);
         flashRed.onComplete = [this, value]() {
             // Actually delete from list
-            m_list.deleteFront();
+            std::uint64_t hopsBefore = hopCount();
+            m_list->deleteFront();
+            recordHops("Delete Front", hopsBefore, 0);
             syncVisuals();
 
             std::ostringstream oss;
@@ -579,18 +706,13 @@ void LinkedListVisualizer::deleteFrontValue() {
 }
 
 void LinkedListVisualizer::deleteBackValue() {
-    if (m_list.isEmpty()) {
+    if (m_list->isEmpty()) {
         m_statusText = "Error: List is empty!";
         return;
     }
 
     // Get the last value
-    int value = 0;
-    auto current = m_list.head();
-    while (current) {
-        value = current->data;
-        current = current->next;
-    }
+    int value = m_values.back();
 
     // Update status
     std::ostringstream oss;
@@ -603,8 +725,11 @@ void LinkedListVisualizer::deleteBackValue() {
 
         Animation flashRed = createColorAnimation(node.color, colors::semantic::error, 0.3f);
         flashRed.onComplete = [this, value]() {
-            // Actually delete from list
-            m_list.deleteBack();
+            // Actually delete from list (a singly linked list walks to the node before the tail)
+            size_t sizeBefore = m_list->size();
+            std::uint64_t hopsBefore = hopCount();
+            m_list->deleteBack();
+            recordHops("Delete Back", hopsBefore, sizeBefore > 1 ? sizeBefore - 1 : 0);
             syncVisuals();
 
             std::ostringstream oss;
@@ -616,18 +741,17 @@ void LinkedListVisualizer::deleteBackValue() {
 }
 
 void LinkedListVisualizer::deleteAtValue(size_t index) {
-    if (index >= m_list.size()) {
+    if (index >= m_list->size()) {
         m_statusText = "Error: Index out of range!";
         return;
     }
+    if (!m_list->canDeleteAt(index)) {
+        m_statusText = "Error: This backend cannot delete that node!";
+        return;
+    }
 
     // Get the value at index
-    int value = 0;
-    auto current = m_list.head();
-    for (size_t i = 0; i < index; ++i) {
-        current = current->next;
-    }
-    value = current->data;
+    int value = m_values[index];
 
     // Update status
     std::ostringstream oss;
@@ -641,7 +765,9 @@ void LinkedListVisualizer::deleteAtValue(size_t index) {
         Animation flashRed = createColorAnimation(node.color, colors::semantic::error, 0.3f);
         flashRed.onComplete = [this, value, index]() {
             // Actually delete from list
-            m_list.deleteAt(index);
+            std::uint64_t hopsBefore = hopCount();
+            m_list->deleteAt(index);
+            recordHops("Delete At", hopsBefore, index);
             syncVisuals();
 
             std::ostringstream oss;
@@ -653,7 +779,7 @@ void LinkedListVisualizer::deleteAtValue(size_t index) {
 }
 
 void LinkedListVisualizer::searchValue(int value) {
-    if (m_list.isEmpty()) {
+    if (m_list->isEmpty()) {
         m_statusText = "Error: List is empty!";
         return;
     }
@@ -665,14 +791,11 @@ void LinkedListVisualizer::searchValue(int value) {
 
     // Animate: highlight each node being checked
     bool found = false;
-    auto current = m_list.head();
-    size_t index = 0;
-
-    while (current) {
+    for (size_t index = 0; index < m_values.size(); ++index) {
         if (index < m_visualNodes.size()) {
             auto& node = m_visualNodes[index];
 
-            if (current->data == value && !found) {
+            if (m_values[index] == value && !found) {
                 // Found! Highlight in green
                 Animation highlightFound = createColorAnimation(
                     node.color,
@@ -710,7 +833,7 @@ void LinkedListVisualizer::searchValue(int value) {
                 );
 
                 // If this is the last node and not found, update status
-                if (!current->next && !found) {
+                if (index + 1 == m_values.size() && !found) {
                     restore.onComplete = [this, value]() {
                         std::ostringstream oss;
                         oss << "Value " << value << " not found in list";
@@ -721,15 +844,12 @@ void LinkedListVisualizer::searchValue(int value) {
                 m_animator.enqueue(restore);
             }
         }
-
-        current = current->next;
-        index++;
     }
 }
 
 void LinkedListVisualizer::initializeRandom(size_t count) {
     // Clear existing list
-    m_list.clear();
+    m_list->clear();
     m_visualNodes.clear();
     m_animator.clear();
 
@@ -743,10 +863,15 @@ void LinkedListVisualizer::initializeRandom(size_t count) {
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(1, 99);
 
-    // Populate list with random values
-    for (size_t i = 0; i < count; ++i) {
-        m_list.insertBack(dis(gen));
+    // Populate list with random values in one bulk append
+    std::vector<int> values(count);
+    for (int& value : values) {
+        value = dis(gen);
     }
+    std::uint64_t hopsBefore = hopCount();
+    m_list->appendValues(values);
+    // A head-only list walks 0 + 0 + 1 + ... + (count - 2) nodes for the same appends
+    recordHops("Initialize Random", hopsBefore, count > 1 ? (count - 1) * (count - 2) / 2 : 0);
 
     // Sync visuals (includes NULL node)
     syncVisuals();
@@ -791,14 +916,14 @@ void LinkedListVisualizer::step() {
 }
 
 void LinkedListVisualizer::reset() {
-    m_list.clear();
+    m_list->clear();
     m_visualNodes.clear();
     m_animator.clear();
 
     // Add initial nodes
-    m_list.insertBack(10);
-    m_list.insertBack(20);
-    m_list.insertBack(30);
+    m_list->insertBack(10);
+    m_list->insertBack(20);
+    m_list->insertBack(30);
     syncVisuals();
 
     m_statusText = "List reset";
@@ -822,26 +947,62 @@ bool LinkedListVisualizer::isPaused() const {
     return m_isPaused;
 }
 
+void LinkedListVisualizer::setVariant(ListVariant variant) {
+    if (!m_canSwitchVariant || variant == m_variant) {
+        return;
+    }
+
+    std::unique_ptr<ListBackend> next;
+    if (variant == ListVariant::Doubly) {
+        next = std::make_unique<CppDoublyListBackend>();
+    } else {
+        next = std::make_unique<CppListBackend>();
+    }
+
+    m_animator.clear();
+    m_list->values(m_values);
+    next->appendValues(m_values);
+    m_list = std::move(next);
+    m_variant = variant;
+    m_hopOperation.clear();
+    syncVisuals();
+
+    m_statusText = (variant == ListVariant::Doubly) ? "Switched to a doubly linked list"
+                                                    : "Switched to a singly linked list";
+}
+
+std::uint64_t LinkedListVisualizer::hopCount() const {
+    const OpCounters* counters = m_list->opCounters();
+    return counters ? counters->hops : 0;
+}
+
+void LinkedListVisualizer::recordHops(const char* operation, std::uint64_t hopsBefore, std::uint64_t headOnlyHops) {
+    m_hopOperation = operation;
+    m_lastHops = hopCount() - hopsBefore;
+    m_headOnlyHops = headOnlyHops;
+}
+
 void LinkedListVisualizer::syncVisuals() {
+    m_sceneVersion++;
     m_visualNodes.clear();
+    m_list->values(m_values);
+    m_summary.updateFrom(m_summaryValues, m_values);
+    m_summaryValues = m_values;
 
-    auto current = m_list.head();
     size_t index = 0;
 
     // Add regular data nodes
-    while (current) {
+    for (int value : m_values) {
         VisualNode vnode;
         vnode.position = calculatePosition(index);
         vnode.size = glm::vec2(NODE_WIDTH, NODE_HEIGHT);
         vnode.color = colors::semantic::elementBase;
         vnode.borderColor = colors::semantic::elementBorder;
-        vnode.label = std::to_string(current->data);
+        vnode.label = labels::fromInt(value);
         vnode.hasNext = true;  // Always has next (points to next node or NULL node)
         vnode.isNull = false;
 
         m_visualNodes.push_back(vnode);
-
-        current = current->next;
         index++;
     }
 
@@ -851,13 +1012,23 @@ void LinkedListVisualizer::syncVisuals() {
     nullNode.size = glm::vec2(NODE_WIDTH, NODE_HEIGHT);
     nullNode.color = colors::withAlpha(colors::mocha::surface1, 0.5f);
     nullNode.borderColor = colors::mocha::overlay0;
-    nullNode.label = "NULL";
+    nullNode.label = labels::intern("NULL");
     nullNode.hasNext = false;
     nullNode.isNull = true;
 
     m_visualNodes.push_back(nullNode);
 }
 
+void LinkedListVisualizer::centerOn(double index) {
+    float totalWidth = m_visualNodes.empty() ? 0.0f
+        : m_visualNodes.size() * (NODE_WIDTH + NODE_SPACING) * m_zoomLevel - NODE_SPACING * m_zoomLevel;
+    float baseOffset = std::max(100.0f, (m_canvasWidth - totalWidth) / 2.0f);
+
+    // renderVisualization() clamps this to the list's extent
+    float x = (START_X + static_cast<float>(index) * NODE_SPACING) * m_zoomLevel;
+    m_cameraOffsetX = m_canvasWidth / 2.0f - x - baseOffset;
+}
+
 glm::vec2 LinkedListVisualizer::calculatePosition(size_t index) const {
     // Nodes arranged horizontally
     float x = START_X + index * NODE_SPACING;
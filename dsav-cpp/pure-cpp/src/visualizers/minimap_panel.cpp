@@ -0,0 +1,228 @@
+/**
+ * @file minimap_panel.cpp
+ * @brief Minimap texture fill and navigation
+ */
+
+#include "visualizers/minimap_panel.hpp"
+#include "color_scheme.hpp"
+#include <algorithm>
+#include <cmath>
+#include <imgui.h>
+
+namespace dsav {
+
+namespace {
+
+constexpr size_t SEQUENCE_COLUMNS = algorithms::TreeDensity::COLUMNS;
+constexpr size_t RAMP_SIZE = 64;
+
+ImU32 toU32(const glm::vec4& color) {
+    return ImGui::ColorConvertFloat4ToU32(colors::toImGui(color));
+}
+
+/**
+ * @brief Density colors from sparse (surface) through mauve to dense (peach)
+ */
+const std::vector<ImU32>& densityRamp() {
+    static const std::vector<ImU32> ramp = [] {
+        std::vector<ImU32> colors(RAMP_SIZE);
+        for (size_t i = 0; i < RAMP_SIZE; ++i) {
+            float t = static_cast<float>(i) / (RAMP_SIZE - 1);
+            glm::vec4 color = t < 0.5f
+                ? colors::lerp(colors::mocha::surface2, colors::mocha::mauve, t * 2.0f)
+                : colors::lerp(colors::mocha::mauve, colors::mocha::peach, t * 2.0f - 1.0f);
+            colors[i] = toU32(color);
+        }
+        return colors;
+    }();
+    return ramp;
+}
+
+} // namespace
+
+// ===== Sequences =====
+
+bool MinimapPanel::renderSequence(const algorithms::ValueSummary& summary, double viewFirst, double viewLast,
+                                  double& jumpTo) {
+    if (summary.empty()) {
+        ImGui::TextDisabled("Nothing to summarize");
+        return false;
+    }
+    if (m_source != &summary || m_version != summary.version()) {
+        fillSequence(summary);
+        m_texture.upload(m_pixels.data(), static_cast<int>(SEQUENCE_COLUMNS), SEQUENCE_ROWS);
+        m_source = &summary;
+        m_version = summary.version();
+    }
+
+    algorithms::ValueBucket total = summary.total();
+    ImGui::Text("%zu elements: min %d, max %d, mean %.1f", summary.size(), total.min, total.max, total.mean());
+
+    auto count = static_cast<double>(summary.size());
+    ImVec2 viewMin(static_cast<float>(viewFirst / count), 0.0f);
+    ImVec2 viewMax(static_cast<float>(viewLast / count), 1.0f);
+    ImVec2 pick;
+    ImVec2 hover;
+    int state = drawOverview("##sequence_minimap", viewMin, viewMax, pick, hover);
+
+    if (state & 2) {
+        size_t column = std::min(static_cast<size_t>(hover.x * SEQUENCE_COLUMNS), SEQUENCE_COLUMNS - 1);
+        const algorithms::ValueBucket& bucket = m_columns[column];
+        size_t first = summary.size() * column / SEQUENCE_COLUMNS;
+        size_t last = std::max(first + 1, summary.size() * (column + 1) / SEQUENCE_COLUMNS);
+        if (bucket.count > 0) {
+            ImGui::SetTooltip("Elements %zu-%zu\nmin %d, max %d, mean %.1f", first, last - 1,
+                              bucket.min, bucket.max, bucket.mean());
+        }
+    }
+    if (state & 1) {
+        jumpTo = static_cast<double>(pick.x) * count;
+        return true;
+    }
+    return false;
+}
+
+void MinimapPanel::fillSequence(const algorithms::ValueSummary& summary) {
+    m_pixels.assign(SEQUENCE_COLUMNS * SEQUENCE_ROWS, toU32(colors::mocha::crust));
+    summary.query(0, summary.size(), SEQUENCE_COLUMNS, m_columns);
+
+    // Rows run from the largest value (top) to the smallest
+    algorithms::ValueBucket total = summary.total();
+    double range = std::max(1.0, static_cast<double>(total.max) - total.min);
+    auto rowOf = [&](double value) {
+        auto row = static_cast<int>(std::lround((total.max - value) / range * (SEQUENCE_ROWS - 1)));
+        return std::clamp(row, 0, SEQUENCE_ROWS - 1);
+    };
+
+    ImU32 band = toU32(colors::mocha::blue);
+    ImU32 mean = toU32(colors::mocha::peach);
+    for (size_t c = 0; c < SEQUENCE_COLUMNS; ++c) {
+        const algorithms::ValueBucket& bucket = m_columns[c];
+        if (bucket.count == 0) continue;
+        for (int r = rowOf(bucket.max); r <= rowOf(bucket.min); ++r) {
+            m_pixels[static_cast<size_t>(r) * SEQUENCE_COLUMNS + c] = band;
+        }
+        m_pixels[static_cast<size_t>(rowOf(bucket.mean())) * SEQUENCE_COLUMNS + c] = mean;
+    }
+}
+
+// ===== Trees =====
+
+bool MinimapPanel::renderTree(const algorithms::TreeDensity& density, const glm::vec2& viewMin,
+                              const glm::vec2& viewMax, glm::vec2& jumpTo) {
+    if (density.size() == 0) {
+        ImGui::TextDisabled("Nothing to summarize");
+        return false;
+    }
+    if (m_source != &density || m_version != density.version()) {
+        fillTree(density);
+        m_texture.upload(m_pixels.data(), static_cast<int>(density.columns()), static_cast<int>(density.rows()));
+        m_source = &density;
+        m_version = density.version();
+    }
+
+    ImGui::Text("%zu nodes, height %zu", density.size(), density.depthCount() - 1);
+    ImGui::Text("Widest: depth %zu (%u nodes)", m_widestDepth, m_widestCount);
+
+    // Depth d is drawn across [d, d + 1) of the rows' depth span
+    float left = density.left();
+    float width = density.right() - left;
+    auto depthSpan = static_cast<float>(density.rows() * density.depthsPerRow());
+    ImVec2 fractionMin((viewMin.x - left) / width, (viewMin.y + 0.5f) / depthSpan);
+    ImVec2 fractionMax((viewMax.x - left) / width, (viewMax.y + 0.5f) / depthSpan);
+    ImVec2 pick;
+    ImVec2 hover;
+    int state = drawOverview("##tree_minimap", fractionMin, fractionMax, pick, hover);
+
+    if (state & 2) {
+        size_t row = std::min(static_cast<size_t>(hover.y * density.rows()), density.rows() - 1);
+        size_t column = std::min(static_cast<size_t>(hover.x * density.columns()), density.columns() - 1);
+        size_t first = row * density.depthsPerRow();
+        size_t last = std::min(first + density.depthsPerRow(), density.depthCount());
+        std::uint64_t nodes = 0;
+        for (size_t d = first; d < last; ++d) {
+            nodes += density.nodesAtDepth(d);
+        }
+        if (last > first + 1) {
+            ImGui::SetTooltip("Depths %zu-%zu: %llu nodes\nHere: %u nodes", first, last - 1,
+                              static_cast<unsigned long long>(nodes), density.cell(row, column));
+        } else {
+            ImGui::SetTooltip("Depth %zu: %llu nodes\nHere: %u nodes", first,
+                              static_cast<unsigned long long>(nodes), density.cell(row, column));
+        }
+    }
+    if (state & 1) {
+        jumpTo = glm::vec2(left + pick.x * width, pick.y * depthSpan - 0.5f);
+        return true;
+    }
+    return false;
+}
+
+void MinimapPanel::fillTree(const algorithms::TreeDensity& density) {
+    size_t rows = density.rows();
+    size_t columns = density.columns();
+    m_pixels.assign(rows * columns, toU32(colors::mocha::crust));
+
+    // Log scale: the root's cell holds one node, a deep band of a big tree thousands
+    const std::vector<ImU32>& ramp = densityRamp();
+    double scale = std::log1p(static_cast<double>(std::max(density.maxCell(), 1u)));
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < columns; ++c) {
+            std::uint32_t count = density.cell(r, c);
+            if (count == 0) continue;
+            auto t = std::log1p(static_cast<double>(count)) / scale;
+            m_pixels[r * columns + c] = ramp[std::min(static_cast<size_t>(t * (RAMP_SIZE - 1)), RAMP_SIZE - 1)];
+        }
+    }
+
+    m_widestDepth = 0;
+    m_widestCount = 0;
+    for (size_t d = 0; d < density.depthCount(); ++d) {
+        if (density.nodesAtDepth(d) > m_widestCount) {
+            m_widestCount = density.nodesAtDepth(d);
+            m_widestDepth = d;
+        }
+    }
+}
+
+// ===== Shared =====
+
+int MinimapPanel::drawOverview(const char* id, const ImVec2& viewMin, const ImVec2& viewMax, ImVec2& pick,
+                               ImVec2& hover) {
+    ImVec2 size(std::max(ImGui::GetContentRegionAvail().x, 1.0f), HEIGHT);
+    ImVec2 min = ImGui::GetCursorScreenPos();
+    ImVec2 max(min.x + size.x, min.y + size.y);
+    ImGui::InvisibleButton(id, size);
+
+    auto mouseFraction = [&] {
+        ImVec2 mouse = ImGui::GetIO().MousePos;
+        return ImVec2(std::clamp((mouse.x - min.x) / size.x, 0.0f, 1.0f),
+                      std::clamp((mouse.y - min.y) / size.y, 0.0f, 1.0f));
+    };
+    int state = 0;
+    if (ImGui::IsItemActive()) {
+        pick = mouseFraction();
+        state |= 1;
+    }
+    if (ImGui::IsItemHovered()) {
+        hover = mouseFraction();
+        state |= 2;
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(min, max, toU32(colors::mocha::crust));
+    m_texture.draw(drawList, min, max);
+
+    // Keep a sliver of a view visible on a huge container
+    float x0 = min.x + std::clamp(viewMin.x, 0.0f, 1.0f) * size.x;
+    float x1 = min.x + std::clamp(viewMax.x, 0.0f, 1.0f) * size.x;
+    float y0 = min.y + std::clamp(viewMin.y, 0.0f, 1.0f) * size.y;
+    float y1 = min.y + std::clamp(viewMax.y, 0.0f, 1.0f) * size.y;
+    x1 = std::max(x1, std::min(x0 + 3.0f, max.x));
+    y1 = std::max(y1, std::min(y0 + 3.0f, max.y));
+    drawList->AddRect(ImVec2(x0, y0), ImVec2(x1, y1), toU32(colors::mocha::text), 0.0f, 0, 1.5f);
+    drawList->AddRect(min, max, toU32(colors::mocha::surface1));
+    return state;
+}
+
+} // namespace dsav
@@ -5,6 +5,9 @@
 
 #include "visualizers/queue_visualizer.hpp"
 #include "ui_components.hpp"
+#include "algorithms/snapshot.hpp"
+#include "algorithms/workload_targets.hpp"
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <random>
@@ -12,24 +15,55 @@
 
 namespace dsav {
 
-QueueVisualizer::QueueVisualizer(size_t maxSize)
-    : m_statusText("Queue is empty") {
-    (void)maxSize;  // Unused for now, queue has fixed size
+QueueVisualizer::QueueVisualizer(size_t blockSize)
+    : QueueVisualizer(std::make_unique<CppQueueBackend>(blockSize)) {
+}
+
+QueueVisualizer::QueueVisualizer(std::unique_ptr<QueueBackend> backend)
+    : m_queue(std::move(backend)), m_statusText("Queue is empty") {
+    m_animator.bindContainer(m_elements);
     syncVisuals();
+
+    // Through the backend, so the assembly ring buffer replays too (a full ring misses inserts)
+    algorithms::WorkloadHooks hooks;
+    hooks.apply = [this](const algorithms::WorkloadOp& op) { return algorithms::applyQueueOp(*m_queue, op); };
+    hooks.capture = [this](algorithms::WorkloadKeyframe& keyframe) {
+        keyframe.elements.resize(m_queue->size());
+        for (size_t i = 0; i < keyframe.elements.size(); ++i) {
+            keyframe.elements[i] = m_queue->atPosition(i);
+        }
+    };
+    hooks.restore = [this](const algorithms::WorkloadKeyframe& keyframe) {
+        m_queue->clear();
+        for (int value : keyframe.elements) {
+            m_queue->enqueue(value);
+        }
+    };
+    m_workload.setHooks(std::move(hooks));
 }
 
 void QueueVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
+    m_blockFlash = std::max(0.0f, m_blockFlash - deltaTime * m_speed);
+
+    // A playing replay moves on once the last sampled op has finished animating
+    if (m_workload.isPlaying() && !isAnimating()) {
+        if (m_workload.advance([this](const algorithms::WorkloadOp& op) { animateWorkloadOp(op); })) {
+            syncWorkload();
+        }
+    }
 
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_queue.isEmpty()) {
+        if (m_workload.replay().isActive()) {
+            m_statusText = m_workload.statusText();
+        } else if (m_queue->isEmpty()) {
             m_statusText = "Queue is empty";
         } else {
             std::ostringstream oss;
-            oss << "Queue has " << m_queue.size() << " element(s)";
-            if (auto front = m_queue.peek()) {
+            oss << "Queue has " << m_queue->size() << " element(s)";
+            if (auto front = m_queue->peek()) {
                 oss << " | Front: " << *front;
             }
             m_statusText = oss.str();
@@ -55,8 +89,8 @@ void QueueVisualizer::renderVisualization() {
     float scaledSpacing = ELEMENT_SPACING * m_zoomLevel;
 
     // Calculate total width with zoom applied
-    float totalQueueWidth = m_queue.capacity() * scaledElementWidth +
-                            (m_queue.capacity() - 1) * scaledSpacing;
+    float totalQueueWidth = shownSlots() * scaledElementWidth +
+                            (shownSlots() - 1) * scaledSpacing;
 
     // Calculate horizontal offset for centering
     float horizontalOffset = (canvasSize.x - totalQueueWidth) / 2.0f;
@@ -142,8 +176,8 @@ void QueueVisualizer::renderVisualization() {
     scaledElementHeight = ELEMENT_HEIGHT * m_zoomLevel;
     scaledSpacing = ELEMENT_SPACING * m_zoomLevel;
 
-    totalQueueWidth = m_queue.capacity() * scaledElementWidth +
-                      (m_queue.capacity() - 1) * scaledSpacing;
+    totalQueueWidth = shownSlots() * scaledElementWidth +
+                      (shownSlots() - 1) * scaledSpacing;
 
     horizontalOffset = (canvasSize.x - totalQueueWidth) / 2.0f;
     if (horizontalOffset < 20.0f) {
@@ -165,8 +199,17 @@ void QueueVisualizer::renderVisualization() {
         horizontalOffset = minOffset;
     }
 
-    // Draw capacity indicator (ghost boxes showing circular buffer) with zoom
-    for (size_t i = 0; i < m_queue.capacity(); ++i) {
+    // Only the slots that overlap the canvas are drawn
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    IndexRange visible = viewport.visibleColumns(
+        canvasPos.x + horizontalOffset + calculatePosition(0).x * m_zoomLevel,
+        (ELEMENT_WIDTH + ELEMENT_SPACING) * m_zoomLevel,
+        scaledElementWidth,
+        shownSlots()
+    );
+
+    // Draw capacity indicator (ghost boxes, one run per block) with zoom
+    for (size_t i = visible.first; i < visible.last; ++i) {
         glm::vec2 pos = calculatePosition(i);
         float scaledX = pos.x * m_zoomLevel;
         float scaledY = START_Y * m_zoomLevel;
@@ -178,36 +221,63 @@ void QueueVisualizer::renderVisualization() {
         ghost.borderColor = colors::withAlpha(colors::mocha::overlay0, 0.5f);
         ghost.borderWidth = 1.0f;
 
+        // A block that was just added glows and fades back to ghosts
+        if (m_blockFlash > 0.0f && i >= m_newSlotsFrom && i < m_newSlotsFrom + m_queue->blockSize()) {
+            float t = m_blockFlash / BLOCK_FLASH_SECONDS;
+            ghost.color = colors::withAlpha(colors::semantic::highlight, 0.3f + 0.4f * t);
+            ghost.borderColor = colors::semantic::highlight;
+        }
+
+        // Separator in the gap before each block after the first
+        if (i > 0 && i % m_queue->blockSize() == 0) {
+            float gapX = ghost.position.x - scaledSpacing / 2.0f;
+            drawList->AddLine(
+                ImVec2(gapX, ghost.position.y - 10.0f),
+                ImVec2(gapX, ghost.position.y + scaledElementHeight + 10.0f),
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                2.0f
+            );
+        }
+
         // Draw array index below ghost box
-        std::string indexLabel = std::to_string(i);
-        ImVec2 indexSize = ImGui::CalcTextSize(indexLabel.c_str());
-        ImVec2 indexPos = ImVec2(
-            ghost.position.x + (scaledElementWidth - indexSize.x) / 2.0f,
-            ghost.position.y + scaledElementHeight + 5.0f
-        );
-        drawList->AddText(
-            indexPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            indexLabel.c_str()
-        );
+        if (viewport.isFullDetail()) {
+            LabelId indexLabel = labels::fromInt(static_cast<int>(i));
+            ImVec2 indexSize = labels::textSize(indexLabel);
+            ImVec2 indexPos = ImVec2(
+                ghost.position.x + (scaledElementWidth - indexSize.x) / 2.0f,
+                ghost.position.y + scaledElementHeight + 5.0f
+            );
+            labels::draw(
+                drawList,
+                indexPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                indexLabel
+            );
+        }
 
-        renderElement(drawList, ghost);
+        renderElement(drawList, ghost, ImVec2(0, 0), viewport.detail());
     }
 
     // Draw actual queue elements with zoom
     for (auto& elem : m_elements) {
-        VisualElement renderElem = elem;
         float scaledX = elem.position.x * m_zoomLevel;
         float scaledY = START_Y * m_zoomLevel;
 
-        renderElem.position = glm::vec2(canvasPos.x + horizontalOffset + scaledX, canvasPos.y + scaledY);
+        ImVec2 elemMin = ImVec2(canvasPos.x + horizontalOffset + scaledX, canvasPos.y + scaledY);
+        ImVec2 elemMax = ImVec2(elemMin.x + scaledElementWidth, elemMin.y + scaledElementHeight);
+        if (!viewport.isRectVisible(elemMin, elemMax)) {
+            continue;
+        }
+
+        VisualElement renderElem = elem;
+        renderElem.position = glm::vec2(elemMin.x, elemMin.y);
         renderElem.size = glm::vec2(scaledElementWidth, scaledElementHeight);
-        renderElement(drawList, renderElem);
+        renderElement(drawList, renderElem, ImVec2(0, 0), viewport.detail());
     }
 
     // Draw "FRONT" indicator
-    if (!m_queue.isEmpty()) {
-        glm::vec2 frontPos = calculatePosition(m_queue.frontIndex());
+    if (!m_queue->isEmpty()) {
+        glm::vec2 frontPos = calculatePosition(m_queue->frontIndex());
         float scaledX = frontPos.x * m_zoomLevel;
         float scaledY = START_Y * m_zoomLevel;
         ImVec2 frontArrowPos = ImVec2(
@@ -222,8 +292,8 @@ void QueueVisualizer::renderVisualization() {
     }
 
     // Draw "REAR" indicator (where next element will be added)
-    if (!m_queue.isFull()) {
-        glm::vec2 rearPos = calculatePosition(m_queue.rearIndex());
+    if (!m_queue->isFull()) {
+        glm::vec2 rearPos = calculatePosition(m_queue->rearIndex());
         float scaledX = rearPos.x * m_zoomLevel;
         float scaledY = START_Y * m_zoomLevel;
         ImVec2 rearArrowPos = ImVec2(
@@ -237,19 +307,19 @@ void QueueVisualizer::renderVisualization() {
         );
     }
 
-    // Draw circular buffer indicator
-    ImVec2 circularTextPos = ImVec2(
+    // Draw block layout indicator
+    ImVec2 blockTextPos = ImVec2(
         canvasPos.x + 20.0f,
         canvasPos.y + canvasSize.y - 30.0f
     );
     drawList->AddText(
-        circularTextPos,
+        blockTextPos,
         ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-        "Circular Buffer: Elements wrap around when reaching the end"
+        m_queue->layoutHint()
     );
 
     // Show interaction hints
-    if (!m_queue.isEmpty()) {
+    if (!m_queue->isEmpty()) {
         std::string hintText = "Drag to pan | Scroll to move | Ctrl+Scroll to zoom";
         if (m_zoomLevel != 1.0f) {
             hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
@@ -280,7 +350,7 @@ void QueueVisualizer::renderControls() {
     ImGui::InputInt("Value", &m_inputValue);
     ImGui::PopItemWidth();
 
-    ImGui::BeginDisabled(m_queue.isFull() || isAnimating());
+    ImGui::BeginDisabled(m_queue->isFull() || isAnimating() || m_workload.isPlaying());
     if (ui::ButtonSuccess("Enqueue", ImVec2(120, 0))) {
         enqueueValue(m_inputValue);
     }
@@ -289,14 +359,14 @@ void QueueVisualizer::renderControls() {
 
     ImGui::SameLine();
 
-    ImGui::BeginDisabled(m_queue.isEmpty() || isAnimating());
+    ImGui::BeginDisabled(m_queue->isEmpty() || isAnimating() || m_workload.isPlaying());
     if (ui::ButtonDanger("Dequeue", ImVec2(120, 0))) {
         dequeueValue();
     }
     ImGui::EndDisabled();
     ui::Tooltip("Remove element from front of queue");
 
-    ImGui::BeginDisabled(m_queue.isEmpty() || isAnimating());
+    ImGui::BeginDisabled(m_queue->isEmpty() || isAnimating() || m_workload.isPlaying());
     if (ImGui::Button("Peek", ImVec2(120, 0))) {
         peekValue();
     }
@@ -312,12 +382,10 @@ void QueueVisualizer::renderControls() {
     ImGui::PushItemWidth(150.0f);
     ImGui::InputInt("Count", &m_initCount);
     if (m_initCount < 1) m_initCount = 1;
-    if (m_initCount > static_cast<int>(m_queue.capacity())) {
-        m_initCount = static_cast<int>(m_queue.capacity());
-    }
+    if (m_initCount > MAX_INIT_COUNT) m_initCount = MAX_INIT_COUNT;
     ImGui::PopItemWidth();
 
-    ImGui::BeginDisabled(isAnimating());
+    ImGui::BeginDisabled(isAnimating() || m_workload.isPlaying());
     if (ui::ButtonPrimary("Initialize Random", ImVec2(200, 0))) {
         initializeRandom(static_cast<size_t>(m_initCount));
     }
@@ -326,6 +394,15 @@ void QueueVisualizer::renderControls() {
 
     ImGui::Separator();
 
+    // Workload replay: insert enqueues, remove dequeues, search peeks
+    if (ImGui::CollapsingHeader("Workload Replay")) {
+        if (m_workload.render()) {
+            syncWorkload();
+        }
+    }
+
+    ImGui::Separator();
+
     // Playback controls
     ui::PlaybackControls(
         m_isPaused,
@@ -342,15 +419,20 @@ void QueueVisualizer::renderControls() {
 
     // Queue info
     ImGui::Text("Queue Info:");
-    ImGui::Text("Size: %zu / %zu", m_queue.size(), m_queue.capacity());
+    ImGui::Text("Size: %zu / %zu", m_queue->size(), m_queue->capacity());
     ImGui::ProgressBar(
-        static_cast<float>(m_queue.size()) / static_cast<float>(m_queue.capacity()),
+        static_cast<float>(m_queue->size()) / static_cast<float>(shownSlots()),
         ImVec2(-1, 0)
     );
+    if (m_queue->eventLog() != nullptr) {
+        ImGui::Text("Blocks: %zu live, %zu spare (%zu slots each)",
+                    m_queue->blockCount(), m_queue->spareBlockCount(), m_queue->blockSize());
+        ui::Tooltip("Drained blocks are kept as spares (up to 4) and reused before allocating");
+    }
 
-    if (!m_queue.isEmpty()) {
-        ImGui::Text("Front Index: %zu", m_queue.frontIndex());
-        ImGui::Text("Rear Index: %zu", m_queue.rearIndex());
+    if (!m_queue->isEmpty()) {
+        ImGui::Text("Front Index: %zu", m_queue->frontIndex());
+        ImGui::Text("Rear Index: %zu", m_queue->rearIndex());
     }
 
     ImGui::End();
@@ -358,16 +440,16 @@ void QueueVisualizer::renderControls() {
 
 void QueueVisualizer::enqueueValue(int value) {
     // Check if queue is full
-    if (m_queue.isFull()) {
+    if (m_queue->isFull()) {
         m_statusText = "Error: Queue Overflow!";
         return;
     }
 
     // Get the rear index before enqueueing
-    size_t rearIdx = m_queue.rearIndex();
+    size_t rearIdx = m_queue->rearIndex();
 
     // Enqueue to actual queue
-    m_queue.enqueue(value);
+    m_queue->enqueue(value);
 
     // Update status
     std::ostringstream oss;
@@ -382,15 +464,17 @@ void QueueVisualizer::enqueueValue(int value) {
     newElem.size = glm::vec2(ELEMENT_WIDTH, ELEMENT_HEIGHT);
     newElem.color = colors::semantic::elementBase;
     newElem.borderColor = colors::semantic::active;
-    newElem.label = std::to_string(value);
-    newElem.sublabel = "";
+    newElem.label = labels::fromInt(value);
 
     m_elements.push_back(newElem);
 
+    // A new rear block is shown before the element slides into it
+    animateCapacityEvents();
+
     // Animate: Slide in from right
     auto& elem = m_elements.back();
     Animation slideIn = createMoveAnimation(elem.position, targetPos, 0.4f);
-    slideIn.easingFn = easing::easeOutBack;
+    slideIn.easing = Easing::EaseOutBack;
     m_animator.enqueue(slideIn);
 
     // Flash green to indicate success
@@ -408,13 +492,13 @@ void QueueVisualizer::enqueueValue(int value) {
 
 void QueueVisualizer::dequeueValue() {
     // Check if queue is empty
-    if (m_queue.isEmpty()) {
+    if (m_queue->isEmpty()) {
         m_statusText = "Error: Queue Underflow!";
         return;
     }
 
     // Get the value before dequeueing
-    auto value = m_queue.peek();
+    auto value = m_queue->peek();
     if (!value) return;
 
     // Update status
@@ -436,7 +520,7 @@ void QueueVisualizer::dequeueValue() {
         glm::vec2(elem.position.x - 150.0f, elem.position.y),
         0.4f
     );
-    slideOut.easingFn = easing::easeIn;
+    slideOut.easing = Easing::EaseIn;
     slideOut.onComplete = [this, value]() {
         // Remove visual element
         if (!m_elements.empty()) {
@@ -450,11 +534,12 @@ void QueueVisualizer::dequeueValue() {
     m_animator.enqueue(slideOut);
 
     // Dequeue from actual queue
-    m_queue.dequeue();
+    m_queue->dequeue();
+    animateCapacityEvents();
 }
 
 void QueueVisualizer::peekValue() {
-    auto value = m_queue.peek();
+    auto value = m_queue->peek();
     if (value) {
         std::ostringstream oss;
         oss << "Front element: " << *value;
@@ -476,14 +561,12 @@ void QueueVisualizer::peekValue() {
 
 void QueueVisualizer::initializeRandom(size_t count) {
     // Clear existing queue
-    m_queue.clear();
+    m_workload.stop();
+    m_queue->clear();
     m_elements.clear();
     m_animator.clear();
 
-    // Clamp count to capacity
-    if (count > m_queue.capacity()) {
-        count = m_queue.capacity();
-    }
+    count = std::min(count, static_cast<size_t>(MAX_INIT_COUNT));
 
     // Update status
     std::ostringstream oss;
@@ -495,24 +578,30 @@ void QueueVisualizer::initializeRandom(size_t count) {
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(1, 99);
 
-    // Populate queue with random values
+    // Populate queue with random values (a fixed-size backend stops when full)
     for (size_t i = 0; i < count; ++i) {
-        m_queue.enqueue(dis(gen));
+        if (!m_queue->enqueue(dis(gen))) {
+            break;
+        }
     }
+    count = m_queue->size();
+    skipCapacityEvents();
 
     // Sync visuals
     syncVisuals();
 
-    // Animate each element appearing with a cascade effect from front to rear
-    for (size_t i = 0; i < m_elements.size(); ++i) {
+    // Animate the front elements appearing with a cascade effect from front to rear
+    size_t cascadeEnd = std::min(m_elements.size(), MAX_CASCADE);
+    for (size_t i = 0; i < cascadeEnd; ++i) {
         auto& elem = m_elements[i];
 
         // Flash to show appearance
         Animation fadeIn = createColorAnimation(elem.color, colors::semantic::elementBase, 0.15f);
-        if (i == m_elements.size() - 1) {
+        if (i == cascadeEnd - 1) {
             fadeIn.onComplete = [this, count]() {
                 std::ostringstream oss;
-                oss << "Initialized queue with " << count << " random elements";
+                oss << "Initialized queue with " << count << " random elements in "
+                    << m_queue->blockCount() << " block(s)";
                 m_statusText = oss.str();
             };
         }
@@ -524,6 +613,55 @@ void QueueVisualizer::initializeRandom(size_t count) {
     m_zoomLevel = 1.0f;
 }
 
+bool QueueVisualizer::saveSnapshot(const std::string& path) {
+    // Blocks are not contiguous: gather front to rear first
+    std::vector<int> values(m_queue->size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = m_queue->atPosition(i);
+    }
+    std::string error;
+    if (!algorithms::writeSnapshot(path, algorithms::SnapshotKind::Queue, values.data(), values.size(),
+                                   nullptr, error)) {
+        m_statusText = "Save failed: " + error;
+        return false;
+    }
+    m_statusText = "Saved " + std::to_string(values.size()) + " elements to " + path;
+    return true;
+}
+
+bool QueueVisualizer::loadSnapshot(const std::string& path) {
+    algorithms::SnapshotReader reader;
+    std::vector<int> values;
+    if (!reader.open(path) || !reader.expect(algorithms::SnapshotKind::Queue)) {
+        m_statusText = "Load failed: " + reader.error();
+        return false;
+    }
+    reader.readElements(values);
+
+    m_workload.stop();
+    m_animator.clear();
+    m_elements.clear();
+    m_blockFlash = 0.0f;
+    m_queue->clear();
+    size_t loaded = 0;
+    while (loaded < values.size() && m_queue->enqueue(values[loaded])) {
+        ++loaded;
+    }
+    skipCapacityEvents();
+    syncVisuals();
+
+    m_cameraOffsetX = 0.0f;
+    m_zoomLevel = 1.0f;
+    std::ostringstream oss;
+    oss << "Loaded " << loaded << " elements from " << path;
+    if (loaded < values.size()) {
+        oss << " (queue full, " << values.size() - loaded << " dropped)";
+    }
+    m_statusText = oss.str();
+    m_isPaused = true;
+    return true;
+}
+
 void QueueVisualizer::play() {
     m_isPaused = false;
     m_animator.setPaused(false);
@@ -540,13 +678,45 @@ void QueueVisualizer::step() {
 }
 
 void QueueVisualizer::reset() {
-    m_queue.clear();
+    m_workload.stop();
+    m_queue->clear();
+    skipCapacityEvents();
+    m_blockFlash = 0.0f;
     m_elements.clear();
     m_animator.clear();
     m_statusText = "Queue reset";
     m_isPaused = true;
 }
 
+bool QueueVisualizer::stepBack() {
+    size_t position = m_workload.replay().position();
+    return position > 0 && seek(position - 1);
+}
+
+bool QueueVisualizer::seek(size_t step) {
+    if (!m_workload.seek(step)) {
+        return false;
+    }
+    syncWorkload();
+    m_statusText = m_workload.statusText();
+    return true;
+}
+
+void QueueVisualizer::animateWorkloadOp(const algorithms::WorkloadOp& op) {
+    switch (op.code) {
+        case algorithms::WorkloadOpCode::Insert: enqueueValue(op.operand); break;
+        case algorithms::WorkloadOpCode::Remove: dequeueValue(); break;
+        case algorithms::WorkloadOpCode::Search: peekValue(); break;
+    }
+}
+
+void QueueVisualizer::syncWorkload() {
+    m_animator.clear();
+    m_blockFlash = 0.0f;
+    skipCapacityEvents();
+    syncVisuals();
+}
+
 void QueueVisualizer::setSpeed(float speed) {
     m_speed = speed;
     m_animator.setSpeedMultiplier(speed);
@@ -568,8 +738,8 @@ void QueueVisualizer::syncVisuals() {
     m_elements.clear();
 
     // Iterate through queue elements from front to rear
-    for (size_t i = 0; i < m_queue.size(); ++i) {
-        size_t actualIndex = (m_queue.frontIndex() + i) % m_queue.capacity();
+    for (size_t i = 0; i < m_queue->size(); ++i) {
+        size_t actualIndex = m_queue->slotOf(i);
 
         VisualElement elem;
         elem.position = calculatePosition(actualIndex);
@@ -578,15 +748,87 @@ void QueueVisualizer::syncVisuals() {
         elem.borderColor = (i == 0)
             ? colors::semantic::active  // Highlight front
             : colors::semantic::elementBorder;
-        elem.label = std::to_string(m_queue.atPosition(i));
-        elem.sublabel = "";
+        elem.label = labels::fromInt(m_queue->atPosition(i));
 
         m_elements.push_back(elem);
     }
 }
 
+size_t QueueVisualizer::shownSlots() const {
+    return std::max(m_queue->capacity(), m_queue->blockSize());
+}
+
+size_t QueueVisualizer::animateCapacityEvents() {
+    const CapacityEventLog* log = m_queue->eventLog();
+    if (log == nullptr) {
+        return 0;
+    }
+
+    const auto& events = log->events();
+    std::uint64_t first = std::max(m_eventCursor, events.beginSequence());
+    size_t count = static_cast<size_t>(events.endSequence() - first);
+
+    for (std::uint64_t seq = first; seq < events.endSequence(); ++seq) {
+        const CapacityEvent& event = events[static_cast<size_t>(seq - events.beginSequence())];
+
+        std::ostringstream oss;
+        switch (event.type) {
+            case CapacityEventType::BlockAllocate:
+            case CapacityEventType::BlockReuse:
+                oss << "Rear block full: "
+                    << (event.type == CapacityEventType::BlockReuse ? "reused a spare" : "allocated a new")
+                    << " block (" << event.newCapacity << " slots)";
+                m_newSlotsFrom = event.oldCapacity;
+                m_blockFlash = BLOCK_FLASH_SECONDS;
+                m_statusText = oss.str();
+                break;
+
+            case CapacityEventType::BlockRetire:
+            case CapacityEventType::BlockFree: {
+                oss << "Front block drained: "
+                    << (event.type == CapacityEventType::BlockRetire ? "kept as a spare" : "freed")
+                    << ", slots renumbered from the next block";
+                std::string status = oss.str();
+                m_blockFlash = 0.0f;
+
+                // The dequeued element is erased before this step plays, so
+                // element k then holds queue position k and slides left one block
+                std::vector<Animation> shift;
+                for (size_t k = 0; k < event.size && k < m_elements.size(); ++k) {
+                    shift.push_back(createMoveAnimation(
+                        m_elements[k].position,
+                        calculatePosition(m_queue->slotOf(k)),
+                        0.4f
+                    ));
+                }
+                if (shift.empty()) {
+                    m_statusText = status;
+                    break;
+                }
+                shift.front().onComplete = [this, status]() {
+                    m_statusText = status;
+                };
+                m_animator.enqueueParallel(std::move(shift));
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    m_eventCursor = events.endSequence();
+    return count;
+}
+
+void QueueVisualizer::skipCapacityEvents() {
+    if (const CapacityEventLog* log = m_queue->eventLog()) {
+        m_eventCursor = log->events().endSequence();
+    }
+}
+
 glm::vec2 QueueVisualizer::calculatePosition(size_t arrayIndex) const {
-    // Elements arranged horizontally in a line (circular buffer layout)
+    // Elements arranged horizontally in a line, block after block
     float x = arrayIndex * (ELEMENT_WIDTH + ELEMENT_SPACING);
     float y = START_Y;
     return glm::vec2(x, y);
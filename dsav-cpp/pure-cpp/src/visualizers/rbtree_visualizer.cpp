@@ -5,6 +5,9 @@
 
 #include "visualizers/rbtree_visualizer.hpp"
 #include "ui_components.hpp"
+#include "trace_writer.hpp"
+#include "algorithms/snapshot.hpp"
+#include "algorithms/workload_targets.hpp"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
@@ -14,7 +17,14 @@
 namespace dsav {
 
 RBTreeVisualizer::RBTreeVisualizer()
-    : m_statusText("Red-Black Tree is empty") {
+    : m_layout(HORIZONTAL_SPACING, VERTICAL_SPACING),
+      m_statusText("Red-Black Tree is empty") {
+    m_layout.setOrigin(glm::vec2(START_X, START_Y));
+    m_density.reset(START_X, HORIZONTAL_SPACING);
+    m_rbTree.enableChangeTracking();
+    m_rbTree.enableEventRecording();
+    m_animator.bindContainer(m_visualNodes);
+
     // Initialize with a balanced tree for demonstration
     m_rbTree.insert(50);
     m_rbTree.insert(30);
@@ -28,15 +38,48 @@ RBTreeVisualizer::RBTreeVisualizer()
     m_currentCase.caseName = "Ready";
     m_currentCase.explanation = "Insert values to see RB tree balancing in action";
     m_currentCase.nodeRoles = "";
+
+    // Keyframes are snapshots; a restore relinks them into a replacement tree
+    algorithms::WorkloadHooks hooks;
+    hooks.apply = [this](const algorithms::WorkloadOp& op) { return algorithms::applyTreeOp(m_rbTree, op); };
+    hooks.capture = [this](algorithms::WorkloadKeyframe& keyframe) {
+        m_rbTree.exportPreorder(keyframe.elements, keyframe.colorBits);
+    };
+    hooks.restore = [this](const algorithms::WorkloadKeyframe& keyframe) {
+        BulkLoad load;
+        load.tree.enableChangeTracking();
+        load.tree.enableEventRecording();
+        load.tree.restorePreorder(keyframe.elements.data(), keyframe.colorBits.data(), keyframe.elements.size());
+        layOutReplacement(load);
+        adoptReplacement(load);
+    };
+    m_workload.setHooks(std::move(hooks));
+}
+
+RBTreeVisualizer::~RBTreeVisualizer() {
+    // The pending completion captures this; cancelling drops it
+    if (m_bulkJob) m_bulkJob->cancel();
 }
 
 void RBTreeVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
 
+    // Continue a pending bulk insert within this frame's budget
+    drainPendingInserts();
+
+    // A playing replay moves on once the last sampled op has finished animating
+    if (m_workload.isPlaying() && !isAnimating()) {
+        if (m_workload.advance([this](const algorithms::WorkloadOp& op) { animateWorkloadOp(op); })) {
+            syncWorkload();
+        }
+    }
+
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_rbTree.isEmpty()) {
+        if (m_workload.replay().isActive()) {
+            m_statusText = m_workload.statusText();
+        } else if (m_rbTree.isEmpty()) {
             m_statusText = "Red-Black Tree is empty";
         } else {
             std::ostringstream oss;
@@ -51,13 +94,7 @@ void RBTreeVisualizer::renderVisualization() {
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     ImVec2 canvasPos = ImGui::GetCursorScreenPos();
     ImVec2 canvasSize = ImGui::GetContentRegionAvail();
-
-    // Draw background
-    drawList->AddRectFilled(
-        canvasPos,
-        ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
-        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
-    );
+    m_canvasSize = canvasSize;
 
     // Calculate smaller hitbox (with padding on all sides)
     const float padding = 20.0f;
@@ -112,67 +149,41 @@ void RBTreeVisualizer::renderVisualization() {
         }
     }
 
+    // Center once on a node picked by select, so panning still works afterwards
+    if (m_jumpTarget != NULL_NODE) {
+        if (m_rbTree.isLive(m_jumpTarget)) {
+            const glm::vec2& world = m_visualNodes[m_jumpTarget].position;
+            m_cameraOffsetX = canvasSize.x * 0.5f - world.x * m_zoomLevel;
+            m_cameraOffsetY = canvasSize.y * 0.5f - world.y * m_zoomLevel;
+        }
+        m_jumpTarget = NULL_NODE;
+    }
+
     // Apply camera offset
     float horizontalOffset = m_cameraOffsetX;
     float verticalOffset = m_cameraOffsetY;
 
-    // Draw connections first (so they appear behind nodes)
-    auto root = m_rbTree.root();
-    if (root) {
-        std::function<void(std::shared_ptr<RBTreeNode<int>>)> drawConnections;
-        drawConnections = [&](std::shared_ptr<RBTreeNode<int>> node) {
-            if (!node) return;
-
-            auto parentIt = m_nodePositions.find(node->data);
-            if (parentIt == m_nodePositions.end()) return;
-
-            // Apply zoom and camera offset to parent position
-            float scaledParentX = parentIt->second.x * m_zoomLevel;
-            float scaledParentY = parentIt->second.y * m_zoomLevel;
-            ImVec2 parentPos = ImVec2(
-                canvasPos.x + scaledParentX + horizontalOffset,
-                canvasPos.y + scaledParentY + verticalOffset
-            );
-
-            // Draw connection to left child
-            if (node->left) {
-                auto leftIt = m_nodePositions.find(node->left->data);
-                if (leftIt != m_nodePositions.end()) {
-                    float scaledLeftX = leftIt->second.x * m_zoomLevel;
-                    float scaledLeftY = leftIt->second.y * m_zoomLevel;
-                    ImVec2 leftPos = ImVec2(
-                        canvasPos.x + scaledLeftX + horizontalOffset,
-                        canvasPos.y + scaledLeftY + verticalOffset
-                    );
-                    drawConnection(drawList, parentPos, leftPos,
-                                 ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)));
-                }
-            }
-
-            // Draw connection to right child
-            if (node->right) {
-                auto rightIt = m_nodePositions.find(node->right->data);
-                if (rightIt != m_nodePositions.end()) {
-                    float scaledRightX = rightIt->second.x * m_zoomLevel;
-                    float scaledRightY = rightIt->second.y * m_zoomLevel;
-                    ImVec2 rightPos = ImVec2(
-                        canvasPos.x + scaledRightX + horizontalOffset,
-                        canvasPos.y + scaledRightY + verticalOffset
-                    );
-                    drawConnection(drawList, parentPos, rightPos,
-                                 ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)));
-                }
-            }
+    // Everything outside the canvas is culled; zoomed out drops labels
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    ImU32 connectionColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0));
 
-            drawConnections(node->left);
-            drawConnections(node->right);
-        };
-
-        drawConnections(root);
+    // Nodes the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_visualNodes, m_animatedScratch);
+    if (m_animatedScratch != m_animatedNodes) {
+        m_animatedNodes.swap(m_animatedScratch);
+        m_sceneVersion++;
     }
 
-    // Draw nodes
-    for (const auto& vnode : m_visualNodes) {
+    auto toScreen = [&](NodeIndex id) {
+        const glm::vec2& world = m_visualNodes[id].position;
+        return ImVec2(
+            canvasPos.x + world.x * m_zoomLevel + horizontalOffset,
+            canvasPos.y + world.y * m_zoomLevel + verticalOffset
+        );
+    };
+
+    float radius = NODE_RADIUS * m_zoomLevel;
+    auto drawNode = [&](const VisualRBTreeNode& vnode) {
         // Apply zoom and camera offset to node position
         float scaledX = vnode.position.x * m_zoomLevel;
         float scaledY = vnode.position.y * m_zoomLevel;
@@ -180,55 +191,134 @@ void RBTreeVisualizer::renderVisualization() {
             canvasPos.x + scaledX + horizontalOffset,
             canvasPos.y + scaledY + verticalOffset
         );
-
-        float radius = vnode.isNIL ? NIL_NODE_RADIUS * m_zoomLevel : NODE_RADIUS * m_zoomLevel;
+        if (!viewport.isCircleVisible(center, radius)) return;
 
         // Draw circle
         drawList->AddCircleFilled(
             center,
             radius,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.color))
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.color)),
+            viewport.circleSegments()
         );
 
         // Draw border (RED or BLACK, thicker to make it visible)
-        float borderThickness = vnode.isNIL ? 1.5f : 3.0f;
         drawList->AddCircle(
             center,
             radius,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(vnode.borderColor)),
-            0,
-            borderThickness
+            viewport.circleSegments(),
+            3.0f
         );
 
+        if (!viewport.isFullDetail()) return;
+
         // Draw label (centered)
-        if (!vnode.label.empty()) {
-            ImVec2 textSize = ImGui::CalcTextSize(vnode.label.c_str());
+        labels::drawCentered(
+            drawList,
+            center,
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::text)),
+            vnode.label
+        );
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = m_zoomLevel;
+    cacheKey.offsetX = horizontalOffset;
+    cacheKey.offsetY = verticalOffset;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Draw background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
+
+        // Draw connections first (so they appear behind nodes); those of a
+        // moving node follow it in the live pass
+        auto traversal = m_rbTree.preorder();
+        for (auto it = traversal.begin(); it != traversal.end(); ++it) {
+            auto node = it.handle();
+            bool parentAnimated = m_animatedNodes[node.index()] != 0;
+            ImVec2 parentPos = toScreen(node.index());
+
+            for (auto child : {node.left(), node.right()}) {
+                if (!child || parentAnimated || m_animatedNodes[child.index()]) continue;
+
+                ImVec2 childPos = toScreen(child.index());
+                if (viewport.isSegmentVisible(parentPos, childPos)) {
+                    drawConnection(drawList, parentPos, childPos, connectionColor);
+                }
+            }
+
+            // NIL leaves hang off the node wherever a child is missing
+            if (m_showNIL && !parentAnimated) {
+                if (!node.left()) drawNILNode(drawList, viewport, parentPos, true);
+                if (!node.right()) drawNILNode(drawList, viewport, parentPos, false);
+            }
+        }
+
+        // Draw resting nodes
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (m_visualNodes[id].active && !m_animatedNodes[id]) {
+                drawNode(m_visualNodes[id]);
+            }
+        }
+
+        // Draw info text if empty
+        if (m_rbTree.isEmpty()) {
             ImVec2 textPos = ImVec2(
-                center.x - textSize.x / 2.0f,
-                center.y - textSize.y / 2.0f
+                canvasPos.x + canvasSize.x / 2.0f - 150.0f,
+                canvasPos.y + canvasSize.y / 2.0f
             );
-            ImU32 textColor = vnode.isNIL
-                ? ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::subtext0))
-                : ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::text));
             drawList->AddText(
                 textPos,
-                textColor,
-                vnode.label.c_str()
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "RB Tree is empty. Use Insert to add nodes."
             );
         }
     }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating nodes on top, with their connections and NIL leaves
+    if (animatedCount > 0) {
+        std::vector<NodeIndex> restingEnds;
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (!m_visualNodes[id].active) continue;
+            auto node = m_rbTree.node(id);
+            bool parentAnimated = m_animatedNodes[id] != 0;
+            ImVec2 parentPos = toScreen(id);
+
+            for (auto child : {node.left(), node.right()}) {
+                if (!child) continue;
+                bool childAnimated = m_animatedNodes[child.index()] != 0;
+                if (!parentAnimated && !childAnimated) continue;
+
+                ImVec2 childPos = toScreen(child.index());
+                if (viewport.isSegmentVisible(parentPos, childPos)) {
+                    drawConnection(drawList, parentPos, childPos, connectionColor);
+                }
+                // A cached end is drawn again, so the live line stays behind it
+                restingEnds.push_back(parentAnimated ? child.index() : id);
+            }
 
-    // Draw info text if empty
-    if (m_rbTree.isEmpty()) {
-        ImVec2 textPos = ImVec2(
-            canvasPos.x + canvasSize.x / 2.0f - 150.0f,
-            canvasPos.y + canvasSize.y / 2.0f
-        );
-        drawList->AddText(
-            textPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
-            "RB Tree is empty. Use Insert to add nodes."
-        );
+            if (m_showNIL && parentAnimated) {
+                if (!node.left()) drawNILNode(drawList, viewport, parentPos, true);
+                if (!node.right()) drawNILNode(drawList, viewport, parentPos, false);
+            }
+        }
+
+        for (NodeIndex id : restingEnds) {
+            if (!m_animatedNodes[id]) {
+                drawNode(m_visualNodes[id]);
+            }
+        }
+        for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+            if (m_visualNodes[id].active && m_animatedNodes[id]) {
+                drawNode(m_visualNodes[id]);
+            }
+        }
     }
 
     // Draw hint text at bottom showing controls and zoom level
@@ -256,8 +346,13 @@ void RBTreeVisualizer::renderControls() {
         "Insert",
         "Delete",
         "Search",
+        "Select k-th Smallest",
+        "Percentile",
+        "Count in Range",
         "Traverse: Inorder",
-        "Initialize Random"
+        "Initialize Random",
+        "Load Random Keys",
+        "Import Dataset"
     };
     int currentModeIdx = static_cast<int>(m_currentMode);
     if (ImGui::Combo("##Mode", &currentModeIdx, modes, IM_ARRAYSIZE(modes))) {
@@ -276,18 +371,48 @@ void RBTreeVisualizer::renderControls() {
         m_currentMode == OperationMode::Search) {
         ImGui::InputInt("Value", &m_inputValue);
     }
+    // Rank input (for Select k-th)
+    else if (m_currentMode == OperationMode::SelectKth) {
+        ImGui::InputInt("k (1 = smallest)", &m_selectRank);
+        m_selectRank = std::clamp(m_selectRank, 1, std::max(1, static_cast<int>(m_rbTree.size())));
+    }
+    // Percentile (for Percentile)
+    else if (m_currentMode == OperationMode::Percentile) {
+        ImGui::SliderFloat("Percentile", &m_percentile, 0.0f, 100.0f, "%.1f");
+    }
+    // Bounds (for Count in Range)
+    else if (m_currentMode == OperationMode::CountRange) {
+        ImGui::InputInt("Low", &m_rangeLow);
+        ImGui::InputInt("High", &m_rangeHigh);
+    }
     // Count input (for Initialize)
     else if (m_currentMode == OperationMode::Initialize) {
         ImGui::InputInt("Count (1-20)", &m_initCount);
         m_initCount = std::clamp(m_initCount, 1, 20);
     }
+    // Key count (for bulk load)
+    else if (m_currentMode == OperationMode::LoadRandomKeys) {
+        ImGui::SliderInt("Keys", &m_bulkCount, 1, MAX_BULK_KEYS, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::Checkbox("Keep existing keys", &m_bulkKeepExisting);
+        ui::Tooltip("Batch-insert into the current tree instead of replacing it");
+        if (m_bulkJob) {
+            ImGui::Text("Loading keys...");
+        }
+    }
+    // File (for dataset import)
+    else if (m_currentMode == OperationMode::ImportDataset) {
+        m_importPanel.render();
+        if (m_bulkJob) {
+            ImGui::Text("Loading keys...");
+        }
+    }
 
     ImGui::PopItemWidth();
 
     ImGui::Spacing();
 
     // Execute button
-    ImGui::BeginDisabled(isAnimating());
+    ImGui::BeginDisabled(isAnimating() || m_workload.isPlaying());
 
     bool canExecute = true;
     std::string buttonLabel = "Execute";
@@ -308,6 +433,21 @@ void RBTreeVisualizer::renderControls() {
             tooltipText = "Search for value in RB tree";
             canExecute = !m_rbTree.isEmpty();
             break;
+        case OperationMode::SelectKth:
+            buttonLabel = "Select";
+            tooltipText = "Walk down by subtree sizes to the k-th smallest key (O(log n))";
+            canExecute = !m_rbTree.isEmpty();
+            break;
+        case OperationMode::Percentile:
+            buttonLabel = "Select Percentile";
+            tooltipText = "Nearest-rank percentile: select(ceil(p / 100 * n) - 1)";
+            canExecute = !m_rbTree.isEmpty();
+            break;
+        case OperationMode::CountRange:
+            buttonLabel = "Count";
+            tooltipText = "Count keys in [Low, High] from two rank queries (O(log n))";
+            canExecute = !m_rbTree.isEmpty();
+            break;
         case OperationMode::TraverseInorder:
             buttonLabel = "Traverse Inorder";
             tooltipText = "Inorder traversal (Left-Root-Right)";
@@ -317,6 +457,15 @@ void RBTreeVisualizer::renderControls() {
             buttonLabel = "Initialize Random";
             tooltipText = "Create RB tree with random values";
             break;
+        case OperationMode::LoadRandomKeys:
+            buttonLabel = "Load Random Keys";
+            tooltipText = "Bulk-load random keys in one pass (no per-insert animation)";
+            break;
+        case OperationMode::ImportDataset:
+            buttonLabel = "Import";
+            tooltipText = "Replace the tree with a balanced bulk load of the file's keys";
+            canExecute = m_importPanel.hasPath();
+            break;
     }
 
     if (!canExecute) {
@@ -334,12 +483,27 @@ void RBTreeVisualizer::renderControls() {
             case OperationMode::Search:
                 searchValue(m_inputValue);
                 break;
+            case OperationMode::SelectKth:
+                selectKth(static_cast<size_t>(m_selectRank - 1));
+                break;
+            case OperationMode::Percentile:
+                selectPercentile(m_percentile);
+                break;
+            case OperationMode::CountRange:
+                countRange(m_rangeLow, m_rangeHigh);
+                break;
             case OperationMode::TraverseInorder:
                 traverseInorder();
                 break;
             case OperationMode::Initialize:
                 initializeRandom(m_initCount);
                 break;
+            case OperationMode::LoadRandomKeys:
+                loadRandomKeys(static_cast<size_t>(m_bulkCount));
+                break;
+            case OperationMode::ImportDataset:
+                importDataset(m_importPanel.path(), m_importPanel.format());
+                break;
         }
     }
 
@@ -352,6 +516,19 @@ void RBTreeVisualizer::renderControls() {
 
     ImGui::Separator();
 
+    renderMinimap();
+
+    // Workload replay: insert, delete and search by key; not while keys are still loading
+    if (ImGui::CollapsingHeader("Workload Replay")) {
+        ImGui::BeginDisabled(m_bulkJob != nullptr || m_pendingInsertPos < m_pendingInserts.size());
+        if (m_workload.render()) {
+            syncWorkload();
+        }
+        ImGui::EndDisabled();
+    }
+
+    ImGui::Separator();
+
     // Playback controls
     ui::PlaybackControls(
         m_isPaused,
@@ -368,7 +545,9 @@ void RBTreeVisualizer::renderControls() {
 
     // Display options
     ImGui::Text("Display Options:");
-    ImGui::Checkbox("Show NIL Leaves", &m_showNIL);
+    if (ImGui::Checkbox("Show NIL Leaves", &m_showNIL)) {
+        m_sceneVersion++;
+    }
     ui::Tooltip("Show black NIL leaf nodes for educational purposes");
 
     ImGui::Checkbox("Show Case Explanation", &m_showCaseExplanation);
@@ -407,80 +586,84 @@ void RBTreeVisualizer::renderControls() {
             ImGui::Text("Nodes: %s", m_currentCase.nodeRoles.c_str());
         }
 
+        ImGui::Spacing();
+        if (ImGui::CollapsingHeader("Event Log")) {
+            renderEventLog();
+        }
+
         ImGui::End();
     }
 }
 
+void RBTreeVisualizer::renderEventLog() {
+    bool recording = m_rbTree.isRecordingEvents();
+    if (ImGui::Checkbox("Record events", &recording)) {
+        if (recording) {
+            m_rbTree.enableEventRecording();
+        } else {
+            m_rbTree.disableEventRecording();
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Clear")) {
+        m_rbTree.clearEvents();
+    }
+
+    const auto& events = m_rbTree.events();
+    ImGui::Text("%zu most recent event(s)", events.size());
+
+    // Only the rows on screen are formatted, newest first
+    ImGui::BeginChild("##rb_event_log", ImVec2(0, 200.0f), true);
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(events.size()));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            std::string text = describeEvent(events[events.size() - 1 - static_cast<size_t>(row)]);
+            ImGui::TextUnformatted(text.c_str());
+        }
+    }
+    clipper.End();
+    ImGui::EndChild();
+}
+
+void RBTreeVisualizer::traceNewEvents() {
+    if (!trace::isActive()) {
+        return;
+    }
+
+    static const char* const EVENT_NAMES[] = {
+        "InsertNode", "Recolor", "RotateLeft", "RotateRight", "Case1_UncleRed",
+        "Case2_Triangle", "Case3_Line", "SetRootBlack", "DeleteNode", "DeleteFixup"
+    };
+
+    // Events the ring already overwrote are skipped
+    const auto& events = m_rbTree.events();
+    std::uint64_t first = std::max(m_traceCursor, events.beginSequence());
+    for (std::uint64_t seq = first; seq < events.endSequence(); ++seq) {
+        const RBTreeEvent<int>& event = events[static_cast<size_t>(seq - events.beginSequence())];
+        trace::instant(EVENT_NAMES[static_cast<size_t>(event.type)], "Red-Black Tree", trace::ALGORITHM_TRACK,
+                       "value", event.value, "case", event.fixupCase);
+    }
+    m_traceCursor = events.endSequence();
+}
+
 void RBTreeVisualizer::insertValue(int value) {
     // Update status
     std::ostringstream oss;
     oss << "Inserting " << value << "...";
     m_statusText = oss.str();
 
-    // Step 1: Capture positions BEFORE insertion
-    std::map<int, glm::vec2> oldPositions = m_nodePositions;
-    std::map<int, RBColor> oldColors;
-
-    // Store colors of existing nodes
-    auto root = m_rbTree.root();
-    if (root) {
-        std::function<void(std::shared_ptr<RBTreeNode<int>>)> captureColors;
-        captureColors = [&](std::shared_ptr<RBTreeNode<int>> node) {
-            if (!node) return;
-            oldColors[node->data] = node->color;
-            captureColors(node->left);
-            captureColors(node->right);
-        };
-        captureColors(root);
-    }
-
-    // Step 2: Perform insertion
+    // Step 1: Perform insertion
+    m_traceCursor = m_rbTree.events().endSequence();
     m_rbTree.insert(value);
+    traceNewEvents();
 
-    // Step 3: Recalculate positions AFTER insertion
-    syncVisuals();
-    std::map<int, glm::vec2> newPositions = m_nodePositions;
-
-    // Step 4: Detect moved nodes and create smooth animations
+    // Step 2: Re-layout the touched part of the tree, animating nodes that
+    // moved (rotations) and borders that changed (recoloring)
     std::vector<Animation> parallelMoves;
+    syncVisuals(&parallelMoves);
 
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.isNIL) continue;  // Skip NIL nodes
-
-        auto oldPosIt = oldPositions.find(vnode.value);
-        if (oldPosIt != oldPositions.end()) {
-            // Node existed before - check if it moved
-            if (glm::distance(oldPosIt->second, vnode.position) > 1.0f) {
-                // Node moved! Create smooth animation
-                vnode.position = oldPosIt->second;  // Start from old position
-
-                Animation moveAnim = createMoveAnimation(
-                    vnode.position,
-                    newPositions[vnode.value],
-                    0.5f  // 0.5 seconds for rotation animation
-                );
-                moveAnim.easingFn = easing::easeOutBack;  // Smooth overshoot
-                parallelMoves.push_back(moveAnim);
-            }
-
-            // Check if color changed
-            auto oldColorIt = oldColors.find(vnode.value);
-            if (oldColorIt != oldColors.end() && oldColorIt->second != vnode.rbColor) {
-                // Color changed! Animate border color
-                glm::vec4 oldBorderColor = (oldColorIt->second == RBColor::RED)
-                    ? colors::semantic::error : colors::mocha::text;
-
-                Animation colorAnim = createColorAnimation(
-                    vnode.borderColor,
-                    getBorderColor(vnode.rbColor),
-                    0.4f
-                );
-                parallelMoves.push_back(colorAnim);
-            }
-        }
-    }
-
-    // Step 5: Enqueue parallel animations for rotations
+    // Step 3: Enqueue parallel animations for rotations
     if (!parallelMoves.empty()) {
         m_animator.enqueueParallel(parallelMoves);
 
@@ -490,34 +673,31 @@ void RBTreeVisualizer::insertValue(int value) {
         m_currentCase.nodeRoles = "Animated: " + std::to_string(parallelMoves.size()) + " operations";
     }
 
-    // Step 6: Highlight the newly inserted node
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.value == value && !vnode.isNIL) {
-            Animation flashGreen = createColorAnimation(
-                vnode.color,
-                colors::semantic::sorted,
-                0.3f
-            );
-            m_animator.enqueue(flashGreen);
+    // Step 4: Highlight the newly inserted node
+    if (VisualRBTreeNode* vnode = findVisual(value)) {
+        Animation flashGreen = createColorAnimation(
+            vnode->color,
+            colors::semantic::sorted,
+            0.3f
+        );
+        m_animator.enqueue(flashGreen);
 
-            Animation flashBack = createColorAnimation(
-                vnode.color,
-                colors::semantic::elementBase,
-                0.3f
-            );
-            flashBack.onComplete = [this, value]() {
-                std::ostringstream oss;
-                oss << "Inserted " << value << " - Tree balanced";
-                m_statusText = oss.str();
+        Animation flashBack = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
+        flashBack.onComplete = [this, value]() {
+            std::ostringstream oss;
+            oss << "Inserted " << value << " - Tree balanced";
+            m_statusText = oss.str();
 
-                // Update explanation
-                m_currentCase.caseName = "Insertion Complete";
-                m_currentCase.explanation = "RB tree properties maintained. All rotations and recoloring complete.";
-                m_currentCase.nodeRoles = "";
-            };
-            m_animator.enqueue(flashBack);
-            break;
-        }
+            // Update explanation
+            m_currentCase.caseName = "Insertion Complete";
+            m_currentCase.explanation = "RB tree properties maintained. All rotations and recoloring complete.";
+            m_currentCase.nodeRoles = "";
+        };
+        m_animator.enqueue(flashBack);
     }
 }
 
@@ -544,92 +724,38 @@ void RBTreeVisualizer::deleteValue(int value) {
     m_statusText = oss.str();
 
     // Step 1: Flash red on node being deleted
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.value == value && !vnode.isNIL) {
-            Animation flashRed = createColorAnimation(
-                vnode.color,
-                colors::semantic::error,
-                0.3f
-            );
-            m_animator.enqueue(flashRed);
-            break;
-        }
-    }
-
-    // Step 2: Capture positions and colors BEFORE deletion
-    std::map<int, glm::vec2> oldPositions = m_nodePositions;
-    std::map<int, RBColor> oldColors;
-
-    auto root = m_rbTree.root();
-    if (root) {
-        std::function<void(std::shared_ptr<RBTreeNode<int>>)> captureColors;
-        captureColors = [&](std::shared_ptr<RBTreeNode<int>> node) {
-            if (!node) return;
-            oldColors[node->data] = node->color;
-            captureColors(node->left);
-            captureColors(node->right);
-        };
-        captureColors(root);
+    if (VisualRBTreeNode* vnode = findVisual(value)) {
+        Animation flashRed = createColorAnimation(
+            vnode->color,
+            colors::semantic::error,
+            0.3f
+        );
+        m_animator.enqueue(flashRed);
     }
 
-    // Step 3: Perform deletion
+    // Step 2: Perform deletion
+    m_traceCursor = m_rbTree.events().endSequence();
     bool success = m_rbTree.remove(value);
+    traceNewEvents();
 
     if (!success) {
         m_statusText = "Error: Deletion failed";
         return;
     }
 
-    // Step 4: Recalculate positions AFTER deletion
-    syncVisuals();
-    std::map<int, glm::vec2> newPositions = m_nodePositions;
-
-    // Step 5: Detect moved nodes and create smooth animations
+    // Step 3: Re-layout the touched part of the tree with smooth transitions
     std::vector<Animation> parallelMoves;
+    syncVisuals(&parallelMoves);
 
-    for (auto& vnode : m_visualNodes) {
-        if (vnode.isNIL) continue;
-
-        auto oldPosIt = oldPositions.find(vnode.value);
-        if (oldPosIt != oldPositions.end()) {
-            // Node existed before - check if it moved
-            if (glm::distance(oldPosIt->second, vnode.position) > 1.0f) {
-                // Node moved! Create smooth animation
-                vnode.position = oldPosIt->second;  // Start from old position
-
-                Animation moveAnim = createMoveAnimation(
-                    vnode.position,
-                    newPositions[vnode.value],
-                    0.5f
-                );
-                moveAnim.easingFn = easing::easeOutBack;
-                parallelMoves.push_back(moveAnim);
-            }
-
-            // Check color changes and animate borders
-            auto oldColorIt = oldColors.find(vnode.value);
-            if (oldColorIt != oldColors.end() && oldColorIt->second != vnode.rbColor) {
-                Animation colorAnim = createColorAnimation(
-                    vnode.borderColor,
-                    getBorderColor(vnode.rbColor),
-                    0.4f
-                );
-                parallelMoves.push_back(colorAnim);
-            }
-        }
-    }
-
-    // Step 6: Enqueue parallel animations
+    // Step 4: Enqueue parallel animations
     if (!parallelMoves.empty()) {
         m_animator.enqueueParallel(parallelMoves);
         m_currentCase.caseName = "Rebalancing After Deletion";
         m_currentCase.explanation = "Performing rotations and recoloring to maintain RB tree properties...";
     }
 
-    // Step 7: Final status update
-    Animation complete;
-    complete.duration = 0.1f;
-    complete.updateFn = [](float) {};
+    // Step 5: Final status update
+    Animation complete = createDelayAnimation(0.1f);
     complete.onComplete = [this, value]() {
         std::ostringstream oss;
         oss << "Deleted " << value << " - Tree balanced";
@@ -652,62 +778,59 @@ void RBTreeVisualizer::searchValue(int value) {
     oss << "Searching for " << value << "...";
     m_statusText = oss.str();
 
+    size_t rank = m_rbTree.rank(value);
+
     // Traverse from root following BST property
     auto current = m_rbTree.root();
     bool found = false;
 
     while (current) {
-        // Find visual node
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == current->data && !vnode.isNIL) {
-                if (current->data == value) {
-                    // Found!
-                    Animation highlightFound = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::sorted,
-                        0.3f
-                    );
-                    highlightFound.onComplete = [this, value]() {
-                        std::ostringstream oss;
-                        oss << "Found " << value << " in tree";
-                        m_statusText = oss.str();
-                    };
-                    m_animator.enqueue(highlightFound);
-
-                    Animation restore = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::elementBase,
-                        0.3f
-                    );
-                    m_animator.enqueue(restore);
-                    found = true;
-                } else {
-                    // Checking this node
-                    Animation checking = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::comparing,
-                        0.2f
-                    );
-                    m_animator.enqueue(checking);
-
-                    Animation restore = createColorAnimation(
-                        vnode.color,
-                        colors::semantic::elementBase,
-                        0.2f
-                    );
-                    m_animator.enqueue(restore);
-                }
-                break;
-            }
+        VisualRBTreeNode& vnode = m_visualNodes[current.index()];
+        if (current->data == value) {
+            // Found!
+            Animation highlightFound = createColorAnimation(
+                vnode.color,
+                colors::semantic::sorted,
+                0.3f
+            );
+            highlightFound.onComplete = [this, value, rank]() {
+                std::ostringstream oss;
+                oss << "Found " << value << " in tree (rank " << rank + 1 << " of " << m_rbTree.size() << ")";
+                m_statusText = oss.str();
+            };
+            m_animator.enqueue(highlightFound);
+
+            Animation restore = createColorAnimation(
+                vnode.color,
+                colors::semantic::elementBase,
+                0.3f
+            );
+            m_animator.enqueue(restore);
+            found = true;
+        } else {
+            // Checking this node
+            Animation checking = createColorAnimation(
+                vnode.color,
+                colors::semantic::comparing,
+                0.2f
+            );
+            m_animator.enqueue(checking);
+
+            Animation restore = createColorAnimation(
+                vnode.color,
+                colors::semantic::elementBase,
+                0.2f
+            );
+            m_animator.enqueue(restore);
         }
 
         if (found) break;
 
         // Move to next node
         if (value < current->data) {
-            current = current->left;
+            current = current.left();
         } else {
-            current = current->right;
+            current = current.right();
         }
     }
 
@@ -724,40 +847,39 @@ void RBTreeVisualizer::traverseInorder() {
     m_statusText = "Inorder traversal: Left-Root-Right";
 
     for (size_t i = 0; i < order.size(); ++i) {
-        int value = order[i];
-        for (auto& vnode : m_visualNodes) {
-            if (vnode.value == value && !vnode.isNIL) {
-                Animation highlight = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::highlight,
-                    0.3f
-                );
-                m_animator.enqueue(highlight);
-
-                Animation restore = createColorAnimation(
-                    vnode.color,
-                    colors::semantic::elementBase,
-                    0.3f
-                );
-
-                if (i == order.size() - 1) {
-                    restore.onComplete = [this]() {
-                        m_statusText = "Inorder traversal complete";
-                    };
-                }
+        VisualRBTreeNode* vnode = findVisual(order[i]);
+        if (!vnode) continue;
 
-                m_animator.enqueue(restore);
-                break;
-            }
+        Animation highlight = createColorAnimation(
+            vnode->color,
+            colors::semantic::highlight,
+            0.3f
+        );
+        m_animator.enqueue(highlight);
+
+        Animation restore = createColorAnimation(
+            vnode->color,
+            colors::semantic::elementBase,
+            0.3f
+        );
+
+        if (i == order.size() - 1) {
+            restore.onComplete = [this]() {
+                m_statusText = "Inorder traversal complete";
+            };
         }
+
+        m_animator.enqueue(restore);
     }
 }
 
 void RBTreeVisualizer::initializeRandom(size_t count) {
     // Clear existing tree and animations
+    m_workload.stop();
     m_rbTree.clear();
     m_visualNodes.clear();
-    m_nodePositions.clear();
+    m_layout.clear();
+    m_density.reset(START_X, HORIZONTAL_SPACING);
     m_animator.clear();
 
     // Reset camera
@@ -781,19 +903,10 @@ void RBTreeVisualizer::initializeRandom(size_t count) {
     // Shuffle the values
     std::shuffle(values.begin(), values.end(), gen);
 
-    // Insert values into RB tree
-    for (int value : values) {
-        m_rbTree.insert(value);
-    }
-
-    // Sync visuals
-    syncVisuals();
-
-    // Update status
-    std::ostringstream oss;
-    oss << "Initialized RB tree with " << count << " nodes, Height: " << m_rbTree.height()
-        << ", Black Height: " << m_rbTree.blackHeight();
-    m_statusText = oss.str();
+    // Insert in time-budgeted batches, syncing visuals once per batch
+    m_pendingInserts = std::move(values);
+    m_pendingInsertPos = 0;
+    drainPendingInserts();
 
     // Reset case explanation
     m_currentCase.caseName = "Ready";
@@ -801,6 +914,84 @@ void RBTreeVisualizer::initializeRandom(size_t count) {
     m_currentCase.nodeRoles = "";
 }
 
+void RBTreeVisualizer::selectKth(size_t k) {
+    auto node = m_rbTree.select(k);
+    if (!node) {
+        m_statusText = "Error: rank is out of range";
+        return;
+    }
+
+    std::ostringstream oss;
+    oss << "Rank " << k + 1 << " of " << m_rbTree.size() << " is " << node->data;
+    m_statusText = "Selecting rank " + std::to_string(k + 1) + "...";
+    animateSelection(node.index(), oss.str());
+}
+
+void RBTreeVisualizer::selectPercentile(float percent) {
+    if (m_rbTree.isEmpty()) {
+        m_statusText = "Error: Tree is empty!";
+        return;
+    }
+
+    // Nearest rank: the smallest key with at least percent% of the keys at or below it
+    size_t n = m_rbTree.size();
+    auto rank = static_cast<size_t>(std::ceil(static_cast<double>(percent) / 100.0 * static_cast<double>(n)));
+    size_t k = std::clamp<size_t>(rank, 1, n) - 1;
+    auto node = m_rbTree.select(k);
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << "P" << percent << " = " << node->data
+        << " (rank " << k + 1 << " of " << n << ")";
+    m_statusText = "Selecting rank " + std::to_string(k + 1) + "...";
+    animateSelection(node.index(), oss.str());
+}
+
+void RBTreeVisualizer::countRange(int low, int high) {
+    if (low > high) std::swap(low, high);
+
+    size_t count = m_rbTree.countInRange(low, high);
+    std::ostringstream oss;
+    oss << count << " keys in [" << low << ", " << high << "]";
+    if (count == 0) {
+        m_statusText = oss.str();
+        return;
+    }
+
+    size_t first = m_rbTree.rank(low);
+    auto firstNode = m_rbTree.select(first);
+    auto lastNode = m_rbTree.select(first + count - 1);
+    oss << ": ranks " << first + 1 << " to " << first + count
+        << " (" << firstNode->data << " .. " << lastNode->data << ")";
+    m_statusText = "Counting keys in range...";
+
+    if (count > 1) animateSelection(lastNode.index(), oss.str());
+    animateSelection(firstNode.index(), oss.str());
+}
+
+void RBTreeVisualizer::animateSelection(NodeIndex id, const std::string& status) {
+    // Root-to-node path from the parent links
+    std::vector<NodeIndex> path;
+    for (auto node = m_rbTree.node(id); node; node = node.parent()) {
+        path.push_back(node.index());
+    }
+    std::reverse(path.begin(), path.end());
+
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        VisualRBTreeNode& vnode = m_visualNodes[path[i]];
+        m_animator.enqueue(createColorAnimation(vnode.color, colors::semantic::comparing, 0.2f));
+        m_animator.enqueue(createColorAnimation(vnode.color, colors::semantic::elementBase, 0.2f));
+    }
+
+    VisualRBTreeNode& target = m_visualNodes[id];
+    Animation highlight = createColorAnimation(target.color, colors::semantic::sorted, 0.3f);
+    highlight.onComplete = [this, status]() {
+        m_statusText = status;
+    };
+    m_animator.enqueue(highlight);
+    m_animator.enqueue(createColorAnimation(target.color, colors::semantic::elementBase, 0.3f));
+    m_jumpTarget = id;
+}
+
 void RBTreeVisualizer::play() {
     m_isPaused = false;
     m_animator.setPaused(false);
@@ -822,9 +1013,17 @@ void RBTreeVisualizer::step() {
 }
 
 void RBTreeVisualizer::reset() {
+    m_workload.stop();
+    if (m_bulkJob) {
+        m_bulkJob->cancel();
+        m_bulkJob.reset();
+    }
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
     m_rbTree.clear();
     m_visualNodes.clear();
-    m_nodePositions.clear();
+    m_layout.clear();
+    m_density.reset(START_X, HORIZONTAL_SPACING);
     m_animator.clear();
 
     // Add initial balanced tree
@@ -856,112 +1055,148 @@ std::string RBTreeVisualizer::getStatusText() const {
 }
 
 bool RBTreeVisualizer::isAnimating() const {
-    return m_animator.hasAnimations();
+    return m_animator.hasAnimations() || m_pendingInsertPos < m_pendingInserts.size();
 }
 
 bool RBTreeVisualizer::isPaused() const {
     return m_isPaused;
 }
 
-void RBTreeVisualizer::syncVisuals() {
-    m_visualNodes.clear();
-    m_nodePositions.clear();
-
-    // Calculate positions using recursive layout algorithm
-    // Increased initial offset from 200 to 280 for better spacing
-    calculatePositions(m_rbTree.root(), START_X, START_Y, 280.0f);
-
-    // Create visual nodes from positions
-    for (const auto& [value, pos] : m_nodePositions) {
-        auto node = m_rbTree.find(value);
-        if (!node) continue;
+void RBTreeVisualizer::syncVisuals(std::vector<Animation>* transitions) {
+    m_sceneVersion++;
+    std::vector<NodeIndex> changed = m_rbTree.takeChangedNodes();
 
-        VisualRBTreeNode vnode;
-        vnode.position = pos;
-        vnode.size = glm::vec2(NODE_RADIUS * 2, NODE_RADIUS * 2);
-        vnode.color = colors::semantic::elementBase;
-        vnode.borderColor = getBorderColor(node->color);
-        vnode.label = std::to_string(value);
-        vnode.value = value;
-        vnode.rbColor = node->color;
-        vnode.isNIL = false;
-
-        m_visualNodes.push_back(vnode);
+    // Grow storage up front: transitions hold references into m_visualNodes
+    if (!changed.empty() && changed.back() >= m_visualNodes.size()) {
+        m_visualNodes.resize(changed.back() + 1);
     }
 
-    // Add NIL nodes if enabled
-    if (m_showNIL && m_rbTree.root()) {
-        std::function<void(std::shared_ptr<RBTreeNode<int>>)> addNILs;
-        addNILs = [&](std::shared_ptr<RBTreeNode<int>> node) {
-            if (!node) return;
+    // Apply journaled changes to the visuals and the layout mirror
+    std::vector<NodeIndex> created;
+    for (NodeIndex id : changed) {
+        VisualRBTreeNode& vnode = m_visualNodes[id];
+        if (!m_rbTree.isLive(id)) {
+            m_layout.removeNode(id);
+            m_density.remove(id);
+            vnode.active = false;
+            continue;
+        }
 
-            // Add NIL children if they don't exist
-            if (!node->left) {
-                addNILNode(node, true);
-            }
-            if (!node->right) {
-                addNILNode(node, false);
+        auto node = m_rbTree.node(id);
+        m_layout.setLinks(id, node->left, node->right);
+
+        if (!vnode.active) {
+            vnode.size = glm::vec2(NODE_RADIUS * 2, NODE_RADIUS * 2);
+            vnode.color = colors::semantic::elementBase;
+            vnode.borderColor = getBorderColor(node->color);
+            vnode.rbColor = node->color;
+            vnode.active = true;
+            created.push_back(id);
+        } else if (vnode.rbColor != node->color) {
+            if (transitions) {
+                transitions->push_back(createColorAnimation(
+                    vnode.borderColor,
+                    getBorderColor(node->color),
+                    0.4f
+                ));
+            } else {
+                vnode.borderColor = getBorderColor(node->color);
             }
+            vnode.rbColor = node->color;
+        }
 
-            addNILs(node->left);
-            addNILs(node->right);
-        };
+        if (vnode.label == NO_LABEL || vnode.value != node->data) {
+            vnode.value = node->data;
+            vnode.label = labels::fromInt(node->data);
+        }
+    }
 
-        addNILs(m_rbTree.root());
+    m_layout.setRoot(m_rbTree.root().index());
+    m_layout.update();
+
+    // New nodes appear in place; existing ones glide to their new slot
+    for (NodeIndex id : m_layout.movedNodes()) {
+        VisualRBTreeNode& vnode = m_visualNodes[id];
+        glm::vec2 target = m_layout.position(id);
+        placeDensity(id);
+        bool animate = transitions != nullptr &&
+                       glm::distance(vnode.position, target) > 1.0f &&
+                       std::find(created.begin(), created.end(), id) == created.end();
+
+        if (animate) {
+            Animation moveAnim = createMoveAnimation(vnode.position, target, 0.5f);
+            moveAnim.easing = Easing::EaseOutBack;  // Smooth overshoot
+            transitions->push_back(moveAnim);
+        } else {
+            vnode.position = target;
+        }
     }
 }
 
-void RBTreeVisualizer::calculatePositions(std::shared_ptr<RBTreeNode<int>> node, float x, float y, float xOffset) {
-    if (!node) return;
-
-    // Store position for this node
-    m_nodePositions[node->data] = glm::vec2(x, y);
-
-    // Calculate positions for children
-    float nextY = y + VERTICAL_SPACING;
-    float nextOffset = xOffset * 0.75f;  // Reduce offset for deeper levels (slower decay)
-
-    // Ensure minimum spacing to prevent overlap (nodes are 50px diameter)
-    const float MIN_OFFSET = 70.0f;
-    if (nextOffset < MIN_OFFSET) {
-        nextOffset = MIN_OFFSET;
-    }
+void RBTreeVisualizer::placeDensity(NodeIndex id) {
+    glm::vec2 position = m_layout.position(id);
+    auto depth = static_cast<int>(std::lround((position.y - START_Y) / VERTICAL_SPACING));
+    m_density.place(id, position.x, depth);
+}
 
-    if (node->left) {
-        calculatePositions(node->left, x - xOffset, nextY, nextOffset);
+void RBTreeVisualizer::renderMinimap() {
+    // Click or drag to center the canvas on that part of the tree
+    if (!ImGui::CollapsingHeader("Minimap")) {
+        return;
     }
 
-    if (node->right) {
-        calculatePositions(node->right, x + xOffset, nextY, nextOffset);
+    // Canvas corners in world x and depth (node centers sit on whole depths)
+    auto depthAt = [](float worldY) { return (worldY - START_Y) / VERTICAL_SPACING; };
+    glm::vec2 viewMin(-m_cameraOffsetX / m_zoomLevel, depthAt(-m_cameraOffsetY / m_zoomLevel));
+    glm::vec2 viewMax((m_canvasSize.x - m_cameraOffsetX) / m_zoomLevel,
+                      depthAt((m_canvasSize.y - m_cameraOffsetY) / m_zoomLevel));
+    glm::vec2 target;
+    if (m_minimap.renderTree(m_density, viewMin, viewMax, target)) {
+        m_cameraOffsetX = m_canvasSize.x * 0.5f - target.x * m_zoomLevel;
+        m_cameraOffsetY = m_canvasSize.y * 0.5f - (START_Y + target.y * VERTICAL_SPACING) * m_zoomLevel;
     }
+    ImGui::Separator();
 }
 
-void RBTreeVisualizer::addNILNode(std::shared_ptr<RBTreeNode<int>> parent, bool isLeft) {
-    auto parentIt = m_nodePositions.find(parent->data);
-    if (parentIt == m_nodePositions.end()) return;
-
-    // Calculate NIL position
-    float parentX = parentIt->second.x;
-    float parentY = parentIt->second.y;
-    float xOffset = 100.0f * 0.6f * 0.6f;  // Smaller offset for NIL nodes
-    float nilX = isLeft ? (parentX - xOffset) : (parentX + xOffset);
-    float nilY = parentY + VERTICAL_SPACING;
+VisualRBTreeNode* RBTreeVisualizer::findVisual(int value) {
+    auto node = m_rbTree.find(value);
+    return node ? &m_visualNodes[node.index()] : nullptr;
+}
 
-    VisualRBTreeNode nilNode;
-    nilNode.position = glm::vec2(nilX, nilY);
-    nilNode.size = glm::vec2(NIL_NODE_RADIUS * 2, NIL_NODE_RADIUS * 2);
-    nilNode.color = colors::mocha::surface0;  // Dark background
-    nilNode.borderColor = getBorderColor(RBColor::BLACK);  // BLACK border
-    nilNode.label = "NIL";
-    nilNode.value = -1;  // Sentinel value
-    nilNode.rbColor = RBColor::BLACK;
-    nilNode.isNIL = true;
+void RBTreeVisualizer::drawNILNode(ImDrawList* drawList, const CanvasViewport& viewport,
+                                   const ImVec2& parentCenter, bool isLeft) {
+    // Tucked under the parent, inside the gap the layout keeps between nodes
+    float xOffset = HORIZONTAL_SPACING * 0.25f * m_zoomLevel;
+    ImVec2 center = ImVec2(
+        parentCenter.x + (isLeft ? -xOffset : xOffset),
+        parentCenter.y + VERTICAL_SPACING * m_zoomLevel
+    );
+    float radius = NIL_NODE_RADIUS * m_zoomLevel;
+    if (!viewport.isCircleVisible(center, radius)) return;
+
+    drawList->AddCircleFilled(
+        center,
+        radius,
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::surface0)),  // Dark background
+        viewport.circleSegments()
+    );
+    drawList->AddCircle(
+        center,
+        radius,
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(getBorderColor(RBColor::BLACK))),  // BLACK border
+        viewport.circleSegments(),
+        1.5f
+    );
 
-    m_visualNodes.push_back(nilNode);
+    if (!viewport.isFullDetail()) return;
 
-    // Store NIL position with unique negative key
-    static int nilCounter = -1000;
-    m_nodePositions[nilCounter--] = nilNode.position;
+    static const LabelId nilLabel = labels::intern("NIL");
+    labels::drawCentered(
+        drawList,
+        center,
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::subtext0)),
+        nilLabel
+    );
 }
 
 void RBTreeVisualizer::drawConnection(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color) {
@@ -974,9 +1209,8 @@ glm::vec4 RBTreeVisualizer::getBorderColor(RBColor color) const {
 
 std::vector<int> RBTreeVisualizer::collectInorderTraversal() {
     std::vector<int> result;
-    m_rbTree.inorderTraversal([&result](const int& val) {
-        result.push_back(val);
-    });
+    result.reserve(m_rbTree.size());
+    for (int val : m_rbTree.inorder()) result.push_back(val);
     return result;
 }
 
@@ -984,4 +1218,281 @@ void RBTreeVisualizer::updateCaseExplanation(const FixupCaseInfo& info) {
     m_currentCase = info;
 }
 
+void RBTreeVisualizer::loadRandomKeys(size_t count) {
+    m_workload.stop();
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_animator.clear();
+    if (m_bulkJob) m_bulkJob->cancel();
+
+    bool keepExisting = m_bulkKeepExisting;
+    m_bulkJob = jobs::submit([this, count, keepExisting](const JobToken& token) {
+        // Draw distinct keys from a range wide enough to make collisions rare
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        int maxKey = static_cast<int>(std::min<size_t>(count * 8, 0x3FFFFFFF)) + 99;
+        std::uniform_int_distribution<> dis(1, maxKey);
+        auto load = std::make_shared<BulkLoad>();
+        std::vector<int>& keys = load->keys;
+        keys.reserve(count);
+
+        while (keys.size() < count && !token.isCancelled()) {
+            while (keys.size() < count) {
+                keys.push_back(dis(gen));
+            }
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        }
+
+        if (keepExisting) {
+            // The live tree belongs to the render thread: insert there
+            std::shuffle(keys.begin(), keys.end(), gen);
+        } else {
+            // Build and lay out a replacement tree here, with the same journal/layout setup
+            load->tree.enableChangeTracking();
+            load->tree.enableEventRecording();
+            load->tree.buildFromSorted(keys.begin(), keys.end());
+            load->keys = {};
+            layOutReplacement(*load);
+        }
+
+        return JobCompletion([this, load, count]() {
+            finishBulkLoad(*load, std::to_string(count) + " random keys");
+        });
+    });
+
+    m_statusText = "Loading " + std::to_string(count) + " random keys...";
+}
+
+void RBTreeVisualizer::importDataset(const std::string& path, algorithms::DatasetFormat format) {
+    m_workload.stop();
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_animator.clear();
+    if (m_bulkJob) m_bulkJob->cancel();
+
+    m_bulkJob = jobs::submit([this, path, format](const JobToken& token) {
+        auto load = std::make_shared<BulkLoad>();
+        algorithms::DatasetReader reader;
+        bool ok = reader.open(path, format) && reader.prepare(&token.cancelledFlag());
+        size_t loaded = 0;
+
+        if (ok) {
+            const algorithms::DatasetInfo& info = reader.info();
+            bool sorted = info.hasSortedness && info.sortedness.isAscending();
+            load->tree.enableChangeTracking();
+            load->tree.enableEventRecording();
+            if (sorted && reader.isMapped() && info.count <= MAX_IMPORT_KEYS) {
+                // Known sorted: decode from the mapping as the tree is built
+                load->tree.buildFromSorted(reader.begin(), reader.end());
+                loaded = static_cast<size_t>(info.count);
+            } else {
+                // A sample of a sorted file stays sorted
+                ok = reader.readInto(load->keys, MAX_IMPORT_KEYS, &token.cancelledFlag());
+                if (ok && sorted) {
+                    load->tree.buildFromSorted(load->keys.begin(), load->keys.end());
+                } else if (ok) {
+                    load->tree.bulkLoad(load->keys.begin(), load->keys.end());
+                }
+                loaded = load->keys.size();
+                load->keys = {};
+            }
+        }
+        std::string failure = ok ? "" : reader.error();
+        if (ok && loaded == 0) {
+            ok = false;
+            failure = "the file has no keys";
+        }
+        if (ok) {
+            layOutReplacement(*load);
+        }
+
+        std::string source = ok ? DatasetImportPanel::describe(reader.info(), loaded) : failure;
+        return JobCompletion([this, load, ok, source]() {
+            if (ok) {
+                finishBulkLoad(*load, source);
+            } else {
+                m_bulkJob.reset();
+                m_statusText = "Import failed: " + source;
+            }
+        });
+    });
+
+    m_statusText = "Importing " + path + "...";
+}
+
+bool RBTreeVisualizer::saveSnapshot(const std::string& path) {
+    std::vector<int> keys;
+    std::vector<std::uint8_t> redBits;
+    m_rbTree.exportPreorder(keys, redBits);
+    std::string error;
+    if (!algorithms::writeSnapshot(path, algorithms::SnapshotKind::RedBlackTree, keys.data(), keys.size(),
+                                   redBits.data(), error)) {
+        m_statusText = "Save failed: " + error;
+        return false;
+    }
+    m_statusText = "Saved " + std::to_string(keys.size()) + " nodes to " + path;
+    return true;
+}
+
+bool RBTreeVisualizer::loadSnapshot(const std::string& path) {
+    algorithms::SnapshotReader reader;
+    if (!reader.open(path) || !reader.expect(algorithms::SnapshotKind::RedBlackTree)) {
+        m_statusText = "Load failed: " + reader.error();
+        return false;
+    }
+
+    // Relinked into a replacement tree, so the live one survives a rejected file
+    BulkLoad load;
+    std::vector<int> keys;
+    reader.readElements(keys);
+    load.tree.enableChangeTracking();
+    load.tree.enableEventRecording();
+    if (!load.tree.restorePreorder(keys.data(), reader.colorBits(), keys.size())) {
+        m_statusText = "Load failed: " + path + " is not a valid red-black tree";
+        return false;
+    }
+
+    m_workload.stop();
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+    m_animator.clear();
+    if (m_bulkJob) m_bulkJob->cancel();
+    layOutReplacement(load);
+    finishBulkLoad(load, path);
+    m_currentCase.explanation = "Tree restored from a snapshot without rebalancing";
+    m_isPaused = true;
+    return true;
+}
+
+void RBTreeVisualizer::layOutReplacement(BulkLoad& load) {
+    load.layout = TreeLayout(HORIZONTAL_SPACING, VERTICAL_SPACING);
+    load.layout.setOrigin(glm::vec2(START_X, START_Y));
+    for (NodeIndex id : load.tree.takeChangedNodes()) {
+        auto node = load.tree.node(id);
+        load.layout.setLinks(id, node->left, node->right);
+    }
+    load.layout.setRoot(load.tree.root().index());
+    load.layout.update();
+}
+
+void RBTreeVisualizer::finishBulkLoad(BulkLoad& load, const std::string& source) {
+    m_bulkJob.reset();
+
+    if (!load.keys.empty()) {
+        m_rbTree.insertRange(load.keys.begin(), load.keys.end());
+
+        // One sync for the whole batch
+        syncVisuals();
+    } else {
+        adoptReplacement(load);
+
+        m_cameraOffsetX = 0.0f;
+        m_cameraOffsetY = 0.0f;
+        m_zoomLevel = 1.0f;
+    }
+
+    std::ostringstream oss;
+    oss << "Loaded " << source << ": " << m_rbTree.size() << " nodes, Height: " << m_rbTree.height() << ", Black Height: " << m_rbTree.blackHeight();
+    m_statusText = oss.str();
+
+    m_currentCase.caseName = "Ready";
+    m_currentCase.explanation = "Tree bulk-loaded without per-insert fixups";
+    m_currentCase.nodeRoles = "";
+}
+
+void RBTreeVisualizer::adoptReplacement(BulkLoad& load) {
+    // Every node is new and already placed
+    m_rbTree = std::move(load.tree);
+    m_layout = std::move(load.layout);
+    m_sceneVersion++;
+    m_visualNodes.clear();
+    m_density.reset(START_X, HORIZONTAL_SPACING);
+    for (NodeIndex id : m_layout.movedNodes()) {
+        placeDensity(id);
+        if (id >= m_visualNodes.size()) {
+            m_visualNodes.resize(id + 1);
+        }
+        auto node = m_rbTree.node(id);
+        VisualRBTreeNode& vnode = m_visualNodes[id];
+        vnode.position = m_layout.position(id);
+        vnode.size = glm::vec2(NODE_RADIUS * 2, NODE_RADIUS * 2);
+        vnode.color = colors::semantic::elementBase;
+        vnode.borderColor = getBorderColor(node->color);
+        vnode.rbColor = node->color;
+        vnode.value = node->data;
+        vnode.label = labels::fromInt(node->data);
+        vnode.active = true;
+    }
+}
+
+bool RBTreeVisualizer::stepBack() {
+    size_t position = m_workload.replay().position();
+    return position > 0 && seek(position - 1);
+}
+
+bool RBTreeVisualizer::seek(size_t step) {
+    if (!m_workload.seek(step)) {
+        return false;
+    }
+    syncWorkload();
+    m_statusText = m_workload.statusText();
+    return true;
+}
+
+void RBTreeVisualizer::animateWorkloadOp(const algorithms::WorkloadOp& op) {
+    switch (op.code) {
+        case algorithms::WorkloadOpCode::Insert: insertValue(op.operand); break;
+        case algorithms::WorkloadOpCode::Remove: deleteValue(op.operand); break;
+        case algorithms::WorkloadOpCode::Search: searchValue(op.operand); break;
+    }
+}
+
+void RBTreeVisualizer::syncWorkload() {
+    bool interrupted = m_animator.hasAnimations();
+    m_animator.clear();
+    syncVisuals();
+    if (!interrupted) {
+        return;
+    }
+
+    // Dropped animations leave fills, borders and positions part way
+    for (NodeIndex id = 0; id < m_visualNodes.size(); ++id) {
+        VisualRBTreeNode& vnode = m_visualNodes[id];
+        if (!vnode.active) continue;
+        vnode.position = m_layout.position(id);
+        vnode.color = colors::semantic::elementBase;
+        vnode.borderColor = getBorderColor(vnode.rbColor);
+    }
+    m_currentCase.caseName = "Ready";
+    m_currentCase.explanation = "Replay moved without animating";
+    m_currentCase.nodeRoles = "";
+}
+
+void RBTreeVisualizer::drainPendingInserts() {
+    if (m_pendingInsertPos >= m_pendingInserts.size()) {
+        return;
+    }
+
+    runStepsWithinBudget([this]() {
+        m_rbTree.insert(m_pendingInserts[m_pendingInsertPos++]);
+        return m_pendingInsertPos < m_pendingInserts.size();
+    }, m_turboBudgetMs);
+
+    syncVisuals();
+
+    std::ostringstream oss;
+    if (m_pendingInsertPos < m_pendingInserts.size()) {
+        oss << "Inserting... " << m_pendingInsertPos << " / " << m_pendingInserts.size();
+        m_statusText = oss.str();
+        return;
+    }
+
+    oss << "Initialized RB tree with " << m_pendingInserts.size() << " nodes, Height: " << m_rbTree.height()
+        << ", Black Height: " << m_rbTree.blackHeight();
+    m_statusText = oss.str();
+    m_pendingInserts.clear();
+    m_pendingInsertPos = 0;
+}
+
 } // namespace dsav
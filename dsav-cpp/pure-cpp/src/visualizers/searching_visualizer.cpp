@@ -7,6 +7,8 @@
 #include "color_scheme.hpp"
 #include "animation.hpp"
 #include <algorithm>
+#include <cstdlib>
+#include <iomanip>
 #include <random>
 #include <sstream>
 
@@ -19,10 +21,21 @@ SearchingVisualizer::SearchingVisualizer() {
     m_statusText = "Ready to search. Set target value and click 'Start Search'.";
 }
 
+SearchingVisualizer::~SearchingVisualizer() {
+    // The pending completion captures this; cancelling drops it
+    if (m_importJob) m_importJob->cancel();
+}
+
 void SearchingVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
 
+    // Turbo: run a time-budgeted batch of steps every frame
+    if (!m_isPaused && m_isSearching && m_turboMode) {
+        executeTurboBatch();
+        return;
+    }
+
     // Auto-step when playing
     if (!m_isPaused && m_isSearching) {
         m_timeSinceLastStep += deltaTime * m_speed;
@@ -85,34 +98,36 @@ void SearchingVisualizer::renderVisualization() {
         );
 
         // Draw value label centered
-        ImVec2 labelPos = ImVec2(
-            topLeft.x + (ELEMENT_WIDTH - ImGui::CalcTextSize(elem.label.c_str()).x) / 2.0f,
-            topLeft.y + (ELEMENT_HEIGHT - ImGui::CalcTextSize(elem.label.c_str()).y) / 2.0f
-        );
-        drawList->AddText(
-            labelPos,
+        labels::drawCentered(
+            drawList,
+            ImVec2(topLeft.x + ELEMENT_WIDTH / 2.0f, topLeft.y + ELEMENT_HEIGHT / 2.0f),
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textPrimary)),
-            elem.label.c_str()
+            elem.label
         );
 
         // Draw index label below
-        std::string indexLabel = "[" + std::to_string(i) + "]";
+        LabelId indexLabel = labels::fromIndex(i);
         ImVec2 indexPos = ImVec2(
-            topLeft.x + (ELEMENT_WIDTH - ImGui::CalcTextSize(indexLabel.c_str()).x) / 2.0f,
+            topLeft.x + (ELEMENT_WIDTH - labels::textSize(indexLabel).x) / 2.0f,
             bottomRight.y + 5.0f
         );
-        drawList->AddText(
+        labels::draw(
+            drawList,
             indexPos,
             ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary)),
-            indexLabel.c_str()
+            indexLabel
         );
     }
 
     // Draw algorithm info and target
     std::string algoName;
     switch (m_currentAlgorithm) {
-        case Algorithm::LinearSearch: algoName = "Linear Search"; break;
-        case Algorithm::BinarySearch: algoName = "Binary Search"; break;
+        case Algorithm::LinearSearch:           algoName = "Linear Search"; break;
+        case Algorithm::BinarySearch:           algoName = "Binary Search"; break;
+        case Algorithm::BranchlessBinarySearch: algoName = "Branchless Binary Search"; break;
+        case Algorithm::EytzingerSearch:        algoName = "Eytzinger Search (BFS layout)"; break;
+        case Algorithm::InterpolationSearch:    algoName = "Interpolation Search"; break;
+        case Algorithm::ExponentialSearch:      algoName = "Exponential Search"; break;
     }
 
     std::string targetInfo = algoName + " | Target: " + std::to_string(m_target);
@@ -123,10 +138,12 @@ void SearchingVisualizer::renderVisualization() {
         targetInfo.c_str()
     );
 
-    // Draw bounds for binary search
-    if (m_currentAlgorithm == Algorithm::BinarySearch && m_binarySearcher) {
-        int left = m_binarySearcher->getLeftBound();
-        int right = m_binarySearcher->getRightBound();
+    // Draw bounds for the range-narrowing searches
+    bool hasBounds = m_currentAlgorithm != Algorithm::LinearSearch &&
+                     m_currentAlgorithm != Algorithm::EytzingerSearch;
+    if (hasBounds && (m_isSearching || m_timeline.isActive())) {
+        int left = cursor().second;
+        int right = cursor().third;
 
         if (left >= 0 && right >= 0 && left < static_cast<int>(m_elements.size()) &&
             right < static_cast<int>(m_elements.size())) {
@@ -141,18 +158,80 @@ void SearchingVisualizer::renderVisualization() {
         }
     }
 
+    renderAccessPattern(drawList, canvasPos, canvasSize);
+
     // Reserve space for the canvas
     ImGui::Dummy(canvasSize);
 }
 
+void SearchingVisualizer::renderAccessPattern(ImDrawList* drawList, ImVec2 canvasPos, ImVec2 canvasSize) const {
+    float top = canvasPos.y + START_Y + ELEMENT_HEIGHT + 40.0f;
+    int n = static_cast<int>(m_array.size());
+
+    // Reads up to the shown step; live runs show everything read so far
+    size_t shownStep = m_timeline.isActive() ? m_timeline.position() : m_liveSteps;
+    size_t visible = 0;
+    while (visible < m_probes.size() && m_probes[visible].step <= shownStep) {
+        visible++;
+    }
+
+    // Stats: distinct cache lines (array assumed line-aligned) and mean jump between reads
+    std::vector<size_t> lines;
+    double totalStride = 0.0;
+    for (size_t k = 0; k < visible; ++k) {
+        lines.push_back(static_cast<size_t>(m_probes[k].index) * sizeof(int) / CACHE_LINE_BYTES);
+        if (k > 0) totalStride += std::abs(m_probes[k].index - m_probes[k - 1].index);
+    }
+    std::sort(lines.begin(), lines.end());
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+
+    std::ostringstream header;
+    header << "Memory access (one row per read) | Reads: " << visible
+           << " | Cache lines: " << lines.size();
+    if (visible > 1) {
+        header << " | Mean stride: " << std::fixed << std::setprecision(1)
+               << totalStride / static_cast<double>(visible - 1);
+    }
+    drawList->AddText(
+        ImVec2(canvasPos.x + START_X, top),
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary)),
+        header.str().c_str()
+    );
+
+    // Newest reads win when they do not all fit
+    float rowsTop = top + 20.0f;
+    size_t rows = static_cast<size_t>(std::max(0.0f, (canvasPos.y + canvasSize.y - rowsTop) / ACCESS_ROW_HEIGHT));
+    size_t first = (visible > rows) ? visible - rows : 0;
+
+    ImU32 lineColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::border));
+    ImU32 dotColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::highlight));
+    ImU32 lastColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::comparing));
+    ImVec2 previous;
+    for (size_t k = first; k < visible; ++k) {
+        int index = m_probes[k].index;
+        if (index < 0 || index >= n) continue;
+
+        ImVec2 point(canvasPos.x + calculatePosition(static_cast<size_t>(index)).x + ELEMENT_WIDTH / 2.0f,
+                     rowsTop + (k - first) * ACCESS_ROW_HEIGHT + ACCESS_ROW_HEIGHT / 2.0f);
+        if (k > first) {
+            drawList->AddLine(previous, point, lineColor, 1.5f);
+        }
+        drawList->AddCircleFilled(point, 4.0f, (k + 1 == visible) ? lastColor : dotColor);
+        previous = point;
+    }
+}
+
 void SearchingVisualizer::renderControls() {
     ImGui::Begin("Search Controls");
 
     // Algorithm selection
     ImGui::Text("Algorithm:");
-    static const char* algorithmNames[] = { "Linear Search", "Binary Search" };
+    static const char* algorithmNames[] = {
+        "Linear Search", "Binary Search", "Branchless Binary Search",
+        "Eytzinger Search", "Interpolation Search", "Exponential Search"
+    };
     int currentAlgo = static_cast<int>(m_currentAlgorithm);
-    if (ImGui::Combo("##Algorithm", &currentAlgo, algorithmNames, 2)) {
+    if (ImGui::Combo("##Algorithm", &currentAlgo, algorithmNames, IM_ARRAYSIZE(algorithmNames))) {
         m_currentAlgorithm = static_cast<Algorithm>(currentAlgo);
         reset();
     }
@@ -171,18 +250,34 @@ void SearchingVisualizer::renderControls() {
         randomizeArray();
     }
 
-    if (ImGui::Button("Sort Array (for Binary Search)", ImVec2(-1, 0))) {
+    if (ImGui::Button("Sort Array", ImVec2(-1, 0))) {
         sortArray();
         syncVisuals();
         m_statusText = "Array sorted for binary search";
     }
 
+    // Dataset import
+    if (ImGui::CollapsingHeader("Import Dataset")) {
+        m_importPanel.render();
+        ImGui::BeginDisabled(!m_importPanel.hasPath() || m_isSearching);
+        if (ImGui::Button("Import Sample", ImVec2(-1, 0))) {
+            importDataset(m_importPanel.path(), m_importPanel.format());
+        }
+        ImGui::EndDisabled();
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Take %d evenly spaced keys of the file, in file order", MAX_ARRAY_SIZE);
+        }
+        if (m_importJob) {
+            ImGui::Text("Importing...");
+        }
+    }
+
     ImGui::Separator();
 
     // Target input
     ImGui::Text("Search Target:");
     ImGui::InputInt("Target Value", &m_target);
-    m_target = std::clamp(m_target, 1, MAX_VALUE);
+    m_target = std::clamp(m_target, m_targetMin, m_targetMax);
 
     ImGui::Separator();
 
@@ -206,6 +301,13 @@ void SearchingVisualizer::renderControls() {
     }
     ImGui::SameLine();
 
+    ImGui::BeginDisabled(!m_timeline.isActive() || m_timeline.position() == 0);
+    if (ImGui::Button("⏪ Back")) {
+        stepBack();
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+
     if (ImGui::Button("⏩ Step")) {
         step();
     }
@@ -216,6 +318,16 @@ void SearchingVisualizer::renderControls() {
     }
     ImGui::EndGroup();
 
+    // Step history
+    ImGui::Checkbox("Record history", &m_recordHistory);
+    if (m_timeline.isActive()) {
+        int position = static_cast<int>(m_timeline.position());
+        int last = static_cast<int>(m_timeline.stepCount());
+        if (ImGui::SliderInt("Timeline", &position, 0, last)) {
+            seek(static_cast<size_t>(position));
+        }
+    }
+
     ImGui::Separator();
 
     // Speed control
@@ -228,6 +340,12 @@ void SearchingVisualizer::renderControls() {
         // Delay updated
     }
 
+    ImGui::Checkbox("Turbo (steps per frame)", &m_turboMode);
+    if (m_turboMode) {
+        ImGui::SliderFloat("Frame Budget (ms)", &m_turboBudgetMs, 0.5f, 8.0f, "%.1f");
+        ImGui::Text("Steps last frame: %zu", m_lastBatchSteps);
+    }
+
     ImGui::Separator();
 
     // Status
@@ -272,8 +390,14 @@ void SearchingVisualizer::reset() {
     m_animator.clear();
 
     // Reset algorithm steppers
+    m_timeline.clear();
     m_linearSearcher.reset();
     m_binarySearcher.reset();
+    m_branchlessSearcher.reset();
+    m_eytzingerSearcher.reset();
+    m_interpolationSearcher.reset();
+    m_exponentialSearcher.reset();
+    m_liveCursor = algorithms::StepCursor{};
 
     // Regenerate random array
     randomizeArray();
@@ -299,9 +423,12 @@ bool SearchingVisualizer::isPaused() const {
 }
 
 void SearchingVisualizer::startSearch() {
-    // Binary search requires sorted array
-    if (m_currentAlgorithm == Algorithm::BinarySearch) {
+    // Everything but linear search needs sorted input; Eytzinger then reorders it
+    if (needsSortedArray()) {
         sortArray();
+        if (m_currentAlgorithm == Algorithm::EytzingerSearch) {
+            m_array = algorithms::eytzingerLayout(m_array);
+        }
         syncVisuals();
     }
 
@@ -319,6 +446,33 @@ void SearchingVisualizer::startSearch() {
             m_binarySearcher = std::make_unique<algorithms::BinarySearchStepper>(m_array, m_target);
             m_statusText = "Starting Binary Search for " + std::to_string(m_target) + "...";
             break;
+        case Algorithm::BranchlessBinarySearch:
+            m_branchlessSearcher = std::make_unique<algorithms::BranchlessBinarySearchStepper>(m_array, m_target);
+            m_statusText = "Starting Branchless Binary Search for " + std::to_string(m_target) + "...";
+            break;
+        case Algorithm::EytzingerSearch:
+            m_eytzingerSearcher = std::make_unique<algorithms::EytzingerSearchStepper>(m_array, m_target);
+            m_statusText = "Starting Eytzinger Search for " + std::to_string(m_target) +
+                           " (array shown in breadth-first order)...";
+            break;
+        case Algorithm::InterpolationSearch:
+            m_interpolationSearcher = std::make_unique<algorithms::InterpolationSearchStepper>(m_array, m_target);
+            m_statusText = "Starting Interpolation Search for " + std::to_string(m_target) + "...";
+            break;
+        case Algorithm::ExponentialSearch:
+            m_exponentialSearcher = std::make_unique<algorithms::ExponentialSearchStepper>(m_array, m_target);
+            m_statusText = "Starting Exponential Search for " + std::to_string(m_target) + "...";
+            break;
+    }
+    m_probes.clear();
+    m_liveSteps = 0;
+
+    // The searchers never write the array, so the history is cursors only
+    m_liveCursor = captureCursor();
+    if (m_recordHistory) {
+        m_timeline.begin(m_array, m_liveCursor);
+    } else {
+        m_timeline.clear();
     }
 
     syncVisuals();
@@ -339,7 +493,11 @@ void SearchingVisualizer::randomizeArray() {
     // Reset searching state
     m_isSearching = false;
     m_isPaused = true;
+    m_timeline.clear();
+    m_probes.clear();
+    m_liveSteps = 0;
 
+    updateTargetRange();
     syncVisuals();
 }
 
@@ -352,9 +510,47 @@ void SearchingVisualizer::setArray(const std::vector<int>& arr) {
     m_arraySize = static_cast<int>(arr.size());
     m_isSearching = false;
     m_isPaused = true;
+    m_timeline.clear();
+    m_probes.clear();
+    m_liveSteps = 0;
+    updateTargetRange();
     syncVisuals();
 }
 
+void SearchingVisualizer::importDataset(const std::string& path, algorithms::DatasetFormat format) {
+    if (m_importJob) m_importJob->cancel();
+
+    m_importJob = jobs::submit([this, path, format](const JobToken& token) {
+        auto keys = std::make_shared<std::vector<int>>();
+        algorithms::DatasetReader reader;
+        bool ok = reader.open(path, format) &&
+                  reader.readInto(*keys, static_cast<size_t>(MAX_ARRAY_SIZE), &token.cancelledFlag());
+        std::string message = ok ? "Imported " + DatasetImportPanel::describe(reader.info(), keys->size())
+                                 : "Import failed: " + reader.error();
+        return JobCompletion([this, keys, ok, message]() { finishImport(*keys, ok, message); });
+    });
+
+    m_statusText = "Importing " + path + "...";
+}
+
+void SearchingVisualizer::finishImport(std::vector<int>& keys, bool ok, const std::string& message) {
+    m_importJob.reset();
+    if (ok && !keys.empty()) {
+        setArray(keys);
+        m_target = std::clamp(m_array[m_array.size() / 2], m_targetMin, m_targetMax);
+    }
+    m_statusText = (ok && keys.empty()) ? "Import failed: the file has no keys" : message;
+}
+
+void SearchingVisualizer::updateTargetRange() {
+    m_targetMin = 1;
+    m_targetMax = MAX_VALUE;
+    for (int v : m_array) {
+        m_targetMin = std::min(m_targetMin, v);
+        m_targetMax = std::max(m_targetMax, v);
+    }
+}
+
 void SearchingVisualizer::syncVisuals() {
     m_elements.clear();
     m_elements.reserve(m_array.size());
@@ -365,7 +561,7 @@ void SearchingVisualizer::syncVisuals() {
         elem.size = glm::vec2(ELEMENT_WIDTH, ELEMENT_HEIGHT);
         elem.color = colors::semantic::elementBase;
         elem.borderColor = colors::semantic::active;
-        elem.label = std::to_string(m_array[i]);
+        elem.label = labels::fromInt(m_array[i]);
         elem.value = m_array[i];
         elem.isChecked = false;
         elem.isFound = false;
@@ -387,67 +583,294 @@ void SearchingVisualizer::executeStep() {
         return;
     }
 
-    bool continueSearch = false;
+    if (advanceSearcher()) {
+        describeStep();
+    }
+
+    // Update visuals and colors
+    syncVisuals();
+    updateColors();
+}
+
+void SearchingVisualizer::executeTurboBatch() {
+    if (!m_isSearching) {
+        return;
+    }
+
+    // As many steps as fit in the frame budget, then a single visual sync.
+    // Linear search scans whole blocks per step unless the timeline records each one.
+    if (m_linearSearcher) m_linearSearcher->setFastForward(!m_timeline.isActive());
+    m_lastBatchSteps = runStepsWithinBudget([this]() { return advanceSearcher(); }, m_turboBudgetMs);
+    if (m_linearSearcher) m_linearSearcher->setFastForward(false);
+    if (m_isSearching) {
+        describeStep();
+    }
+
+    syncVisuals();
+    updateColors();
+}
+
+bool SearchingVisualizer::advanceSearcher() {
+    if (!m_isSearching) {
+        return false;
+    }
+
+    // Behind the frontier: replay the recorded step, the searcher is already past it
+    if (m_timeline.isActive() && !m_timeline.atFrontier()) {
+        m_timeline.seek(m_timeline.position() + 1, m_array);
+        if (m_timeline.atFrontier() && searcherComplete()) {
+            describeResult();
+            m_isSearching = false;
+            m_isPaused = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool continueSearch = true;
+    size_t comparisonsBefore = searcherComparisons();
+    int linearIndex = m_linearSearcher ? m_linearSearcher->getCurrentIndex() : -1;
 
     switch (m_currentAlgorithm) {
         case Algorithm::LinearSearch:
             if (m_linearSearcher) {
                 continueSearch = m_linearSearcher->step();
+            }
+            break;
+
+        case Algorithm::BinarySearch:
+            if (m_binarySearcher) {
+                continueSearch = m_binarySearcher->step();
+            }
+            break;
 
-                if (!continueSearch) {
-                    auto state = m_linearSearcher->getState();
-                    int result = m_linearSearcher->getResult();
+        case Algorithm::BranchlessBinarySearch:
+            if (m_branchlessSearcher) {
+                continueSearch = m_branchlessSearcher->step();
+            }
+            break;
 
-                    if (state == algorithms::SearchState::Found) {
-                        m_statusText = "Found " + std::to_string(m_target) + " at index " + std::to_string(result) + "!";
-                    } else {
-                        m_statusText = "Value " + std::to_string(m_target) + " not found in array.";
-                    }
+        case Algorithm::EytzingerSearch:
+            if (m_eytzingerSearcher) {
+                continueSearch = m_eytzingerSearcher->step();
+            }
+            break;
 
-                    m_isSearching = false;
-                    m_isPaused = true;
-                } else {
-                    int idx = m_linearSearcher->getCurrentIndex();
-                    std::ostringstream oss;
-                    oss << "Checking index " << idx << ": value = " << m_array[idx];
-                    m_statusText = oss.str();
-                }
+        case Algorithm::InterpolationSearch:
+            if (m_interpolationSearcher) {
+                continueSearch = m_interpolationSearcher->step();
+            }
+            break;
+
+        case Algorithm::ExponentialSearch:
+            if (m_exponentialSearcher) {
+                continueSearch = m_exponentialSearcher->step();
+            }
+            break;
+    }
+
+    m_liveSteps++;
+    m_liveCursor = captureCursor();
+    m_timeline.commitStep(m_array, m_liveCursor);
+
+    // Steps that compared read an element: linear reads the index it started on
+    if (searcherComparisons() > comparisonsBefore) {
+        int index = (m_currentAlgorithm == Algorithm::LinearSearch) ? linearIndex : m_liveCursor.first;
+        m_probes.push_back({m_liveSteps, index});
+    }
+
+    if (!continueSearch) {
+        describeResult();
+        m_isSearching = false;
+        m_isPaused = true;
+    }
+    return continueSearch;
+}
+
+bool SearchingVisualizer::stepBack() {
+    if (!m_timeline.isActive() || m_timeline.position() == 0) {
+        return false;
+    }
+    return seek(m_timeline.position() - 1);
+}
+
+bool SearchingVisualizer::seek(size_t step) {
+    if (!m_timeline.isActive() || step > m_timeline.stepCount()) {
+        return false;
+    }
+
+    m_isPaused = true;
+    m_timeline.seek(step, m_array);
+
+    // Only the frontier of a finished search has nothing left to play
+    m_isSearching = !(m_timeline.atFrontier() && searcherComplete());
+    if (m_isSearching) {
+        std::ostringstream oss;
+        oss << "Step " << m_timeline.position() << " / " << m_timeline.stepCount();
+        m_statusText = oss.str();
+        if (m_timeline.position() > 0) {
+            describeStep();
+        }
+    } else {
+        describeResult();
+    }
+
+    syncVisuals();
+    return true;
+}
+
+algorithms::StepCursor SearchingVisualizer::captureCursor() const {
+    // Linear: first = current index; Eytzinger: first/second = node/depth;
+    // the others: first/second/third = probe/left/right
+    algorithms::StepCursor result;
+
+    switch (m_currentAlgorithm) {
+        case Algorithm::LinearSearch:
+            if (m_linearSearcher) {
+                result.state = static_cast<std::uint8_t>(m_linearSearcher->getState());
+                result.first = m_linearSearcher->getCurrentIndex();
             }
             break;
 
         case Algorithm::BinarySearch:
             if (m_binarySearcher) {
-                continueSearch = m_binarySearcher->step();
+                result.state = static_cast<std::uint8_t>(m_binarySearcher->getState());
+                result.first = m_binarySearcher->getMidIndex();
+                result.second = m_binarySearcher->getLeftBound();
+                result.third = m_binarySearcher->getRightBound();
+            }
+            break;
 
-                if (!continueSearch) {
-                    auto state = m_binarySearcher->getState();
-                    int result = m_binarySearcher->getResult();
+        case Algorithm::BranchlessBinarySearch:
+            if (m_branchlessSearcher) {
+                result.state = static_cast<std::uint8_t>(m_branchlessSearcher->getState());
+                result.first = m_branchlessSearcher->getProbeIndex();
+                result.second = m_branchlessSearcher->getBase();
+                result.third = m_branchlessSearcher->getBase() + m_branchlessSearcher->getLength() - 1;
+            }
+            break;
 
-                    if (state == algorithms::SearchState::Found) {
-                        m_statusText = "Found " + std::to_string(m_target) + " at index " + std::to_string(result) + "!";
-                    } else {
-                        m_statusText = "Value " + std::to_string(m_target) + " not found in array.";
-                    }
+        case Algorithm::EytzingerSearch:
+            if (m_eytzingerSearcher) {
+                result.state = static_cast<std::uint8_t>(m_eytzingerSearcher->getState());
+                result.first = m_eytzingerSearcher->getNodeIndex();
+                result.second = m_eytzingerSearcher->getDepth();
+            }
+            break;
 
-                    m_isSearching = false;
-                    m_isPaused = true;
+        case Algorithm::InterpolationSearch:
+            if (m_interpolationSearcher) {
+                result.state = static_cast<std::uint8_t>(m_interpolationSearcher->getState());
+                result.first = m_interpolationSearcher->getProbeIndex();
+                result.second = m_interpolationSearcher->getLeftBound();
+                result.third = m_interpolationSearcher->getRightBound();
+            }
+            break;
+
+        case Algorithm::ExponentialSearch:
+            if (m_exponentialSearcher) {
+                result.state = static_cast<std::uint8_t>(m_exponentialSearcher->getState());
+                result.first = m_exponentialSearcher->getProbeIndex();
+                result.second = m_exponentialSearcher->getLeftBound();
+                result.third = m_exponentialSearcher->getRightBound();
+            }
+            break;
+    }
+    return result;
+}
+
+const algorithms::StepCursor& SearchingVisualizer::cursor() const {
+    return m_timeline.isActive() ? m_timeline.cursor() : m_liveCursor;
+}
+
+bool SearchingVisualizer::searcherComplete() const {
+    switch (m_currentAlgorithm) {
+        case Algorithm::LinearSearch: return m_linearSearcher && m_linearSearcher->isComplete();
+        case Algorithm::BinarySearch: return m_binarySearcher && m_binarySearcher->isComplete();
+        case Algorithm::BranchlessBinarySearch:
+            return m_branchlessSearcher && m_branchlessSearcher->isComplete();
+        case Algorithm::EytzingerSearch:
+            return m_eytzingerSearcher && m_eytzingerSearcher->isComplete();
+        case Algorithm::InterpolationSearch:
+            return m_interpolationSearcher && m_interpolationSearcher->isComplete();
+        case Algorithm::ExponentialSearch:
+            return m_exponentialSearcher && m_exponentialSearcher->isComplete();
+    }
+    return false;
+}
+
+bool SearchingVisualizer::needsSortedArray() const {
+    return m_currentAlgorithm != Algorithm::LinearSearch;
+}
+
+size_t SearchingVisualizer::searcherComparisons() const {
+    switch (m_currentAlgorithm) {
+        case Algorithm::LinearSearch:
+            return m_linearSearcher ? m_linearSearcher->getComparisons() : 0;
+        case Algorithm::BinarySearch:
+            return m_binarySearcher ? m_binarySearcher->getComparisons() : 0;
+        case Algorithm::BranchlessBinarySearch:
+            return m_branchlessSearcher ? m_branchlessSearcher->getComparisons() : 0;
+        case Algorithm::EytzingerSearch:
+            return m_eytzingerSearcher ? m_eytzingerSearcher->getComparisons() : 0;
+        case Algorithm::InterpolationSearch:
+            return m_interpolationSearcher ? m_interpolationSearcher->getComparisons() : 0;
+        case Algorithm::ExponentialSearch:
+            return m_exponentialSearcher ? m_exponentialSearcher->getComparisons() : 0;
+    }
+    return 0;
+}
+
+void SearchingVisualizer::describeResult() {
+    const algorithms::StepCursor& c = cursor();
+    if (static_cast<algorithms::SearchState>(c.state) == algorithms::SearchState::Found) {
+        m_statusText = "Found " + std::to_string(m_target) + " at index " + std::to_string(c.first) + "!";
+    } else {
+        m_statusText = "Value " + std::to_string(m_target) + " not found in array.";
+    }
+}
+
+void SearchingVisualizer::describeStep() {
+    const algorithms::StepCursor& c = cursor();
+    int n = static_cast<int>(m_array.size());
+    std::ostringstream oss;
+
+    switch (m_currentAlgorithm) {
+        case Algorithm::LinearSearch:
+            if (c.first >= 0 && c.first < n) {
+                oss << "Checking index " << c.first << ": value = " << m_array[c.first];
+            }
+            break;
+
+        case Algorithm::BinarySearch:
+            if (c.first >= 0 && c.first < n) {
+                oss << "Checking middle (index " << c.first << "): value = " << m_array[c.first]
+                    << " | Bounds: [" << c.second << ", " << c.third << "]";
+            }
+            break;
+
+        case Algorithm::EytzingerSearch:
+            if (c.first >= 0 && c.first < n) {
+                oss << "Checking node " << c.first << " at depth " << c.second
+                    << ": value = " << m_array[c.first];
+            }
+            break;
+
+        case Algorithm::BranchlessBinarySearch:
+        case Algorithm::InterpolationSearch:
+        case Algorithm::ExponentialSearch:
+            if (c.first >= 0 && c.first < n) {
+                oss << "Probing index " << c.first << ": value = " << m_array[c.first];
+                if (c.second >= 0 && c.third >= 0) {
+                    oss << " | Bounds: [" << c.second << ", " << c.third << "]";
                 } else {
-                    int mid = m_binarySearcher->getMidIndex();
-                    int left = m_binarySearcher->getLeftBound();
-                    int right = m_binarySearcher->getRightBound();
-
-                    std::ostringstream oss;
-                    oss << "Checking middle (index " << mid << "): value = " << m_array[mid]
-                        << " | Bounds: [" << left << ", " << right << "]";
-                    m_statusText = oss.str();
+                    oss << " | Doubling the bound";
                 }
             }
             break;
     }
 
-    // Update visuals and colors
-    syncVisuals();
-    updateColors();
+    m_statusText = oss.str();
 }
 
 void SearchingVisualizer::updateColors() {
@@ -463,68 +886,80 @@ void SearchingVisualizer::updateColors() {
         return;
     }
 
-    // Update colors based on current algorithm state
+    // Update colors based on the shown step's cursor (see captureCursor)
+    const algorithms::StepCursor& c = cursor();
+    auto state = static_cast<algorithms::SearchState>(c.state);
+    int n = static_cast<int>(m_elements.size());
+
     switch (m_currentAlgorithm) {
-        case Algorithm::LinearSearch:
-            if (m_linearSearcher) {
-                int currentIdx = m_linearSearcher->getCurrentIndex();
-                auto state = m_linearSearcher->getState();
+        case Algorithm::LinearSearch: {
+            int currentIdx = c.first;
+
+            // Highlight all checked elements
+            for (int i = 0; i < currentIdx && i < n; ++i) {
+                m_elements[i].color = colors::semantic::textSecondary;
+                m_elements[i].isChecked = true;
+            }
 
-                // Highlight all checked elements
-                for (int i = 0; i < currentIdx && i < static_cast<int>(m_elements.size()); ++i) {
-                    m_elements[i].color = colors::semantic::textSecondary;
-                    m_elements[i].isChecked = true;
+            // Highlight current element being checked
+            if (currentIdx >= 0 && currentIdx < n) {
+                if (state == algorithms::SearchState::Checking) {
+                    m_elements[currentIdx].color = colors::semantic::comparing;
+                } else if (state == algorithms::SearchState::Found) {
+                    m_elements[currentIdx].color = colors::semantic::sorted;
+                    m_elements[currentIdx].isFound = true;
                 }
+            }
+            break;
+        }
 
-                // Highlight current element being checked
-                if (currentIdx >= 0 && currentIdx < static_cast<int>(m_elements.size())) {
-                    if (state == algorithms::SearchState::Checking) {
-                        m_elements[currentIdx].color = colors::semantic::comparing;
-                    } else if (state == algorithms::SearchState::Found) {
-                        m_elements[currentIdx].color = colors::semantic::sorted;
-                        m_elements[currentIdx].isFound = true;
-                    }
+        case Algorithm::EytzingerSearch: {
+            // Earlier nodes on the root-to-leaf path: scattered in sorted order, adjacent here
+            size_t shownStep = m_timeline.isActive() ? m_timeline.position() : m_liveSteps;
+            for (const Probe& probe : m_probes) {
+                if (probe.step > shownStep) break;
+                if (probe.index >= 0 && probe.index < n) {
+                    m_elements[probe.index].color = colors::semantic::textSecondary;
+                    m_elements[probe.index].isChecked = true;
                 }
+            }
 
-                // If found, highlight the found element
-                int result = m_linearSearcher->getResult();
-                if (result >= 0 && result < static_cast<int>(m_elements.size())) {
-                    m_elements[result].color = colors::semantic::sorted;
-                    m_elements[result].isFound = true;
+            int node = c.first;
+            if (node >= 0 && node < n) {
+                if (state == algorithms::SearchState::Checking) {
+                    m_elements[node].color = colors::semantic::comparing;
+                } else if (state == algorithms::SearchState::Found) {
+                    m_elements[node].color = colors::semantic::sorted;
+                    m_elements[node].isFound = true;
                 }
             }
             break;
+        }
 
         case Algorithm::BinarySearch:
-            if (m_binarySearcher) {
-                int left = m_binarySearcher->getLeftBound();
-                int right = m_binarySearcher->getRightBound();
-                int mid = m_binarySearcher->getMidIndex();
-                auto state = m_binarySearcher->getState();
-
-                // Highlight search range
-                for (int i = left; i <= right && i < static_cast<int>(m_elements.size()); ++i) {
-                    m_elements[i].color = colors::mocha::surface1;
-                }
-
-                // Highlight middle element being checked
-                if (mid >= 0 && mid < static_cast<int>(m_elements.size())) {
-                    if (state == algorithms::SearchState::Checking) {
-                        m_elements[mid].color = colors::semantic::comparing;
-                    } else if (state == algorithms::SearchState::Found) {
-                        m_elements[mid].color = colors::semantic::sorted;
-                        m_elements[mid].isFound = true;
-                    }
-                }
+        case Algorithm::BranchlessBinarySearch:
+        case Algorithm::InterpolationSearch:
+        case Algorithm::ExponentialSearch: {
+            int mid = c.first;
+            int left = c.second;
+            int right = c.third;
+
+            // Highlight search range
+            for (int i = std::max(left, 0); i <= right && i < n; ++i) {
+                m_elements[i].color = colors::mocha::surface1;
+            }
 
-                // If found, highlight the found element
-                int result = m_binarySearcher->getResult();
-                if (result >= 0 && result < static_cast<int>(m_elements.size())) {
-                    m_elements[result].color = colors::semantic::sorted;
-                    m_elements[result].isFound = true;
+            // Highlight middle element being checked
+            if (mid >= 0 && mid < n) {
+                if (state == algorithms::SearchState::Checking) {
+                    m_elements[mid].color = colors::semantic::comparing;
+                } else if (state == algorithms::SearchState::Found) {
+                    m_elements[mid].color = colors::semantic::sorted;
+                    m_elements[mid].isFound = true;
                 }
             }
             break;
+        }
     }
 }
 
@@ -0,0 +1,332 @@
+/**
+ * @file sort_race_view.cpp
+ * @brief Implementation of the sort race panels
+ */
+
+#include "visualizers/sort_race_view.hpp"
+#include "ui_components.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+namespace dsav {
+
+using algorithms::SortAlgorithm;
+using algorithms::SortRaceLaneStats;
+using algorithms::SortRaceState;
+
+namespace {
+
+glm::vec4 laneColor(size_t lane) {
+    return colors::semantic::lanes[lane % BAR_LANE_COUNT];
+}
+
+const char* stateName(SortRaceState state) {
+    switch (state) {
+        case SortRaceState::Running:  return "running";
+        case SortRaceState::Finished: return "finished";
+        case SortRaceState::Stopped:  return "stopped";
+    }
+    return "?";
+}
+
+} // namespace
+
+SortRaceView::SortRaceView() {
+    // One quadratic sort against the n log n ones, then the rest of the field
+    m_algorithms = {
+        static_cast<int>(SortAlgorithm::Insertion),
+        static_cast<int>(SortAlgorithm::Merge),
+        static_cast<int>(SortAlgorithm::Quick),
+        static_cast<int>(SortAlgorithm::Heap),
+        static_cast<int>(SortAlgorithm::Shell)
+    };
+}
+
+bool SortRaceView::start(const std::vector<int>& input) {
+    std::vector<SortAlgorithm> lanes;
+    for (int i = 0; i < m_laneCount; ++i) {
+        lanes.push_back(static_cast<SortAlgorithm>(m_algorithms[i]));
+    }
+
+    std::int64_t largest = 1;
+    for (int v : input) {
+        largest = std::max<std::int64_t>(largest, v < 0 ? -static_cast<std::int64_t>(v) : v);
+    }
+    m_unitHeight = static_cast<float>(largest);
+
+    for (LanePanel& panel : m_panels) {
+        panel.snapshot = algorithms::SortRaceSnapshot();
+        panel.states.clear();
+        panel.dirty = false;
+    }
+    m_sinceSnapshot = 0.0f;
+    return m_race.start(input, lanes, m_paced ? m_stepsPerSecond : 0.0);
+}
+
+void SortRaceView::update(float deltaTime) {
+    if (!hasRace()) {
+        return;
+    }
+    m_sinceSnapshot += deltaTime;
+    // A finished race publishes its final arrays once; take them right away
+    if (m_sinceSnapshot >= 1.0f / SNAPSHOT_HZ || !isRunning()) {
+        m_sinceSnapshot = 0.0f;
+        takeSnapshots();
+    }
+}
+
+void SortRaceView::takeSnapshots() {
+    for (size_t lane = 0; lane < m_race.laneCount(); ++lane) {
+        LanePanel& panel = m_panels[lane];
+        if (!m_race.takeSnapshot(lane, panel.snapshot)) {
+            continue;
+        }
+
+        const algorithms::SortedMarks& marks = panel.snapshot.marks;
+        size_t n = panel.snapshot.values.size();
+        SortRaceLaneStats stats = m_race.stats(lane);
+        if (marks.count() == 0 && stats.state == SortRaceState::Running) {
+            panel.states.assign(n, BarState::Base);
+        } else if (marks.count() >= n || stats.sorted) {
+            panel.states.assign(n, BarState::Sorted);
+        } else {
+            panel.states.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                panel.states[i] = marks.isSorted(i) ? BarState::Sorted : BarState::Base;
+            }
+        }
+        panel.dirty = true;
+    }
+}
+
+size_t SortRaceView::rank(size_t lane) const {
+    SortRaceLaneStats mine = m_race.stats(lane);
+    if (mine.state != SortRaceState::Finished) {
+        return 0;
+    }
+    size_t position = 1;
+    for (size_t other = 0; other < m_race.laneCount(); ++other) {
+        SortRaceLaneStats stats = m_race.stats(other);
+        if (other != lane && stats.state == SortRaceState::Finished &&
+            (stats.seconds < mine.seconds || (stats.seconds == mine.seconds && other < lane))) {
+            ++position;
+        }
+    }
+    return position;
+}
+
+void SortRaceView::render(ImDrawList* drawList, ImVec2 canvasPos, ImVec2 canvasSize) {
+    ImU32 counterColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary));
+    ImU32 hintColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1));
+
+    if (!hasRace()) {
+        drawList->AddText(ImVec2(canvasPos.x + PADDING, canvasPos.y + PADDING), hintColor,
+                          "Pick the lanes in the controls and click 'Start Race'");
+        return;
+    }
+
+    size_t lanes = m_race.laneCount();
+    float panelWidth = canvasSize.x - 2.0f * PADDING;
+    float available = canvasSize.y - 2.0f * PADDING - HINT_HEIGHT - PANEL_GAP * static_cast<float>(lanes - 1);
+    float panelHeight = std::max(HEADER_HEIGHT + 10.0f, available / static_cast<float>(lanes));
+
+    for (size_t lane = 0; lane < lanes; ++lane) {
+        LanePanel& panel = m_panels[lane];
+        SortRaceLaneStats stats = m_race.stats(lane);
+        ImVec2 min(canvasPos.x + PADDING, canvasPos.y + PADDING + static_cast<float>(lane) * (panelHeight + PANEL_GAP));
+        ImVec2 max(min.x + panelWidth, min.y + panelHeight);
+
+        drawList->AddRectFilled(min, max, ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::panel)), 4.0f);
+        drawList->AddRectFilled(min, ImVec2(min.x + 4.0f, max.y),
+                                ImGui::ColorConvertFloat4ToU32(colors::toImGui(laneColor(lane))), 4.0f);
+
+        // Title: algorithm and outcome
+        char title[128];
+        size_t place = rank(lane);
+        if (stats.state == SortRaceState::Finished && !stats.sorted) {
+            std::snprintf(title, sizeof(title), "%s - NOT SORTED", algorithms::sortAlgorithmName(m_race.algorithm(lane)));
+        } else if (place > 0) {
+            std::snprintf(title, sizeof(title), "%s - #%zu", algorithms::sortAlgorithmName(m_race.algorithm(lane)), place);
+        } else {
+            std::snprintf(title, sizeof(title), "%s - %s", algorithms::sortAlgorithmName(m_race.algorithm(lane)),
+                          stateName(stats.state));
+        }
+        glm::vec4 outcome = laneColor(lane);
+        if (stats.state == SortRaceState::Finished) {
+            outcome = stats.sorted ? colors::semantic::success : colors::semantic::error;
+        }
+        drawList->AddText(ImVec2(min.x + 12.0f, min.y + 4.0f),
+                          ImGui::ColorConvertFloat4ToU32(colors::toImGui(outcome)), title);
+
+        // Live counters
+        char counters[160];
+        std::snprintf(counters, sizeof(counters), "Steps %zu   Compares %zu   Swaps %zu   %.3f ms",
+                      stats.steps, stats.comparisons, stats.swaps, stats.seconds * 1000.0);
+        drawList->AddText(ImVec2(min.x + 12.0f, min.y + 22.0f), counterColor, counters);
+
+        // Bars of the latest snapshot, clipped to the panel
+        ImVec2 barsMin(min.x + 12.0f, min.y + HEADER_HEIGHT);
+        ImVec2 barsMax(max.x - 8.0f, max.y - 4.0f);
+        size_t n = panel.snapshot.values.size();
+        if (n == 0 || barsMax.x <= barsMin.x || barsMax.y <= barsMin.y) {
+            continue;
+        }
+
+        BarLayout layout;
+        layout.origin = glm::vec2(barsMin.x, barsMax.y);
+        layout.pitch = (barsMax.x - barsMin.x) / static_cast<float>(n);
+        layout.width = layout.pitch >= 4.0f ? layout.pitch * 0.8f : layout.pitch;
+        layout.heightScale = (barsMax.y - barsMin.y) / m_unitHeight;
+
+        drawList->PushClipRect(barsMin, barsMax, true);
+        if (panel.renderer.isAvailable()) {
+            if (panel.dirty) {
+                panel.renderer.upload(panel.snapshot.values, panel.states);
+                panel.dirty = false;
+            }
+            panel.renderer.draw(drawList, layout, 0, n);
+        } else {
+            renderFallbackBars(drawList, panel, barsMin, barsMax, layout.heightScale);
+        }
+        drawList->PopClipRect();
+    }
+
+    char hint[128];
+    std::snprintf(hint, sizeof(hint), "%zu lanes on %u hardware threads | %zu elements per lane%s",
+                  lanes, std::thread::hardware_concurrency(), m_race.inputSize(),
+                  m_paced ? " | paced: wall times include the pacing" : "");
+    drawList->AddText(ImVec2(canvasPos.x + PADDING, canvasPos.y + canvasSize.y - HINT_HEIGHT + 6.0f), hintColor, hint);
+}
+
+void SortRaceView::renderFallbackBars(ImDrawList* drawList, const LanePanel& panel, ImVec2 min, ImVec2 max,
+                                      float heightScale) const {
+    size_t n = panel.snapshot.values.size();
+    float pitch = (max.x - min.x) / static_cast<float>(n);
+    size_t stride = pitch < 1.0f ? static_cast<size_t>(1.0f / pitch) : 1;
+    float width = pitch >= 4.0f ? pitch * 0.8f : std::max(pitch, 1.0f);
+
+    ImU32 baseColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::elementBase));
+    ImU32 sortedColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::sorted));
+    for (size_t i = 0; i < n; i += stride) {
+        float x = min.x + static_cast<float>(i) * pitch;
+        float height = static_cast<float>(panel.snapshot.values[i]) * heightScale;
+        drawList->AddRectFilled(ImVec2(x, max.y - height), ImVec2(x + width, max.y),
+                                panel.states[i] == BarState::Sorted ? sortedColor : baseColor);
+    }
+}
+
+void SortRaceView::renderSettings() {
+    bool running = isRunning();
+    ImGui::BeginDisabled(running);
+
+    ImGui::SliderInt("Lanes", &m_laneCount, 1, static_cast<int>(MAX_LANES));
+
+    const char* names[algorithms::SORT_ALGORITHM_COUNT];
+    for (size_t i = 0; i < algorithms::SORT_ALGORITHM_COUNT; ++i) {
+        names[i] = algorithms::sortAlgorithmName(static_cast<SortAlgorithm>(i));
+    }
+    for (int lane = 0; lane < m_laneCount; ++lane) {
+        ImGui::PushID(lane);
+        ImGui::TextColored(colors::toImGui(laneColor(static_cast<size_t>(lane))), "Lane %d", lane + 1);
+        ImGui::SameLine();
+        ImGui::Combo("##algorithm", &m_algorithms[lane], names, IM_ARRAYSIZE(names));
+        ImGui::PopID();
+    }
+
+    ImGui::Checkbox("Pace lanes", &m_paced);
+    ui::Tooltip("Limit every lane to the same number of steps per second so small\n"
+                "arrays can be watched; unpaced lanes run flat out for timing");
+    if (m_paced) {
+        ImGui::SliderFloat("Steps/s", &m_stepsPerSecond, MIN_STEPS_PER_SECOND, MAX_STEPS_PER_SECOND, "%.0f",
+                           ImGuiSliderFlags_Logarithmic);
+    }
+
+    ImGui::EndDisabled();
+}
+
+void SortRaceView::renderResults() {
+    if (!hasRace()) {
+        return;
+    }
+    if (isRunning()) {
+        ImGui::TextDisabled("Timings are listed here once every lane is done");
+        return;
+    }
+
+    // Finished lanes by time, then stopped lanes by progress
+    std::vector<size_t> order(m_race.laneCount());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::vector<SortRaceLaneStats> stats;
+    for (size_t i = 0; i < order.size(); ++i) stats.push_back(m_race.stats(i));
+    std::stable_sort(order.begin(), order.end(), [&stats](size_t a, size_t b) {
+        bool aDone = stats[a].state == SortRaceState::Finished;
+        bool bDone = stats[b].state == SortRaceState::Finished;
+        if (aDone != bDone) return aDone;
+        return aDone ? stats[a].seconds < stats[b].seconds : stats[a].steps > stats[b].steps;
+    });
+    double best = stats[order.front()].state == SortRaceState::Finished ? stats[order.front()].seconds : 0.0;
+
+    ImGui::Text("Final timings:");
+    if (ImGui::BeginTable("##race_results", 6, ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("Algorithm");
+        ImGui::TableSetupColumn("Steps");
+        ImGui::TableSetupColumn("Compares");
+        ImGui::TableSetupColumn("Swaps");
+        ImGui::TableSetupColumn("ms");
+        ImGui::TableSetupColumn("vs best");
+        ImGui::TableHeadersRow();
+        for (size_t lane : order) {
+            const SortRaceLaneStats& s = stats[lane];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextColored(colors::toImGui(laneColor(lane)), "%s", algorithms::sortAlgorithmName(m_race.algorithm(lane)));
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", s.steps);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", s.comparisons);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", s.swaps);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", s.seconds * 1000.0);
+            ImGui::TableNextColumn();
+            if (s.state == SortRaceState::Stopped) {
+                ImGui::TextColored(colors::toImGui(colors::semantic::warning), "stopped");
+            } else if (!s.sorted) {
+                ImGui::TextColored(colors::toImGui(colors::semantic::error), "not sorted");
+            } else if (best > 0.0) {
+                ImGui::Text("x%.2f", s.seconds / best);
+            } else {
+                ImGui::TextUnformatted("-");
+            }
+        }
+        ImGui::EndTable();
+    }
+}
+
+void SortRaceView::suspend() {
+    for (LanePanel& panel : m_panels) {
+        panel.renderer.release();
+        panel.dirty = !panel.snapshot.values.empty();
+    }
+}
+
+std::string SortRaceView::summary() const {
+    size_t lanes = m_race.laneCount();
+    size_t winner = SIZE_MAX;
+    for (size_t lane = 0; lane < lanes; ++lane) {
+        if (rank(lane) == 1) winner = lane;
+    }
+    char text[160];
+    if (winner == SIZE_MAX) {
+        std::snprintf(text, sizeof(text), "Race stopped before any of the %zu lanes finished", lanes);
+    } else {
+        SortRaceLaneStats stats = m_race.stats(winner);
+        std::snprintf(text, sizeof(text), "%s won in %.3f ms (%zu lanes)",
+                      algorithms::sortAlgorithmName(m_race.algorithm(winner)), stats.seconds * 1000.0, lanes);
+    }
+    return text;
+}
+
+} // namespace dsav
@@ -14,17 +14,48 @@
 
 namespace dsav {
 
-SortingVisualizer::SortingVisualizer() {
+SortingVisualizer::SortingVisualizer()
+    : SortingVisualizer(std::make_unique<CppSortBackend>()) {
+}
+
+SortingVisualizer::SortingVisualizer(std::unique_ptr<SortBackend> sorts)
+    : m_sorts(std::move(sorts)) {
+    for (size_t i = 0; i < m_sorts->algorithmCount(); ++i) {
+        m_algorithmNames.push_back(m_sorts->algorithmName(i));
+    }
+
     // Initialize with a random array
     randomizeArray();
     syncVisuals();
     m_statusText = "Ready to sort. Click 'Start Sort' or 'Step' to begin.";
 }
 
+SortingVisualizer::~SortingVisualizer() {
+    // The pending completions capture this; cancelling drops them
+    discardTrace();
+    discardImport();
+}
+
 void SortingVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
 
+    // The race lanes step on their own threads; only their snapshots are picked up here
+    if (m_raceMode) {
+        m_raceView.update(deltaTime);
+        if (!m_raceReported && !m_raceView.isRunning()) {
+            m_raceReported = true;
+            m_statusText = m_raceView.summary();
+        }
+        return;
+    }
+
+    // Turbo: run a time-budgeted batch of steps every frame
+    if (!m_isPaused && m_isSorting && m_turboMode) {
+        executeTurboBatch();
+        return;
+    }
+
     // Auto-step when playing
     if (!m_isPaused && m_isSorting) {
         m_timeSinceLastStep += deltaTime * m_speed;
@@ -55,6 +86,13 @@ void SortingVisualizer::renderVisualization() {
         ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::base))
     );
 
+    // Race panels fit the canvas, so there is no camera to drive
+    if (m_raceMode) {
+        m_raceView.render(drawList, canvasPos, canvasSize);
+        ImGui::Dummy(canvasSize);
+        return;
+    }
+
     // Calculate smaller hitbox (with padding on all sides)
     const float padding = 20.0f;
     ImVec2 hitboxMin = ImVec2(canvasPos.x + padding, canvasPos.y + padding);
@@ -89,7 +127,7 @@ void SortingVisualizer::renderVisualization() {
             float zoomDelta = io.MouseWheel * 0.1f;
             float oldZoom = m_zoomLevel;
             m_zoomLevel += zoomDelta;
-            m_zoomLevel = std::clamp(m_zoomLevel, 0.3f, 3.0f);
+            m_zoomLevel = std::clamp(m_zoomLevel, MIN_ZOOM, maxZoom());
 
             // Zoom focus on mouse cursor position
             float ratio = (m_zoomLevel - oldZoom) / oldZoom;
@@ -124,83 +162,38 @@ void SortingVisualizer::renderVisualization() {
         );
     }
 
-    // Draw elements as vertical bars (with zoom and offset)
-    for (size_t i = 0; i < m_elements.size(); ++i) {
-        const auto& elem = m_elements[i];
-
-        // Calculate bar height based on value (scaled)
-        float barHeight = elem.value * ELEMENT_HEIGHT_SCALE * m_zoomLevel;
-        float scaledWidth = ELEMENT_WIDTH * m_zoomLevel;
-        float scaledX = elem.position.x * m_zoomLevel;
-        float scaledBaseY = BASE_Y * m_zoomLevel;
-
-        // Draw bar (from bottom up)
-        ImVec2 topLeft = ImVec2(
-            canvasPos.x + scaledX + horizontalOffset,
-            canvasPos.y + scaledBaseY - barHeight + verticalOffset
-        );
-        ImVec2 bottomRight = ImVec2(
-            canvasPos.x + scaledX + scaledWidth + horizontalOffset,
-            canvasPos.y + scaledBaseY + verticalOffset
-        );
-
-        // Draw filled bar
-        drawList->AddRectFilled(
-            topLeft,
-            bottomRight,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(elem.color)),
-            4.0f * m_zoomLevel
-        );
-
-        // Draw border
-        drawList->AddRect(
-            topLeft,
-            bottomRight,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(elem.borderColor)),
-            4.0f * m_zoomLevel,
-            0,
-            2.0f
-        );
-
-        // Draw value label on top of bar
-        ImVec2 labelPos = ImVec2(
-            topLeft.x + (scaledWidth - ImGui::CalcTextSize(elem.label.c_str()).x) / 2.0f,
-            topLeft.y - 20.0f * m_zoomLevel
-        );
-        drawList->AddText(
-            labelPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textPrimary)),
-            elem.label.c_str()
-        );
-
-        // Draw index label at bottom
-        std::string indexLabel = "[" + std::to_string(i) + "]";
-        ImVec2 indexPos = ImVec2(
-            topLeft.x + (scaledWidth - ImGui::CalcTextSize(indexLabel.c_str()).x) / 2.0f,
-            bottomRight.y + 5.0f * m_zoomLevel
-        );
-        drawList->AddText(
-            indexPos,
-            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary)),
-            indexLabel.c_str()
-        );
+    // Draw bars (with zoom and offset), culled to the visible index range
+    float pitchPx = barPitch() * m_zoomLevel;
+    glm::vec2 origin(canvasPos.x + START_X * m_zoomLevel + horizontalOffset,
+                     canvasPos.y + BASE_Y * m_zoomLevel + verticalOffset);
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel, 0.0f);
+    IndexRange visible = viewport.visibleColumns(origin.x, pitchPx, pitchPx, m_array.size());
+    size_t first = visible.first;
+    size_t last = visible.last;
+
+    BarLayout layout;
+    layout.origin = origin;
+    layout.pitch = pitchPx;
+    layout.width = barWidth() * m_zoomLevel;
+    layout.heightScale = ELEMENT_HEIGHT_SCALE * m_valueScale * m_zoomLevel;
+
+    if (pitchPx >= LABELED_BAR_MIN_PITCH || !m_barRenderer.isAvailable()) {
+        renderLabeledBars(drawList, layout, first, last);
+    } else if (first < last) {
+        // One instanced draw for every visible bar
+        if (m_barsDirty) {
+            m_barRenderer.upload(m_array, m_barStates);
+            m_barsDirty = false;
+        }
+        m_barRenderer.draw(drawList, layout, first, last - first);
     }
 
     // Draw algorithm info
-    std::string algoName;
-    switch (m_currentAlgorithm) {
-        case Algorithm::BubbleSort:    algoName = "Bubble Sort"; break;
-        case Algorithm::SelectionSort: algoName = "Selection Sort"; break;
-        case Algorithm::InsertionSort: algoName = "Insertion Sort"; break;
-        case Algorithm::MergeSort:     algoName = "Merge Sort"; break;
-        case Algorithm::QuickSort:     algoName = "Quick Sort"; break;
-    }
-
     ImVec2 algoTextPos = ImVec2(canvasPos.x + 10.0f, canvasPos.y + 10.0f);
     drawList->AddText(
         algoTextPos,
         ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::active)),
-        algoName.c_str()
+        m_sorts->algorithmName(m_algorithm)
     );
 
     // Draw hint text at bottom showing controls and zoom level
@@ -221,73 +214,188 @@ void SortingVisualizer::renderVisualization() {
 void SortingVisualizer::renderControls() {
     ImGui::Begin("Sorting Controls");
 
-    // Algorithm selection
-    ImGui::Text("Algorithm:");
-    static const char* algorithmNames[] = {
-        "Bubble Sort", "Selection Sort", "Insertion Sort", "Merge Sort", "Quick Sort"
-    };
-    int currentAlgo = static_cast<int>(m_currentAlgorithm);
-    if (ImGui::Combo("##Algorithm", &currentAlgo, algorithmNames, 5)) {
-        m_currentAlgorithm = static_cast<Algorithm>(currentAlgo);
-        reset();
+    // Race lanes run the C++ steppers
+    if (m_sorts->hasSteppers() && ImGui::Checkbox("Race mode", &m_raceMode)) {
+        if (m_raceMode) {
+            // The race sorts copies; a half-finished single run would only confuse the input
+            if (m_isSorting) reset();
+            m_statusText = "Race mode: pick the lanes and click 'Start Race'.";
+        } else {
+            stopRace();
+            m_statusText = "Ready to sort. Click 'Start Sort' or 'Step' to begin.";
+        }
+    }
+    if (m_sorts->hasSteppers() && ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Sort copies of the array with several algorithms at once,\n"
+                          "each on its own thread");
+    }
+
+    if (m_raceMode) {
+        ImGui::Text("Race lanes:");
+        m_raceView.renderSettings();
+    } else {
+        // Algorithm selection
+        ImGui::Text("Algorithm:");
+        int currentAlgo = static_cast<int>(m_algorithm);
+        if (ImGui::Combo("##Algorithm", &currentAlgo, m_algorithmNames.data(),
+                         static_cast<int>(m_algorithmNames.size()))) {
+            m_algorithm = static_cast<size_t>(currentAlgo);
+            reset();
+        }
+
+        // Lane count applies from the next Start Sort
+        bool parallel = currentAlgorithm() == Algorithm::ParallelMergeSort
+                     || currentAlgorithm() == Algorithm::ParallelQuickSort;
+        if (m_sorts->hasSteppers() && parallel) {
+            ImGui::SliderInt("Threads", &m_parallelLanes, 1, static_cast<int>(algorithms::MAX_SORT_LANES));
+            if (const std::vector<size_t>* work = laneWork()) {
+                size_t total = 0;
+                for (size_t count : *work) total += count;
+                for (size_t lane = 0; lane < work->size(); ++lane) {
+                    float share = total > 0 ? static_cast<float>((*work)[lane]) / static_cast<float>(total) : 0.0f;
+                    ImGui::PushStyleColor(ImGuiCol_PlotHistogram, colors::toImGui(barColor(laneBarState(lane))));
+                    ImGui::ProgressBar(share, ImVec2(-1.0f, 0.0f), ("Lane " + std::to_string(lane)).c_str());
+                    ImGui::PopStyleColor();
+                }
+            }
+        }
     }
 
     ImGui::Separator();
 
     // Array controls
     ImGui::Text("Array Configuration:");
-    if (ImGui::SliderInt("Array Size", &m_arraySize, 5, MAX_ARRAY_SIZE)) {
-        if (!m_isSorting) {
-            randomizeArray();
-        }
+    // Logarithmic so small sizes stay reachable; regenerate once the drag ends
+    ImGui::SliderInt("Array Size", &m_arraySize, 5, MAX_ARRAY_SIZE, "%d", ImGuiSliderFlags_Logarithmic);
+    if (ImGui::IsItemDeactivatedAfterEdit() && !m_isSorting) {
+        randomizeArray();
     }
 
     if (ImGui::Button("Randomize Array", ImVec2(-1, 0))) {
         randomizeArray();
     }
 
+    // Dataset import
+    if (ImGui::CollapsingHeader("Import Dataset")) {
+        m_importPanel.render();
+        ImGui::BeginDisabled(!m_importPanel.hasPath() || m_isSorting);
+        if (ImGui::Button("Import", ImVec2(-1, 0))) {
+            importDataset(m_importPanel.path(), m_importPanel.format());
+        }
+        ImGui::EndDisabled();
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Replace the array with the file's keys, in file order");
+        }
+        if (m_importJob) {
+            ImGui::Text("Importing...");
+        }
+    }
+
     ImGui::Separator();
 
-    // Playback controls
-    ImGui::Text("Playback:");
+    if (m_raceMode) {
+        ImGui::Text("Race:");
+        if (m_raceView.isRunning()) {
+            if (ImGui::Button("Stop Race", ImVec2(-1, 0))) {
+                stopRace();
+            }
+        } else if (ImGui::Button("Start Race", ImVec2(-1, 0))) {
+            startRace();
+        }
+        m_raceView.renderResults();
+    } else {
+        // Playback controls
+        ImGui::Text("Playback:");
 
-    ImGui::BeginGroup();
-    if (ImGui::Button("⏮ Reset")) {
-        reset();
-    }
-    ImGui::SameLine();
+        ImGui::BeginGroup();
+        if (ImGui::Button("⏮ Reset")) {
+            reset();
+        }
+        ImGui::SameLine();
 
-    if (m_isPaused) {
-        if (ImGui::Button("▶ Play")) {
-            play();
+        if (m_isPaused) {
+            if (ImGui::Button("▶ Play")) {
+                play();
+            }
+        } else {
+            if (ImGui::Button("⏸ Pause")) {
+                pause();
+            }
         }
-    } else {
-        if (ImGui::Button("⏸ Pause")) {
-            pause();
+        ImGui::SameLine();
+
+        ImGui::BeginDisabled(!m_timeline.isActive() || m_timeline.position() == 0);
+        if (ImGui::Button("⏪ Back")) {
+            stepBack();
         }
-    }
-    ImGui::SameLine();
+        ImGui::EndDisabled();
+        ImGui::SameLine();
 
-    if (ImGui::Button("⏩ Step")) {
-        step();
-    }
-    ImGui::SameLine();
+        if (ImGui::Button("⏩ Step")) {
+            step();
+        }
+        ImGui::SameLine();
 
-    if (ImGui::Button("Start Sort")) {
-        startSort();
-    }
-    ImGui::EndGroup();
+        if (ImGui::Button("Start Sort")) {
+            startSort();
+        }
+        ImGui::EndGroup();
+
+        // Step history
+        ImGui::Checkbox("Record history", &m_recordHistory);
+        // Backends without steppers always replay a trace
+        if (m_sorts->hasSteppers()) {
+            ImGui::Checkbox("Precompute trace", &m_useTrace);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Run the sort to completion on a worker thread first,\n"
+                                  "then replay its compares, swaps and writes");
+            }
+        }
+        if (m_useTrace || m_runUsesTrace || !m_sorts->hasSteppers()) {
+            ImGui::SliderInt("Ops per step", &m_traceOpsPerStep, 1, MAX_TRACE_OPS_PER_STEP, "%d",
+                             ImGuiSliderFlags_Logarithmic);
+        }
+        if (m_traceJob) {
+            ImGui::Text("Generating trace...");
+        } else if (m_trace && m_runUsesTrace) {
+            ImGui::Text("Trace: %zu / %zu ops, %.1f MB", m_tracePlayer.position(), m_trace->size(),
+                        static_cast<double>(m_trace->memoryUsage()) / (1024.0 * 1024.0));
+        }
+        if (!m_runNote.empty()) {
+            ImGui::TextWrapped("Last run: %s", m_runNote.c_str());
+        }
+        if (m_timeline.isActive()) {
+            int position = static_cast<int>(m_timeline.position());
+            int last = static_cast<int>(m_timeline.stepCount());
+            if (ImGui::SliderInt("Timeline", &position, 0, last)) {
+                seek(static_cast<size_t>(position));
+            }
+            ImGui::Text("History: %zu steps, %.1f MB", m_timeline.stepCount(),
+                        static_cast<double>(m_timeline.memoryUsage()) / (1024.0 * 1024.0));
+        } else if (m_timeline.overflowed()) {
+            ImGui::TextWrapped("History dropped: this run needs more than %zu MB",
+                               algorithms::ArrayTimeline::MAX_MEMORY_BYTES >> 20);
+        }
 
-    ImGui::Separator();
+        ImGui::Separator();
 
-    // Speed control
-    ImGui::Text("Speed:");
-    if (ImGui::SliderFloat("##Speed", &m_speed, 0.1f, 5.0f, "%.1fx")) {
-        setSpeed(m_speed);
-    }
+        // Speed control
+        ImGui::Text("Speed:");
+        if (ImGui::SliderFloat("##Speed", &m_speed, 0.1f, 5.0f, "%.1fx")) {
+            setSpeed(m_speed);
+        }
 
-    if (ImGui::SliderInt("Step Delay (ms)", &m_stepDelay, 10, 2000)) {
-        // Delay updated
+        if (ImGui::SliderInt("Step Delay (ms)", &m_stepDelay, 10, 2000)) {
+            // Delay updated
+        }
+
+        ImGui::Checkbox("Turbo (steps per frame)", &m_turboMode);
+        if (m_turboMode) {
+            ImGui::SliderFloat("Frame Budget (ms)", &m_turboBudgetMs, 0.5f, 8.0f, "%.1f");
+            ImGui::Text("Steps last frame: %zu", m_lastBatchSteps);
+        }
+
+        m_sorts->renderControls();
     }
 
     ImGui::Separator();
@@ -308,6 +416,10 @@ void SortingVisualizer::renderControls() {
 }
 
 void SortingVisualizer::play() {
+    if (m_raceMode) {
+        startRace();
+        return;
+    }
     m_isPaused = false;
     if (!m_isSorting) {
         startSort();
@@ -316,11 +428,19 @@ void SortingVisualizer::play() {
 }
 
 void SortingVisualizer::pause() {
+    if (m_raceMode) {
+        stopRace();
+        return;
+    }
     m_isPaused = true;
     m_statusText = "Paused";
 }
 
 void SortingVisualizer::step() {
+    if (m_raceMode) {
+        // Lanes run free on their threads; there is no common step to take
+        return;
+    }
     if (!m_isSorting) {
         startSort();
     }
@@ -332,13 +452,24 @@ void SortingVisualizer::reset() {
     m_isSorting = false;
     m_timeSinceLastStep = 0.0f;
     m_animator.clear();
+    stopRace();
 
     // Reset algorithm steppers
+    discardTrace();
+    discardImport();
+    m_timeline.clear();
     m_bubbleSorter.reset();
     m_selectionSorter.reset();
     m_insertionSorter.reset();
     m_mergeSorter.reset();
     m_quickSorter.reset();
+    m_heapSorter.reset();
+    m_shellSorter.reset();
+    m_radixSorter.reset();
+    m_countingSorter.reset();
+    m_introSorter.reset();
+    m_parallelMergeSorter.reset();
+    m_parallelQuickSorter.reset();
 
     // Regenerate random array
     randomizeArray();
@@ -360,16 +491,46 @@ bool SortingVisualizer::isAnimating() const {
 }
 
 bool SortingVisualizer::isPaused() const {
+    if (m_raceMode) {
+        return !m_raceView.isRunning();
+    }
     return m_isPaused;
 }
 
+void SortingVisualizer::suspend() {
+    // The bars are re-uploaded from m_array when the visualizer is shown again
+    m_barRenderer.release();
+    m_barsDirty = true;
+
+    // Lanes would keep their cores busy while nobody watches
+    stopRace();
+    m_raceView.suspend();
+}
+
 void SortingVisualizer::startSort() {
     m_isSorting = true;
     m_isPaused = false;
     m_timeSinceLastStep = 0.0f;
 
+    if (m_sorts->hasSteppers()) {
+        createStepper();
+    } else {
+        m_statusText = std::string("Starting ") + m_sorts->algorithmName(m_algorithm) + "...";
+    }
+
+    discardTrace();
+    m_runUsesTrace = m_useTrace || !m_sorts->hasSteppers();
+    if (m_runUsesTrace) {
+        launchTrace();
+    }
+
+    beginTimeline();
+    syncVisuals();
+}
+
+void SortingVisualizer::createStepper() {
     // Create appropriate stepper based on selected algorithm
-    switch (m_currentAlgorithm) {
+    switch (currentAlgorithm()) {
         case Algorithm::BubbleSort:
             m_bubbleSorter = std::make_unique<algorithms::BubbleSortStepper>(m_array);
             m_statusText = "Starting Bubble Sort...";
@@ -390,9 +551,57 @@ void SortingVisualizer::startSort() {
             m_quickSorter = std::make_unique<algorithms::QuickSortStepper>(m_array);
             m_statusText = "Starting Quick Sort...";
             break;
+        case Algorithm::HeapSort:
+            m_heapSorter = std::make_unique<algorithms::HeapSortStepper>(m_array);
+            m_statusText = "Starting Heap Sort...";
+            break;
+        case Algorithm::ShellSort:
+            m_shellSorter = std::make_unique<algorithms::ShellSortStepper>(m_array);
+            m_statusText = "Starting Shell Sort...";
+            break;
+        case Algorithm::RadixSort:
+            m_radixSorter = std::make_unique<algorithms::RadixSortStepper>(m_array);
+            m_statusText = "Starting Radix Sort...";
+            break;
+        case Algorithm::CountingSort:
+            m_countingSorter = std::make_unique<algorithms::CountingSortStepper>(m_array);
+            m_statusText = "Starting Counting Sort...";
+            break;
+        case Algorithm::IntroSort:
+            m_introSorter = std::make_unique<algorithms::IntroSortStepper>(m_array);
+            m_statusText = "Starting Introsort...";
+            break;
+        case Algorithm::ParallelMergeSort:
+        case Algorithm::ParallelQuickSort: {
+            // Small enough tasks that every lane gets some even on a short array
+            size_t lanes = static_cast<size_t>(m_parallelLanes);
+            size_t grain = std::max<size_t>(1, m_array.size() / (lanes * PARALLEL_TASKS_PER_LANE));
+            if (currentAlgorithm() == Algorithm::ParallelMergeSort) {
+                m_parallelMergeSorter = std::make_unique<algorithms::ParallelMergeSortStepper>(m_array, lanes, grain);
+                m_statusText = "Starting Parallel Merge Sort...";
+            } else {
+                m_parallelQuickSorter = std::make_unique<algorithms::ParallelQuickSortStepper>(m_array, lanes, grain);
+                m_statusText = "Starting Parallel Quick Sort...";
+            }
+            break;
+        }
     }
+}
 
-    syncVisuals();
+void SortingVisualizer::startRace() {
+    if (!m_raceView.start(m_array)) {
+        m_statusText = "Race failed: " + m_raceView.error();
+        return;
+    }
+    m_raceReported = false;
+    m_statusText = "Racing on " + std::to_string(m_array.size()) + " elements...";
+}
+
+void SortingVisualizer::stopRace() {
+    if (m_raceView.isRunning()) {
+        m_raceView.stop();
+        m_statusText = "Race stopped";
+    }
 }
 
 void SortingVisualizer::randomizeArray() {
@@ -410,42 +619,162 @@ void SortingVisualizer::randomizeArray() {
     // Reset sorting state
     m_isSorting = false;
     m_isPaused = true;
+    discardTrace();
+    m_timeline.clear();
 
+    updateValueScale();
     syncVisuals();
 }
 
 void SortingVisualizer::setArray(const std::vector<int>& arr) {
-    m_array = arr;
-    m_arraySize = static_cast<int>(arr.size());
+    setArray(std::vector<int>(arr));
+}
+
+void SortingVisualizer::setArray(std::vector<int>&& arr) {
+    m_array = std::move(arr);
+    m_arraySize = static_cast<int>(std::min<size_t>(m_array.size(), MAX_ARRAY_SIZE));
     m_isSorting = false;
     m_isPaused = true;
+    discardTrace();
+    m_timeline.clear();
+    updateValueScale();
     syncVisuals();
 }
 
-void SortingVisualizer::syncVisuals() {
-    m_elements.clear();
-    m_elements.reserve(m_array.size());
+void SortingVisualizer::importDataset(const std::string& path, algorithms::DatasetFormat format) {
+    discardImport();
+
+    m_importJob = jobs::submit([this, path, format](const JobToken& token) {
+        // Decoded straight from the mapping (or the text buffer) into the array the bars will show
+        auto keys = std::make_shared<std::vector<int>>();
+        algorithms::DatasetReader reader;
+        bool ok = reader.open(path, format) && reader.readInto(*keys, MAX_IMPORT_SIZE, &token.cancelledFlag());
+        std::string message = ok ? "Imported " + DatasetImportPanel::describe(reader.info(), keys->size())
+                                 : "Import failed: " + reader.error();
+        return JobCompletion([this, keys, ok, message]() { finishImport(*keys, ok, message); });
+    });
+
+    m_statusText = "Importing " + path + "...";
+}
 
-    for (size_t i = 0; i < m_array.size(); ++i) {
-        VisualSortElement elem;
-        elem.position = calculatePosition(i);
-        elem.size = glm::vec2(ELEMENT_WIDTH, m_array[i] * ELEMENT_HEIGHT_SCALE);
-        elem.color = colors::semantic::elementBase;
-        elem.borderColor = colors::semantic::active;
-        elem.label = std::to_string(m_array[i]);
-        elem.value = m_array[i];
-        elem.isSorted = false;
+void SortingVisualizer::finishImport(std::vector<int>& keys, bool ok, const std::string& message) {
+    m_importJob.reset();
+    if (ok) {
+        m_animator.clear();
+        setArray(std::move(keys));
+        m_cameraOffsetX = 0.0f;
+        m_cameraOffsetY = 0.0f;
+        m_zoomLevel = 1.0f;
+    }
+    m_statusText = message;
+}
 
-        m_elements.push_back(elem);
+void SortingVisualizer::discardImport() {
+    if (m_importJob) {
+        m_importJob->cancel();
+        m_importJob.reset();
     }
+}
+
+void SortingVisualizer::updateValueScale() {
+    // Generated values keep their natural height; larger keys are squeezed to MAX_VALUE's
+    std::int64_t largest = 0;
+    for (int v : m_array) {
+        largest = std::max<std::int64_t>(largest, v < 0 ? -static_cast<std::int64_t>(v) : v);
+    }
+    m_valueScale = largest > MAX_VALUE ? static_cast<float>(MAX_VALUE) / static_cast<float>(largest) : 1.0f;
+}
 
+void SortingVisualizer::syncVisuals() {
+    m_barStates.assign(m_array.size(), BarState::Base);
     updateColors();
 }
 
-glm::vec2 SortingVisualizer::calculatePosition(size_t index) const {
-    float x = START_X + index * (ELEMENT_WIDTH + ELEMENT_SPACING);
-    float y = BASE_Y;  // All bars share same baseline
-    return glm::vec2(x, y);
+float SortingVisualizer::barPitch() const {
+    // Natural spacing for small arrays; large arrays are squeezed to fit
+    float natural = ELEMENT_WIDTH + ELEMENT_SPACING;
+    if (m_array.empty()) return natural;
+    return std::min(natural, FIT_WIDTH / static_cast<float>(m_array.size()));
+}
+
+float SortingVisualizer::barWidth() const {
+    // Keep the gap while bars are wide enough to show it
+    float pitch = barPitch();
+    float natural = ELEMENT_WIDTH + ELEMENT_SPACING;
+    return (pitch >= 4.0f) ? pitch * (ELEMENT_WIDTH / natural) : pitch;
+}
+
+float SortingVisualizer::maxZoom() const {
+    // Always allow zooming in until labels become legible
+    return std::max(MAX_ZOOM, LABELED_BAR_MIN_PITCH * 1.5f / barPitch());
+}
+
+void SortingVisualizer::renderLabeledBars(ImDrawList* drawList, const BarLayout& layout, size_t first, size_t last) {
+    bool labeled = layout.pitch >= LABELED_BAR_MIN_PITCH;
+    float rounding = labeled ? 4.0f * m_zoomLevel : 0.0f;
+
+    // Without the GPU path, thin bars are sampled so each pixel column is drawn once
+    size_t stride = 1;
+    if (!labeled && layout.pitch < 1.0f) {
+        stride = static_cast<size_t>(1.0f / layout.pitch);
+    }
+
+    ImU32 borderColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::active));
+    ImU32 textColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textPrimary));
+    ImU32 indexColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::semantic::textSecondary));
+
+    for (size_t i = first; i < last; i += stride) {
+        float barHeight = m_array[i] * layout.heightScale;
+        float x = layout.origin.x + static_cast<float>(i) * layout.pitch;
+
+        // Draw bar (from bottom up)
+        ImVec2 topLeft = ImVec2(x, layout.origin.y - barHeight);
+        ImVec2 bottomRight = ImVec2(x + std::max(layout.width, 1.0f), layout.origin.y);
+
+        drawList->AddRectFilled(
+            topLeft,
+            bottomRight,
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(barColor(m_barStates[i]))),
+            rounding
+        );
+
+        if (!labeled) {
+            continue;
+        }
+
+        // Draw border
+        drawList->AddRect(topLeft, bottomRight, borderColor, rounding, 0, 2.0f);
+
+        // Draw value label on top of bar
+        LabelId label = labels::fromInt(m_array[i]);
+        ImVec2 labelPos = ImVec2(
+            topLeft.x + (layout.width - labels::textSize(label).x) / 2.0f,
+            topLeft.y - 20.0f * m_zoomLevel
+        );
+        labels::draw(drawList, labelPos, textColor, label);
+
+        // Draw index label at bottom
+        LabelId indexLabel = labels::fromIndex(i);
+        ImVec2 indexPos = ImVec2(
+            topLeft.x + (layout.width - labels::textSize(indexLabel).x) / 2.0f,
+            bottomRight.y + 5.0f * m_zoomLevel
+        );
+        labels::draw(drawList, indexPos, indexColor, indexLabel);
+    }
+}
+
+glm::vec4 SortingVisualizer::barColor(BarState state) {
+    switch (state) {
+        case BarState::Comparing: return colors::semantic::comparing;
+        case BarState::Swapping:  return colors::semantic::swapping;
+        case BarState::Sorted:    return colors::semantic::sorted;
+        case BarState::Highlight: return colors::semantic::highlight;
+        default: break;
+    }
+    if (state >= BarState::Lane0 && state <= BarState::Lane7) {
+        return colors::semantic::lanes[static_cast<size_t>(state) - static_cast<size_t>(BarState::Lane0)];
+    }
+    return colors::semantic::elementBase;
 }
 
 void SortingVisualizer::executeStep() {
@@ -453,276 +782,756 @@ void SortingVisualizer::executeStep() {
         return;
     }
 
-    bool continueSort = false;
+    if (advanceStepper()) {
+        describeStep();
+    }
 
-    switch (m_currentAlgorithm) {
-        case Algorithm::BubbleSort:
-            if (m_bubbleSorter) {
-                continueSort = m_bubbleSorter->step();
-                if (!continueSort) {
-                    m_statusText = "Bubble Sort complete!";
-                    m_isSorting = false;
-                    m_isPaused = true;
-                } else {
-                    auto state = m_bubbleSorter->getState();
-                    int i = m_bubbleSorter->getIndexI();
-                    int j = m_bubbleSorter->getIndexJ();
-
-                    if (state == algorithms::SortState::Comparing) {
-                        std::ostringstream oss;
-                        oss << "Comparing: arr[" << j << "]=" << m_array[j]
-                            << " and arr[" << (j+1) << "]=" << m_array[j+1];
-                        m_statusText = oss.str();
-                    } else if (state == algorithms::SortState::Swapping) {
-                        std::ostringstream oss;
-                        oss << "Swapping: arr[" << j << "] ↔ arr[" << (j+1) << "]";
-                        m_statusText = oss.str();
-                    }
+    // Update visuals and colors
+    syncVisuals();
+    updateColors();
+}
+
+void SortingVisualizer::executeTurboBatch() {
+    if (!m_isSorting) {
+        return;
+    }
+
+    // As many steps as fit in the frame budget, then a single visual sync
+    setFastForward(true);
+    m_lastBatchSteps = runStepsWithinBudget([this]() { return advanceStepper(); }, m_turboBudgetMs);
+    setFastForward(false);
+    if (m_isSorting) {
+        describeStep();
+    }
+
+    syncVisuals();
+    updateColors();
+}
+
+void SortingVisualizer::setFastForward(bool enabled) {
+    if (m_mergeSorter) m_mergeSorter->setFastForward(enabled);
+    if (m_quickSorter) m_quickSorter->setFastForward(enabled);
+}
+
+bool SortingVisualizer::advanceStepper() {
+    if (!m_isSorting) {
+        return false;
+    }
+
+    // Behind the frontier: replay the recorded step, the stepper is already past it
+    if (m_timeline.isActive() && !m_timeline.atFrontier()) {
+        m_timeline.seek(m_timeline.position() + 1, m_array);
+        if (m_timeline.atFrontier() && stepperComplete()) {
+            m_statusText = "Reached the end of the recorded run";
+            m_isSorting = false;
+            m_isPaused = true;
+            return false;
+        }
+        return true;
+    }
+
+    // Trace runs wait for the worker before their first step
+    if (m_traceJob) {
+        return false;
+    }
+
+    bool continueSort = true;
+    const char* completeText = "";
+
+    if (m_runUsesTrace) {
+        algorithms::StepRecorder* recorder = m_timeline.isActive() ? &m_timeline : nullptr;
+        if (trace::isActive()) {
+            m_traceRecorder.attach(recorder, m_sorts->algorithmName(m_algorithm));
+            recorder = &m_traceRecorder;
+        }
+        continueSort = m_tracePlayer.advance(static_cast<size_t>(m_traceOpsPerStep), m_array, recorder);
+        completeText = "Trace replay complete!";
+    } else {
+        switch (currentAlgorithm()) {
+            case Algorithm::BubbleSort:
+                if (m_bubbleSorter) {
+                    continueSort = m_bubbleSorter->step();
+                    completeText = "Bubble Sort complete!";
+                }
+                break;
+
+            case Algorithm::SelectionSort:
+                if (m_selectionSorter) {
+                    continueSort = m_selectionSorter->step();
+                    completeText = "Selection Sort complete!";
+                }
+                break;
+
+            case Algorithm::InsertionSort:
+                if (m_insertionSorter) {
+                    continueSort = m_insertionSorter->step();
+                    completeText = "Insertion Sort complete!";
+                }
+                break;
+
+            case Algorithm::MergeSort:
+                if (m_mergeSorter) {
+                    continueSort = m_mergeSorter->step();
+                    completeText = "Merge Sort complete!";
+                }
+                break;
+
+            case Algorithm::QuickSort:
+                if (m_quickSorter) {
+                    continueSort = m_quickSorter->step();
+                    completeText = "Quick Sort complete!";
+                }
+                break;
+
+            case Algorithm::HeapSort:
+                if (m_heapSorter) {
+                    continueSort = m_heapSorter->step();
+                    completeText = "Heap Sort complete!";
+                }
+                break;
+
+            case Algorithm::ShellSort:
+                if (m_shellSorter) {
+                    continueSort = m_shellSorter->step();
+                    completeText = "Shell Sort complete!";
+                }
+                break;
+
+            case Algorithm::RadixSort:
+                if (m_radixSorter) {
+                    continueSort = m_radixSorter->step();
+                    completeText = "Radix Sort complete!";
                 }
+                break;
+
+            case Algorithm::CountingSort:
+                if (m_countingSorter) {
+                    continueSort = m_countingSorter->step();
+                    completeText = "Counting Sort complete!";
+                }
+                break;
+
+            case Algorithm::IntroSort:
+                if (m_introSorter) {
+                    continueSort = m_introSorter->step();
+                    completeText = "Introsort complete!";
+                }
+                break;
+
+            case Algorithm::ParallelMergeSort:
+                if (m_parallelMergeSorter) {
+                    continueSort = m_parallelMergeSorter->step();
+                    completeText = "Parallel Merge Sort complete!";
+                }
+                break;
+
+            case Algorithm::ParallelQuickSort:
+                if (m_parallelQuickSorter) {
+                    continueSort = m_parallelQuickSorter->step();
+                    completeText = "Parallel Quick Sort complete!";
+                }
+                break;
+        }
+    }
+
+    m_liveCursor = captureCursor();
+    m_timeline.commitStep(m_array, m_liveCursor);
+
+    if (!continueSort) {
+        m_statusText = completeText;
+        m_isSorting = false;
+        m_isPaused = true;
+    }
+    return continueSort;
+}
+
+bool SortingVisualizer::stepBack() {
+    if (!m_timeline.isActive() || m_timeline.position() == 0) {
+        return false;
+    }
+    return seek(m_timeline.position() - 1);
+}
+
+bool SortingVisualizer::seek(size_t step) {
+    if (!m_timeline.isActive() || step > m_timeline.stepCount()) {
+        return false;
+    }
+
+    m_isPaused = true;
+    m_timeline.seek(step, m_array);
+
+    // Only the frontier of a finished run has nothing left to play
+    m_isSorting = !(m_timeline.atFrontier() && stepperComplete());
+    std::ostringstream oss;
+    oss << "Step " << m_timeline.position() << " / " << m_timeline.stepCount();
+    m_statusText = oss.str();
+    describeStep();
+
+    syncVisuals();
+    return true;
+}
+
+void SortingVisualizer::launchTrace() {
+    // The worker sorts its own copy; m_array stays untouched until replay. A cancelled
+    // job may still be running when the visualizer goes away, so it shares the backend.
+    std::shared_ptr<const SortBackend> sorts = m_sorts;
+    m_traceJob = jobs::submit([this, sorts, algorithm = m_algorithm, input = m_array](const JobToken& token) mutable {
+        auto trace = std::make_shared<algorithms::SortTrace>();
+        std::string note;
+        if (!sorts->record(algorithm, std::move(input), *trace, note, &token.cancelledFlag())) {
+            trace.reset();
+        }
+        return JobCompletion([this, trace, note]() { onTraceReady(trace, note); });
+    });
+    m_runNote.clear();
+    m_statusText = "Generating trace...";
+}
+
+void SortingVisualizer::onTraceReady(std::shared_ptr<algorithms::SortTrace> trace, const std::string& note) {
+    m_traceJob.reset();
+    m_trace = std::move(trace);
+    if (m_trace) {
+        m_tracePlayer.reset(m_trace.get());
+        m_runNote = note;
+    } else if (m_sorts->hasSteppers()) {
+        // Too many operations to keep: run the stepper live instead
+        m_runUsesTrace = false;
+        m_statusText = "Trace too large, sorting live";
+    } else {
+        m_isSorting = false;
+        m_isPaused = true;
+        m_statusText = "Sort failed: " + note;
+    }
+}
+
+void SortingVisualizer::discardTrace() {
+    // A cancelled job stops generating and its completion is dropped
+    if (m_traceJob) {
+        m_traceJob->cancel();
+        m_traceJob.reset();
+    }
+    m_trace.reset();
+    m_tracePlayer.reset(nullptr);
+    m_runUsesTrace = false;
+}
+
+void SortingVisualizer::beginTimeline() {
+    m_liveCursor = captureCursor();
+
+    algorithms::StepRecorder* recorder = nullptr;
+    if (m_recordHistory) {
+        m_timeline.begin(m_array, m_liveCursor);
+        if (const algorithms::SortedMarks* marks = sortedMarks()) {
+            for (size_t i = 0; i < m_array.size(); ++i) {
+                if (marks->isSorted(i)) m_timeline.markInitial(i, i + 1);
             }
+        }
+        recorder = &m_timeline;
+    } else {
+        m_timeline.clear();
+    }
+
+    // A trace capture sees the run through a tee in front of the timeline
+    if (trace::isActive()) {
+        m_traceRecorder.attach(recorder, m_sorts->algorithmName(m_algorithm));
+        recorder = &m_traceRecorder;
+    }
+
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort:
+            if (m_bubbleSorter) m_bubbleSorter->setRecorder(recorder);
+            break;
+        case Algorithm::SelectionSort:
+            if (m_selectionSorter) m_selectionSorter->setRecorder(recorder);
+            break;
+        case Algorithm::InsertionSort:
+            if (m_insertionSorter) m_insertionSorter->setRecorder(recorder);
+            break;
+        case Algorithm::MergeSort:
+            if (m_mergeSorter) m_mergeSorter->setRecorder(recorder);
+            break;
+        case Algorithm::QuickSort:
+            if (m_quickSorter) m_quickSorter->setRecorder(recorder);
+            break;
+        case Algorithm::HeapSort:
+            if (m_heapSorter) m_heapSorter->setRecorder(recorder);
+            break;
+        case Algorithm::ShellSort:
+            if (m_shellSorter) m_shellSorter->setRecorder(recorder);
+            break;
+        case Algorithm::RadixSort:
+            if (m_radixSorter) m_radixSorter->setRecorder(recorder);
+            break;
+        case Algorithm::CountingSort:
+            if (m_countingSorter) m_countingSorter->setRecorder(recorder);
             break;
+        case Algorithm::IntroSort:
+            if (m_introSorter) m_introSorter->setRecorder(recorder);
+            break;
+        case Algorithm::ParallelMergeSort:
+            if (m_parallelMergeSorter) m_parallelMergeSorter->setRecorder(recorder);
+            break;
+        case Algorithm::ParallelQuickSort:
+            if (m_parallelQuickSorter) m_parallelQuickSorter->setRecorder(recorder);
+            break;
+    }
+}
+
+algorithms::StepCursor SortingVisualizer::captureCursor() const {
+    // Per algorithm: first/second/third hold the indices updateColors highlights
+    algorithms::StepCursor result;
+    auto pack = [&result](algorithms::SortState state, int first, int second, int third) {
+        result.state = static_cast<std::uint8_t>(state);
+        result.first = first;
+        result.second = second;
+        result.third = third;
+    };
 
+    // Trace replay: the operands of the last compare/swap/write (second = -1 for writes)
+    if (m_runUsesTrace) {
+        if (const algorithms::TraceOp* op = m_tracePlayer.lastOp()) {
+            int a = static_cast<int>(op->a());
+            switch (op->kind()) {
+                case algorithms::TraceOpKind::Compare: pack(algorithms::SortState::Comparing, a, op->b(), -1); break;
+                case algorithms::TraceOpKind::Swap:    pack(algorithms::SortState::Swapping, a, op->b(), -1); break;
+                default:                               pack(algorithms::SortState::Swapping, a, -1, -1); break;
+            }
+        }
+        return result;
+    }
+
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort:
+            if (m_bubbleSorter) {
+                pack(m_bubbleSorter->getState(), m_bubbleSorter->getIndexJ(), m_bubbleSorter->getIndexI(), -1);
+            }
+            break;
         case Algorithm::SelectionSort:
             if (m_selectionSorter) {
-                continueSort = m_selectionSorter->step();
-                if (!continueSort) {
-                    m_statusText = "Selection Sort complete!";
-                    m_isSorting = false;
-                    m_isPaused = true;
-                } else {
-                    auto state = m_selectionSorter->getState();
-                    int current = m_selectionSorter->getCurrentIndex();
-                    int minIdx = m_selectionSorter->getMinIndex();
-
-                    if (state == algorithms::SortState::Comparing) {
-                        std::ostringstream oss;
-                        oss << "Finding minimum in unsorted portion. Current min index: " << minIdx;
-                        m_statusText = oss.str();
-                    } else if (state == algorithms::SortState::Swapping) {
-                        std::ostringstream oss;
-                        oss << "Swapping minimum to position " << current;
-                        m_statusText = oss.str();
-                    }
-                }
+                pack(m_selectionSorter->getState(), m_selectionSorter->getCurrentIndex(),
+                     m_selectionSorter->getMinIndex(), m_selectionSorter->getCompareIndex());
             }
             break;
-
         case Algorithm::InsertionSort:
             if (m_insertionSorter) {
-                continueSort = m_insertionSorter->step();
-                if (!continueSort) {
-                    m_statusText = "Insertion Sort complete!";
-                    m_isSorting = false;
-                    m_isPaused = true;
-                } else {
-                    auto state = m_insertionSorter->getState();
-                    int current = m_insertionSorter->getCurrentIndex();
-
-                    if (state == algorithms::SortState::Swapping) {
-                        std::ostringstream oss;
-                        oss << "Inserting element at index " << current << " into sorted portion";
-                        m_statusText = oss.str();
-                    }
-                }
+                pack(m_insertionSorter->getState(), m_insertionSorter->getCurrentIndex(),
+                     m_insertionSorter->getCompareIndex(), -1);
             }
             break;
-
         case Algorithm::MergeSort:
             if (m_mergeSorter) {
-                continueSort = m_mergeSorter->step();
-                if (!continueSort) {
-                    m_statusText = "Merge Sort complete!";
-                    m_isSorting = false;
-                    m_isPaused = true;
-                } else {
-                    int left = m_mergeSorter->getLeftIndex();
-                    int mid = m_mergeSorter->getMidIndex();
-                    int right = m_mergeSorter->getRightIndex();
-                    std::ostringstream oss;
-                    oss << "Merging [" << left << ".." << mid << "] (yellow) with ["
-                        << (mid + 1) << ".." << right << "] (orange)";
-                    m_statusText = oss.str();
-                }
+                pack(m_mergeSorter->getState(), m_mergeSorter->getLeftIndex(),
+                     m_mergeSorter->getMidIndex(), m_mergeSorter->getRightIndex());
             }
             break;
-
         case Algorithm::QuickSort:
             if (m_quickSorter) {
-                continueSort = m_quickSorter->step();
-                if (!continueSort) {
-                    m_statusText = "Quick Sort complete!";
-                    m_isSorting = false;
-                    m_isPaused = true;
-                } else {
-                    int pivot = m_quickSorter->getPivotIndex();
-                    std::ostringstream oss;
-                    oss << "Partitioning around pivot at index " << pivot;
-                    m_statusText = oss.str();
-                }
+                pack(m_quickSorter->getState(), m_quickSorter->getPivotIndex(),
+                     m_quickSorter->getLeftIndex(), m_quickSorter->getRightIndex());
+            }
+            break;
+        case Algorithm::HeapSort:
+            if (m_heapSorter) {
+                pack(m_heapSorter->getState(), m_heapSorter->getNodeIndex(),
+                     m_heapSorter->getChildIndex(), m_heapSorter->getHeapSize());
+            }
+            break;
+        case Algorithm::ShellSort:
+            if (m_shellSorter) {
+                pack(m_shellSorter->getState(), m_shellSorter->getCurrentIndex(),
+                     m_shellSorter->getCompareIndex(), m_shellSorter->getGap());
+            }
+            break;
+        case Algorithm::RadixSort:
+            if (m_radixSorter) {
+                pack(m_radixSorter->getState(), m_radixSorter->getCurrentIndex(),
+                     m_radixSorter->getWriteIndex(), m_radixSorter->getPass());
+            }
+            break;
+        case Algorithm::CountingSort:
+            if (m_countingSorter) {
+                pack(m_countingSorter->getState(), m_countingSorter->getCurrentIndex(),
+                     m_countingSorter->getWriteIndex(), -1);
+            }
+            break;
+        case Algorithm::IntroSort:
+            if (m_introSorter) {
+                // Heap fallback and insertion steps have no pivot
+                pack(m_introSorter->getState(), m_introSorter->getPivotIndex(),
+                     m_introSorter->getLeftIndex(), m_introSorter->getRightIndex());
+            }
+            break;
+        case Algorithm::ParallelMergeSort:
+            // Lane spans are too large for a cursor; only the level is recorded
+            if (m_parallelMergeSorter) {
+                pack(m_parallelMergeSorter->getState(), static_cast<int>(m_parallelMergeSorter->getWidth()),
+                     static_cast<int>(m_parallelMergeSorter->getDepth()),
+                     static_cast<int>(m_parallelMergeSorter->getLaneSpans().size()));
+            }
+            break;
+        case Algorithm::ParallelQuickSort:
+            if (m_parallelQuickSorter) {
+                pack(m_parallelQuickSorter->getState(), static_cast<int>(m_parallelQuickSorter->getPendingRanges()),
+                     static_cast<int>(m_parallelQuickSorter->getDepth()),
+                     static_cast<int>(m_parallelQuickSorter->getLaneSpans().size()));
             }
             break;
     }
+    return result;
+}
 
-    // Update visuals and colors
-    syncVisuals();
-    updateColors();
+const algorithms::StepCursor& SortingVisualizer::cursor() const {
+    return m_timeline.isActive() ? m_timeline.cursor() : m_liveCursor;
 }
 
-void SortingVisualizer::updateColors() {
-    // Reset all to base color
-    for (auto& elem : m_elements) {
-        elem.color = colors::semantic::elementBase;
-        elem.borderColor = colors::semantic::active;
-        elem.isSorted = false;
+bool SortingVisualizer::stepperComplete() const {
+    if (m_runUsesTrace) {
+        return m_trace && m_tracePlayer.isComplete();
     }
 
-    if (!m_isSorting) {
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort:    return m_bubbleSorter && m_bubbleSorter->isComplete();
+        case Algorithm::SelectionSort: return m_selectionSorter && m_selectionSorter->isComplete();
+        case Algorithm::InsertionSort: return m_insertionSorter && m_insertionSorter->isComplete();
+        case Algorithm::MergeSort:     return m_mergeSorter && m_mergeSorter->isComplete();
+        case Algorithm::QuickSort:     return m_quickSorter && m_quickSorter->isComplete();
+        case Algorithm::HeapSort:      return m_heapSorter && m_heapSorter->isComplete();
+        case Algorithm::ShellSort:     return m_shellSorter && m_shellSorter->isComplete();
+        case Algorithm::RadixSort:     return m_radixSorter && m_radixSorter->isComplete();
+        case Algorithm::CountingSort:  return m_countingSorter && m_countingSorter->isComplete();
+        case Algorithm::IntroSort:     return m_introSorter && m_introSorter->isComplete();
+        case Algorithm::ParallelMergeSort: return m_parallelMergeSorter && m_parallelMergeSorter->isComplete();
+        case Algorithm::ParallelQuickSort: return m_parallelQuickSorter && m_parallelQuickSorter->isComplete();
+    }
+    return false;
+}
+
+void SortingVisualizer::describeStep() {
+    const algorithms::StepCursor& c = cursor();
+    auto state = static_cast<algorithms::SortState>(c.state);
+    std::ostringstream oss;
+    int n = static_cast<int>(m_array.size());
+
+    if (m_runUsesTrace) {
+        if (c.first < 0 || c.first >= n || c.second >= n) {
+            return;
+        }
+
+        if (state == algorithms::SortState::Comparing) {
+            oss << "Comparing: arr[" << c.first << "]=" << m_array[c.first]
+                << " and arr[" << c.second << "]=" << m_array[c.second];
+        } else if (c.second >= 0) {
+            oss << "Swapping: arr[" << c.first << "] ↔ arr[" << c.second << "]";
+        } else {
+            oss << "Writing: arr[" << c.first << "] = " << m_array[c.first];
+        }
+
+        // The active range is only tracked live, not per recorded step
+        bool live = !m_timeline.isActive() || m_timeline.atFrontier();
+        if (live && m_tracePlayer.rangeEnd() > m_tracePlayer.rangeBegin()) {
+            oss << " in [" << m_tracePlayer.rangeBegin() << ", " << m_tracePlayer.rangeEnd() << ")";
+        }
+        m_statusText = oss.str();
         return;
     }
 
-    // Update colors based on current algorithm state
-    switch (m_currentAlgorithm) {
-        case Algorithm::BubbleSort:
-            if (m_bubbleSorter) {
-                int i = m_bubbleSorter->getIndexI();
-                int j = m_bubbleSorter->getIndexJ();
-                auto state = m_bubbleSorter->getState();
-
-                // Highlight elements being compared/swapped
-                if (j >= 0 && j < static_cast<int>(m_elements.size())) {
-                    if (state == algorithms::SortState::Comparing) {
-                        m_elements[j].color = colors::semantic::comparing;
-                        if (j + 1 < static_cast<int>(m_elements.size())) {
-                            m_elements[j + 1].color = colors::semantic::comparing;
-                        }
-                    } else if (state == algorithms::SortState::Swapping) {
-                        m_elements[j].color = colors::semantic::swapping;
-                        if (j + 1 < static_cast<int>(m_elements.size())) {
-                            m_elements[j + 1].color = colors::semantic::swapping;
-                        }
-                    }
-                }
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort: {
+            int j = c.first;
+            if (j < 0 || j + 1 >= n) break;
 
-                // Highlight sorted elements (at the end)
-                const auto& sortedIndices = m_bubbleSorter->getSortedIndices();
-                for (int idx : sortedIndices) {
-                    if (idx >= 0 && idx < static_cast<int>(m_elements.size())) {
-                        m_elements[idx].color = colors::semantic::sorted;
-                        m_elements[idx].isSorted = true;
-                    }
-                }
+            if (state == algorithms::SortState::Comparing) {
+                oss << "Comparing: arr[" << j << "]=" << m_array[j]
+                    << " and arr[" << (j+1) << "]=" << m_array[j+1];
+            } else if (state == algorithms::SortState::Swapping) {
+                oss << "Swapping: arr[" << j << "] ↔ arr[" << (j+1) << "]";
             }
             break;
+        }
 
         case Algorithm::SelectionSort:
-            if (m_selectionSorter) {
-                int current = m_selectionSorter->getCurrentIndex();
-                int minIdx = m_selectionSorter->getMinIndex();
-                int compareIdx = m_selectionSorter->getCompareIndex();
+            if (state == algorithms::SortState::Comparing) {
+                oss << "Finding minimum in unsorted portion. Current min index: " << c.second;
+            } else if (state == algorithms::SortState::Swapping) {
+                oss << "Swapping minimum to position " << c.first;
+            }
+            break;
 
-                // Highlight current minimum
-                if (minIdx >= 0 && minIdx < static_cast<int>(m_elements.size())) {
-                    m_elements[minIdx].color = colors::semantic::highlight;
-                }
+        case Algorithm::InsertionSort:
+            if (state == algorithms::SortState::Swapping) {
+                oss << "Inserting element at index " << c.first << " into sorted portion";
+            }
+            break;
 
-                // Highlight element being compared
-                if (compareIdx >= 0 && compareIdx < static_cast<int>(m_elements.size())) {
-                    m_elements[compareIdx].color = colors::semantic::comparing;
-                }
+        case Algorithm::MergeSort:
+            if (c.first >= 0) {
+                oss << "Merging [" << c.first << ".." << c.second << "] (yellow) with ["
+                    << (c.second + 1) << ".." << c.third << "] (orange)";
+            }
+            break;
 
-                // Highlight sorted elements
-                const auto& sortedIndices = m_selectionSorter->getSortedIndices();
-                for (int idx : sortedIndices) {
-                    if (idx >= 0 && idx < static_cast<int>(m_elements.size())) {
-                        m_elements[idx].color = colors::semantic::sorted;
-                        m_elements[idx].isSorted = true;
-                    }
-                }
+        case Algorithm::QuickSort:
+            if (c.first >= 0) {
+                oss << "Partitioning around pivot at index " << c.first;
             }
             break;
 
-        case Algorithm::InsertionSort:
-            if (m_insertionSorter) {
-                int current = m_insertionSorter->getCurrentIndex();
-                int compare = m_insertionSorter->getCompareIndex();
+        case Algorithm::HeapSort:
+            if (c.first >= 0) {
+                oss << "Sifting down from index " << c.first << " (heap size " << c.third << ")";
+            }
+            break;
 
-                // Highlight element being inserted
-                if (current >= 0 && current < static_cast<int>(m_elements.size())) {
-                    m_elements[current].color = colors::semantic::comparing;
-                }
+        case Algorithm::ShellSort:
+            if (c.second >= 0) {
+                oss << "Gap " << c.third << ": comparing arr[" << c.second
+                    << "] with the element headed for slot " << c.first;
+            }
+            break;
 
-                // Highlight comparison position
-                if (compare >= 0 && compare < static_cast<int>(m_elements.size())) {
-                    m_elements[compare].color = colors::semantic::swapping;
-                }
+        case Algorithm::RadixSort:
+            if (state == algorithms::SortState::Comparing && c.first >= 0) {
+                oss << "Byte " << c.third << ": counting the digit of arr[" << c.first << "]";
+            } else if (state == algorithms::SortState::Swapping && c.second >= 0) {
+                oss << "Byte " << c.third << ": writing arr[" << c.second << "] from its digit bucket";
+            }
+            break;
 
-                // Highlight sorted elements
-                const auto& sortedIndices = m_insertionSorter->getSortedIndices();
-                for (int idx : sortedIndices) {
-                    if (idx >= 0 && idx < static_cast<int>(m_elements.size())) {
-                        m_elements[idx].color = colors::semantic::sorted;
-                        m_elements[idx].isSorted = true;
-                    }
-                }
+        case Algorithm::CountingSort:
+            if (state == algorithms::SortState::Comparing && c.first >= 0) {
+                oss << "Counting occurrences: arr[" << c.first << "]";
+            } else if (state == algorithms::SortState::Swapping && c.second >= 0) {
+                oss << "Writing back in order: arr[" << c.second << "]";
+            }
+            break;
+
+        case Algorithm::IntroSort:
+            if (c.first >= 0) {
+                oss << "Median-of-three partition of [" << c.second << ".." << c.third
+                    << "], pivot lands at index " << c.first;
+            } else if (c.second >= 0 && c.third - c.second >= algorithms::IntroSortStepper::INSERTION_CUTOFF) {
+                // Insertions never move an element this far, so this was the heap fallback
+                oss << "Depth limit reached: heap sorted [" << c.second << ".." << c.third << "]";
+            } else if (c.second >= 0) {
+                oss << "Final insertion pass: moved arr[" << c.third << "] to index " << c.second;
+            }
+            break;
+
+        case Algorithm::ParallelMergeSort:
+            if (c.second > 0 && m_parallelMergeSorter) {
+                oss << "Level " << c.second << ": merged runs of " << (c.first / 2) << " into runs of "
+                    << c.first << " (" << c.third << " tasks over " << m_parallelMergeSorter->getLaneCount()
+                    << " lanes)";
             }
             break;
 
+        case Algorithm::ParallelQuickSort:
+            if (c.second > 0) {
+                oss << "Depth " << c.second << ": partitioned " << c.third << " ranges in parallel, "
+                    << c.first << " left to split";
+            }
+            break;
+    }
+
+    // Keep the previous message when the current state has nothing new to say
+    std::string text = oss.str();
+    if (!text.empty()) {
+        m_statusText = std::move(text);
+    }
+}
+
+const algorithms::SortedMarks* SortingVisualizer::sortedMarks() const {
+    if (m_runUsesTrace) {
+        return &m_tracePlayer.getSortedMarks();
+    }
+
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort:
+            return m_bubbleSorter ? &m_bubbleSorter->getSortedMarks() : nullptr;
+        case Algorithm::SelectionSort:
+            return m_selectionSorter ? &m_selectionSorter->getSortedMarks() : nullptr;
+        case Algorithm::InsertionSort:
+            return m_insertionSorter ? &m_insertionSorter->getSortedMarks() : nullptr;
         case Algorithm::MergeSort:
-            if (m_mergeSorter) {
-                int left = m_mergeSorter->getLeftIndex();
-                int mid = m_mergeSorter->getMidIndex();
-                int right = m_mergeSorter->getRightIndex();
+            return m_mergeSorter ? &m_mergeSorter->getSortedMarks() : nullptr;
+        case Algorithm::QuickSort:
+            return m_quickSorter ? &m_quickSorter->getSortedMarks() : nullptr;
+        case Algorithm::HeapSort:
+            return m_heapSorter ? &m_heapSorter->getSortedMarks() : nullptr;
+        case Algorithm::ShellSort:
+            return m_shellSorter ? &m_shellSorter->getSortedMarks() : nullptr;
+        case Algorithm::RadixSort:
+            return m_radixSorter ? &m_radixSorter->getSortedMarks() : nullptr;
+        case Algorithm::CountingSort:
+            return m_countingSorter ? &m_countingSorter->getSortedMarks() : nullptr;
+        case Algorithm::IntroSort:
+            return m_introSorter ? &m_introSorter->getSortedMarks() : nullptr;
+        case Algorithm::ParallelMergeSort:
+            return m_parallelMergeSorter ? &m_parallelMergeSorter->getSortedMarks() : nullptr;
+        case Algorithm::ParallelQuickSort:
+            return m_parallelQuickSorter ? &m_parallelQuickSorter->getSortedMarks() : nullptr;
+    }
+    return nullptr;
+}
 
-                // Highlight left subarray (being merged) - Yellow
-                for (int i = left; i >= 0 && i <= mid && i < static_cast<int>(m_elements.size()); ++i) {
-                    m_elements[i].color = colors::semantic::comparing;
-                }
+const std::vector<algorithms::LaneSpan>* SortingVisualizer::laneSpans() const {
+    if (m_runUsesTrace) {
+        return nullptr;
+    }
+    if (currentAlgorithm() == Algorithm::ParallelMergeSort && m_parallelMergeSorter) {
+        return &m_parallelMergeSorter->getLaneSpans();
+    }
+    if (currentAlgorithm() == Algorithm::ParallelQuickSort && m_parallelQuickSorter) {
+        return &m_parallelQuickSorter->getLaneSpans();
+    }
+    return nullptr;
+}
 
-                // Highlight right subarray (being merged) - Peach/Orange
-                for (int i = mid + 1; i >= 0 && i <= right && i < static_cast<int>(m_elements.size()); ++i) {
-                    m_elements[i].color = colors::semantic::swapping;
-                }
+const std::vector<size_t>* SortingVisualizer::laneWork() const {
+    if (m_runUsesTrace) {
+        return nullptr;
+    }
+    if (currentAlgorithm() == Algorithm::ParallelMergeSort && m_parallelMergeSorter) {
+        return &m_parallelMergeSorter->getLaneWork();
+    }
+    if (currentAlgorithm() == Algorithm::ParallelQuickSort && m_parallelQuickSorter) {
+        return &m_parallelQuickSorter->getLaneWork();
+    }
+    return nullptr;
+}
 
-                // Highlight sorted elements - Green
-                const auto& sortedIndices = m_mergeSorter->getSortedIndices();
-                for (int idx : sortedIndices) {
-                    if (idx >= 0 && idx < static_cast<int>(m_elements.size())) {
-                        m_elements[idx].color = colors::semantic::sorted;
-                        m_elements[idx].isSorted = true;
-                    }
-                }
+void SortingVisualizer::updateColors() {
+    // Recorded runs answer from the timeline so seeking shows the marks of that step
+    bool recorded = m_timeline.isActive();
+    const algorithms::SortedMarks* marks = (m_isSorting && !recorded) ? sortedMarks() : nullptr;
+
+    // Single pass: sorted elements get their final state, the rest reset to base
+    for (size_t idx = 0; idx < m_barStates.size(); ++idx) {
+        bool sorted = m_isSorting && (recorded ? m_timeline.isSorted(idx) : (marks && marks->isSorted(idx)));
+        m_barStates[idx] = sorted ? BarState::Sorted : BarState::Base;
+    }
+    m_barsDirty = true;
+
+    if (!m_isSorting) {
+        return;
+    }
+
+    // Highlight an active element (sorted elements keep their state)
+    auto highlight = [this](int idx, BarState state) {
+        if (idx >= 0 && idx < static_cast<int>(m_barStates.size()) && m_barStates[idx] != BarState::Sorted) {
+            m_barStates[idx] = state;
+        }
+    };
+
+    // Update colors based on the shown step's cursor (see captureCursor)
+    const algorithms::StepCursor& c = cursor();
+    auto state = static_cast<algorithms::SortState>(c.state);
+
+    if (m_runUsesTrace) {
+        BarState active = (state == algorithms::SortState::Comparing) ? BarState::Comparing : BarState::Swapping;
+        highlight(c.first, active);
+        highlight(c.second, active);
+        return;
+    }
+
+    switch (currentAlgorithm()) {
+        case Algorithm::BubbleSort:
+            // Highlight elements being compared/swapped
+            if (state == algorithms::SortState::Comparing) {
+                highlight(c.first, BarState::Comparing);
+                highlight(c.first + 1, BarState::Comparing);
+            } else if (state == algorithms::SortState::Swapping) {
+                highlight(c.first, BarState::Swapping);
+                highlight(c.first + 1, BarState::Swapping);
             }
             break;
 
-        case Algorithm::QuickSort:
-            if (m_quickSorter) {
-                int pivot = m_quickSorter->getPivotIndex();
-                int left = m_quickSorter->getLeftIndex();
-                int right = m_quickSorter->getRightIndex();
+        case Algorithm::SelectionSort:
+            // Highlight current minimum and element being compared
+            highlight(c.second, BarState::Highlight);
+            highlight(c.third, BarState::Comparing);
+            break;
 
-                // Highlight pivot
-                if (pivot >= 0 && pivot < static_cast<int>(m_elements.size())) {
-                    m_elements[pivot].color = colors::semantic::highlight;
-                }
+        case Algorithm::InsertionSort:
+            // Highlight element being inserted and comparison position
+            highlight(c.first, BarState::Comparing);
+            highlight(c.second, BarState::Swapping);
+            break;
 
-                // Highlight elements being compared
-                if (left >= 0 && left < static_cast<int>(m_elements.size())) {
-                    m_elements[left].color = colors::semantic::comparing;
-                }
-                if (right >= 0 && right < static_cast<int>(m_elements.size()) && right != pivot) {
-                    m_elements[right].color = colors::semantic::comparing;
-                }
+        case Algorithm::MergeSort: {
+            int left = c.first;
+            int mid = c.second;
+            int right = c.third;
+
+            // Highlight left subarray (being merged) - Yellow
+            for (int i = std::max(left, 0); i <= mid; ++i) {
+                highlight(i, BarState::Comparing);
+            }
 
-                // Highlight sorted elements
-                const auto& sortedIndices = m_quickSorter->getSortedIndices();
-                for (int idx : sortedIndices) {
-                    if (idx >= 0 && idx < static_cast<int>(m_elements.size())) {
-                        m_elements[idx].color = colors::semantic::sorted;
-                        m_elements[idx].isSorted = true;
+            // Highlight right subarray (being merged) - Peach/Orange
+            for (int i = std::max(mid + 1, 0); i <= right; ++i) {
+                highlight(i, BarState::Swapping);
+            }
+            break;
+        }
+
+        case Algorithm::QuickSort: {
+            int pivot = c.first;
+            int right = c.third;
+
+            // Highlight pivot and elements being compared
+            highlight(pivot, BarState::Highlight);
+            highlight(c.second, BarState::Comparing);
+            if (right != pivot) {
+                highlight(right, BarState::Comparing);
+            }
+            break;
+        }
+
+        case Algorithm::HeapSort: {
+            // Highlight the node being sifted and the child it was compared with
+            BarState active = (state == algorithms::SortState::Swapping) ? BarState::Swapping : BarState::Comparing;
+            highlight(c.first, BarState::Highlight);
+            highlight(c.second, active);
+            break;
+        }
+
+        case Algorithm::ShellSort:
+            // Highlight the key's slot and the element one gap below it
+            highlight(c.first, BarState::Swapping);
+            highlight(c.second, BarState::Comparing);
+            break;
+
+        case Algorithm::RadixSort:
+        case Algorithm::CountingSort:
+            // Highlight the element being counted, or the slot being written
+            if (state == algorithms::SortState::Comparing) {
+                highlight(c.first, BarState::Comparing);
+            } else {
+                highlight(c.second, BarState::Swapping);
+            }
+            break;
+
+        case Algorithm::IntroSort:
+            // Highlight the pivot and the bounds of the range just processed
+            highlight(c.first, BarState::Highlight);
+            highlight(c.second, BarState::Comparing);
+            highlight(c.third, BarState::Comparing);
+            break;
+
+        case Algorithm::ParallelMergeSort:
+        case Algorithm::ParallelQuickSort: {
+            // Color each range by the lane that processed it; spans are only kept for the live step
+            const std::vector<algorithms::LaneSpan>* spans = laneSpans();
+            if (spans && (!recorded || m_timeline.atFrontier())) {
+                for (const algorithms::LaneSpan& span : *spans) {
+                    for (size_t i = span.begin; i < span.end; ++i) {
+                        highlight(static_cast<int>(i), laneBarState(span.lane));
                     }
                 }
             }
             break;
+        }
     }
 }
 
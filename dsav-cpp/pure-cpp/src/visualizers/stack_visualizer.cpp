@@ -5,6 +5,9 @@
 
 #include "visualizers/stack_visualizer.hpp"
 #include "ui_components.hpp"
+#include "algorithms/snapshot.hpp"
+#include "algorithms/workload_targets.hpp"
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <random>
@@ -13,18 +16,39 @@
 namespace dsav {
 
 StackVisualizer::StackVisualizer(size_t maxSize)
-    : m_statusText("Stack is empty") {
-    (void)maxSize;  // Unused for now, stack has fixed size
+    : m_stack(maxSize), m_statusText("Stack is empty") {
+    m_stack.enableEventRecording();
+    m_animator.bindContainer(m_elements);
     syncVisuals();
+
+    algorithms::WorkloadHooks hooks;
+    hooks.apply = [this](const algorithms::WorkloadOp& op) { return algorithms::applyStackOp(m_stack, op); };
+    hooks.capture = [this](algorithms::WorkloadKeyframe& keyframe) {
+        keyframe.elements.assign(m_stack.data(), m_stack.data() + m_stack.size());
+    };
+    hooks.restore = [this](const algorithms::WorkloadKeyframe& keyframe) {
+        m_stack.assign(keyframe.elements.data(), keyframe.elements.size());
+    };
+    m_workload.setHooks(std::move(hooks));
 }
 
 void StackVisualizer::update(float deltaTime) {
     // Update animations
     m_animator.update(deltaTime);
+    m_growthFlash = std::max(0.0f, m_growthFlash - deltaTime * m_speed);
+
+    // A playing replay moves on once the last sampled op has finished animating
+    if (m_workload.isPlaying() && !isAnimating()) {
+        if (m_workload.advance([this](const algorithms::WorkloadOp& op) { animateWorkloadOp(op); })) {
+            syncWorkload();
+        }
+    }
 
     // Update status if not animating
     if (!isAnimating()) {
-        if (m_stack.isEmpty()) {
+        if (m_workload.replay().isActive()) {
+            m_statusText = m_workload.statusText();
+        } else if (m_stack.isEmpty()) {
             m_statusText = "Stack is empty";
         } else {
             std::ostringstream oss;
@@ -174,8 +198,17 @@ void StackVisualizer::renderVisualization() {
         );
     };
 
+    // Only the slots that overlap the canvas are drawn; index 0 sits at the bottom
+    CanvasViewport viewport(canvasPos, canvasSize, m_zoomLevel);
+    IndexRange visible = viewport.visibleRows(
+        toScreenPos(calculatePosition(0), scaledElementHeight).y,
+        -(ELEMENT_HEIGHT + ELEMENT_SPACING) * m_zoomLevel,
+        scaledElementHeight,
+        m_stack.capacity()
+    );
+
     // Draw capacity indicator (ghost boxes showing max capacity)
-    for (size_t i = 0; i < m_stack.capacity(); ++i) {
+    for (size_t i = visible.first; i < visible.last; ++i) {
         glm::vec2 localPos = calculatePosition(i);
         ImVec2 screenPos = toScreenPos(localPos, scaledElementHeight);
 
@@ -186,18 +219,25 @@ void StackVisualizer::renderVisualization() {
         ghost.borderColor = colors::withAlpha(colors::mocha::overlay0, 0.5f);
         ghost.borderWidth = 1.0f;
 
-        renderElement(drawList, ghost);
+        // Slots added by the last growth glow and fade back to ghosts
+        if (m_growthFlash > 0.0f && i >= m_newSlotsFrom) {
+            float t = m_growthFlash / GROWTH_FLASH_SECONDS;
+            ghost.color = colors::withAlpha(colors::semantic::highlight, 0.3f + 0.4f * t);
+            ghost.borderColor = colors::semantic::highlight;
+        }
+
+        renderElement(drawList, ghost, ImVec2(0, 0), viewport.detail());
     }
 
     // Draw actual stack elements with zoom
-    for (size_t i = 0; i < m_elements.size(); ++i) {
+    for (size_t i = visible.first; i < std::min(visible.last, m_elements.size()); ++i) {
         glm::vec2 localPos = calculatePosition(i);
         ImVec2 screenPos = toScreenPos(localPos, scaledElementHeight);
 
         VisualElement renderElem = m_elements[i];
         renderElem.position = glm::vec2(screenPos.x, screenPos.y);
         renderElem.size = glm::vec2(scaledElementWidth, scaledElementHeight);
-        renderElement(drawList, renderElem);
+        renderElement(drawList, renderElem, ImVec2(0, 0), viewport.detail());
     }
 
     // Draw "TOP" label
@@ -260,7 +300,7 @@ void StackVisualizer::renderControls() {
     ImGui::InputInt("Value", &m_inputValue);
     ImGui::PopItemWidth();
 
-    ImGui::BeginDisabled(m_stack.isFull() || isAnimating());
+    ImGui::BeginDisabled(m_stack.isFull() || isAnimating() || m_workload.isPlaying());
     if (ui::ButtonSuccess("Push", ImVec2(100, 0))) {
         pushValue(m_inputValue);
     }
@@ -269,14 +309,14 @@ void StackVisualizer::renderControls() {
 
     ImGui::SameLine();
 
-    ImGui::BeginDisabled(m_stack.isEmpty() || isAnimating());
+    ImGui::BeginDisabled(m_stack.isEmpty() || isAnimating() || m_workload.isPlaying());
     if (ui::ButtonDanger("Pop", ImVec2(100, 0))) {
         popValue();
     }
     ImGui::EndDisabled();
     ui::Tooltip("Remove element from top of stack");
 
-    ImGui::BeginDisabled(m_stack.isEmpty() || isAnimating());
+    ImGui::BeginDisabled(m_stack.isEmpty() || isAnimating() || m_workload.isPlaying());
     if (ImGui::Button("Peek", ImVec2(100, 0))) {
         peekValue();
     }
@@ -292,17 +332,24 @@ void StackVisualizer::renderControls() {
     ImGui::PushItemWidth(150.0f);
     ImGui::InputInt("Count", &m_initCount);
     if (m_initCount < 1) m_initCount = 1;
-    if (m_initCount > static_cast<int>(m_stack.capacity())) {
-        m_initCount = static_cast<int>(m_stack.capacity());
-    }
+    if (m_initCount > MAX_INIT_COUNT) m_initCount = MAX_INIT_COUNT;
     ImGui::PopItemWidth();
 
-    ImGui::BeginDisabled(isAnimating());
+    ImGui::BeginDisabled(isAnimating() || m_workload.isPlaying());
     if (ui::ButtonPrimary("Initialize Random", ImVec2(200, 0))) {
         initializeRandom(static_cast<size_t>(m_initCount));
     }
     ImGui::EndDisabled();
-    ui::Tooltip("Fill stack with random values (clears existing stack)");
+    ui::Tooltip("Fill stack with random values (clears existing stack and starts from the minimum capacity)");
+
+    ImGui::Separator();
+
+    // Workload replay: insert pushes, remove pops, search peeks
+    if (ImGui::CollapsingHeader("Workload Replay")) {
+        if (m_workload.render()) {
+            syncWorkload();
+        }
+    }
 
     ImGui::Separator();
 
@@ -327,6 +374,8 @@ void StackVisualizer::renderControls() {
         static_cast<float>(m_stack.size()) / static_cast<float>(m_stack.capacity()),
         ImVec2(-1, 0)
     );
+    ImGui::Text("Reallocations: %zu", m_stack.reallocations());
+    ui::Tooltip("Pushing onto a full stack doubles its buffer; popping it down to a quarter halves it");
 
     ImGui::End();
 }
@@ -355,17 +404,19 @@ void StackVisualizer::pushValue(int value) {
     newElem.size = glm::vec2(ELEMENT_WIDTH, ELEMENT_HEIGHT);
     newElem.color = colors::semantic::elementBase;
     newElem.borderColor = colors::semantic::active;
-    newElem.label = std::to_string(value);
-    newElem.sublabel = "[" + std::to_string(newIndex) + "]";
+    newElem.label = labels::fromInt(value);
+    newElem.sublabel = labels::fromIndex(newIndex);
 
     m_elements.push_back(newElem);
 
     // Animate: Drop down from top
     auto& elem = m_elements.back();
     Animation dropAnim = createMoveAnimation(elem.position, targetPos, 0.4f);
-    dropAnim.easingFn = easing::easeOutBounce;
+    dropAnim.easing = Easing::EaseOutBounce;
     m_animator.enqueue(dropAnim);
 
+    animateCapacityEvents();
+
     // Flash color to indicate success
     Animation flashGreen = createColorAnimation(elem.color, colors::semantic::sorted, 0.2f);
     m_animator.enqueue(flashGreen);
@@ -406,7 +457,7 @@ void StackVisualizer::popValue() {
         glm::vec2(elem.position.x, -100.0f),
         0.4f
     );
-    slideUp.easingFn = easing::easeIn;
+    slideUp.easing = Easing::EaseIn;
     slideUp.onComplete = [this, value]() {
         // Remove visual element
         if (!m_elements.empty()) {
@@ -421,6 +472,7 @@ void StackVisualizer::popValue() {
 
     // Pop from actual stack
     m_stack.pop();
+    animateCapacityEvents();
 }
 
 void StackVisualizer::peekValue() {
@@ -445,15 +497,15 @@ void StackVisualizer::peekValue() {
 }
 
 void StackVisualizer::initializeRandom(size_t count) {
-    // Clear existing stack
+    // Clear existing stack, releasing the buffer so the fill shows its growth
+    m_workload.stop();
     m_stack.clear();
+    m_stack.shrinkToFit();
     m_elements.clear();
     m_animator.clear();
 
-    // Clamp count to capacity
-    if (count > m_stack.capacity()) {
-        count = m_stack.capacity();
-    }
+    count = std::min(count, static_cast<size_t>(MAX_INIT_COUNT));
+    size_t reallocationsBefore = m_stack.reallocations();
 
     // Update status
     std::ostringstream oss;
@@ -469,20 +521,24 @@ void StackVisualizer::initializeRandom(size_t count) {
     for (size_t i = 0; i < count; ++i) {
         m_stack.push(dis(gen));
     }
+    size_t grown = m_stack.reallocations() - reallocationsBefore;
+    skipCapacityEvents();
 
     // Sync visuals
     syncVisuals();
 
-    // Animate each element appearing with a cascade effect from bottom to top
-    for (size_t i = 0; i < m_elements.size(); ++i) {
+    // Animate the top elements appearing with a cascade effect from bottom to top
+    size_t cascadeStart = m_elements.size() - std::min(m_elements.size(), MAX_CASCADE);
+    for (size_t i = cascadeStart; i < m_elements.size(); ++i) {
         auto& elem = m_elements[i];
 
         // Flash to show appearance
         Animation fadeIn = createColorAnimation(elem.color, colors::semantic::elementBase, 0.15f);
         if (i == m_elements.size() - 1) {
-            fadeIn.onComplete = [this, count]() {
+            fadeIn.onComplete = [this, count, grown]() {
                 std::ostringstream oss;
-                oss << "Initialized stack with " << count << " random elements";
+                oss << "Initialized stack with " << count << " random elements ("
+                    << grown << " reallocation(s), capacity " << m_stack.capacity() << ")";
                 m_statusText = oss.str();
             };
         }
@@ -510,13 +566,81 @@ void StackVisualizer::step() {
 }
 
 void StackVisualizer::reset() {
+    m_workload.stop();
     m_stack.clear();
+    m_stack.shrinkToFit();
+    skipCapacityEvents();
+    m_growthFlash = 0.0f;
     m_elements.clear();
     m_animator.clear();
     m_statusText = "Stack reset";
     m_isPaused = true;
 }
 
+bool StackVisualizer::saveSnapshot(const std::string& path) {
+    std::string error;
+    if (!algorithms::writeSnapshot(path, algorithms::SnapshotKind::Stack, m_stack.data(), m_stack.size(),
+                                   nullptr, error)) {
+        m_statusText = "Save failed: " + error;
+        return false;
+    }
+    m_statusText = "Saved " + std::to_string(m_stack.size()) + " elements to " + path;
+    return true;
+}
+
+bool StackVisualizer::loadSnapshot(const std::string& path) {
+    algorithms::SnapshotReader reader;
+    std::vector<int> values;
+    if (!reader.open(path) || !reader.expect(algorithms::SnapshotKind::Stack)) {
+        m_statusText = "Load failed: " + reader.error();
+        return false;
+    }
+    reader.readElements(values);
+
+    m_workload.stop();
+    m_animator.clear();
+    m_elements.clear();
+    m_growthFlash = 0.0f;
+    m_stack.assign(values.data(), values.size());
+    skipCapacityEvents();
+    syncVisuals();
+
+    m_cameraOffsetY = 0.0f;
+    m_zoomLevel = 1.0f;
+    m_statusText = "Loaded " + std::to_string(m_stack.size()) + " elements from " + path;
+    m_isPaused = true;
+    return true;
+}
+
+bool StackVisualizer::stepBack() {
+    size_t position = m_workload.replay().position();
+    return position > 0 && seek(position - 1);
+}
+
+bool StackVisualizer::seek(size_t step) {
+    if (!m_workload.seek(step)) {
+        return false;
+    }
+    syncWorkload();
+    m_statusText = m_workload.statusText();
+    return true;
+}
+
+void StackVisualizer::animateWorkloadOp(const algorithms::WorkloadOp& op) {
+    switch (op.code) {
+        case algorithms::WorkloadOpCode::Insert: pushValue(op.operand); break;
+        case algorithms::WorkloadOpCode::Remove: popValue(); break;
+        case algorithms::WorkloadOpCode::Search: peekValue(); break;
+    }
+}
+
+void StackVisualizer::syncWorkload() {
+    m_animator.clear();
+    m_growthFlash = 0.0f;
+    skipCapacityEvents();
+    syncVisuals();
+}
+
 void StackVisualizer::setSpeed(float speed) {
     m_speed = speed;
     m_animator.setSpeedMultiplier(speed);
@@ -545,13 +669,61 @@ void StackVisualizer::syncVisuals() {
         elem.borderColor = (i == m_stack.size() - 1)
             ? colors::semantic::active
             : colors::semantic::elementBorder;
-        elem.label = std::to_string(m_stack.at(i));
-        elem.sublabel = "[" + std::to_string(i) + "]";
+        elem.label = labels::fromInt(m_stack.at(i));
+        elem.sublabel = labels::fromIndex(i);
 
         m_elements.push_back(elem);
     }
 }
 
+size_t StackVisualizer::animateCapacityEvents() {
+    const auto& events = m_stack.events();
+    std::uint64_t first = std::max(m_eventCursor, events.beginSequence());
+    size_t count = static_cast<size_t>(events.endSequence() - first);
+
+    for (std::uint64_t seq = first; seq < events.endSequence(); ++seq) {
+        const CapacityEvent& event = events[static_cast<size_t>(seq - events.beginSequence())];
+
+        std::ostringstream oss;
+        if (event.type == CapacityEventType::Grow) {
+            oss << "Stack full: grew " << event.oldCapacity << " -> " << event.newCapacity
+                << " slots, copied " << event.size << " element(s)";
+            m_newSlotsFrom = event.oldCapacity;
+            m_growthFlash = GROWTH_FLASH_SECONDS;
+        } else {
+            oss << "Stack a quarter full: shrank " << event.oldCapacity << " -> "
+                << event.newCapacity << " slots, copied " << event.size << " element(s)";
+            m_growthFlash = 0.0f;
+        }
+        std::string status = oss.str();
+
+        // Every element that was moved to the new buffer flashes together
+        std::vector<Animation> copied;
+        std::vector<Animation> restored;
+        size_t moved = std::min(event.size, m_elements.size());
+        for (size_t i = moved - std::min(moved, MAX_CASCADE); i < moved; ++i) {
+            copied.push_back(createColorAnimation(m_elements[i].color, colors::semantic::highlight, 0.2f));
+            restored.push_back(createColorAnimation(m_elements[i].color, colors::semantic::elementBase, 0.2f));
+        }
+        if (copied.empty()) {
+            m_statusText = status;
+            continue;
+        }
+        copied.front().onComplete = [this, status]() {
+            m_statusText = status;
+        };
+        m_animator.enqueueParallel(std::move(copied));
+        m_animator.enqueueParallel(std::move(restored));
+    }
+
+    m_eventCursor = events.endSequence();
+    return count;
+}
+
+void StackVisualizer::skipCapacityEvents() {
+    m_eventCursor = m_stack.events().endSequence();
+}
+
 glm::vec2 StackVisualizer::calculatePosition(size_t index) const {
     // Stack grows upward from bottom (index 0 at y=0)
     // Higher indices have larger y values (we'll flip this when rendering)
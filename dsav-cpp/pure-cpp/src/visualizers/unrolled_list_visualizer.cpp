@@ -0,0 +1,744 @@
+/**
+ * @file unrolled_list_visualizer.cpp
+ * @brief Implementation of Unrolled Linked List visualizer
+ */
+
+#include "visualizers/unrolled_list_visualizer.hpp"
+#include "ui_components.hpp"
+#include <sstream>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+namespace dsav {
+
+UnrolledListVisualizer::UnrolledListVisualizer()
+    : m_statusText("Unrolled list is empty") {
+    m_animator.bindContainer(m_slots);
+
+    // Initialize with a few elements for demonstration
+    for (int value : {10, 20, 30, 40, 50, 60}) {
+        m_list.insertBack(value);
+        m_linked.insertBack(value);
+    }
+    syncVisuals();
+}
+
+void UnrolledListVisualizer::update(float deltaTime) {
+    // Update animations
+    m_animator.update(deltaTime);
+
+    // Update status if not animating
+    if (!isAnimating()) {
+        if (m_list.isEmpty()) {
+            m_statusText = "Unrolled list is empty";
+        } else {
+            std::ostringstream oss;
+            oss << "List has " << m_list.size() << " element(s) in "
+                << m_list.nodeCount() << " node(s)";
+            m_statusText = oss.str();
+        }
+    }
+}
+
+void UnrolledListVisualizer::renderVisualization() {
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 canvasPos = ImGui::GetCursorScreenPos();
+    ImVec2 canvasSize = ImGui::GetContentRegionAvail();
+
+    // Whole canvas is the drag/zoom surface
+    ImGui::InvisibleButton("unrolled_canvas", ImVec2(std::max(canvasSize.x, 1.0f), std::max(canvasSize.y, 1.0f)));
+    bool isHovered = ImGui::IsItemHovered();
+    bool isActive = ImGui::IsItemActive();
+
+    // Handle mouse drag for panning
+    if (isActive && ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+        if (!m_isDragging) {
+            m_isDragging = true;
+            m_lastMousePos = ImGui::GetMousePos();
+        } else {
+            ImVec2 currentMousePos = ImGui::GetMousePos();
+            m_cameraOffsetX += currentMousePos.x - m_lastMousePos.x;
+            m_lastMousePos = currentMousePos;
+        }
+    } else {
+        m_isDragging = false;
+    }
+
+    // Handle mouse wheel
+    if (isHovered) {
+        float wheel = ImGui::GetIO().MouseWheel;
+        if (wheel != 0.0f) {
+            if (ImGui::GetIO().KeyCtrl) {
+                // Zoom toward the mouse position
+                float oldZoom = m_zoomLevel;
+                m_zoomLevel = std::clamp(m_zoomLevel + wheel * 0.1f, 0.3f, 3.0f);
+                float mouseRelativeX = ImGui::GetMousePos().x - canvasPos.x;
+                float zoomRatio = m_zoomLevel / oldZoom;
+                m_cameraOffsetX = mouseRelativeX - (mouseRelativeX - m_cameraOffsetX) * zoomRatio;
+            } else {
+                // Regular horizontal scrolling
+                m_cameraOffsetX += wheel * 50.0f;
+            }
+        }
+    }
+
+    float zoom = m_zoomLevel;
+    float chunkWidth = NODE_CAP * SLOT_WIDTH + 2.0f * CHUNK_PADDING;
+    float chunkHeight = SLOT_HEIGHT + 2.0f * CHUNK_PADDING;
+
+    // Clamp camera offset so the list can't be scrolled fully off-canvas
+    float totalWidth = (START_X + m_chunks.size() * (chunkWidth + CHUNK_GAP)) * zoom;
+    m_cameraOffsetX = std::clamp(m_cameraOffsetX, std::min(0.0f, canvasSize.x - totalWidth - 100.0f), 0.0f);
+
+    auto toScreen = [&](const glm::vec2& world) {
+        return ImVec2(canvasPos.x + m_cameraOffsetX + world.x * zoom, canvasPos.y + world.y * zoom);
+    };
+
+    CanvasViewport viewport(canvasPos, canvasSize, zoom);
+    ImU32 arrowColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::blue));
+    ImU32 frameColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::surface0));
+    ImU32 frameBorder = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0));
+    ImU32 captionColor = ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::subtext0));
+
+    // Slots the current animation step touches are drawn live; the rest is cached
+    size_t animatedCount = m_animator.markAnimated(m_slots, m_animatedScratch);
+    if (m_animatedScratch != m_animatedSlots) {
+        m_animatedSlots.swap(m_animatedScratch);
+        m_sceneVersion++;
+    }
+
+    auto drawSlot = [&](const ImVec2& frameMin, size_t index, size_t i) {
+        const VisualSlot& slot = m_slots[index];
+        VisualElement elem;
+        elem.position = glm::vec2(frameMin.x + (CHUNK_PADDING + i * SLOT_WIDTH) * zoom,
+                                  frameMin.y + CHUNK_PADDING * zoom);
+        elem.size = glm::vec2(SLOT_WIDTH * zoom, SLOT_HEIGHT * zoom);
+        elem.color = slot.color;
+        elem.borderColor = slot.borderColor;
+        elem.borderWidth = slot.isLive ? 2.0f : 1.0f;
+        elem.cornerRadius = 4.0f;
+        elem.label = slot.label;
+        renderElement(drawList, elem, ImVec2(0, 0), viewport.detail());
+    };
+
+    CanvasCacheKey cacheKey;
+    cacheKey.sceneVersion = m_sceneVersion;
+    cacheKey.zoom = zoom;
+    cacheKey.offsetX = m_cameraOffsetX;
+
+    if (m_canvasCache.beginStatic(drawList, canvasPos, canvasSize, cacheKey)) {
+        // Background
+        drawList->AddRectFilled(
+            canvasPos,
+            ImVec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y),
+            ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::mantle))
+        );
+
+        // Draw "HEAD →" indicator
+        if (!m_chunks.empty()) {
+            ImVec2 first = toScreen(m_chunks.front().position);
+            drawList->AddText(
+                ImVec2(first.x - 60.0f, first.y + chunkHeight * zoom / 2.0f - 8.0f),
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::green)),
+                "HEAD →"
+            );
+        }
+
+        for (size_t c = 0; c < m_chunks.size(); ++c) {
+            const VisualChunk& chunk = m_chunks[c];
+            ImVec2 frameMin = toScreen(chunk.position);
+            ImVec2 frameMax = ImVec2(frameMin.x + chunkWidth * zoom, frameMin.y + chunkHeight * zoom);
+
+            // Arrow to the next node, or NULL after the last one
+            ImVec2 arrowStart = ImVec2(frameMax.x, frameMin.y + chunkHeight * zoom / 2.0f);
+            ImVec2 arrowEnd = ImVec2(arrowStart.x + (CHUNK_GAP - 8.0f) * zoom, arrowStart.y);
+            if (viewport.isSegmentVisible(arrowStart, arrowEnd)) {
+                if (c + 1 < m_chunks.size()) {
+                    if (viewport.isFullDetail()) {
+                        drawArrow(drawList, arrowStart, arrowEnd, arrowColor);
+                    } else {
+                        drawList->AddLine(arrowStart, arrowEnd, arrowColor, 2.0f);
+                    }
+                } else {
+                    drawList->AddText(ImVec2(arrowStart.x + 10.0f, arrowStart.y - 8.0f), frameBorder, "NULL");
+                }
+            }
+
+            if (!viewport.isRectVisible(frameMin, ImVec2(frameMax.x, frameMax.y + 24.0f * zoom))) {
+                continue;
+            }
+
+            // Node frame around its resting slots
+            drawList->AddRectFilled(frameMin, frameMax, frameColor, 6.0f * zoom);
+            drawList->AddRect(frameMin, frameMax, frameBorder, 6.0f * zoom, 0, 1.5f);
+
+            for (size_t i = 0; i < NODE_CAP; ++i) {
+                if (!m_animatedSlots[chunk.firstSlot + i]) {
+                    drawSlot(frameMin, chunk.firstSlot + i, i);
+                }
+            }
+
+            // Fill caption under the node
+            if (viewport.isFullDetail()) {
+                ImVec2 captionSize = labels::textSize(chunk.fillLabel);
+                labels::draw(drawList,
+                             ImVec2((frameMin.x + frameMax.x - captionSize.x) / 2.0f, frameMax.y + 4.0f),
+                             captionColor, chunk.fillLabel);
+            }
+        }
+
+        // Draw info text if empty
+        if (m_list.isEmpty()) {
+            ImVec2 textPos = ImVec2(
+                canvasPos.x + canvasSize.x / 2.0f - 140.0f,
+                canvasPos.y + canvasSize.y / 2.0f
+            );
+            drawList->AddText(
+                textPos,
+                ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay1)),
+                "Unrolled list is empty. Use Insert to add elements."
+            );
+        }
+    }
+    m_canvasCache.endStatic(drawList);
+
+    // Animating slots on top
+    if (animatedCount > 0) {
+        for (const VisualChunk& chunk : m_chunks) {
+            ImVec2 frameMin = toScreen(chunk.position);
+            ImVec2 frameMax = ImVec2(frameMin.x + chunkWidth * zoom, frameMin.y + chunkHeight * zoom);
+            if (!viewport.isRectVisible(frameMin, frameMax)) {
+                continue;
+            }
+            for (size_t i = 0; i < NODE_CAP; ++i) {
+                if (m_animatedSlots[chunk.firstSlot + i]) {
+                    drawSlot(frameMin, chunk.firstSlot + i, i);
+                }
+            }
+        }
+    }
+
+    if (m_list.isEmpty()) {
+        return;
+    }
+
+    // Show interaction hints
+    std::string hintText = "Drag to pan | Scroll to move | Ctrl+Scroll to zoom";
+    if (m_zoomLevel != 1.0f) {
+        hintText += " (Zoom: " + std::to_string(static_cast<int>(m_zoomLevel * 100)) + "%)";
+    }
+    ImVec2 hintSize = ImGui::CalcTextSize(hintText.c_str());
+    drawList->AddText(
+        ImVec2(canvasPos.x + canvasSize.x - hintSize.x - 10.0f, canvasPos.y + 10.0f),
+        ImGui::ColorConvertFloat4ToU32(colors::toImGui(colors::mocha::overlay0)),
+        hintText.c_str()
+    );
+}
+
+void UnrolledListVisualizer::renderControls() {
+    ImGui::Begin("Unrolled Linked List Controls");
+
+    // Status
+    ui::StatusText(m_statusText.c_str(), "info");
+    ImGui::Separator();
+
+    // Operation mode selection
+    ImGui::Text("Operation Mode:");
+    const char* modes[] = {
+        "Insert Front",
+        "Insert Back",
+        "Insert At",
+        "Delete Front",
+        "Delete Back",
+        "Delete At",
+        "Search"
+    };
+    int currentModeIdx = static_cast<int>(m_currentMode);
+    if (ImGui::Combo("##Mode", &currentModeIdx, modes, IM_ARRAYSIZE(modes))) {
+        m_currentMode = static_cast<OperationMode>(currentModeIdx);
+    }
+
+    ImGui::Separator();
+
+    // Input fields
+    ImGui::Text("Parameters:");
+    ImGui::PushItemWidth(150.0f);
+
+    if (m_currentMode == OperationMode::InsertFront ||
+        m_currentMode == OperationMode::InsertBack ||
+        m_currentMode == OperationMode::InsertAt ||
+        m_currentMode == OperationMode::Search) {
+        ImGui::InputInt("Value", &m_inputValue);
+    }
+
+    if (m_currentMode == OperationMode::InsertAt ||
+        m_currentMode == OperationMode::DeleteAt) {
+        ImGui::InputInt("Index", &m_inputIndex);
+        if (m_inputIndex < 0) m_inputIndex = 0;
+    }
+
+    ImGui::PopItemWidth();
+
+    ImGui::Spacing();
+
+    // Execute button
+    ImGui::BeginDisabled(isAnimating());
+
+    size_t index = static_cast<size_t>(m_inputIndex);
+    bool canExecute = true;
+    const char* buttonLabel = "Execute";
+    const char* tooltipText = "";
+
+    switch (m_currentMode) {
+        case OperationMode::InsertFront:
+            buttonLabel = "Insert Front";
+            tooltipText = "Insert at the front (splits the head node when it is full)";
+            break;
+        case OperationMode::InsertBack:
+            buttonLabel = "Insert Back";
+            tooltipText = "Append to the tail node, or start a new node when it is full";
+            break;
+        case OperationMode::InsertAt:
+            buttonLabel = "Insert At";
+            tooltipText = "Insert at an index (a full node splits in two first)";
+            canExecute = index <= m_list.size();
+            break;
+        case OperationMode::DeleteFront:
+            buttonLabel = "Delete Front";
+            tooltipText = "Delete the first element";
+            canExecute = !m_list.isEmpty();
+            break;
+        case OperationMode::DeleteBack:
+            buttonLabel = "Delete Back";
+            tooltipText = "Delete the last element";
+            canExecute = !m_list.isEmpty();
+            break;
+        case OperationMode::DeleteAt:
+            buttonLabel = "Delete At";
+            tooltipText = "Delete at an index (a node under half full borrows or merges)";
+            canExecute = index < m_list.size();
+            break;
+        case OperationMode::Search:
+            buttonLabel = "Search";
+            tooltipText = "Scan node by node for a value";
+            canExecute = !m_list.isEmpty();
+            break;
+    }
+
+    if (!canExecute) {
+        ImGui::BeginDisabled();
+    }
+
+    if (ui::ButtonPrimary(buttonLabel, ImVec2(200, 0))) {
+        switch (m_currentMode) {
+            case OperationMode::InsertFront: insertFrontValue(m_inputValue); break;
+            case OperationMode::InsertBack:  insertBackValue(m_inputValue); break;
+            case OperationMode::InsertAt:    insertAtValue(index, m_inputValue); break;
+            case OperationMode::DeleteFront: deleteFrontValue(); break;
+            case OperationMode::DeleteBack:  deleteBackValue(); break;
+            case OperationMode::DeleteAt:    deleteAtValue(index); break;
+            case OperationMode::Search:      searchValue(m_inputValue); break;
+        }
+    }
+
+    if (!canExecute) {
+        ImGui::EndDisabled();
+    }
+
+    ImGui::EndDisabled();
+    ui::Tooltip(tooltipText);
+
+    ImGui::Spacing();
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Initialize operation
+    ImGui::Text("Initialize:");
+    ImGui::PushItemWidth(150.0f);
+    ImGui::InputInt("Count", &m_initCount);
+    m_initCount = std::clamp(m_initCount, 1, MAX_INIT_COUNT);
+    ImGui::PopItemWidth();
+
+    ImGui::BeginDisabled(isAnimating());
+    if (ui::ButtonPrimary("Initialize Random", ImVec2(200, 0))) {
+        initializeRandom(static_cast<size_t>(m_initCount));
+    }
+    ImGui::EndDisabled();
+    ui::Tooltip("Fill list with random values (clears existing list)");
+
+    ImGui::Separator();
+
+    // Playback controls
+    ui::PlaybackControls(
+        m_isPaused,
+        [this]() { play(); },
+        [this]() { pause(); },
+        [this]() { step(); },
+        [this]() { reset(); }
+    );
+
+    ImGui::Spacing();
+    ui::SpeedSlider(m_speed, 0.1f, 5.0f);
+
+    ImGui::Separator();
+
+    // List info
+    ImGui::Text("List Info:");
+    ImGui::Text("Size: %zu elements", m_list.size());
+    ImGui::Text("Nodes: %zu (capacity %zu each)", m_list.nodeCount(), NODE_CAP);
+    if (m_list.nodeCount() > 0) {
+        ImGui::Text("Average fill: %.0f%%",
+                    100.0 * m_list.size() / static_cast<double>(m_list.nodeCount() * NODE_CAP));
+    }
+
+    renderHopReadout();
+
+    ImGui::End();
+}
+
+void UnrolledListVisualizer::renderHopReadout() {
+    ImGui::Separator();
+    ImGui::Text("Pointer Hops:");
+    if (!OpCounted::countingEnabled()) {
+        ImGui::TextDisabled("Operation counting is compiled out");
+        return;
+    }
+    if (m_hopOperation.empty()) {
+        ImGui::TextDisabled("Run an operation to count its hops");
+        return;
+    }
+    ImGui::Text("Last: %s", m_hopOperation.c_str());
+    ImGui::BulletText("Unrolled list: %llu", static_cast<unsigned long long>(m_lastHops));
+    ImGui::BulletText("Linked list: %llu", static_cast<unsigned long long>(m_linkedHops));
+    ui::Tooltip("Hops the same operation needs in a LinkedList holding one value per node.\n"
+                "Every hop is a dependent load, and a likely cache miss on a large list");
+}
+
+void UnrolledListVisualizer::insertFrontValue(int value) {
+    HopMark before = markHops();
+    m_list.insertFront(value);
+    m_linked.insertFront(value);
+    recordHops("Insert Front", before);
+
+    syncVisuals();
+    std::ostringstream oss;
+    oss << "Inserted " << value << " at front";
+    flashElement(0, colors::semantic::sorted, oss.str());
+}
+
+void UnrolledListVisualizer::insertBackValue(int value) {
+    HopMark before = markHops();
+    m_list.insertBack(value);
+    m_linked.insertBack(value);
+    recordHops("Insert Back", before);
+
+    syncVisuals();
+    std::ostringstream oss;
+    oss << "Inserted " << value << " at back";
+    flashElement(m_list.size() - 1, colors::semantic::sorted, oss.str());
+}
+
+void UnrolledListVisualizer::insertAtValue(size_t index, int value) {
+    if (index > m_list.size()) {
+        m_statusText = "Error: Index out of range!";
+        return;
+    }
+
+    size_t nodesBefore = m_list.nodeCount();
+    HopMark before = markHops();
+    m_list.insertAt(index, value);
+    m_linked.insertAt(index, value);
+    recordHops("Insert At", before);
+
+    syncVisuals();
+    std::ostringstream oss;
+    oss << "Inserted " << value << " at index " << index;
+    if (m_list.nodeCount() > nodesBefore && index + 1 < m_list.size()) {
+        oss << " (full node split)";
+    }
+    flashElement(index, colors::semantic::sorted, oss.str());
+}
+
+void UnrolledListVisualizer::deleteFrontValue() {
+    if (m_list.isEmpty()) {
+        m_statusText = "Error: List is empty!";
+        return;
+    }
+    animateDelete(0, "Delete Front");
+}
+
+void UnrolledListVisualizer::deleteBackValue() {
+    if (m_list.isEmpty()) {
+        m_statusText = "Error: List is empty!";
+        return;
+    }
+    animateDelete(m_list.size() - 1, "Delete Back");
+}
+
+void UnrolledListVisualizer::deleteAtValue(size_t index) {
+    if (index >= m_list.size()) {
+        m_statusText = "Error: Index out of range!";
+        return;
+    }
+    animateDelete(index, "Delete At");
+}
+
+void UnrolledListVisualizer::animateDelete(size_t index, const char* operation) {
+    std::ostringstream oss;
+    oss << "Deleting element at index " << index << "...";
+    m_statusText = oss.str();
+
+    auto& slot = m_slots[m_slotOfElement[index]];
+    Animation flashRed = createColorAnimation(slot.color, colors::semantic::error, 0.3f);
+    flashRed.onComplete = [this, index, operation]() {
+        size_t nodesBefore = m_list.nodeCount();
+        HopMark before = markHops();
+        std::optional<int> value;
+        if (index == 0) {
+            value = m_list.deleteFront();
+            m_linked.deleteFront();
+        } else if (index + 1 == m_list.size()) {
+            value = m_list.deleteBack();
+            m_linked.deleteBack();
+        } else {
+            value = m_list.deleteAt(index);
+            m_linked.deleteAt(index);
+        }
+        recordHops(operation, before);
+        syncVisuals();
+
+        std::ostringstream oss;
+        oss << "Deleted " << value.value_or(0) << " from index " << index;
+        if (m_list.nodeCount() < nodesBefore) {
+            oss << " (node merged away)";
+        }
+        m_statusText = oss.str();
+    };
+    m_animator.enqueue(flashRed);
+}
+
+void UnrolledListVisualizer::searchValue(int value) {
+    if (m_list.isEmpty()) {
+        m_statusText = "Error: List is empty!";
+        return;
+    }
+
+    std::ostringstream oss;
+    oss << "Searching for " << value << "...";
+    m_statusText = oss.str();
+
+    // Count both lists' hops for the same search up front
+    HopMark before = markHops();
+    std::optional<size_t> found = m_list.find(value);
+    m_linked.find(value);
+    recordHops("Search", before);
+
+    // Animate: light up one node at a time, then its matching slot
+    size_t base = 0;
+    for (const VisualChunk& chunk : m_chunks) {
+        std::vector<Animation> checking;
+        std::vector<Animation> restore;
+        for (size_t i = 0; i < chunk.count; ++i) {
+            auto& slot = m_slots[chunk.firstSlot + i];
+            checking.push_back(createColorAnimation(slot.color, colors::semantic::comparing, 0.2f));
+            restore.push_back(createColorAnimation(slot.color, colors::semantic::elementBase, 0.2f));
+        }
+        m_animator.enqueueParallel(std::move(checking));
+
+        bool inChunk = found && *found < base + chunk.count;
+        if (inChunk) {
+            size_t index = *found;
+            Animation highlightFound = createColorAnimation(
+                m_slots[m_slotOfElement[index]].color, colors::semantic::sorted, 0.3f);
+            highlightFound.onComplete = [this, value, index]() {
+                std::ostringstream oss;
+                oss << "Found " << value << " at index " << index;
+                m_statusText = oss.str();
+            };
+            m_animator.enqueue(highlightFound);
+        } else if (&chunk == &m_chunks.back()) {
+            restore.back().onComplete = [this, value]() {
+                std::ostringstream oss;
+                oss << "Value " << value << " not found in list";
+                m_statusText = oss.str();
+            };
+        }
+        m_animator.enqueueParallel(std::move(restore));
+
+        if (inChunk) {
+            break;
+        }
+        base += chunk.count;
+    }
+}
+
+void UnrolledListVisualizer::initializeRandom(size_t count) {
+    m_list.clear();
+    m_linked.clear();
+    m_animator.clear();
+
+    // Generate random values
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dis(1, 99);
+
+    std::vector<int> values(count);
+    for (int& value : values) {
+        value = dis(gen);
+    }
+
+    HopMark before = markHops();
+    m_list.appendRange(values.begin(), values.end());
+    m_linked.appendRange(values.begin(), values.end());
+    recordHops("Initialize Random", before);
+    syncVisuals();
+
+    // Cascade each node into place
+    for (const VisualChunk& chunk : m_chunks) {
+        std::vector<Animation> appear;
+        for (size_t i = 0; i < chunk.count; ++i) {
+            auto& slot = m_slots[chunk.firstSlot + i];
+            slot.color = colors::semantic::sorted;
+            appear.push_back(createColorAnimation(slot.color, colors::semantic::elementBase, 0.15f));
+        }
+        m_animator.enqueueParallel(std::move(appear));
+    }
+
+    std::ostringstream oss;
+    oss << "Initialized list with " << count << " random values in " << m_list.nodeCount() << " nodes";
+    m_statusText = oss.str();
+
+    // Reset camera position and zoom
+    m_cameraOffsetX = 0.0f;
+    m_zoomLevel = 1.0f;
+}
+
+void UnrolledListVisualizer::play() {
+    m_isPaused = false;
+    m_animator.setPaused(false);
+}
+
+void UnrolledListVisualizer::pause() {
+    m_isPaused = true;
+    m_animator.setPaused(true);
+}
+
+void UnrolledListVisualizer::step() {
+    m_animator.stepForward();
+}
+
+void UnrolledListVisualizer::reset() {
+    m_list.clear();
+    m_linked.clear();
+    m_animator.clear();
+    m_hopOperation.clear();
+
+    for (int value : {10, 20, 30, 40, 50, 60}) {
+        m_list.insertBack(value);
+        m_linked.insertBack(value);
+    }
+    syncVisuals();
+
+    m_statusText = "List reset";
+    m_isPaused = true;
+}
+
+void UnrolledListVisualizer::setSpeed(float speed) {
+    m_speed = speed;
+    m_animator.setSpeedMultiplier(speed);
+}
+
+std::string UnrolledListVisualizer::getStatusText() const {
+    return m_statusText;
+}
+
+bool UnrolledListVisualizer::isAnimating() const {
+    return m_animator.hasAnimations();
+}
+
+bool UnrolledListVisualizer::isPaused() const {
+    return m_isPaused;
+}
+
+UnrolledListVisualizer::HopMark UnrolledListVisualizer::markHops() const {
+    return HopMark{m_list.opCounters().hops, m_linked.opCounters().hops};
+}
+
+void UnrolledListVisualizer::recordHops(const char* operation, const HopMark& before) {
+    m_hopOperation = operation;
+    m_lastHops = m_list.opCounters().hops - before.unrolled;
+    m_linkedHops = m_linked.opCounters().hops - before.linked;
+}
+
+void UnrolledListVisualizer::syncVisuals() {
+    m_sceneVersion++;
+    m_chunks.clear();
+    m_slots.clear();
+    m_slotOfElement.clear();
+
+    glm::vec4 emptyColor = colors::withAlpha(colors::mocha::surface1, 0.4f);
+    float chunkPitch = NODE_CAP * SLOT_WIDTH + 2.0f * CHUNK_PADDING + CHUNK_GAP;
+
+    for (auto node = m_list.head(); node; node = node.next()) {
+        VisualChunk chunk;
+        chunk.position = glm::vec2(START_X + m_chunks.size() * chunkPitch, START_Y);
+        chunk.firstSlot = m_slots.size();
+        chunk.count = node->count;
+        chunk.fillLabel = labels::intern(std::to_string(node->count) + "/" + std::to_string(NODE_CAP));
+
+        for (size_t i = 0; i < NODE_CAP; ++i) {
+            VisualSlot slot;
+            slot.isLive = i < node->count;
+            if (slot.isLive) {
+                slot.color = colors::semantic::elementBase;
+                slot.borderColor = colors::semantic::elementBorder;
+                slot.label = labels::fromInt(node->items[i]);
+                m_slotOfElement.push_back(m_slots.size());
+            } else {
+                slot.color = emptyColor;
+                slot.borderColor = colors::mocha::surface2;
+            }
+            m_slots.push_back(slot);
+        }
+        m_chunks.push_back(chunk);
+    }
+}
+
+void UnrolledListVisualizer::flashElement(size_t index, const glm::vec4& color, const std::string& message) {
+    if (index >= m_slotOfElement.size()) {
+        m_statusText = message;
+        return;
+    }
+
+    auto& slot = m_slots[m_slotOfElement[index]];
+    m_animator.enqueue(createColorAnimation(slot.color, color, 0.3f));
+
+    Animation flashBack = createColorAnimation(slot.color, colors::semantic::elementBase, 0.3f);
+    flashBack.onComplete = [this, message]() {
+        m_statusText = message;
+    };
+    m_animator.enqueue(flashBack);
+}
+
+void UnrolledListVisualizer::drawArrow(ImDrawList* drawList, const ImVec2& from, const ImVec2& to, ImU32 color) {
+    // Draw line
+    drawList->AddLine(from, to, color, 2.0f);
+
+    // Draw arrowhead
+    float angle = std::atan2(to.y - from.y, to.x - from.x);
+    float arrowSize = 10.0f;
+
+    ImVec2 p1 = ImVec2(
+        to.x - arrowSize * std::cos(angle - 0.5f),
+        to.y - arrowSize * std::sin(angle - 0.5f)
+    );
+    ImVec2 p2 = ImVec2(
+        to.x - arrowSize * std::cos(angle + 0.5f),
+        to.y - arrowSize * std::sin(angle + 0.5f)
+    );
+
+    drawList->AddTriangleFilled(to, p1, p2, color);
+}
+
+} // namespace dsav
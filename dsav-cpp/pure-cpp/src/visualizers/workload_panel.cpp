@@ -0,0 +1,177 @@
+/**
+ * @file workload_panel.cpp
+ * @brief Workload script controls and batched replay driving
+ */
+
+#include "visualizers/workload_panel.hpp"
+#include "ui_components.hpp"
+#include <algorithm>
+#include <imgui.h>
+
+namespace dsav {
+
+bool WorkloadPanel::render() {
+    bool changed = false;
+
+    // ===== Script =====
+    ImGui::InputText("Script", m_path, sizeof(m_path));
+    ui::Tooltip("One op per line (insert 5, remove 5, search 5, push 5, pop,\n"
+                "enqueue 5, dequeue, peek; # starts a comment) or a binary workload");
+    const char* formats[] = {"Auto", "Text", "Binary"};  // Indexed by algorithms::WorkloadFormat
+    ImGui::Combo("Script Format", &m_format, formats, IM_ARRAYSIZE(formats));
+
+    ImGui::BeginDisabled(m_path[0] == '\0' || m_replay.isActive());
+    if (ImGui::Button("Load Script")) {
+        loadScript();
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(m_path[0] == '\0' || !m_script);
+    if (ImGui::Button("Save Script")) {
+        saveScript();
+    }
+    ImGui::EndDisabled();
+
+    ImGui::InputInt("Ops", &m_generateOps, 1000, 100000);
+    m_generateOps = std::clamp(m_generateOps, 1, MAX_GENERATE_OPS);
+    ImGui::SliderInt("Insert %", &m_insertWeight, 0, 100);
+    ImGui::SliderInt("Remove %", &m_removeWeight, 0, 100);
+    ImGui::SliderInt("Search %", &m_searchWeight, 0, 100);
+    ImGui::InputInt("Burst", &m_burst);
+    m_burst = std::clamp(m_burst, 1, 1 << 16);
+    ui::Tooltip("Ops of the same kind in a row (push/pop bursts)");
+    ImGui::InputInt("Key Range", &m_keyRange, 100, 10000);
+    m_keyRange = std::max(m_keyRange, 0);
+    ui::Tooltip("Operands are drawn from [1, range] (0 = the op count)");
+    ImGui::BeginDisabled(m_replay.isActive());
+    if (ImGui::Button("Generate Script")) {
+        generateScript();
+    }
+    ImGui::EndDisabled();
+
+    if (m_script) {
+        ImGui::Text("%zu ops: %zu insert, %zu remove, %zu search", m_script->size(),
+                    m_script->count(algorithms::WorkloadOpCode::Insert),
+                    m_script->count(algorithms::WorkloadOpCode::Remove),
+                    m_script->count(algorithms::WorkloadOpCode::Search));
+    }
+    if (!m_message.empty()) {
+        ImGui::TextWrapped("%s", m_message.c_str());
+    }
+
+    // ===== Replay =====
+    ImGui::Separator();
+    if (ImGui::InputInt("Animate Every", &m_sampleEvery, 10, 1000)) {
+        m_sampleEvery = std::max(m_sampleEvery, 0);
+        m_replay.setSampleEvery(static_cast<size_t>(m_sampleEvery));
+    }
+    ui::Tooltip("Animate every n-th op; the ops in between are applied\n"
+                "in batches (0 = animate none)");
+    ImGui::SliderInt("Ops per Frame", &m_batch, 1, MAX_BATCH, "%d", ImGuiSliderFlags_Logarithmic);
+
+    if (!m_replay.isActive()) {
+        ImGui::BeginDisabled(!m_script || m_script->empty() || !m_hooks.apply);
+        if (ImGui::Button("Start Replay")) {
+            // Replays start from whatever the container holds now
+            m_replay.begin(m_script, m_hooks, static_cast<size_t>(m_sampleEvery));
+            m_playing = true;
+        }
+        ImGui::EndDisabled();
+        return changed;
+    }
+
+    if (ImGui::Button(m_playing ? "Pause Replay" : "Play Replay")) {
+        m_playing = !m_playing && !m_replay.atEnd();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Stop Replay")) {
+        stop();
+        return changed;
+    }
+
+    int position = static_cast<int>(m_replay.position());
+    if (ImGui::SliderInt("Replay", &position, 0, static_cast<int>(m_replay.size()))) {
+        changed = seek(static_cast<size_t>(position));
+    }
+    ImGui::Text("Keyframes: %zu every %zu ops, %.1f MB", m_replay.keyframeCount(), m_replay.keyframeInterval(),
+                static_cast<double>(m_replay.memoryUsage()) / (1024.0 * 1024.0));
+    return changed;
+}
+
+bool WorkloadPanel::advance(const std::function<void(const algorithms::WorkloadOp&)>& animate) {
+    if (!m_playing || !m_replay.isActive()) {
+        return false;
+    }
+
+    // The animation of the last sampled op (and any change it deferred) has finished
+    m_replay.commitSampled();
+    if (m_replay.atEnd()) {
+        m_playing = false;
+        return false;
+    }
+    if (m_replay.atSample()) {
+        animate(m_replay.current());
+        m_replay.beginSampled();
+        return false;
+    }
+    return m_replay.runSilently(static_cast<size_t>(m_batch)) > 0;
+}
+
+bool WorkloadPanel::seek(size_t step) {
+    if (!m_replay.isActive()) {
+        return false;
+    }
+    m_playing = false;
+    m_replay.seek(step);
+    return true;
+}
+
+void WorkloadPanel::stop() {
+    m_playing = false;
+    m_replay.clear();
+}
+
+std::string WorkloadPanel::statusText() const {
+    std::string text = "Replay: " + std::to_string(m_replay.position()) + " / " +
+                       std::to_string(m_replay.size()) + " ops";
+    if (m_replay.atEnd()) {
+        text += " (finished)";
+    } else if (m_replay.sampleEvery() > 0) {
+        text += " (1 in " + std::to_string(m_replay.sampleEvery()) + " animated)";
+    }
+    return text;
+}
+
+void WorkloadPanel::loadScript() {
+    auto script = std::make_shared<algorithms::WorkloadScript>();
+    if (!script->load(m_path, static_cast<algorithms::WorkloadFormat>(m_format))) {
+        m_message = "Load failed: " + script->error();
+        return;
+    }
+    m_script = std::move(script);
+    m_message = "Loaded " + std::string(m_path);
+}
+
+void WorkloadPanel::saveScript() {
+    // Auto writes binary
+    auto format = static_cast<algorithms::WorkloadFormat>(m_format);
+    m_message = m_script->save(m_path, format)
+        ? "Saved " + std::string(m_path)
+        : "Save failed: " + m_script->error();
+}
+
+void WorkloadPanel::generateScript() {
+    algorithms::WorkloadMix mix;
+    mix.insertWeight = static_cast<unsigned>(m_insertWeight);
+    mix.removeWeight = static_cast<unsigned>(m_removeWeight);
+    mix.searchWeight = static_cast<unsigned>(m_searchWeight);
+    mix.burst = static_cast<size_t>(m_burst);
+    mix.keyRange = m_keyRange;
+
+    auto script = std::make_shared<algorithms::WorkloadScript>();
+    script->generate(static_cast<size_t>(m_generateOps), mix, static_cast<std::uint32_t>(m_seed++));
+    m_script = std::move(script);
+    m_message = "Generated " + std::to_string(m_script->size()) + " ops";
+}
+
+} // namespace dsav